@@ -93,6 +93,10 @@ elseif(CC_IS_EMSCRIPTEN)
     set(EMCC_CMAKE_TOOLCHAIN "" CACHE FILEPATH "Path to EMCC CMake Emscripten.cmake")
     set(EMCC_INCLUDE_PATH "." CACHE PATH "Path to EMCC include dir")
     set(EMCC_COMPILE_FLAGS "--bind -o .html --preload-file ../../files")
+    if (BUILD_WASM_AUDIO_WORKLET)
+        # the worklet thread shares the memory, so everything is compiled with the atomics
+        set(EMCC_COMPILE_FLAGS "${EMCC_COMPILE_FLAGS} -s WASM_WORKERS=1")
+    endif()
 
     set(CMAKE_RUNTIME_OUTPUT_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}/public_html)
     set(CMAKE_EXECUTABLE_SUFFIX ".html")
@@ -0,0 +1,113 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+var Score = require("steps/Score.js")
+
+//! NOTE The scores are looked up in the testing files dirs of the autobot
+var scores = [
+    "Big_Score.mscz"
+]
+
+var ROUNDS = 4
+var NOTES = ["note-c", "note-d", "note-e", "note-f", "note-g", "note-a", "note-b"]
+
+var undoCount = 0
+
+function measure(scoreName, action, isUndoable)
+{
+    api.latency.measure(action, scoreName + "/" + action)
+    if (isUndoable) {
+        undoCount += 1
+    }
+}
+
+function scoreSteps(scoreName)
+{
+    return [
+        {name: scoreName + ": open", func: function() {
+            api.autobot.openProject(scoreName)
+            Score.focusIn()
+            api.dispatcher.dispatch("first-element")
+            undoCount = 0
+        }},
+        {name: scoreName + ": note input", func: function() {
+            measure(scoreName, "note-input", false)
+            measure(scoreName, "pad-note-8", false)
+            for (var r = 0; r < ROUNDS; ++r) {
+                for (var i = 0; i < NOTES.length; ++i) {
+                    measure(scoreName, NOTES[i], true)
+                }
+            }
+            measure(scoreName, "notation-escape", false)
+        }},
+        {name: scoreName + ": transpose", func: function() {
+            api.dispatcher.dispatch("first-element")
+            for (var i = 0; i < 7; ++i) {
+                api.dispatcher.dispatch("select-next-chord")
+            }
+            for (var r = 0; r < ROUNDS; ++r) {
+                measure(scoreName, "pitch-up", true)
+                measure(scoreName, "pitch-down", true)
+            }
+        }},
+        {name: scoreName + ": copy and paste", func: function() {
+            for (var r = 0; r < ROUNDS; ++r) {
+                measure(scoreName, "notation-copy", false)
+                api.dispatcher.dispatch("notation-move-right")
+                measure(scoreName, "notation-paste", true)
+            }
+        }},
+        {name: scoreName + ": undo", func: function() {
+            //! NOTE Undo all the changes, so the score can be closed without a question
+            while (undoCount > 0) {
+                measure(scoreName, "undo", false)
+                undoCount -= 1
+            }
+        }},
+        {name: scoreName + ": close", func: function() {
+            api.dispatcher.dispatch("file-close")
+        }}
+    ]
+}
+
+function main()
+{
+    var steps = []
+    for (var i = 0; i < scores.length; ++i) {
+        steps = steps.concat(scoreSteps(scores[i]))
+    }
+
+    steps.push({name: "Save report", func: function() {
+        var path = api.latency.saveReport()
+        api.log.info("latency report: " + path)
+    }})
+
+    var testCase = {
+        name: "TC10: Interaction latency",
+        description: "Measure the time from an action to the paint of the notation",
+        steps: steps
+    };
+
+    api.latency.beginRun("TC10_InteractionLatency")
+    api.autobot.setInterval(500)
+    api.autobot.runTestCase(testCase)
+}
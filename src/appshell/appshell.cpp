@@ -25,6 +25,7 @@
 #include "config.h"
 
 #include <QApplication>
+#include <QElapsedTimer>
 #include <QQmlApplicationEngine>
 #include <QQuickWindow>
 #include <QStyleHints>
@@ -41,9 +42,12 @@
 #include "version.h"
 
 #include "commandlinecontroller.h"
+#include "internal/moduleinittimes.h"
 
 #include "framework/global/globalmodule.h"
 
+#include "concurrency/taskscheduler.h"
+
 #include "log.h"
 
 using namespace mu::appshell;
@@ -62,6 +66,9 @@ void AppShell::addModule(modularity::IModuleSetup* module)
 
 int AppShell::run(int argc, char** argv)
 {
+    QElapsedTimer startupTimer;
+    startupTimer.start();
+
     // ====================================================
     // Setup global Qt application variables
     // ====================================================
@@ -118,22 +125,27 @@ int AppShell::run(int argc, char** argv)
     // ====================================================
     // Setup modules: Resources, Exports, Imports, UiTypes
     // ====================================================
+    QElapsedTimer setupTimer;
+    setupTimer.start();
+
+    ModuleInitTimes initTimes;
+
     globalModule.registerResources();
     globalModule.registerExports();
     globalModule.registerUiTypes();
 
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->registerResources();
+        initTimes.measure(m->moduleName(), "registerResources", [m]() { m->registerResources(); });
     }
 
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->registerExports();
+        initTimes.measure(m->moduleName(), "registerExports", [m]() { m->registerExports(); });
     }
 
     globalModule.resolveImports();
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->registerUiTypes();
-        m->resolveImports();
+        initTimes.measure(m->moduleName(), "registerUiTypes", [m]() { m->registerUiTypes(); });
+        initTimes.measure(m->moduleName(), "resolveImports", [m]() { m->resolveImports(); });
     }
 
     // ====================================================
@@ -149,7 +161,7 @@ int AppShell::run(int argc, char** argv)
     // ====================================================
     globalModule.onPreInit(runMode);
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->onPreInit(runMode);
+        initTimes.measure(m->moduleName(), "onPreInit", [m, runMode]() { m->onPreInit(runMode); });
     }
 
     SplashScreen* splashScreen = nullptr;
@@ -161,9 +173,32 @@ int AppShell::run(int argc, char** argv)
     // ====================================================
     // Setup modules: onInit
     // ====================================================
+    //! NOTE The concurrent init of each module is started right after its onInit,
+    //! so it overlaps the onInit of the next modules
+    std::vector<std::future<void> > concurrentInits;
+
     globalModule.onInit(runMode);
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->onInit(runMode);
+        initTimes.measure(m->moduleName(), "onInit", [m, runMode]() { m->onInit(runMode); });
+
+        concurrentInits.push_back(TaskScheduler::instance()->submit([m, runMode, &initTimes]() {
+            initTimes.measure(m->moduleName(), "onConcurrentInit", [m, runMode]() { m->onConcurrentInit(runMode); }, true);
+        }));
+    }
+
+    {
+        QElapsedTimer waitTimer;
+        waitTimer.start();
+
+        for (std::future<void>& f : concurrentInits) {
+            try {
+                f.get();
+            } catch (const std::exception& e) {
+                LOGE() << "concurrent init failed: " << e.what();
+            }
+        }
+
+        initTimes.add({ "appshell", "waitConcurrentInit", static_cast<double>(waitTimer.nsecsElapsed()) / 1000000.0 });
     }
 
     // ====================================================
@@ -171,9 +206,11 @@ int AppShell::run(int argc, char** argv)
     // ====================================================
     globalModule.onAllInited(runMode);
     for (mu::modularity::IModuleSetup* m : m_modules) {
-        m->onAllInited(runMode);
+        initTimes.measure(m->moduleName(), "onAllInited", [m, runMode]() { m->onAllInited(runMode); });
     }
 
+    initTimes.print(static_cast<double>(setupTimer.nsecsElapsed()) / 1000000.0);
+
     // ====================================================
     // Setup modules: onStartApp (on next event loop)
     // ====================================================
@@ -204,7 +241,9 @@ int AppShell::run(int argc, char** argv)
             // Process Converter
             // ====================================================
             CommandLineController::ConverterTask task = commandLine.converterTask();
-            QMetaObject::invokeMethod(qApp, [this, task]() {
+            QMetaObject::invokeMethod(qApp, [this, task, startupTimer]() {
+                    LOGI() << "converter startup: " << startupTimer.elapsed() << " ms";
+
                     int code = processConverter(task);
                     qApp->exit(code);
                 }, Qt::QueuedConnection);
@@ -289,6 +328,11 @@ int AppShell::run(int argc, char** argv)
 
     PROFILER_PRINT;
 
+    QString traceOutput = commandLine.diagnostic().traceOutput;
+    if (!traceOutput.isEmpty()) {
+        PROFILER_TRACE_SAVE(traceOutput.toStdString());
+    }
+
     // Wait Thread Poll
 #ifndef Q_OS_WASM
     QThreadPool* globalThreadPool = QThreadPool::globalInstance();
@@ -329,9 +373,15 @@ int AppShell::processConverter(const CommandLineController::ConverterTask& task)
     bool forceMode = task.params[CommandLineController::ParamKey::ForceMode].toBool();
 
     switch (task.type) {
-    case CommandLineController::ConvertType::Batch:
-        ret = converter()->batchConvert(task.inputFile, stylePath, forceMode);
-        break;
+    case CommandLineController::ConvertType::Batch: {
+        size_t workerCount = task.params.value(CommandLineController::ParamKey::BatchJobWorkers, 1).toUInt();
+        io::path_t reportPath = task.params[CommandLineController::ParamKey::BatchJobReportPath].toString();
+        ret = converter()->batchConvert(task.inputFile, stylePath, forceMode, workerCount, reportPath);
+    } break;
+    case CommandLineController::ConvertType::JobServer: {
+        std::string serverName = task.params[CommandLineController::ParamKey::JobServerName].toString().toStdString();
+        ret = converter()->runJobServer(serverName, stylePath, forceMode);
+    } break;
     case CommandLineController::ConvertType::ConvertScoreParts:
         ret = converter()->convertScoreParts(task.inputFile, task.outputFile, stylePath);
         break;
@@ -345,6 +395,12 @@ int AppShell::processConverter(const CommandLineController::ConverterTask& task)
     case CommandLineController::ConvertType::ExportScoreMeta:
         ret = converter()->exportScoreMeta(task.inputFile, task.outputFile, stylePath, forceMode);
         break;
+    case CommandLineController::ConvertType::ExportScoreLayoutStatistics:
+        ret = converter()->exportScoreLayoutStatistics(task.inputFile, task.outputFile, stylePath, forceMode);
+        break;
+    case CommandLineController::ConvertType::ExportScoreMemoryReport:
+        ret = converter()->exportScoreMemoryReport(task.inputFile, task.outputFile, stylePath, forceMode);
+        break;
     case CommandLineController::ConvertType::ExportScoreParts:
         ret = converter()->exportScoreParts(task.inputFile, task.outputFile, stylePath, forceMode);
         break;
@@ -379,19 +435,36 @@ int AppShell::processDiagnostic(const CommandLineController::Diagnostic& task)
 
     Ret ret = make_ret(Ret::Code::Ok);
 
-    io::path_t input = task.input;
+    io::paths_t input;
+    for (const QString& path : task.input) {
+        input.push_back(path);
+    }
+
     io::path_t output = task.output;
 
+    if (input.empty()) {
+        LOGE() << "no diagnostic input";
+        return static_cast<int>(Ret::Code::UnknownError);
+    }
+
     if (output.empty()) {
         output = "./";
     }
 
     switch (task.type) {
     case CommandLineController::DiagnosticType::GenDrawData:
-        ret = engravingDrawProvider()->genDrawData(input, output);
+        ret = engravingDrawProvider()->genDrawData(input.front(), output);
+        break;
+    case CommandLineController::DiagnosticType::ComDrawData:
+        if (input.size() != 2) {
+            LOGE() << "expected the reference and the current draw data dirs";
+            ret = make_ret(Ret::Code::UnknownError);
+            break;
+        }
+        ret = engravingDrawProvider()->compareDrawData(input.at(0), input.at(1), output);
         break;
     case CommandLineController::DiagnosticType::DrawDataToPng:
-        ret = engravingDrawProvider()->drawDataToPng(input, output);
+        ret = engravingDrawProvider()->drawDataToPng(input.front(), output);
         break;
     default:
         break;
@@ -186,12 +186,19 @@ void AppShellModule::onPreInit(const framework::IApplication::RunMode&)
     s_applicationActionController->preInit();
 }
 
-void AppShellModule::onInit(const IApplication::RunMode&)
+void AppShellModule::onInit(const IApplication::RunMode& mode)
 {
-    DockSetup::onInit();
-
     s_appShellConfiguration->init();
     s_applicationActionController->init();
+
+    //! NOTE The converter doesn't show any window and doesn't keep sessions,
+    //! so it doesn't need the dock actions and the ui actions, and must not save a session per converted file
+    if (IApplication::RunMode::Editor != mode) {
+        return;
+    }
+
+    DockSetup::onInit();
+
     s_applicationUiActions->init();
     s_sessionsManager->init();
 
@@ -53,7 +53,17 @@ void CommandLineController::parse(const QStringList& args)
 
     // Converter mode
     m_parser.addOption(QCommandLineOption({ "r", "image-resolution" }, "Set output resolution for image export", "DPI"));
+    m_parser.addOption(QCommandLineOption("image-export-threads",
+                                          "Set the number of threads painting the pages of the png and svg export, 0 for all the cores",
+                                          "count"));
     m_parser.addOption(QCommandLineOption({ "j", "job" }, "Process a conversion job", "file"));
+    m_parser.addOption(QCommandLineOption("job-workers",
+                                          "Use with '-j <file>', process the jobs in the given number of worker processes", "count"));
+    m_parser.addOption(QCommandLineOption("job-report",
+                                          "Use with '-j <file>', write the status and the time of each job to a JSON file", "file"));
+    m_parser.addOption(QCommandLineOption("job-server",
+                                          "Keep running and process the jobs received on the given local socket, one JSON job per line",
+                                          "name"));
     m_parser.addOption(QCommandLineOption({ "o", "export-to" }, "Export to 'file'. Format depends on file's extension", "file"));
     m_parser.addOption(QCommandLineOption({ "F", "factory-settings" }, "Use factory settings"));
     m_parser.addOption(QCommandLineOption({ "R", "revert-settings" }, "Revert to factory settings, but keep default preferences"));
@@ -66,6 +76,10 @@ void CommandLineController::parse(const QStringList& args)
                                           "Export all media (excepting mp3) for a given score in a single JSON file and print it to stdout"));
     m_parser.addOption(QCommandLineOption("highlight-config", "Set highlight to svg, generated from a given score", "highlight-config"));
     m_parser.addOption(QCommandLineOption("score-meta", "Export score metadata to JSON document and print it to stdout"));
+    m_parser.addOption(QCommandLineOption("score-layout-stats",
+                                          "Lay out the given score and export the time of the layout phases to a JSON document, print it to stdout"));
+    m_parser.addOption(QCommandLineOption("score-memory-report",
+                                          "Export the number and size of the items of the given score by type and the memory held by its subsystems to a JSON document, print it to stdout"));
     m_parser.addOption(QCommandLineOption("score-parts", "Generate parts data for the given score and save them to separate mscz files"));
     m_parser.addOption(QCommandLineOption("score-parts-pdf",
                                           "Generate parts data for the given score and export the data to a single JSON file, print it to stdout"));
@@ -89,6 +103,9 @@ void CommandLineController::parse(const QStringList& args)
     m_parser.addOption(QCommandLineOption("fps", "Frame per second [60, 30, 24]", "24"));
     m_parser.addOption(QCommandLineOption("ls", "Pause before playback in seconds (3.0)", "3.0"));
     m_parser.addOption(QCommandLineOption("ts", "Pause before end of video in seconds (3.0)", "3.0"));
+    m_parser.addOption(QCommandLineOption("video-encoder",
+                                          "Video encoder, ex hardware [h264_nvenc, h264_videotoolbox]. Software H.264 by default",
+                                          "encoder"));
 
     m_parser.addOption(QCommandLineOption("gp-linked", "create tabulature linked staves for guitar pro"));
     m_parser.addOption(QCommandLineOption("gp-experimental", "experimental features for guitar pro import"));
@@ -99,7 +116,12 @@ void CommandLineController::parse(const QStringList& args)
     // Diagnostic
     m_parser.addOption(QCommandLineOption("diagnostic-output", "Diagnostic output", "output"));
     m_parser.addOption(QCommandLineOption("diagnostic-gen-drawdata", "Generate engraving draw data", "scores-dir"));
+    m_parser.addOption(QCommandLineOption("diagnostic-com-drawdata",
+                                          "Compare engraving draw data, given twice: the reference and the current dirs", "dir"));
     m_parser.addOption(QCommandLineOption("diagnostic-drawdata-to-png", "Convert draw data to png", "file"));
+    m_parser.addOption(QCommandLineOption("diagnostic-trace",
+                                          "Record a trace of the profiled functions and save it on quit, "
+                                          "in the Chrome trace event format", "file"));
 
     m_parser.process(args);
 }
@@ -193,6 +215,15 @@ void CommandLineController::apply()
         }
     }
 
+    if (m_parser.isSet("image-export-threads")) {
+        std::optional<int> val = intValue("image-export-threads");
+        if (val && val.value() >= 0) {
+            imagesExportConfiguration()->setExportThreadCount(val);
+        } else {
+            LOGE() << "Option: --image-export-threads not recognized thread count: " << m_parser.value("image-export-threads");
+        }
+    }
+
     if (m_parser.isSet("o")) {
         application()->setRunMode(IApplication::RunMode::Converter);
         m_converterTask.type = ConvertType::File;
@@ -219,6 +250,25 @@ void CommandLineController::apply()
         application()->setRunMode(IApplication::RunMode::Converter);
         m_converterTask.type = ConvertType::Batch;
         m_converterTask.inputFile = m_parser.value("j");
+
+        if (m_parser.isSet("job-workers")) {
+            std::optional<int> val = intValue("job-workers");
+            if (val && val.value() > 0) {
+                m_converterTask.params[CommandLineController::ParamKey::BatchJobWorkers] = val.value();
+            } else {
+                LOGE() << "Option: --job-workers not recognized worker count: " << m_parser.value("job-workers");
+            }
+        }
+
+        if (m_parser.isSet("job-report")) {
+            m_converterTask.params[CommandLineController::ParamKey::BatchJobReportPath] = m_parser.value("job-report");
+        }
+    }
+
+    if (m_parser.isSet("job-server")) {
+        application()->setRunMode(IApplication::RunMode::Converter);
+        m_converterTask.type = ConvertType::JobServer;
+        m_converterTask.params[CommandLineController::ParamKey::JobServerName] = m_parser.value("job-server");
     }
 
     if (m_parser.isSet("score-media")) {
@@ -236,6 +286,18 @@ void CommandLineController::apply()
         m_converterTask.inputFile = scorefiles[0];
     }
 
+    if (m_parser.isSet("score-layout-stats")) {
+        application()->setRunMode(IApplication::RunMode::Converter);
+        m_converterTask.type = ConvertType::ExportScoreLayoutStatistics;
+        m_converterTask.inputFile = scorefiles[0];
+    }
+
+    if (m_parser.isSet("score-memory-report")) {
+        application()->setRunMode(IApplication::RunMode::Converter);
+        m_converterTask.type = ConvertType::ExportScoreMemoryReport;
+        m_converterTask.inputFile = scorefiles[0];
+    }
+
     if (m_parser.isSet("score-parts")) {
         application()->setRunMode(IApplication::RunMode::Converter);
         m_converterTask.type = ConvertType::ExportScoreParts;
@@ -331,6 +393,10 @@ void CommandLineController::apply()
         if (m_parser.isSet("ts")) {
             videoExportConfiguration()->setTrailingSec(doubleValue("ts"));
         }
+
+        if (m_parser.isSet("video-encoder")) {
+            videoExportConfiguration()->setEncoder(m_parser.value("video-encoder").toStdString());
+        }
     }
 #endif
 
@@ -383,13 +449,24 @@ void CommandLineController::apply()
     if (m_parser.isSet("diagnostic-gen-drawdata")) {
         application()->setRunMode(IApplication::RunMode::Converter);
         m_diagnostic.type = DiagnosticType::GenDrawData;
-        m_diagnostic.input = m_parser.value("diagnostic-gen-drawdata");
+        m_diagnostic.input << m_parser.value("diagnostic-gen-drawdata");
+    }
+
+    if (m_parser.isSet("diagnostic-com-drawdata")) {
+        application()->setRunMode(IApplication::RunMode::Converter);
+        m_diagnostic.type = DiagnosticType::ComDrawData;
+        m_diagnostic.input = m_parser.values("diagnostic-com-drawdata");
     }
 
     if (m_parser.isSet("diagnostic-drawdata-to-png")) {
         application()->setRunMode(IApplication::RunMode::Converter);
         m_diagnostic.type = DiagnosticType::DrawDataToPng;
-        m_diagnostic.input = m_parser.value("diagnostic-drawdata-to-png");
+        m_diagnostic.input << m_parser.value("diagnostic-drawdata-to-png");
+    }
+
+    if (m_parser.isSet("diagnostic-trace")) {
+        m_diagnostic.traceOutput = m_parser.value("diagnostic-trace");
+        PROFILER_TRACE_START;
     }
 
     // Startup
@@ -62,11 +62,14 @@ public:
         ConvertScoreParts,
         ExportScoreMedia,
         ExportScoreMeta,
+        ExportScoreLayoutStatistics,
+        ExportScoreMemoryReport,
         ExportScoreParts,
         ExportScorePartsPdf,
         ExportScoreTranspose,
         SourceUpdate,
-        ExportScoreVideo
+        ExportScoreVideo,
+        JobServer
     };
 
     enum class ParamKey {
@@ -75,6 +78,9 @@ public:
         ScoreSource,
         ScoreTransposeOptions,
         ForceMode,
+        BatchJobWorkers,
+        BatchJobReportPath,
+        JobServerName,
 
         // Video
     };
@@ -91,13 +97,15 @@ public:
     enum class DiagnosticType {
         Undefined = 0,
         GenDrawData,
+        ComDrawData,
         DrawDataToPng
     };
 
     struct Diagnostic {
         DiagnosticType type = DiagnosticType::Undefined;
-        QString input;
+        QStringList input;
         QString output;
+        QString traceOutput;
     };
 
     void parse(const QStringList& args);
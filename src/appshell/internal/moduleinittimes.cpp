@@ -0,0 +1,111 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "moduleinittimes.h"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <sstream>
+#include <iomanip>
+
+#include "log.h"
+
+using namespace mu::appshell;
+
+void ModuleInitTimes::measure(const std::string& module, const std::string& step, const std::function<void()>& func, bool concurrent)
+{
+    auto start = std::chrono::steady_clock::now();
+    func();
+    std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+    add({ module, step, elapsed.count(), concurrent });
+}
+
+void ModuleInitTimes::add(const Record& record)
+{
+    std::lock_guard lock(m_mutex);
+    m_records.push_back(record);
+}
+
+std::vector<ModuleInitTimes::Record> ModuleInitTimes::records() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_records;
+}
+
+double ModuleInitTimes::stepTotal(const std::string& step) const
+{
+    std::lock_guard lock(m_mutex);
+    double total = 0.0;
+    for (const Record& r : m_records) {
+        if (r.step == step) {
+            total += r.ms;
+        }
+    }
+    return total;
+}
+
+void ModuleInitTimes::print(double wallMs) const
+{
+    const std::vector<Record> recs = records();
+
+    std::map<std::string, double> moduleTotals;
+    std::map<std::string, double> stepTotals;
+    for (const Record& r : recs) {
+        //! NOTE The concurrent steps overlap the main thread, so they are not added to the module totals
+        if (!r.concurrent) {
+            moduleTotals[r.module] += r.ms;
+        }
+        stepTotals[r.step] += r.ms;
+    }
+
+    std::vector<std::pair<std::string, double> > modules(moduleTotals.begin(), moduleTotals.end());
+    std::stable_sort(modules.begin(), modules.end(), [](const auto& a, const auto& b) {
+        return a.second > b.second;
+    });
+
+    std::stringstream stream;
+    stream << std::fixed << std::setprecision(1);
+    stream << "\nModules setup: " << wallMs << " ms\n";
+
+    for (const auto& step : stepTotals) {
+        stream << "  " << step.first << ": " << step.second << " ms\n";
+    }
+
+    for (const auto& module : modules) {
+        stream << "  " << module.first << ": " << module.second << " ms (";
+
+        bool first = true;
+        for (const Record& r : recs) {
+            if (r.module != module.first || r.ms < 0.1) {
+                continue;
+            }
+
+            stream << (first ? "" : ", ") << r.step << " " << r.ms;
+            first = false;
+        }
+
+        stream << ")\n";
+    }
+
+    LOGI() << stream.str();
+}
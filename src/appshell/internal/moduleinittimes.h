@@ -0,0 +1,57 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_APPSHELL_MODULEINITTIMES_H
+#define MU_APPSHELL_MODULEINITTIMES_H
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <functional>
+
+namespace mu::appshell {
+//! NOTE Collects the time spent by each module in each setup step,
+//! the concurrent steps can be added from the workers
+class ModuleInitTimes
+{
+public:
+    struct Record {
+        std::string module;
+        std::string step;
+        double ms = 0.0;
+        bool concurrent = false;
+    };
+
+    void measure(const std::string& module, const std::string& step, const std::function<void()>& func, bool concurrent = false);
+    void add(const Record& record);
+
+    std::vector<Record> records() const;
+    double stepTotal(const std::string& step) const;
+
+    void print(double wallMs) const;
+
+private:
+    mutable std::mutex m_mutex;
+    std::vector<Record> m_records;
+};
+}
+
+#endif // MU_APPSHELL_MODULEINITTIMES_H
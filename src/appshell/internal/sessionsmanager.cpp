@@ -41,6 +41,11 @@ void SessionsManager::init()
 
 void SessionsManager::deinit()
 {
+    //! NOTE Not inited in the converter, it must not touch the session of the editor
+    if (application()->runMode() != framework::IApplication::RunMode::Editor) {
+        return;
+    }
+
     bool isServer = multiInstancesProvider()->isMainInstance();
     if (!isServer) {
         return;
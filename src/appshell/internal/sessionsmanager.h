@@ -27,6 +27,7 @@
 #include "async/asyncable.h"
 
 #include "modularity/ioc.h"
+#include "iapplication.h"
 #include "actions/iactionsdispatcher.h"
 #include "context/iglobalcontext.h"
 #include "multiinstances/imultiinstancesprovider.h"
@@ -43,6 +44,7 @@ class SessionsManager : public ISessionsManager, public async::Asyncable
     INJECT(appshell, context::IGlobalContext, globalContext)
     INJECT(appshell, project::IProjectConfiguration, projectConfiguration)
     INJECT(appshell, IAppShellConfiguration, configuration)
+    INJECT(appshell, framework::IApplication, application)
 
 public:
     void init();
@@ -344,6 +344,10 @@ MenuItem* AppMenuModel::makeDiagnosticMenu()
     MenuItemList systemItems {
         makeMenuItem("diagnostic-show-paths"),
         makeMenuItem("diagnostic-show-profiler"),
+        makeMenuItem("diagnostic-show-audio-performance"),
+        makeSeparator(),
+        makeMenuItem("diagnostic-start-trace"),
+        makeMenuItem("diagnostic-save-trace"),
     };
 
     MenuItemList items {
@@ -362,6 +366,7 @@ MenuItem* AppMenuModel::makeDiagnosticMenu()
     if (globalConfiguration()->devModeEnabled()) {
         MenuItemList engravingItems {
             makeMenuItem("diagnostic-show-engraving-elements"),
+            makeMenuItem("diagnostic-allocators-dump"),
             makeSeparator(),
             makeMenuItem("show-element-bounding-rects"),
             makeMenuItem("color-element-shapes"),
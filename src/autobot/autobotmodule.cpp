@@ -48,6 +48,7 @@
 #include "internal/api/interactiveapi.h"
 #include "internal/api/keyboardapi.h"
 #include "internal/api/accessibilityapi.h"
+#include "internal/api/latencyapi.h"
 
 #include "diagnostics/idiagnosticspathsregister.h"
 
@@ -103,6 +104,7 @@ void AutobotModule::resolveImports()
         api->regApiCreator("global", "api.interactive", new ApiCreator<InteractiveApi>());
         api->regApiCreator("ui", "api.keyboard", new ApiCreator<KeyboardApi>());
         api->regApiCreator("accessibility", "api.accessibility", new ApiCreator<AccessibilityApi>());
+        api->regApiCreator("autobot", "api.latency", new ApiCreator<LatencyApi>());
     }
 }
 
@@ -112,8 +114,12 @@ void AutobotModule::registerUiTypes()
     qmlRegisterType<TestCaseRunModel>("MuseScore.Autobot", 1, 0, "TestCaseRunModel");
 }
 
-void AutobotModule::onInit(const framework::IApplication::RunMode&)
+void AutobotModule::onInit(const framework::IApplication::RunMode& mode)
 {
+    if (framework::IApplication::RunMode::Editor != mode) {
+        return;
+    }
+
     s_autobot->init();
     s_actionsController->init();
 
@@ -0,0 +1,302 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "latencyapi.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+#include <QDateTime>
+#include <QEventLoop>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSysInfo>
+#include <QThread>
+#include <QTimer>
+
+#include "version.h"
+
+#include "log.h"
+
+using namespace mu::api;
+
+static constexpr int REPORT_VERSION = 1;
+static constexpr int PAINT_TIMEOUT_MSEC = 1000;
+static constexpr int PAINT_POLL_MSEC = 1;
+
+//! NOTE The names of the profiler functions (see TRACEFUNC) the phases are taken from
+static const std::string LAYOUT_FUNC("Score::doLayoutRange");
+static const std::string PLAYBACK_FUNC("PlaybackModel::onScoreChanged");
+static const std::string PAINT_FUNC("AbstractNotationPaintView::paint");
+
+static double elapsedMs(const QElapsedTimer& timer)
+{
+    return timer.nsecsElapsed() / 1000000.0;
+}
+
+static double roundMs(double ms)
+{
+    return std::round(ms * 1000.0) / 1000.0;
+}
+
+//! NOTE A fixed amount of integer work, to relate the numbers of different machines
+static double calibrationMs()
+{
+    std::vector<double> times;
+    for (int run = 0; run < 3; ++run) {
+        QElapsedTimer timer;
+        timer.start();
+
+        volatile uint64_t sink = 0;
+        uint64_t x = 88172645463325252ull;
+        for (int i = 0; i < (1 << 24); ++i) {
+            x ^= x << 13;
+            x ^= x >> 7;
+            x ^= x << 17;
+        }
+        sink = x;
+        (void)sink;
+
+        times.push_back(elapsedMs(timer));
+    }
+
+    std::sort(times.begin(), times.end());
+    return times[1];
+}
+
+static QJsonObject statistics(std::vector<double> values)
+{
+    QJsonObject obj;
+    if (values.empty()) {
+        return obj;
+    }
+
+    std::sort(values.begin(), values.end());
+
+    auto percentile = [&values](double p) {
+        size_t idx = static_cast<size_t>(p * (values.size() - 1) + 0.5);
+        return values.at(idx);
+    };
+
+    obj["median"] = roundMs(percentile(0.5));
+    obj["p90"] = roundMs(percentile(0.9));
+    obj["max"] = roundMs(values.back());
+    return obj;
+}
+
+LatencyApi::LatencyApi(IApiEngine* e)
+    : ApiObject(e)
+{
+}
+
+void LatencyApi::beginRun(const QString& name)
+{
+    m_runName = name;
+    m_samples.clear();
+}
+
+LatencyApi::Phases LatencyApi::phases() const
+{
+    using namespace haw::profiler;
+
+    Phases result;
+    Profiler::Data data = Profiler::instance()->threadsData(Profiler::Data::All);
+
+    for (const auto& thread : data.threads) {
+        const auto& funcs = thread.second.funcs;
+        bool isMain = thread.first == data.mainThread;
+
+        if (isMain) {
+            auto layout = funcs.find(LAYOUT_FUNC);
+            if (layout != funcs.end()) {
+                result.layoutMs += layout->second.sumtimeMs;
+            }
+
+            auto playback = funcs.find(PLAYBACK_FUNC);
+            if (playback != funcs.end()) {
+                result.playbackMs += playback->second.sumtimeMs;
+            }
+        }
+
+        auto paint = funcs.find(PAINT_FUNC);
+        if (paint != funcs.end()) {
+            result.paintMs += paint->second.sumtimeMs;
+            result.paintCount += paint->second.callcount;
+        }
+    }
+
+    return result;
+}
+
+bool LatencyApi::waitPaint(long paintCount) const
+{
+    bool painted = false;
+
+    QElapsedTimer timer;
+    timer.start();
+
+    QEventLoop loop;
+    QTimer poll;
+    poll.setInterval(PAINT_POLL_MSEC);
+    QObject::connect(&poll, &QTimer::timeout, &loop, [&]() {
+        if (phases().paintCount > paintCount) {
+            painted = true;
+            loop.quit();
+        } else if (timer.elapsed() > PAINT_TIMEOUT_MSEC) {
+            loop.quit();
+        }
+    });
+
+    poll.start();
+    loop.exec();
+
+    return painted;
+}
+
+QVariantMap LatencyApi::measure(const QString& action, const QString& label)
+{
+    Sample sample;
+    sample.action = action;
+    sample.label = label.isEmpty() ? action : label;
+
+    Phases before = phases();
+
+    QElapsedTimer timer;
+    timer.start();
+
+    dispatcher()->dispatch(action.toStdString());
+    double dispatchMs = elapsedMs(timer);
+    Phases dispatched = phases();
+
+    sample.painted = waitPaint(before.paintCount);
+    sample.totalMs = elapsedMs(timer);
+
+    Phases after = phases();
+
+    sample.layoutMs = after.layoutMs - before.layoutMs;
+    sample.playbackMs = after.playbackMs - before.playbackMs;
+    sample.paintMs = after.paintMs - before.paintMs;
+
+    //! NOTE The layout and the playback update done during the dispatch are a part of it
+    double nestedMs = (dispatched.layoutMs - before.layoutMs) + (dispatched.playbackMs - before.playbackMs);
+    sample.executionMs = std::max(0.0, dispatchMs - nestedMs);
+
+    m_samples.push_back(sample);
+
+    if (!sample.painted) {
+        LOGW() << "no paint after action: " << action << ", within " << PAINT_TIMEOUT_MSEC << " msec";
+    }
+
+    return sampleToMap(sample);
+}
+
+QVariantMap LatencyApi::sampleToMap(const Sample& sample) const
+{
+    QVariantMap map;
+    map["label"] = sample.label;
+    map["action"] = sample.action;
+    map["total"] = roundMs(sample.totalMs);
+    map["execution"] = roundMs(sample.executionMs);
+    map["layout"] = roundMs(sample.layoutMs);
+    map["playback"] = roundMs(sample.playbackMs);
+    map["paint"] = roundMs(sample.paintMs);
+    map["painted"] = sample.painted;
+    return map;
+}
+
+QString LatencyApi::saveReport()
+{
+    struct Group {
+        int paintedCount = 0;
+        std::vector<double> total;
+        std::vector<double> execution;
+        std::vector<double> layout;
+        std::vector<double> playback;
+        std::vector<double> paint;
+    };
+
+    //! NOTE Sorted by label, so that the reports can be compared line by line
+    std::map<QString, Group> groups;
+    QJsonArray samples;
+    for (const Sample& s : m_samples) {
+        Group& g = groups[s.label];
+        g.paintedCount += s.painted ? 1 : 0;
+        g.total.push_back(s.totalMs);
+        g.execution.push_back(s.executionMs);
+        g.layout.push_back(s.layoutMs);
+        g.playback.push_back(s.playbackMs);
+        g.paint.push_back(s.paintMs);
+
+        samples.append(QJsonObject::fromVariantMap(sampleToMap(s)));
+    }
+
+    QJsonArray commands;
+    for (const auto& it : groups) {
+        const Group& g = it.second;
+        QJsonObject cmd;
+        cmd["label"] = it.first;
+        cmd["count"] = static_cast<int>(g.total.size());
+        cmd["painted"] = g.paintedCount;
+        cmd["total"] = statistics(g.total);
+        cmd["execution"] = statistics(g.execution);
+        cmd["layout"] = statistics(g.layout);
+        cmd["playback"] = statistics(g.playback);
+        cmd["paint"] = statistics(g.paint);
+        commands.append(cmd);
+    }
+
+    QJsonObject env;
+    env["version"] = QString::fromStdString(framework::Version::fullVersion());
+    env["revision"] = QString::fromStdString(framework::Version::revision());
+    env["os"] = QSysInfo::prettyProductName();
+    env["cpuArch"] = QSysInfo::currentCpuArchitecture();
+    env["threads"] = QThread::idealThreadCount();
+    env["calibrationMs"] = roundMs(calibrationMs());
+
+    QJsonObject root;
+    root["reportVersion"] = REPORT_VERSION;
+    root["run"] = m_runName;
+    root["environment"] = env;
+    root["commands"] = commands;
+    root["samples"] = samples;
+
+    io::path_t reportsPath = configuration()->reportsPath();
+    Ret ret = fileSystem()->makePath(reportsPath);
+    if (!ret) {
+        LOGE() << "failed make path: " << reportsPath << ", err: " << ret.toString();
+        return QString();
+    }
+
+    QString name = m_runName.isEmpty() ? QString("latency") : m_runName;
+    io::path_t filePath = reportsPath + "/" + name + "_" + QDateTime::currentDateTime().toString("yyMMddhhmmss") + ".json";
+
+    QByteArray json = QJsonDocument(root).toJson(QJsonDocument::Indented);
+    ret = fileSystem()->writeFile(filePath, ByteArray::fromQByteArrayNoCopy(json));
+    if (!ret) {
+        LOGE() << "failed write report: " << filePath << ", err: " << ret.toString();
+        return QString();
+    }
+
+    LOGI() << "latency report saved: " << filePath;
+    return filePath.toQString();
+}
@@ -0,0 +1,83 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_API_LATENCYAPI_H
+#define MU_API_LATENCYAPI_H
+
+#include <QVariantMap>
+#include <QElapsedTimer>
+
+#include "apiobject.h"
+
+#include "modularity/ioc.h"
+#include "actions/iactionsdispatcher.h"
+#include "autobot/iautobotconfiguration.h"
+#include "io/ifilesystem.h"
+
+namespace mu::api {
+//! NOTE Measures the interaction latency of the dispatched actions, from the dispatch to the first paint of the notation.
+//! The time is split into the command execution, the layout, the playback model update and the painting,
+//! taken from the profiler function times. The layout and the playback are counted on the main thread,
+//! the painting on all threads (the scene graph may paint on its render thread).
+class LatencyApi : public ApiObject
+{
+    Q_OBJECT
+
+    INJECT(api, actions::IActionsDispatcher, dispatcher)
+    INJECT(api, autobot::IAutobotConfiguration, configuration)
+    INJECT(api, io::IFileSystem, fileSystem)
+
+public:
+    explicit LatencyApi(IApiEngine* e);
+
+    Q_INVOKABLE void beginRun(const QString& name);
+    Q_INVOKABLE QVariantMap measure(const QString& action, const QString& label = QString());
+    Q_INVOKABLE QString saveReport();
+
+private:
+    struct Phases {
+        double layoutMs = 0.0;
+        double playbackMs = 0.0;
+        double paintMs = 0.0;
+        long paintCount = 0;
+    };
+
+    struct Sample {
+        QString label;
+        QString action;
+        double totalMs = 0.0;
+        double executionMs = 0.0;
+        double layoutMs = 0.0;
+        double playbackMs = 0.0;
+        double paintMs = 0.0;
+        bool painted = false;
+    };
+
+    Phases phases() const;
+    bool waitPaint(long paintCount) const;
+    QVariantMap sampleToMap(const Sample& sample) const;
+
+    QString m_runName;
+    std::vector<Sample> m_samples;
+};
+}
+
+#endif // MU_API_LATENCYAPI_H
@@ -23,6 +23,7 @@
 
 #include "log.h"
 #include "draw/painter.h"
+#include "draw/utils/drawdatapaint.h"
 
 static const QColor REMOVED_COLOR("#cc0000");
 static const QColor ADDED_COLOR("#009900");
@@ -99,11 +100,7 @@ void AbPaintProvider::paintData(draw::IPaintProviderPtr provider, const draw::Dr
             }
 
             for (const DrawText& t : d.texts) {
-                if (t.mode == DrawText::Point) {
-                    provider->drawText(t.rect.topLeft(), t.text);
-                } else {
-                    provider->drawText(t.rect, t.flags, t.text);
-                }
+                DrawDataPaint::drawText(provider.get(), st, t);
             }
 
             for (const DrawPixmap& px : d.pixmaps) {
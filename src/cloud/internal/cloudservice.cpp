@@ -30,6 +30,7 @@
 #include <QBuffer>
 #include <QHttpMultiPart>
 #include <QRandomGenerator>
+#include <QElapsedTimer>
 
 #include "async/async.h"
 #include "containers.h"
@@ -485,9 +486,7 @@ ProgressPtr CloudService::uploadScore(QIODevice& scoreData, const QString& title
         progress->started.notify();
 
         INetworkManagerPtr manager = networkManagerCreator()->makeNetworkManager();
-        manager->progress().progressChanged.onReceive(this, [progress](int64_t current, int64_t total, const std::string& message) {
-            progress->progressChanged.send(current, total, message);
-        });
+        forwardUploadProgress(manager, progress);
 
         RetVal<ValMap> urlMap = doUploadScore(manager, scoreData, title, visibility, sourceUrl);
 
@@ -519,9 +518,7 @@ ProgressPtr CloudService::uploadAudio(QIODevice& audioData, const QString& audio
         progress->started.notify();
 
         INetworkManagerPtr manager = networkManagerCreator()->makeNetworkManager();
-        manager->progress().progressChanged.onReceive(this, [progress](int64_t current, int64_t total, const std::string& message) {
-            progress->progressChanged.send(current, total, message);
-        });
+        forwardUploadProgress(manager, progress);
 
         Ret ret = doUploadAudio(manager, audioData, audioFormat, sourceUrl);
         progress->finished.send(ret);
@@ -541,6 +538,25 @@ ProgressPtr CloudService::uploadAudio(QIODevice& audioData, const QString& audio
     return progress;
 }
 
+//! NOTE The message of the forwarded progress is the current upload rate,
+//! so that users on slow connections can see that the upload is moving
+void CloudService::forwardUploadProgress(INetworkManagerPtr uploadManager, ProgressPtr progress)
+{
+    std::shared_ptr<QElapsedTimer> timer = std::make_shared<QElapsedTimer>();
+    timer->start();
+
+    uploadManager->progress().progressChanged.onReceive(this, [progress, timer](int64_t current, int64_t total, const std::string&) {
+        std::string message;
+        qint64 elapsedMs = timer->elapsed();
+        if (elapsedMs > 0) {
+            int64_t kbPerSecond = current * 1000 / elapsedMs / 1024;
+            message = qtrc("cloud", "%1 KB/s").arg(kbPerSecond).toStdString();
+        }
+
+        progress->progressChanged.send(current, total, message);
+    });
+}
+
 static Ret uploadingRetFromRawUploadingRet(const Ret& rawRet, bool isScoreAlreadyUploaded)
 {
     int code = statusCode(rawRet);
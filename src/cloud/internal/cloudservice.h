@@ -101,6 +101,8 @@ private:
                                          Visibility visibility, const QUrl& sourceUrl = QUrl());
     Ret doUploadAudio(network::INetworkManagerPtr uploadManager, QIODevice& audioData, const QString& audioFormat, const QUrl& sourceUrl);
 
+    void forwardUploadProgress(network::INetworkManagerPtr uploadManager, framework::ProgressPtr progress);
+
     using RequestCallback = std::function<Ret()>;
     void executeRequest(const RequestCallback& requestCallback);
 
@@ -32,6 +32,9 @@ enum class Err {
 
     BatchJobFileFailedOpen = 1301,
     BatchJobFileFailedParse = 1302,
+    BatchJobWorkerFailed = 1303,
+    BatchJobReportFailedWrite = 1304,
+    JobServerFailedListen = 1305,
 
     ConvertTypeUnknown = 1310,
 
@@ -35,7 +35,9 @@ public:
 
     virtual Ret fileConvert(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                             bool forceMode = false) = 0;
-    virtual Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
+    virtual Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false,
+                             size_t workerCount = 1, const io::path_t& reportPath = io::path_t()) = 0;
+    virtual Ret runJobServer(const std::string& serverName, const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
     virtual Ret convertScoreParts(const io::path_t& in, const io::path_t& out,
                                   const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
 
@@ -44,6 +46,10 @@ public:
                                  const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
     virtual Ret exportScoreMeta(const io::path_t& in, const io::path_t& out,
                                 const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
+    virtual Ret exportScoreLayoutStatistics(const io::path_t& in, const io::path_t& out,
+                                            const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
+    virtual Ret exportScoreMemoryReport(const io::path_t& in, const io::path_t& out,
+                                        const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
     virtual Ret exportScoreParts(const io::path_t& in, const io::path_t& out,
                                  const io::path_t& stylePath = io::path_t(), bool forceMode = false) = 0;
     virtual Ret exportScorePartsPdfs(const io::path_t& in, const io::path_t& out,
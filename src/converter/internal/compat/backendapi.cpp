@@ -31,10 +31,12 @@
 #include <QRandomGenerator>
 
 #include "io/buffer.h"
+#include "concurrency/taskscheduler.h"
 
 #include "engraving/compat/scoreaccess.h"
 #include "engraving/infrastructure/mscwriter.h"
 #include "engraving/libmscore/excerpt.h"
+#include "engraving/libmscore/memoryreport.h"
 
 #include "backendjsonwriter.h"
 #include "notationmeta.h"
@@ -81,7 +83,10 @@ Ret BackendApi::exportScoreMedia(const io::path_t& in, const io::path_t& out, co
     QFile outputFile;
     openOutputFile(outputFile, out);
 
-    BackendJsonWriter jsonWriter(&outputFile);
+    //! NOTE The writers paint and export on this thread, one after another, the score is laid out once on loading.
+    //! The encoding and the writing of what they produce is done on the worker, while the next writer runs
+    TaskScheduler jsonWorker(1);
+    BackendJsonWriter jsonWriter(&outputFile, &jsonWorker);
 
     result &= exportScorePngs(notation, jsonWriter, ADD_SEPARATOR);
     result &= exportScoreSvgs(notation, highlightConfigPath, jsonWriter, ADD_SEPARATOR);
@@ -117,6 +122,62 @@ Ret BackendApi::exportScoreMeta(const io::path_t& in, const io::path_t& out, con
     return result ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
 }
 
+Ret BackendApi::exportScoreLayoutStatistics(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath, bool forceMode)
+{
+    TRACEFUNC
+
+    RetVal<INotationProjectPtr> prj = openProject(in, stylePath, forceMode);
+    if (!prj.ret) {
+        return prj.ret;
+    }
+
+    // lay out the whole score again, the statistics of the layout done on loading are not collected
+    INotationPtr notation = prj.val->masterNotation()->notation();
+    mu::engraving::MasterScore* score = notation->elements()->msScore()->masterScore();
+    score->setCollectLayoutStatistics(true);
+    score->clearLayoutStatistics();
+    score->doLayout();
+
+    QFile outputFile;
+    Ret ret = openOutputFile(outputFile, out);
+    if (!ret) {
+        return ret;
+    }
+
+    ByteArray json = score->layout().statistics().toJson();
+    bool result = outputFile.write(json.constChar(), json.size()) == qint64(json.size());
+
+    outputFile.close();
+
+    return result ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
+}
+
+Ret BackendApi::exportScoreMemoryReport(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath, bool forceMode)
+{
+    TRACEFUNC
+
+    RetVal<INotationProjectPtr> prj = openProject(in, stylePath, forceMode);
+    if (!prj.ret) {
+        return prj.ret;
+    }
+
+    INotationPtr notation = prj.val->masterNotation()->notation();
+    mu::engraving::MasterScore* score = notation->elements()->msScore()->masterScore();
+
+    QFile outputFile;
+    Ret ret = openOutputFile(outputFile, out);
+    if (!ret) {
+        return ret;
+    }
+
+    ByteArray json = mu::engraving::MemoryReport::collect(score).toJson();
+    bool result = outputFile.write(json.constChar(), json.size()) == qint64(json.size());
+
+    outputFile.close();
+
+    return result ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
+}
+
 Ret BackendApi::exportScoreParts(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath, bool forceMode)
 {
     TRACEFUNC
@@ -285,30 +346,25 @@ Ret BackendApi::exportScorePngs(const INotationPtr notation, BackendJsonWriter&
 
     PageList notationPages = pages(notation);
 
-    bool result = true;
-    for (size_t i = 0; i < notationPages.size(); ++i) {
-        QByteArray pngData;
-        QBuffer pngDevice(&pngData);
-        pngDevice.open(QIODevice::ReadWrite);
-
-        INotationWriter::Options options {
-            { INotationWriter::OptionKey::PAGE_NUMBER, Val(static_cast<int>(i)) },
-            { INotationWriter::OptionKey::TRANSPARENT_BACKGROUND, Val(false) }
-        };
-
-        Ret writeRet = pngWriter->write(notation, pngDevice, options);
-        if (!writeRet) {
-            LOGW() << writeRet.toString();
-            result = false;
-        }
+    INotationWriter::Options options {
+        { INotationWriter::OptionKey::TRANSPARENT_BACKGROUND, Val(false) }
+    };
 
-        bool lastArrayValue = ((notationPages.size() - 1) == i);
-        jsonWriter.addValue(pngData.toBase64(), !lastArrayValue);
+    //! NOTE The pages are painted concurrently
+    std::vector<QByteArray> pngDatas(notationPages.size());
+    Ret writeRet = writePages(pngWriter, notation, pngDatas, options);
+    if (!writeRet) {
+        LOGW() << writeRet.toString();
+    }
+
+    for (size_t i = 0; i < pngDatas.size(); ++i) {
+        bool lastArrayValue = ((pngDatas.size() - 1) == i);
+        jsonWriter.addBase64Value(pngDatas[i], !lastArrayValue);
     }
 
     jsonWriter.closeArray(addSeparator);
 
-    return result ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
+    return writeRet ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
 }
 
 Ret BackendApi::exportScoreSvgs(const INotationPtr notation, const io::path_t& highlightConfigPath, BackendJsonWriter& jsonWriter,
@@ -328,31 +384,27 @@ Ret BackendApi::exportScoreSvgs(const INotationPtr notation, const io::path_t& h
     PageList notationPages = pages(notation);
     QVariantMap beatsColors = readBeatsColors(highlightConfigPath);
 
-    bool result = true;
-    for (size_t i = 0; i < notationPages.size(); ++i) {
-        QByteArray svgData;
-        QBuffer svgDevice(&svgData);
-        svgDevice.open(QIODevice::ReadWrite);
-
-        INotationWriter::Options options {
-            { INotationWriter::OptionKey::PAGE_NUMBER, Val(static_cast<int>(i)) },
-            { INotationWriter::OptionKey::TRANSPARENT_BACKGROUND, Val(false) },
-            { INotationWriter::OptionKey::BEATS_COLORS, Val::fromQVariant(beatsColors) }
-        };
-
-        Ret writeRet = svgWriter->write(notation, svgDevice, options);
-        if (!writeRet) {
-            LOGW() << writeRet.toString();
-            result = false;
-        }
+    INotationWriter::Options options {
+        { INotationWriter::OptionKey::TRANSPARENT_BACKGROUND, Val(false) },
+        { INotationWriter::OptionKey::BEATS_COLORS, Val::fromQVariant(beatsColors) },
+        { INotationWriter::OptionKey::REUSE_GLYPHS, Val(true) }
+    };
 
-        bool lastArrayValue = ((notationPages.size() - 1) == i);
-        jsonWriter.addValue(svgData.toBase64(), !lastArrayValue);
+    //! NOTE The pages are painted concurrently
+    std::vector<QByteArray> svgDatas(notationPages.size());
+    Ret writeRet = writePages(svgWriter, notation, svgDatas, options);
+    if (!writeRet) {
+        LOGW() << writeRet.toString();
+    }
+
+    for (size_t i = 0; i < svgDatas.size(); ++i) {
+        bool lastArrayValue = ((svgDatas.size() - 1) == i);
+        jsonWriter.addBase64Value(svgDatas[i], !lastArrayValue);
     }
 
     jsonWriter.closeArray(addSeparator);
 
-    return result ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
+    return writeRet ? make_ret(Ret::Code::Ok) : make_ret(Ret::Code::InternalError);
 }
 
 Ret BackendApi::exportScoreElementsPositions(const std::string& elementsPositionsWriterName, const INotationPtr notation,
@@ -489,6 +541,29 @@ mu::RetVal<QByteArray> BackendApi::processWriter(const std::string& writerName,
     return result;
 }
 
+Ret BackendApi::writePages(const INotationWriterPtr writer, const INotationPtr notation, std::vector<QByteArray>& datas,
+                           const INotationWriter::Options& options)
+{
+    std::vector<std::unique_ptr<QBuffer> > buffers;
+    std::vector<QIODevice*> devices;
+
+    for (QByteArray& data : datas) {
+        std::unique_ptr<QBuffer> buffer = std::make_unique<QBuffer>(&data);
+        buffer->open(QIODevice::ReadWrite);
+
+        devices.push_back(buffer.get());
+        buffers.push_back(std::move(buffer));
+    }
+
+    Ret ret = writer->writePages(notation, devices, options);
+
+    for (std::unique_ptr<QBuffer>& buffer : buffers) {
+        buffer->close();
+    }
+
+    return ret;
+}
+
 mu::RetVal<QByteArray> BackendApi::processWriter(const std::string& writerName, const INotationPtrList notations,
                                                  const INotationWriter::Options& options)
 {
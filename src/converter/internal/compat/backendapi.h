@@ -47,6 +47,10 @@ public:
     static Ret exportScoreMedia(const io::path_t& in, const io::path_t& out, const io::path_t& highlightConfigPath,
                                 const io::path_t& stylePath = "", bool forceMode = false);
     static Ret exportScoreMeta(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath, bool forceMode = false);
+    static Ret exportScoreLayoutStatistics(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath,
+                                           bool forceMode = false);
+    static Ret exportScoreMemoryReport(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath,
+                                       bool forceMode = false);
     static Ret exportScoreParts(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath, bool forceMode = false);
     static Ret exportScorePartsPdfs(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath, bool forceMode = false);
     static Ret exportScoreTranspose(const io::path_t& in, const io::path_t& out, const std::string& optionsJson,
@@ -79,6 +83,8 @@ private:
     static mu::RetVal<QByteArray> processWriter(const std::string& writerName, const notation::INotationPtr notation);
     static mu::RetVal<QByteArray> processWriter(const std::string& writerName, const notation::INotationPtrList notations,
                                                 const project::INotationWriter::Options& options);
+    static Ret writePages(const project::INotationWriterPtr writer, const notation::INotationPtr notation, std::vector<QByteArray>& datas,
+                          const project::INotationWriter::Options& options);
 
     static Ret doExportScoreParts(const notation::INotationPtr notation, QIODevice& destinationDevice);
     static Ret doExportScorePartsPdfs(const notation::IMasterNotationPtr notation, QIODevice& destinationDevice,
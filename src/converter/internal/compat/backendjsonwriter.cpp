@@ -21,10 +21,13 @@
  */
 #include "backendjsonwriter.h"
 
+#include "concurrency/taskscheduler.h"
+
 using namespace mu::converter;
 using namespace mu::io;
 
-BackendJsonWriter::BackendJsonWriter(QIODevice* destinationDevice)
+BackendJsonWriter::BackendJsonWriter(QIODevice* destinationDevice, TaskScheduler* worker)
+    : m_worker(worker)
 {
     m_destinationDevice = destinationDevice;
     m_destinationDevice->open(QIODevice::WriteOnly);
@@ -33,18 +36,49 @@ BackendJsonWriter::BackendJsonWriter(QIODevice* destinationDevice)
 
 BackendJsonWriter::~BackendJsonWriter()
 {
+    if (m_worker) {
+        //! NOTE The worker runs the writes one by one, so all the previous ones are done when this one is
+        m_worker->submit([]() {}).wait();
+    }
+
     m_destinationDevice->write("\n}\n");
     m_destinationDevice->close();
 }
 
+void BackendJsonWriter::post(const std::function<void()>& write)
+{
+    if (m_worker) {
+        m_worker->push(write);
+    } else {
+        write();
+    }
+}
+
 void BackendJsonWriter::addKey(const char* arrayName)
 {
-    m_destinationDevice->write("\"");
-    m_destinationDevice->write(arrayName);
-    m_destinationDevice->write("\": ");
+    QByteArray name(arrayName);
+    post([this, name]() {
+        m_destinationDevice->write("\"");
+        m_destinationDevice->write(name);
+        m_destinationDevice->write("\": ");
+    });
 }
 
 void BackendJsonWriter::addValue(const QByteArray& data, bool addSeparator, bool isJson)
+{
+    post([this, data, addSeparator, isJson]() {
+        doAddValue(data, addSeparator, isJson);
+    });
+}
+
+void BackendJsonWriter::addBase64Value(const QByteArray& data, bool addSeparator)
+{
+    post([this, data, addSeparator]() {
+        doAddValue(data.toBase64(), addSeparator, false);
+    });
+}
+
+void BackendJsonWriter::doAddValue(const QByteArray& data, bool addSeparator, bool isJson)
 {
     if (!isJson) {
         m_destinationDevice->write("\"");
@@ -60,14 +94,18 @@ void BackendJsonWriter::addValue(const QByteArray& data, bool addSeparator, bool
 
 void BackendJsonWriter::openArray()
 {
-    m_destinationDevice->write(" [");
+    post([this]() {
+        m_destinationDevice->write(" [");
+    });
 }
 
 void BackendJsonWriter::closeArray(bool addSeparator)
 {
-    m_destinationDevice->write("]");
-    if (addSeparator) {
-        m_destinationDevice->write(",");
-    }
-    m_destinationDevice->write("\n");
+    post([this, addSeparator]() {
+        m_destinationDevice->write("]");
+        if (addSeparator) {
+            m_destinationDevice->write(",");
+        }
+        m_destinationDevice->write("\n");
+    });
 }
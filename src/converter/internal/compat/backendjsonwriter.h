@@ -22,23 +22,36 @@
 #ifndef MU_CONVERTER_BACKENDJSONWRITER_H
 #define MU_CONVERTER_BACKENDJSONWRITER_H
 
+#include <functional>
+
 #include "io/path.h"
 
+namespace mu {
+class TaskScheduler;
+}
+
 namespace mu::converter {
 class BackendJsonWriter
 {
 public:
-    BackendJsonWriter(QIODevice* destinationDevice);
+    //! NOTE With a worker (a single thread one), the writes are done on it in the order of the calls,
+    //! so the caller can produce the next value while the previous ones are encoded and written
+    BackendJsonWriter(QIODevice* destinationDevice, TaskScheduler* worker = nullptr);
     ~BackendJsonWriter();
 
     void addKey(const char* arrayName);
     void addValue(const QByteArray& data, bool addSeparator = false, bool isJson = false);
+    void addBase64Value(const QByteArray& data, bool addSeparator = false);
 
     void openArray();
     void closeArray(bool addSeparator = false);
 
 private:
+    void post(const std::function<void()>& write);
+    void doAddValue(const QByteArray& data, bool addSeparator, bool isJson);
+
     QIODevice* m_destinationDevice = nullptr;
+    TaskScheduler* m_worker = nullptr;
 };
 }
 
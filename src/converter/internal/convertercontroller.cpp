@@ -21,11 +21,20 @@
  */
 #include "convertercontroller.h"
 
+#include <QCoreApplication>
+#include <QElapsedTimer>
 #include <QFile>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QJsonParseError>
+#include <QLocalServer>
+#include <QLocalSocket>
+#include <QProcess>
+#include <QTemporaryDir>
+
+#include "concurrency/taskscheduler.h"
+#include "draw/painter.h"
 
 #include "convertercodes.h"
 #include "stringutils.h"
@@ -39,8 +48,22 @@ using namespace mu::notation;
 
 static const std::string PDF_SUFFIX = "pdf";
 static const std::string PNG_SUFFIX = "png";
+static const std::string WAV_SUFFIX = "wav";
+static const std::string MP3_SUFFIX = "mp3";
+static const std::string OGG_SUFFIX = "ogg";
+static const std::string FLAC_SUFFIX = "flac";
+
+static constexpr size_t MIN_PARTS_TO_PAINT_CONCURRENTLY = 2;
+
+//! NOTE Not the page painting workers: a part paints its pages on those and waits for them
+static mu::TaskScheduler* partWorkers()
+{
+    static mu::TaskScheduler workers;
+    return &workers;
+}
 
-mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath, bool forceMode)
+mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath, bool forceMode,
+                                          size_t workerCount, const io::path_t& reportPath)
 {
     TRACEFUNC;
 
@@ -50,11 +73,52 @@ mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const
         return batchJob.ret;
     }
 
+    QJsonArray report;
+    Ret ret = make_ret(Ret::Code::Ok);
+    if (workerCount > 1 && batchJob.val.size() > 1) {
+        ret = convertJobsInWorkers(batchJob.val, stylePath, forceMode, workerCount, report);
+    } else {
+        ret = convertJobs(batchJob.val, stylePath, forceMode, report);
+    }
+
+    if (!reportPath.empty()) {
+        Ret reportRet = writeBatchReport(reportPath, report);
+        if (ret && !reportRet) {
+            ret = reportRet;
+        }
+    }
+
+    return ret;
+}
+
+mu::Ret ConverterController::convertJobs(const BatchJob& jobs, const io::path_t& stylePath, bool forceMode, QJsonArray& report)
+{
     Ret ret = make_ret(Ret::Code::Ok);
-    for (const Job& job : batchJob.val) {
-        ret = fileConvert(job.in, job.out, stylePath, forceMode);
+    for (const Job& job : jobs) {
+        QElapsedTimer timer;
+        timer.start();
+
+        if (job.out.size() == 1) {
+            ret = fileConvert(job.in, job.out.front(), stylePath, forceMode);
+        } else {
+            ret = fileConvert(job.in, job.out, stylePath, forceMode);
+        }
+
+        qint64 elapsed = timer.elapsed();
+        LOGI() << "job finished in " << elapsed << " ms, in: " << job.in << ", out: " << io::pathsToString(job.out);
+
+        QJsonObject result;
+        result["in"] = job.in.toQString();
+        result["out"] = outToJson(job.out);
+        result["code"] = ret.code();
+        if (!ret) {
+            result["error"] = QString::fromStdString(ret.toString());
+        }
+        result["durationMs"] = elapsed;
+        report.append(result);
+
         if (!ret) {
-            LOGE() << "failed convert, err: " << ret.toString() << ", in: " << job.in << ", out: " << job.out;
+            LOGE() << "failed convert, err: " << ret.toString() << ", in: " << job.in << ", out: " << io::pathsToString(job.out);
             break;
         }
     }
@@ -62,6 +126,168 @@ mu::Ret ConverterController::batchConvert(const io::path_t& batchJobFile, const
     return ret;
 }
 
+mu::Ret ConverterController::convertJobsInWorkers(const BatchJob& jobs, const io::path_t& stylePath, bool forceMode,
+                                                  size_t workerCount, QJsonArray& report) const
+{
+    TRACEFUNC;
+
+    //! NOTE The notation loading and the layout rely on global state (the current project, the default style),
+    //! so the jobs can't be converted on threads of this process. Every worker is a converter process of its own,
+    //! it loads the fonts, the instrument templates and the sound fonts once and reuses them for all its jobs.
+    QTemporaryDir tempDir;
+    if (!tempDir.isValid()) {
+        return make_ret(Err::BatchJobWorkerFailed, "failed create temporary directory");
+    }
+
+    workerCount = std::min(workerCount, jobs.size());
+
+    //! NOTE Round robin, so that the workers get a similar mix of the (usually sorted) job list
+    std::vector<QJsonArray> workerJobs(workerCount);
+    size_t jobIdx = 0;
+    for (const Job& job : jobs) {
+        QJsonObject obj;
+        obj["in"] = job.in.toQString();
+        obj["out"] = outToJson(job.out);
+        workerJobs[jobIdx++ % workerCount].append(obj);
+    }
+
+    QProcessEnvironment env = QProcessEnvironment::systemEnvironment();
+    if (!env.contains("QT_QPA_PLATFORM")) {
+        env.insert("QT_QPA_PLATFORM", "offscreen");
+    }
+
+    std::vector<std::unique_ptr<QProcess> > workers;
+    std::vector<QString> reportFiles;
+
+    for (size_t i = 0; i < workerCount; ++i) {
+        QString jobFilePath = tempDir.filePath(QString("job-%1.json").arg(i));
+        QFile jobFile(jobFilePath);
+        if (!jobFile.open(QIODevice::WriteOnly) || jobFile.write(QJsonDocument(workerJobs[i]).toJson()) < 0) {
+            return make_ret(Err::BatchJobWorkerFailed, "failed write job file " + jobFilePath.toStdString());
+        }
+        jobFile.close();
+
+        QString reportFilePath = tempDir.filePath(QString("report-%1.json").arg(i));
+        QStringList args { "-j", jobFilePath, "--job-report", reportFilePath };
+        if (!stylePath.empty()) {
+            args << "-S" << stylePath.toQString();
+        }
+        if (forceMode) {
+            args << "-f";
+        }
+
+        std::unique_ptr<QProcess> worker = std::make_unique<QProcess>();
+        worker->setProcessChannelMode(QProcess::ForwardedChannels);
+        worker->setProcessEnvironment(env);
+        worker->start(QCoreApplication::applicationFilePath(), args);
+
+        workers.push_back(std::move(worker));
+        reportFiles.push_back(reportFilePath);
+    }
+
+    Ret ret = make_ret(Ret::Code::Ok);
+    for (size_t i = 0; i < workerCount; ++i) {
+        QProcess* worker = workers[i].get();
+        if (!worker->waitForFinished(-1) || worker->exitStatus() != QProcess::NormalExit || worker->exitCode() != 0) {
+            LOGE() << "worker " << i << " failed, exit code: " << worker->exitCode() << ", err: " << worker->errorString();
+            if (ret) {
+                ret = make_ret(Err::BatchJobWorkerFailed, worker->errorString().toStdString());
+            }
+        }
+
+        QFile reportFile(reportFiles[i]);
+        if (!reportFile.open(QIODevice::ReadOnly)) {
+            continue;
+        }
+
+        const QJsonArray workerReport = QJsonDocument::fromJson(reportFile.readAll()).array();
+        for (const QJsonValue v : workerReport) {
+            report.append(v);
+
+            QJsonObject result = v.toObject();
+            if (ret && result["code"].toInt() != int(Ret::Code::Ok)) {
+                ret = Ret(result["code"].toInt(), result["error"].toString().toStdString());
+            }
+        }
+    }
+
+    return ret;
+}
+
+mu::Ret ConverterController::runJobServer(const std::string& serverName, const io::path_t& stylePath, bool forceMode)
+{
+    TRACEFUNC;
+
+    QString name = QString::fromStdString(serverName);
+    QLocalServer::removeServer(name);
+
+    QLocalServer server;
+    if (!server.listen(name)) {
+        LOGE() << "failed listen: " << server.errorString();
+        return make_ret(Err::JobServerFailedListen, server.errorString().toStdString());
+    }
+
+    LOGI() << "job server listening on: " << server.fullServerName();
+
+    //! NOTE The connections are served one after another, all the modules stay initialized between them,
+    //! so a request only pays for loading and converting its own scores
+    while (server.waitForNewConnection(-1)) {
+        std::unique_ptr<QLocalSocket> socket(server.nextPendingConnection());
+        if (socket) {
+            serveJobConnection(socket.get(), stylePath, forceMode);
+        }
+    }
+
+    return make_ret(Ret::Code::Ok);
+}
+
+void ConverterController::serveJobConnection(QLocalSocket* socket, const io::path_t& stylePath, bool forceMode)
+{
+    //! NOTE Every line received is a job (or an array of jobs) in the batch job format,
+    //! every line sent back is the report of the line received, in the '--job-report' format
+    for (;;) {
+        if (!socket->canReadLine()) {
+            if (!socket->waitForReadyRead(-1)) {
+                break;
+            }
+            continue;
+        }
+
+        QByteArray line = socket->readLine().trimmed();
+        if (line.isEmpty()) {
+            continue;
+        }
+
+        QJsonArray report;
+        RetVal<BatchJob> jobs = parseJobs(line);
+        if (jobs.ret) {
+            convertJobs(jobs.val, stylePath, forceMode, report);
+        } else {
+            QJsonObject result;
+            result["code"] = jobs.ret.code();
+            result["error"] = QString::fromStdString(jobs.ret.toString());
+            report.append(result);
+        }
+
+        socket->write(QJsonDocument(report).toJson(QJsonDocument::Compact) + '\n');
+        socket->waitForBytesWritten(-1);
+    }
+}
+
+mu::Ret ConverterController::writeBatchReport(const io::path_t& reportPath, const QJsonArray& report) const
+{
+    QFile file(reportPath.toQString());
+    if (!file.open(QIODevice::WriteOnly)) {
+        return make_ret(Err::BatchJobReportFailedWrite);
+    }
+
+    if (file.write(QJsonDocument(report).toJson()) < 0) {
+        return make_ret(Err::BatchJobReportFailedWrite);
+    }
+
+    return make_ret(Ret::Code::Ok);
+}
+
 mu::Ret ConverterController::fileConvert(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath, bool forceMode)
 {
     TRACEFUNC;
@@ -95,6 +321,87 @@ mu::Ret ConverterController::fileConvert(const io::path_t& in, const io::path_t&
     return make_ret(Ret::Code::Ok);
 }
 
+//! NOTE Loads the score once for all the outputs. The outputs which aren't converted page by page are written
+//! together, so that the audio formats are rendered only once
+mu::Ret ConverterController::fileConvert(const io::path_t& in, const io::paths_t& out, const io::path_t& stylePath, bool forceMode)
+{
+    TRACEFUNC;
+
+    LOGI() << "in: " << in << ", out: " << io::pathsToString(out);
+    auto notationProject = notationCreator()->newProject();
+    IF_ASSERT_FAILED(notationProject) {
+        return make_ret(Err::UnknownError);
+    }
+
+    std::vector<INotationWriterPtr> outWriters;
+    for (const io::path_t& path : out) {
+        INotationWriterPtr writer = writers()->writer(io::suffix(path));
+        if (!writer) {
+            return make_ret(Err::ConvertTypeUnknown);
+        }
+        outWriters.push_back(writer);
+    }
+
+    Ret ret = notationProject->load(in, stylePath, forceMode);
+    if (!ret) {
+        LOGE() << "failed load notation, err: " << ret.toString() << ", path: " << in;
+        return make_ret(Err::InFileFailedLoad);
+    }
+
+    globalContext()->setCurrentProject(notationProject);
+
+    INotationPtr notation = notationProject->masterNotation()->notation();
+    //! NOTE The audio formats are rendered once for all of them, the others are written one by one
+    INotationWriter::WriterDevices audioDevices;
+    INotationWriter::WriterDevices otherDevices;
+    std::vector<std::unique_ptr<QFile> > files;
+
+    for (size_t i = 0; i < out.size(); ++i) {
+        if (isConvertPageByPage(io::suffix(out[i]))) {
+            ret = convertPageByPage(outWriters[i], notation, out[i]);
+            if (!ret) {
+                return ret;
+            }
+            continue;
+        }
+
+        std::unique_ptr<QFile> file = std::make_unique<QFile>(out[i].toQString());
+        if (!file->open(QFile::WriteOnly)) {
+            return make_ret(Err::OutFileFailedOpen);
+        }
+
+        file->setProperty("path", out[i].toQString());
+        if (isAudioSuffix(io::suffix(out[i]))) {
+            audioDevices.push_back({ outWriters[i], file.get() });
+        } else {
+            otherDevices.push_back({ outWriters[i], file.get() });
+        }
+        files.push_back(std::move(file));
+    }
+
+    for (const auto& [writer, device] : otherDevices) {
+        ret = writer->write(notation, *device);
+        if (!ret) {
+            LOGE() << "failed write, err: " << ret.toString() << ", path: " << device->property("path").toString();
+            return make_ret(Err::OutFileFailedWrite);
+        }
+    }
+
+    if (!audioDevices.empty()) {
+        ret = audioDevices.front().first->writeFormats(notation, audioDevices);
+        if (!ret) {
+            LOGE() << "failed write, err: " << ret.toString() << ", path: " << io::pathsToString(out);
+            return make_ret(Err::OutFileFailedWrite);
+        }
+    }
+
+    for (std::unique_ptr<QFile>& file : files) {
+        file->close();
+    }
+
+    return make_ret(Ret::Code::Ok);
+}
+
 mu::Ret ConverterController::convertScoreParts(const mu::io::path_t& in, const mu::io::path_t& out, const mu::io::path_t& stylePath,
                                                bool forceMode)
 {
@@ -139,22 +446,37 @@ mu::RetVal<ConverterController::BatchJob> ConverterController::parseBatchJob(con
         return rv;
     }
 
-    QByteArray data = file.readAll();
+    return parseJobs(file.readAll());
+}
+
+mu::RetVal<ConverterController::BatchJob> ConverterController::parseJobs(const QByteArray& data) const
+{
+    RetVal<BatchJob> rv;
     QJsonParseError err;
     QJsonDocument doc = QJsonDocument::fromJson(data, &err);
-    if (err.error != QJsonParseError::NoError || !doc.isArray()) {
+    if (err.error != QJsonParseError::NoError || (!doc.isArray() && !doc.isObject())) {
         rv.ret = make_ret(Err::BatchJobFileFailedParse, err.errorString().toStdString());
         return rv;
     }
 
-    QJsonArray arr = doc.array();
+    //! NOTE A single job may be given as an object instead of an array with one object
+    QJsonArray arr = doc.isArray() ? doc.array() : QJsonArray { doc.object() };
 
     for (const QJsonValue v : arr) {
         QJsonObject obj = v.toObject();
 
+        //! NOTE The out may be a list of paths, to convert the score into several formats at once
         Job job;
         job.in = obj["in"].toString();
-        job.out = obj["out"].toString();
+        if (obj["out"].isArray()) {
+            for (const QJsonValue out : obj["out"].toArray()) {
+                if (!out.toString().isEmpty()) {
+                    job.out.push_back(out.toString());
+                }
+            }
+        } else if (!obj["out"].toString().isEmpty()) {
+            job.out.push_back(obj["out"].toString());
+        }
 
         if (!job.in.empty() && !job.out.empty()) {
             rv.val.push_back(std::move(job));
@@ -165,6 +487,20 @@ mu::RetVal<ConverterController::BatchJob> ConverterController::parseBatchJob(con
     return rv;
 }
 
+QJsonValue ConverterController::outToJson(const io::paths_t& out) const
+{
+    if (out.size() == 1) {
+        return out.front().toQString();
+    }
+
+    QJsonArray arr;
+    for (const io::path_t& path : out) {
+        arr.append(path.toQString());
+    }
+
+    return arr;
+}
+
 bool ConverterController::isConvertPageByPage(const std::string& suffix) const
 {
     QList<std::string> types {
@@ -174,31 +510,48 @@ bool ConverterController::isConvertPageByPage(const std::string& suffix) const
     return types.contains(suffix);
 }
 
+bool ConverterController::isAudioSuffix(const std::string& suffix) const
+{
+    QList<std::string> types {
+        WAV_SUFFIX,
+        MP3_SUFFIX,
+        OGG_SUFFIX,
+        FLAC_SUFFIX
+    };
+
+    return types.contains(suffix);
+}
+
 mu::Ret ConverterController::convertPageByPage(INotationWriterPtr writer, INotationPtr notation, const mu::io::path_t& out) const
 {
     TRACEFUNC;
 
+    //! NOTE All the pages are given to the writer at once, it may paint them concurrently
+    std::vector<std::unique_ptr<QFile> > files;
+    std::vector<QIODevice*> devices;
+
     for (size_t i = 0; i < notation->elements()->pages().size(); i++) {
         const QString filePath = io::path_t(io::dirpath(out) + "/" + io::basename(out) + "-%1." + io::suffix(out)).toQString().arg(i + 1);
 
-        QFile file(filePath);
-        if (!file.open(QFile::WriteOnly)) {
+        std::unique_ptr<QFile> file = std::make_unique<QFile>(filePath);
+        if (!file->open(QFile::WriteOnly)) {
             return make_ret(Err::OutFileFailedOpen);
         }
 
-        INotationWriter::Options options {
-            { INotationWriter::OptionKey::PAGE_NUMBER, Val(static_cast<int>(i)) },
-        };
+        file->setProperty("path", out.toQString());
 
-        file.setProperty("path", out.toQString());
+        devices.push_back(file.get());
+        files.push_back(std::move(file));
+    }
 
-        Ret ret = writer->write(notation, file, options);
-        if (!ret) {
-            LOGE() << "failed write, err: " << ret.toString() << ", path: " << out;
-            return make_ret(Err::OutFileFailedWrite);
-        }
+    Ret ret = writer->writePages(notation, devices);
+    if (!ret) {
+        LOGE() << "failed write, err: " << ret.toString() << ", path: " << out;
+        return make_ret(Err::OutFileFailedWrite);
+    }
 
-        file.close();
+    for (std::unique_ptr<QFile>& file : files) {
+        file->close();
     }
 
     return make_ret(Ret::Code::Ok);
@@ -270,16 +623,46 @@ mu::Ret ConverterController::convertScorePartsToPngs(INotationWriterPtr writer,
         excerpts.push_back(e->notation());
     }
 
-    io::path_t pngFilePath = io::dirpath(out) + "/" + io::path_t(io::basename(out) + "-excerpt.png");
+    //! NOTE Every part has its own files, '<name>-excerpt-<n>-<page>.png', they used to overwrite each other's
+    auto pngFilePath = [&out](size_t excerptIdx) {
+        return io::dirpath(out) + "/" + io::path_t(io::basename(out) + "-excerpt-" + std::to_string(excerptIdx + 1) + ".png");
+    };
+
+    if (excerpts.size() < MIN_PARTS_TO_PAINT_CONCURRENTLY || draw::Painter::extended) {
+        for (size_t i = 0; i < excerpts.size(); i++) {
+            Ret ret = convertPageByPage(writer, excerpts[i], pngFilePath(i));
+            if (!ret) {
+                return ret;
+            }
+        }
 
+        return make_ret(Ret::Code::Ok);
+    }
+
+    //! NOTE The parts are painted on the workers, so everything that is not a read of their score is done here:
+    //! the injections of the writer are resolved by the conversion of the master score above,
+    //! and the layout of the parts is finished and its damage taken before they are painted
+    for (const INotationPtr& excerpt : excerpts) {
+        excerpt->painting()->prepareView(RectF(), /*isPrinting*/ true);
+        excerpt->painting()->damageSince(0);
+    }
+
+    std::vector<std::future<Ret> > results;
     for (size_t i = 0; i < excerpts.size(); i++) {
-        Ret ret = convertPageByPage(writer, excerpts[i], pngFilePath);
-        if (!ret) {
-            return ret;
+        results.push_back(partWorkers()->submit([this, writer, &excerpts, &pngFilePath, i]() {
+            return convertPageByPage(writer, excerpts[i], pngFilePath(i));
+        }));
+    }
+
+    ret = make_ret(Ret::Code::Ok);
+    for (std::future<Ret>& result : results) {
+        Ret partRet = result.get();
+        if (!partRet && ret) {
+            ret = partRet;
         }
     }
 
-    return make_ret(Ret::Code::Ok);
+    return ret;
 }
 
 mu::Ret ConverterController::exportScoreMedia(const mu::io::path_t& in, const mu::io::path_t& out,
@@ -299,6 +682,22 @@ mu::Ret ConverterController::exportScoreMeta(const mu::io::path_t& in, const mu:
     return BackendApi::exportScoreMeta(in, out, stylePath, forceMode);
 }
 
+mu::Ret ConverterController::exportScoreLayoutStatistics(const mu::io::path_t& in, const mu::io::path_t& out,
+                                                         const io::path_t& stylePath, bool forceMode)
+{
+    TRACEFUNC;
+
+    return BackendApi::exportScoreLayoutStatistics(in, out, stylePath, forceMode);
+}
+
+mu::Ret ConverterController::exportScoreMemoryReport(const mu::io::path_t& in, const mu::io::path_t& out,
+                                                     const io::path_t& stylePath, bool forceMode)
+{
+    TRACEFUNC;
+
+    return BackendApi::exportScoreMemoryReport(in, out, stylePath, forceMode);
+}
+
 mu::Ret ConverterController::exportScoreParts(const mu::io::path_t& in, const mu::io::path_t& out, const io::path_t& stylePath,
                                               bool forceMode)
 {
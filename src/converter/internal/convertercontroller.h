@@ -24,6 +24,10 @@
 
 #include <list>
 
+#include <QJsonArray>
+
+class QLocalSocket;
+
 #include "../iconvertercontroller.h"
 
 #include "modularity/ioc.h"
@@ -47,7 +51,9 @@ public:
 
     Ret fileConvert(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                     bool forceMode = false) override;
-    Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false) override;
+    Ret batchConvert(const io::path_t& batchJobFile, const io::path_t& stylePath = io::path_t(), bool forceMode = false,
+                     size_t workerCount = 1, const io::path_t& reportPath = io::path_t()) override;
+    Ret runJobServer(const std::string& serverName, const io::path_t& stylePath = io::path_t(), bool forceMode = false) override;
     Ret convertScoreParts(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                           bool forceMode = false) override;
 
@@ -56,6 +62,10 @@ public:
                          bool forceMode = false) override;
     Ret exportScoreMeta(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                         bool forceMode = false) override;
+    Ret exportScoreLayoutStatistics(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
+                                    bool forceMode = false) override;
+    Ret exportScoreMemoryReport(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
+                                bool forceMode = false) override;
     Ret exportScoreParts(const io::path_t& in, const io::path_t& out, const io::path_t& stylePath = io::path_t(),
                          bool forceMode = false) override;
     Ret exportScorePartsPdfs(const io::path_t& in, const io::path_t& out,
@@ -71,14 +81,25 @@ private:
 
     struct Job {
         io::path_t in;
-        io::path_t out;
+        io::paths_t out;
     };
 
     using BatchJob = std::list<Job>;
 
     RetVal<BatchJob> parseBatchJob(const io::path_t& batchJobFile) const;
+    RetVal<BatchJob> parseJobs(const QByteArray& data) const;
+    QJsonValue outToJson(const io::paths_t& out) const;
+
+    void serveJobConnection(QLocalSocket* socket, const io::path_t& stylePath, bool forceMode);
+
+    Ret fileConvert(const io::path_t& in, const io::paths_t& out, const io::path_t& stylePath, bool forceMode);
+    Ret convertJobs(const BatchJob& jobs, const io::path_t& stylePath, bool forceMode, QJsonArray& report);
+    Ret convertJobsInWorkers(const BatchJob& jobs, const io::path_t& stylePath, bool forceMode, size_t workerCount,
+                             QJsonArray& report) const;
+    Ret writeBatchReport(const io::path_t& reportPath, const QJsonArray& report) const;
 
     bool isConvertPageByPage(const std::string& suffix) const;
+    bool isAudioSuffix(const std::string& suffix) const;
     Ret convertPageByPage(project::INotationWriterPtr writer, notation::INotationPtr notation, const io::path_t& out) const;
     Ret convertFullNotation(project::INotationWriterPtr writer, notation::INotationPtr notation, const io::path_t& out) const;
 
@@ -41,6 +41,7 @@
 
 #include "view/diagnosticspathsmodel.h"
 #include "view/system/profilerviewmodel.h"
+#include "view/system/audioperformanceviewmodel.h"
 
 #include "view/keynav/diagnosticnavigationmodel.h"
 #include "view/keynav/abstractkeynavdevitem.h"
@@ -86,6 +87,8 @@ void DiagnosticsModule::resolveImports()
     if (ir) {
         ir->registerQmlUri(Uri("musescore://diagnostics/system/paths"), "MuseScore/Diagnostics/DiagnosticPathsDialog.qml");
         ir->registerQmlUri(Uri("musescore://diagnostics/system/profiler"), "MuseScore/Diagnostics/DiagnosticProfilerDialog.qml");
+        ir->registerQmlUri(Uri("musescore://diagnostics/system/audioperformance"),
+                           "MuseScore/Diagnostics/DiagnosticAudioPerformanceDialog.qml");
         ir->registerQmlUri(Uri("musescore://diagnostics/navigation/tree"), "MuseScore/Diagnostics/DiagnosticNavigationDialog.qml");
         ir->registerQmlUri(Uri("musescore://diagnostics/accessible/tree"), "MuseScore/Diagnostics/DiagnosticAccessibleDialog.qml");
         ir->registerQmlUri(Uri("musescore://diagnostics/engraving/elements"), "MuseScore/Diagnostics/EngravingElementsDialog.qml");
@@ -101,6 +104,7 @@ void DiagnosticsModule::registerUiTypes()
 {
     qmlRegisterType<DiagnosticsPathsModel>("MuseScore.Diagnostics", 1, 0, "DiagnosticsPathsModel");
     qmlRegisterType<ProfilerViewModel>("MuseScore.Diagnostics", 1, 0, "ProfilerViewModel");
+    qmlRegisterType<AudioPerformanceViewModel>("MuseScore.Diagnostics", 1, 0, "AudioPerformanceViewModel");
 
     qmlRegisterType<DiagnosticNavigationModel>("MuseScore.Diagnostics", 1, 0, "DiagnosticNavigationModel");
     qmlRegisterUncreatableType<AbstractKeyNavDevItem>("MuseScore.Diagnostics", 1, 0, "AbstractKeyNavDevItem", "Cannot create a Abstract");
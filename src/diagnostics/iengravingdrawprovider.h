@@ -35,6 +35,7 @@ public:
 
     virtual Ret genDrawData(const io::path_t& scoresDir, const io::path_t& outDir) = 0;
     virtual Ret drawDataToPng(const io::path_t& dataFile, const io::path_t& outFile) = 0;
+    virtual Ret compareDrawData(const io::path_t& refDir, const io::path_t& curDir, const io::path_t& outDir) = 0;
 };
 }
 
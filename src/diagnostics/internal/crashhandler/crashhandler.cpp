@@ -29,11 +29,22 @@
 #include <thirdparty/google_crashpad_client/client/settings.h>
 
 #include "log.h"
+#include "thirdparty/haw_logger/logger/asynclogdest.h"
 #include "global/version.h"
 
 using namespace mu::diagnostics;
 using namespace crashpad;
 
+#ifdef Q_OS_LINUX
+static bool flushLogsOnCrash(int, siginfo_t*, ucontext_t*)
+{
+    //! NOTE Best effort, the buffered messages are the most useful ones to read next to the dump
+    haw::logger::AsyncLogDest::flushAll();
+    return false;
+}
+
+#endif
+
 CrashHandler::~CrashHandler()
 {
     delete m_client;
@@ -88,6 +99,12 @@ bool CrashHandler::start(const io::path_t& handlerFilePath, const io::path_t& du
         false // asynchronous_start
         );
 
+#ifdef Q_OS_LINUX
+    if (success) {
+        CrashpadClient::SetFirstChanceExceptionHandler(flushLogsOnCrash);
+    }
+#endif
+
     return success;
 }
 
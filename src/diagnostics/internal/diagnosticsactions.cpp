@@ -44,6 +44,21 @@ const UiActionList DiagnosticsActions::m_actions = {
              mu::context::CTX_ANY,
              TranslatableString("action", "Show pr&ofiler…")
              ),
+    UiAction("diagnostic-show-audio-performance",
+             mu::context::UiCtxAny,
+             mu::context::CTX_ANY,
+             TranslatableString::untranslatable("Show a&udio performance…")
+             ),
+    UiAction("diagnostic-start-trace",
+             mu::context::UiCtxAny,
+             mu::context::CTX_ANY,
+             TranslatableString::untranslatable("Start &trace recording")
+             ),
+    UiAction("diagnostic-save-trace",
+             mu::context::UiCtxAny,
+             mu::context::CTX_ANY,
+             TranslatableString::untranslatable("Stop and sa&ve trace…")
+             ),
     UiAction("diagnostic-show-navigation-tree",
              mu::context::UiCtxAny,
              mu::context::CTX_ANY,
@@ -63,6 +78,11 @@ const UiActionList DiagnosticsActions::m_actions = {
              mu::context::UiCtxAny,
              mu::context::CTX_ANY,
              TranslatableString("action", "Engraving &elements")
+             ),
+    UiAction("diagnostic-allocators-dump",
+             mu::context::UiCtxAny,
+             mu::context::CTX_ANY,
+             TranslatableString::untranslatable("Allocators &dump")
              )
 };
 
@@ -22,6 +22,8 @@
 #include "diagnosticsactionscontroller.h"
 
 #include "types/uri.h"
+#include "global/allocator.h"
+#include "translation.h"
 
 #include "view/diagnosticaccessiblemodel.h"
 
@@ -33,6 +35,7 @@ using namespace mu::framework;
 
 static const mu::UriQuery SYSTEM_PATHS_URI("musescore://diagnostics/system/paths?sync=false&modal=false&floating=true");
 static const mu::UriQuery PROFILER_URI("musescore://diagnostics/system/profiler?sync=false&modal=false&floating=true");
+static const mu::UriQuery AUDIO_PERFORMANCE_URI("musescore://diagnostics/system/audioperformance?sync=false&modal=false&floating=true");
 static const mu::UriQuery NAVIGATION_TREE_URI("musescore://diagnostics/navigation/tree?sync=false&modal=false&floating=true");
 static const mu::UriQuery ACCESSIBLE_TREE_URI("musescore://diagnostics/accessible/tree?sync=false&modal=false&floating=true");
 static const mu::UriQuery ENGRAVING_ELEMENTS_URI("musescore://diagnostics/engraving/elements?sync=false&modal=false&floating=true");
@@ -41,11 +44,15 @@ void DiagnosticsActionsController::init()
 {
     dispatcher()->reg(this, "diagnostic-show-paths", [this]() { openUri(SYSTEM_PATHS_URI); });
     dispatcher()->reg(this, "diagnostic-show-profiler", [this]() { openUri(PROFILER_URI); });
+    dispatcher()->reg(this, "diagnostic-show-audio-performance", [this]() { openUri(AUDIO_PERFORMANCE_URI); });
     dispatcher()->reg(this, "diagnostic-show-navigation-tree", [this]() { openUri(NAVIGATION_TREE_URI); });
     dispatcher()->reg(this, "diagnostic-show-accessible-tree", [this]() { openUri(ACCESSIBLE_TREE_URI); });
     dispatcher()->reg(this, "diagnostic-accessible-tree-dump", []() { DiagnosticAccessibleModel::dumpTree(); });
     dispatcher()->reg(this, "diagnostic-show-engraving-elements", [this]() { openUri(ENGRAVING_ELEMENTS_URI, false); });
+    dispatcher()->reg(this, "diagnostic-allocators-dump", []() { mu::AllocatorsRegister::instance()->printState("=== Allocators ==="); });
     dispatcher()->reg(this, "diagnostic-save-diagnostic-files", this, &DiagnosticsActionsController::saveDiagnosticFiles);
+    dispatcher()->reg(this, "diagnostic-start-trace", this, &DiagnosticsActionsController::startTrace);
+    dispatcher()->reg(this, "diagnostic-save-trace", this, &DiagnosticsActionsController::saveTrace);
 }
 
 void DiagnosticsActionsController::openUri(const mu::UriQuery& uri, bool isSingle)
@@ -64,3 +71,32 @@ void DiagnosticsActionsController::saveDiagnosticFiles()
         LOGE() << ret.toString();
     }
 }
+
+void DiagnosticsActionsController::startTrace()
+{
+    using namespace haw::profiler;
+
+    //! NOTE Start from empty buffers so the trace covers only what comes next
+    Profiler::instance()->clear();
+    Profiler::instance()->setTracingEnabled(true);
+}
+
+void DiagnosticsActionsController::saveTrace()
+{
+    using namespace haw::profiler;
+
+    Profiler::instance()->setTracingEnabled(false);
+
+    io::path_t path = interactive()->selectSavingFile(
+        qtrc("diagnostics", "Save trace"),
+        configuration()->diagnosticFilesDefaultSavingPath() + "/trace.json",
+        { "Trace Event Format (*.json)" });
+
+    if (path.empty()) {
+        return;
+    }
+
+    if (!Profiler::instance()->saveTrace(path.toStdString())) {
+        LOGE() << "failed to save trace: " << path;
+    }
+}
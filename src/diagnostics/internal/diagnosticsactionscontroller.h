@@ -28,6 +28,7 @@
 #include "iinteractive.h"
 #include "accessibility/iaccessibilitycontroller.h"
 #include "isavediagnosticfilesscenario.h"
+#include "idiagnosticsconfiguration.h"
 
 namespace mu::diagnostics {
 class DiagnosticsActionsController : public actions::Actionable
@@ -35,6 +36,7 @@ class DiagnosticsActionsController : public actions::Actionable
     INJECT(diagnostics, actions::IActionsDispatcher, dispatcher)
     INJECT(diagnostics, framework::IInteractive, interactive)
     INJECT(diagnostics, diagnostics::ISaveDiagnosticFilesScenario, saveDiagnosticsScenario)
+    INJECT(diagnostics, diagnostics::IDiagnosticsConfiguration, configuration)
 
 public:
     DiagnosticsActionsController() = default;
@@ -44,6 +46,8 @@ public:
 private:
     void openUri(const mu::UriQuery& uri, bool isSingle = true);
     void saveDiagnosticFiles();
+    void startTrace();
+    void saveTrace();
 };
 }
 
@@ -0,0 +1,149 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "drawdatacomparator.h"
+
+#include <set>
+
+#include "global/concurrency/taskscheduler.h"
+#include "global/io/dir.h"
+#include "global/io/file.h"
+#include "global/io/fileinfo.h"
+
+#include "draw/utils/drawdatacomp.h"
+#include "draw/utils/drawdatarw.h"
+
+#include "drawdataconverter.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::diagnostics;
+using namespace mu::draw;
+
+static const std::vector<std::string> DATA_FILTER = { "*.json" };
+
+static std::set<std::string> dataNames(const io::path_t& dir)
+{
+    std::set<std::string> names;
+
+    RetVal<io::paths_t> files = io::Dir::scanFiles(dir, DATA_FILTER, io::ScanMode::FilesInCurrentDir);
+    for (const io::path_t& file : files.val) {
+        names.insert(io::FileInfo(file).completeBaseName().toStdString());
+    }
+
+    return names;
+}
+
+Ret DrawDataComparator::compareDirs(const io::path_t& refDir, const io::path_t& curDir, const io::path_t& outDir) const
+{
+    TRACEFUNC;
+
+    std::set<std::string> names = dataNames(refDir);
+    std::set<std::string> curNames = dataNames(curDir);
+    names.insert(curNames.cbegin(), curNames.cend());
+
+    if (names.empty()) {
+        LOGE() << "no draw data in: " << refDir << ", " << curDir;
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    //! NOTE The pages are read and compared concurrently,
+    //! only the rasterizing (QPixmap) must be done on the main thread
+    TaskScheduler scheduler;
+    std::vector<std::future<PageResult> > futures;
+    futures.reserve(names.size());
+    for (const std::string& name : names) {
+        futures.push_back(scheduler.submit([this, name, &refDir, &curDir]() {
+            return comparePage(name, refDir, curDir);
+        }));
+    }
+
+    size_t diffCount = 0;
+    for (std::future<PageResult>& future : futures) {
+        PageResult result = future.get();
+        if (!result.isDifferent) {
+            continue;
+        }
+
+        LOGI() << "Different: " << result.name;
+        saveDiff(result, outDir);
+        ++diffCount;
+    }
+
+    LOGI() << "compared pages: " << names.size() << ", different: " << diffCount;
+
+    return make_ok();
+}
+
+DrawDataComparator::PageResult DrawDataComparator::comparePage(const std::string& name, const io::path_t& refDir,
+                                                               const io::path_t& curDir) const
+{
+    PageResult result;
+    result.name = name;
+
+    RetVal<DrawDataPtr> ref = DrawDataRW::readData(refDir + "/" + name + ".json");
+    RetVal<DrawDataPtr> cur = DrawDataRW::readData(curDir + "/" + name + ".json");
+    result.ref = ref.val;
+    result.cur = cur.val;
+
+    //! NOTE A page which exists only in one of the dirs is different
+    if (!ref.ret || !cur.ret || !result.ref || !result.cur) {
+        result.isDifferent = true;
+        return result;
+    }
+
+    result.diff = DrawDataComp::compare(result.cur, result.ref);
+    result.isDifferent = !result.diff.empty();
+
+    return result;
+}
+
+void DrawDataComparator::saveDiff(const PageResult& result, const io::path_t& outDir) const
+{
+    DrawDataConverter c;
+
+    if (result.ref) {
+        io::File::writeFile(outDir + "/" + result.name + ".ref.png", c.drawDataToPixmap(result.ref).data());
+    }
+
+    if (result.cur) {
+        io::File::writeFile(outDir + "/" + result.name + ".png", c.drawDataToPixmap(result.cur).data());
+    }
+
+    if (!result.ref || !result.cur) {
+        return;
+    }
+
+    //! NOTE The reference in gray, the added in red and the removed in blue
+    Pixmap px = c.drawDataToPixmap(result.ref);
+    c.drawOnPixmap(px, result.ref, Color("#999999"));
+
+    if (result.diff.dataRemoved) {
+        c.drawOnPixmap(px, result.diff.dataRemoved, Color("#0000ff"));
+    }
+    if (result.diff.dataAdded) {
+        c.drawOnPixmap(px, result.diff.dataAdded, Color("#ff0000"));
+    }
+
+    io::File::writeFile(outDir + "/" + result.name + ".diff.png", px.data());
+}
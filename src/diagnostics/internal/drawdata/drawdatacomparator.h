@@ -0,0 +1,54 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_DIAGNOSTICS_DRAWDATACOMPARATOR_H
+#define MU_DIAGNOSTICS_DRAWDATACOMPARATOR_H
+
+#include "global/types/ret.h"
+#include "global/io/path.h"
+#include "draw/types/drawdata.h"
+
+namespace mu::diagnostics {
+//! NOTE Compares the draw data of the pages structurally,
+//! only the pages which differ are rasterized: name.ref.png, name.png and name.diff.png
+class DrawDataComparator
+{
+public:
+    DrawDataComparator() = default;
+
+    Ret compareDirs(const io::path_t& refDir, const io::path_t& curDir, const io::path_t& outDir) const;
+
+private:
+    struct PageResult {
+        std::string name;
+        draw::DrawDataPtr ref;
+        draw::DrawDataPtr cur;
+        draw::Diff diff;
+        bool isDifferent = false;
+    };
+
+    PageResult comparePage(const std::string& name, const io::path_t& refDir, const io::path_t& curDir) const;
+    void saveDiff(const PageResult& result, const io::path_t& outDir) const;
+};
+}
+
+#endif // MU_DIAGNOSTICS_DRAWDATACOMPARATOR_H
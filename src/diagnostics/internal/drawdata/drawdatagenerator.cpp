@@ -47,7 +47,7 @@ using namespace mu::engraving;
 using namespace mu::iex::guitarpro;
 
 static const int CANVAS_DPI = 300;
-static const std::vector<std::string> FILES_FILTER = { "*.mscz", "*.gp", "*.gpx", "*.gp4", "*.gp5" };
+static const std::vector<std::string> FILES_FILTER = { "*.mscz", "*.mscx", "*.gp", "*.gpx", "*.gp4", "*.gp5" };
 
 Ret DrawDataGenerator::processDir(const io::path_t& scoreDir, const io::path_t& outDir, const io::path_t& ignoreFile)
 {
@@ -55,7 +55,8 @@ Ret DrawDataGenerator::processDir(const io::path_t& scoreDir, const io::path_t&
 
     PROFILER_CLEAR;
 
-    RetVal<io::paths_t> scores = io::Dir::scanFiles(scoreDir, FILES_FILTER);
+    //! NOTE As the vtest pngs, the scores of the subdirs (e.g. vtest/scores/disabled) are not processed
+    RetVal<io::paths_t> scores = io::Dir::scanFiles(scoreDir, FILES_FILTER, io::ScanMode::FilesInCurrentDir);
     for (size_t i = 0; i < scores.val.size(); ++i) {
 //        if (i < 1919) {
 //            continue;
@@ -106,25 +107,21 @@ Ret DrawDataGenerator::processFile(const io::path_t& path, const io::path_t& out
         score->doLayout();
     }
 
-    std::shared_ptr<BufferedPaintProvider> pd = std::make_shared<BufferedPaintProvider>();
-    {
-        TRACEFUNC_C("Paint");
-        Painter painter(pd, "DrawData");
-        Paint::Options opt;
-        opt.isSetViewport = true;
-        opt.isMultiPage = false;
-        opt.isPrinting = true;
-
-        Paint::paintScore(&painter, score, opt);
+    //! NOTE A data per page, named as the pages exported to png: name-1.json, name-2.json...
+    Ret ret = make_ok();
+    for (size_t pageIdx = 0; pageIdx < score->npages(); ++pageIdx) {
+        DrawDataPtr drawData = genPageDrawData(score, pageIdx);
+        io::path_t filePath = outDir + "/" + io::FileInfo(path).baseName() + "-" + std::to_string(pageIdx + 1) + ".json";
+        Ret writeRet = DrawDataRW::writeData(filePath, drawData);
+        if (!writeRet) {
+            LOGE() << "failed write file: " << filePath << ", err: " << writeRet.toString();
+            ret = writeRet;
+        }
     }
 
-    DrawDataPtr drawData = genDrawData(path);
-    io::path_t filePath = outDir + "/" + io::FileInfo(path).baseName() + ".json";
-    DrawDataRW::writeData(filePath, drawData);
-
     delete score;
 
-    return make_ok();
+    return ret;
 }
 
 DrawDataPtr DrawDataGenerator::genDrawData(const io::path_t& scorePath) const
@@ -140,13 +137,23 @@ DrawDataPtr DrawDataGenerator::genDrawData(const io::path_t& scorePath) const
         score->doLayout();
     }
 
+    DrawDataPtr drawData = genPageDrawData(score, 0);
+
+    delete score;
+
+    return drawData;
+}
+
+DrawDataPtr DrawDataGenerator::genPageDrawData(MasterScore* score, size_t pageIdx) const
+{
+    TRACEFUNC_C("Paint");
+
     std::shared_ptr<BufferedPaintProvider> pd = std::make_shared<BufferedPaintProvider>();
     {
-        TRACEFUNC_C("Paint");
         Painter painter(pd, "DrawData");
         Paint::Options opt;
-        opt.fromPage = 0;
-        opt.toPage = 0;
+        opt.fromPage = static_cast<int>(pageIdx);
+        opt.toPage = static_cast<int>(pageIdx);
         opt.deviceDpi = CANVAS_DPI;
         opt.printPageBackground = true;
         opt.isSetViewport = true;
@@ -156,8 +163,7 @@ DrawDataPtr DrawDataGenerator::genDrawData(const io::path_t& scorePath) const
         Paint::paintScore(&painter, score, opt);
     }
 
-    DrawDataPtr drawData = pd->drawData();
-    return drawData;
+    return pd->drawData();
 }
 
 Pixmap DrawDataGenerator::genImage(const io::path_t& scorePath) const
@@ -46,6 +46,7 @@ private:
 
     std::vector<std::string> loadIgnore(const mu::io::path_t& ignoreFile) const;
     bool loadScore(engraving::MasterScore* score, const io::path_t& path) const;
+    draw::DrawDataPtr genPageDrawData(engraving::MasterScore* score, size_t pageIdx) const;
 };
 }
 
@@ -23,6 +23,7 @@
 
 #include "drawdatagenerator.h"
 #include "drawdataconverter.h"
+#include "drawdatacomparator.h"
 
 #include "log.h"
 
@@ -31,6 +32,7 @@ using namespace mu::diagnostics;
 
 // --diagnostic-gen-drawdata ./vtest/scores --diagnostic-output ./drawdata
 // --diagnostic-drawdata-to-png ./drawdata/accidental-24.json --diagnostic-output ./drawdata/accidental-24.png
+// --diagnostic-com-drawdata ./drawdata_ref --diagnostic-com-drawdata ./drawdata --diagnostic-output ./drawdata_diff
 
 Ret EngravingDrawProvider::genDrawData(const io::path_t& scoresDir, const io::path_t& outDir)
 {
@@ -44,3 +46,10 @@ Ret EngravingDrawProvider::drawDataToPng(const io::path_t& dataFile, const io::p
     DrawDataConverter c;
     return c.drawDataToPng(dataFile, outFile);
 }
+
+Ret EngravingDrawProvider::compareDrawData(const io::path_t& refDir, const io::path_t& curDir, const io::path_t& outDir)
+{
+    LOGI() << "refDir: " << refDir << ", curDir: " << curDir << ", outDir: " << outDir;
+    DrawDataComparator c;
+    return c.compareDirs(refDir, curDir, outDir);
+}
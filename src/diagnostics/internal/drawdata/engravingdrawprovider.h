@@ -32,6 +32,7 @@ public:
 
     Ret genDrawData(const io::path_t& scoresDir, const io::path_t& outDir) override;
     Ret drawDataToPng(const io::path_t& dataFile, const io::path_t& outFile) override;
+    Ret compareDrawData(const io::path_t& refDir, const io::path_t& curDir, const io::path_t& outDir) override;
 };
 }
 
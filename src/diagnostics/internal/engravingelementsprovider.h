@@ -24,6 +24,7 @@
 
 #include <string>
 #include <map>
+#include <mutex>
 
 #include "../iengravingelementsprovider.h"
 
@@ -69,6 +70,7 @@ private:
     std::map<std::string, ObjectStatistic> m_statistics;
 
     EngravingObjectList m_elements;
+    std::mutex m_mutex; // excerpts are laid out concurrently, see MasterScore::doLayoutScoresRange
 
     EngravingObjectList m_selected;
     async::Channel<const mu::engraving::EngravingObject*, bool> m_selectChanged;
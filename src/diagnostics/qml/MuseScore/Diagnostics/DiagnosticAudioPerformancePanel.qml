@@ -0,0 +1,101 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+import QtQuick 2.15
+
+import MuseScore.Ui 1.0
+import MuseScore.UiComponents 1.0
+import MuseScore.Diagnostics 1.0
+
+Rectangle {
+
+    id: root
+
+    objectName: "DiagnosticAudioPerformancePanel"
+    color: ui.theme.backgroundPrimaryColor
+
+    Component.onCompleted: {
+        perfModel.load()
+    }
+
+    Item {
+        id: toolPanel
+        anchors.left: parent.left
+        anchors.right: parent.right
+        height: 48
+
+        Row {
+            id: btnRow
+            anchors.top: parent.top
+            anchors.bottom: parent.bottom
+            anchors.right: parent.right
+            anchors.rightMargin: 16
+            width: childrenRect.width
+            spacing: 8
+
+            FlatButton {
+                anchors.verticalCenter: parent.verticalCenter
+                text: "Reset"
+                onClicked: perfModel.reset()
+            }
+        }
+    }
+
+    AudioPerformanceViewModel {
+        id: perfModel
+    }
+
+    ListView {
+        anchors.top: toolPanel.bottom
+        anchors.bottom: parent.bottom
+        anchors.left: parent.left
+        anchors.right: parent.right
+        clip: true
+        model: perfModel
+        section.property: "groupRole"
+        section.delegate: Rectangle {
+            width: parent.width
+            height: 24
+            color: ui.theme.backgroundSecondaryColor
+            StyledTextLabel {
+                anchors.fill: parent
+                anchors.margins: 2
+                horizontalAlignment: Qt.AlignLeft
+                text: section
+            }
+        }
+        delegate: ListItemBlank {
+
+            anchors.left: parent ? parent.left : undefined
+            anchors.right: parent ? parent.right : undefined
+            height: 24
+
+            StyledTextLabel {
+                anchors.fill: parent
+                anchors.leftMargin: 16
+                verticalAlignment: Text.AlignVCenter
+                horizontalAlignment: Text.AlignLeft
+                font.family: "Consolas"
+                text: dataRole
+            }
+        }
+    }
+}
@@ -69,6 +69,13 @@ Rectangle {
             width: childrenRect.width
             spacing: 8
 
+            CheckBox {
+                anchors.verticalCenter: parent.verticalCenter
+                text: "Layout statistics"
+                checked: profModel.isLayoutStatisticsEnabled
+                onClicked: profModel.isLayoutStatisticsEnabled = !profModel.isLayoutStatisticsEnabled
+            }
+
             FlatButton {
                 anchors.verticalCenter: parent.verticalCenter
                 text: "Update"
@@ -0,0 +1,153 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "audioperformanceviewmodel.h"
+
+#include <algorithm>
+
+#include "audio/iaudiooutput.h"
+
+#include "log.h"
+
+using namespace mu::diagnostics;
+using namespace mu::audio;
+
+static constexpr int UPDATE_INTERVAL_MS = 500;
+
+static QString loadString(float load)
+{
+    return QString("%1%").arg(load * 100.f, 0, 'f', 1);
+}
+
+AudioPerformanceViewModel::AudioPerformanceViewModel(QObject* parent)
+    : QAbstractListModel(parent)
+{
+    m_updateTimer.setInterval(UPDATE_INTERVAL_MS);
+    connect(&m_updateTimer, &QTimer::timeout, this, &AudioPerformanceViewModel::requestStats);
+}
+
+QVariant AudioPerformanceViewModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid()) {
+        return QVariant();
+    }
+
+    const Item& item = m_list.at(index.row());
+    switch (role) {
+    case rData: return QVariant::fromValue(item.data);
+    case rGroup: return QVariant::fromValue(item.group);
+    default: break;
+    }
+
+    return QVariant();
+}
+
+int AudioPerformanceViewModel::rowCount(const QModelIndex& parent) const
+{
+    Q_UNUSED(parent);
+    return m_list.count();
+}
+
+QHash<int, QByteArray> AudioPerformanceViewModel::roleNames() const
+{
+    static const QHash<int, QByteArray> roles = {
+        { rData, "dataRole" },
+        { rGroup, "groupRole" },
+    };
+    return roles;
+}
+
+void AudioPerformanceViewModel::load()
+{
+    requestStats();
+    m_updateTimer.start();
+}
+
+void AudioPerformanceViewModel::reset()
+{
+    playback()->audioOutput()->resetPerformanceStats();
+    requestStats();
+}
+
+void AudioPerformanceViewModel::requestStats()
+{
+    //! NOTE Skip the tick if the audio thread hasn't answered the previous request yet
+    if (m_isRequested) {
+        return;
+    }
+
+    m_isRequested = true;
+
+    playback()->audioOutput()->performanceStats()
+    .onResolve(this, [this](const AudioPerformanceStats& stats) {
+        m_isRequested = false;
+        setStats(stats);
+    })
+    .onReject(this, [this](int code, const std::string& msg) {
+        m_isRequested = false;
+        LOGE() << "failed to get the audio performance, code: " << code << ", " << msg;
+    });
+}
+
+void AudioPerformanceViewModel::setStats(const AudioPerformanceStats& stats)
+{
+    beginResetModel();
+
+    m_list.clear();
+
+    auto append = [this](const QString& group, const QString& data) {
+        Item item;
+        item.group = group;
+        item.data = data;
+        m_list.append(item);
+    };
+
+    QString group = "Engine";
+    append(group, QString("Blocks: %1, deadline misses: %2").arg(stats.blocksCount).arg(stats.deadlineMissCount));
+    append(group, QString("Block time avg: %1 us, max: %2 us, deadline: %3 us")
+           .arg(stats.averageBlockUsecs, 0, 'f', 1)
+           .arg(stats.maxBlockUsecs, 0, 'f', 1)
+           .arg(stats.blockDeadlineUsecs, 0, 'f', 1));
+    append(group, QString("Load avg: %1, max: %2").arg(loadString(stats.load)).arg(loadString(stats.maxLoad)));
+    append(group, QString("Active voices: %1").arg(stats.activeVoices));
+
+    group = "Buffer";
+    append(group, QString("Underruns: %1, missed frames: %2").arg(stats.bufferUnderrunCount).arg(stats.missedFramesCount));
+
+    //! NOTE The heaviest channels first, they are the ones to look at when the playback glitches
+    std::vector<AudioChannelPerformance> channels = stats.channels;
+    std::sort(channels.begin(), channels.end(), [](const AudioChannelPerformance& f, const AudioChannelPerformance& s) {
+        return f.load > s.load;
+    });
+
+    group = "Channels";
+    for (const AudioChannelPerformance& ch : channels) {
+        append(group, QString("%1 %2: load avg: %3, max: %4, fx: %5, voices: %6")
+               .arg(ch.isAux ? "Aux" : "Track")
+               .arg(ch.trackId)
+               .arg(loadString(ch.load))
+               .arg(loadString(ch.maxLoad))
+               .arg(loadString(ch.fxLoad))
+               .arg(ch.activeVoices));
+    }
+
+    endResetModel();
+}
@@ -0,0 +1,70 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_DIAGNOSTICS_AUDIOPERFORMANCEVIEWMODEL_H
+#define MU_DIAGNOSTICS_AUDIOPERFORMANCEVIEWMODEL_H
+
+#include <QAbstractListModel>
+#include <QTimer>
+
+#include "modularity/ioc.h"
+#include "async/asyncable.h"
+#include "audio/iplayback.h"
+#include "audio/audiotypes.h"
+
+namespace mu::diagnostics {
+class AudioPerformanceViewModel : public QAbstractListModel, public async::Asyncable
+{
+    Q_OBJECT
+
+    INJECT(diagnostics, audio::IPlayback, playback)
+
+public:
+    explicit AudioPerformanceViewModel(QObject* parent = 0);
+
+    QVariant data(const QModelIndex& index, int role) const override;
+    int rowCount(const QModelIndex& parent) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    Q_INVOKABLE void load();
+    Q_INVOKABLE void reset();
+
+private:
+    void requestStats();
+    void setStats(const audio::AudioPerformanceStats& stats);
+
+    enum Roles {
+        rData = Qt::UserRole + 1,
+        rGroup
+    };
+
+    struct Item {
+        QString group;
+        QString data;
+    };
+
+    QList<Item> m_list;
+    QTimer m_updateTimer;
+    bool m_isRequested = false;
+};
+}
+
+#endif // MU_DIAGNOSTICS_AUDIOPERFORMANCEVIEWMODEL_H
@@ -21,9 +21,15 @@
  */
 #include "profilerviewmodel.h"
 
+#include "engraving/libmscore/excerpt.h"
+#include "engraving/libmscore/masterscore.h"
+#include "engraving/libmscore/memoryreport.h"
+#include "engraving/libmscore/score.h"
+
 #include "log.h"
 
 using namespace mu::diagnostics;
+using namespace mu::engraving;
 using namespace haw::profiler;
 
 ProfilerViewModel::ProfilerViewModel(QObject* parent)
@@ -31,6 +37,33 @@ ProfilerViewModel::ProfilerViewModel(QObject* parent)
 {
 }
 
+ProfilerViewModel::~ProfilerViewModel()
+{
+    //! NOTE The statistics are only collected while the panel is open
+    setIsLayoutStatisticsEnabled(false);
+}
+
+bool ProfilerViewModel::isLayoutStatisticsEnabled() const
+{
+    return m_isLayoutStatisticsEnabled;
+}
+
+void ProfilerViewModel::setIsLayoutStatisticsEnabled(bool arg)
+{
+    if (m_isLayoutStatisticsEnabled == arg) {
+        return;
+    }
+
+    m_isLayoutStatisticsEnabled = arg;
+    if (arg) {
+        LayoutStatistics::requestCollecting();
+    } else {
+        LayoutStatistics::releaseCollecting();
+    }
+
+    emit isLayoutStatisticsEnabledChanged();
+}
+
 QVariant ProfilerViewModel::data(const QModelIndex& index, int role) const
 {
     if (!index.isValid()) {
@@ -88,9 +121,78 @@ void ProfilerViewModel::reload()
         m_allList.append(item);
     }
 
+    appendLayoutStatistics();
+    appendMemoryUsage();
+
     find(m_searchText);
 }
 
+std::vector<const Score*> ProfilerViewModel::masterScores() const
+{
+    std::vector<const Score*> scores;
+    for (const EngravingObject* el : elementsProvider()->elements()) {
+        if (el != gpaletteScore && el->isScore() && toScore(el)->isMaster()) {
+            scores.push_back(toScore(el));
+        }
+    }
+    return scores;
+}
+
+void ProfilerViewModel::appendLayoutStatistics()
+{
+    using Phase = LayoutStatistics::Phase;
+
+    for (const Score* score : masterScores()) {
+        QString group = QString("Layout: %1").arg(score->name().toQString());
+        const LayoutStatistics& statistics = score->layout().statistics();
+        for (size_t i = 0; i < size_t(Phase::PhaseCount); ++i) {
+            LayoutStatistics::Entry entry = statistics.phase(Phase(i));
+
+            Item item;
+            item.group = group;
+            item.data = QString("%1: %2 calls, %3 ms")
+                        .arg(LayoutStatistics::phaseName(Phase(i)))
+                        .arg(entry.calls)
+                        .arg(entry.nanoseconds / 1e6, 0, 'f', 3);
+
+            m_allList.append(item);
+        }
+    }
+}
+
+void ProfilerViewModel::appendMemoryUsage()
+{
+    auto append = [this](const Score* score) {
+        QString group = QString("Memory: %1").arg(score->name().toQString());
+        MemoryReport report = MemoryReport::collect(score);
+
+        auto item = [&group](const QString& name, const MemoryReport::Entry& entry) {
+            Item item;
+            item.group = group;
+            item.data = QString("%1: %2, %3 MB")
+                        .arg(name)
+                        .arg(entry.count)
+                        .arg(entry.bytes / (1024.0 * 1024.0), 0, 'f', 2);
+            return item;
+        };
+
+        for (const auto& p : report.subsystems()) {
+            m_allList.append(item(QString::fromStdString(p.first), p.second));
+        }
+
+        m_allList.append(item("total", report.subsystemsTotal()));
+    };
+
+    for (const Score* score : masterScores()) {
+        append(score);
+        for (const Excerpt* excerpt : score->masterScore()->excerpts()) {
+            if (excerpt->excerptScore()) {
+                append(excerpt->excerptScore());
+            }
+        }
+    }
+}
+
 void ProfilerViewModel::find(const QString& str)
 {
     beginResetModel();
@@ -114,6 +216,7 @@ void ProfilerViewModel::find(const QString& str)
 void ProfilerViewModel::clear()
 {
     PROFILER_CLEAR;
+    LayoutStatistics::clearAll();
     reload();
 }
 
@@ -24,12 +24,26 @@
 
 #include <QAbstractListModel>
 
+#include "modularity/ioc.h"
+#include "iengravingelementsprovider.h"
+
+namespace mu::engraving {
+class Score;
+}
+
 namespace mu::diagnostics {
 class ProfilerViewModel : public QAbstractListModel
 {
     Q_OBJECT
+
+    Q_PROPERTY(bool isLayoutStatisticsEnabled READ isLayoutStatisticsEnabled WRITE setIsLayoutStatisticsEnabled NOTIFY
+               isLayoutStatisticsEnabledChanged)
+
+    INJECT(diagnostics, IEngravingElementsProvider, elementsProvider)
+
 public:
     explicit ProfilerViewModel(QObject* parent = 0);
+    ~ProfilerViewModel() override;
 
     QVariant data(const QModelIndex& index, int role) const override;
     int rowCount(const QModelIndex& parent) const override;
@@ -40,8 +54,18 @@ public:
     Q_INVOKABLE void clear();
     Q_INVOKABLE void print();
 
+    bool isLayoutStatisticsEnabled() const;
+    void setIsLayoutStatisticsEnabled(bool arg);
+
+signals:
+    void isLayoutStatisticsEnabledChanged();
+
 private:
 
+    std::vector<const engraving::Score*> masterScores() const;
+    void appendLayoutStatistics();
+    void appendMemoryUsage();
+
     enum Roles {
         rData = Qt::UserRole + 1,
         rGroup
@@ -56,6 +80,7 @@ private:
     QList<Item> m_list;
     QList<Item> m_allList;
     QString m_searchText;
+    bool m_isLayoutStatisticsEnabled = false;
 };
 }
 
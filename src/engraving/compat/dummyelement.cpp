@@ -58,14 +58,14 @@ DummyElement::~DummyElement()
 void DummyElement::init()
 {
 #ifndef ENGRAVING_NO_ACCESSIBILITY
-    setupAccessible();
+    createAccessibleIfNeed();
 #endif
 
     m_root = new RootItem(score());
     m_root->setParent(explicitParent());
 
 #ifndef ENGRAVING_NO_ACCESSIBILITY
-    m_root->setupAccessible();
+    m_root->createAccessibleIfNeed();
 #endif
 
     m_page = Factory::createPage(m_root);
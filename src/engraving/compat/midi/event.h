@@ -181,6 +181,13 @@ public:
             _highestChannel = c;
         }
     }
+
+    //! NOTE Moves the events of other after the events of this map at the same ticks
+    void merge(EventMap& other)
+    {
+        std::multimap<int, NPlayEvent>::merge(other);
+        registerChannel(other._highestChannel);
+    }
 };
 
 typedef EventList::iterator iEvent;
@@ -47,6 +47,7 @@ mu::Ret mu::engraving::compat::mscxToMscz(const String& mscxFilePath, ByteArray*
     params.device = &buf;
     params.filePath = mscxFilePath;
     params.mode = MscIoMode::Zip;
+    params.compressed = false; // read back right away
     MscWriter writer(params);
     writer.open();
     writer.writeScoreFile(mscxData);
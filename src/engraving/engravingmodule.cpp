@@ -95,7 +95,7 @@ void EngravingModule::onInit(const framework::IApplication::RunMode&)
     // Init fonts
     {
         // Symbols
-        Smufl::init();
+        Smufl::init(s_configuration->fontsCachePath() + "/glyphnames.bin");
 
         s_engravingfonts->addFont("Leland",     "Leland",      ":/fonts/leland/Leland.otf");
         s_engravingfonts->addFont("Bravura",    "Bravura",     ":/fonts/bravura/Bravura.otf");
@@ -110,7 +110,6 @@ void EngravingModule::onInit(const framework::IApplication::RunMode&)
 
         // Text
         const std::vector<io::path_t> textFonts = {
-            ":/fonts/musejazz/MuseJazzText.otf",
             ":/fonts/campania/Campania.otf",
             ":/fonts/edwin/Edwin-Roman.otf",
             ":/fonts/edwin/Edwin-Bold.otf",
@@ -123,15 +122,21 @@ void EngravingModule::onInit(const framework::IApplication::RunMode&)
             ":/fonts/FreeSerifBoldItalic.ttf",
             ":/fonts/mscoreTab.ttf",
             ":/fonts/mscore-BC.ttf",
-            ":/fonts/leland/LelandText.otf",
             ":/fonts/leland/Leland.otf",
-            ":/fonts/bravura/BravuraText.otf",
-            ":/fonts/gootville/GootvilleText.otf",
-            ":/fonts/mscore/MScoreText.ttf",
-            ":/fonts/petaluma/PetalumaText.otf",
-            ":/fonts/petaluma/PetalumaScript.otf",
-            ":/fonts/finalemaestro/FinaleMaestroText.otf",
-            ":/fonts/finalebroadway/FinaleBroadwayText.otf",
+        };
+
+        //! NOTE The musical text fonts are used only by the scores that refer to them,
+        //! so they are loaded on the first use
+        const std::vector<std::pair<String, io::path_t> > lazyTextFonts = {
+            { u"MuseJazz Text",        ":/fonts/musejazz/MuseJazzText.otf" },
+            { u"Leland Text",          ":/fonts/leland/LelandText.otf" },
+            { u"Bravura Text",         ":/fonts/bravura/BravuraText.otf" },
+            { u"Gootville Text",       ":/fonts/gootville/GootvilleText.otf" },
+            { u"MScore Text",          ":/fonts/mscore/MScoreText.ttf" },
+            { u"Petaluma Text",        ":/fonts/petaluma/PetalumaText.otf" },
+            { u"Petaluma Script",      ":/fonts/petaluma/PetalumaScript.otf" },
+            { u"Finale Maestro Text",  ":/fonts/finalemaestro/FinaleMaestroText.otf" },
+            { u"Finale Broadway Text", ":/fonts/finalebroadway/FinaleBroadwayText.otf" },
         };
 
         std::shared_ptr<IFontProvider> fontProvider = ioc()->resolve<IFontProvider>("fonts");
@@ -142,6 +147,10 @@ void EngravingModule::onInit(const framework::IApplication::RunMode&)
             }
         }
 
+        for (const auto& font : lazyTextFonts) {
+            fontProvider->addLazyTextFont(font.first, font.second);
+        }
+
         fontProvider->insertSubstitution(u"Leland Text",    u"Bravura Text");
         fontProvider->insertSubstitution(u"Bravura Text",   u"Leland Text");
         fontProvider->insertSubstitution(u"MScore Text",    u"Leland Text");
@@ -69,6 +69,9 @@ EngravingProject::~EngravingProject()
     AllocatorsRegister::instance()->printStatistic("=== Destroy engraving project ===");
     //! NOTE At the moment, the allocator is working as leak detector. No need to do cleanup, at the moment it can lead to crashes
     // AllocatorsRegister::instance()->cleanupAll("engraving");
+
+    //! NOTE The blocks without alive objects are safe to give back, so closing a big score returns its memory
+    AllocatorsRegister::instance()->releaseFreeBlocks("engraving");
 }
 
 void EngravingProject::init(const MStyle& style)
@@ -41,6 +41,7 @@ public:
     virtual ~IEngravingConfiguration() = default;
 
     virtual io::path_t appDataPath() const = 0;
+    virtual io::path_t fontsCachePath() const = 0;
 
     virtual io::path_t defaultStyleFilePath() const = 0;
     virtual void setDefaultStyleFilePath(const io::path_t& path) = 0;
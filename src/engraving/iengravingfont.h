@@ -14,6 +14,13 @@ class Painter;
 }
 
 namespace mu::engraving {
+struct SymbolPosition {
+    SymId id = SymId::noSym;
+    PointF pos;
+};
+
+using SymbolPositions = std::vector<SymbolPosition>;
+
 class IEngravingFont
 {
 public:
@@ -49,6 +56,11 @@ public:
     virtual void draw(SymId id, draw::Painter* p, const SizeF& mag, const PointF& pos) const = 0;
     virtual void draw(const SymIdList& ids, draw::Painter* p, double mag, const PointF& pos) const = 0;
     virtual void draw(const SymIdList& ids, draw::Painter* p, const SizeF& mag, const PointF& pos) const = 0;
+
+    //! NOTE Draws the symbols in one go, with the font and the scaling set once,
+    //! so the painter can draw them in a batch
+    virtual void draw(const SymbolPositions& symbols, draw::Painter* p, double mag) const = 0;
+    virtual void draw(const SymbolPositions& symbols, draw::Painter* p, const SizeF& mag) const = 0;
 };
 
 using IEngravingFontPtr = std::shared_ptr<IEngravingFont>;
@@ -0,0 +1,135 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "binarycachefile.h"
+
+#include "io/dir.h"
+#include "io/file.h"
+#include "io/fileinfo.h"
+#include "io/mappedfile.h"
+
+#include "config.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::io;
+using namespace mu::engraving;
+
+static constexpr uint32_t CACHE_MAGIC = 0x4346534d; // "MSFC"
+static constexpr uint32_t CACHE_FORMAT_VERSION = 1;
+
+// FNV-1a, the same for every run, unlike std::hash
+static uint64_t hashData(uint64_t hash, const uint8_t* data, size_t size)
+{
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+static uint64_t hashString(uint64_t hash, const char* str)
+{
+    return hashData(hash, reinterpret_cast<const uint8_t*>(str), std::strlen(str));
+}
+
+void BinaryCacheFile::Writer::writeString(const String& str)
+{
+    ByteArray utf8 = str.toUtf8();
+    write(static_cast<uint32_t>(utf8.size()));
+    m_data.push_back(utf8.constData(), utf8.size());
+}
+
+bool BinaryCacheFile::Reader::readString(String& str)
+{
+    uint32_t size = 0;
+    if (!read(size) || m_pos + size > m_size) {
+        return false;
+    }
+
+    str = String::fromStdString(std::string(reinterpret_cast<const char*>(m_data + m_pos), size));
+    m_pos += size;
+    return true;
+}
+
+uint64_t BinaryCacheFile::key(const ByteArray& source)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    hash = hashString(hash, VERSION);
+    hash = hashString(hash, BUILD_NUMBER);
+    hash = hashString(hash, MUSESCORE_REVISION);
+    hash = hashData(hash, source.constData(), source.size());
+    return hash;
+}
+
+bool BinaryCacheFile::read(const path_t& filePath, uint64_t key, const ReadFunc& readData)
+{
+    if (!File::exists(filePath)) {
+        return false;
+    }
+
+    MappedFile file(filePath);
+    if (!file.open(IODevice::ReadOnly)) {
+        return false;
+    }
+
+    Reader reader(file.readData(), file.size());
+
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    uint64_t fileKey = 0;
+    if (!reader.read(magic) || !reader.read(version) || !reader.read(fileKey)) {
+        return false;
+    }
+
+    if (magic != CACHE_MAGIC || version != CACHE_FORMAT_VERSION || fileKey != key) {
+        return false;
+    }
+
+    if (!readData(reader) || !reader.atEnd()) {
+        LOGW() << "Broken cache file: " << filePath;
+        return false;
+    }
+
+    return true;
+}
+
+bool BinaryCacheFile::write(const path_t& filePath, uint64_t key, const Writer& writer)
+{
+    Writer header;
+    header.write(CACHE_MAGIC);
+    header.write(CACHE_FORMAT_VERSION);
+    header.write(key);
+
+    ByteArray data = header.data();
+    data.push_back(writer.data());
+
+    Dir::mkpath(FileInfo(filePath).path());
+
+    Ret ret = File::writeFile(filePath, data);
+    if (!ret) {
+        LOGW() << "Failed to write cache file: " << filePath << ", err: " << ret.toString();
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,98 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_BINARYCACHEFILE_H
+#define MU_ENGRAVING_BINARYCACHEFILE_H
+
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+#include "io/path.h"
+#include "types/bytearray.h"
+#include "types/string.h"
+
+namespace mu::engraving {
+//! NOTE A file keeping what was computed from a source (like the metadata of a font),
+//! so that it is read on the next start instead of being computed again.
+//! The file is only used if it was written from the same source by the same build, see key()
+class BinaryCacheFile
+{
+public:
+    class Writer
+    {
+    public:
+        template<typename T>
+        void write(const T& value)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "only plain values are written as they are");
+            m_data.push_back(reinterpret_cast<const uint8_t*>(&value), sizeof(T));
+        }
+
+        void writeString(const String& str);
+
+        const ByteArray& data() const { return m_data; }
+
+    private:
+        ByteArray m_data;
+    };
+
+    class Reader
+    {
+    public:
+        Reader(const uint8_t* data, size_t size)
+            : m_data(data), m_size(size) {}
+
+        template<typename T>
+        bool read(T& value)
+        {
+            static_assert(std::is_trivially_copyable<T>::value, "only plain values are read as they are");
+            if (m_pos + sizeof(T) > m_size) {
+                return false;
+            }
+
+            std::memcpy(&value, m_data + m_pos, sizeof(T));
+            m_pos += sizeof(T);
+            return true;
+        }
+
+        bool readString(String& str);
+
+        bool atEnd() const { return m_pos == m_size; }
+
+    private:
+        const uint8_t* m_data = nullptr;
+        size_t m_size = 0;
+        size_t m_pos = 0;
+    };
+
+    using ReadFunc = std::function<bool (Reader& reader)>;
+
+    //! NOTE Identifies the source and the build, the cache must be computed again if any changes
+    static uint64_t key(const ByteArray& source);
+
+    //! NOTE The file is mapped, readData must read all of it; returns false if the file can't be used
+    static bool read(const io::path_t& filePath, uint64_t key, const ReadFunc& readData);
+    static bool write(const io::path_t& filePath, uint64_t key, const Writer& writer);
+};
+}
+
+#endif // MU_ENGRAVING_BINARYCACHEFILE_H
@@ -24,6 +24,7 @@
 #include "io/file.h"
 #include "io/fileinfo.h"
 #include "io/dir.h"
+#include "io/mappedfile.h"
 #include "serialization/zipreader.h"
 #include "serialization/xmlstreamreader.h"
 
@@ -136,22 +137,48 @@ String MscReader::mainFileName() const
     return completeBaseName + u".mscx";
 }
 
+String MscReader::rootScoreFileName() const
+{
+    StringList files = reader()->fileList();
+    for (const String& name : files) {
+        // mscx file in the root dir
+        if (!name.contains(u'/') && name.endsWith(u".mscx", mu::CaseInsensitive)) {
+            return name;
+        }
+    }
+    return String();
+}
+
 ByteArray MscReader::readScoreFile() const
 {
     String mscxFileName = mainFileName();
     ByteArray data = fileData(mscxFileName);
-    if (data.empty() && reader()->isContainer()) {
-        StringList files = reader()->fileList();
-        for (const String& name : files) {
-            // mscx file in the root dir
-            if (!name.contains(u'/') && name.endsWith(u".mscx", mu::CaseInsensitive)) {
-                mscxFileName = name;
-                break;
-            }
-        }
+    if (!data.empty() || !reader()->isContainer()) {
+        return data;
+    }
+
+    String rootFileName = rootScoreFileName();
+    if (rootFileName.isEmpty() || rootFileName == mscxFileName) {
+        return data;
     }
 
-    return fileData(mscxFileName);
+    return fileData(rootFileName);
+}
+
+bool MscReader::readScoreFile(const DataHandler& onData) const
+{
+    String mscxFileName = mainFileName();
+    bool ok = reader()->fileData(mscxFileName, onData);
+    if (ok || !reader()->isContainer()) {
+        return ok;
+    }
+
+    String rootFileName = rootScoreFileName();
+    if (rootFileName.isEmpty() || rootFileName == mscxFileName) {
+        return false;
+    }
+
+    return reader()->fileData(rootFileName, onData);
 }
 
 std::vector<String> MscReader::excerptNames() const
@@ -234,6 +261,17 @@ ByteArray MscReader::readViewSettingsJsonFile(const io::path_t& pathPrefix) cons
 // Readers
 // =======================================================================
 
+bool MscReader::IReader::fileData(const String& fileName, const DataHandler& onData) const
+{
+    ByteArray data = fileData(fileName);
+    if (data.empty()) {
+        return false;
+    }
+
+    onData(data.constData(), data.size());
+    return true;
+}
+
 MscReader::ZipFileReader::~ZipFileReader()
 {
     delete m_zip;
@@ -246,7 +284,8 @@ bool MscReader::ZipFileReader::open(IODevice* device, const path_t& filePath)
 {
     m_device = device;
     if (!m_device) {
-        m_device = new File(filePath);
+        //! NOTE Mapped, so that only the entries which are read are loaded from the disk
+        m_device = new MappedFile(filePath);
         m_selfDeviceOwner = true;
     }
 
@@ -318,6 +357,20 @@ ByteArray MscReader::ZipFileReader::fileData(const String& fileName) const
     return data;
 }
 
+bool MscReader::ZipFileReader::fileData(const String& fileName, const DataHandler& onData) const
+{
+    IF_ASSERT_FAILED(m_zip) {
+        return false;
+    }
+
+    bool ok = m_zip->fileData(fileName.toStdString(), onData);
+    if (m_zip->hasError()) {
+        LOGD() << "failed read data";
+        return false;
+    }
+    return ok;
+}
+
 bool MscReader::DirReader::open(IODevice* device, const path_t& filePath)
 {
     if (device) {
@@ -372,13 +425,14 @@ StringList MscReader::DirReader::fileList() const
 ByteArray MscReader::DirReader::fileData(const String& fileName) const
 {
     io::path_t filePath = m_rootPath + "/" + fileName;
-    File file(filePath);
-    if (!file.open(IODevice::ReadOnly)) {
+    ByteArray data;
+    Ret ret = File::readFile(filePath, data);
+    if (!ret) {
         LOGD() << "failed open file: " << filePath;
         return ByteArray();
     }
 
-    return file.readAll();
+    return data;
 }
 
 bool MscReader::XmlFileReader::open(IODevice* device, const path_t& filePath)
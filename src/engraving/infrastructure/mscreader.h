@@ -22,6 +22,8 @@
 #ifndef MU_ENGRAVING_MSCREADER_H
 #define MU_ENGRAVING_MSCREADER_H
 
+#include <functional>
+
 #include "types/string.h"
 #include "io/path.h"
 #include "io/iodevice.h"
@@ -55,8 +57,13 @@ public:
     void close();
     bool isOpened() const;
 
+    //! NOTE Passes the data of a file chunk by chunk while it's read (inflated),
+    //! the handler returns false to stop reading
+    using DataHandler = std::function<bool (const uint8_t* data, size_t len)>;
+
     ByteArray readStyleFile() const;
     ByteArray readScoreFile() const;
+    bool readScoreFile(const DataHandler& onData) const;
 
     std::vector<String> excerptNames() const;
     ByteArray readExcerptStyleFile(const String& name) const;
@@ -86,6 +93,7 @@ private:
         virtual bool isContainer() const = 0;
         virtual StringList fileList() const = 0;
         virtual ByteArray fileData(const String& fileName) const = 0;
+        virtual bool fileData(const String& fileName, const DataHandler& onData) const;
     };
 
     struct ZipFileReader : public IReader
@@ -97,6 +105,7 @@ private:
         bool isContainer() const override;
         StringList fileList() const override;
         ByteArray fileData(const String& fileName) const override;
+        bool fileData(const String& fileName, const DataHandler& onData) const override;
     private:
         io::IODevice* m_device = nullptr;
         bool m_selfDeviceOwner = false;
@@ -132,6 +141,7 @@ private:
     ByteArray fileData(const String& fileName) const;
 
     String mainFileName() const;
+    String rootScoreFileName() const;
 
     Params m_params;
     mutable IReader* m_reader = nullptr;
@@ -29,6 +29,7 @@
 #include "io/fileinfo.h"
 #include "io/dir.h"
 #include "serialization/xmlstreamwriter.h"
+#include "serialization/zipreader.h"
 #include "serialization/zipwriter.h"
 #include "serialization/textstream.h"
 
@@ -94,7 +95,7 @@ MscWriter::IWriter* MscWriter::writer() const
     if (!m_writer) {
         switch (m_params.mode) {
         case MscIoMode::Zip:
-            m_writer = new ZipFileWriter();
+            m_writer = new ZipFileWriter(m_params);
             break;
         case MscIoMode::Dir:
             m_writer = new DirWriter();
@@ -245,9 +246,15 @@ void MscWriter::Meta::addFile(const String& file)
 // Writers
 // =======================================================================
 
+MscWriter::ZipFileWriter::ZipFileWriter(const Params& params)
+    : m_compressed(params.compressed), m_compressionLevel(params.compressionLevel), m_previousFilePath(params.previousFilePath)
+{
+}
+
 MscWriter::ZipFileWriter::~ZipFileWriter()
 {
     delete m_zip;
+    delete m_previous;
     if (m_selfDeviceOwner) {
         delete m_device;
     }
@@ -269,6 +276,16 @@ bool MscWriter::ZipFileWriter::open(io::IODevice* device, const path_t& filePath
     }
 
     m_zip = new ZipWriter(m_device);
+    m_zip->setCompressionEnabled(m_compressed);
+    m_zip->setCompressionLevel(m_compressionLevel);
+
+    if (!m_previousFilePath.empty() && File::exists(m_previousFilePath)) {
+        m_previous = new ZipReader(m_previousFilePath);
+        if (m_previous->hasError()) {
+            delete m_previous;
+            m_previous = nullptr;
+        }
+    }
 
     return true;
 }
@@ -279,6 +296,10 @@ void MscWriter::ZipFileWriter::close()
         m_zip->close();
     }
 
+    //! NOTE Released here, the previous file is usually replaced by the written one after closing
+    delete m_previous;
+    m_previous = nullptr;
+
     if (m_device) {
         m_device->close();
     }
@@ -295,7 +316,11 @@ bool MscWriter::ZipFileWriter::addFileData(const String& fileName, const ByteArr
         return false;
     }
 
-    m_zip->addFile(fileName.toStdString(), data);
+    std::string name = fileName.toStdString();
+    if (!m_previous || !m_zip->addUnchangedFile(*m_previous, name, data)) {
+        m_zip->addFile(name, data);
+    }
+
     if (m_zip->hasError()) {
         LOGE() << "failed write files to zip";
         return false;
@@ -28,6 +28,7 @@
 #include "mscio.h"
 
 namespace mu {
+class ZipReader;
 class ZipWriter;
 class TextStream;
 }
@@ -43,6 +44,9 @@ public:
         io::path_t filePath;
         String mainFileName;
         MscIoMode mode = MscIoMode::Zip;
+        bool compressed = true; // only for MscIoMode::Zip
+        int compressionLevel = -1; // only for MscIoMode::Zip, see ZipWriter::setCompressionLevel
+        io::path_t previousFilePath; // only for MscIoMode::Zip, its unchanged files are copied without recompressing
     };
 
     MscWriter() = default;
@@ -80,6 +84,7 @@ private:
 
     struct ZipFileWriter : public IWriter
     {
+        ZipFileWriter(const Params& params);
         ~ZipFileWriter() override;
         bool open(io::IODevice* device, const io::path_t& filePath) override;
         void close() override;
@@ -89,6 +94,10 @@ private:
     private:
         io::IODevice* m_device = nullptr;
         bool m_selfDeviceOwner = false;
+        bool m_compressed = true;
+        int m_compressionLevel = -1;
+        io::path_t m_previousFilePath;
+        ZipReader* m_previous = nullptr;
         ZipWriter* m_zip = nullptr;
     };
 
@@ -0,0 +1,212 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "pagedisplaylists.h"
+
+#include <algorithm>
+
+#include "draw/bufferedpaintprovider.h"
+#include "draw/utils/drawdatapaint.h"
+
+#include "libmscore/engravingitem.h"
+#include "libmscore/mscore.h"
+#include "libmscore/page.h"
+
+#include "paint.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static constexpr size_t MAX_DISPLAY_LISTS = 32;
+
+void PageDisplayLists::paintPage(draw::Painter& painter, Page* page, const RectF& drawRect, bool isPrinting)
+{
+    std::shared_ptr<DisplayList> list;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto it = m_lists.find(page);
+        if (it != m_lists.end() && isSame(*it->second, page, isPrinting)) {
+            list = it->second;
+            list->lastUse = ++m_useCounter;
+        } else {
+            //! NOTE Only noted the first time, the page is painted from its elements
+            std::shared_ptr<DisplayList> painted = std::make_shared<DisplayList>();
+            painted->page = page;
+            painted->canvasRect = page->canvasBoundingRect();
+            painted->isPrinting = isPrinting;
+            painted->pixelRatio = MScore::pixelRatio;
+            painted->lastUse = ++m_useCounter;
+            keep(painted);
+        }
+    }
+
+    if (!list) {
+        Paint::paintPageElements(painter, page, drawRect, isPrinting);
+        return;
+    }
+
+    if (!list->data) {
+        std::shared_ptr<DisplayList> recorded = record(page, isPrinting);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_lists.find(page);
+        if (it != m_lists.end() && it->second == list) {
+            recorded->lastUse = list->lastUse;
+            keep(recorded);
+        }
+        list = recorded;
+    }
+
+    replay(painter, *list, drawRect);
+}
+
+bool PageDisplayLists::isSame(const DisplayList& list, const Page* page, bool isPrinting) const
+{
+    return list.page == page
+           && list.canvasRect == page->canvasBoundingRect()
+           && list.isPrinting == isPrinting
+           && RealIsEqual(list.pixelRatio, MScore::pixelRatio);
+}
+
+void PageDisplayLists::keep(const std::shared_ptr<DisplayList>& list)
+{
+    m_lists[list->page] = list;
+    if (m_lists.size() <= MAX_DISPLAY_LISTS) {
+        return;
+    }
+
+    auto oldest = std::min_element(m_lists.begin(), m_lists.end(), [](const auto& l1, const auto& l2) {
+        return l1.second->lastUse < l2.second->lastUse;
+    });
+    m_lists.erase(oldest);
+}
+
+std::shared_ptr<PageDisplayLists::DisplayList> PageDisplayLists::record(const Page* page, bool isPrinting)
+{
+    TRACEFUNC;
+
+    std::shared_ptr<DisplayList> list = std::make_shared<DisplayList>();
+    list->page = page;
+    list->canvasRect = page->canvasBoundingRect();
+    list->isPrinting = isPrinting;
+    list->pixelRatio = MScore::pixelRatio;
+
+    std::vector<EngravingItem*> elements = page->elements();
+    std::sort(elements.begin(), elements.end(), mu::engraving::elementLessThan);
+
+    std::shared_ptr<draw::BufferedPaintProvider> provider = std::make_shared<draw::BufferedPaintProvider>();
+    {
+        draw::Painter recorder(provider, "pagedisplaylist");
+        recorder.setAntialiasing(true);
+
+        //! NOTE Each element is an object of the display list, to skip the ones out of the painted area
+        for (const EngravingItem* element : elements) {
+            if (!element->isInteractionAvailable()) {
+                continue;
+            }
+
+            recorder.beginObject(element->typeName(), element->pagePos());
+            Paint::paintElement(recorder, element);
+            recorder.endObject();
+
+            list->objectRects.push_back(element->pageBoundingRect());
+        }
+
+        recorder.endDraw();
+    }
+
+    list->data = provider->drawData();
+
+    return list;
+}
+
+void PageDisplayLists::replay(draw::Painter& painter, const DisplayList& list, const RectF& drawRect)
+{
+    TRACEFUNC;
+
+    draw::DrawDataPaint::replay(&painter, list.data, [&list, &drawRect](size_t index) {
+        //! NOTE The last object keeps what was painted out of the elements
+        return index >= list.objectRects.size() || list.objectRects.at(index).intersects(drawRect);
+    });
+}
+
+void PageDisplayLists::invalidate(const RectF& canvasRect)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (auto it = m_lists.begin(); it != m_lists.end();) {
+        if (it->second->canvasRect.intersects(canvasRect)) {
+            it = m_lists.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void PageDisplayLists::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_lists.clear();
+}
+
+static size_t drawDataSize(const draw::DrawData& data)
+{
+    size_t bytes = sizeof(draw::DrawData) + data.objects.capacity() * sizeof(draw::DrawData::Object);
+    for (const draw::DrawData::Object& obj : data.objects) {
+        bytes += obj.name.capacity() + obj.datas.capacity() * sizeof(draw::DrawData::Data);
+        for (const draw::DrawData::Data& d : obj.datas) {
+            bytes += d.paths.capacity() * sizeof(draw::DrawPath)
+                     + d.polygons.capacity() * sizeof(draw::DrawPolygon)
+                     + d.texts.capacity() * sizeof(draw::DrawText)
+                     + d.pixmaps.capacity() * sizeof(draw::DrawPixmap);
+
+            for (const draw::DrawPath& path : d.paths) {
+                bytes += path.path.elementCount() * sizeof(draw::PainterPath::Element);
+            }
+            for (const draw::DrawPolygon& polygon : d.polygons) {
+                bytes += polygon.polygon.capacity() * sizeof(PointF);
+            }
+            for (const draw::DrawText& text : d.texts) {
+                bytes += text.text.size() * sizeof(char16_t);
+            }
+        }
+    }
+    return bytes;
+}
+
+MemoryReport::Entry PageDisplayLists::memoryUsage() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    MemoryReport::Entry entry;
+    for (const auto& p : m_lists) {
+        const DisplayList& list = *p.second;
+        entry.count++;
+        entry.bytes += sizeof(DisplayList) + list.objectRects.capacity() * sizeof(RectF);
+        if (list.data) {
+            entry.bytes += drawDataSize(*list.data);
+        }
+    }
+    return entry;
+}
@@ -0,0 +1,83 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_PAGEDISPLAYLISTS_H
+#define MU_ENGRAVING_PAGEDISPLAYLISTS_H
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "draw/painter.h"
+#include "draw/types/drawdata.h"
+
+#include "libmscore/memoryreport.h"
+
+namespace mu::engraving {
+class Page;
+
+//! NOTE Keeps what was painted for the pages, so that a page which has not changed
+//! is painted again from its display list instead of from its elements.
+//! A page is recorded the second time it is painted the same way, the pages painted once,
+//! like in most exports, cost nothing more than before.
+//! The owner must invalidate the area of the score which is painted differently
+class PageDisplayLists
+{
+public:
+    PageDisplayLists() = default;
+
+    //! NOTE Paints the elements of the page in drawRect (in page coordinates),
+    //! may be called for different pages at the same time
+    void paintPage(draw::Painter& painter, Page* page, const RectF& drawRect, bool isPrinting);
+
+    void invalidate(const RectF& canvasRect);
+    void clear();
+
+    //! NOTE The number of the recorded lists and their approximate size
+    MemoryReport::Entry memoryUsage() const;
+
+private:
+    struct DisplayList {
+        const Page* page = nullptr;
+        RectF canvasRect;
+        bool isPrinting = false;
+        double pixelRatio = 0.0;
+
+        uint64_t lastUse = 0;
+
+        draw::DrawDataPtr data;   // null while the page was painted only once
+        std::vector<RectF> objectRects;   // page bounding rects of the recorded elements, in the order of the objects
+    };
+
+    static std::shared_ptr<DisplayList> record(const Page* page, bool isPrinting);
+    static void replay(draw::Painter& painter, const DisplayList& list, const RectF& drawRect);
+
+    bool isSame(const DisplayList& list, const Page* page, bool isPrinting) const;
+    void keep(const std::shared_ptr<DisplayList>& list);
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<const Page*, std::shared_ptr<DisplayList> > m_lists;
+    uint64_t m_useCounter = 0;
+};
+}
+
+#endif // MU_ENGRAVING_PAGEDISPLAYLISTS_H
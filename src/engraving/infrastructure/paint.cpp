@@ -21,18 +21,24 @@
  */
 #include "paint.h"
 
+#include <cmath>
+
 #include "draw/painter.h"
 #include "libmscore/score.h"
 #include "libmscore/page.h"
 #include "libmscore/engravingitem.h"
 
 #include "debugpaint.h"
+#include "pagedisplaylists.h"
 
 #include "log.h"
 #include "config.h"
 
 using namespace mu::engraving;
 
+//! NOTE The texts are painted as boxes of their color with this alpha when simplified
+static constexpr int SIMPLIFIED_TEXT_ALPHA = 80;
+
 void Paint::paintScore(draw::Painter* painter, Score* score, const Options& opt)
 {
     TRACEFUNC;
@@ -65,9 +71,32 @@ void Paint::paintScore(draw::Painter* painter, Score* score, const Options& opt)
     }
 
     // Setup score draw system
-    mu::engraving::MScore::pixelRatio = mu::engraving::DPI / DEVICE_DPI;
-    score->setPrinting(opt.isPrinting);
-    mu::engraving::MScore::pdfPrinting = opt.isPrinting;
+    //! NOTE Set only on change, the pages of an export may be painted concurrently with the same setup
+    const double pixelRatio = mu::engraving::DPI / DEVICE_DPI;
+    if (mu::engraving::MScore::pixelRatio != pixelRatio) {
+        mu::engraving::MScore::pixelRatio = pixelRatio;
+    }
+    if (score->printing() != opt.isPrinting) {
+        score->setPrinting(opt.isPrinting);
+    }
+    if (mu::engraving::MScore::pdfPrinting != opt.isPrinting) {
+        mu::engraving::MScore::pdfPrinting = opt.isPrinting;
+    }
+
+    //! NOTE Level of detail: when zoomed out, the small elements are not painted and the texts are boxes
+    const double pixelsPerSpatium = score->spatium() * std::abs(painter->worldTransform().m11());
+    const bool isSimplified = pixelsPerSpatium < opt.simplifyBelowPixelsPerSpatium;
+
+    //! NOTE The paint debugger follows the elements being painted, it needs them painted one by one.
+    //! The simplified painting is cheap, it isn't recorded
+#ifdef ENGRAVING_PAINT_DEBUGGER_ENABLED
+    const bool canUseDisplayLists = !draw::Painter::extended && opt.isPrinting && !isSimplified;
+#else
+    const bool canUseDisplayLists = !draw::Painter::extended && !isSimplified;
+#endif
+
+    //! NOTE The positions don't change while painting
+    EngravingItem::PagePosCacheScope pagePosCache;
 
     // Setup page counts
     int fromPage = opt.fromPage >= 0 ? opt.fromPage : 0;
@@ -127,8 +156,12 @@ void Paint::paintScore(draw::Painter* painter, Score* score, const Options& opt)
             // Draw page elements
             painter->setClipping(true);
             painter->setClipRect(pageRect);
-            std::vector<EngravingItem*> elements = page->items(drawRect.translated(-pagePos));
-            paintElements(*painter, elements, opt.isPrinting);
+            RectF pageDrawRect = drawRect.translated(-pagePos);
+            if (opt.displayLists && canUseDisplayLists) {
+                opt.displayLists->paintPage(*painter, page, pageDrawRect, opt.isPrinting);
+            } else {
+                paintPageElements(*painter, page, pageDrawRect, opt.isPrinting, isSimplified);
+            }
             painter->setClipping(false);
 
 #ifdef ENGRAVING_PAINT_DEBUGGER_ENABLED
@@ -181,9 +214,63 @@ void Paint::paintElement(mu::draw::Painter& painter, const EngravingItem* elemen
     painter.translate(-elementPosition);
 }
 
-void Paint::paintElements(mu::draw::Painter& painter, const std::vector<EngravingItem*>& elements, bool isPrinting)
+void Paint::paintPageElements(mu::draw::Painter& painter, Page* page, const RectF& drawRect, bool isPrinting, bool isSimplified)
+{
+    if (drawRect.contains(page->bbox())) {
+        paintElements(painter, page->elements(), isPrinting, isSimplified);
+        return;
+    }
+
+    // reused from frame to frame
+    static thread_local std::vector<EngravingItem*> elements;
+    elements.clear();
+    page->visitItems(drawRect, [&drawRect](EngravingItem* e) {
+        if (e->pageBoundingRect().intersects(drawRect)) {
+            elements.push_back(e);
+        }
+        return true;
+    });
+    paintElements(painter, elements, isPrinting, isSimplified);
+}
+
+void Paint::paintElementSimplified(mu::draw::Painter& painter, const EngravingItem* element)
+{
+    if (element->skipDraw()) {
+        return;
+    }
+
+    switch (element->type()) {
+    case ElementType::ARTICULATION:
+    case ElementType::FINGERING:
+    case ElementType::STICKING:
+    case ElementType::BREATH:
+    case ElementType::STEM_SLASH:
+    case ElementType::LEDGER_LINE:
+        return;
+    default:
+        break;
+    }
+
+    if (element->isTextBase()) {
+        RectF rect = element->pageBoundingRect();
+        if (rect.isEmpty()) {
+            return;
+        }
+
+        draw::Color color = element->curColor();
+        color.setAlpha(SIMPLIFIED_TEXT_ALPHA);
+        painter.fillRect(rect, color);
+        return;
+    }
+
+    paintElement(painter, element);
+}
+
+void Paint::paintElements(mu::draw::Painter& painter, const std::vector<EngravingItem*>& elements, bool isPrinting, bool isSimplified)
 {
-    std::vector<EngravingItem*> sortedElements(elements.begin(), elements.end());
+    // reused from frame to frame
+    static thread_local std::vector<EngravingItem*> sortedElements;
+    sortedElements.assign(elements.begin(), elements.end());
 
     std::sort(sortedElements.begin(), sortedElements.end(), mu::engraving::elementLessThan);
 
@@ -192,7 +279,11 @@ void Paint::paintElements(mu::draw::Painter& painter, const std::vector<Engravin
             continue;
         }
 
-        paintElement(painter, element);
+        if (isSimplified) {
+            paintElementSimplified(painter, element);
+        } else {
+            paintElement(painter, element);
+        }
     }
 
 #ifdef ENGRAVING_PAINT_DEBUGGER_ENABLED
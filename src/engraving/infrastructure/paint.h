@@ -27,6 +27,8 @@
 
 namespace mu::engraving {
 class EngravingItem;
+class Page;
+class PageDisplayLists;
 class Score;
 
 class Paint
@@ -45,6 +47,8 @@ public:
         int copyCount = 1;
         int trimMarginPixelSize = -1;
         int deviceDpi = -1;
+        PageDisplayLists* displayLists = nullptr; // to paint the unchanged pages again from what was recorded
+        double simplifyBelowPixelsPerSpatium = 0.0; // level of detail, 0 to paint everything
 
         std::function<void(draw::Painter* painter, const RectF& pageRect, const RectF& pageContentRect, bool isOdd)> onPaintPageSheet;
         std::function<void()> onNewPage;
@@ -52,11 +56,14 @@ public:
 
     static void paintScore(draw::Painter* painter, Score* score, const Options& opt);
     static void paintElement(draw::Painter& painter, const EngravingItem* element);
-    static void paintElements(draw::Painter& painter, const std::vector<EngravingItem*>& elements, bool isPrinting);
+    static void paintElements(draw::Painter& painter, const std::vector<EngravingItem*>& elements, bool isPrinting,
+                              bool isSimplified = false);
+    static void paintPageElements(draw::Painter& painter, Page* page, const RectF& drawRect, bool isPrinting, bool isSimplified = false);
 
     static SizeF pageSizeInch(Score* score);
 
 private:
+    static void paintElementSimplified(draw::Painter& painter, const EngravingItem* element);
 };
 }
 
@@ -28,6 +28,8 @@
 
 #include "libmscore/mscore.h"
 
+#include "binarycachefile.h"
+
 #include "log.h"
 
 using namespace mu;
@@ -46,14 +48,14 @@ char32_t Smufl::smuflCode(SymId id)
     return s_symIdCodes.at(static_cast<size_t>(id)).smuflCode;
 }
 
-bool Smufl::init()
+bool Smufl::init(const io::path_t& cachePath)
 {
-    bool ok = initGlyphNamesJson();
+    bool ok = initGlyphNamesJson(cachePath);
 
     return ok;
 }
 
-bool Smufl::initGlyphNamesJson()
+bool Smufl::initGlyphNamesJson(const io::path_t& cachePath)
 {
     File file(":/fonts/smufl/glyphnames.json");
     if (!file.open(IODevice::ReadOnly)) {
@@ -61,10 +63,17 @@ bool Smufl::initGlyphNamesJson()
         return false;
     }
 
-    std::string error;
-    JsonObject glyphNamesJson = JsonDocument::fromJson(file.readAll(), &error).rootObject();
+    ByteArray glyphNames = file.readAll();
     file.close();
 
+    const uint64_t cacheKey = BinaryCacheFile::key(glyphNames);
+    if (!cachePath.empty() && readGlyphNamesCache(cachePath, cacheKey)) {
+        return true;
+    }
+
+    std::string error;
+    JsonObject glyphNamesJson = JsonDocument::fromJson(glyphNames, &error).rootObject();
+
     if (!error.empty()) {
         LOGE() << "JSON parse error in glyph names file: " << error;
         return false;
@@ -102,9 +111,57 @@ bool Smufl::initGlyphNamesJson()
             LOGD() << "could not read alternate codepoint for glyph " << name;
         }
     }
+
+    if (!cachePath.empty()) {
+        writeGlyphNamesCache(cachePath, cacheKey);
+    }
+
     return true;
 }
 
+bool Smufl::readGlyphNamesCache(const io::path_t& cachePath, uint64_t cacheKey)
+{
+    std::array<Code, size_t(SymId::lastSym) + 1> codes;
+
+    bool ok = BinaryCacheFile::read(cachePath, cacheKey, [&codes](BinaryCacheFile::Reader& reader) {
+        uint32_t count = 0;
+        if (!reader.read(count) || count != codes.size()) {
+            return false;
+        }
+
+        for (Code& code : codes) {
+            uint32_t smuflCode = 0;
+            uint32_t musicSymBlockCode = 0;
+            if (!reader.read(smuflCode) || !reader.read(musicSymBlockCode)) {
+                return false;
+            }
+
+            code.smuflCode = smuflCode;
+            code.musicSymBlockCode = musicSymBlockCode;
+        }
+
+        return true;
+    });
+
+    if (ok) {
+        s_symIdCodes = codes;
+    }
+
+    return ok;
+}
+
+void Smufl::writeGlyphNamesCache(const io::path_t& cachePath, uint64_t cacheKey)
+{
+    BinaryCacheFile::Writer writer;
+    writer.write(static_cast<uint32_t>(s_symIdCodes.size()));
+    for (const Code& code : s_symIdCodes) {
+        writer.write(static_cast<uint32_t>(code.smuflCode));
+        writer.write(static_cast<uint32_t>(code.musicSymBlockCode));
+    }
+
+    BinaryCacheFile::write(cachePath, cacheKey, writer);
+}
+
 //---------------------------------------------------------
 //   smuflRanges
 //    read smufl ranges.json file
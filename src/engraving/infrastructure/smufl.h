@@ -25,6 +25,7 @@
 #include <array>
 #include <map>
 
+#include "io/path.h"
 #include "types/string.h"
 #include "types/symid.h"
 
@@ -33,7 +34,8 @@ class Smufl
 {
 public:
 
-    static bool init();
+    //! NOTE The codes read from the glyph names are kept in the cache file, if given
+    static bool init(const io::path_t& cachePath = io::path_t());
 
     struct Code {
         char32_t smuflCode = 0;
@@ -50,7 +52,9 @@ public:
 
 private:
 
-    static bool initGlyphNamesJson();
+    static bool initGlyphNamesJson(const io::path_t& cachePath);
+    static bool readGlyphNamesCache(const io::path_t& cachePath, uint64_t cacheKey);
+    static void writeGlyphNamesCache(const io::path_t& cachePath, uint64_t cacheKey);
 
     static std::array<Code, size_t(SymId::lastSym) + 1> s_symIdCodes;
 };
@@ -0,0 +1,188 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "textmetricscache.h"
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "draw/fontmetrics.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static constexpr size_t MAX_CACHED_FONTS = 256;
+static constexpr size_t MAX_CACHED_TEXTS = 4096;
+
+// Font::operator==() ignores the type and compares sizes fuzzily, both may change the metrics
+static bool isSameFont(const draw::Font& f1, const draw::Font& f2)
+{
+    return f1.family() == f2.family()
+           && f1.type() == f2.type()
+           && f1.pointSizeF() == f2.pointSizeF()
+           && f1.pixelSize() == f2.pixelSize()
+           && f1.weight() == f2.weight()
+           && f1.bold() == f2.bold()
+           && f1.italic() == f2.italic()
+           && f1.underline() == f2.underline()
+           && f1.strike() == f2.strike()
+           && f1.noFontMerging() == f2.noFontMerging()
+           && f1.hinting() == f2.hinting();
+}
+
+template<typename T>
+struct FontEntry {
+    draw::Font font;
+    T value;
+};
+
+template<typename T>
+using FontEntries = std::vector<FontEntry<T> >;
+
+struct Cache {
+    std::mutex mutex;
+    FontEntries<TextMetricsCache::FontInfo> fonts;
+    std::map<String, FontEntries<TextMetricsCache::RunInfo> > runs;
+    std::map<String, FontEntries<bool> > inFont;
+};
+
+static Cache& cache()
+{
+    static Cache c;
+    return c;
+}
+
+template<typename T>
+static const T* findFont(const FontEntries<T>& entries, const draw::Font& font)
+{
+    for (const FontEntry<T>& entry : entries) {
+        if (isSameFont(entry.font, font)) {
+            return &entry.value;
+        }
+    }
+
+    return nullptr;
+}
+
+template<typename T>
+static void keepText(std::map<String, FontEntries<T> >& texts, const String& text, const draw::Font& font, const T& value)
+{
+    if (texts.size() > MAX_CACHED_TEXTS) {
+        texts.clear();
+    }
+
+    texts[text].push_back(FontEntry<T> { font, value });
+}
+
+TextMetricsCache::FontInfo TextMetricsCache::fontInfo(const draw::Font& font)
+{
+    Cache& c = cache();
+    {
+        std::lock_guard<std::mutex> lock(c.mutex);
+        if (const FontInfo* info = findFont(c.fonts, font)) {
+            return *info;
+        }
+    }
+
+    draw::FontMetrics fm(font);
+
+    FontInfo info;
+    info.ascent = fm.ascent();
+    info.descent = fm.descent();
+    info.xHeight = fm.xHeight();
+    info.lineSpacing = fm.lineSpacing();
+
+    std::lock_guard<std::mutex> lock(c.mutex);
+    if (c.fonts.size() > MAX_CACHED_FONTS) {
+        c.fonts.clear();
+    }
+    c.fonts.push_back(FontEntry<FontInfo> { font, info });
+
+    return info;
+}
+
+TextMetricsCache::RunInfo TextMetricsCache::runInfo(const draw::Font& font, const String& text)
+{
+    Cache& c = cache();
+    {
+        std::lock_guard<std::mutex> lock(c.mutex);
+        auto it = c.runs.find(text);
+        if (it != c.runs.end()) {
+            if (const RunInfo* info = findFont(it->second, font)) {
+                return *info;
+            }
+        }
+    }
+
+    draw::FontMetrics fm(font);
+
+    RunInfo info;
+    info.width = fm.width(text);
+    info.tightBoundingRect = fm.tightBoundingRect(text);
+
+    std::lock_guard<std::mutex> lock(c.mutex);
+    keepText(c.runs, text, font, info);
+
+    return info;
+}
+
+bool TextMetricsCache::isInFont(const draw::Font& font, const String& text)
+{
+    Cache& c = cache();
+    {
+        std::lock_guard<std::mutex> lock(c.mutex);
+        auto it = c.inFont.find(text);
+        if (it != c.inFont.end()) {
+            if (const bool* result = findFont(it->second, font)) {
+                return *result;
+            }
+        }
+    }
+
+    draw::FontMetrics fm(font);
+
+    bool result = true;
+    for (size_t i = 0; i < text.size() && result; ++i) {
+        const Char& ch = text.at(i);
+        if (ch.isHighSurrogate() && i + 1 < text.size()) {
+            char32_t v = Char::surrogateToUcs4(ch, text.at(i + 1));
+            ++i;
+            result = fm.inFontUcs4(v);
+        } else {
+            result = fm.inFont(ch);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(c.mutex);
+    keepText(c.inFont, text, font, result);
+
+    return result;
+}
+
+void TextMetricsCache::clear()
+{
+    Cache& c = cache();
+    std::lock_guard<std::mutex> lock(c.mutex);
+    c.fonts.clear();
+    c.runs.clear();
+    c.inFont.clear();
+}
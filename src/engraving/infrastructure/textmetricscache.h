@@ -0,0 +1,58 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_TEXTMETRICSCACHE_H
+#define MU_ENGRAVING_TEXTMETRICSCACHE_H
+
+#include "types/string.h"
+#include "draw/types/font.h"
+#include "draw/types/geometry.h"
+
+namespace mu::engraving {
+//! NOTE The same texts are laid out again and again in the same fonts (dynamics, fingerings,
+//! measure numbers, tempo texts, chord symbols...), so their metrics are measured once and
+//! shared by all the scores. The methods may be called from several threads
+class TextMetricsCache
+{
+public:
+    struct FontInfo {
+        double ascent = 0.0;
+        double descent = 0.0;
+        double xHeight = 0.0;
+        double lineSpacing = 0.0;
+    };
+
+    struct RunInfo {
+        double width = 0.0;
+        RectF tightBoundingRect;
+    };
+
+    static FontInfo fontInfo(const draw::Font& font);
+    static RunInfo runInfo(const draw::Font& font, const String& text);
+
+    //! NOTE Whether the font has all the characters of the text
+    static bool isInFont(const draw::Font& font, const String& text);
+
+    static void clear();
+};
+}
+
+#endif // MU_ENGRAVING_TEXTMETRICSCACHE_H
@@ -60,9 +60,11 @@ void EngravingConfiguration::init()
     };
 
     settings()->setDefaultValue(INVERT_SCORE_COLOR, Val(false));
-    settings()->valueChanged(INVERT_SCORE_COLOR).onReceive(nullptr, [this](const Val&) {
+    settings()->valueChanged(INVERT_SCORE_COLOR).onReceive(nullptr, [this](const Val& val) {
+        m_scoreInversionEnabled = val.toBool();
         m_scoreInversionChanged.notify();
     });
+    m_scoreInversionEnabled = settings()->value(INVERT_SCORE_COLOR).toBool();
 
     for (voice_idx_t voice = 0; voice < VOICES; ++voice) {
         Settings::Key key("engraving", "engraving/colors/voice" + std::to_string(voice + 1));
@@ -85,6 +87,11 @@ mu::io::path_t EngravingConfiguration::appDataPath() const
     return globalConfiguration()->appDataPath();
 }
 
+mu::io::path_t EngravingConfiguration::fontsCachePath() const
+{
+    return globalConfiguration()->userAppDataPath() + "/fontcache";
+}
+
 mu::io::path_t EngravingConfiguration::defaultStyleFilePath() const
 {
     return settings()->value(DEFAULT_STYLE_FILE_PATH).toPath();
@@ -161,22 +168,26 @@ Color EngravingConfiguration::scoreInversionColor() const
 
 Color EngravingConfiguration::invisibleColor() const
 {
-    return "#808080";
+    static const Color color("#808080");
+    return color;
 }
 
 Color EngravingConfiguration::lassoColor() const
 {
-    return "#00323200";
+    static const Color color("#00323200");
+    return color;
 }
 
 Color EngravingConfiguration::warningColor() const
 {
-    return "#808000";
+    static const Color color("#808000");
+    return color;
 }
 
 Color EngravingConfiguration::warningSelectedColor() const
 {
-    return "#565600";
+    static const Color color("#565600");
+    return color;
 }
 
 Color EngravingConfiguration::criticalColor() const
@@ -186,12 +197,14 @@ Color EngravingConfiguration::criticalColor() const
 
 Color EngravingConfiguration::criticalSelectedColor() const
 {
-    return "#8B0000";
+    static const Color color("#8B0000");
+    return color;
 }
 
 Color EngravingConfiguration::formattingMarksColor() const
 {
-    return "#A0A0A4";
+    static const Color color("#A0A0A4");
+    return color;
 }
 
 Color EngravingConfiguration::thumbnailBackgroundColor() const
@@ -243,11 +256,13 @@ Color EngravingConfiguration::highlightSelectionColor(voice_idx_t voice) const
 
 bool EngravingConfiguration::scoreInversionEnabled() const
 {
-    return settings()->value(INVERT_SCORE_COLOR).toBool();
+    //! NOTE Asked by every painted item, so it is kept here instead of being read from the settings
+    return m_scoreInversionEnabled;
 }
 
 void EngravingConfiguration::setScoreInversionEnabled(bool value)
 {
+    m_scoreInversionEnabled = value;
     settings()->setSharedValue(INVERT_SCORE_COLOR, Val(value));
 }
 
@@ -46,6 +46,7 @@ public:
     void init();
 
     io::path_t appDataPath() const override;
+    io::path_t fontsCachePath() const override;
 
     io::path_t defaultStyleFilePath() const override;
     void setDefaultStyleFilePath(const io::path_t& path) override;
@@ -104,6 +105,7 @@ private:
     ValNt<DebuggingOptions> m_debuggingOptions;
 
     bool m_multiVoice = false;
+    bool m_scoreInversionEnabled = false;
 };
 }
 
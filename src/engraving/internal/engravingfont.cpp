@@ -29,6 +29,7 @@
 
 #include "libmscore/mscore.h"
 
+#include "binarycachefile.h"
 #include "smufl.h"
 
 #include "log.h"
@@ -93,6 +94,12 @@ void EngravingFont::ensureLoad()
         return;
     }
 
+    //! NOTE The fonts may be loaded while the pages of an export are painted concurrently
+    std::lock_guard<std::mutex> lock(m_loadMutex);
+    if (m_loaded) {
+        return;
+    }
+
     if (-1 == fontProvider()->addSymbolFont(String::fromStdString(m_family), m_fontPath)) {
         LOGE() << "fatal error: cannot load internal font: " << m_fontPath;
         return;
@@ -104,23 +111,53 @@ void EngravingFont::ensureLoad()
     m_font.setNoFontMerging(true);
     m_font.setHinting(mu::draw::Font::Hinting::PreferVerticalHinting);
 
+    File metadataFile(io::FileInfo(m_fontPath).path() + u"/metadata.json");
+    if (!metadataFile.open(IODevice::ReadOnly)) {
+        LOGE() << "Failed to open glyph metadata file: " << metadataFile.filePath();
+        return;
+    }
+
+    ByteArray metadata = metadataFile.readAll();
+
+    //! NOTE Asking the font for the metrics of thousands of glyphs and parsing the metadata take long,
+    //! so what is loaded is kept in a cache file, read on the next start
+    ByteArray cacheSource = metadata;
+    cacheSource.push_back(m_fontPath.toString().toUtf8());
+    const uint64_t cacheKey = BinaryCacheFile::key(cacheSource);
+    const io::path_t cachePath = configuration()->fontsCachePath() + "/" + m_name + ".bin";
+
+    if (readMetricsCache(cachePath, cacheKey)) {
+        m_loaded = true;
+        return;
+    }
+
+    //! NOTE The metrics of all the symbols are asked at once
+    std::vector<size_t> ids;
+    std::vector<char32_t> codes;
     for (size_t id = 0; id < m_symbols.size(); ++id) {
         Smufl::Code code = Smufl::code(static_cast<SymId>(id));
         if (!code.isValid()) {
             continue;
         }
         Sym& sym = m_symbols[id];
-        computeMetrics(sym, code);
+        sym.code = codeInFont(code);
+        if (sym.code > 0) {
+            ids.push_back(id);
+            codes.push_back(sym.code);
+        }
     }
 
-    File metadataFile(io::FileInfo(m_fontPath).path() + u"/metadata.json");
-    if (!metadataFile.open(IODevice::ReadOnly)) {
-        LOGE() << "Failed to open glyph metadata file: " << metadataFile.filePath();
-        return;
+    std::vector<RectF> bboxes;
+    std::vector<double> advances;
+    fontProvider()->symMetrics(m_font, codes, DPI_F, bboxes, advances);
+    for (size_t i = 0; i < ids.size(); ++i) {
+        Sym& sym = m_symbols[ids[i]];
+        sym.bbox = bboxes[i];
+        sym.advance = advances[i];
     }
 
     std::string error;
-    JsonObject metadataJson = JsonDocument::fromJson(metadataFile.readAll(), &error).rootObject();
+    JsonObject metadataJson = JsonDocument::fromJson(metadata, &error).rootObject();
     if (!error.empty()) {
         LOGE() << "Json parse error in " << metadataFile.filePath() << ", error: " << error;
         return;
@@ -131,9 +168,164 @@ void EngravingFont::ensureLoad()
     loadStylisticAlternates(metadataJson.value("glyphsWithAlternates").toObject());
     loadEngravingDefaults(metadataJson.value("engravingDefaults").toObject());
 
+    writeMetricsCache(cachePath, cacheKey);
+
     m_loaded = true;
 }
 
+bool EngravingFont::readMetricsCache(const io::path_t& cachePath, uint64_t cacheKey)
+{
+    std::vector<Sym> symbols(m_symbols.size());
+    std::unordered_map<Sid, PropertyValue> engravingDefaults;
+    double textEnclosureThickness = 0.0;
+
+    bool ok = BinaryCacheFile::read(cachePath, cacheKey, [&](BinaryCacheFile::Reader& reader) {
+        uint32_t symbolCount = 0;
+        if (!reader.read(symbolCount) || symbolCount != symbols.size()) {
+            return false;
+        }
+
+        for (Sym& sym : symbols) {
+            uint32_t code = 0;
+            double x = 0.0, y = 0.0, w = 0.0, h = 0.0;
+            uint32_t anchorCount = 0;
+            if (!reader.read(code) || !reader.read(x) || !reader.read(y) || !reader.read(w) || !reader.read(h)
+                || !reader.read(sym.advance) || !reader.read(anchorCount)) {
+                return false;
+            }
+
+            sym.code = code;
+            sym.bbox = RectF(x, y, w, h);
+
+            for (uint32_t i = 0; i < anchorCount; ++i) {
+                int32_t anchorId = 0;
+                double ax = 0.0, ay = 0.0;
+                if (!reader.read(anchorId) || !reader.read(ax) || !reader.read(ay)) {
+                    return false;
+                }
+                sym.smuflAnchors[static_cast<SmuflAnchorId>(anchorId)] = PointF(ax, ay);
+            }
+
+            uint32_t subSymbolCount = 0;
+            if (!reader.read(subSymbolCount)) {
+                return false;
+            }
+
+            for (uint32_t i = 0; i < subSymbolCount; ++i) {
+                uint32_t subSymbolId = 0;
+                if (!reader.read(subSymbolId)) {
+                    return false;
+                }
+                sym.subSymbolIds.push_back(static_cast<SymId>(subSymbolId));
+            }
+        }
+
+        uint32_t defaultCount = 0;
+        if (!reader.read(textEnclosureThickness) || !reader.read(defaultCount)) {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < defaultCount; ++i) {
+            int32_t sid = 0;
+            uint8_t type = 0;
+            if (!reader.read(sid) || !reader.read(type)) {
+                return false;
+            }
+
+            PropertyValue value;
+            if (type == static_cast<uint8_t>(P_TYPE::REAL)) {
+                double d = 0.0;
+                if (!reader.read(d)) {
+                    return false;
+                }
+                value = d;
+            } else if (type == static_cast<uint8_t>(P_TYPE::BOOL)) {
+                uint8_t b = 0;
+                if (!reader.read(b)) {
+                    return false;
+                }
+                value = b != 0;
+            } else if (type == static_cast<uint8_t>(P_TYPE::STRING)) {
+                String s;
+                if (!reader.readString(s)) {
+                    return false;
+                }
+                value = s;
+            } else {
+                return false;
+            }
+
+            engravingDefaults.insert({ static_cast<Sid>(sid), value });
+        }
+
+        return true;
+    });
+
+    if (!ok) {
+        return false;
+    }
+
+    m_symbols = std::move(symbols);
+    m_engravingDefaults = std::move(engravingDefaults);
+    m_textEnclosureThickness = textEnclosureThickness;
+
+    return true;
+}
+
+void EngravingFont::writeMetricsCache(const io::path_t& cachePath, uint64_t cacheKey) const
+{
+    BinaryCacheFile::Writer writer;
+
+    writer.write(static_cast<uint32_t>(m_symbols.size()));
+    for (const Sym& sym : m_symbols) {
+        writer.write(static_cast<uint32_t>(sym.code));
+        writer.write(sym.bbox.x());
+        writer.write(sym.bbox.y());
+        writer.write(sym.bbox.width());
+        writer.write(sym.bbox.height());
+        writer.write(sym.advance);
+
+        writer.write(static_cast<uint32_t>(sym.smuflAnchors.size()));
+        for (const auto& anchor : sym.smuflAnchors) {
+            writer.write(static_cast<int32_t>(anchor.first));
+            writer.write(anchor.second.x());
+            writer.write(anchor.second.y());
+        }
+
+        writer.write(static_cast<uint32_t>(sym.subSymbolIds.size()));
+        for (SymId subSymbolId : sym.subSymbolIds) {
+            writer.write(static_cast<uint32_t>(subSymbolId));
+        }
+    }
+
+    writer.write(m_textEnclosureThickness);
+
+    writer.write(static_cast<uint32_t>(m_engravingDefaults.size()));
+    for (const auto& pair : m_engravingDefaults) {
+        const PropertyValue& value = pair.second;
+
+        writer.write(static_cast<int32_t>(pair.first));
+        writer.write(static_cast<uint8_t>(value.type()));
+
+        switch (value.type()) {
+        case P_TYPE::REAL:
+            writer.write(value.value<double>());
+            break;
+        case P_TYPE::BOOL:
+            writer.write(static_cast<uint8_t>(value.value<bool>()));
+            break;
+        case P_TYPE::STRING:
+            writer.writeString(value.value<String>());
+            break;
+        default:
+            LOGW() << "Not cached engraving default of " << m_name << ", type: " << static_cast<int>(value.type());
+            return;
+        }
+    }
+
+    BinaryCacheFile::write(cachePath, cacheKey, writer);
+}
+
 void EngravingFont::loadGlyphsWithAnchors(const JsonObject& glyphsWithAnchors)
 {
     for (const std::string& symName : glyphsWithAnchors.keys()) {
@@ -496,12 +688,22 @@ void EngravingFont::loadEngravingDefaults(const JsonObject& engravingDefaultsObj
     m_engravingDefaults.insert({ Sid::MusicalTextFont, String(u"%1 Text").arg(String::fromStdString(m_family)) });
 }
 
-void EngravingFont::computeMetrics(EngravingFont::Sym& sym, const Smufl::Code& code)
+char32_t EngravingFont::codeInFont(const Smufl::Code& code) const
 {
     if (fontProvider()->inFontUcs4(m_font, code.smuflCode)) {
-        sym.code = code.smuflCode;
+        return code.smuflCode;
     } else if (fontProvider()->inFontUcs4(m_font, code.musicSymBlockCode)) {
-        sym.code = code.musicSymBlockCode;
+        return code.musicSymBlockCode;
+    }
+
+    return 0;
+}
+
+void EngravingFont::computeMetrics(EngravingFont::Sym& sym, const Smufl::Code& code)
+{
+    char32_t codeInFont = this->codeInFont(code);
+    if (codeInFont > 0) {
+        sym.code = codeInFont;
     }
 
     if (sym.code > 0) {
@@ -646,16 +848,72 @@ PointF EngravingFont::smuflAnchor(SymId symId, SmuflAnchorId anchorId, double ma
 // =============================================
 
 void EngravingFont::draw(SymId id, Painter* painter, const SizeF& mag, const PointF& pos) const
+{
+    draw(SymbolPositions { { id, pos } }, painter, mag);
+}
+
+void EngravingFont::draw(SymId id, Painter* painter, double mag, const PointF& pos) const
+{
+    draw(id, painter, SizeF(mag, mag), pos);
+}
+
+void EngravingFont::draw(const SymIdList& ids, Painter* painter, double mag, const PointF& startPos) const
+{
+    draw(ids, painter, SizeF(mag, mag), startPos);
+}
+
+void EngravingFont::draw(const SymIdList& ids, Painter* painter, const SizeF& mag, const PointF& startPos) const
+{
+    SymbolPositions symbols;
+    symbols.reserve(ids.size());
+
+    PointF pos(startPos);
+    for (SymId id : ids) {
+        symbols.push_back({ id, pos });
+        pos.setX(pos.x() + advance(id, mag.width()));
+    }
+
+    draw(symbols, painter, mag);
+}
+
+void EngravingFont::draw(const SymbolPositions& symbols, Painter* painter, double mag) const
+{
+    draw(symbols, painter, SizeF(mag, mag));
+}
+
+void EngravingFont::draw(const SymbolPositions& symbols, Painter* painter, const SizeF& mag) const
+{
+    SymbolPositions own;
+    SymbolPositions fallback;
+    own.reserve(symbols.size());
+
+    for (const SymbolPosition& symbol : symbols) {
+        collectSymbols(symbol.id, mag, symbol.pos, own, fallback);
+    }
+
+    drawSymbols(own, painter, mag);
+
+    if (!fallback.empty()) {
+        engravingFonts()->fallbackFont()->draw(fallback, painter, mag);
+    }
+}
+
+void EngravingFont::collectSymbols(SymId id, const SizeF& mag, const PointF& pos, SymbolPositions& own, SymbolPositions& fallback) const
 {
     const Sym& sym = this->sym(id);
     if (sym.isCompound()) { // is this a compound symbol?
-        draw(sym.subSymbolIds, painter, mag, pos);
+        PointF subPos(pos);
+        for (SymId subId : sym.subSymbolIds) {
+            collectSymbols(subId, mag, subPos, own, fallback);
+            subPos.setX(subPos.x() + advance(subId, mag.width()));
+        }
+
         return;
     }
 
     if (!sym.isValid()) {
         if (MScore::useFallbackFont && !engravingFonts()->isFallbackFont(this)) {
-            engravingFonts()->fallbackFont()->draw(id, painter, mag, pos);
+            fallback.push_back({ id, pos });
         } else {
             LOGE() << "invalid sym: " << static_cast<size_t>(id);
         }
@@ -663,34 +921,35 @@ void EngravingFont::draw(SymId id, Painter* painter, const SizeF& mag, const Poi
         return;
     }
 
-    painter->save();
-    double size = 20.0 * MScore::pixelRatio;
-    m_font.setPointSizeF(size);
-    painter->scale(mag.width(), mag.height());
-    painter->setFont(m_font);
-    painter->drawSymbol(PointF(pos.x() / mag.width(), pos.y() / mag.height()), symCode(id));
-    painter->restore();
+    own.push_back({ id, pos });
 }
 
-void EngravingFont::draw(SymId id, Painter* painter, double mag, const PointF& pos) const
+void EngravingFont::drawSymbols(const SymbolPositions& symbols, Painter* painter, const SizeF& mag) const
 {
-    draw(id, painter, SizeF(mag, mag), pos);
-}
+    if (symbols.empty()) {
+        return;
+    }
 
-void EngravingFont::draw(const SymIdList& ids, Painter* painter, double mag, const PointF& startPos) const
-{
-    PointF pos(startPos);
-    for (SymId id : ids) {
-        draw(id, painter, mag, pos);
-        pos.setX(pos.x() + advance(id, mag));
+    //! NOTE Instead of save and restore, which end a batch of the painter,
+    //! only the font and the scaling are set back
+    const Font oldFont = painter->font();
+    const Transform oldTransform = painter->worldTransform();
+    const bool isScaled = !RealIsEqual(mag.width(), 1.0) || !RealIsEqual(mag.height(), 1.0);
+
+    //! NOTE The loaded font is not changed, it is shared by the layout and paint workers
+    Font font(m_font);
+    font.setPointSizeF(20.0 * MScore::pixelRatio);
+    if (isScaled) {
+        painter->scale(mag.width(), mag.height());
     }
-}
+    painter->setFont(font);
 
-void EngravingFont::draw(const SymIdList& ids, Painter* painter, const SizeF& mag, const PointF& startPos) const
-{
-    PointF pos(startPos);
-    for (SymId id : ids) {
-        draw(id, painter, mag, pos);
-        pos.setX(pos.x() + advance(id, mag.width()));
+    for (const SymbolPosition& symbol : symbols) {
+        painter->drawSymbol(PointF(symbol.pos.x() / mag.width(), symbol.pos.y() / mag.height()), symCode(symbol.id));
+    }
+
+    painter->setFont(oldFont);
+    if (isScaled) {
+        painter->setWorldTransform(oldTransform);
     }
 }
@@ -22,6 +22,8 @@
 #ifndef MU_ENGRAVING_ENGRAVINGFONT_H
 #define MU_ENGRAVING_ENGRAVINGFONT_H
 
+#include <atomic>
+#include <mutex>
 #include <unordered_map>
 
 #include "iengravingfont.h"
@@ -30,6 +32,7 @@
 #include "draw/ifontprovider.h"
 #include "draw/types/geometry.h"
 #include "iengravingfontsprovider.h"
+#include "iengravingconfiguration.h"
 
 #include "io/path.h"
 
@@ -51,6 +54,7 @@ class EngravingFont : public IEngravingFont
 {
     INJECT_STATIC(score, mu::draw::IFontProvider, fontProvider)
     INJECT_STATIC(score, IEngravingFontsProvider, engravingFonts)
+    INJECT_STATIC(score, IEngravingConfiguration, configuration)
 public:
     EngravingFont(const std::string& name, const std::string& family, const io::path_t& filePath);
     EngravingFont(const EngravingFont& other);
@@ -86,6 +90,9 @@ public:
     void draw(const SymIdList& ids, draw::Painter* p, double mag, const PointF& pos) const override;
     void draw(const SymIdList& ids, draw::Painter* p, const SizeF& mag, const PointF& pos) const override;
 
+    void draw(const SymbolPositions& symbols, draw::Painter* p, double mag) const override;
+    void draw(const SymbolPositions& symbols, draw::Painter* p, const SizeF& mag) const override;
+
     void ensureLoad();
 
 private:
@@ -115,16 +122,24 @@ private:
     void loadComposedGlyphs();
     void loadStylisticAlternates(const JsonObject& glyphsWithAlternatesObject);
     void loadEngravingDefaults(const JsonObject& engravingDefaultsObject);
+    char32_t codeInFont(const Smufl::Code& code) const;
     void computeMetrics(Sym& sym, const Smufl::Code& code);
 
+    bool readMetricsCache(const io::path_t& cachePath, uint64_t cacheKey);
+    void writeMetricsCache(const io::path_t& cachePath, uint64_t cacheKey) const;
+
     Sym& sym(SymId id);
     const Sym& sym(SymId id) const;
 
     bool useFallbackFont(SymId id) const;
 
-    bool m_loaded = false;
+    void collectSymbols(SymId id, const SizeF& mag, const PointF& pos, SymbolPositions& own, SymbolPositions& fallback) const;
+    void drawSymbols(const SymbolPositions& symbols, draw::Painter* painter, const SizeF& mag) const;
+
+    std::atomic<bool> m_loaded = false;
+    std::mutex m_loadMutex;
     std::vector<Sym> m_symbols;
-    mutable draw::Font m_font;
+    draw::Font m_font;
 
     std::string m_name;
     std::string m_family;
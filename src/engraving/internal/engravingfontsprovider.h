@@ -23,6 +23,7 @@
 #ifndef MU_ENGRAVING_ENGRAVINGFONTSPROVIDER_H
 #define MU_ENGRAVING_ENGRAVINGFONTSPROVIDER_H
 
+#include <mutex>
 #include <vector>
 
 #include "iengravingfontsprovider.h"
@@ -54,6 +55,7 @@ private:
     };
 
     mutable Fallback m_fallback;
+    mutable std::mutex m_fallbackMutex; // the fallback font may be needed while pages are painted concurrently
     std::vector<std::shared_ptr<EngravingFont> > m_symbolFonts;
 };
 }
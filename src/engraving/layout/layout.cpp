@@ -21,6 +21,9 @@
  */
 #include "layout.h"
 
+#include <algorithm>
+#include <iterator>
+
 #include "containers.h"
 
 #include "libmscore/barline.h"
@@ -48,6 +51,7 @@
 #include "layoutsystem.h"
 #include "layoutbeams.h"
 #include "layouttuplets.h"
+#include "measurewidthcache.h"
 
 #include "log.h"
 
@@ -60,21 +64,60 @@ using namespace mu::engraving;
 class CmdStateLocker
 {
     Score* m_score = nullptr;
+    bool m_wasLocked = false;   // the excerpts share the cmd state, see MasterScore::doLayoutScoresRange
 public:
     CmdStateLocker(Score* s)
-        : m_score(s) { m_score->cmdState().lock(); }
-    ~CmdStateLocker() { m_score->cmdState().unlock(); }
+        : m_score(s), m_wasLocked(s->cmdState().locked())
+    {
+        if (!m_wasLocked) {
+            m_score->cmdState().lock();
+        }
+    }
+
+    ~CmdStateLocker()
+    {
+        if (!m_wasLocked) {
+            m_score->cmdState().unlock();
+        }
+    }
 };
 
 Layout::Layout(Score* score)
-    : m_score(score)
+    : m_score(score), m_widthCache(std::make_unique<MeasureWidthCache>())
 {
 }
 
+Layout::~Layout() = default;
+
+void Layout::prepareMMRests(const LayoutOptions& options, const Fraction& st, const Fraction& et)
+{
+    if (!m_score->firstMeasure()) {
+        return;
+    }
+
+    LayoutContext ctx(m_score);
+    // the measures out of the range keep their cached emptiness, as in doLayoutRange()
+    if (st > Fraction(0, 1) || !et.negative()) {
+        ctx.changedStartTick = std::max(st, Fraction(0, 1));
+        if (!et.negative()) {
+            ctx.changedEndTick = et;
+        }
+    }
+    for (const Staff* staff : m_score->staves()) {
+        ctx.shownStavesKey = ctx.shownStavesKey * 31 + (staff->show() ? 2 : 1);
+    }
+
+    LayoutMeasure::prepareMMRests(options, ctx);
+}
+
 void Layout::doLayoutRange(const LayoutOptions& options, const Fraction& st, const Fraction& et)
 {
     CmdStateLocker cmdStateLocker(m_score);
+    // before the context, its destructor waits for the pages finished on workers
+    LayoutStatistics* statistics = options.collectStatistics || LayoutStatistics::isCollectingRequested() ? &m_statistics : nullptr;
+    LayoutStatistics::Scope statisticsScope(statistics, LayoutStatistics::Phase::Layout);
     LayoutContext ctx(m_score);
+    ctx.statistics = statistics;
 
     Fraction stick(st);
     Fraction etick(et);
@@ -87,6 +130,9 @@ void Layout::doLayoutRange(const LayoutOptions& options, const Fraction& st, con
         DeleteAll(m_score->pages());
         m_score->pages().clear();
         LayoutPage::getNextPage(options, ctx);
+        m_pendingTick = Fraction(-1, 1);
+        clearDraftRange();
+        m_score->setPaintDamageAll();
         return;
     }
 
@@ -97,8 +143,24 @@ void Layout::doLayoutRange(const LayoutOptions& options, const Fraction& st, con
     if (etick < Fraction(0, 1)) {
         etick = m_score->last()->endTick();
     }
+    // the measures after the pending tick have no valid system yet,
+    // continue from there if the range starts in that part
+    if (!isComplete() && stick > m_pendingTick) {
+        stick = m_pendingTick;
+    }
 
     ctx.endTick = etick;
+    ctx.layoutAll = layoutAll;
+    if (!layoutAll) {
+        ctx.changedStartTick = stick;
+        ctx.changedEndTick = etick;
+    }
+    for (const Staff* staff : m_score->staves()) {
+        ctx.shownStavesKey = ctx.shownStavesKey * 31 + (staff->show() ? 2 : 1);
+    }
+
+    m_widthCache->checkStyle(m_score);
+    ctx.widthCache = m_widthCache.get();
 
     if (m_score->cmdState().layoutFlags & LayoutFlag::REBUILD_MIDI_MAPPING) {
         if (m_score->isMaster()) {
@@ -113,6 +175,16 @@ void Layout::doLayoutRange(const LayoutOptions& options, const Fraction& st, con
     //    initialize layout context lc
     //---------------------------------------------------
 
+    if (options.optimalSystemBreaks && !options.isLinearMode()) {
+        // the systems of the whole paragraph around the range are planned again
+        auto it = m_paragraphStarts.upper_bound(stick);
+        if (it != m_paragraphStarts.begin()) {
+            stick = *std::prev(it);
+        }
+    } else {
+        m_paragraphStarts.clear();
+    }
+
     MeasureBase* m = m_score->tick2measure(stick);
     if (m == 0) {
         m = m_score->first();
@@ -136,14 +208,23 @@ void Layout::doLayoutRange(const LayoutOptions& options, const Fraction& st, con
         m = toMeasure(m)->mmRest();
     }
 
+    // only the systems laid out again or moved are repainted, see addSystemsPaintDamage
+    if (layoutAll || options.isLinearMode()) {
+        m_score->setPaintDamageAll();
+    }
+
     if (options.isLinearMode()) {
         ctx.prevMeasure = 0;
         ctx.nextMeasure = m;         //_showVBox ? first() : firstMeasure();
         ctx.startTick   = m->tick();
+        limitToLinearWindow(options, ctx);
         layoutLinear(layoutAll, options, ctx);
+        m_pendingTick = Fraction(-1, 1);
         return;
     }
 
+    m_linearStaleTicks.clear();
+
     if (!layoutAll && m->system()) {
         System* system = m->system();
         system_idx_t systemIndex = mu::indexOf(m_score->_systems, system);
@@ -207,6 +288,7 @@ void Layout::doLayoutRange(const LayoutOptions& options, const Fraction& st, con
 
         DeleteAll(m_score->pages());
         m_score->pages().clear();
+        m_paragraphStarts.clear();
 
         ctx.nextMeasure = options.showVBox ? m_score->first() : m_score->firstMeasure();
     }
@@ -222,16 +304,30 @@ void Layout::doLayoutRange(const LayoutOptions& options, const Fraction& st, con
 void Layout::doLayout(const LayoutOptions& options, LayoutContext& lc)
 {
     MeasureBase* lmb;
+    size_t collectedPages = 0;
+    bool pageLimitReached = false;
+    const page_idx_t oldPageCount = m_score->npages();
+    std::vector<const Page*> pages;
     do {
         LayoutPage::getNextPage(options, lc);
         LayoutPage::collectPage(options, lc);
 
+        if (lc.page) {
+            pages.push_back(lc.page);
+            // the header and the footer of a new page
+            if (lc.curPage > oldPageCount) {
+                m_score->addPaintDamage(lc.page->canvasBoundingRect());
+            }
+        }
+
         if (lc.page && !lc.page->systems().empty()) {
             lmb = lc.page->systems().back()->measures().back();
         } else {
             lmb = nullptr;
         }
 
+        pageLimitReached = options.pageLimit > 0 && ++collectedPages >= options.pageLimit;
+
         // we can stop collecting pages when:
         // 1) we reach the end of score (curSystem is nullptr)
         // or
@@ -241,17 +337,61 @@ void Layout::doLayout(const LayoutOptions& options, LayoutContext& lc)
         //    c) this page ends with the same measure as the previous layout
         //    pageOldMeasure will be last measure from previous layout if range was completed on or before this page
         //    it will be nullptr if this page was never laid out or if we collected a system for next page
-    } while (lc.curSystem && !(lc.rangeDone && lmb == lc.pageOldMeasure));
+    } while (lc.curSystem && !(lc.rangeDone && lmb == lc.pageOldMeasure) && !pageLimitReached);
     // && page->system(0)->measures().back()->tick() > endTick // FIXME: perhaps the first measure was meant? Or last system?
 
+    LayoutPage::waitForPendingPage(lc);
+
+    addSystemsPaintDamage(lc, pages);
+
+    // only the vertical justification is left out of a draft
+    if (options.draftLayout && options.isMode(LayoutMode::PAGE) && m_score->enableVerticalSpread()) {
+        for (const Page* page : pages) {
+            if (page->systems().empty() || page->systems().front()->measures().empty()) {
+                continue;
+            }
+            Fraction stick = page->systems().front()->measures().front()->tick();
+            Fraction etick = page->systems().back()->endTick();
+            if (!hasDraftRange()) {
+                m_draftStartTick = stick;
+                m_draftEndTick = etick;
+            } else {
+                m_draftStartTick = std::min(m_draftStartTick, stick);
+                m_draftEndTick = std::max(m_draftEndTick, etick);
+            }
+        }
+    }
+
+    if (!lc.plannedParagraphStarts.empty()) {
+        m_paragraphStarts.erase(m_paragraphStarts.lower_bound(lc.plannedParagraphStarts.front()),
+                                m_paragraphStarts.upper_bound(lc.plannedParagraphStarts.back()));
+        m_paragraphStarts.insert(lc.plannedParagraphStarts.begin(), lc.plannedParagraphStarts.end());
+    }
+
+    // Systems of the previous layout whose measures have been reflowed
+    // into re-collected systems are no longer referenced by any page
+    DeleteAll(lc.supersededSystems);
+    lc.supersededSystems.clear();
+
+    if (!lc.curSystem) {
+        m_pendingTick = Fraction(-1, 1);
+    } else if (pageLimitReached && !(lc.rangeDone && lmb == lc.pageOldMeasure)) {
+        // The system collected for the next page is laid out again on continuation
+        m_pendingTick = lc.curSystem->measures().front()->tick();
+    }
+
     if (!lc.curSystem) {
         // The end of the score. The remaining systems are not needed...
+        for (const System* s : lc.systemList) {
+            m_score->addPaintDamage(LayoutSystem::paintRect(s));
+        }
         DeleteAll(lc.systemList);
         lc.systemList.clear();
         // ...and the remaining pages too
         while (lc.score()->npages() > lc.curPage) {
             Page* p = lc.score()->pages().back();
             lc.score()->pages().pop_back();
+            m_score->addPaintDamage(p->canvasBoundingRect());
             delete p;
         }
     } else {
@@ -263,6 +403,36 @@ void Layout::doLayout(const LayoutOptions& options, LayoutContext& lc)
     lc.score()->systems().insert(lc.score()->systems().end(), lc.systemList.begin(), lc.systemList.end());
 }
 
+//---------------------------------------------------------
+//   addSystemsPaintDamage
+//    the old and the new area of the systems laid out again
+//    or moved, and the old area of the removed ones
+//---------------------------------------------------------
+
+void Layout::addSystemsPaintDamage(const LayoutContext& lc, const std::vector<const Page*>& pages)
+{
+    std::set<const System*> unchangedSystems;
+
+    for (const Page* page : pages) {
+        for (const System* system : page->systems()) {
+            RectF rect = LayoutSystem::paintRect(system);
+            auto old = lc.oldSystemRects.find(system);
+            if (!mu::contains(lc.relaidSystems, system) && old != lc.oldSystemRects.end() && old->second == rect) {
+                unchangedSystems.insert(system);
+                continue;
+            }
+
+            m_score->addPaintDamage(rect);
+        }
+    }
+
+    for (const auto& old : lc.oldSystemRects) {
+        if (!mu::contains(unchangedSystems, old.first)) {
+            m_score->addPaintDamage(old.second);
+        }
+    }
+}
+
 //---------------------------------------------------------
 //   layoutLinear
 //---------------------------------------------------------
@@ -276,6 +446,58 @@ void Layout::layoutLinear(bool layoutAll, const LayoutOptions& options, LayoutCo
     layoutLinear(options, lc);
 }
 
+//---------------------------------------------------------
+//   limitToLinearWindow
+//    restrict the layout range to the measures visible in
+//    continuous view, the measures of the range outside of
+//    the window keep their previous layout until scrolled in
+//---------------------------------------------------------
+
+void Layout::limitToLinearWindow(const LayoutOptions& options, LayoutContext& ctx)
+{
+    const Fraction rangeStart = ctx.startTick;
+    const Fraction rangeEnd = ctx.endTick;
+
+    m_linearStaleTicks.erase(m_linearStaleTicks.lower_bound(rangeStart), m_linearStaleTicks.upper_bound(rangeEnd));
+
+    if (options.linearWindowStart.negative() || options.linearWindowEnd.negative()) {
+        return;
+    }
+
+    ctx.startTick = std::max(rangeStart, options.linearWindowStart);
+    ctx.endTick = std::min(rangeEnd, options.linearWindowEnd);
+
+    for (const Measure* m = m_score->tick2measure(rangeStart); m && m->tick() <= rangeEnd; m = m->nextMeasure()) {
+        if (m->tick() < ctx.startTick || m->tick() > ctx.endTick) {
+            m_linearStaleTicks.insert(m->tick());
+        }
+    }
+}
+
+void Layout::clearDraftRange()
+{
+    m_draftStartTick = Fraction(-1, 1);
+    m_draftEndTick = Fraction(-1, 1);
+}
+
+bool Layout::isLinearRangeStale(const Fraction& stick, const Fraction& etick) const
+{
+    auto it = m_linearStaleTicks.lower_bound(stick);
+    return it != m_linearStaleTicks.end() && *it <= etick;
+}
+
+size_t Layout::memoryUsage() const
+{
+    //! NOTE The nodes of the sets are counted at three pointers and the value
+    constexpr size_t SET_NODE_SIZE = 3 * sizeof(void*) + sizeof(Fraction);
+
+    size_t bytes = (m_linearStaleTicks.size() + m_paragraphStarts.size()) * SET_NODE_SIZE;
+    if (m_widthCache) {
+        bytes += m_widthCache->memoryUsage();
+    }
+    return bytes;
+}
+
 //---------------------------------------------------------
 //   resetSystems
 //    in linear mode there is only one page
@@ -397,7 +619,7 @@ void Layout::collectLinearSystem(const LayoutOptions& options, LayoutContext& ct
                     m->stretchMeasureInPracticeMode(ww);
                 } else {
                     m->createEndBarLines(false);
-                    m->computeWidth(minTicks, maxTicks, 1);
+                    LayoutMeasure::computeWidth(ctx, m, minTicks, maxTicks, 1);
                     ww = m->width();
                     m->layoutMeasureElements();
                 }
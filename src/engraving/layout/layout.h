@@ -22,18 +22,54 @@
 #ifndef MU_ENGRAVING_LAYOUT_H
 #define MU_ENGRAVING_LAYOUT_H
 
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "types/fraction.h"
+
 #include "layoutoptions.h"
+#include "layoutstatistics.h"
 
 namespace mu::engraving {
+class Page;
 class Score;
 
 class LayoutContext;
+class MeasureWidthCache;
 class Layout
 {
 public:
     Layout(Score* score);
+    ~Layout();
 
     void doLayoutRange(const LayoutOptions& options, const Fraction&, const Fraction&);
+    //! creates the multimeasure rests of the score for a layout with LayoutOptions::mmRestsPrepared
+    void prepareMMRests(const LayoutOptions& options, const Fraction&, const Fraction&);
+
+    const MeasureWidthCache* widthCache() const { return m_widthCache.get(); }
+
+    //! false if the last layout stopped at LayoutOptions::pageLimit before the end of the score
+    bool isComplete() const { return m_pendingTick.negative(); }
+    //! first tick of the part of the score not laid out yet
+    const Fraction& pendingTick() const { return m_pendingTick; }
+
+    //! true if pages laid out with LayoutOptions::draftLayout have not been refined yet
+    bool hasDraftRange() const { return !m_draftStartTick.negative(); }
+    //! tick range of the pages laid out as a draft (end: the end tick of their last system)
+    const Fraction& draftStartTick() const { return m_draftStartTick; }
+    const Fraction& draftEndTick() const { return m_draftEndTick; }
+    void clearDraftRange();
+
+    //! true if measures starting in the range have been skipped by the window of a continuous view layout
+    bool isLinearRangeStale(const Fraction& stick, const Fraction& etick) const;
+
+    //! time of the layout phases, accumulated over the layouts with LayoutOptions::collectStatistics
+    const LayoutStatistics& statistics() const { return m_statistics; }
+    LayoutStatistics& statistics() { return m_statistics; }
+
+    //! memory held by the caches of the layout between the layouts
+    size_t memoryUsage() const;
 
 private:
 
@@ -41,10 +77,19 @@ private:
     void layoutLinear(bool layoutAll, const LayoutOptions& options, LayoutContext& lc);
     void resetSystems(bool layoutAll, const LayoutOptions& options, LayoutContext& lc);
     void collectLinearSystem(const LayoutOptions& options, LayoutContext& ctx);
+    void limitToLinearWindow(const LayoutOptions& options, LayoutContext& ctx);
 
     void doLayout(const LayoutOptions& options, LayoutContext& lc);
+    void addSystemsPaintDamage(const LayoutContext& lc, const std::vector<const Page*>& pages);
 
     Score* m_score = nullptr;
+    std::unique_ptr<MeasureWidthCache> m_widthCache;
+    Fraction m_pendingTick { -1, 1 };
+    Fraction m_draftStartTick { -1, 1 };
+    Fraction m_draftEndTick { -1, 1 };
+    std::set<Fraction> m_linearStaleTicks;
+    std::set<Fraction> m_paragraphStarts;  // optimal system breaks: first ticks of the planned paragraphs
+    LayoutStatistics m_statistics;
 };
 }
 
@@ -21,6 +21,8 @@
  */
 #include "layoutcontext.h"
 
+#include "concurrency/taskscheduler.h"
+
 #include "libmscore/mscoreview.h"
 #include "libmscore/score.h"
 #include "libmscore/spanner.h"
@@ -35,6 +37,16 @@ LayoutContext::LayoutContext(Score* score)
 
 LayoutContext::~LayoutContext()
 {
+    for (PendingPage& pending : pendingPages) {
+        if (pending.finished.valid()) {
+            pending.finished.wait();
+        }
+    }
+
+    if (!notifyOnDestroy) {
+        return;
+    }
+
     for (Spanner* s : processedSpanners) {
         s->layoutSystemsDone();
     }
@@ -43,3 +55,9 @@ LayoutContext::~LayoutContext()
         v->layoutChanged();
     }
 }
+
+mu::TaskScheduler* LayoutContext::workers()
+{
+    static mu::TaskScheduler scheduler;
+    return &scheduler;
+}
@@ -22,19 +22,28 @@
 #ifndef MU_ENGRAVING_LAYOUTCONTEXT_H
 #define MU_ENGRAVING_LAYOUTCONTEXT_H
 
+#include <future>
 #include <vector>
 #include <set>
+#include <unordered_map>
 
 #include "types/fraction.h"
 #include "types/types.h"
 
+namespace mu {
+class TaskScheduler;
+}
+
 namespace mu::engraving {
 class MeasureBase;
+class MeasureWidthCache;
 class Page;
 class Score;
 class Spanner;
 class System;
 
+class LayoutStatistics;
+
 class LayoutContext
 {
 public:
@@ -45,6 +54,9 @@ public:
 
     Score* score() const { return m_score; }
 
+    // worker threads for layout tasks, not shared with the audio ones
+    static TaskScheduler* workers();
+
     bool startWithLongNames = true;
     bool firstSystem = true;
     bool firstSystemIndent = true;
@@ -52,6 +64,9 @@ public:
     page_idx_t curPage = 0; // index in Score->page()s
     Fraction tick{ 0, 1 };
 
+    // false for the scratch contexts, which only measure and must not notify the spanners and the views
+    bool notifyOnDestroy = true;
+
     std::vector<System*> systemList; // reusable systems
     std::set<Spanner*> processedSpanners;
 
@@ -62,6 +77,13 @@ public:
     MeasureBase* pageOldMeasure = nullptr;
     bool rangeDone = false;
 
+    // dirty range tracking
+    std::vector<System*> supersededSystems; // systems of the previous layout whose measures have been taken by re-collected systems
+
+    // paint damage, see LayoutSystem::paintRect
+    std::unordered_map<const System*, RectF> oldSystemRects; // systems of the previous layout touched by this one
+    std::set<const System*> relaidSystems;
+
     MeasureBase* prevMeasure = nullptr;
     MeasureBase* curMeasure = nullptr;
     MeasureBase* nextMeasure = nullptr;
@@ -71,6 +93,41 @@ public:
 
     double totalBracketsWidth = -1.0;
 
+    MeasureWidthCache* widthCache = nullptr;
+    LayoutStatistics* statistics = nullptr;   // only with LayoutOptions::collectStatistics
+
+    // ticks which may have changed since the previous layout, everything by default
+    Fraction changedStartTick { 0, 1 };
+    Fraction changedEndTick = Fraction::max();
+    size_t shownStavesKey = 0;
+
+    // optimal system breaks, see LayoutSystemBreaks
+    std::set<const MeasureBase*> plannedSystemStarts;
+    const MeasureBase* plannedSystemsEnd = nullptr;     // layout can't converge inside of the planned systems
+    std::vector<Fraction> plannedParagraphStarts;
+
+    // the measures processed by getNextMeasure while the systems were planned,
+    // by the measure before them; getNextMeasure only moves to them then
+    struct PreparedMeasure {
+        MeasureBase* nextMeasure = nullptr;   // before
+        Fraction tick;                        // before
+        MeasureBase* preparedCurMeasure = nullptr;
+        MeasureBase* preparedNextMeasure = nullptr;
+        Fraction preparedTick;
+        int preparedMeasureNo = 0;
+    };
+    std::unordered_map<const MeasureBase*, PreparedMeasure> preparedMeasures;
+
+    // pages finished on workers while the next page is collected,
+    // several of them only on full layout (see LayoutPage::collectPage)
+    bool layoutAll = false;
+    struct PendingPage {
+        Page* page = nullptr;
+        std::future<void> finished;
+    };
+    std::vector<PendingPage> pendingPages;
+    Fraction pendingPageEndTick { -1, 1 };
+
 private:
     Score* m_score = nullptr;
 };
@@ -49,7 +49,9 @@ static double findLyricsMaxY(const MStyle& style, Segment& s, staff_idx_t staffI
     for (voice_idx_t voice = 0; voice < VOICES; ++voice) {
         ChordRest* cr = s.cr(staffIdx * VOICES + voice);
         if (cr && !cr->lyrics().empty()) {
+            // all the verses of the chord rest are queried at once
             SkylineLine sk(true);
+            bool hasLyrics = false;
 
             for (Lyrics* l : cr->lyrics()) {
                 if (l->autoplace() && l->placeBelow()) {
@@ -58,15 +60,14 @@ static double findLyricsMaxY(const MStyle& style, Segment& s, staff_idx_t staffI
                     RectF r = l->bbox().translated(offset);
                     r.translate(0.0, -yOff);
                     sk.add(r.x(), r.top(), r.width());
+                    hasLyrics = true;
                 }
             }
-            SysStaff* ss = s.measure()->system()->staff(staffIdx);
-            for (Lyrics* l : cr->lyrics()) {
-                if (l->autoplace() && l->placeBelow()) {
-                    double y = ss->skyline().south().minDistance(sk);
-                    if (y > -lyricsMinTopDistance) {
-                        yMax = std::max(yMax, y + lyricsMinTopDistance);
-                    }
+            if (hasLyrics) {
+                SysStaff* ss = s.measure()->system()->staff(staffIdx);
+                double y = ss->skyline().south().minDistance(sk);
+                if (y > -lyricsMinTopDistance) {
+                    yMax = std::max(yMax, y + lyricsMinTopDistance);
                 }
             }
         }
@@ -89,6 +90,7 @@ static double findLyricsMinY(const MStyle& style, Segment& s, staff_idx_t staffI
         ChordRest* cr = s.cr(staffIdx * VOICES + voice);
         if (cr && !cr->lyrics().empty()) {
             SkylineLine sk(false);
+            bool hasLyrics = false;
 
             for (Lyrics* l : cr->lyrics()) {
                 if (l->autoplace() && l->placeAbove()) {
@@ -96,15 +98,14 @@ static double findLyricsMinY(const MStyle& style, Segment& s, staff_idx_t staffI
                     RectF r = l->bbox().translated(l->pos() + cr->pos() + s.pos() + s.measure()->pos());
                     r.translate(0.0, -yOff);
                     sk.add(r.x(), r.bottom(), r.width());
+                    hasLyrics = true;
                 }
             }
-            SysStaff* ss = s.measure()->system()->staff(staffIdx);
-            for (Lyrics* l : cr->lyrics()) {
-                if (l->autoplace() && l->placeAbove()) {
-                    double y = sk.minDistance(ss->skyline().north());
-                    if (y > -lyricsMinTopDistance) {
-                        yMin = std::min(yMin, -y - lyricsMinTopDistance);
-                    }
+            if (hasLyrics) {
+                SysStaff* ss = s.measure()->system()->staff(staffIdx);
+                double y = sk.minDistance(ss->skyline().north());
+                if (y > -lyricsMinTopDistance) {
+                    yMin = std::min(yMin, -y - lyricsMinTopDistance);
                 }
             }
         }
@@ -213,6 +214,8 @@ void LayoutLyrics::layoutLyrics(const LayoutOptions& options, const Score* score
 
     //int nAbove[nstaves()];
     std::vector<staff_idx_t> VnAbove(score->nstaves());
+    // chord rests with lyrics, collected in the first sweep
+    std::vector<std::vector<ChordRest*> > lyricsChordRests(score->nstaves());
 
     for (staff_idx_t staffIdx : visibleStaves) {
         VnAbove[staffIdx] = 0;
@@ -225,7 +228,8 @@ void LayoutLyrics::layoutLyrics(const LayoutOptions& options, const Score* score
                 if (s.isChordRestType()) {
                     for (voice_idx_t voice = 0; voice < VOICES; ++voice) {
                         ChordRest* cr = s.cr(staffIdx * VOICES + voice);
-                        if (cr) {
+                        if (cr && !cr->lyrics().empty()) {
+                            lyricsChordRests[staffIdx].push_back(cr);
                             staff_idx_t nA = 0;
                             for (Lyrics* l : cr->lyrics()) {
                                 // user adjusted offset can possibly change placement
@@ -252,22 +256,9 @@ void LayoutLyrics::layoutLyrics(const LayoutOptions& options, const Score* score
     }
 
     for (staff_idx_t staffIdx : visibleStaves) {
-        for (MeasureBase* mb : system->measures()) {
-            if (!mb->isMeasure()) {
-                continue;
-            }
-            Measure* m = toMeasure(mb);
-            for (Segment& s : m->segments()) {
-                if (s.isChordRestType()) {
-                    for (voice_idx_t voice = 0; voice < VOICES; ++voice) {
-                        ChordRest* cr = s.cr(staffIdx * VOICES + voice);
-                        if (cr) {
-                            for (Lyrics* l : cr->lyrics()) {
-                                l->layout2(static_cast<int>(VnAbove[staffIdx]));
-                            }
-                        }
-                    }
-                }
+        for (ChordRest* cr : lyricsChordRests[staffIdx]) {
+            for (Lyrics* l : cr->lyrics()) {
+                l->layout2(static_cast<int>(VnAbove[staffIdx]));
             }
         }
     }
@@ -21,6 +21,8 @@
  */
 #include "layoutmeasure.h"
 
+#include "concurrency/taskscheduler.h"
+
 #include "libmscore/ambitus.h"
 #include "libmscore/barline.h"
 #include "libmscore/beam.h"
@@ -41,6 +43,8 @@
 #include "layoutbeams.h"
 #include "layoutchords.h"
 #include "layouttremolo.h"
+#include "layoutstatistics.h"
+#include "measurewidthcache.h"
 
 #include "log.h"
 
@@ -388,12 +392,12 @@ void LayoutMeasure::createMMRest(const LayoutOptions& options, Score* score, Mea
 }
 
 //---------------------------------------------------------
-// validMMRestMeasure
+// checkMMRestMeasure
 //    return true if this might be a measure in a
 //    multi measure rest
 //---------------------------------------------------------
 
-static bool validMMRestMeasure(const LayoutContext& ctx, Measure* m)
+static bool checkMMRestMeasure(const LayoutContext& ctx, Measure* m)
 {
     if (m->irregular()) {
         return false;
@@ -439,6 +443,30 @@ static bool validMMRestMeasure(const LayoutContext& ctx, Measure* m)
     return true;
 }
 
+//---------------------------------------------------------
+// validMMRestMeasure
+//    checkMMRestMeasure() result, reused for the measures
+//    that can't have changed since they were checked so
+//    that runs of empty measures aren't scanned again on
+//    every edit
+//---------------------------------------------------------
+
+static bool validMMRestMeasure(const LayoutContext& ctx, Measure* m)
+{
+    const Measure::MMRestCheck& check = m->mmRestCheck();
+    bool changed = m->tick() <= ctx.changedEndTick && m->endTick() >= ctx.changedStartTick;
+    if (check.known && !changed && check.shownStaves == ctx.shownStavesKey) {
+        return check.empty;
+    }
+
+    Measure::MMRestCheck newCheck;
+    newCheck.known = true;
+    newCheck.empty = checkMMRestMeasure(ctx, m);
+    newCheck.shownStaves = ctx.shownStavesKey;
+    m->setMMRestCheck(newCheck);
+    return newCheck.empty;
+}
+
 //---------------------------------------------------------
 //  breakMultiMeasureRest
 //    return true if this measure should start a new
@@ -561,14 +589,20 @@ static bool breakMultiMeasureRest(const LayoutContext& ctx, Measure* m)
 //   layoutDrumsetChord
 //---------------------------------------------------------
 
-static void layoutDrumsetChord(Chord* c, const Drumset* drumset, const StaffType* st, double spatium)
+static void layoutDrumsetChord(const LayoutOptions& options, Chord* c, const Drumset* drumset, const StaffType* st, double spatium)
 {
     for (Note* note : c->notes()) {
         int pitch = note->pitch();
         if (!drumset->isValid(pitch)) {
             // LOGD("unmapped drum note %d", pitch);
         } else if (!note->fixed()) {
-            note->undoChangeProperty(Pid::HEAD_GROUP, int(drumset->noteHead(pitch)));
+            int headGroup = int(drumset->noteHead(pitch));
+            if (!options.concurrentLinkedScores) {
+                note->undoChangeProperty(Pid::HEAD_GROUP, headGroup);
+            } else if (note->getProperty(Pid::HEAD_GROUP) != PropertyValue(headGroup)) {
+                // the linked notes get their head group from the layout of their own score
+                c->score()->undo(new ChangeProperty(note, Pid::HEAD_GROUP, headGroup, note->propertyFlags(Pid::HEAD_GROUP)));
+            }
             int line = drumset->line(pitch);
             note->setLine(line);
 
@@ -579,8 +613,109 @@ static void layoutDrumsetChord(Chord* c, const Drumset* drumset, const StaffType
     }
 }
 
+//---------------------------------------------------------
+//   updateMMRest
+//    replaces ctx.curMeasure and the empty measures after it
+//    with a multimeasure rest, or removes the multimeasure
+//    rest of ctx.curMeasure if there are too few of them
+//---------------------------------------------------------
+
+void LayoutMeasure::updateMMRest(const LayoutOptions& options, LayoutContext& ctx, int mno)
+{
+    Score* score = ctx.score();
+    Measure* m = toMeasure(ctx.curMeasure);
+    Measure* nm = m;
+    Measure* lm = nm;
+    int n       = 0;
+    Fraction len;
+
+    while (validMMRestMeasure(ctx, nm)) {
+        MeasureBase* mb = options.showVBox ? nm->next() : nm->nextMeasure();
+        if (breakMultiMeasureRest(ctx, nm) && n) {
+            break;
+        }
+        if (nm != m) {
+            adjustMeasureNo(ctx, nm);
+        }
+        ++n;
+        len += nm->ticks();
+        lm = nm;
+        if (!(mb && mb->isMeasure())) {
+            break;
+        }
+        nm = toMeasure(mb);
+    }
+    if (n >= score->styleI(Sid::minEmptyMeasures)) {
+        createMMRest(options, score, m, lm, len);
+        ctx.curMeasure  = m->mmRest();
+        ctx.nextMeasure = options.showVBox ? lm->next() : lm->nextMeasure();
+    } else {
+        if (m->mmRest()) {
+            score->undo(new ChangeMMRest(m, 0));
+        }
+        m->setMMRestCount(0);
+        ctx.measureNo = mno;
+    }
+}
+
+//---------------------------------------------------------
+//   moveToPreparedMMRest
+//    same as updateMMRest() for the multimeasure rests
+//    created before by prepareMMRests(): the measures
+//    are only numbered and skipped
+//---------------------------------------------------------
+
+void LayoutMeasure::moveToPreparedMMRest(const LayoutOptions& options, LayoutContext& ctx, int mno)
+{
+    Measure* m = toMeasure(ctx.curMeasure);
+    Measure* mmRest = m->mmRest();
+    if (!mmRest) {
+        ctx.measureNo = mno;
+        return;
+    }
+
+    Measure* lm = m;
+    for (Measure* nm = m->nextMeasure(); nm && nm->tick() < mmRest->endTick(); nm = nm->nextMeasure()) {
+        adjustMeasureNo(ctx, nm);
+        lm = nm;
+    }
+    ctx.curMeasure  = mmRest;
+    ctx.nextMeasure = options.showVBox ? lm->next() : lm->nextMeasure();
+}
+
+//---------------------------------------------------------
+//   prepareMMRests
+//    creates the multimeasure rests of the whole score as
+//    getNextMeasure() would, for a layout which can't
+//    create them (LayoutOptions::mmRestsPrepared): their
+//    elements are linked to the elements of other scores
+//---------------------------------------------------------
+
+void LayoutMeasure::prepareMMRests(const LayoutOptions& options, LayoutContext& ctx)
+{
+    Score* score = ctx.score();
+    if (!score->styleB(Sid::createMultiMeasureRests)) {
+        return;
+    }
+
+    MeasureBase* mb = options.showVBox ? score->first() : score->firstMeasure();
+    while (mb) {
+        ctx.curMeasure  = mb;
+        ctx.nextMeasure = options.showVBox ? mb->next() : mb->nextMeasure();
+        if (mb->isMeasure()) {
+            int mno = adjustMeasureNo(ctx, mb);
+            updateMMRest(options, ctx, mno);
+        }
+        mb = ctx.nextMeasure;
+    }
+}
+
 void LayoutMeasure::getNextMeasure(const LayoutOptions& options, LayoutContext& ctx)
 {
+    if (!ctx.preparedMeasures.empty() && moveToPreparedMeasure(ctx)) {
+        return;
+    }
+
     Score* score = ctx.score();
     ctx.prevMeasure = ctx.curMeasure;
     ctx.curMeasure  = ctx.nextMeasure;
@@ -592,43 +727,16 @@ void LayoutMeasure::getNextMeasure(const LayoutOptions& options, LayoutContext&
     if (!ctx.curMeasure) {
         return;
     }
+    LayoutStatistics::Scope statisticsScope(ctx.statistics, LayoutStatistics::Phase::GetNextMeasure, ctx.curMeasure);
 
     int mno = adjustMeasureNo(ctx, ctx.curMeasure);
 
     if (ctx.curMeasure->isMeasure()) {
         if (ctx.score()->styleB(Sid::createMultiMeasureRests)) {
-            Measure* m = toMeasure(ctx.curMeasure);
-            Measure* nm = m;
-            Measure* lm = nm;
-            int n       = 0;
-            Fraction len;
-
-            while (validMMRestMeasure(ctx, nm)) {
-                MeasureBase* mb = options.showVBox ? nm->next() : nm->nextMeasure();
-                if (breakMultiMeasureRest(ctx, nm) && n) {
-                    break;
-                }
-                if (nm != m) {
-                    adjustMeasureNo(ctx, nm);
-                }
-                ++n;
-                len += nm->ticks();
-                lm = nm;
-                if (!(mb && mb->isMeasure())) {
-                    break;
-                }
-                nm = toMeasure(mb);
-            }
-            if (n >= score->styleI(Sid::minEmptyMeasures)) {
-                createMMRest(options, score, m, lm, len);
-                ctx.curMeasure  = m->mmRest();
-                ctx.nextMeasure = options.showVBox ? lm->next() : lm->nextMeasure();
+            if (options.mmRestsPrepared) {
+                moveToPreparedMMRest(options, ctx, mno);
             } else {
-                if (m->mmRest()) {
-                    score->undo(new ChangeMMRest(m, 0));
-                }
-                m->setMMRestCount(0);
-                ctx.measureNo = mno;
+                updateMMRest(options, ctx, mno);
             }
         } else if (toMeasure(ctx.curMeasure)->isMMRest()) {
             LOGD("mmrest: no %d += %d", ctx.measureNo, toMeasure(ctx.curMeasure)->mmRestCount());
@@ -708,12 +816,12 @@ void LayoutMeasure::getNextMeasure(const LayoutOptions& options, LayoutContext&
                             c->setTrack(t);
                             c->computeUp();
                             if (drumset) {
-                                layoutDrumsetChord(c, drumset, st, score->spatium());
+                                layoutDrumsetChord(options, c, drumset, st, score->spatium());
                             }
                             c->layoutStem();
                         }
                         if (drumset) {
-                            layoutDrumsetChord(chord, drumset, st, score->spatium());
+                            layoutDrumsetChord(options, chord, drumset, st, score->spatium());
                         }
                         chord->computeUp();
                         chord->layoutStem();               // create stems needed to calculate spacing
@@ -766,10 +874,11 @@ void LayoutMeasure::getNextMeasure(const LayoutOptions& options, LayoutContext&
         LayoutBeams::layoutNonCrossBeams(&s);
     }
 
+    layoutPartsChords1(options, score, measure);
+
     for (staff_idx_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
         for (Segment& segment : measure->segments()) {
             if (segment.isChordRestType()) {
-                LayoutChords::layoutChords1(score, &segment, staffIdx);
                 for (voice_idx_t voice = 0; voice < VOICES; ++voice) {
                     ChordRest* cr = segment.cr(staffIdx * VOICES + voice);
                     if (cr) {
@@ -814,7 +923,11 @@ void LayoutMeasure::getNextMeasure(const LayoutOptions& options, LayoutContext&
             }
         }
     } else if (seg) {
-        score->undoRemoveElement(seg);
+        if (options.concurrentLinkedScores) {
+            score->undo(new RemoveElement(seg));
+        } else {
+            score->undoRemoveElement(seg);
+        }
     }
 
     for (Segment& s : measure->segments()) {
@@ -832,6 +945,92 @@ void LayoutMeasure::getNextMeasure(const LayoutOptions& options, LayoutContext&
     ctx.tick += measure->ticks();
 }
 
+//---------------------------------------------------------
+//   moveToPreparedMeasure
+//    the next measure has already been processed while the
+//    systems were planned, see LayoutSystemBreaks::planSystems
+//---------------------------------------------------------
+
+bool LayoutMeasure::moveToPreparedMeasure(LayoutContext& ctx)
+{
+    auto it = ctx.preparedMeasures.find(ctx.curMeasure);
+    if (it == ctx.preparedMeasures.end()) {
+        return false;
+    }
+
+    const LayoutContext::PreparedMeasure prepared = it->second;
+    ctx.preparedMeasures.erase(it);
+    if (prepared.nextMeasure != ctx.nextMeasure || prepared.tick != ctx.tick) {
+        return false;
+    }
+
+    ctx.prevMeasure = ctx.curMeasure;
+    ctx.curMeasure = prepared.preparedCurMeasure;
+    ctx.nextMeasure = prepared.preparedNextMeasure;
+    ctx.tick = prepared.preparedTick;
+    ctx.measureNo = prepared.preparedMeasureNo;
+
+    return true;
+}
+
+//---------------------------------------------------------
+//   layoutPartsChords1
+//    Before horizontal spacing is computed, chords of different
+//    parts don't interact (staff moves are limited to the staves
+//    of a part), so for large scores the parts are laid out in
+//    parallel. Each part is processed by a single task in staff
+//    order, so the result does not depend on the scheduling.
+//---------------------------------------------------------
+
+void LayoutMeasure::layoutPartsChords1(const LayoutOptions& options, Score* score, Measure* measure)
+{
+    static constexpr size_t PARALLEL_LAYOUT_MIN_PARTS = 8;
+
+    auto layoutStaves = [score, measure](staff_idx_t startStaff, staff_idx_t endStaff) {
+        for (staff_idx_t staffIdx = startStaff; staffIdx < endStaff; ++staffIdx) {
+            for (Segment& segment : measure->segments()) {
+                if (segment.isChordRestType()) {
+                    LayoutChords::layoutChords1(score, &segment, staffIdx);
+                }
+            }
+        }
+    };
+
+    const std::vector<Part*>& parts = score->parts();
+    if (!options.parallelPartsLayout || parts.size() < PARALLEL_LAYOUT_MIN_PARTS || LayoutContext::workers()->threadPoolSize() < 2) {
+        layoutStaves(0, score->nstaves());
+        return;
+    }
+
+    // the undo commands of the parts (e.g. the dots of the notes) are kept in a buffer per part
+    // and added to the command in part order after all of them
+    std::vector<UndoStack::CommandList> commands(parts.size() - 1);
+    std::vector<std::future<void> > futures;
+    futures.reserve(parts.size() - 1);
+    for (size_t i = 1; i < parts.size(); ++i) {
+        const Part* part = parts.at(i);
+        UndoStack::CommandList* buffer = &commands[i - 1];
+        staff_idx_t startStaff = track2staff(part->startTrack());
+        staff_idx_t endStaff = track2staff(part->endTrack());
+        futures.push_back(LayoutContext::workers()->submit([layoutStaves, buffer, startStaff, endStaff]() {
+            UndoStack::setThreadCommandBuffer(buffer);
+            layoutStaves(startStaff, endStaff);
+            UndoStack::setThreadCommandBuffer(nullptr);
+        }));
+    }
+
+    // the first part is laid out by the calling thread
+    const Part* firstPart = parts.front();
+    layoutStaves(track2staff(firstPart->startTrack()), track2staff(firstPart->endTrack()));
+
+    for (std::future<void>& future : futures) {
+        future.get();
+    }
+    for (UndoStack::CommandList& cmds : commands) {
+        score->undoStack()->appendCommands(cmds);
+    }
+}
+
 //---------------------------------------------------------
 //   adjustMeasureNo
 //---------------------------------------------------------
@@ -886,3 +1085,19 @@ void LayoutMeasure::computePreSpacingItems(Measure* m)
         seg.createShapes();
     }
 }
+
+//---------------------------------------------------------
+//   computeWidth
+//    horizontal spacing of the measure, taken from the
+//    width cache if a measure with the same content has
+//    already been spaced
+//---------------------------------------------------------
+
+void LayoutMeasure::computeWidth(LayoutContext& ctx, Measure* m, Fraction minTicks, Fraction maxTicks, double stretchCoeff)
+{
+    if (ctx.widthCache) {
+        ctx.widthCache->computeWidth(m, minTicks, maxTicks, stretchCoeff);
+    } else {
+        m->computeWidth(minTicks, maxTicks, stretchCoeff);
+    }
+}
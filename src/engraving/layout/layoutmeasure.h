@@ -36,13 +36,20 @@ public:
     LayoutMeasure() = default;
 
     static void getNextMeasure(const LayoutOptions& options, LayoutContext& lc);
+    static void prepareMMRests(const LayoutOptions& options, LayoutContext& ctx);
     static void computePreSpacingItems(Measure* m);
+    static void computeWidth(LayoutContext& ctx, Measure* m, Fraction minTicks, Fraction maxTicks, double stretchCoeff);
 
 private:
 
     static void createMMRest(const LayoutOptions& options, Score* score, Measure* firstMeasure, Measure* lastMeasure, const Fraction& len);
+    static void updateMMRest(const LayoutOptions& options, LayoutContext& ctx, int mno);
+    static void moveToPreparedMMRest(const LayoutOptions& options, LayoutContext& ctx, int mno);
 
     static int adjustMeasureNo(LayoutContext& lc, MeasureBase* m);
+    static bool moveToPreparedMeasure(LayoutContext& ctx);
+
+    static void layoutPartsChords1(const LayoutOptions& options, Score* score, Measure* measure);
 };
 }
 
@@ -25,6 +25,7 @@
 #include "style/styledef.h"
 #include "style/style.h"
 #include "libmscore/mscore.h"
+#include "types/fraction.h"
 
 namespace mu::engraving {
 //---------------------------------------------------------
@@ -45,6 +46,36 @@ struct LayoutOptions
 
     bool showVBox = true;
 
+    // lay out the chords of different parts on worker threads
+    // (only for scores with many parts, see LayoutMeasure::layoutPartsChords1)
+    bool parallelPartsLayout = true;
+    // finish the vertical layout of a page while the next one is collected
+    // (only for pages that don't share elements with the next one, see LayoutPage::isPageIsolated)
+    bool pipelinedPageLayout = true;
+    // lay out the excerpts of a master score concurrently (see MasterScore::doLayoutScoresRange)
+    bool parallelExcerptsLayout = true;
+    // the multimeasure rests have been created before the layout by LayoutMeasure::prepareMMRests,
+    // the layout doesn't change them
+    bool mmRestsPrepared = false;
+    // the linked scores are laid out at the same time (see MasterScore::doLayoutScoresRange),
+    // the layout changes the elements of its own score only
+    bool concurrentLinkedScores = false;
+    // stop the page layout after this many pages (0: no limit),
+    // the rest of the score is laid out later, see Score::continueLayout
+    size_t pageLimit = 0;
+    // continuous view: only measures starting in this tick range are laid out,
+    // the others keep their previous layout (negative: no limit)
+    Fraction linearWindowStart { -1, 1 };
+    Fraction linearWindowEnd { -1, 1 };
+    // choose the system breaks of each paragraph together (see LayoutSystemBreaks)
+    // instead of filling the systems one by one
+    bool optimalSystemBreaks = false;
+    // record the time of the layout phases, see Layout::statistics
+    bool collectStatistics = false;
+    // quick layout while editing: the vertical justification of the pages is skipped,
+    // the pages are laid out again with it later, see Score::refineDraftLayout
+    bool draftLayout = false;
+
     // from style
     double loWidth = 0;
     double loHeight = 0;
@@ -22,6 +22,7 @@
 #include "layoutpage.h"
 
 #include "realfn.h"
+#include "concurrency/taskscheduler.h"
 
 #include "libmscore/barline.h"
 #include "libmscore/beam.h"
@@ -33,6 +34,7 @@
 #include "libmscore/factory.h"
 #include "libmscore/measure.h"
 #include "libmscore/measurebase.h"
+#include "libmscore/note.h"
 #include "libmscore/page.h"
 #include "libmscore/score.h"
 #include "libmscore/segment.h"
@@ -41,11 +43,14 @@
 #include "libmscore/staff.h"
 #include "libmscore/system.h"
 #include "libmscore/systemdivider.h"
+#include "libmscore/tie.h"
 #include "libmscore/tremolo.h"
 #include "libmscore/tuplet.h"
 
 #include "layoutsystem.h"
 #include "layoutbeams.h"
+#include "layoutcontext.h"
+#include "layoutstatistics.h"
 #include "layouttuplets.h"
 #include "verticalgapdata.h"
 
@@ -103,6 +108,7 @@ void LayoutPage::getNextPage(const LayoutOptions& options, LayoutContext& lc)
 void LayoutPage::collectPage(const LayoutOptions& options, LayoutContext& ctx)
 {
     TRACEFUNC;
+    LayoutStatistics::Scope statisticsScope(ctx.statistics, LayoutStatistics::Phase::CollectPage);
 
     const double slb = ctx.score()->styleMM(Sid::staffLowerBorder);
     bool breakPages = ctx.score()->layoutMode() != LayoutMode::SYSTEM;
@@ -114,11 +120,14 @@ void LayoutPage::collectPage(const LayoutOptions& options, LayoutContext& ctx)
 
     System* nextSystem = 0;
     int systemIdx = -1;
+    double restHeight = 0.0;
+    double footerPadding = 0.0;
 
     // re-calculate positions for systems before current
     // (they may have been filled on previous layout)
     size_t pSystems = ctx.page->systems().size();
     if (pSystems > 0) {
+        LayoutSystem::keepOldPaintRect(ctx, ctx.page->system(0));
         ctx.page->system(0)->restoreLayout2();
         y = ctx.page->system(0)->y() + ctx.page->system(0)->height();
     } else {
@@ -129,6 +138,7 @@ void LayoutPage::collectPage(const LayoutOptions& options, LayoutContext& ctx)
         System* ps = ctx.page->system(i - 1);
         double distance = ps->minDistance(cs);
         y += distance;
+        LayoutSystem::keepOldPaintRect(ctx, cs);
         cs->setPos(ctx.page->lm(), y);
         cs->restoreLayout2();
         y += cs->height();
@@ -177,6 +187,7 @@ void LayoutPage::collectPage(const LayoutOptions& options, LayoutContext& ctx)
         }
 
         y += distance;
+        LayoutSystem::keepOldPaintRect(ctx, ctx.curSystem);
         ctx.curSystem->setPos(ctx.page->lm(), y);
         ctx.curSystem->restoreLayout2();
         ctx.page->appendSystem(ctx.curSystem);
@@ -231,14 +242,13 @@ void LayoutPage::collectPage(const LayoutOptions& options, LayoutContext& ctx)
         }
         if (breakPage) {
             double dist = std::max(ctx.prevSystem->minBottom(), ctx.prevSystem->spacerDistance(false));
-            double footerPadding = 0.0;
             // ensure it doesn't collide with footer
             if (footerExtension > 0) {
                 footerPadding = footerExtension + headerFooterPadding;
                 dist += footerPadding;
             }
             dist = std::max(dist, slb);
-            layoutPage(ctx, ctx.page, endY - (y + dist), footerPadding);
+            restHeight = endY - (y + dist);
             // if we collected a system we cannot fit onto this page,
             // we need to collect next page in order to correctly set system positions
             if (collected) {
@@ -248,26 +258,59 @@ void LayoutPage::collectPage(const LayoutOptions& options, LayoutContext& ctx)
         }
     }
 
-    Fraction stick = Fraction(-1, 1);
-    for (System* s : ctx.page->systems()) {
-        Score* currentScore = ctx.score();
+    // The next page may already be collected while this one is finished.
+    // On incremental layout pages are finished one at a time and in order,
+    // as the old systems reused by collectSystem() may still belong to them.
+    // On full layout all systems are new, so the isolated pages are finished
+    // together; a page that is not isolated waits for all of them.
+    // The worker only gets the score and the page: the slurs and ties are laid out
+    // after the join, as they look up their systems in the list collectSystem() appends to.
+    Page* page = ctx.page;
+    bool isolated = options.pipelinedPageLayout && ctx.curSystem && options.isMode(LayoutMode::PAGE) && isPageIsolated(ctx, page);
+    if (!isolated || !ctx.layoutAll) {
+        waitForPendingPage(ctx);
+    }
+
+    if (isolated) {
+        Score* score = ctx.score();
+        LayoutStatistics* statistics = ctx.statistics;
+        ctx.pendingPageEndTick = page->systems().back()->endTick();
+        ctx.pendingPages.push_back({ page, LayoutContext::workers()->submit([&options, score, statistics, page, restHeight, footerPadding]() {
+                finishPage(options, score, statistics, page, restHeight, footerPadding);
+            }) });
+    } else {
+        finishPage(options, ctx.score(), ctx.statistics, page, restHeight, footerPadding);
+        layoutPageSpanners(ctx.score(), page);
+    }
+}
+
+//---------------------------------------------------------
+//   finishPage
+//    vertical layout of a page whose systems are all collected
+//---------------------------------------------------------
+
+void LayoutPage::finishPage(const LayoutOptions& options, Score* score, LayoutStatistics* statistics, Page* page, double restHeight,
+                            double footerPadding)
+{
+    TRACEFUNC;
+
+    layoutPage(options, score, statistics, page, restHeight, footerPadding);
+
+    for (System* s : page->systems()) {
         for (MeasureBase* mb : s->measures()) {
             if (!mb->isMeasure()) {
                 continue;
             }
             Measure* m = toMeasure(mb);
-            if (stick == Fraction(-1, 1)) {
-                stick = m->tick();
-            }
 
-            for (size_t track = 0; track < currentScore->ntracks(); ++track) {
+            for (size_t track = 0; track < score->ntracks(); ++track) {
                 for (Segment* segment = m->first(); segment; segment = segment->next()) {
                     EngravingItem* e = segment->element(static_cast<int>(track));
                     if (!e) {
                         continue;
                     }
                     if (e->isChordRest()) {
-                        if (!currentScore->staff(track2staff(static_cast<int>(track)))->show()) {
+                        if (!score->staff(track2staff(static_cast<int>(track)))->show()) {
                             continue;
                         }
                         ChordRest* cr = toChordRest(e);
@@ -290,15 +333,8 @@ void LayoutPage::collectPage(const LayoutOptions& options, LayoutContext& ctx)
                                 if (cc->beam() && cc->beam()->elements().front() == cc) {
                                     cc->beam()->layout();
                                 }
-                                cc->layoutSpanners();
-                                for (EngravingItem* element : cc->el()) {
-                                    if (element->isSlur()) {
-                                        element->layout();
-                                    }
-                                }
                             }
                             c->layoutArpeggio2();
-                            c->layoutSpanners();
                             if (c->tremolo()) {
                                 Tremolo* t = c->tremolo();
                                 Chord* c1 = t->chord1();
@@ -318,14 +354,55 @@ void LayoutPage::collectPage(const LayoutOptions& options, LayoutContext& ctx)
     }
 
     if (options.isMode(LayoutMode::SYSTEM)) {
-        System* s = ctx.page->systems().back();
-        double height = s ? s->pos().y() + s->height() + s->minBottom() : ctx.page->tm();
-        ctx.page->bbox().setRect(0.0, 0.0, options.loWidth, height + ctx.page->bm());
+        System* s = page->systems().back();
+        double height = s ? s->pos().y() + s->height() + s->minBottom() : page->tm();
+        page->bbox().setRect(0.0, 0.0, options.loWidth, height + page->bm());
+    }
+}
+
+//---------------------------------------------------------
+//   layoutPageSpanners
+//    the ties, slurs and note spanners of a finished page;
+//    Slur::layout() walks score()->systems(), so this runs
+//    on the layout thread only
+//---------------------------------------------------------
+
+void LayoutPage::layoutPageSpanners(Score* score, Page* page)
+{
+    for (System* s : page->systems()) {
+        for (MeasureBase* mb : s->measures()) {
+            if (!mb->isMeasure()) {
+                continue;
+            }
+            Measure* m = toMeasure(mb);
+
+            for (size_t track = 0; track < score->ntracks(); ++track) {
+                if (!score->staff(track2staff(static_cast<int>(track)))->show()) {
+                    continue;
+                }
+                for (Segment* segment = m->first(SegmentType::ChordRest); segment; segment = segment->next(SegmentType::ChordRest)) {
+                    EngravingItem* e = segment->element(static_cast<int>(track));
+                    if (!e || !e->isChord()) {
+                        continue;
+                    }
+                    Chord* c = toChord(e);
+                    for (Chord* cc : c->graceNotes()) {
+                        cc->layoutSpanners();
+                        for (EngravingItem* element : cc->el()) {
+                            if (element->isSlur()) {
+                                element->layout();
+                            }
+                        }
+                    }
+                    c->layoutSpanners();
+                }
+            }
+        }
     }
 
     // HACK: we relayout here cross-staff slurs because only now the information
     // about staff distances is fully available.
-    for (System* system : ctx.page->systems()) {
+    for (System* system : page->systems()) {
         long int stick = 0;
         long int etick = 0;
         if (system->firstMeasure()) {
@@ -335,7 +412,9 @@ void LayoutPage::collectPage(const LayoutOptions& options, LayoutContext& ctx)
         if (stick == 0 && etick == 0) {
             continue;
         }
-        auto spanners = ctx.score()->spannerMap().findOverlapping(stick, etick);
+        // the query must not use the list shared by the map
+        SpannerMap::IntervalList spanners;
+        score->spannerMap().findOverlapping(stick, etick, spanners);
         for (auto interval : spanners) {
             Spanner* sp = interval.value;
             if (!sp->isSlur()) {
@@ -347,7 +426,108 @@ void LayoutPage::collectPage(const LayoutOptions& options, LayoutContext& ctx)
         }
     }
 
-    ctx.page->invalidateBspTree();
+    page->invalidateBspTree();
+}
+
+//---------------------------------------------------------
+//   isPageIsolated
+//    Check if the page can be finished while the next page
+//    is collected: nothing laid out by finishPage() may reach
+//    into the systems that follow the page. On full layout
+//    several pages are finished together, so nothing may
+//    reach into the systems that precede the page either.
+//---------------------------------------------------------
+
+bool LayoutPage::isPageIsolated(const LayoutContext& ctx, const Page* page)
+{
+    if (page->systems().empty()) {
+        return false;
+    }
+
+    const System* lastSystem = page->systems().back();
+    const Measure* lastMeasure = lastSystem->lastMeasure();
+    if (!lastMeasure) {
+        return false;
+    }
+
+    for (const System* system : page->systems()) {
+        // non-generated dividers are removed via undo
+        const SystemDivider* left = system->systemDividerLeft();
+        const SystemDivider* right = system->systemDividerRight();
+        if ((left && !left->generated()) || (right && !right->generated())) {
+            return false;
+        }
+    }
+
+    const Fraction endTick = lastSystem->endTick();
+    SpannerMap::IntervalList spanners;
+    ctx.score()->spannerMap().findOverlapping(endTick.ticks() - 1, endTick.ticks(), spanners);
+    for (auto interval : spanners) {
+        const Spanner* sp = interval.value;
+        if (sp->tick() < endTick && sp->tick2() >= endTick) {
+            return false;
+        }
+    }
+
+    const Measure* firstMeasure = page->systems().front()->firstMeasure();
+    if (!firstMeasure) {
+        return false;
+    }
+
+    const Fraction startTick = firstMeasure->tick();
+    spanners.clear();
+    ctx.score()->spannerMap().findOverlapping(startTick.ticks(), startTick.ticks() + 1, spanners);
+    for (auto interval : spanners) {
+        const Spanner* sp = interval.value;
+        if (sp->tick() < startTick && sp->tick2() > startTick) {
+            return false;
+        }
+    }
+
+    for (const Segment* seg = lastMeasure->first(SegmentType::ChordRest); seg; seg = seg->next(SegmentType::ChordRest)) {
+        for (const EngravingItem* e : seg->elist()) {
+            if (!e || !e->isChordRest()) {
+                continue;
+            }
+            const ChordRest* cr = toChordRest(e);
+            if (cr->beam() && cr->beam()->elements().back()->tick() >= endTick) {
+                return false;
+            }
+            if (!cr->isChord()) {
+                continue;
+            }
+            const Chord* chord = toChord(cr);
+            std::vector<const Chord*> chords { chord };
+            chords.insert(chords.end(), chord->graceNotes().begin(), chord->graceNotes().end());
+            for (const Chord* c : chords) {
+                for (const Note* note : c->notes()) {
+                    const Tie* tie = note->tieFor();
+                    if (tie && (!tie->endNote() || tie->endNote()->tick() >= endTick)) {
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------
+//   waitForPendingPage
+//---------------------------------------------------------
+
+void LayoutPage::waitForPendingPage(LayoutContext& ctx)
+{
+    for (LayoutContext::PendingPage& pending : ctx.pendingPages) {
+        pending.finished.get();
+    }
+    // in the order of the pages, as on the layout without workers
+    for (LayoutContext::PendingPage& pending : ctx.pendingPages) {
+        layoutPageSpanners(ctx.score(), pending.page);
+    }
+    ctx.pendingPages.clear();
+    ctx.pendingPageEndTick = Fraction(-1, 1);
 }
 
 //---------------------------------------------------------
@@ -358,14 +538,13 @@ void LayoutPage::collectPage(const LayoutOptions& options, LayoutContext& ctx)
 //    systems.
 //---------------------------------------------------------
 
-void LayoutPage::layoutPage(const LayoutContext& ctx, Page* page, double restHeight, double footerPadding)
+void LayoutPage::layoutPage(const LayoutOptions& options, Score* score, LayoutStatistics* statistics, Page* page, double restHeight, double footerPadding)
 {
     if (restHeight < 0.0) {
         LOGN("restHeight < 0.0: %f\n", restHeight);
         restHeight = 0;
     }
 
-    Score* score = ctx.score();
     int gaps     = static_cast<int>(page->systems().size()) - 1;
 
     std::vector<System*> sList;
@@ -378,10 +557,10 @@ void LayoutPage::layoutPage(const LayoutContext& ctx, Page* page, double restHei
         s1->setDistance(s2->y() - s1->y());
         if (s1->vbox() || s2->vbox() || s1->hasFixedDownDistance()) {
             if (s2->vbox()) {
-                checkDivider(ctx, true, s1, 0.0, true);              // remove
-                checkDivider(ctx, false, s1, 0.0, true);             // remove
-                checkDivider(ctx, true, s2, 0.0, true);              // remove
-                checkDivider(ctx, false, s2, 0.0, true);             // remove
+                checkDivider(score, true, s1, 0.0, true);              // remove
+                checkDivider(score, false, s1, 0.0, true);             // remove
+                checkDivider(score, true, s2, 0.0, true);              // remove
+                checkDivider(score, false, s2, 0.0, true);             // remove
             }
             continue;
         }
@@ -390,8 +569,8 @@ void LayoutPage::layoutPage(const LayoutContext& ctx, Page* page, double restHei
 
     // last system needs no divider
     System* lastSystem = page->systems().back();
-    checkDivider(ctx, true, lastSystem, 0.0, true);        // remove
-    checkDivider(ctx, false, lastSystem, 0.0, true);       // remove
+    checkDivider(score, true, lastSystem, 0.0, true);        // remove
+    checkDivider(score, false, lastSystem, 0.0, true);       // remove
 
     if (sList.empty() || MScore::noVerticalStretch || score->enableVerticalSpread() || score->layoutMode() == LayoutMode::SYSTEM) {
         if (score->layoutMode() == LayoutMode::FLOAT) {
@@ -399,8 +578,8 @@ void LayoutPage::layoutPage(const LayoutContext& ctx, Page* page, double restHei
             for (System* system : page->systems()) {
                 system->move(PointF(0.0, y));
             }
-        } else if ((score->layoutMode() != LayoutMode::SYSTEM) && score->enableVerticalSpread()) {
-            distributeStaves(ctx, page, footerPadding);
+        } else if ((score->layoutMode() != LayoutMode::SYSTEM) && score->enableVerticalSpread() && !options.draftLayout) {
+            distributeStaves(score, statistics, page, footerPadding);
         }
 
         // system dividers
@@ -409,8 +588,8 @@ void LayoutPage::layoutPage(const LayoutContext& ctx, Page* page, double restHei
             System* s2 = page->systems().at(i + 1);
             if (!(s1->vbox() || s2->vbox())) {
                 double yOffset = s1->height() + (s1->distance() - s1->height()) * .5;
-                checkDivider(ctx, true,  s1, yOffset);
-                checkDivider(ctx, false, s1, yOffset);
+                checkDivider(score, true,  s1, yOffset);
+                checkDivider(score, false, s1, yOffset);
             }
         }
         return;
@@ -468,17 +647,17 @@ void LayoutPage::layoutPage(const LayoutContext& ctx, Page* page, double restHei
 
         if (!(s1->vbox() || s2->vbox())) {
             double yOffset = s1->height() + (s1->distance() - s1->height()) * .5;
-            checkDivider(ctx, true,  s1, yOffset);
-            checkDivider(ctx, false, s1, yOffset);
+            checkDivider(score, true,  s1, yOffset);
+            checkDivider(score, false, s1, yOffset);
         }
     }
     page->systems().back()->setPosY(y);
 }
 
-void LayoutPage::checkDivider(const LayoutContext& ctx, bool left, System* s, double yOffset, bool remove)
+void LayoutPage::checkDivider(Score* score, bool left, System* s, double yOffset, bool remove)
 {
     SystemDivider* divider = left ? s->systemDividerLeft() : s->systemDividerRight();
-    if ((ctx.score()->styleB(left ? Sid::dividerLeft : Sid::dividerRight)) && !remove) {
+    if ((score->styleB(left ? Sid::dividerLeft : Sid::dividerRight)) && !remove) {
         if (!divider) {
             divider = new SystemDivider(s);
             divider->setDividerType(left ? SystemDivider::Type::LEFT : SystemDivider::Type::RIGHT);
@@ -488,26 +667,26 @@ void LayoutPage::checkDivider(const LayoutContext& ctx, bool left, System* s, do
         divider->layout();
         divider->setPosY(divider->height() * .5 + yOffset);
         if (left) {
-            divider->movePosY(ctx.score()->styleD(Sid::dividerLeftY) * SPATIUM20);
-            divider->setPosX(ctx.score()->styleD(Sid::dividerLeftX) * SPATIUM20);
+            divider->movePosY(score->styleD(Sid::dividerLeftY) * SPATIUM20);
+            divider->setPosX(score->styleD(Sid::dividerLeftX) * SPATIUM20);
         } else {
-            divider->movePosY(ctx.score()->styleD(Sid::dividerRightY) * SPATIUM20);
-            divider->setPosX(ctx.score()->styleD(Sid::pagePrintableWidth) * DPI - divider->width());
-            divider->movePosX(ctx.score()->styleD(Sid::dividerRightX) * SPATIUM20);
+            divider->movePosY(score->styleD(Sid::dividerRightY) * SPATIUM20);
+            divider->setPosX(score->styleD(Sid::pagePrintableWidth) * DPI - divider->width());
+            divider->movePosX(score->styleD(Sid::dividerRightX) * SPATIUM20);
         }
     } else if (divider) {
         if (divider->generated()) {
             s->remove(divider);
             delete divider;
         } else {
-            ctx.score()->undoRemoveElement(divider);
+            score->undoRemoveElement(divider);
         }
     }
 }
 
-void LayoutPage::distributeStaves(const LayoutContext& ctx, Page* page, double footerPadding)
+void LayoutPage::distributeStaves(Score* score, LayoutStatistics* statistics, Page* page, double footerPadding)
 {
-    Score* score = ctx.score();
+    LayoutStatistics::Scope statisticsScope(statistics, LayoutStatistics::Phase::DistributeStaves);
     VerticalGapDataList vgdl;
 
     // Find and classify all gaps between staves.
@@ -521,7 +700,7 @@ void LayoutPage::distributeStaves(const LayoutContext& ctx, Page* page, double f
     bool transferCurlyBracket  { false };
     for (System* system : page->systems()) {
         if (system->vbox()) {
-            VerticalGapData* vgd = new VerticalGapData(&ctx.score()->style(), !ngaps++, system, nullptr, nullptr, nullptr, prevYBottom);
+            VerticalGapData* vgd = new VerticalGapData(&score->style(), !ngaps++, system, nullptr, nullptr, nullptr, prevYBottom);
             vgd->addSpaceAroundVBox(true);
             prevYBottom = system->y();
             yBottom     = system->y() + system->height();
@@ -558,7 +737,7 @@ void LayoutPage::distributeStaves(const LayoutContext& ctx, Page* page, double f
                 }
 
                 VerticalGapData* vgd
-                    = new VerticalGapData(&ctx.score()->style(), !ngaps++, system, staff, sysStaff, nextSpacer, prevYBottom);
+                    = new VerticalGapData(&score->style(), !ngaps++, system, staff, sysStaff, nextSpacer, prevYBottom);
                 nextSpacer = system->downSpacer(staff->idx());
 
                 if (newSystem) {
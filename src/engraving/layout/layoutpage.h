@@ -35,11 +35,17 @@ public:
 
     static void getNextPage(const LayoutOptions& options, LayoutContext& lc);
     static void collectPage(const LayoutOptions& options, LayoutContext& lc);
+    static void waitForPendingPage(LayoutContext& lc);
 
 private:
-    static void layoutPage(const LayoutContext& ctx, Page* page, double restHeight, double footerPadding);
-    static void checkDivider(const LayoutContext& ctx, bool left, System* s, double yOffset, bool remove = false);
-    static void distributeStaves(const LayoutContext& ctx, Page* page, double footerPadding);
+    static void finishPage(const LayoutOptions& options, Score* score, LayoutStatistics* statistics, Page* page, double restHeight,
+                           double footerPadding);
+    static void layoutPageSpanners(Score* score, Page* page);
+    static bool isPageIsolated(const LayoutContext& ctx, const Page* page);
+    static void layoutPage(const LayoutOptions& options, Score* score, LayoutStatistics* statistics, Page* page, double restHeight,
+                           double footerPadding);
+    static void checkDivider(Score* score, bool left, System* s, double yOffset, bool remove = false);
+    static void distributeStaves(Score* score, LayoutStatistics* statistics, Page* page, double footerPadding);
 };
 }
 
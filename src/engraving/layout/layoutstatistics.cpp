@@ -0,0 +1,197 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "layoutstatistics.h"
+
+#include <atomic>
+
+#include "serialization/json.h"
+
+#include "libmscore/measurebase.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+//---------------------------------------------------------
+//   Scope
+//---------------------------------------------------------
+
+LayoutStatistics::Scope::Scope(LayoutStatistics* statistics, Phase phase, const MeasureBase* measure)
+    : m_statistics(statistics), m_phase(phase)
+{
+    if (!m_statistics) {
+        return;
+    }
+    if (measure) {
+        m_measureTick = measure->tick();
+    }
+    m_start = std::chrono::steady_clock::now();
+}
+
+LayoutStatistics::Scope::~Scope()
+{
+    if (!m_statistics) {
+        return;
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start);
+    m_statistics->add(m_phase, elapsed.count(), m_measureTick);
+}
+
+//---------------------------------------------------------
+//   clear
+//---------------------------------------------------------
+
+static std::atomic<int> s_collectingRequests { 0 };
+static std::atomic<uint64_t> s_clearGeneration { 0 };
+
+void LayoutStatistics::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_phases.fill(Entry());
+    m_measures.clear();
+    m_clearGeneration = s_clearGeneration;
+}
+
+//---------------------------------------------------------
+//   requestCollecting
+//---------------------------------------------------------
+
+void LayoutStatistics::requestCollecting()
+{
+    ++s_collectingRequests;
+}
+
+void LayoutStatistics::releaseCollecting()
+{
+    --s_collectingRequests;
+}
+
+bool LayoutStatistics::isCollectingRequested()
+{
+    return s_collectingRequests > 0;
+}
+
+//---------------------------------------------------------
+//   clearAll
+//    the statistics are dropped on their next access
+//---------------------------------------------------------
+
+void LayoutStatistics::clearAll()
+{
+    ++s_clearGeneration;
+}
+
+bool LayoutStatistics::isClearedByAll() const
+{
+    return m_clearGeneration != s_clearGeneration;
+}
+
+//---------------------------------------------------------
+//   add
+//    measureTick: also record the time of the measure starting there (negative: none)
+//---------------------------------------------------------
+
+void LayoutStatistics::add(Phase phase, int64_t nanoseconds, const Fraction& measureTick)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (isClearedByAll()) {
+        m_phases.fill(Entry());
+        m_measures.clear();
+        m_clearGeneration = s_clearGeneration;
+    }
+
+    Entry& e = m_phases[size_t(phase)];
+    ++e.calls;
+    e.nanoseconds += nanoseconds;
+
+    if (!measureTick.negative()) {
+        Entry& m = m_measures[measureTick];
+        ++m.calls;
+        m.nanoseconds += nanoseconds;
+    }
+}
+
+LayoutStatistics::Entry LayoutStatistics::phase(Phase phase) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return isClearedByAll() ? Entry() : m_phases[size_t(phase)];
+}
+
+std::map<Fraction, LayoutStatistics::Entry> LayoutStatistics::measures() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return isClearedByAll() ? std::map<Fraction, Entry>() : m_measures;
+}
+
+//---------------------------------------------------------
+//   phaseName
+//---------------------------------------------------------
+
+const char* LayoutStatistics::phaseName(Phase phase)
+{
+    switch (phase) {
+    case Phase::Layout:               return "layout";
+    case Phase::GetNextMeasure:       return "getNextMeasure";
+    case Phase::CollectSystem:        return "collectSystem";
+    case Phase::LayoutSystemElements: return "layoutSystemElements";
+    case Phase::Beams:                return "beams";
+    case Phase::Lyrics:               return "lyrics";
+    case Phase::Spanners:             return "spanners";
+    case Phase::CollectPage:          return "collectPage";
+    case Phase::DistributeStaves:     return "distributeStaves";
+    case Phase::PhaseCount:           break;
+    }
+    return "";
+}
+
+//---------------------------------------------------------
+//   toJson
+//    times in milliseconds, measures by their start tick
+//---------------------------------------------------------
+
+ByteArray LayoutStatistics::toJson() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const bool cleared = isClearedByAll();
+
+    JsonObject phases;
+    for (size_t i = 0; i < m_phases.size(); ++i) {
+        const Entry e = cleared ? Entry() : m_phases[i];
+        JsonObject entry;
+        entry.set("calls", int(e.calls));
+        entry.set("ms", e.nanoseconds / 1e6);
+        phases.set(phaseName(Phase(i)), entry);
+    }
+
+    JsonArray measures;
+    for (const auto& p : cleared ? std::map<Fraction, Entry>() : m_measures) {
+        JsonObject entry;
+        entry.set("tick", p.first.ticks());
+        entry.set("calls", int(p.second.calls));
+        entry.set("ms", p.second.nanoseconds / 1e6);
+        measures.append(entry);
+    }
+
+    JsonObject root;
+    root.set("phases", phases);
+    root.set("measures", measures);
+    return JsonDocument(root).toJson();
+}
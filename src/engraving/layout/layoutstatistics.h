@@ -0,0 +1,115 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_LAYOUTSTATISTICS_H
+#define MU_ENGRAVING_LAYOUTSTATISTICS_H
+
+#include <array>
+#include <chrono>
+#include <map>
+#include <mutex>
+
+#include "types/bytearray.h"
+#include "types/fraction.h"
+
+namespace mu::engraving {
+class MeasureBase;
+
+//---------------------------------------------------------
+//   LayoutStatistics
+//    wall time and number of calls of the layout phases,
+//    collected only with LayoutOptions::collectStatistics
+//    or while collecting is requested for all the scores
+//---------------------------------------------------------
+
+class LayoutStatistics
+{
+public:
+    enum class Phase {
+        Layout,
+        GetNextMeasure,
+        CollectSystem,
+        LayoutSystemElements,
+        Beams,
+        Lyrics,
+        Spanners,
+        CollectPage,
+        DistributeStaves,
+
+        PhaseCount
+    };
+
+    struct Entry {
+        size_t calls = 0;
+        int64_t nanoseconds = 0;
+    };
+
+    //---------------------------------------------------------
+    //   Scope
+    //    records the time until the end of the scope,
+    //    does nothing without statistics
+    //---------------------------------------------------------
+
+    class Scope
+    {
+    public:
+        Scope(LayoutStatistics* statistics, Phase phase, const MeasureBase* measure = nullptr);
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        LayoutStatistics* m_statistics = nullptr;
+        Phase m_phase = Phase::Layout;
+        Fraction m_measureTick { -1, 1 };
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    void clear();
+
+    //! NOTE For the diagnostic tools: the layouts of all the scores collect the statistics
+    //! while at least one request is held, clearAll() resets the statistics of all the scores
+    static void requestCollecting();
+    static void releaseCollecting();
+    static bool isCollectingRequested();
+    static void clearAll();
+
+    void add(Phase phase, int64_t nanoseconds, const Fraction& measureTick = Fraction(-1, 1));
+
+    Entry phase(Phase phase) const;
+    std::map<Fraction, Entry> measures() const;
+
+    static const char* phaseName(Phase phase);
+
+    ByteArray toJson() const;
+
+private:
+    bool isClearedByAll() const;
+
+    mutable std::mutex m_mutex;     // pages are finished on workers, see LayoutPage::collectPage
+    uint64_t m_clearGeneration = 0; // see clearAll()
+    std::array<Entry, size_t(Phase::PhaseCount)> m_phases;
+    std::map<Fraction, Entry> m_measures;
+};
+}
+
+#endif // MU_ENGRAVING_LAYOUTSTATISTICS_H
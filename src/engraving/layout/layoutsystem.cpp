@@ -21,6 +21,11 @@
  */
 #include "layoutsystem.h"
 
+#include <algorithm>
+
+#include "containers.h"
+#include "realfn.h"
+
 #include "libmscore/barline.h"
 #include "libmscore/beam.h"
 #include "libmscore/box.h"
@@ -33,6 +38,7 @@
 #include "libmscore/measurenumber.h"
 #include "libmscore/mmrestrange.h"
 #include "libmscore/note.h"
+#include "libmscore/page.h"
 #include "libmscore/part.h"
 #include "libmscore/score.h"
 #include "libmscore/slur.h"
@@ -49,6 +55,9 @@
 #include "layoutharmonies.h"
 #include "layoutlyrics.h"
 #include "layoutmeasure.h"
+#include "layoutpage.h"
+#include "layoutsystembreaks.h"
+#include "layoutstatistics.h"
 #include "layouttuplets.h"
 
 #include "log.h"
@@ -66,6 +75,7 @@ System* LayoutSystem::collectSystem(const LayoutOptions& options, LayoutContext&
     if (!ctx.curMeasure) {
         return nullptr;
     }
+    LayoutStatistics::Scope statisticsScope(ctx.statistics, LayoutStatistics::Phase::CollectSystem);
 
     const MeasureBase* measure  = score->systems().empty() ? 0 : score->systems().back()->measures().back();
     if (measure) {
@@ -109,7 +119,10 @@ System* LayoutSystem::collectSystem(const LayoutOptions& options, LayoutContext&
     while (ctx.curMeasure) {      // collect measure for system
         oldSystem = ctx.curMeasure->system();
         system->appendMeasure(ctx.curMeasure);
-        if (system->hasCrossStaffOrModifiedBeams()) {
+        if (ctx.curMeasure->isMeasure()) {
+            collectCrossBeamChordRests(toMeasure(ctx.curMeasure));
+        }
+        if (hasCrossStaffOrModifiedBeams(system)) {
             updateCrossBeams(system, ctx);
         }
         double ww  = 0.0; // width of current measure
@@ -144,7 +157,7 @@ System* LayoutSystem::collectSystem(const LayoutOptions& options, LayoutContext&
                     if (mb->isMeasure()) {
                         Measure* mm = toMeasure(mb);
                         double prevWidth = mm->width();
-                        mm->computeWidth(minTicks, maxTicks, 1);
+                        LayoutMeasure::computeWidth(ctx, mm, minTicks, maxTicks, 1);
                         double newWidth = mm->width();
                         curSysWidth += newWidth - prevWidth;
                     }
@@ -154,7 +167,7 @@ System* LayoutSystem::collectSystem(const LayoutOptions& options, LayoutContext&
             if (firstMeasure) {
                 layoutSystemMinWidth = curSysWidth;
                 system->layoutSystem(ctx, curSysWidth, ctx.firstSystem, ctx.firstSystemIndent);
-                if (system->hasCrossStaffOrModifiedBeams()) {
+                if (hasCrossStaffOrModifiedBeams(system)) {
                     updateCrossBeams(system, ctx);
                 }
                 curSysWidth += system->leftMargin();
@@ -165,6 +178,9 @@ System* LayoutSystem::collectSystem(const LayoutOptions& options, LayoutContext&
                     }
                 }
                 m->addSystemHeader(ctx.firstSystem);
+                if (options.optimalSystemBreaks && !mu::contains(ctx.plannedSystemStarts, static_cast<const MeasureBase*>(m))) {
+                    LayoutSystemBreaks::planSystems(options, ctx, system, curSysWidth);
+                }
                 firstMeasure = false;
                 createHeader = false;
             } else {
@@ -184,7 +200,7 @@ System* LayoutSystem::collectSystem(const LayoutOptions& options, LayoutContext&
             } else {
                 m->addSystemTrailer(m->nextMeasure());
             }
-            m->computeWidth(minTicks, maxTicks, 1);
+            LayoutMeasure::computeWidth(ctx, m, minTicks, maxTicks, 1);
             ww = m->width();
         } else if (ctx.curMeasure->isHBox()) {
             ctx.curMeasure->computeMinWidth();
@@ -201,6 +217,10 @@ System* LayoutSystem::collectSystem(const LayoutOptions& options, LayoutContext&
         // collect at least one measure and the break
         double acceptanceRange = squeezability * system->squeezableSpace();
         bool doBreak = (system->measures().size() > 1) && ((curSysWidth + ww) > targetSystemWidth + acceptanceRange);
+        if (options.optimalSystemBreaks && system->measures().size() > 1
+            && mu::contains(ctx.plannedSystemStarts, static_cast<const MeasureBase*>(ctx.curMeasure))) {
+            doBreak = true;
+        }
         /* acceptanceRange allows some systems to be initially slightly larger than the margins and be
          * justified by squeezing instead of stretching. Allows to make much better choices of how many
          * measures to fit per system. */
@@ -235,7 +255,7 @@ System* LayoutSystem::collectSystem(const LayoutOptions& options, LayoutContext&
                 for (MeasureBase* mb : system->measures()) {
                     if (mb->isMeasure()) {
                         double prevWidth = toMeasure(mb)->width();
-                        toMeasure(mb)->computeWidth(minTicks, maxTicks, 1);
+                        LayoutMeasure::computeWidth(ctx, toMeasure(mb), minTicks, maxTicks, 1);
                         double newWidth = toMeasure(mb)->width();
                         curSysWidth += newWidth - prevWidth;
                     }
@@ -269,7 +289,7 @@ System* LayoutSystem::collectSystem(const LayoutOptions& options, LayoutContext&
                     Segment* s = m1->findSegmentR(SegmentType::StartRepeatBarLine, Fraction(0, 1));
                     if (!s->enabled()) {
                         s->setEnabled(true);
-                        m1->computeWidth(minTicks, maxTicks, 1);
+                        LayoutMeasure::computeWidth(ctx, m1, minTicks, maxTicks, 1);
                         ww = m1->width();
                     }
                 }
@@ -339,8 +359,11 @@ System* LayoutSystem::collectSystem(const LayoutOptions& options, LayoutContext&
     if (ctx.endTick < ctx.prevMeasure->tick()) {
         // we've processed the entire range
         // but we need to continue layout until we reach a system whose last measure is the same as previous layout
-        if (ctx.prevMeasure == ctx.systemOldMeasure) {
+        // with optimal system breaks, the planned systems depend on each other
+        bool canConverge = !options.optimalSystemBreaks || ctx.prevMeasure == ctx.plannedSystemsEnd;
+        if (canConverge && (ctx.prevMeasure == ctx.systemOldMeasure || skipSupersededSystems(ctx))) {
             // this system ends in the same place as the previous layout
+            // (or as one of the following systems of the previous layout)
             // ok to stop
             if (ctx.curMeasure && ctx.curMeasure->isMeasure()) {
                 // we may have previously processed first measure(s) of next system
@@ -367,7 +390,7 @@ System* LayoutSystem::collectSystem(const LayoutOptions& options, LayoutContext&
                     } else {
                         m->removeSystemTrailer();
                     }
-                    m->computeWidth(m->system()->minSysTicks(), m->system()->maxSysTicks(), oldStretch);
+                    LayoutMeasure::computeWidth(ctx, m, m->system()->minSysTicks(), m->system()->maxSysTicks(), oldStretch);
                     m->stretchToTargetWidth(oldWidth);
                     m->layoutMeasureElements();
                     LayoutBeams::restoreBeams(m);
@@ -395,7 +418,7 @@ System* LayoutSystem::collectSystem(const LayoutOptions& options, LayoutContext&
     }
 
     // hide empty staves
-    hideEmptyStaves(score, system, ctx.firstSystem);
+    hideEmptyStaves(ctx, score, system, ctx.firstSystem);
     // Relayout system to account for newly hidden/unhidden staves
     curSysWidth -= system->leftMargin();
     system->layoutSystem(ctx, layoutSystemMinWidth, ctx.firstSystem, ctx.firstSystemIndent);
@@ -420,7 +443,7 @@ System* LayoutSystem::collectSystem(const LayoutOptions& options, LayoutContext&
         }
         Measure* m = toMeasure(mb);
         double oldWidth = m->width();
-        m->computeWidth(minTicks, maxTicks, preStretch);
+        LayoutMeasure::computeWidth(ctx, m, minTicks, maxTicks, preStretch);
         curSysWidth += m->width() - oldWidth;
     }
 
@@ -485,6 +508,11 @@ System* LayoutSystem::collectSystem(const LayoutOptions& options, LayoutContext&
     }
 
     if (oldSystem) {
+        // The old system may share measures with the page that is being finished
+        if (!ctx.pendingPageEndTick.negative()
+            && (oldSystem->measures().empty() || oldSystem->measures().front()->tick() < ctx.pendingPageEndTick)) {
+            LayoutPage::waitForPendingPage(ctx);
+        }
         // We may have previously processed the ties of the next system (in LayoutChords::updateLineAttachPoints()).
         // We need to restore them to the correct state.
         LayoutSystem::restoreTies(oldSystem);
@@ -493,6 +521,83 @@ System* LayoutSystem::collectSystem(const LayoutOptions& options, LayoutContext&
     return system;
 }
 
+//---------------------------------------------------------
+//   skipSupersededSystems
+//    Called once the layout range has been processed.
+//    Re-collected systems may have taken measures from the
+//    following systems of the previous layout. If the current
+//    system ends where one of them ended, layout has converged:
+//    the systems in between are superseded and the remaining
+//    ones can be reused unchanged.
+//---------------------------------------------------------
+
+bool LayoutSystem::skipSupersededSystems(LayoutContext& ctx)
+{
+    auto converged = std::find_if(ctx.systemList.begin(), ctx.systemList.end(), [&ctx](const System* s) {
+        return !s->measures().empty() && s->measures().back() == ctx.prevMeasure;
+    });
+    if (converged == ctx.systemList.end()) {
+        return false;
+    }
+
+    ++converged;
+    for (auto it = ctx.systemList.begin(); it != converged; ++it) {
+        System* s = *it;
+        keepOldPaintRect(ctx, s);
+        // detach from page, the system must not be kept by LayoutPage::getNextPage
+        s->resetExplicitParent();
+        ctx.supersededSystems.push_back(s);
+    }
+    ctx.systemList.erase(ctx.systemList.begin(), converged);
+
+    return true;
+}
+
+//---------------------------------------------------------
+//   paintRect
+//    canvas area which may be painted by the elements of the system
+//---------------------------------------------------------
+
+mu::RectF LayoutSystem::paintRect(const System* system)
+{
+    //! NOTE The autoplaced elements above and below the staves are in their skylines,
+    //! the margin is for the other ones placed near the system
+    static constexpr double PAINT_MARGIN = 4.0;
+
+    RectF rect = system->canvasBoundingRect();
+    double margin = PAINT_MARGIN * system->spatium();
+    double top = system->vbox() ? 0.0 : std::max(system->minTop(), 0.0);
+    double bottom = system->vbox() ? 0.0 : std::max(system->minBottom(), 0.0);
+    rect.adjust(-margin, -top - margin, margin, bottom + margin);
+
+    // the instrument names and the brackets are in the page margin
+    const Page* page = system->page();
+    if (page) {
+        RectF pageRect = page->canvasBoundingRect();
+        rect.setLeft(std::min(rect.left(), pageRect.left()));
+        rect.setRight(std::max(rect.right(), pageRect.right()));
+    }
+
+    return rect;
+}
+
+//---------------------------------------------------------
+//   keepOldPaintRect
+//    record the paint rect of a system of the previous layout
+//    before it is laid out or positioned again
+//---------------------------------------------------------
+
+void LayoutSystem::keepOldPaintRect(LayoutContext& ctx, const System* system)
+{
+    // new systems are still in the dummy page
+    const Page* page = system->page();
+    if (!page || page == ctx.score()->dummy()->page() || mu::contains(ctx.oldSystemRects, system)) {
+        return;
+    }
+
+    ctx.oldSystemRects.emplace(system, paintRect(system));
+}
+
 void LayoutSystem::justifySystem(System* system, double curSysWidth, double targetSystemWidth)
 {
     double rest = targetSystemWidth - curSysWidth;
@@ -545,10 +650,12 @@ System* LayoutSystem::getNextSystem(LayoutContext& ctx)
         ctx.systemOldMeasure = 0;
     } else {
         system = mu::takeFirst(ctx.systemList);
+        keepOldPaintRect(ctx, system);
         ctx.systemOldMeasure = system->measures().empty() ? 0 : system->measures().back();
         system->clear();       // remove measures from system
     }
     score->systems().push_back(system);
+    ctx.relaidSystems.insert(system);
     if (!isVBox) {
         size_t nstaves = score->Score::nstaves();
         system->adjustStavesNumber(nstaves);
@@ -559,12 +666,64 @@ System* LayoutSystem::getNextSystem(LayoutContext& ctx)
     return system;
 }
 
-void LayoutSystem::hideEmptyStaves(Score* score, System* system, bool isFirstSystem)
+//---------------------------------------------------------
+//   staffContent
+//    content of the staves of the measure, computed again only
+//    for measures in the range changed since the previous layout
+//---------------------------------------------------------
+
+static const Measure::StaffContent& staffContent(const LayoutContext& ctx, Measure* m)
+{
+    const Measure::StaffContent& content = m->staffContent();
+    size_t staves = m->score()->nstaves();
+    bool changed = m->tick() <= ctx.changedEndTick && m->endTick() >= ctx.changedStartTick;
+    if (content.known && !changed && content.empty.size() == staves) {
+        return content;
+    }
+
+    Measure::StaffContent newContent;
+    newContent.known = true;
+    newContent.empty.resize(staves);
+    newContent.movedInto.resize(staves, false);
+    for (staff_idx_t staffIdx = 0; staffIdx < staves; ++staffIdx) {
+        newContent.empty[staffIdx] = m->isEmpty(staffIdx);
+    }
+    for (Segment* s = m->first(SegmentType::ChordRest); s; s = s->next(SegmentType::ChordRest)) {
+        for (track_idx_t track = 0; track < staves * VOICES; ++track) {
+            ChordRest* cr = s->cr(track);
+            if (!cr || cr->isRest() || cr->staffMove() == 0) {
+                continue;
+            }
+            staff_idx_t movedIdx = track2staff(track) + cr->staffMove();
+            if (movedIdx < staves) {
+                newContent.movedInto[movedIdx] = true;
+            }
+        }
+    }
+    m->setStaffContent(std::move(newContent));
+    return m->staffContent();
+}
+
+void LayoutSystem::hideEmptyStaves(const LayoutContext& ctx, Score* score, System* system, bool isFirstSystem)
 {
     size_t staves = score->nstaves();
     staff_idx_t staffIdx = 0;
     bool systemIsEmpty = true;
 
+    // staves empty in all measures of the system, staves that chords are moved into in any of them
+    std::vector<bool> emptyStaves(staves, true);
+    std::vector<bool> movedIntoStaves(staves, false);
+    for (MeasureBase* mb : system->measures()) {
+        if (!mb->isMeasure()) {
+            continue;
+        }
+        const Measure::StaffContent& content = staffContent(ctx, toMeasure(mb));
+        for (staff_idx_t i = 0; i < staves; ++i) {
+            emptyStaves[i] = emptyStaves[i] && content.empty[i];
+            movedIntoStaves[i] = movedIntoStaves[i] || content.movedInto[i];
+        }
+    }
+
     for (Staff* staff : score->staves()) {
         SysStaff* ss  = system->staff(staffIdx);
 
@@ -575,54 +734,20 @@ void LayoutSystem::hideEmptyStaves(Score* score, System* system, bool isFirstSys
                 && (staves > 1)
                 && !(isFirstSystem && score->styleB(Sid::dontHideStavesInFirstSystem))
                 && hideMode != Staff::HideMode::NEVER)) {
-            bool hideStaff = true;
-            for (MeasureBase* m : system->measures()) {
-                if (!m->isMeasure()) {
-                    continue;
-                }
-                Measure* measure = toMeasure(m);
-                if (!measure->isEmpty(staffIdx)) {
-                    hideStaff = false;
-                    break;
-                }
-            }
+            bool hideStaff = emptyStaves[staffIdx];
             // check if notes moved into this staff
             Part* part = staff->part();
             const size_t n = part->nstaves();
             if (hideStaff && (n > 1)) {
-                staff_idx_t idx = part->staves().front()->idx();
-                for (staff_idx_t i = 0; i < n; ++i) {
-                    staff_idx_t st = idx + i;
-
-                    for (MeasureBase* mb : system->measures()) {
-                        if (!mb->isMeasure()) {
-                            continue;
-                        }
-                        Measure* m = toMeasure(mb);
-                        if (staff->hideWhenEmpty() == Staff::HideMode::INSTRUMENT && !m->isEmpty(st)) {
+                // the case staffMove == 0 has already been checked by Measure::isEmpty()
+                hideStaff = !movedIntoStaves[staffIdx];
+                if (hideStaff && staff->hideWhenEmpty() == Staff::HideMode::INSTRUMENT) {
+                    staff_idx_t idx = part->staves().front()->idx();
+                    for (staff_idx_t i = 0; i < n; ++i) {
+                        if (!emptyStaves[idx + i]) {
                             hideStaff = false;
                             break;
                         }
-                        for (Segment* s = m->first(SegmentType::ChordRest); s; s = s->next(SegmentType::ChordRest)) {
-                            for (voice_idx_t voice = 0; voice < VOICES; ++voice) {
-                                ChordRest* cr = s->cr(st * VOICES + voice);
-                                int staffMove = cr ? cr->staffMove() : 0;
-                                if (!cr || cr->isRest() || cr->staffMove() == 0) {
-                                    // The case staffMove == 0 has already been checked by measure->isEmpty()
-                                    continue;
-                                }
-                                if (staffIdx == st + staffMove) {
-                                    hideStaff = false;
-                                    break;
-                                }
-                            }
-                        }
-                        if (!hideStaff) {
-                            break;
-                        }
-                    }
-                    if (!hideStaff) {
-                        break;
                     }
                 }
             }
@@ -673,6 +798,7 @@ void LayoutSystem::layoutSystemElements(const LayoutOptions& options, LayoutCont
     if (score->noStaves()) {
         return;
     }
+    LayoutStatistics::Scope statisticsScope(lc.statistics, LayoutStatistics::Phase::LayoutSystemElements);
 
     //-------------------------------------------------------------
     //    create cr segment list to speed up computations
@@ -705,13 +831,16 @@ void LayoutSystem::layoutSystemElements(const LayoutOptions& options, LayoutCont
     //  may change.
     //-------------------------------------------------------------
 
-    for (Segment* s : sl) {
-        if (!s->isChordRestType()) {
-            continue;
+    {
+        LayoutStatistics::Scope beamsScope(lc.statistics, LayoutStatistics::Phase::Beams);
+        for (Segment* s : sl) {
+            if (!s->isChordRestType()) {
+                continue;
+            }
+            LayoutBeams::layoutNonCrossBeams(s);
+            // Must recreate the shapes because stem lengths may have been changed!
+            s->createShapes();
         }
-        LayoutBeams::layoutNonCrossBeams(s);
-        // Must recreate the shapes because stem lengths may have been changed!
-        s->createShapes();
     }
 
     //-------------------------------------------------------------
@@ -962,7 +1091,10 @@ void LayoutSystem::layoutSystemElements(const LayoutOptions& options, LayoutCont
             }
         }
     }
-    processLines(system, spanner, false);
+    {
+        LayoutStatistics::Scope spannersScope(lc.statistics, LayoutStatistics::Phase::Spanners);
+        processLines(system, spanner, false);
+    }
     for (auto s : spanner) {
         Slur* slur = toSlur(s);
         ChordRest* scr = s->startCR();
@@ -1055,16 +1187,22 @@ void LayoutSystem::layoutSystemElements(const LayoutOptions& options, LayoutCont
             }
         }
     }
-    processLines(system, hairpins, false);
-    processLines(system, spanner, false);
-    processLines(system, ottavas, false);
-    processLines(system, pedal,   true);
+    {
+        LayoutStatistics::Scope spannersScope(lc.statistics, LayoutStatistics::Phase::Spanners);
+        processLines(system, hairpins, false);
+        processLines(system, spanner, false);
+        processLines(system, ottavas, false);
+        processLines(system, pedal,   true);
+    }
 
     //-------------------------------------------------------------
     // Lyric
     //-------------------------------------------------------------
 
-    LayoutLyrics::layoutLyrics(options, score, system);
+    {
+        LayoutStatistics::Scope lyricsScope(lc.statistics, LayoutStatistics::Phase::Lyrics);
+        LayoutLyrics::layoutLyrics(options, score, system);
+    }
 
     // here are lyrics dashes and melisma
     for (Spanner* sp : score->unmanagedSpanners()) {
@@ -1432,11 +1570,68 @@ void LayoutSystem::layoutTies(Chord* ch, System* system, const Fraction& stick)
     }
 }
 
+//---------------------------------------------------------
+//   collectCrossBeamChordRests
+//    Index the chords and rests of the measure (grace chords included)
+//    whose beam is cross-staff or user-modified, or may still become
+//    cross-staff when it is completed in a following measure, so that
+//    updateCrossBeams() doesn't walk all the segments of the system
+//    every time a measure is added.
+//---------------------------------------------------------
+
+void LayoutSystem::collectCrossBeamChordRests(Measure* measure)
+{
+    auto needsUpdate = [measure](const ChordRest* cr) {
+        const Beam* beam = cr->beam();
+        return beam && (beam->cross() || beam->userModified() || beam->elements().back()->measure() != measure);
+    };
+
+    std::vector<ChordRest*> chordRests;
+    for (Segment& seg : measure->segments()) {
+        if (!seg.isChordRestType()) {
+            continue;
+        }
+        for (EngravingItem* e : seg.elist()) {
+            if (!e || !e->isChordRest()) {
+                continue;
+            }
+            ChordRest* cr = toChordRest(e);
+            if (cr->isChord()) {
+                for (Chord* grace : toChord(cr)->graceNotes()) {
+                    if (needsUpdate(grace)) {
+                        chordRests.push_back(grace);
+                    }
+                }
+            }
+            if (needsUpdate(cr)) {
+                chordRests.push_back(cr);
+            }
+        }
+    }
+    measure->setCrossBeamChordRests(std::move(chordRests));
+}
+
+bool LayoutSystem::hasCrossStaffOrModifiedBeams(const System* system)
+{
+    for (const MeasureBase* mb : system->measures()) {
+        if (!mb->isMeasure()) {
+            continue;
+        }
+        for (const ChordRest* cr : toMeasure(mb)->crossBeamChordRests()) {
+            if (cr->beam() && (cr->beam()->cross() || cr->beam()->userModified())) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 /****************************************************************************
  * updateCrossBeams
  * Performs a pre-calculation of staff distances (final staff distances will
  * be calculated at the very end of layout) and updates the up() property
  * of cross-beam chords accordingly.
+ * Only the chords indexed by collectCrossBeamChordRests() are visited.
  * *************************************************************************/
 
 void LayoutSystem::updateCrossBeams(System* system, const LayoutContext& ctx)
@@ -1447,19 +1642,12 @@ void LayoutSystem::updateCrossBeams(System* system, const LayoutContext& ctx)
         if (!mb->isMeasure()) {
             continue;
         }
-        for (Segment& seg : toMeasure(mb)->segments()) {
-            if (!seg.isChordRestType()) {
+        for (ChordRest* cr : toMeasure(mb)->crossBeamChordRests()) {
+            if (!cr->isGrace()) {
                 continue;
             }
-            for (EngravingItem* e : seg.elist()) {
-                if (!e || !e->isChord()) {
-                    continue;
-                }
-                for (Chord* grace : toChord(e)->graceNotes()) {
-                    if (grace->beam() && (grace->beam()->cross() || grace->beam()->userModified())) {
-                        grace->computeUp();
-                    }
-                }
+            if (cr->beam() && (cr->beam()->cross() || cr->beam()->userModified())) {
+                cr->computeUp();
             }
         }
     }
@@ -1468,20 +1656,19 @@ void LayoutSystem::updateCrossBeams(System* system, const LayoutContext& ctx)
         if (!mb->isMeasure()) {
             continue;
         }
-        for (Segment& seg : toMeasure(mb)->segments()) {
-            for (EngravingItem* e : seg.elist()) {
-                if (!e || !e->isChord()) {
-                    continue;
-                }
-                Chord* chord = toChord(e);
-                if (chord->beam() && (chord->beam()->cross() || chord->beam()->userModified())) {
-                    bool prevUp = chord->up();
-                    chord->computeUp();
-                    if (chord->up() != prevUp) {
-                        // If the chord has changed direction needs to be re-laid out
-                        LayoutChords::layoutChords1(chord->score(), &seg, chord->vStaffIdx());
-                        seg.createShape(chord->vStaffIdx());
-                    }
+        for (ChordRest* cr : toMeasure(mb)->crossBeamChordRests()) {
+            if (!cr->isChord() || cr->isGrace()) {
+                continue;
+            }
+            Chord* chord = toChord(cr);
+            if (chord->beam() && (chord->beam()->cross() || chord->beam()->userModified())) {
+                bool prevUp = chord->up();
+                chord->computeUp();
+                if (chord->up() != prevUp) {
+                    // If the chord has changed direction needs to be re-laid out
+                    Segment* seg = chord->segment();
+                    LayoutChords::layoutChords1(chord->score(), seg, chord->vStaffIdx());
+                    seg->createShape(chord->vStaffIdx());
                 }
             }
         }
@@ -29,6 +29,7 @@
 
 namespace mu::engraving {
 class Chord;
+class Measure;
 class Score;
 class Segment;
 class Spanner;
@@ -40,15 +41,21 @@ public:
     static System* collectSystem(const LayoutOptions& options, LayoutContext& lc, Score* score);
     static void layoutSystemElements(const LayoutOptions& options, LayoutContext& lc, Score* score, System* system);
 
+    static RectF paintRect(const System* system);
+    static void keepOldPaintRect(LayoutContext& ctx, const System* system);
+
 private:
     static System* getNextSystem(LayoutContext& lc);
-    static void hideEmptyStaves(Score* score, System* system, bool isFirstSystem);
+    static void hideEmptyStaves(const LayoutContext& ctx, Score* score, System* system, bool isFirstSystem);
     static void processLines(System* system, std::vector<Spanner*> lines, bool align);
     static void layoutTies(Chord* ch, System* system, const Fraction& stick);
     static void doLayoutTies(System* system, std::vector<Segment*> sl, const Fraction& stick, const Fraction& etick);
     static void justifySystem(System* system, double curSysWidth, double targetSystemWidth);
+    static void collectCrossBeamChordRests(Measure* measure);
+    static bool hasCrossStaffOrModifiedBeams(const System* system);
     static void updateCrossBeams(System* system, const LayoutContext& ctx);
     static void restoreTies(System* system);
+    static bool skipSupersededSystems(LayoutContext& ctx);
 };
 }
 
@@ -0,0 +1,253 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "layoutsystembreaks.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "libmscore/box.h"
+#include "libmscore/measure.h"
+#include "libmscore/score.h"
+#include "libmscore/system.h"
+
+#include "layoutmeasure.h"
+
+#include "log.h"
+
+using namespace mu::engraving;
+
+// demerits of a system are (LINE_PENALTY + badness)^2, the penalty prefers fewer systems
+static constexpr double LINE_PENALTY = 1.0;
+static constexpr double MAX_BADNESS = 100.0;
+
+//---------------------------------------------------------
+//   planSystems
+//    ctx.curMeasure is the first measure of the system,
+//    with the system header already added. The following
+//    measures of the paragraph are prepared on a scratch
+//    context; the systems are collected from the prepared
+//    measures, they are not processed again.
+//---------------------------------------------------------
+
+void LayoutSystemBreaks::planSystems(const LayoutOptions& options, LayoutContext& ctx, System* system, double leftMargin)
+{
+    TRACEFUNC;
+
+    Score* score = ctx.score();
+    Measure* first = toMeasure(ctx.curMeasure);
+
+    // width of the system header, estimated from the first measure
+    LayoutMeasure::computeWidth(ctx, first, first->shortestChordRest(), first->maxTicks(), 1);
+    double headerWidth = first->width();
+    first->removeSystemHeader();
+    LayoutMeasure::computeWidth(ctx, first, first->shortestChordRest(), first->maxTicks(), 1);
+    headerWidth -= first->width();
+    first->addSystemHeader(ctx.firstSystem);
+
+    LayoutContext sc(score);
+    sc.notifyOnDestroy = false;
+    sc.prevMeasure = ctx.prevMeasure;
+    sc.curMeasure = ctx.curMeasure;
+    sc.nextMeasure = ctx.nextMeasure;
+    sc.tick = ctx.tick;
+    sc.measureNo = ctx.measureNo;
+    sc.startTick = ctx.startTick;
+    sc.endTick = ctx.endTick;
+    sc.widthCache = ctx.widthCache;
+    sc.statistics = ctx.statistics;
+    sc.changedStartTick = ctx.changedStartTick;
+    sc.changedEndTick = ctx.changedEndTick;
+    sc.shownStavesKey = ctx.shownStavesKey;
+
+    ctx.preparedMeasures.clear();
+
+    std::vector<Item> items;
+    std::vector<MeasureBase*> measures;
+    std::vector<System*> oldSystems;
+    bool lastIsFinal = true;
+
+    while (sc.curMeasure) {
+        MeasureBase* mb = sc.curMeasure;
+        if (mb->isVBox() || mb->isTBox() || mb->isFBox()) {
+            break;
+        }
+        if (items.size() >= MAX_PARAGRAPH_MEASURES) {
+            lastIsFinal = false;
+            break;
+        }
+
+        // computeWidth needs the measure to be part of the system
+        if (mb != first) {
+            oldSystems.push_back(mb->system());
+            system->appendMeasure(mb);
+        }
+
+        Item item;
+        if (mb->isMeasure()) {
+            Measure* m = toMeasure(mb);
+            if (m != first) {
+                LayoutMeasure::computePreSpacingItems(m);
+                if (m->header()) {
+                    m->removeSystemHeader();
+                }
+            }
+            if (m->trailer()) {
+                m->removeSystemTrailer();
+            }
+            LayoutMeasure::computeWidth(ctx, m, m->shortestChordRest(), m->maxTicks(), 1);
+            item.width = m->width() - (m == first ? headerWidth : 0.0);
+            item.squeezable = m->squeezableSpace();
+        } else if (mb->isHBox()) {
+            mb->computeMinWidth();
+            item.width = mb->width();
+        }
+        item.noBreak = mb->noBreak();
+        items.push_back(item);
+        measures.push_back(mb);
+
+        bool forcedBreak = mb->pageBreak() || mb->lineBreak() || mb->sectionBreak();
+        if (forcedBreak && (options.isMode(LayoutMode::PAGE) || options.isMode(LayoutMode::SYSTEM))) {
+            break;
+        }
+
+        LayoutContext::PreparedMeasure prepared;
+        prepared.nextMeasure = sc.nextMeasure;
+        prepared.tick = sc.tick;
+        LayoutMeasure::getNextMeasure(options, sc);
+        prepared.preparedCurMeasure = sc.curMeasure;
+        prepared.preparedNextMeasure = sc.nextMeasure;
+        prepared.preparedTick = sc.tick;
+        prepared.preparedMeasureNo = sc.measureNo;
+        ctx.preparedMeasures[mb] = prepared;
+    }
+
+    // give the measures back to the systems of the previous layout
+    for (auto it = oldSystems.rbegin(); it != oldSystems.rend(); ++it) {
+        MeasureBase* mb = system->measures().back();
+        system->removeLastMeasure();
+        mb->setParent(*it);
+    }
+
+    Params params;
+    params.systemWidth = score->styleD(Sid::pagePrintableWidth) * DPI - leftMargin;
+    params.headerWidth = headerWidth;
+    params.squeezability = 0.3;
+    params.lastSystemFillLimit = score->styleD(Sid::lastSystemFillLimit);
+    params.lastIsFinal = lastIsFinal;
+
+    std::vector<size_t> starts = computeBreaks(items, params);
+
+    ctx.plannedSystemStarts.clear();
+    for (size_t idx : starts) {
+        ctx.plannedSystemStarts.insert(measures.at(idx));
+    }
+    // a paragraph cut at MAX_PARAGRAPH_MEASURES is planned again from the start of its last system
+    size_t lastPlanned = lastIsFinal || starts.size() < 2 ? measures.size() - 1 : starts.back() - 1;
+    ctx.plannedSystemsEnd = measures.at(lastPlanned);
+    ctx.plannedParagraphStarts.push_back(first->tick());
+}
+
+//---------------------------------------------------------
+//   computeBreaks
+//    dynamic programming over the possible system starts,
+//    the cost of the search is bounded by the number of
+//    measures that can fit into one system
+//---------------------------------------------------------
+
+std::vector<size_t> LayoutSystemBreaks::computeBreaks(const std::vector<Item>& items, const Params& params)
+{
+    TRACEFUNC;
+
+    const size_t n = items.size();
+    if (n == 0) {
+        return {};
+    }
+
+    constexpr double INF = std::numeric_limits<double>::infinity();
+    std::vector<double> demerits(n + 1, INF);
+    std::vector<size_t> prevStart(n + 1, 0);
+    demerits[0] = 0.0;
+
+    for (size_t start = 0; start < n; ++start) {
+        if (demerits[start] == INF) {
+            continue;
+        }
+        double width = params.headerWidth;
+        double squeezable = 0.0;
+        for (size_t end = start; end < n; ++end) {
+            width += items[end].width;
+            squeezable += items[end].squeezable;
+
+            bool overfull = width > params.systemWidth + params.squeezability * squeezable;
+            if (overfull && end > start) {
+                break;
+            }
+            if (items[end].noBreak && end + 1 < n) {
+                continue;
+            }
+
+            double bad = badness(width, squeezable, params, end + 1 == n);
+            double d = demerits[start] + (LINE_PENALTY + bad) * (LINE_PENALTY + bad);
+            if (d < demerits[end + 1]) {
+                demerits[end + 1] = d;
+                prevStart[end + 1] = start;
+            }
+        }
+    }
+
+    std::vector<size_t> starts;
+    if (demerits[n] == INF) {
+        // only possible within a nobreak group longer than a system
+        starts.push_back(0);
+        return starts;
+    }
+    for (size_t end = n; end > 0; end = prevStart[end]) {
+        starts.push_back(prevStart[end]);
+    }
+    std::reverse(starts.begin(), starts.end());
+    return starts;
+}
+
+double LayoutSystemBreaks::badness(double width, double squeezable, const Params& params, bool last)
+{
+    if (width > params.systemWidth) {
+        // squeezed
+        double range = params.squeezability * squeezable;
+        if (range <= 0.0) {
+            return MAX_BADNESS;
+        }
+        double r = std::min((width - params.systemWidth) / range, 1.0);
+        return MAX_BADNESS * r * r * r;
+    }
+
+    if (last && params.lastIsFinal && width / params.systemWidth < params.lastSystemFillLimit) {
+        // the last system is not justified
+        return 0.0;
+    }
+
+    if (width <= 0.0) {
+        return MAX_BADNESS;
+    }
+    // stretched
+    double r = std::min((params.systemWidth - width) / width, 1.0);
+    return MAX_BADNESS * r * r * r;
+}
@@ -0,0 +1,72 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_LAYOUTSYSTEMBREAKS_H
+#define MU_ENGRAVING_LAYOUTSYSTEMBREAKS_H
+
+#include <vector>
+
+#include "layoutoptions.h"
+#include "layoutcontext.h"
+
+namespace mu::engraving {
+class System;
+
+//---------------------------------------------------------
+//   LayoutSystemBreaks
+//    Optimal (Knuth–Plass style) choice of system breaks:
+//    instead of filling systems one by one, the breaks of
+//    a paragraph of measures (up to the next forced break
+//    or frame) are chosen so that the total badness of
+//    the systems is minimal.
+//---------------------------------------------------------
+
+class LayoutSystemBreaks
+{
+public:
+    struct Item {
+        double width = 0.0;         // natural width without system header
+        double squeezable = 0.0;
+        bool noBreak = false;       // the system can't end after this item
+    };
+
+    struct Params {
+        double systemWidth = 0.0;   // available width for the measures of a system
+        double headerWidth = 0.0;   // width added to the first measure of a system
+        double squeezability = 0.0;
+        double lastSystemFillLimit = 0.0;
+        bool lastIsFinal = true;    // the last system of the paragraph is not justified if short
+    };
+
+    //! Plans the systems of the paragraph starting with the first measure of the system being collected
+    static void planSystems(const LayoutOptions& options, LayoutContext& ctx, System* system, double leftMargin);
+
+    //! Indices of the first item of each system (the first one is always 0)
+    static std::vector<size_t> computeBreaks(const std::vector<Item>& items, const Params& params);
+
+    static constexpr size_t MAX_PARAGRAPH_MEASURES = 64;
+
+private:
+    static double badness(double width, double squeezable, const Params& params, bool last);
+};
+}
+
+#endif // MU_ENGRAVING_LAYOUTSYSTEMBREAKS_H
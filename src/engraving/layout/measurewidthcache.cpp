@@ -0,0 +1,385 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "measurewidthcache.h"
+
+#include <cstring>
+
+#include "libmscore/beam.h"
+#include "libmscore/chord.h"
+#include "libmscore/measure.h"
+#include "libmscore/note.h"
+#include "libmscore/shape.h"
+#include "libmscore/staff.h"
+#include "libmscore/system.h"
+
+#include "layoutchords.h"
+
+using namespace mu::engraving;
+
+// style values read by the horizontal spacing itself,
+// values used for the shapes are part of the shapes
+static const Sid SPACING_STYLES[] = {
+    Sid::measureSpacing,
+    Sid::minNoteDistance,
+    Sid::clefKeyRightMargin,
+    Sid::clefLeftMargin,
+    Sid::keysigLeftMargin,
+    Sid::timesigLeftMargin,
+    Sid::stemWidth,
+    Sid::endBarWidth,
+    Sid::endBarDistance,
+    Sid::minMMRestWidth,
+    Sid::multiMeasureRestMargin,
+    Sid::oldStyleMultiMeasureRests,
+    Sid::minMeasureWidth,
+    Sid::barAccidentalDistance,
+    Sid::barNoteDistance,
+    Sid::systemHeaderDistance,
+    Sid::systemHeaderTimeSigDistance,
+    Sid::HeaderToLineStartDistance,
+    Sid::MinTieLength,
+    Sid::graceToGraceNoteDist,
+    Sid::graceToMainNoteDist,
+};
+
+static double styleValue(const Score* score, Sid sid)
+{
+    switch (MStyle::valueType(sid)) {
+    case P_TYPE::SPATIUM: return score->styleMM(sid);
+    case P_TYPE::BOOL: return score->styleB(sid) ? 1.0 : 0.0;
+    default: break;
+    }
+    return score->styleD(sid);
+}
+
+static void addFraction(const Fraction& f, std::vector<double>& fp)
+{
+    fp.push_back(f.numerator());
+    fp.push_back(f.denominator());
+}
+
+//---------------------------------------------------------
+//   computeWidth
+//---------------------------------------------------------
+
+void MeasureWidthCache::computeWidth(Measure* m, Fraction minTicks, Fraction maxTicks, double stretchCoeff)
+{
+    // Measure::computeWidth() starts with this too, the grace notes are part of the shapes
+    LayoutChords::updateGraceNotes(m);
+
+    Fingerprint fp;
+    if (!makeFingerprint(m, minTicks, maxTicks, stretchCoeff, fp)) {
+        ++m_stats.bypassed;
+        m->computeWidth(minTicks, maxTicks, stretchCoeff);
+        return;
+    }
+
+    size_t key = hash(fp);
+    auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+        for (const Entry& entry : it->second) {
+            if (entry.fingerprint == fp) {
+                ++m_stats.hits;
+                restore(m, entry);
+                return;
+            }
+        }
+    }
+
+    ++m_stats.misses;
+    m->computeWidth(minTicks, maxTicks, stretchCoeff);
+    store(m, std::move(fp), key);
+}
+
+//---------------------------------------------------------
+//   checkStyle
+//---------------------------------------------------------
+
+void MeasureWidthCache::checkStyle(const Score* score)
+{
+    std::vector<double> values;
+    values.reserve(std::size(SPACING_STYLES) + 2);
+    values.push_back(score->spatium());
+    values.push_back(score->noteHeadWidth());
+    for (Sid sid : SPACING_STYLES) {
+        values.push_back(styleValue(score, sid));
+    }
+
+    if (values == m_styleValues && score->paddingTable() == m_paddingTable) {
+        return;
+    }
+
+    clear();
+    m_styleValues = std::move(values);
+    m_paddingTable = score->paddingTable();
+}
+
+void MeasureWidthCache::clear()
+{
+    m_entries.clear();
+    m_entriesCount = 0;
+}
+
+//---------------------------------------------------------
+//   memoryUsage
+//    approximate, the nodes of the map are counted
+//    at the size of their values
+//---------------------------------------------------------
+
+size_t MeasureWidthCache::memoryUsage() const
+{
+    size_t bytes = sizeof(MeasureWidthCache) + m_styleValues.capacity() * sizeof(double)
+                   + m_entries.bucket_count() * sizeof(void*);
+
+    for (const auto& p : m_entries) {
+        bytes += sizeof(p) + p.second.capacity() * sizeof(Entry);
+        for (const Entry& entry : p.second) {
+            bytes += entry.fingerprint.capacity() * sizeof(double) + entry.segments.capacity() * sizeof(SegmentResult);
+        }
+    }
+
+    return bytes;
+}
+
+//---------------------------------------------------------
+//   makeFingerprint
+//    collect everything Measure::computeWidth() reads;
+//    returns false if the spacing depends on more than
+//    the content of the measure
+//---------------------------------------------------------
+
+bool MeasureWidthCache::makeFingerprint(const Measure* m, Fraction minTicks, Fraction maxTicks, double stretchCoeff, Fingerprint& fp) const
+{
+    const System* system = m->system();
+    if (!system || !m->first()) {
+        return false;
+    }
+
+    fp.reserve(256);
+
+    addFraction(minTicks, fp);
+    addFraction(maxTicks, fp);
+    fp.push_back(stretchCoeff);
+    fp.push_back(m->userStretch());
+    fp.push_back(m->isFirstInSystem());
+    fp.push_back(m->mmRestCount());
+    addFraction(m->ticks(), fp);
+    addFraction(m->timesig(), fp);
+    fp.push_back(system->width());
+    fp.push_back(system->leftMargin());
+
+    // the first segment is spaced against the end barline of the previous measure
+    const MeasureBase* prev = m->prev();
+    const Measure* prevMeasure = prev && prev->isMeasure() ? toMeasure(prev) : nullptr;
+    fp.push_back(prevMeasure ? 1.0 : 0.0);
+    if (prevMeasure) {
+        fp.push_back(prevMeasure->repeatEnd());
+        fp.push_back(prevMeasure->system() == system);
+        const Segment* last = prevMeasure->last();
+        fp.push_back(last ? double(last->segmentType()) : -1.0);
+        if (last && last->isEndBarLineType()) {
+            fp.push_back(last->shapes().size());
+            for (const Shape& shape : last->shapes()) {
+                if (!addShape(shape, fp)) {
+                    return false;
+                }
+            }
+        }
+    }
+
+    for (const Segment* s = m->first(); s; s = s->next()) {
+        fp.push_back(double(s->segmentType()));
+        addFraction(s->rtick(), fp);
+        addFraction(s->ticks(), fp);
+        fp.push_back(s->enabled());
+        fp.push_back(s->visible());
+        fp.push_back(s->allElementsInvisible());
+        fp.push_back(s->header());
+        fp.push_back(s->extraLeadingSpace().val());
+
+        if (s->isChordRestType()) {
+            addFraction(s->shortestChordRest(), fp);
+            fp.push_back(s->hasAccidentals());
+
+            for (const EngravingItem* e : s->elist()) {
+                if (!e || !e->isChordRest()) {
+                    fp.push_back(-1.0);
+                    continue;
+                }
+                const ChordRest* cr = toChordRest(e);
+                if (cr->staffMove() != 0) {
+                    return false;
+                }
+                fp.push_back(cr->pos().x());
+                fp.push_back(cr->mag());
+                fp.push_back(cr->up());
+                fp.push_back(cr->visible());
+                fp.push_back(cr->isFullMeasureRest());
+                fp.push_back(cr->staff()->visible());
+                fp.push_back(cr->staff()->isTabStaff(cr->tick()));
+
+                const Beam* beam = cr->beam();
+                if (beam) {
+                    addFraction(beam->elements().front()->tick() - m->tick(), fp);
+                    addFraction(beam->elements().back()->tick() - m->tick(), fp);
+                } else {
+                    fp.push_back(-1.0);
+                }
+
+                if (cr->isChord()) {
+                    const Chord* chord = toChord(cr);
+                    // kerning of these notes depends on the position of the staff in the system
+                    if (!chord->allowKerningAbove() || !chord->allowKerningBelow()) {
+                        return false;
+                    }
+                }
+            }
+        }
+
+        fp.push_back(s->shapes().size());
+        for (const Shape& shape : s->shapes()) {
+            if (!addShape(shape, fp)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------
+//   addShape
+//    the padding between two shape elements depends on
+//    the type, magnification and voice of their items
+//---------------------------------------------------------
+
+bool MeasureWidthCache::addShape(const Shape& shape, Fingerprint& fp) const
+{
+    fp.push_back(shape.size());
+    for (const ShapeElement& el : shape) {
+        fp.push_back(el.x());
+        fp.push_back(el.y());
+        fp.push_back(el.width());
+        fp.push_back(el.height());
+
+        const EngravingItem* item = el.toItem;
+        if (!item) {
+            fp.push_back(-1.0);
+            continue;
+        }
+
+        if (item->isStemSlash()) {
+            // kerning depends on the next chord
+            return false;
+        }
+
+        fp.push_back(double(item->type()));
+        fp.push_back(item->mag());
+        fp.push_back(item->track());
+
+        if (item->isNote()) {
+            const Note* note = toNote(item);
+            // minimum tie and glissando lengths depend on the attached lines
+            if (!note->lineAttachPoints().empty()) {
+                return false;
+            }
+            fp.push_back(note->isGrace());
+        }
+
+        if (item->isNote() || item->isStem()) {
+            const RectF& bbox = item->bbox();
+            fp.push_back(item->pos().x());
+            fp.push_back(item->pos().y());
+            fp.push_back(bbox.x());
+            fp.push_back(bbox.y());
+            fp.push_back(bbox.width());
+            fp.push_back(bbox.height());
+        }
+    }
+
+    return true;
+}
+
+size_t MeasureWidthCache::hash(const Fingerprint& fp)
+{
+    // FNV-1a
+    uint64_t h = 14695981039346656037ULL;
+    for (double d : fp) {
+        uint64_t bits = 0;
+        std::memcpy(&bits, &d, sizeof(bits));
+        h ^= bits;
+        h *= 1099511628211ULL;
+    }
+    return static_cast<size_t>(h);
+}
+
+//---------------------------------------------------------
+//   store
+//---------------------------------------------------------
+
+void MeasureWidthCache::store(const Measure* m, Fingerprint&& fp, size_t key)
+{
+    if (m_entriesCount >= MAX_ENTRIES) {
+        clear();
+    }
+
+    Entry entry;
+    entry.fingerprint = std::move(fp);
+    for (const Segment* s = m->first(); s; s = s->next()) {
+        SegmentResult r;
+        r.x = s->x();
+        r.width = s->width();
+        r.widthOffset = s->widthOffset();
+        r.stretch = s->stretch();
+        r.crossBeamType = s->crossBeamType();
+        entry.segments.push_back(r);
+    }
+    entry.width = m->width();
+    entry.squeezableSpace = m->squeezableSpace();
+    entry.layoutStretch = m->layoutStretch();
+    entry.widthLocked = m->isWidthLocked();
+
+    m_entries[key].push_back(std::move(entry));
+    ++m_entriesCount;
+}
+
+//---------------------------------------------------------
+//   restore
+//---------------------------------------------------------
+
+void MeasureWidthCache::restore(Measure* m, const Entry& entry) const
+{
+    size_t i = 0;
+    for (Segment* s = m->first(); s; s = s->next(), ++i) {
+        const SegmentResult& r = entry.segments.at(i);
+        s->setPosX(r.x);
+        s->setWidth(r.width);
+        s->setWidthOffset(r.widthOffset);
+        s->setStretch(r.stretch);
+        s->setCrossBeamType(r.crossBeamType);
+    }
+
+    m->setSqueezableSpace(entry.squeezableSpace);
+    m->setLayoutStretch(entry.layoutStretch);
+    m->setWidth(entry.width);
+    m->setWidthLocked(entry.widthLocked);
+}
@@ -0,0 +1,107 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_MEASUREWIDTHCACHE_H
+#define MU_ENGRAVING_MEASUREWIDTHCACHE_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "types/fraction.h"
+
+#include "libmscore/score.h"
+#include "libmscore/segment.h"
+
+namespace mu::engraving {
+class Measure;
+class Shape;
+
+//---------------------------------------------------------
+//   MeasureWidthCache
+//    Results of Measure::computeWidth() keyed by the
+//    content of the measure: everything the horizontal
+//    spacing reads (segments, shapes, durations, system
+//    and style values). Measures with the same content
+//    share the result, so do repeated computations for
+//    the same measure while a system is collected.
+//---------------------------------------------------------
+
+class MeasureWidthCache
+{
+public:
+    struct Stats {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t bypassed = 0;    // measures whose spacing can't be keyed by content
+    };
+
+    void computeWidth(Measure* m, Fraction minTicks, Fraction maxTicks, double stretchCoeff);
+
+    //! Drops the results if style values used by spacing have changed since the last layout
+    void checkStyle(const Score* score);
+    void clear();
+
+    const Stats& stats() const { return m_stats; }
+    void resetStats() { m_stats = Stats(); }
+
+    size_t entriesCount() const { return m_entriesCount; }
+    size_t memoryUsage() const;
+
+private:
+    using Fingerprint = std::vector<double>;
+
+    struct SegmentResult {
+        double x = 0.0;
+        double width = 0.0;
+        double widthOffset = 0.0;
+        double stretch = 0.0;
+        CrossBeamType crossBeamType;
+    };
+
+    struct Entry {
+        Fingerprint fingerprint;
+        std::vector<SegmentResult> segments;
+        double width = 0.0;
+        double squeezableSpace = 0.0;
+        double layoutStretch = 1.0;
+        bool widthLocked = false;
+    };
+
+    bool makeFingerprint(const Measure* m, Fraction minTicks, Fraction maxTicks, double stretchCoeff, Fingerprint& fp) const;
+    bool addShape(const Shape& shape, Fingerprint& fp) const;
+    static size_t hash(const Fingerprint& fp);
+
+    void store(const Measure* m, Fingerprint&& fp, size_t key);
+    void restore(Measure* m, const Entry& entry) const;
+
+    static constexpr size_t MAX_ENTRIES = 4096;
+
+    std::unordered_map<size_t, std::vector<Entry> > m_entries;
+    size_t m_entriesCount = 0;
+
+    PaddingTable m_paddingTable {};
+    std::vector<double> m_styleValues;
+
+    Stats m_stats;
+};
+}
+
+#endif // MU_ENGRAVING_MEASUREWIDTHCACHE_H
@@ -529,9 +529,14 @@ void Accidental::draw(mu::draw::Painter* painter) const
     }
 
     painter->setPen(curColor());
+
+    SymbolPositions symbols;
+    symbols.reserve(el.size());
     for (const SymElement& e : el) {
-        score()->engravingFont()->draw(e.sym, painter, magS(), PointF(e.x, e.y));
+        symbols.push_back({ e.sym, PointF(e.x, e.y) });
     }
+
+    drawSymbols(symbols, painter);
 }
 
 //---------------------------------------------------------
@@ -782,13 +782,10 @@ void Articulation::doAutoplace()
 
         double d;
         bool above = up();     // (anchor() == ArticulationAnchor::TOP_STAFF || anchor() == ArticulationAnchor::TOP_CHORD);
-        SkylineLine sk(!above);
         if (above) {
-            sk.add(r.x(), r.bottom(), r.width());
-            d = sk.minDistance(ss->skyline().north());
+            d = ss->skyline().north().minDistance(r.x(), r.bottom(), r.width());
         } else {
-            sk.add(r.x(), r.top(), r.width());
-            d = ss->skyline().south().minDistance(sk);
+            d = ss->skyline().south().minDistance(r.x(), r.top(), r.width());
         }
 
         if (d > -md) {
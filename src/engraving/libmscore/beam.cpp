@@ -71,6 +71,11 @@ static const ElementStyle beamStyle {
 struct BeamFragment {
     double py1[2];
     double py2[2];
+
+    // inputs and result of the last beam position solving in Beam::layout2()
+    std::vector<double> positionKey;
+    int dictator = 0;
+    int pointer = 0;
 };
 
 //---------------------------------------------------------
@@ -1541,25 +1546,62 @@ void Beam::layout2(const std::vector<ChordRest*>& chordRests, SpannerSegmentType
         int stemLengthEnd = abs(round((endAnchorBase - _endAnchor.y()) / spatium() * 4));
         int stemLengthDictator = isStartDictator ? stemLengthStart : stemLengthEnd;
         bool isSmall = mag() < 1.;
-        if (endAnchor.x() > startAnchor.x()) {
-            /* When beam layout is called before horizontal spacing (see LayoutMeasure::getNextMeasure() to
-             * know why) the x positions aren't yet determined and may be all zero, which would cause the
-             * following function to get stuck in a loop. The if() condition avoids that case. */
-            if (!isSmall) {
-                // Adjust anchor stems
-                offsetBeamWithAnchorShortening(chordRests, dictator, pointer, staffLines, isStartDictator, stemLengthDictator);
+        int beamCount = std::max(beamCountD, beamCountP);
+
+        // The search of valid beam positions below only depends on these values, so it is skipped
+        // when the beam is laid out again unchanged (e.g. before and after horizontal spacing,
+        // or when a neighbouring element is edited).
+        std::vector<double> positionKey {
+            double(dictator), double(pointer), double(startNote), double(endNote), double(startChord->line()),
+            double(endChord->line()), double(staffLines), double(middleLine), double(beamCountD), double(beamCountP),
+            double(stemLengthDictator), double(slant), double(specialSlant), double(isStartDictator), double(_up),
+            double(isSmall), double(_isGrace), double(_tab != nullptr), double(_noSlope), double(_beamSpacing),
+            _beamWidth, spatium(), startAnchor.x(), endAnchor.x()
+        };
+        if (chordRests.size() > 2) {
+            // inner stems, see offsetBeamToRemoveCollisions()
+            for (const ChordRest* cr : chordRests) {
+                if (cr->isChord() && cr != _elements.back() && cr != _elements.front()) {
+                    PointF anchor = chordBeamAnchor(cr, ChordBeamAnchorType::Middle) - pagePos();
+                    positionKey.push_back(anchor.x());
+                    positionKey.push_back(anchor.y());
+                }
             }
-            // Adjust inner stems
-            offsetBeamToRemoveCollisions(chordRests, dictator, pointer, startAnchor.x(), endAnchor.x(), isFlat, isStartDictator);
         }
-        int beamCount = std::max(beamCountD, beamCountP);
-        if (!_tab) {
-            if (!_isGrace) {
-                setValidBeamPositions(dictator, pointer, beamCountD, beamCountP, staffLines, isStartDictator, isFlat, isAscending);
+        if (isFlat && !_tab && !_isGrace) {
+            // beam counts of all the chords, see setValidBeamPositions()
+            for (const ChordRest* cr : _elements) {
+                positionKey.push_back(cr->isChord() ? cr->beams() : -1);
+            }
+        }
+
+        BeamFragment* f = fragments[frag];
+        if (positionKey == f->positionKey) {
+            dictator = f->dictator;
+            pointer = f->pointer;
+        } else {
+            if (endAnchor.x() > startAnchor.x()) {
+                /* When beam layout is called before horizontal spacing (see LayoutMeasure::getNextMeasure() to
+                 * know why) the x positions aren't yet determined and may be all zero, which would cause the
+                 * following function to get stuck in a loop. The if() condition avoids that case. */
+                if (!isSmall) {
+                    // Adjust anchor stems
+                    offsetBeamWithAnchorShortening(chordRests, dictator, pointer, staffLines, isStartDictator, stemLengthDictator);
+                }
+                // Adjust inner stems
+                offsetBeamToRemoveCollisions(chordRests, dictator, pointer, startAnchor.x(), endAnchor.x(), isFlat, isStartDictator);
             }
-            if (!forceFlat) {
-                addMiddleLineSlant(dictator, pointer, beamCount, middleLine, interval, smallSlant ? 1 : slant);
+            if (!_tab) {
+                if (!_isGrace) {
+                    setValidBeamPositions(dictator, pointer, beamCountD, beamCountP, staffLines, isStartDictator, isFlat, isAscending);
+                }
+                if (!forceFlat) {
+                    addMiddleLineSlant(dictator, pointer, beamCount, middleLine, interval, smallSlant ? 1 : slant);
+                }
             }
+            f->positionKey = std::move(positionKey);
+            f->dictator = dictator;
+            f->pointer = pointer;
         }
 
         _startAnchor.setY(quarterSpace * (isStartDictator ? dictator : pointer) + pagePos().y());
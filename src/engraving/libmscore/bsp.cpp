@@ -19,7 +19,7 @@
  * You should have received a copy of the GNU General Public License
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
-
+#include <algorithm>
 #include <cmath>
 
 #include "bsp.h"
@@ -29,86 +29,21 @@ using namespace mu;
 
 namespace mu::engraving {
 //---------------------------------------------------------
-//   InsertItemBspTreeVisitor
-//---------------------------------------------------------
-
-class InsertItemBspTreeVisitor : public BspTreeVisitor
-{
-    OBJECT_ALLOCATOR(engraving, InsertItemBspTreeVisitor)
-public:
-    EngravingItem* item;
-
-    inline void visit(std::list<EngravingItem*>* items) { items->push_front(item); }
-};
-
-//---------------------------------------------------------
-//   RemoveItemBspTreeVisitor
-//---------------------------------------------------------
-
-class RemoveItemBspTreeVisitor : public BspTreeVisitor
-{
-    OBJECT_ALLOCATOR(engraving, RemoveItemBspTreeVisitor)
-public:
-    EngravingItem* item;
-
-    inline void visit(std::list<EngravingItem*>* items) { items->remove(item); }
-};
-
-//---------------------------------------------------------
-//   FindItemBspTreeVisitor
-//---------------------------------------------------------
-
-class FindItemBspTreeVisitor : public BspTreeVisitor
-{
-    OBJECT_ALLOCATOR(engraving, FindItemBspTreeVisitor)
-public:
-    std::list<EngravingItem*> foundItems;
-
-    void visit(std::list<EngravingItem*>* items)
-    {
-        for (auto it = items->begin(); it != items->end(); ++it) {
-            EngravingItem* item = *it;
-            if (!item->itemDiscovered) {
-                item->itemDiscovered = true;
-                foundItems.push_front(item);
-            }
-        }
-    }
-};
-
-//---------------------------------------------------------
-//   BspTree
-//---------------------------------------------------------
-
-BspTree::BspTree()
-    : leafCnt(0)
-{
-    depth = 0;
-}
-
-//---------------------------------------------------------
-//   intmaxlog
+//   Box
 //---------------------------------------------------------
 
-static inline int intmaxlog(int n)
+BspTree::Box::Box(const RectF& r)
+    : x1(std::min(r.left(), r.right())), y1(std::min(r.top(), r.bottom())),
+    x2(std::max(r.left(), r.right())), y2(std::max(r.top(), r.bottom()))
 {
-    return n > 0 ? std::max(int(::ceil(::log(double(n)) / ::log(double(2)))), 5) : 0;
 }
 
-//---------------------------------------------------------
-//   initialize
-//---------------------------------------------------------
-
-void BspTree::initialize(const RectF& rec, int n)
+void BspTree::Box::unite(const Box& b)
 {
-    depth      = intmaxlog(n);
-    this->rect = rec;
-    leafCnt    = 0;
-
-    nodes.resize((1 << (depth + 1)) - 1);
-    leaves.resize(1LL << depth);
-    std::fill(leaves.begin(), leaves.end(), std::list<EngravingItem*>());
-    initialize(rec, depth, 0);
+    x1 = std::min(x1, b.x1);
+    y1 = std::min(y1, b.y1);
+    x2 = std::max(x2, b.x2);
+    y2 = std::max(y2, b.y2);
 }
 
 //---------------------------------------------------------
@@ -117,9 +52,11 @@ void BspTree::initialize(const RectF& rec, int n)
 
 void BspTree::clear()
 {
-    leafCnt = 0;
-    nodes.clear();
-    leaves.clear();
+    m_entries.clear();
+    m_nodes.clear();
+    m_pending.clear();
+    m_removed = 0;
+    m_built = false;
 }
 
 //---------------------------------------------------------
@@ -128,9 +65,10 @@ void BspTree::clear()
 
 void BspTree::insert(EngravingItem* element)
 {
-    InsertItemBspTreeVisitor insertVisitor;
-    insertVisitor.item = element;
-    climbTree(&insertVisitor, element->pageBoundingRect());
+    Entry e;
+    e.box = Box(element->pageBoundingRect());
+    e.item = element;
+    m_pending.push_back(e);
 }
 
 //---------------------------------------------------------
@@ -139,9 +77,20 @@ void BspTree::insert(EngravingItem* element)
 
 void BspTree::remove(EngravingItem* element)
 {
-    RemoveItemBspTreeVisitor removeVisitor;
-    removeVisitor.item = element;
-    climbTree(&removeVisitor, element->pageBoundingRect());
+    for (Entry& e : m_pending) {
+        if (e.item == element) {
+            e.item = nullptr;
+            ++m_removed;
+            return;
+        }
+    }
+    for (Entry& e : m_entries) {
+        if (e.item == element) {
+            e.item = nullptr;
+            ++m_removed;
+            return;
+        }
+    }
 }
 
 //---------------------------------------------------------
@@ -150,15 +99,14 @@ void BspTree::remove(EngravingItem* element)
 
 std::vector<EngravingItem*> BspTree::items(const RectF& rec)
 {
-    FindItemBspTreeVisitor findVisitor;
-    climbTree(&findVisitor, rec);
+    build();
     std::vector<EngravingItem*> l;
-    for (EngravingItem* e : findVisitor.foundItems) {
-        e->itemDiscovered = false;
+    visit(rec, [&l, &rec](EngravingItem* e) {
         if (e->pageBoundingRect().intersects(rec)) {
             l.push_back(e);
         }
-    }
+        return true;
+    });
     return l;
 }
 
@@ -168,200 +116,111 @@ std::vector<EngravingItem*> BspTree::items(const RectF& rec)
 
 std::vector<EngravingItem*> BspTree::items(const PointF& pos)
 {
-    FindItemBspTreeVisitor findVisitor;
-    climbTree(&findVisitor, pos);
-
+    build();
     std::vector<EngravingItem*> l;
-    for (EngravingItem* e : findVisitor.foundItems) {
-        e->itemDiscovered = false;
+    visit(RectF(pos.x(), pos.y(), 0.0, 0.0), [&l, &pos](EngravingItem* e) {
         if (e->contains(pos)) {
             l.push_back(e);
         }
-    }
+        return true;
+    });
     return l;
 }
 
-#ifndef NDEBUG
 //---------------------------------------------------------
-//   debug
+//   sortTileRecursive
+//    orders the boxes in vertical slices sorted by y so that
+//    each run of NODE_SIZE of them makes a compact node
 //---------------------------------------------------------
 
-String BspTree::debug(int index) const
+template<typename T>
+void BspTree::sortTileRecursive(std::vector<T>& v)
 {
-    const Node* node = &nodes.at(index);
+    size_t nodeCount = (v.size() + NODE_SIZE - 1) / NODE_SIZE;
+    size_t sliceCount = size_t(std::ceil(std::sqrt(double(nodeCount))));
+    size_t sliceSize = std::max(sliceCount, size_t(1)) * NODE_SIZE;
 
-    String tmp;
-    if (node->type == Node::Type::LEAF) {
-        RectF rec = rectForIndex(index);
-        if (!leaves[node->leafIndex].empty()) {
-            tmp += String(u"[%1, %2, %3, %4] contains %5 items\n")
-                   .arg(rec.left()).arg(rec.top())
-                   .arg(rec.width()).arg(rec.height())
-                   .arg(leaves[node->leafIndex].size());
-        }
-    } else {
-        if (node->type == Node::Type::HORIZONTAL) {
-            tmp += debug(firstChildIndex(index));
-            tmp += debug(firstChildIndex(index) + 1);
-        } else {
-            tmp += debug(firstChildIndex(index));
-            tmp += debug(firstChildIndex(index) + 1);
-        }
+    std::sort(v.begin(), v.end(), [](const T& a, const T& b) { return a.box.centerX() < b.box.centerX(); });
+    for (size_t i = 0; i < v.size(); i += sliceSize) {
+        auto end = v.begin() + std::min(i + sliceSize, v.size());
+        std::sort(v.begin() + i, end, [](const T& a, const T& b) { return a.box.centerY() < b.box.centerY(); });
     }
-    return tmp;
 }
 
-#endif
-
 //---------------------------------------------------------
-//   initialize
+//   build
+//    bulk loads the pending elements together with the
+//    ones already in the tree, drops the removed ones
 //---------------------------------------------------------
 
-void BspTree::initialize(const RectF& rec, int dep, int index)
+void BspTree::build()
 {
-    Node* node = &nodes[index];
-    if (index == 0) {
-        node->type = Node::Type::HORIZONTAL;
-        node->offset = rec.center().x();
+    if (m_built && m_pending.size() * 4 <= m_entries.size() + NODE_SIZE) {
+        // few late insertions, scanned linearly by the queries
+        return;
     }
 
-    if (dep) {
-        Node::Type type;
-        RectF rect1, rect2;
-        double offset1, offset2;
-
-        if (node->type == Node::Type::HORIZONTAL) {
-            type = Node::Type::VERTICAL;
-            rect1.setRect(rec.left(), rec.top(), rec.width(), rec.height() * .5);
-            rect2.setRect(rect1.left(), rect1.bottom(), rect1.width(), rec.height() - rect1.height());
-            offset1 = rect1.center().x();
-            offset2 = rect2.center().x();
-        } else {
-            type = Node::Type::HORIZONTAL;
-            rect1.setRect(rec.left(), rec.top(), rec.width() * .5, rec.height());
-            rect2.setRect(rect1.right(), rect1.top(), rec.width() - rect1.width(), rect1.height());
-            offset1 = rect1.center().y();
-            offset2 = rect2.center().y();
-        }
-
-        int childIndex = firstChildIndex(index);
-
-        Node* child   = &nodes[childIndex];
-        child->offset = offset1;
-        child->type   = type;
-
-        child = &nodes[childIndex + 1];
-        child->offset = offset2;
-        child->type   = type;
-
-        initialize(rect1, dep - 1, childIndex);
-        initialize(rect2, dep - 1, childIndex + 1);
-    } else {
-        node->type      = Node::Type::LEAF;
-        node->leafIndex = leafCnt++;
+    for (const Entry& e : m_pending) {
+        m_entries.push_back(e);
     }
-}
-
-//---------------------------------------------------------
-//   climbTree
-//---------------------------------------------------------
+    m_pending.clear();
+    m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(), [](const Entry& e) { return !e.item; }), m_entries.end());
+    m_removed = 0;
+    m_nodes.clear();
+    m_built = true;
 
-void BspTree::climbTree(BspTreeVisitor* visitor, const mu::PointF& pos, int index)
-{
-    if (nodes.empty()) {
+    if (m_entries.empty()) {
         return;
     }
 
-    Node* node = &nodes[index];
-    int childIndex = firstChildIndex(index);
-
-    switch (node->type) {
-    case Node::Type::LEAF:
-        visitor->visit(&leaves[node->leafIndex]);
-        break;
-    case Node::Type::VERTICAL:
-        if (pos.x() < node->offset) {
-            climbTree(visitor, pos, childIndex);
-        } else {
-            climbTree(visitor, pos, childIndex + 1);
+    sortTileRecursive(m_entries);
+
+    std::vector<Node> level;
+    level.reserve((m_entries.size() + NODE_SIZE - 1) / NODE_SIZE);
+    for (size_t i = 0; i < m_entries.size(); i += NODE_SIZE) {
+        Node node;
+        node.first = i;
+        node.count = std::min(NODE_SIZE, m_entries.size() - i);
+        node.box = m_entries[i].box;
+        for (size_t j = i + 1; j < i + node.count; ++j) {
+            node.box.unite(m_entries[j].box);
         }
-        break;
-    case Node::Type::HORIZONTAL:
-        if (pos.y() < node->offset) {
-            climbTree(visitor, pos, childIndex);
-        } else {
-            climbTree(visitor, pos, childIndex + 1);
-        }
-        break;
-    }
-}
-
-//---------------------------------------------------------
-//   climbTree
-//---------------------------------------------------------
-
-void BspTree::climbTree(BspTreeVisitor* visitor, const mu::RectF& rec, int index)
-{
-    if (nodes.empty()) {
-        return;
+        level.push_back(node);
     }
 
-    Node* node = &nodes[index];
-    int childIndex = firstChildIndex(index);
-
-    switch (node->type) {
-    case Node::Type::LEAF:
-        visitor->visit(&leaves[node->leafIndex]);
-        break;
-    case Node::Type::VERTICAL:
-        if (rec.left() < node->offset) {
-            climbTree(visitor, rec, childIndex);
-            if (rec.right() >= node->offset) {
-                climbTree(visitor, rec, childIndex + 1);
-            }
-        } else {
-            climbTree(visitor, rec, childIndex + 1);
-        }
-        break;
-    case Node::Type::HORIZONTAL:
-        if (rec.top() < node->offset) {
-            climbTree(visitor, rec, childIndex);
-            if (rec.bottom() >= node->offset) {
-                climbTree(visitor, rec, childIndex + 1);
+    while (level.size() > 1) {
+        sortTileRecursive(level);
+        size_t base = m_nodes.size();
+        m_nodes.insert(m_nodes.end(), level.begin(), level.end());
+
+        std::vector<Node> parents;
+        parents.reserve((level.size() + NODE_SIZE - 1) / NODE_SIZE);
+        for (size_t i = 0; i < level.size(); i += NODE_SIZE) {
+            Node node;
+            node.leaf = false;
+            node.first = base + i;
+            node.count = std::min(NODE_SIZE, level.size() - i);
+            node.box = level[i].box;
+            for (size_t j = i + 1; j < i + node.count; ++j) {
+                node.box.unite(level[j].box);
             }
-        } else {
-            climbTree(visitor, rec, childIndex + 1);
+            parents.push_back(node);
         }
+        level = std::move(parents);
     }
+    m_nodes.push_back(level.front());
 }
 
+#ifndef NDEBUG
 //---------------------------------------------------------
-//   rectForIndex
+//   debug
 //---------------------------------------------------------
 
-mu::RectF BspTree::rectForIndex(int index) const
+String BspTree::debug() const
 {
-    if (index <= 0) {
-        return rect;
-    }
-
-    int parentIdx = parentIndex(index);
-    RectF rec   = rectForIndex(parentIdx);
-    const Node* parent = &nodes.at(parentIdx);
-
-    if (parent->type == Node::Type::HORIZONTAL) {
-        if (index & 1) {
-            rec.setRight(parent->offset);
-        } else {
-            rec.setLeft(parent->offset);
-        }
-    } else {
-        if (index & 1) {
-            rec.setBottom(parent->offset);
-        } else {
-            rec.setTop(parent->offset);
-        }
-    }
-    return rec;
+    return String(u"%1 elements in %2 nodes, %3 pending")
+           .arg(int(m_entries.size() + m_pending.size() - m_removed)).arg(int(m_nodes.size())).arg(int(m_pending.size()));
 }
+
+#endif
 }
@@ -23,57 +23,28 @@
 #ifndef __BSP_H__
 #define __BSP_H__
 
-#include <list>
+#include <vector>
 
-#include "global/allocator.h"
 #include "types/string.h"
 #include "draw/types/geometry.h"
 
 namespace mu::engraving {
-class BspTreeVisitor;
-class InsertItemBspTreeVisitor;
-class RemoveItemBspTreeVisitor;
-class FindItemBspTreeVisitor;
-
 class EngravingItem;
 
 //---------------------------------------------------------
 //   BspTree
-//    binary space partitioning
+//    spatial index of the elements of a page: a packed
+//    R-tree bulk loaded (sort tile recursive) with the
+//    elements inserted before the first query. Elements
+//    inserted later are kept aside until the next build,
+//    removed ones are only marked.
 //---------------------------------------------------------
 
 class BspTree
 {
 public:
-    struct Node {
-        enum class Type : char {
-            HORIZONTAL, VERTICAL, LEAF
-        };
-        union {
-            double offset;
-            int leafIndex;
-        };
-        Type type;
-    };
-private:
-    unsigned int depth;
-    void initialize(const mu::RectF& rect, int depth, int index);
-    void climbTree(BspTreeVisitor* visitor, const mu::PointF& pos, int index = 0);
-    void climbTree(BspTreeVisitor* visitor, const mu::RectF& rect, int index = 0);
+    BspTree() = default;
 
-    void findItems(std::list<EngravingItem*>* foundItems, const mu::RectF& rect, int index);
-    void findItems(std::list<EngravingItem*>* foundItems, const mu::PointF& pos, int index);
-    mu::RectF rectForIndex(int index) const;
-
-    std::vector<Node> nodes;
-    std::vector<std::list<EngravingItem*> > leaves;
-    int leafCnt;
-    mu::RectF rect;
-
-public:
-    BspTree();
-
-    void initialize(const mu::RectF& rect, int depth);
     void clear();
 
     void insert(EngravingItem* item);
@@ -82,29 +53,89 @@ public:
     std::vector<EngravingItem*> items(const mu::RectF& rect);
     std::vector<EngravingItem*> items(const mu::PointF& pos);
 
-    int leafCount() const { return leafCnt; }
-    inline int firstChildIndex(int index) const { return index * 2 + 1; }
+    //! packs the inserted elements into the tree, the queries don't do it
+    //! so that they can run concurrently
+    void build();
 
-    inline int parentIndex(int index) const
+    //! calls f(item) for the items whose bounding rectangle at insertion intersects rect,
+    //! until f returns false; doesn't allocate
+    template<typename F>
+    void visit(const mu::RectF& rect, F&& f) const
     {
-        return index > 0 ? ((index & 1) ? ((index - 1) / 2) : ((index - 2) / 2)) : -1;
+        Box box(rect);
+        if (!m_nodes.empty() && !visitNode(m_nodes.size() - 1, box, f)) {
+            return;
+        }
+        for (const Entry& e : m_pending) {
+            if (e.item && e.box.intersects(box) && !f(e.item)) {
+                return;
+            }
+        }
     }
 
+    size_t size() const { return m_entries.size() + m_pending.size() - m_removed; }
+
 #ifndef NDEBUG
-    String debug(int index) const;
+    String debug() const;
 #endif
-};
 
-//---------------------------------------------------------
-//   BspTreeVisitor
-//---------------------------------------------------------
+private:
+    static constexpr size_t NODE_SIZE = 16;
+
+    struct Box {
+        double x1 = 0.0;
+        double y1 = 0.0;
+        double x2 = 0.0;
+        double y2 = 0.0;
+
+        Box() = default;
+        explicit Box(const mu::RectF& r);
+        bool intersects(const Box& b) const { return x1 <= b.x2 && b.x1 <= x2 && y1 <= b.y2 && b.y1 <= y2; }
+        void unite(const Box& b);
+        double centerX() const { return (x1 + x2) * 0.5; }
+        double centerY() const { return (y1 + y2) * 0.5; }
+    };
 
-class BspTreeVisitor
-{
-    OBJECT_ALLOCATOR(engraving, BspTreeVisitor)
-public:
-    virtual ~BspTreeVisitor() {}
-    virtual void visit(std::list<EngravingItem*>* items) = 0;
+    struct Entry {
+        Box box;
+        EngravingItem* item = nullptr;  // null if removed
+    };
+
+    struct Node {
+        Box box;
+        size_t first = 0;       // first child in m_nodes, or first entry in m_entries for leaves
+        size_t count = 0;
+        bool leaf = true;
+    };
+
+    template<typename T>
+    static void sortTileRecursive(std::vector<T>& v);
+
+    template<typename F>
+    bool visitNode(size_t index, const Box& box, F& f) const
+    {
+        const Node& node = m_nodes[index];
+        if (!node.box.intersects(box)) {
+            return true;
+        }
+        for (size_t i = node.first; i < node.first + node.count; ++i) {
+            if (node.leaf) {
+                const Entry& e = m_entries[i];
+                if (e.item && e.box.intersects(box) && !f(e.item)) {
+                    return false;
+                }
+            } else if (!visitNode(i, box, f)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::vector<Entry> m_entries;   // in the order of the leaves
+    std::vector<Node> m_nodes;      // level by level from the leaves, the root is last
+    std::vector<Entry> m_pending;   // inserted since the last build
+    size_t m_removed = 0;
+    bool m_built = false;
 };
 } // namespace mu::engraving
 #endif
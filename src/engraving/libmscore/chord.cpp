@@ -283,6 +283,7 @@ Chord::Chord(const Chord& c, bool link)
         score()->undo(new Link(this, const_cast<Chord*>(&c)));
     }
     _ledgerLines = 0;
+    _spareLedgerLines = 0;
 
     for (Note* onote : c._notes) {
         Note* nnote = Factory::copyNote(*onote, link);
@@ -412,10 +413,12 @@ Chord::~Chord()
     delete _stemSlash;
     delete _stem;
     delete _hook;
-    for (LedgerLine* ll = _ledgerLines; ll;) {
-        LedgerLine* llNext = ll->next();
-        delete ll;
-        ll = llNext;
+    for (LedgerLine* ll : { _ledgerLines, _spareLedgerLines }) {
+        while (ll) {
+            LedgerLine* llNext = ll->next();
+            delete ll;
+            ll = llNext;
+        }
     }
     DeleteAll(_graceNotes);
     DeleteAll(_notes);
@@ -959,8 +962,7 @@ void Chord::addLedgerLines()
             double _spatium = spatium();
             double stepDistance = lineDistance * 0.5;
             for (auto lld : vecLines) {
-                LedgerLine* h = new LedgerLine(score());
-                h->setParent(this);
+                LedgerLine* h = takeLedgerLine();
                 h->setTrack(track);
                 h->setVisible(lld.visible && staffVisible);
                 h->setLen(lld.maxX - lld.minX);
@@ -975,6 +977,43 @@ void Chord::addLedgerLines()
     }
 }
 
+//---------------------------------------------------------
+//   recycleLedgerLines
+//    Ledger lines are recreated on every layout of the chord.
+//    Keep the current ones for takeLedgerLine() instead of
+//    deleting and allocating them again on each pass.
+//---------------------------------------------------------
+
+void Chord::recycleLedgerLines()
+{
+    while (_spareLedgerLines) {
+        LedgerLine* l = _spareLedgerLines->next();
+        delete _spareLedgerLines;
+        _spareLedgerLines = l;
+    }
+    _spareLedgerLines = _ledgerLines;
+    _ledgerLines = nullptr;
+}
+
+//---------------------------------------------------------
+//   takeLedgerLine
+//    returns a spare ledger line or a new one, to be set up
+//    by the caller and prepended to _ledgerLines
+//---------------------------------------------------------
+
+LedgerLine* Chord::takeLedgerLine()
+{
+    LedgerLine* l = _spareLedgerLines;
+    if (l) {
+        _spareLedgerLines = l->next();
+        l->resetLine();
+    } else {
+        l = new LedgerLine(score());
+        l->setParent(this);
+    }
+    return l;
+}
+
 void Chord::computeUp()
 {
     assert(!_notes.empty());
@@ -2098,11 +2137,7 @@ void Chord::layoutPitched()
 
     double chordX           = (_noteType == NoteType::NORMAL) ? ipos().x() : 0.0;
 
-    while (_ledgerLines) {
-        LedgerLine* l = _ledgerLines->next();
-        delete _ledgerLines;
-        _ledgerLines = l;
-    }
+    recycleLedgerLines();
 
     double lll    = 0.0;           // space to leave at left of chord
     double rrr    = 0.0;           // space to leave at right of chord
@@ -2139,6 +2174,7 @@ void Chord::layoutPitched()
     // See GitHub issue #8970 for more details.
     // https://github.com/musescore/MuseScore/issues/8970
     std::vector<Accidental*> chordAccidentals;
+    const double accidentalDistance = score()->styleMM(Sid::accidentalDistance) * mag_;
 
     for (Note* note : _notes) {
         note->layout();
@@ -2159,7 +2195,7 @@ void Chord::layoutPitched()
             double x = accidental->pos().x() + note->pos().x() + chordX;
             // distance from accidental to note already taken into account
             // but here perhaps we create more padding in *front* of accidental?
-            x -= score()->styleMM(Sid::accidentalDistance) * mag_;
+            x -= accidentalDistance;
             lll = std::max(lll, -x);
         }
 
@@ -2191,7 +2227,6 @@ void Chord::layoutPitched()
 
         if (chordAccidentals.size()) {
             double arpeggioAccidentalDistance = score()->styleMM(Sid::ArpeggioAccidentalDistance) * mag_;
-            double accidentalDistance = score()->styleMM(Sid::accidentalDistance) * mag_;
             gapSize = arpeggioAccidentalDistance - accidentalDistance;
             gapSize -= _arpeggio->insetDistance(chordAccidentals, mag_);
         }
@@ -2295,11 +2330,7 @@ void Chord::layoutTablature()
         c->layoutTablature();
     }
 
-    while (_ledgerLines) {
-        LedgerLine* l = _ledgerLines->next();
-        delete _ledgerLines;
-        _ledgerLines = l;
-    }
+    recycleLedgerLines();
 
     double lll         = 0.0;                    // space to leave at left of chord
     double rrr         = 0.0;                    // space to leave at right of chord
@@ -2390,8 +2421,7 @@ void Chord::layoutTablature()
         double extraLen    = 0;
         double llX         = stemX - (headWidth + extraLen) * 0.5;
         for (int i = 0; i < ledgerLines; i++) {
-            LedgerLine* ldgLin = new LedgerLine(score());
-            ldgLin->setParent(this);
+            LedgerLine* ldgLin = takeLedgerLine();
             ldgLin->setTrack(track());
             ldgLin->setVisible(visible());
             ldgLin->setLen(headWidth + extraLen);
@@ -4003,7 +4033,7 @@ void Chord::layoutArticulations2()
 void Chord::checkStartEndSlurs()
 {
     _startEndSlurs.reset();
-    for (Spanner* spanner : _startingSpanners) {
+    for (Spanner* spanner : startingSpanners()) {
         if (!spanner->isSlur()) {
             continue;
         }
@@ -4018,13 +4048,13 @@ void Chord::checkStartEndSlurs()
         if (!slur->endChord()) {
             continue;
         }
-        std::vector<Spanner*>& endingSp = slur->endChord()->endingSpanners();
+        const std::vector<Spanner*>& endingSp = slur->endChord()->endingSpanners();
         if (std::find(endingSp.begin(), endingSp.end(), slur) == endingSp.end()) {
             // Slur not added. Add it now.
-            endingSp.push_back(slur);
+            slur->endChord()->addEndingSpanner(slur);
         }
     }
-    for (Spanner* spanner : _endingSpanners) {
+    for (Spanner* spanner : endingSpanners()) {
         if (!spanner->isSlur()) {
             continue;
         }
@@ -95,6 +95,7 @@ class Chord final : public ChordRest
 
     std::vector<Note*> _notes;           // sorted to decreasing line step
     LedgerLine* _ledgerLines = nullptr;  // single linked list
+    LedgerLine* _spareLedgerLines = nullptr; // lines of the previous layout, reused by the next one
 
     Stem* _stem = nullptr;
     Hook* _hook = nullptr;
@@ -151,6 +152,8 @@ class Chord final : public ChordRest
     double downPos() const override;
     double centerX() const;
     void addLedgerLines();
+    void recycleLedgerLines();
+    LedgerLine* takeLedgerLine();
 
     // `includeTemporarySiblings`: whether items that are deleted & recreated during every layout should also be processed
     void processSiblings(std::function<void(EngravingItem*)> func, bool includeTemporarySiblings) const;
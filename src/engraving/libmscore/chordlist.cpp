@@ -22,6 +22,8 @@
 
 #include "chordlist.h"
 
+#include <mutex>
+
 #include "io/file.h"
 #include "io/fileinfo.h"
 
@@ -1925,6 +1927,7 @@ void ChordList::unload()
     symbols.clear();
     fonts.clear();
     renderListRoot.clear();
+    renderListFunction.clear();
     renderListBase.clear();
     chordTokenList.clear();
     _autoAdjust = false;
@@ -1939,21 +1942,61 @@ const ChordDescription* ChordList::description(int id) const
     return &it->second;
 }
 
+//---------------------------------------------------------
+//   checkChordList
+//    make sure we have a chordlist
+//
+//    The chord description files shipped in the styles
+//    directory are parsed once per style settings and then
+//    copied into every score and excerpt using them.
+//    Scores customize their own copy (e.g. generated
+//    descriptions), the parsed one is never modified.
+//---------------------------------------------------------
+
 void ChordList::checkChordList(const MStyle& style)
 {
-    // make sure we have a chordlist
-    if (!loaded()) {
-        double emag = style.value(Sid::chordExtensionMag).toReal();
-        double eadjust = style.value(Sid::chordExtensionAdjust).toReal();
-        double mmag = style.value(Sid::chordModifierMag).toReal();
-        double madjust = style.value(Sid::chordModifierAdjust).toReal();
-        configureAutoAdjust(emag, eadjust, mmag, madjust);
+    if (loaded()) {
+        return;
+    }
 
-        if (style.value(Sid::chordsXmlFile).toBool()) {
-            read(u"chords.xml");
+    double emag = style.value(Sid::chordExtensionMag).toReal();
+    double eadjust = style.value(Sid::chordExtensionAdjust).toReal();
+    double mmag = style.value(Sid::chordModifierMag).toReal();
+    double madjust = style.value(Sid::chordModifierAdjust).toReal();
+    bool chordsXml = style.value(Sid::chordsXmlFile).toBool();
+    String descriptionFile = style.value(Sid::chordDescriptionFile).value<String>();
+
+    // files given by absolute path may be edited by the user, and
+    // a partially filled list can't be replaced by a parsed one
+    bool shareable = empty() && symbols.empty() && fonts.empty() && chordTokenList.empty()
+                     && !descriptionFile.isEmpty() && !FileInfo(descriptionFile).isAbsolute();
+
+    // the excerpts may be read and laid out concurrently
+    static std::map<String, ChordList> parsedLists;
+    static std::mutex parsedListsMutex;
+    String key = String(u"%1|%2").arg(chordsXml ? u"1" : u"0", descriptionFile)
+                 + String(u"|%1|%2|%3|%4").arg(emag).arg(eadjust).arg(mmag).arg(madjust);
+
+    if (shareable) {
+        std::lock_guard<std::mutex> lock(parsedListsMutex);
+        auto it = parsedLists.find(key);
+        if (it != parsedLists.end()) {
+            bool customChordList = _customChordList;
+            *this = it->second;
+            _customChordList = customChordList;
+            return;
         }
+    }
+
+    configureAutoAdjust(emag, eadjust, mmag, madjust);
+    if (chordsXml) {
+        read(u"chords.xml");
+    }
+    read(descriptionFile);
 
-        read(style.value(Sid::chordDescriptionFile).value<String>());
+    if (shareable && loaded()) {
+        std::lock_guard<std::mutex> lock(parsedListsMutex);
+        parsedLists.insert({ key, *this });
     }
 }
 
@@ -104,24 +104,68 @@ static UndoMacro::ChangesInfo changesInfo(const UndoStack* stack)
     return actualMacro->changesInfo();
 }
 
-static std::pair<int, int> changedTicksRange(const CmdState& cmdState, const std::vector<const EngravingItem*>& changedItems)
+//---------------------------------------------------------
+//   addChangedItems
+//    extend the range by the ticks and staves the items occupy;
+//    the staves are taken from the items only if all of them
+//    belong to a staff, otherwise the range stays score-wide
+//---------------------------------------------------------
+
+static void addChangedItems(ScoreChangesRange& range, const std::vector<const EngravingItem*>& changedItems)
 {
-    int startTick = cmdState.startTick().ticks();
-    int endTick = cmdState.endTick().ticks();
+    staff_idx_t staffFrom = mu::nidx;
+    staff_idx_t staffTo = mu::nidx;
+    bool allItemsOnStaff = true;
 
-    for (const EngravingItem* element : changedItems) {
-        int tick = element->tick().ticks();
+    for (const EngravingItem* item : changedItems) {
+        int tickFrom = item->tick().ticks();
+        int tickTo = tickFrom;
 
-        if (startTick > tick) {
-            startTick = tick;
+        if (item->isSpanner()) {
+            tickTo = toSpanner(item)->tick2().ticks();
+        } else if (item->isChordRest()) {
+            tickTo = tickFrom + toChordRest(item)->actualTicks().ticks();
+        } else if (item->isMeasureBase()) {
+            tickTo = toMeasureBase(item)->endTick().ticks();
         }
 
-        if (endTick < tick) {
-            endTick = tick;
+        if (range.tickFrom == -1 || tickFrom < range.tickFrom) {
+            range.tickFrom = tickFrom;
         }
+
+        if (range.tickTo == -1 || tickTo > range.tickTo) {
+            range.tickTo = tickTo;
+        }
+
+        if (!item->hasStaff()) {
+            allItemsOnStaff = false;
+            continue;
+        }
+
+        staff_idx_t staffIdx = item->staffIdx();
+        if (staffFrom == mu::nidx || staffIdx < staffFrom) {
+            staffFrom = staffIdx;
+        }
+
+        if (staffTo == mu::nidx || staffIdx > staffTo) {
+            staffTo = staffIdx;
+        }
+    }
+
+    if (staffFrom == mu::nidx) {
+        return;
+    }
+
+    if (range.staffIdxFrom == mu::nidx || range.staffIdxTo == mu::nidx) {
+        if (allItemsOnStaff) {
+            range.staffIdxFrom = staffFrom;
+            range.staffIdxTo = staffTo;
+        }
+        return;
     }
 
-    return { startTick, endTick };
+    range.staffIdxFrom = std::min(range.staffIdxFrom, staffFrom);
+    range.staffIdxTo = std::max(range.staffIdxTo, staffTo);
 }
 
 //---------------------------------------------------------
@@ -382,11 +426,14 @@ ScoreChangesRange Score::changesRange() const
 {
     const CmdState& cmdState = score()->cmdState();
     UndoMacro::ChangesInfo changes = changesInfo(undoStack());
-    auto ticksRange = changedTicksRange(cmdState, changes.changedItems);
 
-    return { ticksRange.first, ticksRange.second,
-             cmdState.startStaff(), cmdState.endStaff(),
-             changes.changedObjectTypes, changes.changedPropertyIdSet, changes.changedStyleIdSet };
+    ScoreChangesRange range { cmdState.startTick().ticks(), cmdState.endTick().ticks(),
+                              cmdState.startStaff(), cmdState.endStaff(),
+                              changes.changedObjectTypes, changes.changedPropertyIdSet, changes.changedStyleIdSet };
+
+    addChangedItems(range, changes.changedItems);
+
+    return range;
 }
 
 #ifndef NDEBUG
@@ -423,12 +470,14 @@ void Score::update(bool resetCmdState, bool layoutAllParts)
         ms->deletePostponed();
 
         if (cs.layoutRange()) {
+            std::vector<Score*> scores;
             for (Score* s : ms->scoreList()) {
                 if (s != this && !s->isOpen() && ms->scoreList().size() > 1 && !layoutAllParts) {
                     continue;
                 }
-                s->doLayoutRange(cs.startTick(), cs.endTick());
+                scores.push_back(s);
             }
+            ms->doLayoutScoresRange(scores, cs.startTick(), cs.endTick());
             updateAll = true;
         }
     }
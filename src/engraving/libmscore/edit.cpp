@@ -20,6 +20,7 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <limits>
 #include <map>
 #include <set>
 
@@ -1358,7 +1359,7 @@ void Score::cmdAddTimeSig(Measure* fm, staff_idx_t staffIdx, TimeSig* ts, bool l
                     nsig->setParent(seg);
                     undoAddElement(nsig);
                     if (score->excerpt()) {
-                        const track_idx_t masterTrack = mu::key(score->excerpt()->tracksMapping(), nsig->track());
+                        const track_idx_t masterTrack = score->excerpt()->masterTrack(nsig->track());
                         TimeSig* masterTimeSig = masterTimeSigs[masterTrack];
                         if (masterTimeSig) {
                             undo(new Link(masterTimeSig, nsig));
@@ -2365,16 +2366,12 @@ void Score::deleteItem(EngravingItem* el)
 
             Tuplet* tuplet = chord->tuplet();
             if (tuplet) {
-                std::list<EngravingObject*> tl = tuplet->linkList();
                 for (EngravingObject* e : rest->linkList()) {
                     DurationElement* de = toDurationElement(e);
-                    for (EngravingObject* ee : tl) {
-                        Tuplet* t = toTuplet(ee);
-                        if (t->score() == de->score() && t->track() == de->track()) {
-                            de->setTuplet(t);
-                            t->add(de);
-                            break;
-                        }
+                    Tuplet* t = tuplet->links() ? toTuplet(tuplet->links()->findItem(de->score(), de->track())) : tuplet;
+                    if (t && t->score() == de->score() && t->track() == de->track()) {
+                        de->setTuplet(t);
+                        t->add(de);
                     }
                 }
             }
@@ -3887,22 +3884,31 @@ MeasureBase* Score::insertMeasure(ElementType type, MeasureBase* beforeMeasure,
 //    have changed or be removed.
 //    Spanners need to have a start anchor. Slurs need a
 //    start and end anchor.
+//    Only spanners overlapping the edited range can have
+//    lost an anchor, plus those running past the end of
+//    the score if measures were deleted.
 //---------------------------------------------------------
 
 void Score::checkSpanner(const Fraction& startTick, const Fraction& endTick)
 {
     std::list<Spanner*> sl;       // spanners to remove
     std::list<Spanner*> sl2;      // spanners to shorten
-    auto spanners = _spanner.findOverlapping(startTick.ticks(), endTick.ticks());
-
-    // DEBUG: check all spanner
-    //        there may be spanners outside of score bc. some measures were deleted
 
     Fraction lastTick = lastMeasure()->endTick();
 
-    for (auto i : _spanner.map()) {
-        Spanner* s = i.second;
+    std::vector<Spanner*> spanners;
+    std::set<Spanner*> collected;
+    auto collect = [&spanners, &collected](const SpannerMap::IntervalList& intervals) {
+        for (const auto& interval : intervals) {
+            if (collected.insert(interval.value).second) {
+                spanners.push_back(interval.value);
+            }
+        }
+    };
+    collect(_spanner.findOverlapping(startTick.ticks(), endTick.ticks()));
+    collect(_spanner.findOverlapping(lastTick.ticks(), std::numeric_limits<int>::max()));
 
+    for (Spanner* s : spanners) {
         if (s->isSlur()) {
             Segment* seg = tick2segmentMM(s->tick(), false, SegmentType::ChordRest);
             if (!seg || !seg->element(s->track())) {
@@ -4831,6 +4837,24 @@ void Score::undoChangeClef(Staff* ostaff, EngravingItem* e, ClefType ct, bool fo
     }
 }
 
+//---------------------------------------------------------
+//   findLinkedInStaff
+//---------------------------------------------------------
+
+static EngravingItem* findLinkedInStaff(EngravingItem* e, Staff* nstaff)
+{
+    if (!e->links()) {
+        return e->staff() == nstaff ? e : nullptr;
+    }
+    for (EngravingObject* ee : *e->links()) {
+        EngravingItem* el = toEngravingItem(ee);
+        if (el->staff() == nstaff) {
+            return el;
+        }
+    }
+    return nullptr;
+}
+
 //---------------------------------------------------------
 //   findLinkedVoiceElement
 //---------------------------------------------------------
@@ -4843,20 +4867,14 @@ static EngravingItem* findLinkedVoiceElement(EngravingItem* e, Staff* nstaff)
     track_idx_t dtrack = nstaff->idx() * VOICES + e->voice();
 
     if (se) {
-        strack = mu::key(se->tracksMapping(), strack);
+        strack = se->masterTrack(strack);
     }
 
     if (de) {
         std::vector<track_idx_t> l = mu::values(de->tracksMapping(), strack);
         if (l.empty()) {
             // simply return the first linked element whose staff is equal to nstaff
-            for (EngravingObject* ee : e->linkList()) {
-                EngravingItem* el = toEngravingItem(ee);
-                if (el->staff() == nstaff) {
-                    return el;
-                }
-            }
-            return 0;
+            return findLinkedInStaff(e, nstaff);
         }
         for (track_idx_t i : l) {
             if (nstaff->idx() * VOICES <= i && (nstaff->idx() + 1) * VOICES > i) {
@@ -4886,20 +4904,14 @@ static Chord* findLinkedChord(Chord* c, Staff* nstaff)
     track_idx_t dtrack = nstaff->idx() * VOICES + c->voice();
 
     if (se) {
-        strack = mu::key(se->tracksMapping(), strack);
+        strack = se->masterTrack(strack);
     }
 
     if (de) {
         std::vector<track_idx_t> l = mu::values(de->tracksMapping(), strack);
         if (l.empty()) {
             // simply return the first linked chord whose staff is equal to nstaff
-            for (EngravingObject* ee : c->linkList()) {
-                Chord* ch = toChord(ee);
-                if (ch->staff() == nstaff) {
-                    return ch;
-                }
-            }
-            return 0;
+            return toChord(findLinkedInStaff(c, nstaff));
         }
         for (track_idx_t i : l) {
             if (nstaff->idx() * VOICES <= i && (nstaff->idx() + 1) * VOICES > i) {
@@ -5203,10 +5215,8 @@ void Score::undoAddElement(EngravingItem* element, bool addToLinkedStaves, bool
         strack = ostaff->idx() * VOICES + element->track() % VOICES;
 
         if (mu::engraving::Excerpt* excerpt = ostaff->score()->excerpt()) {
-            const TracksMap& tracks = excerpt->tracksMapping();
-
-            if (!tracks.empty() && strack != mu::nidx) {
-                strack = mu::key(tracks, strack, mu::nidx);
+            if (!excerpt->tracksMapping().empty() && strack != mu::nidx) {
+                strack = excerpt->masterTrack(strack);
             }
         }
     }
@@ -5800,9 +5810,8 @@ void Score::undoAddCR(ChordRest* cr, Measure* measure, const Fraction& tick)
     track_idx_t strack = ostaff->idx() * VOICES + cr->voice();
 
     if (mu::engraving::Excerpt* excerpt = ostaff->score()->excerpt()) {
-        const TracksMap& tracks = excerpt->tracksMapping();
-        if (!tracks.empty()) {
-            strack = mu::key(tracks, strack, mu::nidx);
+        if (!excerpt->tracksMapping().empty()) {
+            strack = excerpt->masterTrack(strack);
         }
     }
 
@@ -5981,23 +5990,19 @@ void Score::undoChangeSpannerElements(Spanner* spanner, EngravingItem* startElem
                 track_idx_t newTrack = sp->startElement() ? sp->startElement()->track() + startDeltaTrack : sp->track();
                 // look in elements linked to new start element for an element with
                 // same score as linked spanner and appropriate track
-                for (EngravingObject* ee : startElement->linkList()) {
-                    EngravingItem* e = toEngravingItem(ee);
-                    if (e->score() == sp->score() && e->track() == newTrack) {
-                        newStartElement = e;
-                        break;
-                    }
+                if (startElement->links()) {
+                    newStartElement = startElement->links()->findItem(sp->score(), newTrack);
+                } else if (startElement->score() == sp->score() && startElement->track() == newTrack) {
+                    newStartElement = startElement;
                 }
             }
             // similarly to determine the 'parallel' end element
             if (endElement) {
                 track_idx_t newTrack = sp->endElement() ? sp->endElement()->track() + endDeltaTrack : sp->track2();
-                for (EngravingObject* ee : endElement->linkList()) {
-                    EngravingItem* e = toEngravingItem(ee);
-                    if (e->score() == sp->score() && e->track() == newTrack) {
-                        newEndElement = e;
-                        break;
-                    }
+                if (endElement->links()) {
+                    newEndElement = endElement->links()->findItem(sp->score(), newTrack);
+                } else if (endElement->score() == sp->score() && endElement->track() == newTrack) {
+                    newEndElement = endElement;
                 }
             }
         }
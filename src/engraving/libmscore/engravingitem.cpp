@@ -27,7 +27,11 @@
 
 #include "engravingitem.h"
 
+#include <atomic>
 #include <cmath>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
 
 #include "containers.h"
 #include "io/buffer.h"
@@ -40,6 +44,7 @@
 #include "rw/xml.h"
 #include "rw/writecontext.h"
 #include "types/typesconv.h"
+#include "compat/dummyelement.h"
 
 #ifndef ENGRAVING_NO_ACCESSIBILITY
 #include "accessibility/accessibleitem.h"
@@ -55,6 +60,7 @@
 #include "mscore.h"
 #include "note.h"
 #include "page.h"
+#include "rootitem.h"
 #include "score.h"
 #include "segment.h"
 #include "shape.h"
@@ -72,6 +78,21 @@ using namespace mu;
 using namespace mu::io;
 using namespace mu::engraving;
 
+namespace {
+struct EidIndex {
+    std::mutex mutex;
+    std::unordered_map<eid_t, EngravingItem*> items;
+    eid_t lastEid = 0;
+};
+}
+
+static EidIndex* eidIndex()
+{
+    // never destroyed, items of the palette score can outlive the static objects
+    static EidIndex* index = new EidIndex();
+    return index;
+}
+
 namespace mu::engraving {
 // extern bool showInvisible;
 
@@ -83,13 +104,27 @@ EngravingItem* EngravingItemList::at(size_t i) const
 EngravingItem::EngravingItem(const ElementType& type, EngravingObject* se, ElementFlags f)
     : EngravingObject(type, se)
 {
-    _flags         = f;
-    _color         = engravingConfiguration()->defaultColor();
+    resetItemState(f);
+}
+
+void EngravingItem::resetItemState(ElementFlags f)
+{
+    _bbox          = RectF();
     _mag           = 1.0;
-    _tag           = 1;
-    _z             = -1;
+    _pos           = PointF();
+    _offset        = PointF();
     _offsetChanged = OffsetChange::NONE;
+    _changedPos    = PointF();
     _minDistance   = Spatium(0.0);
+    _track         = mu::nidx;
+    _flags         = f;
+    _tag           = 1;
+    _z             = -1;
+    _color         = engravingConfiguration()->defaultColor();
+    _skipDraw      = false;
+    _userSetKerning = KerningType::NOT_SET;
+    m_colorsInversionEnabled = true;
+    _cachedPagePosGeneration.store(0, std::memory_order_relaxed);
 }
 
 EngravingItem::EngravingItem(const EngravingItem& e)
@@ -117,10 +152,17 @@ EngravingItem::EngravingItem(const EngravingItem& e)
 EngravingItem::~EngravingItem()
 {
     Score::onElementDestruction(this);
+
+    eid_t eid = m_eid.load(std::memory_order_acquire);
+    if (eid) {
+        EidIndex* index = eidIndex();
+        std::lock_guard<std::mutex> lock(index->mutex);
+        index->items.erase(eid);
+    }
 }
 
 #ifndef ENGRAVING_NO_ACCESSIBILITY
-void EngravingItem::setupAccessible()
+void EngravingItem::createAccessibleIfNeed()
 {
     if (m_accessible) {
         return;
@@ -133,13 +175,62 @@ void EngravingItem::setupAccessible()
     if (score() && !score()->isPaletteScore()) {
         if (std::find(accessibleDisabled.begin(), accessibleDisabled.end(), type()) == accessibleDisabled.end()) {
             m_accessible = createAccessible();
-            m_accessible->setup();
         }
     }
 }
 
+void EngravingItem::setupAccessible()
+{
+    createAccessibleIfNeed();
+
+    if (m_accessible && !m_accessible->registered()) {
+        m_accessible->setup();
+    }
+}
+
 #endif
 
+//---------------------------------------------------------
+//   eid
+//    Ids are given out on request only, so the index
+//    holds just the items somebody wants to find again
+//---------------------------------------------------------
+
+eid_t EngravingItem::eid() const
+{
+    eid_t eid = m_eid.load(std::memory_order_acquire);
+    if (eid) {
+        return eid;
+    }
+
+    EidIndex* index = eidIndex();
+    std::lock_guard<std::mutex> lock(index->mutex);
+
+    // another thread may have assigned it meanwhile
+    eid = m_eid.load(std::memory_order_relaxed);
+    if (eid) {
+        return eid;
+    }
+
+    eid = ++index->lastEid;
+    index->items.emplace(eid, const_cast<EngravingItem*>(this));
+    m_eid.store(eid, std::memory_order_release);
+
+    return eid;
+}
+
+EngravingItem* EngravingItem::itemByEid(eid_t eid)
+{
+    if (!eid) {
+        return nullptr;
+    }
+
+    EidIndex* index = eidIndex();
+    std::lock_guard<std::mutex> lock(index->mutex);
+    auto it = index->items.find(eid);
+    return it != index->items.end() ? it->second : nullptr;
+}
+
 bool EngravingItem::accessibleEnabled() const
 {
     return m_accessibleEnabled;
@@ -635,12 +726,67 @@ mu::draw::Color EngravingItem::curColor(bool isVisible, Color normalColor) const
     return normalColor;
 }
 
+//---------------------------------------------------------
+//   PagePosCacheScope
+//---------------------------------------------------------
+
+static std::atomic<uint64_t> s_pagePosGenerationCounter { 0 };
+static thread_local uint64_t t_pagePosGeneration = 0; // 0 - no active scope
+static constexpr uint64_t PAGE_POS_WRITING = std::numeric_limits<uint64_t>::max();
+
+EngravingItem::PagePosCacheScope::PagePosCacheScope()
+{
+    //! NOTE The nested scopes share the generation of the outer one
+    if (t_pagePosGeneration == 0) {
+        t_pagePosGeneration = ++s_pagePosGenerationCounter;
+        m_isOuter = true;
+    }
+}
+
+EngravingItem::PagePosCacheScope::~PagePosCacheScope()
+{
+    if (m_isOuter) {
+        t_pagePosGeneration = 0;
+    }
+}
+
 //---------------------------------------------------------
 //   pagePos
-//    return position in canvas coordinates
+//    return position in page coordinates
 //---------------------------------------------------------
 
 PointF EngravingItem::pagePos() const
+{
+    if (t_pagePosGeneration == 0) {
+        return computePagePos();
+    }
+
+    //! NOTE The generations are unique per scope, so a position read under our generation
+    //! is the one written under it, provided the generation did not change while reading
+    uint64_t generation = _cachedPagePosGeneration.load(std::memory_order_acquire);
+    if (generation == t_pagePosGeneration) {
+        PointF p(_cachedPagePosX.load(std::memory_order_relaxed), _cachedPagePosY.load(std::memory_order_relaxed));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (_cachedPagePosGeneration.load(std::memory_order_relaxed) == generation) {
+            return p;
+        }
+    }
+
+    PointF p = computePagePos();
+
+    //! NOTE Only one writer at a time, the others just don't cache
+    if (generation != PAGE_POS_WRITING
+        && _cachedPagePosGeneration.compare_exchange_strong(generation, PAGE_POS_WRITING, std::memory_order_acq_rel)) {
+        std::atomic_thread_fence(std::memory_order_release);
+        _cachedPagePosX.store(p.x(), std::memory_order_relaxed);
+        _cachedPagePosY.store(p.y(), std::memory_order_relaxed);
+        _cachedPagePosGeneration.store(t_pagePosGeneration, std::memory_order_release);
+    }
+
+    return p;
+}
+
+PointF EngravingItem::computePagePos() const
 {
     PointF p(pos());
     if (explicitParent() == nullptr) {
@@ -1695,6 +1841,11 @@ void EngravingItem::drawSymbols(const SymIdList& symbols, mu::draw::Painter* p,
     score()->engravingFont()->draw(symbols, p, SizeF(magS() * scale), o);
 }
 
+void EngravingItem::drawSymbols(const SymbolPositions& symbols, mu::draw::Painter* p, double scale) const
+{
+    score()->engravingFont()->draw(symbols, p, magS() * scale);
+}
+
 //---------------------------------------------------------
 //   symHeight
 //---------------------------------------------------------
@@ -2339,6 +2490,52 @@ void EngravingItem::setColorsInverionEnabled(bool enabled)
     m_colorsInversionEnabled = enabled;
 }
 
+//---------------------------------------------------------
+//   startingSpanners / endingSpanners
+//---------------------------------------------------------
+
+static const std::vector<Spanner*> noSpanners;
+
+const std::vector<Spanner*>& EngravingItem::startingSpanners() const
+{
+    return _spanners ? _spanners->starting : noSpanners;
+}
+
+const std::vector<Spanner*>& EngravingItem::endingSpanners() const
+{
+    return _spanners ? _spanners->ending : noSpanners;
+}
+
+void EngravingItem::addStartingSpanner(Spanner* s)
+{
+    if (!_spanners) {
+        _spanners = std::make_unique<SpannerLists>();
+    }
+    _spanners->starting.push_back(s);
+}
+
+void EngravingItem::addEndingSpanner(Spanner* s)
+{
+    if (!_spanners) {
+        _spanners = std::make_unique<SpannerLists>();
+    }
+    _spanners->ending.push_back(s);
+}
+
+void EngravingItem::removeStartingSpanner(Spanner* s)
+{
+    if (_spanners) {
+        mu::remove(_spanners->starting, s);
+    }
+}
+
+void EngravingItem::removeEndingSpanner(Spanner* s)
+{
+    if (_spanners) {
+        mu::remove(_spanners->ending, s);
+    }
+}
+
 std::pair<int, float> EngravingItem::barbeat() const
 {
     const EngravingItem* parent = this;
@@ -2531,14 +2728,11 @@ void EngravingItem::autoplaceSegmentElement(bool above, bool add)
             r.translate(0.0, stYOffset);
         }
 
-        SkylineLine sk(!above);
         double d;
         if (above) {
-            sk.add(r.x(), r.bottom(), r.width());
-            d = sk.minDistance(ss->skyline().north());
+            d = ss->skyline().north().minDistance(r.x(), r.bottom(), r.width());
         } else {
-            sk.add(r.x(), r.top(), r.width());
-            d = ss->skyline().south().minDistance(sk);
+            d = ss->skyline().south().minDistance(r.x(), r.top(), r.width());
         }
 
         if (d > -minDistance) {
@@ -2652,6 +2846,13 @@ void EngravingItem::initAccessibleIfNeed()
 
 void EngravingItem::doInitAccessible()
 {
+    //! NOTE The roots are not registered until the accessibility is used,
+    //! they must be registered before their first item
+    if (Score* sc = score()) {
+        RootItem* root = explicitParent() ? sc->rootItem() : sc->dummy()->rootItem();
+        root->setupAccessible();
+    }
+
     EngravingItemList parents;
     auto parent = parentItem(false /*not explicit*/);
     while (parent) {
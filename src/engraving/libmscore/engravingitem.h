@@ -23,6 +23,9 @@
 #ifndef __ELEMENT_H__
 #define __ELEMENT_H__
 
+#include <atomic>
+#include <memory>
+
 #include "engravingobject.h"
 #include "elementgroup.h"
 
@@ -50,6 +53,7 @@ typedef std::shared_ptr<AccessibleItem> AccessibleItemPtr;
 
 enum class Pid;
 class StaffType;
+struct SymbolPosition;
 class XmlReader;
 class XmlWriter;
 
@@ -155,8 +159,21 @@ class EngravingItem : public EngravingObject
     virtual bool alwaysKernable() const { return false; }
     KerningType _userSetKerning = KerningType::NOT_SET;
 
-    std::vector<Spanner*> _startingSpanners; ///< spanners starting on this item
-    std::vector<Spanner*> _endingSpanners; ///< spanners ending on this item
+    // most items have no spanners attached, keep the lists out of the item until the first one
+    struct SpannerLists {
+        std::vector<Spanner*> starting;    ///< spanners starting on this item
+        std::vector<Spanner*> ending;      ///< spanners ending on this item
+    };
+    std::unique_ptr<SpannerLists> _spanners;
+
+    // memoized by pagePos() while a PagePosCacheScope is alive, see below;
+    // the scopes of several threads may reach the same item (painting, BSP rebuild),
+    // so the position is guarded by its generation like a seqlock
+    mutable std::atomic<double> _cachedPagePosX { 0.0 };
+    mutable std::atomic<double> _cachedPagePosY { 0.0 };
+    mutable std::atomic<uint64_t> _cachedPagePosGeneration { 0 };
+
+    PointF computePagePos() const;
 
 protected:
     mutable int _z;
@@ -167,6 +184,10 @@ protected:
     EngravingItem(const ElementType& type, EngravingObject* se = 0, ElementFlags = ElementFlag::NOTHING);
     EngravingItem(const EngravingItem&);
 
+    //! NOTE Initializes the item in the constructor, and sets back the items kept and reused by the layout
+    //! instead of being created again, the parent and the attached spanners are kept
+    void resetItemState(ElementFlags f = ElementFlag::NOTHING);
+
 #ifndef ENGRAVING_NO_ACCESSIBILITY
     virtual AccessibleItemPtr createAccessible();
     void notifyAboutNameChanged();
@@ -182,11 +203,17 @@ public:
     virtual double computePadding(const EngravingItem* nextItem) const;
 
 #ifndef ENGRAVING_NO_ACCESSIBILITY
+    //! NOTE Creates the accessible object without registering it in the accessibility controller,
+    //! that is done by setupAccessible() once the object is queried by an assistive technology
+    void createAccessibleIfNeed();
     virtual void setupAccessible();
 #endif
     bool accessibleEnabled() const;
     void setAccessibleEnabled(bool enabled);
 
+    eid_t eid() const;
+    static EngravingItem* itemByEid(eid_t eid);
+
     EngravingItem& operator=(const EngravingItem&) = delete;
     //@ create a copy of the element
     virtual EngravingItem* clone() const = 0;
@@ -282,6 +309,20 @@ public:
     bool skipDraw() const { return _skipDraw; }
 
     virtual PointF pagePos() const;            ///< position in page coordinates
+
+    //! NOTE While a scope is alive, pagePos() is computed once per item in the current thread
+    //! and the parent chain walk is shared by the children, for painting and hit testing.
+    //! No position may change while it is alive; a new scope invalidates all the cached positions
+    class PagePosCacheScope
+    {
+    public:
+        PagePosCacheScope();
+        ~PagePosCacheScope();
+
+    private:
+        bool m_isOuter = false;
+    };
+
     virtual PointF canvasPos() const;          ///< position in canvas coordinates
     double pageX() const;
     double canvasX() const;
@@ -512,6 +553,7 @@ public:
     void drawSymbol(SymId id, mu::draw::Painter* p, const PointF& o = PointF(), double scale = 1.0) const;
     void drawSymbols(const SymIdList&, mu::draw::Painter* p, const PointF& o = PointF(), double scale = 1.0) const;
     void drawSymbols(const SymIdList&, mu::draw::Painter* p, const PointF& o, const SizeF& scale) const;
+    void drawSymbols(const std::vector<SymbolPosition>& symbols, mu::draw::Painter* p, double scale = 1.0) const;
     double symHeight(SymId id) const;
     double symWidth(SymId id) const;
     double symWidth(const SymIdList&) const;
@@ -560,8 +602,12 @@ public:
 
     std::pair<int, float> barbeat() const;
 
-    std::vector<Spanner*>& startingSpanners() { return _startingSpanners; }
-    std::vector<Spanner*>& endingSpanners() { return _endingSpanners; }
+    const std::vector<Spanner*>& startingSpanners() const;
+    const std::vector<Spanner*>& endingSpanners() const;
+    void addStartingSpanner(Spanner* s);
+    void addEndingSpanner(Spanner* s);
+    void removeStartingSpanner(Spanner* s);
+    void removeEndingSpanner(Spanner* s);
 
 private:
 #ifndef ENGRAVING_NO_ACCESSIBILITY
@@ -570,6 +616,8 @@ private:
 #endif
 
     bool m_accessibleEnabled = false;
+
+    mutable std::atomic<eid_t> m_eid { 0 }; // assigned on the first request, under the lock of the index
 };
 
 using ElementPtr = std::shared_ptr<EngravingItem>;
@@ -376,7 +376,7 @@ static void changeProperty(EngravingObject* e, Pid t, const PropertyValue& st, P
         if (e->isBracketItem()) {
             BracketItem* bi = toBracketItem(e);
             e->score()->undo(new ChangeBracketProperty(bi->staff(), bi->column(), t, st, ps));
-        } else {
+        } else if (!e->score()->undoStack()->pushPropertyChange(e, t, st, ps)) {
             e->score()->undo(new ChangeProperty(e, t, st, ps));
         }
     }
@@ -494,7 +494,7 @@ void EngravingObject::readProperty(XmlReader& e, Pid id)
 
 bool EngravingObject::readProperty(const AsciiStringView& s, XmlReader& e, Pid id)
 {
-    if (s == propertyName(id)) {
+    if (e.nameToken(s) == propertyNameToken(id)) {
         readProperty(e, id);
         return true;
     }
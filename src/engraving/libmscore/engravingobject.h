@@ -23,6 +23,8 @@
 #ifndef MU_ENGRAVING_OBJECT_H
 #define MU_ENGRAVING_OBJECT_H
 
+#include <type_traits>
+
 #include "global/allocator.h"
 #include "types/string.h"
 
@@ -195,6 +197,13 @@ public:
 
 class EngravingObject
 {
+    template<typename F>
+    struct VisitData {
+        F* func = nullptr;
+        ElementType type = ElementType::INVALID;
+        bool done = false;
+    };
+
     INJECT_STATIC(engraving, mu::diagnostics::IEngravingElementsProvider, elementsProvider)
 
     ElementType m_type = ElementType::INVALID;
@@ -247,6 +256,35 @@ public:
     virtual EngravingObjectList scanChildren() const { return {}; }
     virtual void scanElements(void* data, void (* func)(void*, EngravingItem*), bool all=true);
 
+    //! calls f(item) for the elements reached by scanElements(), until f returns false
+    //! (the rest of the tree is still walked, without calls)
+    template<typename F>
+    void visitElements(F&& f, bool all = true)
+    {
+        using Data = VisitData<std::remove_reference_t<F> >;
+        Data data { &f };
+        scanElements(&data, [](void* d, auto* e) {
+            Data* v = static_cast<Data*>(d);
+            if (!v->done && !(*v->func)(e)) {
+                v->done = true;
+            }
+        }, all);
+    }
+
+    //! same for the elements of the given type only
+    template<typename F>
+    void visitElements(ElementType type, F&& f, bool all = true)
+    {
+        using Data = VisitData<std::remove_reference_t<F> >;
+        Data data { &f, type };
+        scanElements(&data, [](void* d, auto* e) {
+            Data* v = static_cast<Data*>(d);
+            if (!v->done && e->type() == v->type && !(*v->func)(e)) {
+                v->done = true;
+            }
+        }, all);
+    }
+
     // context
     virtual void setScore(Score* s);
     Score* score() const;
@@ -67,7 +67,8 @@ using namespace mu;
 using namespace mu::engraving;
 
 Excerpt::Excerpt(const Excerpt& ex, bool copyPartScore)
-    : m_masterScore(ex.m_masterScore), m_name(ex.m_name), m_parts(ex.m_parts), m_tracksMapping(ex.m_tracksMapping)
+    : m_masterScore(ex.m_masterScore), m_name(ex.m_name), m_parts(ex.m_parts), m_tracksMapping(ex.m_tracksMapping),
+    m_masterTracks(ex.m_masterTracks)
 {
     m_excerptScore = (copyPartScore && ex.m_excerptScore) ? ex.m_excerptScore->clone() : nullptr;
 
@@ -183,13 +184,47 @@ bool Excerpt::isEmpty() const
     return excerptScore() ? excerptScore()->parts().empty() : true;
 }
 
-TracksMap& Excerpt::tracksMapping()
+const TracksMap& Excerpt::tracksMapping()
 {
     updateTracksMapping();
 
     return m_tracksMapping;
 }
 
+void Excerpt::addTrackMapping(track_idx_t masterTrack, track_idx_t excerptTrack)
+{
+    m_tracksMapping.insert({ masterTrack, excerptTrack });
+    updateMasterTracks();
+}
+
+track_idx_t Excerpt::masterTrack(track_idx_t excerptTrack)
+{
+    updateTracksMapping();
+
+    return excerptTrack < m_masterTracks.size() ? m_masterTracks[excerptTrack] : mu::nidx;
+}
+
+//---------------------------------------------------------
+//   updateMasterTracks
+//    Rebuilds the reverse lookup of the tracks mapping.
+//    The first (lowest) master track wins for the excerpt
+//    tracks mapped more than once, as with mu::key().
+//---------------------------------------------------------
+
+void Excerpt::updateMasterTracks()
+{
+    m_masterTracks.clear();
+
+    for (const auto& pair : m_tracksMapping) {
+        if (pair.second >= m_masterTracks.size()) {
+            m_masterTracks.resize(pair.second + 1, mu::nidx);
+        }
+        if (m_masterTracks[pair.second] == mu::nidx) {
+            m_masterTracks[pair.second] = pair.first;
+        }
+    }
+}
+
 void Excerpt::setTracksMapping(const TracksMap& tracksMapping)
 {
     if (m_tracksMapping == tracksMapping) {
@@ -197,6 +232,7 @@ void Excerpt::setTracksMapping(const TracksMap& tracksMapping)
     }
 
     m_tracksMapping = tracksMapping;
+    updateMasterTracks();
 
     for (Staff* staff : excerptScore()->staves()) {
         Staff* masterStaff = m_masterScore->staffById(staff->id());
@@ -601,11 +637,24 @@ void MasterScore::initEmptyExcerpt(Excerpt* excerpt)
 
 static bool scoreContainsSpanner(const Score* score, Spanner* spanner)
 {
+    // linked spanners share the links list, so look for them in the score by their start tick
+    // instead of checking the links of every spanner of the score
+    if (!spanner->links()) {
+        return false;
+    }
+
     const std::multimap<int, Spanner*>& spanners = score->spanner();
 
-    for (auto it = spanners.cbegin(); it != spanners.cend(); ++it) {
-        if (it->second->links()->contains(spanner)) {
-            return true;
+    for (EngravingObject* linked : *spanner->links()) {
+        if (linked->score() != score || !linked->isSpanner()) {
+            continue;
+        }
+
+        auto range = spanners.equal_range(toSpanner(linked)->tick().ticks());
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == linked) {
+                return true;
+            }
         }
     }
 
@@ -764,6 +813,16 @@ static MeasureBase* cloneMeasure(MeasureBase* mb, Score* score, const Score* osc
 
             track_idx_t strack = mu::value(trackList, srcTrack, mu::nidx);
 
+            // a track that is not in the excerpt only gives its system annotations, which are all on track 0,
+            // so with many staves in the source most of the tracks don't need to walk the segments at all
+            if (strack == mu::nidx && srcTrack != 0) {
+                continue;
+            }
+
+            //There are probably more destination tracks for the same source
+            const std::vector<track_idx_t> dstTracks = strack == mu::nidx ? std::vector<track_idx_t>() : mu::values(trackList, srcTrack);
+            const bool allVoicesMapped = strack != mu::nidx && trackList.size() == (score->excerpt()->nstaves() * VOICES);
+
             Tremolo* tremolo = 0;
             for (Segment* oseg = m->first(); oseg; oseg = oseg->next()) {
                 Segment* ns = nullptr;           //create segment later, on demand
@@ -795,18 +854,15 @@ static MeasureBase* cloneMeasure(MeasureBase* mb, Score* score, const Score* osc
                 }
 
                 //If track is not mapped skip the following
-                if (mu::value(trackList, srcTrack, mu::nidx) == mu::nidx) {
+                if (strack == mu::nidx) {
                     continue;
                 }
 
-                //There are probably more destination tracks for the same source
-                std::vector<track_idx_t> t = mu::values(trackList, srcTrack);
-
-                for (track_idx_t track : t) {
+                for (track_idx_t track : dstTracks) {
                     //Clone KeySig TimeSig and Clefs if voice 1 of source staff is not mapped to a track
                     EngravingItem* oef = oseg->element(trackZeroVoice(srcTrack));
                     if (oef && !oef->generated() && (oef->isTimeSig() || oef->isKeySig())
-                        && !(trackList.size() == (score->excerpt()->nstaves() * VOICES))) {
+                        && !allVoicesMapped) {
                         EngravingItem* ne = oef->linkedClone();
                         ne->setTrack(trackZeroVoice(track));
                         ne->setScore(score);
@@ -1532,7 +1588,7 @@ std::vector<Excerpt*> Excerpt::createExcerptsFromParts(const std::vector<Part*>&
         excerpt->parts().push_back(part);
 
         for (track_idx_t i = part->startTrack(), j = 0; i < part->endTrack(); ++i, ++j) {
-            excerpt->tracksMapping().insert({ i, j });
+            excerpt->addTrackMapping(i, j);
         }
 
         String name = formatName(part->partName(), result);
@@ -71,8 +71,12 @@ public:
     size_t nstaves() const;
     bool isEmpty() const;
 
-    TracksMap& tracksMapping();
+    const TracksMap& tracksMapping();
     void setTracksMapping(const TracksMap& tracksMapping);
+    void addTrackMapping(track_idx_t masterTrack, track_idx_t excerptTrack);
+
+    // reverse lookup of tracksMapping(), mu::nidx if the excerpt track is not mapped
+    track_idx_t masterTrack(track_idx_t excerptTrack);
 
     void setVoiceVisible(Staff* staff, int voiceIndex, bool visible);
 
@@ -98,6 +102,7 @@ private:
     void writeNameToMetaTags();
 
     void updateTracksMapping(bool voicesVisibilityChanged = false);
+    void updateMasterTracks();
 
     MasterScore* m_masterScore = nullptr;
     Score* m_excerptScore = nullptr;
@@ -106,6 +111,7 @@ private:
     std::vector<Part*> m_parts;
     std::vector<Staff*> m_cachedStaves;
     TracksMap m_tracksMapping;
+    std::vector<track_idx_t> m_masterTracks; // excerpt track -> master track
     bool m_inited = false;
     ID m_initialPartId;
 };
@@ -157,9 +157,7 @@ void Fingering::layout()
                     movePosY(-1.5 * sp);
                 } else {
                     RectF r = bbox().translated(m->pos() + s->pos() + chord->pos() + n->pos() + pos());
-                    SkylineLine sk(false);
-                    sk.add(r.x(), r.bottom(), r.width());
-                    double d = sk.minDistance(ss->skyline().north());
+                    double d = ss->skyline().north().minDistance(r.x(), r.bottom(), r.width());
                     double yd = 0.0;
                     if (d > 0.0 && isStyled(Pid::MIN_DISTANCE)) {
                         yd -= d + height() * .25;
@@ -193,9 +191,7 @@ void Fingering::layout()
                     movePosY(1.5 * sp);
                 } else {
                     RectF r = bbox().translated(m->pos() + s->pos() + chord->pos() + n->pos() + pos());
-                    SkylineLine sk(true);
-                    sk.add(r.x(), r.top(), r.width());
-                    double d = ss->skyline().south().minDistance(sk);
+                    double d = ss->skyline().south().minDistance(r.x(), r.top(), r.width());
                     double yd = 0.0;
                     if (d > 0.0 && isStyled(Pid::MIN_DISTANCE)) {
                         yd += d + height() * .25;
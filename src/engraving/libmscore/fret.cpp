@@ -551,9 +551,7 @@ void FretDiagram::layout()
         RectF r = _harmony->bbox().translated(m->pos() + s->pos() + pos() + _harmony->pos());
 
         double minDistance = _harmony->minDistance().val() * spatium();
-        SkylineLine sk(false);
-        sk.add(r.x(), r.bottom(), r.width());
-        double d = sk.minDistance(ss->skyline().north());
+        double d = ss->skyline().north().minDistance(r.x(), r.bottom(), r.width());
         if (d > -minDistance) {
             double yd = d + minDistance;
             yd *= -1.0;
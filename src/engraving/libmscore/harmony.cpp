@@ -29,6 +29,9 @@
 #include "draw/fontmetrics.h"
 #include "draw/types/brush.h"
 #include "draw/types/pen.h"
+
+#include "infrastructure/textmetricscache.h"
+
 #include "rw/writecontext.h"
 #include "rw/xml.h"
 
@@ -1623,7 +1626,8 @@ TextSegment::TextSegment(const String& s, const mu::draw::Font& f, double x, dou
 
 double TextSegment::width() const
 {
-    return mu::draw::FontMetrics::width(m_font, text);
+    //! NOTE Chord symbols are made of the same few parts (roots, accidentals, "maj7", "sus4" ...)
+    return TextMetricsCache::runInfo(m_font, text).width;
 }
 
 //---------------------------------------------------------
@@ -1641,7 +1645,7 @@ RectF TextSegment::boundingRect() const
 
 RectF TextSegment::tightBoundingRect() const
 {
-    return mu::draw::FontMetrics::tightBoundingRect(m_font, text);
+    return TextMetricsCache::runInfo(m_font, text).tightBoundingRect;
 }
 
 //---------------------------------------------------------
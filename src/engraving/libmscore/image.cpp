@@ -22,6 +22,8 @@
 
 #include "image.h"
 
+#include <cmath>
+
 #include "io/file.h"
 #include "io/fileinfo.h"
 
@@ -73,6 +75,7 @@ Image::Image(const Image& img)
 {
     imageType        = img.imageType;
     buffer           = img.buffer;
+    _bufferScale     = img._bufferScale;
     _size            = img._size;
     _lockAspectRatio = img._lockAspectRatio;
     _autoScale       = img._autoScale;
@@ -85,7 +88,8 @@ Image::Image(const Image& img)
     _linkPath        = img._linkPath;
     _linkIsValid     = img._linkIsValid;
     if (imageType == ImageType::RASTER) {
-        rasterDoc = img.rasterDoc ? std::make_shared<Pixmap>(*img.rasterDoc) : nullptr;
+        //! NOTE the decoded pixmap is never modified, so copies share it
+        rasterDoc = img.rasterDoc;
     } else if (imageType == ImageType::SVG) {
         svgDoc = img.svgDoc ? new SvgRenderer(_storeItem->buffer()) : 0;
     }
@@ -171,17 +175,34 @@ void Image::draw(mu::draw::Painter* painter) const
                 painter->drawPixmap(PointF(0, 0), *rasterDoc);
             } else {
                 Transform t = painter->worldTransform();
-                Size ss = Size(s.width() * t.m11(), s.height() * t.m22());
+                SizeF ss = SizeF(s.width() * t.m11(), s.height() * t.m22());
                 t.setMatrix(1.0, t.m12(), t.m13(), t.m21(), 1.0, t.m23(), t.m31(), t.m32(), t.m33());
                 painter->setWorldTransform(t);
-                if ((buffer.size() != ss || _dirty) && rasterDoc && !rasterDoc->isNull()) {
-                    buffer = imageProvider()->scaled(*rasterDoc, ss);
-                    _dirty = false;
+
+                //! NOTE Don't rescale the image on every zoom step: from full
+                //! resolution upwards the painter scales the original pixmap,
+                //! below it a downscaled copy is kept per zoom bucket
+                const double scale = rasterDoc->isNull() ? 0.0 : ss.width() / rasterDoc->width();
+                const double bucket = bufferScaleBucket(scale);
+                const Pixmap* pixmap = rasterDoc.get();
+                if (bucket < 1.0) {
+                    if (_bufferScale != bucket || _dirty || buffer.isNull()) {
+                        Size bs = Size(std::max(1, int(rasterDoc->width() * bucket + 0.5)),
+                                       std::max(1, int(rasterDoc->height() * bucket + 0.5)));
+                        buffer = imageProvider()->scaled(*rasterDoc, bs);
+                        _bufferScale = bucket;
+                        _dirty = false;
+                    }
+                    pixmap = &buffer;
+                } else if (!buffer.isNull()) {
+                    buffer = Pixmap();
+                    _bufferScale = 0.0;
                 }
-                if (buffer.isNull()) {
+                if (pixmap->isNull()) {
                     emptyImage = true;
                 } else {
-                    painter->drawPixmap(PointF(0.0, 0.0), buffer);
+                    painter->scale(ss.width() / pixmap->width(), ss.height() / pixmap->height());
+                    painter->drawPixmap(PointF(0.0, 0.0), *pixmap);
                 }
             }
             painter->restore();
@@ -540,6 +561,20 @@ SizeF Image::size2pixel(const SizeF& s) const
     return s * (_sizeIsSpatium ? spatium() : DPMM);
 }
 
+//---------------------------------------------------------
+//   bufferScaleBucket
+//    round a downscale factor up to the next power of sqrt(2),
+//    1.0 means the original pixmap is used
+//---------------------------------------------------------
+
+double Image::bufferScaleBucket(double scale)
+{
+    if (scale <= 0.0 || scale >= 1.0) {
+        return 1.0;
+    }
+    return std::min(1.0, std::pow(2.0, std::ceil(std::log2(scale) * 2.0) / 2.0));
+}
+
 //---------------------------------------------------------
 //   layout
 //---------------------------------------------------------
@@ -553,8 +588,8 @@ void Image::layout()
         }
     } else if (imageType == ImageType::RASTER && !rasterDoc) {
         if (_storeItem) {
-            rasterDoc = imageProvider()->createPixmap(_storeItem->buffer());
-            if (!rasterDoc->isNull()) {
+            rasterDoc = _storeItem->rasterPixmap();
+            if (rasterDoc && !rasterDoc->isNull()) {
                 _dirty = true;
             }
         }
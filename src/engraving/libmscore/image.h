@@ -101,7 +101,8 @@ protected:
     String _storePath;             // the path of the img in the ImageStore
     String _linkPath;              // the path of an external linked img
     bool _linkIsValid;              // whether _linkPath file exists or not
-    mutable mu::draw::Pixmap buffer;         ///< cached rendering
+    mutable mu::draw::Pixmap buffer;         ///< cached downscaled rendering
+    mutable double _bufferScale = 0.0;       ///< zoom bucket buffer was rendered for
     mu::SizeF _size;                   // in mm or spatium units
     bool _lockAspectRatio;
     bool _autoScale;                ///< fill parent frame
@@ -116,6 +117,7 @@ protected:
 private:
     mu::SizeF pixel2size(const mu::SizeF& s) const;
     mu::SizeF size2pixel(const mu::SizeF& s) const;
+    static double bufferScaleBucket(double scale);
 
     std::shared_ptr<mu::draw::Pixmap> rasterDoc;
     mu::draw::SvgRenderer* svgDoc = nullptr;
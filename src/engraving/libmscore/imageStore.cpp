@@ -98,6 +98,24 @@ void ImageStoreItem::load()
     inFile.close();
 
     _hash = cryptographicHash()->hash(_buffer, ICryptographicHash::Algorithm::Md4);
+    _rasterPixmap.reset();
+}
+
+//---------------------------------------------------------
+//   rasterPixmap
+//    decode the image data on first use; the decoded pixmap
+//    is shared by all images referencing this item and freed
+//    together with the last of them
+//---------------------------------------------------------
+
+std::shared_ptr<draw::Pixmap> ImageStoreItem::rasterPixmap()
+{
+    std::shared_ptr<draw::Pixmap> pixmap = _rasterPixmap.lock();
+    if (!pixmap && !_buffer.empty()) {
+        pixmap = imageProvider()->createPixmap(_buffer);
+        _rasterPixmap = pixmap;
+    }
+    return pixmap;
 }
 
 //---------------------------------------------------------
@@ -138,6 +156,15 @@ inline static int toInt(char c)
     return c - 'a' + 10;
 }
 
+//---------------------------------------------------------
+//   hashKey
+//---------------------------------------------------------
+
+inline static std::string hashKey(const ByteArray& hash)
+{
+    return std::string(reinterpret_cast<const char*>(hash.constData()), hash.size());
+}
+
 //---------------------------------------------------------
 //   ~ImageStore
 //---------------------------------------------------------
@@ -169,10 +196,9 @@ ImageStoreItem* ImageStore::getImage(const path_t& path) const
     for (int i = 0; i < 16; ++i) {
         hash[i] = toInt(s.at(i * 2).toAscii()) * 16 + toInt(s.at(i * 2 + 1).toAscii());
     }
-    for (ImageStoreItem* item : _items) {
-        if (item->hash() == hash) {
-            return item;
-        }
+    auto it = _itemsByHash.find(hashKey(hash));
+    if (it != _itemsByHash.end()) {
+        return it->second;
     }
     LOGW() << "image not found: " << path;
     return nullptr;
@@ -185,12 +211,11 @@ ImageStoreItem* ImageStore::getImage(const path_t& path) const
 ImageStoreItem* ImageStore::add(const path_t& path, const ByteArray& ba)
 {
     ByteArray hash = cryptographicHash()->hash(ba, ICryptographicHash::Algorithm::Md4);
-    for (ImageStoreItem* item : _items) {
-        if (item->hash() == hash) {
-            return item;
-        }
+    ImageStoreItem*& item = _itemsByHash[hashKey(hash)];
+    if (item) {
+        return item;
     }
-    ImageStoreItem* item = new ImageStoreItem(path);
+    item = new ImageStoreItem(path);
     item->set(ba, hash);
     _items.push_back(item);
     return item;
@@ -203,9 +228,13 @@ ImageStoreItem* ImageStore::add(const path_t& path, const ByteArray& ba)
 void ImageStore::clearUnused()
 {
     _items.erase(
-        std::remove_if(_items.begin(), _items.end(), [](ImageStoreItem* i) {
+        std::remove_if(_items.begin(), _items.end(), [this](ImageStoreItem* i) {
         const bool remove = !i->isUsed();
         if (remove) {
+            auto it = _itemsByHash.find(hashKey(i->hash()));
+            if (it != _itemsByHash.end() && it->second == i) {
+                _itemsByHash.erase(it);
+            }
             delete i;
         }
         return remove;
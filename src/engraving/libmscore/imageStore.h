@@ -24,6 +24,8 @@
 #define __IMAGE_CACHE_H__
 
 #include <list>
+#include <memory>
+#include <unordered_map>
 
 #include "types/string.h"
 #include "types/bytearray.h"
@@ -31,6 +33,7 @@
 
 #include "modularity/ioc.h"
 #include "global/icryptographichash.h"
+#include "draw/iimageprovider.h"
 
 namespace mu::engraving {
 class Image;
@@ -43,12 +46,14 @@ class Score;
 class ImageStoreItem
 {
     INJECT(engraving, ICryptographicHash, cryptographicHash)
+    INJECT(engraving, mu::draw::IImageProvider, imageProvider)
 
     std::list<Image*> _references;
     io::path_t _path;                  // original location of image
     String _type;                  // image type (file extension)
     mu::ByteArray _buffer;
     mu::ByteArray _hash;               // 16 byte md4 hash of _buffer
+    std::weak_ptr<mu::draw::Pixmap> _rasterPixmap; // decoded _buffer, shared by all referencing images
 
 public:
     ImageStoreItem(const io::path_t& p);
@@ -65,7 +70,9 @@ public:
     void load();
     String hashName() const;
     const mu::ByteArray& hash() const { return _hash; }
-    void set(const mu::ByteArray& b, const mu::ByteArray& h) { _buffer = b; _hash = h; }
+    void set(const mu::ByteArray& b, const mu::ByteArray& h) { _buffer = b; _hash = h; _rasterPixmap.reset(); }
+
+    std::shared_ptr<mu::draw::Pixmap> rasterPixmap();
 };
 
 //---------------------------------------------------------
@@ -78,6 +85,7 @@ class ImageStore
 
     typedef std::vector<ImageStoreItem*> ItemList;
     ItemList _items;
+    std::unordered_map<std::string, ImageStoreItem*> _itemsByHash;
 
 public:
     ImageStore() = default;
@@ -22,6 +22,8 @@
 
 #include "instrtemplate.h"
 
+#include <unordered_map>
+
 #include "io/file.h"
 
 #include "containers.h"
@@ -51,6 +53,56 @@ std::vector<InstrumentGenre*> instrumentGenres;
 std::vector<InstrumentFamily*> instrumentFamilies;
 std::vector<ScoreOrder> instrumentOrders;
 
+//---------------------------------------------------------
+//   TemplateLookup
+//    index of the loaded templates, rebuilt after every load;
+//    for duplicated keys the first template wins, like in a linear search
+//---------------------------------------------------------
+
+struct TemplatePosition {
+    int groupIndex = 0;
+    int instrIndex = 0;
+    InstrumentTemplate* templ = nullptr;
+};
+
+struct TemplateLookup {
+    std::unordered_map<String, TemplatePosition> byId;
+    std::unordered_map<String, TemplatePosition> byTrackName;
+    std::unordered_map<String, InstrumentTemplate*> byMusicXmlId;
+    int templateCount = 0;
+
+    void clear()
+    {
+        byId.clear();
+        byTrackName.clear();
+        byMusicXmlId.clear();
+        templateCount = 0;
+    }
+};
+
+static TemplateLookup s_templateLookup;
+//! NOTE The lookup is rebuilt at the end of loadInstrumentTemplates(), the templates read before are searched in the groups
+static bool s_loadingTemplates = false;
+
+static void rebuildTemplateLookup()
+{
+    s_templateLookup.clear();
+
+    int instIndex = 0;
+    int grpIndex = 0;
+    for (InstrumentGroup* g : instrumentGroups) {
+        for (InstrumentTemplate* it : g->instrumentTemplates) {
+            s_templateLookup.byId.emplace(it->id, TemplatePosition { grpIndex, instIndex, it });
+            s_templateLookup.byTrackName.emplace(it->trackName, TemplatePosition { grpIndex, instIndex, it });
+            s_templateLookup.byMusicXmlId.emplace(it->musicXMLid, it);
+            ++instIndex;
+        }
+        ++grpIndex;
+    }
+
+    s_templateLookup.templateCount = instIndex;
+}
+
 //---------------------------------------------------------
 //   InstrumentIndex
 //---------------------------------------------------------
@@ -651,6 +703,7 @@ void clearInstrumentTemplates()
     instrumentFamilies.clear();
     midiArticulations.clear();
     instrumentOrders.clear();
+    s_templateLookup.clear();
 }
 
 //---------------------------------------------------------
@@ -665,6 +718,8 @@ bool loadInstrumentTemplates(const io::path_t& instrTemplatesPath)
         return false;
     }
 
+    s_loadingTemplates = true;
+
     XmlReader e(&qf);
     while (e.readNextStartElement()) {
         if (e.name() == "museScore") {
@@ -711,6 +766,9 @@ bool loadInstrumentTemplates(const io::path_t& instrTemplatesPath)
         }
     }
 
+    s_loadingTemplates = false;
+    rebuildTemplateLookup();
+
     return true;
 }
 
@@ -720,14 +778,22 @@ bool loadInstrumentTemplates(const io::path_t& instrTemplatesPath)
 
 InstrumentTemplate* searchTemplate(const String& name)
 {
-    for (InstrumentGroup* g : instrumentGroups) {
-        for (InstrumentTemplate* it : g->instrumentTemplates) {
-            if (it->id == name) {
-                return it;
+    auto it = s_templateLookup.byId.find(name);
+    if (it != s_templateLookup.byId.end()) {
+        return it->second.templ;
+    }
+
+    if (s_loadingTemplates) {
+        for (InstrumentGroup* g : instrumentGroups) {
+            for (InstrumentTemplate* t : g->instrumentTemplates) {
+                if (t->id == name) {
+                    return t;
+                }
             }
         }
     }
-    return 0;
+
+    return nullptr;
 }
 
 //---------------------------------------------------------
@@ -736,14 +802,8 @@ InstrumentTemplate* searchTemplate(const String& name)
 
 InstrumentTemplate* searchTemplateForMusicXmlId(const String& mxmlId)
 {
-    for (InstrumentGroup* g : instrumentGroups) {
-        for (InstrumentTemplate* it : g->instrumentTemplates) {
-            if (it->musicXMLid == mxmlId) {
-                return it;
-            }
-        }
-    }
-    return 0;
+    auto it = s_templateLookup.byMusicXmlId.find(mxmlId);
+    return it != s_templateLookup.byMusicXmlId.end() ? it->second : nullptr;
 }
 
 InstrumentTemplate* searchTemplateForInstrNameList(const std::list<String>& nameList, bool useDrumset)
@@ -814,18 +874,13 @@ InstrumentTemplate* searchTemplateForMidiProgram(int bank, int program, bool use
 
 InstrumentIndex searchTemplateIndexForTrackName(const String& trackName)
 {
-    int instIndex = 0;
-    int grpIndex = 0;
-    for (InstrumentGroup* g : instrumentGroups) {
-        for (InstrumentTemplate* it : g->instrumentTemplates) {
-            if (it->trackName == trackName) {
-                return InstrumentIndex(grpIndex, instIndex, it);
-            }
-            ++instIndex;
-        }
-        ++grpIndex;
+    auto it = s_templateLookup.byTrackName.find(trackName);
+    if (it == s_templateLookup.byTrackName.end()) {
+        return InstrumentIndex(-1, -1, nullptr);
     }
-    return InstrumentIndex(-1, -1, nullptr);
+
+    const TemplatePosition& pos = it->second;
+    return InstrumentIndex(pos.groupIndex, pos.instrIndex, pos.templ);
 }
 
 //---------------------------------------------------------
@@ -834,18 +889,13 @@ InstrumentIndex searchTemplateIndexForTrackName(const String& trackName)
 
 InstrumentIndex searchTemplateIndexForId(const String& id)
 {
-    int instIndex = 0;
-    int grpIndex = 0;
-    for (InstrumentGroup* g : instrumentGroups) {
-        for (InstrumentTemplate* it : g->instrumentTemplates) {
-            if (it->id == id) {
-                return InstrumentIndex(grpIndex, instIndex, it);
-            }
-            ++instIndex;
-        }
-        ++grpIndex;
+    auto it = s_templateLookup.byId.find(id);
+    if (it == s_templateLookup.byId.end()) {
+        return InstrumentIndex(-1, s_templateLookup.templateCount, nullptr);
     }
-    return InstrumentIndex(-1, instIndex, nullptr);
+
+    const TemplatePosition& pos = it->second;
+    return InstrumentIndex(pos.groupIndex, pos.instrIndex, pos.templ);
 }
 
 //---------------------------------------------------------
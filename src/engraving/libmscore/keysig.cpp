@@ -23,6 +23,7 @@
 #include "keysig.h"
 
 #include "draw/types/pen.h"
+#include "iengravingfont.h"
 #include "rw/xml.h"
 #include "types/symnames.h"
 #include "types/typesconv.h"
@@ -366,10 +367,16 @@ void KeySig::draw(mu::draw::Painter* painter) const
     int lines = staff() ? staff()->staffTypeForElement(this)->lines() : 5;
     double ledgerLineWidth = score()->styleMM(Sid::ledgerLineWidth) * mag();
     double ledgerExtraLen = score()->styleS(Sid::ledgerLineLength).val() * _spatium;
+
+    SymbolPositions symbols;
+    for (const KeySym& ks: _sig.keySymbols()) {
+        symbols.push_back({ ks.sym, PointF(ks.xPos * _spatium, ks.line * step) });
+    }
+    drawSymbols(symbols, painter);
+
     for (const KeySym& ks: _sig.keySymbols()) {
         double x = ks.xPos * _spatium;
         double y = ks.line * step;
-        drawSymbol(ks.sym, painter, PointF(x, y));
         // ledger lines
         double _symWidth = symWidth(ks.sym);
         double x1 = x - ledgerExtraLen;
@@ -39,15 +39,27 @@ namespace mu::engraving {
 
 LedgerLine::LedgerLine(Score* s)
     : EngravingItem(ElementType::LEDGER_LINE, s)
+{
+    initLine();
+}
+
+LedgerLine::~LedgerLine()
+{
+}
+
+void LedgerLine::initLine()
 {
     setSelectable(false);
     _width      = 0.;
     _len        = 0.;
     _next       = 0;
+    vertical    = false;
 }
 
-LedgerLine::~LedgerLine()
+void LedgerLine::resetLine()
 {
+    resetItemState();
+    initLine();
 }
 
 //---------------------------------------------------------
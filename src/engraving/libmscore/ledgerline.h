@@ -46,6 +46,8 @@ class LedgerLine final : public EngravingItem
     LedgerLine* _next;
     bool vertical { false };
 
+    void initLine();
+
 public:
     LedgerLine(Score*);
     ~LedgerLine();
@@ -68,6 +70,9 @@ public:
     LedgerLine* next() const { return _next; }
     void setNext(LedgerLine* l) { _next = l; }
 
+    //! NOTE Sets back the state of a new line, see Chord::takeLedgerLine()
+    void resetLine();
+
     void writeProperties(XmlWriter& xml) const override;
     bool readProperties(XmlReader&) override;
     void spatiumChanged(double /*oldValue*/, double /*newValue*/) override;
@@ -182,6 +182,8 @@ set(LIBMSCORE_SRC
     ${CMAKE_CURRENT_LIST_DIR}/measurenumberbase.h
     ${CMAKE_CURRENT_LIST_DIR}/measurerepeat.cpp
     ${CMAKE_CURRENT_LIST_DIR}/measurerepeat.h
+    ${CMAKE_CURRENT_LIST_DIR}/memoryreport.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/memoryreport.h
     ${CMAKE_CURRENT_LIST_DIR}/midimapping.cpp
     ${CMAKE_CURRENT_LIST_DIR}/mmrest.cpp
     ${CMAKE_CURRENT_LIST_DIR}/mmrest.h
@@ -21,6 +21,7 @@
  */
 #include "linkedobjects.h"
 
+#include "engravingitem.h"
 #include "masterscore.h"
 #include "measure.h"
 #include "score.h"
@@ -58,6 +59,25 @@ bool LinkedObjects::contains(const EngravingObject* o) const
     return std::find(this->begin(), this->end(), o) != this->end();
 }
 
+//---------------------------------------------------------
+//   findItem
+//    Returns the linked item of the given score on the
+//    given track, without copying the list like linkList().
+//---------------------------------------------------------
+
+EngravingItem* LinkedObjects::findItem(const Score* score, track_idx_t track) const
+{
+    for (EngravingObject* o : *this) {
+        if (o->score() == score && o->isEngravingItem()) {
+            EngravingItem* item = toEngravingItem(o);
+            if (item->track() == track) {
+                return item;
+            }
+        }
+    }
+    return nullptr;
+}
+
 //---------------------------------------------------------
 //   mainElement
 //    Returns "main" linked element which is expected to
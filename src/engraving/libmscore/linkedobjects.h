@@ -27,6 +27,8 @@
 #include "engravingobject.h"
 
 namespace mu::engraving {
+class EngravingItem;
+
 class LinkedObjects : public std::list<EngravingObject*>
 {
     OBJECT_ALLOCATOR(engraving, LinkedObjects)
@@ -41,6 +43,7 @@ public:
     int lid() const { return _lid; }
 
     bool contains(const EngravingObject* o) const;
+    EngravingItem* findItem(const Score* score, track_idx_t track) const;
 
     EngravingObject* mainElement();
 };
@@ -24,7 +24,10 @@
 #include "types/datetime.h"
 #include "io/buffer.h"
 
+#include "concurrency/taskscheduler.h"
+
 #include "compat/writescorehook.h"
+#include "layout/layoutcontext.h"
 #include "infrastructure/mscwriter.h"
 #include "rw/scorereader.h"
 #include "rw/xml.h"
@@ -444,6 +447,95 @@ Score* MasterScore::createScore(const MStyle& s)
     return new Score(this, s);
 }
 
+//---------------------------------------------------------
+//   doLayoutScoresRange
+//    The layouts of the excerpts are independent of each other
+//    but share the cmd state, the undo stack and the fonts with
+//    the master score: the cmd state stays locked during all of
+//    them and the fonts are loaded before. In a command the undo
+//    commands pushed by each layout are kept in a buffer of its
+//    own and added to the command after all of them, in the order
+//    of the scores. The multimeasure rests link elements of several
+//    scores, they are created by a serial pass before. The other
+//    changes of each layout are kept to its own score.
+//    The master score and the scores shown in views are laid out
+//    on the calling thread before.
+//    Returns the number of excerpts laid out concurrently.
+//---------------------------------------------------------
+
+size_t MasterScore::doLayoutScoresRange(const std::vector<Score*>& scores, const Fraction& st, const Fraction& et)
+{
+    TRACEFUNC;
+
+    std::vector<Score*> excerptScores;
+    for (Score* s : scores) {
+        // views are notified of the layout on the calling thread
+        if (s == this || !s->getViewer().empty()) {
+            s->doLayoutRange(st, et);
+        } else {
+            excerptScores.push_back(s);
+        }
+    }
+
+    if (excerptScores.size() < 2 || !layoutOptions().parallelExcerptsLayout
+        || LayoutContext::workers()->threadPoolSize() < 2) {
+        for (Score* s : excerptScores) {
+            s->doLayoutRange(st, et);
+        }
+        return 0;
+    }
+
+    engravingFonts()->fallbackFont();
+    for (Score* s : excerptScores) {
+        engravingFonts()->fontByName(s->style().value(Sid::MusicalSymbolFont).value<String>().toStdString());
+    }
+
+    CmdState& cs = cmdState();
+    bool wasLocked = cs.locked();
+    cs.lock();
+
+    std::vector<LayoutOptions> options;
+    for (Score* s : excerptScores) {
+        options.push_back(s->m_layoutOptions);
+        if (s->styleB(Sid::createMultiMeasureRests)) {
+            s->m_layout.prepareMMRests(s->m_layoutOptions, st, et);
+            s->m_layoutOptions.mmRestsPrepared = true;
+        }
+        // the layout runs on a worker itself, its own tasks could wait for each other
+        s->m_layoutOptions.parallelPartsLayout = false;
+        s->m_layoutOptions.pipelinedPageLayout = false;
+        s->m_layoutOptions.concurrentLinkedScores = true;
+    }
+
+    std::vector<UndoStack::CommandList> commands(excerptScores.size());
+    std::vector<std::future<void> > futures;
+    for (size_t i = 0; i < excerptScores.size(); ++i) {
+        Score* s = excerptScores[i];
+        UndoStack::CommandList* buffer = &commands[i];
+        futures.push_back(LayoutContext::workers()->submit([s, buffer, st, et]() {
+            UndoStack::setThreadCommandBuffer(buffer);
+            s->doLayoutRange(st, et);
+            UndoStack::setThreadCommandBuffer(nullptr);
+        }));
+    }
+    for (size_t i = 0; i < futures.size(); ++i) {
+        futures[i].get();
+        excerptScores[i]->m_layoutOptions.parallelPartsLayout = options[i].parallelPartsLayout;
+        excerptScores[i]->m_layoutOptions.pipelinedPageLayout = options[i].pipelinedPageLayout;
+        excerptScores[i]->m_layoutOptions.mmRestsPrepared = false;
+        excerptScores[i]->m_layoutOptions.concurrentLinkedScores = false;
+    }
+    for (UndoStack::CommandList& cmds : commands) {
+        undoStack()->appendCommands(cmds);
+    }
+
+    if (!wasLocked) {
+        cs.unlock();
+    }
+
+    return excerptScores.size();
+}
+
 //---------------------------------------------------------
 //   setPos
 //---------------------------------------------------------
@@ -496,6 +588,9 @@ void MasterScore::setSoloMute()
 void MasterScore::setUpdateAll()
 {
     _cmdState.setUpdateMode(UpdateMode::UpdateAll);
+    for (Score* s : scoreList()) {
+        s->setPaintDamageAll();
+    }
 }
 
 //---------------------------------------------------------
@@ -215,6 +215,10 @@ public:
     void initExcerpt(Excerpt*);
     void initEmptyExcerpt(Excerpt*);
 
+    //! Lays out the range of the given scores (this one and its excerpts),
+    //! the excerpts concurrently if possible, returns the number of excerpts laid out concurrently
+    size_t doLayoutScoresRange(const std::vector<Score*>& scores, const Fraction& st, const Fraction& et);
+
     void setPlaybackScore(Score*);
     Score* playbackScore() { return _playbackScore; }
     const Score* playbackScore() const { return _playbackScore; }
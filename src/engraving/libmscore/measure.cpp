@@ -27,6 +27,7 @@
 
 #include "measure.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include "realfn.h"
@@ -793,15 +794,10 @@ Chord* Measure::findChord(Fraction t, track_idx_t track)
 ChordRest* Measure::findChordRest(Fraction t, track_idx_t track)
 {
     t -= tick();
-    for (const Segment& seg : m_segments) {
-        if (seg.rtick() > t) {
-            return 0;
-        }
-        if (seg.rtick() == t) {
-            EngravingItem* el = seg.element(track);
-            if (el && el->isChordRest()) {
-                return toChordRest(el);
-            }
+    for (Segment* seg = m_segments.lowerBound(t); seg && seg->rtick() == t; seg = seg->next()) {
+        EngravingItem* el = seg->element(track);
+        if (el && el->isChordRest()) {
+            return toChordRest(el);
         }
     }
     return 0;
@@ -813,18 +809,7 @@ ChordRest* Measure::findChordRest(Fraction t, track_idx_t track)
 
 Segment* Measure::tick2segment(const Fraction& _t, SegmentType st)
 {
-    Fraction t = _t - tick();
-    for (Segment& s : m_segments) {
-        if (s.rtick() == t) {
-            if (s.segmentType() & st) {
-                return &s;
-            }
-        }
-        if (s.rtick() > t) {
-            break;
-        }
-    }
-    return 0;
+    return findSegmentR(st, _t - tick());
 }
 
 //---------------------------------------------------------
@@ -835,20 +820,10 @@ Segment* Measure::tick2segment(const Fraction& _t, SegmentType st)
 
 Segment* Measure::findSegmentR(SegmentType st, const Fraction& t) const
 {
-    Segment* s;
-    if (t > (ticks() * Fraction(1, 2))) {
-        // search backwards
-        for (s = last(); s && s->rtick() > t; s = s->prev()) {
-        }
-        while (s && s->prev() && s->prev()->rtick() == t) {
-            s = s->prev();
-        }
-    } else {
-        // search forwards
-        for (s = first(); s && s->rtick() < t; s = s->next()) {
-        }
+    if (!m_segments.hasType(st)) {
+        return 0;
     }
-    for (; s && s->rtick() == t; s = s->next()) {
+    for (Segment* s = m_segments.lowerBound(t); s && s->rtick() == t; s = s->next()) {
         if (s->segmentType() & st) {
             return s;
         }
@@ -2666,6 +2641,7 @@ Measure* Measure::cloneMeasure(Score* sc, const Fraction& tick, TieMap* tieMap)
 
     size_t tracks = sc->nstaves() * VOICES;
     TupletMap tupletMap;
+    std::vector<EngravingItem*> annotations;
 
     for (Segment* oseg = first(); oseg; oseg = oseg->next()) {
         Segment* s = Factory::createSegment(m, oseg->segmentType(), oseg->rtick());
@@ -2675,18 +2651,27 @@ Measure* Measure::cloneMeasure(Score* sc, const Fraction& tick, TieMap* tieMap)
         s->setTrailer(oseg->trailer());
 
         m->m_segments.push_back(s);
+
+        // annotations are added in track order, like the elements
+        annotations.clear();
+        for (EngravingItem* e : oseg->annotations()) {
+            if (!e->generated() && e->track() < tracks) {
+                annotations.push_back(e);
+            }
+        }
+        std::stable_sort(annotations.begin(), annotations.end(), [](const EngravingItem* a, const EngravingItem* b) {
+            return a->track() < b->track();
+        });
+        for (EngravingItem* e : annotations) {
+            EngravingItem* ne = e->clone();
+            ne->setTrack(e->track());
+            ne->setOffset(e->offset());
+            ne->setScore(sc);
+            s->add(ne);
+        }
+
         for (track_idx_t track = 0; track < tracks; ++track) {
             EngravingItem* oe = oseg->element(track);
-            for (EngravingItem* e : oseg->annotations()) {
-                if (e->generated() || e->track() != track) {
-                    continue;
-                }
-                EngravingItem* ne = e->clone();
-                ne->setTrack(track);
-                ne->setOffset(e->offset());
-                ne->setScore(sc);
-                s->add(ne);
-            }
             if (!oe) {
                 continue;
             }
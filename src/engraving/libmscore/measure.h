@@ -371,11 +371,37 @@ public:
 
     void stretchMeasureInPracticeMode(double stretch);
     double squeezableSpace() const { return _isWidthLocked ? 0.0 : _squeezableSpace; }
+    void setSqueezableSpace(double space) { _squeezableSpace = space; }
+
+    // result of the multimeasure rest emptiness check, kept while the measure is out of the changed range
+    struct MMRestCheck {
+        bool known = false;
+        bool empty = false;
+        size_t shownStaves = 0;     // key of the staves shown when checked
+    };
+    const MMRestCheck& mmRestCheck() const { return _mmRestCheck; }
+    void setMMRestCheck(const MMRestCheck& check) { _mmRestCheck = check; }
+
+    // content of the staves for hiding empty staves, kept while the measure is out of the changed range
+    struct StaffContent {
+        bool known = false;
+        std::vector<bool> empty;        // isEmpty() of each staff
+        std::vector<bool> movedInto;    // chords of another staff are moved into the staff
+    };
+    const StaffContent& staffContent() const { return _staffContent; }
+    void setStaffContent(StaffContent&& content) { _staffContent = std::move(content); }
+
+    // chords and rests whose beam may need updateCrossBeams(), see LayoutSystem::collectCrossBeamChordRests()
+    const std::vector<ChordRest*>& crossBeamChordRests() const { return _crossBeamChordRests; }
+    void setCrossBeamChordRests(std::vector<ChordRest*>&& chordRests) { _crossBeamChordRests = std::move(chordRests); }
 
     void respaceSegments();
 
 private:
     double _squeezableSpace = 0;
+    std::vector<ChordRest*> _crossBeamChordRests;
+    MMRestCheck _mmRestCheck;
+    StaffContent _staffContent;
     friend class Factory;
     friend class rw::MeasureRW;
 
@@ -0,0 +1,502 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "memoryreport.h"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_set>
+
+#include "global/allocator.h"
+#include "serialization/json.h"
+#include "types/typesconv.h"
+
+#include "layout/measurewidthcache.h"
+
+#include "accidental.h"
+#include "actionicon.h"
+#include "ambitus.h"
+#include "arpeggio.h"
+#include "articulation.h"
+#include "bagpembell.h"
+#include "barline.h"
+#include "beam.h"
+#include "bend.h"
+#include "box.h"
+#include "bracket.h"
+#include "breath.h"
+#include "chord.h"
+#include "chordline.h"
+#include "clef.h"
+#include "deadslapped.h"
+#include "dynamic.h"
+#include "fermata.h"
+#include "figuredbass.h"
+#include "fingering.h"
+#include "fret.h"
+#include "fretcircle.h"
+#include "glissando.h"
+#include "gradualtempochange.h"
+#include "hairpin.h"
+#include "harmonicmark.h"
+#include "harmony.h"
+#include "hook.h"
+#include "image.h"
+#include "imageStore.h"
+#include "instrchange.h"
+#include "instrumentname.h"
+#include "jump.h"
+#include "keysig.h"
+#include "layoutbreak.h"
+#include "ledgerline.h"
+#include "letring.h"
+#include "lyrics.h"
+#include "marker.h"
+#include "measure.h"
+#include "measurenumber.h"
+#include "measurerepeat.h"
+#include "mmrest.h"
+#include "mmrestrange.h"
+#include "note.h"
+#include "notedot.h"
+#include "noteline.h"
+#include "ottava.h"
+#include "page.h"
+#include "palmmute.h"
+#include "pedal.h"
+#include "pickscrape.h"
+#include "playtechannotation.h"
+#include "rasgueado.h"
+#include "rehearsalmark.h"
+#include "rest.h"
+#include "score.h"
+#include "segment.h"
+#include "slur.h"
+#include "spacer.h"
+#include "stafflines.h"
+#include "staffstate.h"
+#include "stafftext.h"
+#include "stafftype.h"
+#include "stafftypechange.h"
+#include "stem.h"
+#include "stemslash.h"
+#include "sticking.h"
+#include "stretchedbend.h"
+#include "symbol.h"
+#include "system.h"
+#include "systemdivider.h"
+#include "systemtext.h"
+#include "tempotext.h"
+#include "text.h"
+#include "textframe.h"
+#include "textline.h"
+#include "tie.h"
+#include "timesig.h"
+#include "tremolo.h"
+#include "tremolobar.h"
+#include "trill.h"
+#include "undo.h"
+#include "tripletfeel.h"
+#include "tuplet.h"
+#include "vibrato.h"
+#include "volta.h"
+#include "whammybar.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+namespace {
+struct RegisteredSource {
+    const void* owner = nullptr;
+    const Score* score = nullptr;
+    std::string subsystem;
+    MemoryReport::Source source;
+};
+
+struct Sources {
+    std::mutex mutex;
+    std::vector<RegisteredSource> list;
+};
+
+Sources& sources()
+{
+    static Sources s;
+    return s;
+}
+}
+
+//---------------------------------------------------------
+//   itemSize
+//    0 for the types which are not items of a score
+//---------------------------------------------------------
+
+size_t MemoryReport::itemSize(ElementType type)
+{
+    switch (type) {
+    case ElementType::SYMBOL: return sizeof(Symbol);
+    case ElementType::TEXT: return sizeof(Text);
+    case ElementType::MEASURE_NUMBER: return sizeof(MeasureNumber);
+    case ElementType::MMREST_RANGE: return sizeof(MMRestRange);
+    case ElementType::INSTRUMENT_NAME: return sizeof(InstrumentName);
+    case ElementType::SLUR_SEGMENT: return sizeof(SlurSegment);
+    case ElementType::TIE_SEGMENT: return sizeof(TieSegment);
+    case ElementType::BAR_LINE: return sizeof(BarLine);
+    case ElementType::STAFF_LINES: return sizeof(StaffLines);
+    case ElementType::SYSTEM_DIVIDER: return sizeof(SystemDivider);
+    case ElementType::STEM_SLASH: return sizeof(StemSlash);
+    case ElementType::ARPEGGIO: return sizeof(Arpeggio);
+    case ElementType::ACCIDENTAL: return sizeof(Accidental);
+    case ElementType::LEDGER_LINE: return sizeof(LedgerLine);
+    case ElementType::STEM: return sizeof(Stem);
+    case ElementType::NOTE: return sizeof(Note);
+    case ElementType::CLEF: return sizeof(Clef);
+    case ElementType::KEYSIG: return sizeof(KeySig);
+    case ElementType::AMBITUS: return sizeof(Ambitus);
+    case ElementType::TIMESIG: return sizeof(TimeSig);
+    case ElementType::REST: return sizeof(Rest);
+    case ElementType::MMREST: return sizeof(MMRest);
+    case ElementType::DEAD_SLAPPED: return sizeof(DeadSlapped);
+    case ElementType::BREATH: return sizeof(Breath);
+    case ElementType::MEASURE_REPEAT: return sizeof(MeasureRepeat);
+    case ElementType::TIE: return sizeof(Tie);
+    case ElementType::ARTICULATION: return sizeof(Articulation);
+    case ElementType::FERMATA: return sizeof(Fermata);
+    case ElementType::CHORDLINE: return sizeof(ChordLine);
+    case ElementType::DYNAMIC: return sizeof(Dynamic);
+    case ElementType::BEAM: return sizeof(Beam);
+    case ElementType::HOOK: return sizeof(Hook);
+    case ElementType::LYRICS: return sizeof(Lyrics);
+    case ElementType::FIGURED_BASS: return sizeof(FiguredBass);
+    case ElementType::MARKER: return sizeof(Marker);
+    case ElementType::JUMP: return sizeof(Jump);
+    case ElementType::FINGERING: return sizeof(Fingering);
+    case ElementType::TUPLET: return sizeof(Tuplet);
+    case ElementType::TEMPO_TEXT: return sizeof(TempoText);
+    case ElementType::STAFF_TEXT: return sizeof(StaffText);
+    case ElementType::SYSTEM_TEXT: return sizeof(SystemText);
+    case ElementType::PLAYTECH_ANNOTATION: return sizeof(PlayTechAnnotation);
+    case ElementType::TRIPLET_FEEL: return sizeof(TripletFeel);
+    case ElementType::REHEARSAL_MARK: return sizeof(RehearsalMark);
+    case ElementType::INSTRUMENT_CHANGE: return sizeof(InstrumentChange);
+    case ElementType::STAFFTYPE_CHANGE: return sizeof(StaffTypeChange);
+    case ElementType::HARMONY: return sizeof(Harmony);
+    case ElementType::FRET_DIAGRAM: return sizeof(FretDiagram);
+    case ElementType::BEND: return sizeof(Bend);
+    case ElementType::STRETCHED_BEND: return sizeof(StretchedBend);
+    case ElementType::TREMOLOBAR: return sizeof(TremoloBar);
+    case ElementType::VOLTA: return sizeof(Volta);
+    case ElementType::HAIRPIN_SEGMENT: return sizeof(HairpinSegment);
+    case ElementType::OTTAVA_SEGMENT: return sizeof(OttavaSegment);
+    case ElementType::TRILL_SEGMENT: return sizeof(TrillSegment);
+    case ElementType::LET_RING_SEGMENT: return sizeof(LetRingSegment);
+    case ElementType::GRADUAL_TEMPO_CHANGE_SEGMENT: return sizeof(GradualTempoChangeSegment);
+    case ElementType::VIBRATO_SEGMENT: return sizeof(VibratoSegment);
+    case ElementType::PALM_MUTE_SEGMENT: return sizeof(PalmMuteSegment);
+    case ElementType::WHAMMY_BAR_SEGMENT: return sizeof(WhammyBarSegment);
+    case ElementType::RASGUEADO_SEGMENT: return sizeof(RasgueadoSegment);
+    case ElementType::HARMONIC_MARK_SEGMENT: return sizeof(HarmonicMarkSegment);
+    case ElementType::PICK_SCRAPE_SEGMENT: return sizeof(PickScrapeSegment);
+    case ElementType::TEXTLINE_SEGMENT: return sizeof(TextLineSegment);
+    case ElementType::VOLTA_SEGMENT: return sizeof(VoltaSegment);
+    case ElementType::PEDAL_SEGMENT: return sizeof(PedalSegment);
+    case ElementType::LYRICSLINE_SEGMENT: return sizeof(LyricsLineSegment);
+    case ElementType::GLISSANDO_SEGMENT: return sizeof(GlissandoSegment);
+    case ElementType::LAYOUT_BREAK: return sizeof(LayoutBreak);
+    case ElementType::SPACER: return sizeof(Spacer);
+    case ElementType::STAFF_STATE: return sizeof(StaffState);
+    case ElementType::NOTEHEAD: return sizeof(NoteHead);
+    case ElementType::NOTEDOT: return sizeof(NoteDot);
+    case ElementType::TREMOLO: return sizeof(Tremolo);
+    case ElementType::IMAGE: return sizeof(Image);
+    case ElementType::MEASURE: return sizeof(Measure);
+    case ElementType::TAB_DURATION_SYMBOL: return sizeof(TabDurationSymbol);
+    case ElementType::FSYMBOL: return sizeof(FSymbol);
+    case ElementType::PAGE: return sizeof(Page);
+    case ElementType::HAIRPIN: return sizeof(Hairpin);
+    case ElementType::OTTAVA: return sizeof(Ottava);
+    case ElementType::PEDAL: return sizeof(Pedal);
+    case ElementType::TRILL: return sizeof(Trill);
+    case ElementType::LET_RING: return sizeof(LetRing);
+    case ElementType::GRADUAL_TEMPO_CHANGE: return sizeof(GradualTempoChange);
+    case ElementType::VIBRATO: return sizeof(Vibrato);
+    case ElementType::PALM_MUTE: return sizeof(PalmMute);
+    case ElementType::WHAMMY_BAR: return sizeof(WhammyBar);
+    case ElementType::RASGUEADO: return sizeof(Rasgueado);
+    case ElementType::HARMONIC_MARK: return sizeof(HarmonicMark);
+    case ElementType::PICK_SCRAPE: return sizeof(PickScrape);
+    case ElementType::TEXTLINE: return sizeof(TextLine);
+    case ElementType::NOTELINE: return sizeof(NoteLine);
+    case ElementType::LYRICSLINE: return sizeof(LyricsLine);
+    case ElementType::GLISSANDO: return sizeof(Glissando);
+    case ElementType::BRACKET: return sizeof(Bracket);
+    case ElementType::SEGMENT: return sizeof(Segment);
+    case ElementType::SYSTEM: return sizeof(System);
+    case ElementType::CHORD: return sizeof(Chord);
+    case ElementType::SLUR: return sizeof(Slur);
+    case ElementType::HBOX: return sizeof(HBox);
+    case ElementType::VBOX: return sizeof(VBox);
+    case ElementType::TBOX: return sizeof(TBox);
+    case ElementType::FBOX: return sizeof(FBox);
+    case ElementType::ACTION_ICON: return sizeof(ActionIcon);
+    case ElementType::BAGPIPE_EMBELLISHMENT: return sizeof(BagpipeEmbellishment);
+    case ElementType::STICKING: return sizeof(Sticking);
+    case ElementType::FRET_CIRCLE: return sizeof(FretCircle);
+    default:
+        break;
+    }
+    return 0;
+}
+
+//---------------------------------------------------------
+//   collectTree
+//---------------------------------------------------------
+
+static void collectTree(const EngravingObject* root, std::unordered_set<const EngravingObject*>& visited,
+                        std::map<ElementType, MemoryReport::Entry>& types)
+{
+    std::vector<const EngravingObject*> stack { root };
+
+    while (!stack.empty()) {
+        const EngravingObject* obj = stack.back();
+        stack.pop_back();
+
+        if (!visited.insert(obj).second) {
+            continue;
+        }
+
+        if (obj->isEngravingItem()) {
+            MemoryReport::Entry& entry = types[obj->type()];
+            entry.count++;
+            entry.bytes += MemoryReport::itemSize(obj->type());
+        }
+
+        for (const EngravingObject* child : obj->scanChildren()) {
+            stack.push_back(child);
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   collect
+//    walks the score tree from the pages, so only the items
+//    reachable from the layout are reported
+//---------------------------------------------------------
+
+MemoryReport MemoryReport::collect(const Score* score)
+{
+    MemoryReport report;
+    std::unordered_set<const EngravingObject*> visited;
+    collectTree(score, visited, report.m_types);
+
+    report.m_subsystems["elements"] = report.total();
+
+    Entry& layout = report.m_subsystems["layoutCaches"];
+    layout.count = score->layout().widthCache() ? score->layout().widthCache()->entriesCount() : 0;
+    layout.bytes = score->layout().memoryUsage();
+
+    report.collectUndoStack(score);
+    report.collectImages(score);
+    report.collectSources(score);
+
+    return report;
+}
+
+//---------------------------------------------------------
+//   collectUndoStack
+//    the stack itself and the items it holds: those removed
+//    by the done commands and added by the undone ones
+//---------------------------------------------------------
+
+void MemoryReport::collectUndoStack(const Score* score)
+{
+    // the parts share the undo stack of the master score
+    if (!score->isMaster()) {
+        return;
+    }
+
+    const UndoStack* stack = score->undoStack();
+    Entry& entry = m_subsystems["undoStack"];
+    entry.bytes += stack->memoryUsage();
+
+    std::unordered_set<const EngravingObject*> visited;
+    std::map<ElementType, Entry> held;
+
+    const std::vector<UndoMacro*>& macros = stack->macros();
+    for (size_t i = 0; i < macros.size(); ++i) {
+        if (!macros[i]) {
+            continue;
+        }
+
+        bool done = i < stack->getCurIdx();
+        std::vector<const UndoCommand*> commands { macros[i] };
+        while (!commands.empty()) {
+            const UndoCommand* cmd = commands.back();
+            commands.pop_back();
+            entry.count++;
+
+            const EngravingObject* item = nullptr;
+            if (done && cmd->type() == CommandType::RemoveElement) {
+                std::vector<const EngravingObject*> items = cmd->objectItems();
+                item = items.empty() ? nullptr : items.front();
+            } else if (!done && cmd->type() == CommandType::AddElement) {
+                item = static_cast<const AddElement*>(cmd)->getElement();
+            }
+
+            if (item) {
+                collectTree(item, visited, held);
+            }
+
+            for (const UndoCommand* child : cmd->commands()) {
+                commands.push_back(child);
+            }
+        }
+    }
+
+    for (const auto& p : held) {
+        entry.bytes += p.second.bytes;
+    }
+}
+
+//---------------------------------------------------------
+//   collectImages
+//    the image files of the score, as kept in memory
+//---------------------------------------------------------
+
+void MemoryReport::collectImages(const Score* score)
+{
+    Entry& entry = m_subsystems["images"];
+    for (const ImageStoreItem* item : imageStore) {
+        if (item->isUsed(const_cast<Score*>(score))) {
+            entry.count++;
+            entry.bytes += item->buffer().size();
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   collectSources
+//---------------------------------------------------------
+
+void MemoryReport::collectSources(const Score* score)
+{
+    std::vector<RegisteredSource> list;
+    {
+        std::lock_guard<std::mutex> lock(sources().mutex);
+        for (const RegisteredSource& s : sources().list) {
+            if (s.score == score) {
+                list.push_back(s);
+            }
+        }
+    }
+
+    for (const RegisteredSource& s : list) {
+        Entry value = s.source();
+        Entry& entry = m_subsystems[s.subsystem];
+        entry.count += value.count;
+        entry.bytes += value.bytes;
+    }
+}
+
+void MemoryReport::addSource(const void* owner, const Score* score, const std::string& subsystem, const Source& source)
+{
+    std::lock_guard<std::mutex> lock(sources().mutex);
+    sources().list.push_back({ owner, score, subsystem, source });
+}
+
+void MemoryReport::removeSources(const void* owner)
+{
+    std::lock_guard<std::mutex> lock(sources().mutex);
+    std::vector<RegisteredSource>& list = sources().list;
+    list.erase(std::remove_if(list.begin(), list.end(), [owner](const RegisteredSource& s) {
+        return s.owner == owner;
+    }), list.end());
+}
+
+MemoryReport::Entry MemoryReport::total() const
+{
+    Entry total;
+    for (const auto& p : m_types) {
+        total.count += p.second.count;
+        total.bytes += p.second.bytes;
+    }
+    return total;
+}
+
+MemoryReport::Entry MemoryReport::subsystemsTotal() const
+{
+    Entry total;
+    for (const auto& p : m_subsystems) {
+        total.count += p.second.count;
+        total.bytes += p.second.bytes;
+    }
+    return total;
+}
+
+//---------------------------------------------------------
+//   toJson
+//---------------------------------------------------------
+
+ByteArray MemoryReport::toJson() const
+{
+    JsonObject types;
+    for (const auto& p : m_types) {
+        JsonObject entry;
+        entry.set("count", int(p.second.count));
+        entry.set("itemSize", int(itemSize(p.first)));
+        entry.set("bytes", double(p.second.bytes));
+        types.set(TConv::toXml(p.first).ascii(), entry);
+    }
+
+    Entry sum = total();
+    JsonObject totalEntry;
+    totalEntry.set("count", int(sum.count));
+    totalEntry.set("bytes", double(sum.bytes));
+
+    JsonObject subsystems;
+    for (const auto& p : m_subsystems) {
+        JsonObject entry;
+        entry.set("count", int(p.second.count));
+        entry.set("bytes", double(p.second.bytes));
+        subsystems.set(p.first, entry);
+    }
+
+    Entry subsystemsSum = subsystemsTotal();
+    JsonObject subsystemsTotalEntry;
+    subsystemsTotalEntry.set("bytes", double(subsystemsSum.bytes));
+    subsystems.set("total", subsystemsTotalEntry);
+
+    // the object pools are shared by all the scores of the process
+    JsonObject allocators;
+    for (const ObjectAllocator::Info& info : AllocatorsRegister::instance()->stateInfo("engraving")) {
+        JsonObject entry;
+        entry.set("chunkSize", int(info.chunkSize));
+        entry.set("usedChunks", double(info.usedChunks()));
+        entry.set("allocatedBytes", double(info.allocatedBytes()));
+        allocators.set(info.name, entry);
+    }
+
+    JsonObject root;
+    root.set("types", types);
+    root.set("total", totalEntry);
+    root.set("subsystems", subsystems);
+    root.set("allocators", allocators);
+    return JsonDocument(root).toJson();
+}
@@ -0,0 +1,81 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_MEMORYREPORT_H
+#define MU_ENGRAVING_MEMORYREPORT_H
+
+#include <functional>
+#include <map>
+#include <string>
+
+#include "types/bytearray.h"
+#include "types/types.h"
+
+namespace mu::engraving {
+class Score;
+
+//---------------------------------------------------------
+//   MemoryReport
+//    number and size of the items of a laid out score,
+//    by element type, and the memory held for the score
+//    by the subsystems: the undo stack, the layout caches,
+//    the images and what the sources registered for it
+//    report (the playback data, the render caches)
+//---------------------------------------------------------
+
+class MemoryReport
+{
+public:
+    struct Entry {
+        size_t count = 0;
+        size_t bytes = 0;       // size of the objects themselves, not of the heap memory they own
+    };
+
+    static MemoryReport collect(const Score* score);
+
+    const std::map<ElementType, Entry>& types() const { return m_types; }
+    Entry total() const;
+
+    //! NOTE By subsystem name, "elements" is the total of the types
+    const std::map<std::string, Entry>& subsystems() const { return m_subsystems; }
+    Entry subsystemsTotal() const;
+
+    //! NOTE The owners of the memory outside of the score tree register a source for the score,
+    //! it is asked on collect, on the thread of the collect, and must be removed before the owner is destroyed
+    using Source = std::function<Entry()>;
+    static void addSource(const void* owner, const Score* score, const std::string& subsystem, const Source& source);
+    static void removeSources(const void* owner);
+
+    static size_t itemSize(ElementType type);
+
+    ByteArray toJson() const;
+
+private:
+    void collectUndoStack(const Score* score);
+    void collectImages(const Score* score);
+    void collectSources(const Score* score);
+
+    std::map<ElementType, Entry> m_types;
+    std::map<std::string, Entry> m_subsystems;
+};
+}
+
+#endif // MU_ENGRAVING_MEMORYREPORT_H
@@ -71,6 +71,7 @@ int MScore::mtcType;
 
 bool MScore::noExcerpts = false;
 bool MScore::noImages = false;
+size_t MScore::undoMemoryLimit = 256 * 1024 * 1024;
 bool MScore::pdfPrinting = false;
 bool MScore::svgPrinting = false;
 
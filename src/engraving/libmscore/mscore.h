@@ -271,6 +271,8 @@ public:
     static bool noExcerpts;
     static bool noImages;
 
+    static size_t undoMemoryLimit;  // max. memory held by the undo commands (bytes), 0 for no limit
+
     static bool pdfPrinting;
     static bool svgPrinting;
     static double pixelRatio;
@@ -371,9 +371,7 @@ Ret Score::putNote(const Position& p, bool replace)
     _is.setSegment(s);
 
     if (mu::engraving::Excerpt* excerpt = score()->excerpt()) {
-        const TracksMap& tracks = excerpt->tracksMapping();
-
-        if (!tracks.empty() && mu::key(tracks, _is.track(), mu::nidx) == mu::nidx) {
+        if (!excerpt->tracksMapping().empty() && excerpt->masterTrack(_is.track()) == mu::nidx) {
             return make_ret(Ret::Code::UnknownError);
         }
     }
@@ -32,6 +32,8 @@
 #include "system.h"
 #include "text.h"
 
+#include "log.h"
+
 #ifndef ENGRAVING_NO_ACCESSIBILITY
 #include "accessibility/accessibleitem.h"
 #endif
@@ -60,17 +62,13 @@ Page::Page(RootItem* parent)
 
 std::vector<EngravingItem*> Page::items(const RectF& rect)
 {
-    if (!bspTreeValid) {
-        doRebuildBspTree();
-    }
+    updateBspTree();
     return bspTree.items(rect);
 }
 
 std::vector<EngravingItem*> Page::items(const mu::PointF& point)
 {
-    if (!bspTreeValid) {
-        doRebuildBspTree();
-    }
+    updateBspTree();
     return bspTree.items(point);
 }
 
@@ -319,47 +317,32 @@ void Page::scanElements(void* data, void (* func)(void*, EngravingItem*), bool a
 }
 
 //---------------------------------------------------------
-//   bspInsert
+//   doRebuildBspTree
 //---------------------------------------------------------
 
-static void bspInsert(void* bspTree, EngravingItem* e)
+void Page::doRebuildBspTree()
 {
-    ((BspTree*)bspTree)->insert(e);
-}
+    m_elements.clear();
+    scanElements(&m_elements, collectElements, false);
 
-static void countElements(void* data, EngravingItem* /*e*/)
-{
-    ++(*(int*)data);
+    bspTree.clear();
+    EngravingItem::PagePosCacheScope pagePosCache;
+    for (EngravingItem* e : m_elements) {
+        bspTree.insert(e);
+    }
+    bspTree.build();
+    bspTreeValid = true;
 }
 
 //---------------------------------------------------------
-//   doRebuildBspTree
+//   updateBspTree
 //---------------------------------------------------------
 
-void Page::doRebuildBspTree()
+void Page::updateBspTree()
 {
-    int n = 0;
-    scanElements(&n, countElements, false);
-
-    RectF r;
-    if (score()->linearMode()) {
-        double w = 0.0;
-        double h = 0.0;
-        if (!_systems.empty()) {
-            h = _systems.front()->height();
-            if (!_systems.front()->measures().empty()) {
-                MeasureBase* mb = _systems.front()->measures().back();
-                w = mb->x() + mb->width();
-            }
-        }
-        r = RectF(0.0, 0.0, w, h);
-    } else {
-        r = abbox();
+    if (!bspTreeValid) {
+        doRebuildBspTree();
     }
-
-    bspTree.initialize(r, n);
-    scanElements(&bspTree, &bspInsert, false);
-    bspTreeValid = true;
 }
 
 //---------------------------------------------------------
@@ -569,11 +552,14 @@ void Page::read(XmlReader& e)
 //   elements
 //---------------------------------------------------------
 
-std::vector<EngravingItem*> Page::elements() const
+const std::vector<EngravingItem*>& Page::elements() const
 {
-    std::vector<EngravingItem*> el;
-    const_cast<Page*>(this)->scanElements(&el, collectElements, false);
-    return el;
+    //! NOTE Read while painting, the list is collected before, see updateBspTree()
+    IF_ASSERT_FAILED(bspTreeValid) {
+        static const std::vector<EngravingItem*> noElements;
+        return noElements;
+    }
+    return m_elements;
 }
 
 //---------------------------------------------------------
@@ -626,7 +612,8 @@ RectF Page::tbbox()
     double x2 = 0.0;
     double y1 = height();
     double y2 = 0.0;
-    const std::vector<EngravingItem*> el = elements();
+    updateBspTree();
+    const std::vector<EngravingItem*>& el = elements();
     for (EngravingItem* e : el) {
         if (e == this || !e->isPrintable()) {
             continue;
@@ -23,6 +23,7 @@
 #ifndef __PAGE_H__
 #define __PAGE_H__
 
+#include <cassert>
 #include <vector>
 
 #include "engravingitem.h"
@@ -51,6 +52,7 @@ class Page final : public EngravingItem
     page_idx_t _no;                        // page number
 
     BspTree bspTree;
+    std::vector<EngravingItem*> m_elements;     // visible elements, collected with the bsp tree
     bool bspTreeValid;
 
     void doRebuildBspTree();
@@ -92,9 +94,22 @@ public:
 
     std::vector<EngravingItem*> items(const mu::RectF& r);
     std::vector<EngravingItem*> items(const mu::PointF& p);
+    //! calls f(item) for the items whose bounding rectangle may intersect r, until f returns false;
+    //! doesn't rebuild the bsp tree, see updateBspTree()
+    template<typename F>
+    void visitItems(const mu::RectF& r, F&& f) const
+    {
+        assert(bspTreeValid);
+        if (bspTreeValid) {
+            bspTree.visit(r, f);
+        }
+    }
     void invalidateBspTree() { bspTreeValid = false; }
+    //! rebuilds the bsp tree if it was invalidated; done at the end of the layout,
+    //! so that painting, possibly on several threads, only reads it
+    void updateBspTree();
     mu::PointF pagePos() const override { return mu::PointF(); }       ///< position in page coordinates
-    std::vector<EngravingItem*> elements() const;              ///< list of visible elements
+    const std::vector<EngravingItem*>& elements() const;       ///< list of visible elements, collected by updateBspTree()
     mu::RectF tbbox();                             // tight bounding box, excluding white space
     Fraction endTick() const;
 
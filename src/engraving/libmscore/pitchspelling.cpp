@@ -26,6 +26,8 @@
 
 #include "pitchspelling.h"
 
+#include "concurrency/taskscheduler.h"
+#include "layout/layoutcontext.h"
 #include "translation.h"
 #include "types/typesconv.h"
 
@@ -704,12 +706,16 @@ void changeAllTpcs(Note* n, int tpc1)
 }
 
 //---------------------------------------------------------
-//   spell
+//   spellTpcs
+//    compute the spelling of notes, Tpc::TPC_INVALID for
+//    the ones left as they are. Only reads the notes, the
+//    result is applied by Score::spellNotelist().
 //---------------------------------------------------------
 
-void Score::spellNotelist(std::vector<Note*>& notes)
+static std::vector<int> spellTpcs(const std::vector<Note*>& notes)
 {
     int n = int(notes.size());
+    std::vector<int> tpcs(n, Tpc::TPC_INVALID);
 
     int start = 0;
     while (start < n) {
@@ -727,18 +733,18 @@ void Score::spellNotelist(std::vector<Note*>& notes)
         }
 
         if (start == 0) {
-            changeAllTpcs(notes[0], tab[(notes[0]->pitch() % 12) * 2 + (opt & 1)]);
+            tpcs[0] = tab[(notes[0]->pitch() % 12) * 2 + (opt & 1)];
             if (n > 1) {
-                changeAllTpcs(notes[1], tab[(notes[1]->pitch() % 12) * 2 + ((opt & 2) >> 1)]);
+                tpcs[1] = tab[(notes[1]->pitch() % 12) * 2 + ((opt & 2) >> 1)];
             }
             if (n > 2) {
-                changeAllTpcs(notes[2], tab[(notes[2]->pitch() % 12) * 2 + ((opt & 4) >> 2)]);
+                tpcs[2] = tab[(notes[2]->pitch() % 12) * 2 + ((opt & 4) >> 2)];
             }
         }
         if ((end - start) >= 6) {
-            changeAllTpcs(notes[start + 3], tab[(notes[start + 3]->pitch() % 12) * 2 + ((opt & 8) >> 3)]);
-            changeAllTpcs(notes[start + 4], tab[(notes[start + 4]->pitch() % 12) * 2 + ((opt & 16) >> 4)]);
-            changeAllTpcs(notes[start + 5], tab[(notes[start + 5]->pitch() % 12) * 2 + ((opt & 32) >> 5)]);
+            tpcs[start + 3] = tab[(notes[start + 3]->pitch() % 12) * 2 + ((opt & 8) >> 3)];
+            tpcs[start + 4] = tab[(notes[start + 4]->pitch() % 12) * 2 + ((opt & 16) >> 4)];
+            tpcs[start + 5] = tab[(notes[start + 5]->pitch() % 12) * 2 + ((opt & 32) >> 5)];
         }
         if (end == n) {
             int n1 = end - start;
@@ -746,21 +752,74 @@ void Score::spellNotelist(std::vector<Note*>& notes)
             switch (n1 - 6) {
             case 3:
                 k = end - start - 3;
-                changeAllTpcs(notes[end - 3], tab[(notes[end - 3]->pitch() % 12) * 2 + ((opt & (1 << k)) >> k)]);
+                tpcs[end - 3] = tab[(notes[end - 3]->pitch() % 12) * 2 + ((opt & (1 << k)) >> k)];
             // FALLTHROUGH
             case 2:
                 k = end - start - 2;
-                changeAllTpcs(notes[end - 2], tab[(notes[end - 2]->pitch() % 12) * 2 + ((opt & (1 << k)) >> k)]);
+                tpcs[end - 2] = tab[(notes[end - 2]->pitch() % 12) * 2 + ((opt & (1 << k)) >> k)];
             // FALLTHROUGH
             case 1:
                 k = end - start - 1;
-                changeAllTpcs(notes[end - 1], tab[(notes[end - 1]->pitch() % 12) * 2 + ((opt & (1 << k)) >> k)]);
+                tpcs[end - 1] = tab[(notes[end - 1]->pitch() % 12) * 2 + ((opt & (1 << k)) >> k)];
             }
             break;
         }
         // advance to next window
         start += 3;
     }
+    return tpcs;
+}
+
+static void applyTpcs(const std::vector<Note*>& notes, const std::vector<int>& tpcs)
+{
+    for (size_t i = 0; i < notes.size(); ++i) {
+        if (tpcs[i] != Tpc::TPC_INVALID) {
+            changeAllTpcs(notes[i], tpcs[i]);
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   spell
+//---------------------------------------------------------
+
+void Score::spellNotelist(std::vector<Note*>& notes)
+{
+    applyTpcs(notes, spellTpcs(notes));
+}
+
+//---------------------------------------------------------
+//   spellNotelists
+//    Spell several independent lists of notes, usually one
+//    per staff. The spelling is computed on the workers for
+//    big lists, the changes are recorded in list order.
+//---------------------------------------------------------
+
+void Score::spellNotelists(std::vector<std::vector<Note*> >& lists)
+{
+    static constexpr size_t PARALLEL_SPELL_MIN_NOTES = 1000;
+
+    size_t total = 0;
+    for (const std::vector<Note*>& notes : lists) {
+        total += notes.size();
+    }
+
+    if (lists.size() < 2 || total < PARALLEL_SPELL_MIN_NOTES || LayoutContext::workers()->threadPoolSize() < 2) {
+        for (std::vector<Note*>& notes : lists) {
+            spellNotelist(notes);
+        }
+        return;
+    }
+
+    std::vector<std::future<std::vector<int> > > futures;
+    for (const std::vector<Note*>& notes : lists) {
+        futures.push_back(LayoutContext::workers()->submit([&notes]() {
+            return spellTpcs(notes);
+        }));
+    }
+    for (size_t i = 0; i < lists.size(); ++i) {
+        applyTpcs(lists[i], futures[i].get());
+    }
 }
 
 //---------------------------------------------------------
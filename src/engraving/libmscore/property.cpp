@@ -395,14 +395,51 @@ static constexpr PropertyMetaData propertyList[] = {
 //   propertyId
 //---------------------------------------------------------
 
-Pid propertyId(const AsciiStringView& s)
-{
-    for (const PropertyMetaData& pd : propertyList) {
-        if (s == pd.name) {
-            return pd.id;
+//---------------------------------------------------------
+//   PropertyNameTokens
+//    the token of an xml name is the first Pid with this name,
+//    properties with the same name share the token
+//---------------------------------------------------------
+
+struct PropertyNameTokens {
+    XmlStreamReader::TokenTable table;
+    std::vector<int> tokens;
+
+    PropertyNameTokens()
+    {
+        tokens.reserve(std::size(propertyList));
+        for (const PropertyMetaData& pd : propertyList) {
+            int token = table.token(pd.name);
+            if (token == XmlStreamReader::TokenTable::NoToken) {
+                token = static_cast<int>(pd.id);
+                table.add(pd.name, token);
+            }
+            tokens.push_back(token);
         }
     }
-    return Pid::END;
+};
+
+static const PropertyNameTokens& propertyNameTokens()
+{
+    static const PropertyNameTokens tokens;
+    return tokens;
+}
+
+const XmlStreamReader::TokenTable& propertyNameTokenTable()
+{
+    return propertyNameTokens().table;
+}
+
+int propertyNameToken(Pid id)
+{
+    assert(propertyList[int(id)].id == id);
+    return propertyNameTokens().tokens[int(id)];
+}
+
+Pid propertyId(const AsciiStringView& s)
+{
+    int token = propertyNameTokenTable().token(s);
+    return token != XmlStreamReader::TokenTable::NoToken ? static_cast<Pid>(token) : Pid::END;
 }
 
 //---------------------------------------------------------
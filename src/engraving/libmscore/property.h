@@ -24,6 +24,7 @@
 #define __PROPERTY_H__
 
 #include "types/string.h"
+#include "serialization/xmlstreamreader.h"
 
 #include "types/propertyvalue.h"
 
@@ -407,6 +408,8 @@ extern P_TYPE propertyType(Pid);
 extern const char* propertyName(Pid);
 extern bool propertyLink(Pid id);
 extern Pid propertyId(const AsciiStringView& name);
+extern const XmlStreamReader::TokenTable& propertyNameTokenTable();
+extern int propertyNameToken(Pid);
 extern String propertyUserName(Pid);
 } // namespace mu::engraving
 
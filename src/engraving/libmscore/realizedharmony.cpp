@@ -22,6 +22,9 @@
 
 #include "realizedharmony.h"
 
+#include <mutex>
+#include <tuple>
+
 #include "chordlist.h"
 #include "harmony.h"
 #include "pitchspelling.h"
@@ -30,6 +33,44 @@
 using namespace mu;
 
 namespace mu::engraving {
+//---------------------------------------------------
+//   NotesCacheKey
+///   everything generateNotes() depends on. Realizing
+///   the same progression again, or the same chord in
+///   another part, is then a lookup in a cache shared
+///   by all harmonies. The scores may be laid out and
+///   rendered concurrently, so the cache is guarded.
+//---------------------------------------------------
+struct NotesCacheKey {
+    String quality;
+    String extension;
+    String modifiers;
+    bool understandable = false;
+    int rootTpc = 0;
+    int bassTpc = 0;
+    int transposeOffset = 0;
+    bool literal = false;
+    Voicing voicing = Voicing::INVALID;
+
+    //the next harmony, for jazz (non literal) interpretation
+    int nextRootTpc = Tpc::TPC_INVALID;
+    String nextQuality;
+    int nextExtension = 0;
+
+    bool operator<(const NotesCacheKey& k) const
+    {
+        return std::tie(rootTpc, bassTpc, transposeOffset, literal, voicing, understandable, nextRootTpc, nextExtension,
+                        quality, extension, modifiers, nextQuality)
+               < std::tie(k.rootTpc, k.bassTpc, k.transposeOffset, k.literal, k.voicing, k.understandable, k.nextRootTpc, k.nextExtension,
+                          k.quality, k.extension, k.modifiers, k.nextQuality);
+    }
+};
+
+static constexpr size_t NOTES_CACHE_MAX_SIZE = 4096;
+static std::map<NotesCacheKey, RealizedHarmony::PitchMap> s_notesCache;
+static std::mutex s_notesCacheMutex;
+
+
 //---------------------------------------------------
 //   setVoicing
 ///   sets the voicing and dirty flag if the passed
@@ -91,6 +132,58 @@ const RealizedHarmony::PitchMap& RealizedHarmony::notes() const
 //---------------------------------------------------
 const RealizedHarmony::PitchMap RealizedHarmony::generateNotes(int rootTpc, int bassTpc,
                                                                bool literal, Voicing voicing, int transposeOffset) const
+{
+    const ParsedChord* p = _harmony->parsedForm();
+    if (!p) {
+        return doGenerateNotes(rootTpc, bassTpc, literal, voicing, transposeOffset);
+    }
+
+    NotesCacheKey key;
+    key.quality = p->quality();
+    key.extension = p->extension();
+    key.modifiers = p->modifierList().join(u",");
+    key.understandable = p->understandable();
+    key.rootTpc = rootTpc;
+    key.bassTpc = bassTpc;
+    key.transposeOffset = transposeOffset;
+    key.literal = literal;
+    key.voicing = voicing;
+
+    bool usesIntervals = voicing != Voicing::ROOT_ONLY && (voicing != Voicing::AUTO || key.understandable);
+    if (usesIntervals && !literal) {
+        Harmony* next = _harmony->findNext();
+        if (next && tpcIsValid(next->rootTpc())) {
+            key.nextRootTpc = next->rootTpc();
+            key.nextQuality = next->parsedForm()->quality();
+            key.nextExtension = next->parsedForm()->extension().toInt();
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(s_notesCacheMutex);
+        auto it = s_notesCache.find(key);
+        if (it != s_notesCache.end()) {
+            return it->second;
+        }
+    }
+
+    PitchMap notes = doGenerateNotes(rootTpc, bassTpc, literal, voicing, transposeOffset);
+
+    std::lock_guard<std::mutex> lock(s_notesCacheMutex);
+    if (s_notesCache.size() >= NOTES_CACHE_MAX_SIZE) {
+        s_notesCache.clear();
+    }
+    s_notesCache.emplace(std::move(key), notes);
+    return notes;
+}
+
+//---------------------------------------------------
+//   doGenerateNotes
+///   generates a note list based on the passed parameters
+///   without looking it up in the cache
+//---------------------------------------------------
+RealizedHarmony::PitchMap RealizedHarmony::doGenerateNotes(int rootTpc, int bassTpc,
+                                                           bool literal, Voicing voicing, int transposeOffset) const
 {
     //The octave which to generate the body of the harmony, this is static const for now
     //but may be user controlled in the future
@@ -204,20 +297,19 @@ const RealizedHarmony::PitchMap RealizedHarmony::generateNotes(int rootTpc, int
 //---------------------------------------------------
 void RealizedHarmony::update(int rootTpc, int bassTpc, int transposeOffset /*= 0*/)
 {
-    //on transposition the dirty flag is set by the harmony, but it's a little
-    //bit risky design since these 3 parameters rely on the dirty bit and are not
-    //otherwise checked by RealizedHarmony. This saves us 3 ints of space, but
-    //has the added risk
-    if (!_dirty) {
-        assert(
-            _harmony->harmonyType() != HarmonyType::STANDARD
-            || (_notes.begin()->second == rootTpc || _notes.begin()->second == bassTpc));
+    //the notes are regenerated when they are dirty or were generated
+    //for another root, bass or offset (e.g. after transposition or a capo
+    //change), the dirty flag only has to cover the chord and its context
+    if (!_dirty && rootTpc == _realizedRootTpc && bassTpc == _realizedBassTpc && transposeOffset == _realizedTransposeOffset) {
         return;
     }
 
     if (tpcIsValid(rootTpc)) {
         _notes = generateNotes(rootTpc, bassTpc, _literal, _voicing, transposeOffset);
     }
+    _realizedRootTpc = rootTpc;
+    _realizedBassTpc = bassTpc;
+    _realizedTransposeOffset = transposeOffset;
     _dirty = false;
 }
 
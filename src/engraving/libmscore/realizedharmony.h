@@ -74,6 +74,11 @@ private:
     //whether or not the current notes QMap is up to date
     bool _dirty;
 
+    //the root, bass and offset the current notes were generated for
+    int _realizedRootTpc = 0;
+    int _realizedBassTpc = 0;
+    int _realizedTransposeOffset = 0;
+
     bool _literal = false;   //use all notes when possible and do not add any notes
 
 public:
@@ -106,6 +111,7 @@ public:
     Fraction getActualDuration(int utick, HDuration durationType = HDuration::INVALID) const;
 
 private:
+    PitchMap doGenerateNotes(int rootTpc, int bassTpc, bool literal, Voicing voicing, int transposeOffset) const;
     PitchMap getIntervals(int rootTpc, bool literal = true) const;
     PitchMap normalizeNoteMap(const PitchMap& intervals, int rootTpc, int rootPitch, size_t max = 128, bool enforceMaxAsGoal = false) const;
     void cascadeDirty(bool dirty);
@@ -29,6 +29,9 @@
 
 #include <set>
 #include <cmath>
+#include <future>
+
+#include "concurrency/taskscheduler.h"
 
 #include "compat/midi/event.h"
 #include "style/style.h"
@@ -77,6 +80,14 @@ using namespace mu::engraving;
 
 namespace mu::engraving {
 static constexpr int MIN_CHUNK_SIZE(10); // measure
+//! NOTE Below that, rendering the staves on the workers doesn't pay off
+static constexpr size_t MIN_STAVES_TO_RENDER_CONCURRENTLY(4);
+
+static TaskScheduler* staffRenderWorkers()
+{
+    static TaskScheduler workers;
+    return &workers;
+}
 
 struct SndConfig {
     bool useSND = false;
@@ -145,9 +156,6 @@ void Score::updateCapo()
     }
     for (Segment* s = fm->first(SegmentType::ChordRest); s; s = s->next1(SegmentType::ChordRest)) {
         for (EngravingItem* e : s->annotations()) {
-            if (e->isHarmony()) {
-                toHarmony(e)->realizedHarmony().setDirty(true);
-            }
             if (!e->isStaffTextBase()) {
                 continue;
             }
@@ -2327,13 +2335,35 @@ void MidiRenderer::renderChunk(const Chunk& chunk, EventMap* events, const Conte
     }
 
     // create note & other events
-    for (Staff* st : score->staves()) {
+    const std::vector<Staff*>& staves = score->staves();
+    auto staffContext = [&](Staff* st) {
         StaffContext sctx;
         sctx.staff = st;
         sctx.method = renderMethod;
         sctx.cc = cc;
         sctx.renderHarmony = ctx.renderHarmony;
-        renderStaffChunk(chunk, events, sctx);
+        return sctx;
+    };
+
+    if (staves.size() < MIN_STAVES_TO_RENDER_CONCURRENTLY) {
+        for (Staff* st : staves) {
+            renderStaffChunk(chunk, events, staffContext(st));
+        }
+    } else {
+        //! NOTE The staves only read the score and their own staff, so they are rendered into separate maps,
+        //! merged in the order of the staves to get the same events order as the serial rendering
+        std::vector<EventMap> staffEvents(staves.size());
+        std::vector<std::future<void> > futures;
+        futures.reserve(staves.size());
+        for (size_t i = 0; i < staves.size(); ++i) {
+            futures.push_back(staffRenderWorkers()->submit([this, &chunk, &staffEvents, i, sctx = staffContext(staves[i])]() {
+                renderStaffChunk(chunk, &staffEvents[i], sctx);
+            }));
+        }
+        for (size_t i = 0; i < staves.size(); ++i) {
+            futures[i].get();
+            events->merge(staffEvents[i]);
+        }
     }
     events->fixupMIDI();
 
@@ -23,6 +23,7 @@
 #include "repeatlist.h"
 
 #include <algorithm>
+#include <cstring>
 #include <list>
 #include <utility> // std::pair
 
@@ -119,8 +120,6 @@ const std::vector<const Measure*>& RepeatSegment::measureList() const
 RepeatList::RepeatList(Score* s)
 {
     _score = s;
-    idx1  = 0;
-    idx2  = 0;
 }
 
 //---------------------------------------------------------
@@ -172,6 +171,7 @@ void RepeatList::updateTempo()
 {
     const TempoMap* tl = _score->tempomap();
     if (tl->empty()) {
+        updateLookupTables();
         return;
     }
 
@@ -186,6 +186,106 @@ void RepeatList::updateTempo()
         utick        += s->len();
         t            += tl->tick2time(s->tick + s->len()) - ct;
     }
+
+    updateLookupTables();
+}
+
+//---------------------------------------------------------
+//   updateLookupTables
+//    caches the utick and utime of the segments and, for each
+//    range of ticks, the first segment playing it, so that
+//    the conversions are binary searches
+//---------------------------------------------------------
+
+void RepeatList::updateLookupTables()
+{
+    _segmentUticks.clear();
+    _segmentUtimes.clear();
+    _tickBoundaries.clear();
+    _tickSegments.clear();
+
+    _segmentUticks.reserve(size());
+    _segmentUtimes.reserve(size());
+    _tickBoundaries.reserve(2 * size());
+
+    for (const RepeatSegment* s : *this) {
+        _segmentUticks.push_back(s->utick);
+        _segmentUtimes.push_back(s->utime);
+        _tickBoundaries.push_back(s->tick);
+        _tickBoundaries.push_back(s->tick + s->len());
+    }
+
+    std::sort(_tickBoundaries.begin(), _tickBoundaries.end());
+    _tickBoundaries.erase(std::unique(_tickBoundaries.begin(), _tickBoundaries.end()), _tickBoundaries.end());
+
+    if (_tickBoundaries.size() < 2) {
+        return;
+    }
+
+    // assign each range to the first segment containing it,
+    // skipping the ranges that are already assigned
+    const size_t rangeCount = _tickBoundaries.size() - 1;
+    _tickSegments.assign(rangeCount, -1);
+    std::vector<size_t> nextFree(rangeCount + 1);
+    for (size_t i = 0; i <= rangeCount; ++i) {
+        nextFree[i] = i;
+    }
+
+    auto findFree = [&nextFree](size_t i) {
+        size_t root = i;
+        while (nextFree[root] != root) {
+            root = nextFree[root];
+        }
+        while (nextFree[i] != root) {
+            size_t next = nextFree[i];
+            nextFree[i] = root;
+            i = next;
+        }
+        return root;
+    };
+
+    for (size_t segmentIdx = 0; segmentIdx < size(); ++segmentIdx) {
+        const RepeatSegment* s = at(segmentIdx);
+        if (s->len() <= 0) {
+            continue;
+        }
+
+        size_t from = std::lower_bound(_tickBoundaries.cbegin(), _tickBoundaries.cend(), s->tick) - _tickBoundaries.cbegin();
+        size_t to = std::lower_bound(_tickBoundaries.cbegin(), _tickBoundaries.cend(), s->tick + s->len()) - _tickBoundaries.cbegin();
+
+        for (size_t i = findFree(from); i < to; i = findFree(i + 1)) {
+            _tickSegments[i] = static_cast<int>(segmentIdx);
+            nextFree[i] = i + 1;
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   segmentIndexFromUTick
+//    index of the last segment starting at or before utick,
+//    size() if there is none
+//---------------------------------------------------------
+
+size_t RepeatList::segmentIndexFromUTick(int utick) const
+{
+    auto it = std::upper_bound(_segmentUticks.cbegin(), _segmentUticks.cend(), utick);
+    if (it == _segmentUticks.cbegin()) {
+        return size();
+    }
+    return static_cast<size_t>(it - _segmentUticks.cbegin()) - 1;
+}
+
+//---------------------------------------------------------
+//   segmentIndexFromUTime
+//---------------------------------------------------------
+
+size_t RepeatList::segmentIndexFromUTime(double secs) const
+{
+    auto it = std::upper_bound(_segmentUtimes.cbegin(), _segmentUtimes.cend(), secs);
+    if (it == _segmentUtimes.cbegin()) {
+        return size();
+    }
+    return static_cast<size_t>(it - _segmentUtimes.cbegin()) - 1;
 }
 
 //---------------------------------------------------------
@@ -201,12 +301,10 @@ int RepeatList::utick2tick(int tick) const
     if (tick < 0) {
         return 0;
     }
-    unsigned ii = (idx1 < n) && (tick >= at(idx1)->utick) ? idx1 : 0;
-    for (unsigned i = ii; i < n; ++i) {
-        if ((tick >= at(i)->utick) && ((i + 1 == n) || (tick < at(i + 1)->utick))) {
-            idx1 = i;
-            return tick - (at(i)->utick - at(i)->tick);
-        }
+
+    size_t i = segmentIndexFromUTick(tick);
+    if (i < n) {
+        return tick - (at(i)->utick - at(i)->tick);
     }
 
     ASSERT_X(String(u"tick %1 not found in RepeatList").arg(tick));
@@ -222,8 +320,12 @@ int RepeatList::tick2utick(int tick) const
     if (empty()) {
         return 0;
     }
-    for (const RepeatSegment* s : *this) {
-        if (tick >= s->tick && tick < (s->tick + s->len())) {
+
+    auto it = std::upper_bound(_tickBoundaries.cbegin(), _tickBoundaries.cend(), tick);
+    if (it != _tickBoundaries.cbegin() && it != _tickBoundaries.cend()) {
+        int segmentIdx = _tickSegments[static_cast<size_t>(it - _tickBoundaries.cbegin()) - 1];
+        if (segmentIdx >= 0) {
+            const RepeatSegment* s = at(segmentIdx);
             return s->utick + (tick - s->tick);
         }
     }
@@ -236,14 +338,11 @@ int RepeatList::tick2utick(int tick) const
 
 double RepeatList::utick2utime(int tick) const
 {
-    size_t n = size();
-    unsigned ii = (idx1 < n) && (tick >= at(idx1)->utick) ? idx1 : 0;
-    for (unsigned i = ii; i < n; ++i) {
-        if ((tick >= at(i)->utick) && ((i + 1 == n) || (tick < at(i + 1)->utick))) {
-            int t     = tick - (at(i)->utick - at(i)->tick);
-            double tt = _score->tempomap()->tick2time(t) + at(i)->timeOffset;
-            return tt;
-        }
+    size_t i = segmentIndexFromUTick(tick);
+    if (i < size()) {
+        int t     = tick - (at(i)->utick - at(i)->tick);
+        double tt = _score->tempomap()->tick2time(t) + at(i)->timeOffset;
+        return tt;
     }
     return 0.0;
 }
@@ -254,13 +353,9 @@ double RepeatList::utick2utime(int tick) const
 
 int RepeatList::utime2utick(double secs) const
 {
-    size_t repeatSegmentsCount = size();
-    unsigned ii = (idx2 < repeatSegmentsCount) && (secs >= at(idx2)->utime) ? idx2 : 0;
-    for (unsigned i = ii; i < repeatSegmentsCount; ++i) {
-        if ((secs >= at(i)->utime) && ((i + 1 == repeatSegmentsCount) || (secs < at(i + 1)->utime))) {
-            idx2 = i;
-            return _score->tempomap()->time2tick(secs - at(i)->timeOffset) + (at(i)->utick - at(i)->tick);
-        }
+    size_t i = segmentIndexFromUTime(secs);
+    if (i < size()) {
+        return _score->tempomap()->time2tick(secs - at(i)->timeOffset) + (at(i)->utick - at(i)->tick);
     }
 
     ASSERT_X(String(u"time %1 not found in RepeatList").arg(secs));
@@ -287,9 +382,12 @@ void RepeatList::flatten()
 {
     DeleteAll(*this);
     clear();
+    _sectionKeys.clear();
+    _sectionFirstSegment.clear();
 
     Measure* m = _score->firstMeasure();
     if (!m) {
+        updateLookupTables();
         return;
     }
 
@@ -299,6 +397,7 @@ void RepeatList::flatten()
         m = m->nextMeasure();
     } while (m);
     push_back(s);
+    updateLookupTables();
 
     _expanded = false;
 }
@@ -766,20 +865,156 @@ void RepeatList::performJump(std::vector<RepeatListElementList>::const_iterator
 ///
 /// \brief RepeatList::unwind
 ///
+///---------------------------------------------------------
+/// \brief Collects, for each section, everything its unwinding depends on
+/// \details Two sections with the same keys unwind to the same RepeatSegments,
+///          only the ticks of their measures may differ
+///---------------------------------------------------------
+void RepeatList::collectSectionKeys(std::vector<std::vector<uint64_t> >& keys) const
+{
+    auto ptrKey = [](const void* p) { return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(p)); };
+
+    keys.clear();
+    keys.reserve(_rlElements.size());
+
+    for (const RepeatListElementList& section : _rlElements) {
+        std::vector<uint64_t>& key = keys.emplace_back();
+
+        // the measures in between the elements are added by RepeatSegment::addMeasures
+        for (const Measure* m = section.front()->measure; m; m = m->nextMeasure()) {
+            key.push_back(ptrKey(m));
+            if (m == section.back()->measure) {
+                break;
+            }
+        }
+
+        for (const RepeatListElement* rle : section) {
+            key.push_back(static_cast<uint64_t>(rle->repeatListElementType));
+            key.push_back(ptrKey(rle->measure));
+            switch (rle->repeatListElementType) {
+            case RepeatListElementType::VOLTA_START: {
+                // cloned element, compare its content
+                const Volta* volta = toVolta(rle->element);
+                key.push_back(ptrKey(volta->endMeasure()));
+                for (int ending : volta->endings()) {
+                    key.push_back(static_cast<uint64_t>(ending));
+                }
+            } break;
+            case RepeatListElementType::REPEAT_START: {
+                key.push_back(static_cast<uint64_t>(rle->getRepeatCount()));
+            } break;
+            case RepeatListElementType::REPEAT_END: {
+                key.push_back(static_cast<uint64_t>(rle->measure->repeatCount()));
+            } break;
+            case RepeatListElementType::JUMP: {
+                const Jump* jump = toJump(rle->element);
+                key.push_back(ptrKey(jump));
+                key.push_back(jump->jumpTo().hash());
+                key.push_back(jump->playUntil().hash());
+                key.push_back(jump->continueAt().hash());
+                key.push_back(jump->playRepeats() ? 1 : 0);
+            } break;
+            case RepeatListElementType::MARKER: {
+                key.push_back(ptrKey(rle->element));
+                key.push_back(toMarker(rle->element)->label().hash());
+            } break;
+            case RepeatListElementType::SECTION_BREAK: {
+                key.push_back(ptrKey(rle->element));
+                LayoutBreak const* const layoutBreak = toMeasureBase(rle->element)->sectionBreakElement();
+                double pause = layoutBreak ? layoutBreak->pause() : 0.0;
+                uint64_t pauseBits = 0;
+                static_assert(sizeof(pause) == sizeof(pauseBits));
+                std::memcpy(&pauseBits, &pause, sizeof(pause));
+                key.push_back(pauseBits);
+            } break;
+            case RepeatListElementType::VOLTA_END:
+                break;
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   unwind
+//    only the sections from the first one which differs from
+//    the previous unwind are unwound again, unless a jump
+//    makes the sections depend on each other
+//---------------------------------------------------------
+
 void RepeatList::unwind()
 {
     TRACEFUNC;
 
-    DeleteAll(*this);
-    clear();
     _jumpsTaken.clear();
 
     if (!_score->firstMeasure()) {
+        DeleteAll(*this);
+        clear();
+        _sectionKeys.clear();
+        _sectionFirstSegment.clear();
+        updateLookupTables();
         return;
     }
 
     collectRepeatListElements();
 
+    std::vector<std::vector<uint64_t> > keys;
+    collectSectionKeys(keys);
+
+    size_t firstSection = 0;
+    if (_expanded && !_crossSectionJumps) {
+        while (firstSection < keys.size() && firstSection < _sectionKeys.size()
+               && keys[firstSection] == _sectionKeys[firstSection]) {
+            ++firstSection;
+        }
+    }
+
+    size_t firstSegment = firstSection < _sectionFirstSegment.size() ? _sectionFirstSegment[firstSection] : size();
+    if (firstSection == 0) {
+        firstSegment = 0;
+        _crossSectionJumps = false;
+    }
+
+    for (size_t i = firstSegment; i < size(); ++i) {
+        delete at(i);
+    }
+    erase(begin() + std::min(firstSegment, size()), end());
+    _sectionFirstSegment.resize(_rlElements.size(), 0);
+
+    if (!unwindSections(firstSection)) {
+        // a jump has left the re-unwound sections, start over
+        DeleteAll(*this);
+        clear();
+        _jumpsTaken.clear();
+        collectRepeatListElements();
+        _crossSectionJumps = false;
+        unwindSections(0);
+    }
+
+    // the measures of the kept segments may have moved
+    for (RepeatSegment* rs : *this) {
+        if (const Measure* m = rs->firstMeasure()) {
+            rs->tick = m->tick().ticks();
+        }
+    }
+
+    _sectionKeys = std::move(keys);
+
+    updateTempo();
+    _expanded = true;
+}
+
+//---------------------------------------------------------
+//   unwindSections
+//    unwinds the sections from firstSection on and appends
+//    the segments, returns false if a jump leads to one of
+//    the sections before firstSection
+//---------------------------------------------------------
+
+bool RepeatList::unwindSections(size_t firstSection)
+{
+    const auto firstSectionIt = _rlElements.cbegin() + firstSection;
+
     // Following variables are used during unwinding, but may be altered when following jumps
     // Therefor they are declared outside of the loop
     RepeatSegment* rs = nullptr;
@@ -793,9 +1028,10 @@ void RepeatList::unwind()
     bool forceFinalRepeat = false;   // Used during jump processing
     RepeatListElementList::const_iterator repeatListElementIt;
 
-    for (std::vector<RepeatListElementList>::const_iterator sectionIt = _rlElements.cbegin(); sectionIt != _rlElements.cend();
+    for (std::vector<RepeatListElementList>::const_iterator sectionIt = firstSectionIt; sectionIt != _rlElements.cend();
          ++sectionIt) {
         // Unwind this section
+        _sectionFirstSegment[sectionIt - _rlElements.cbegin()] = size();
         RepeatListElement const* startRepeatReference;
         playbackCount = 1;
         repeatListElementIt = sectionIt->cbegin();     // Should always be a REPEAT_START indicator
@@ -915,6 +1151,17 @@ void RepeatList::unwind()
 
                         // Execute
                         if (jumpTo.first != _rlElements.cend()) {
+                            for (const auto& target : { jumpTo.first, playUntil.first, continueAt.first }) {
+                                if (target == _rlElements.cend() || target == sectionIt) {
+                                    continue;
+                                }
+                                _crossSectionJumps = true;
+                                if (target < firstSectionIt) {
+                                    delete rs;
+                                    return false;
+                                }
+                            }
+
                             push_back(rs);
                             rs = nullptr;
 
@@ -1039,7 +1286,6 @@ void RepeatList::unwind()
         }
     }
 
-    updateTempo();
-    _expanded = true;
+    return true;
 }
 }
@@ -23,6 +23,7 @@
 #ifndef __REPEATLIST_H__
 #define __REPEATLIST_H__
 
+#include <cstdint>
 #include <set>
 #include <vector>
 
@@ -80,7 +81,6 @@ class RepeatList : public std::vector<RepeatSegment*>
     OBJECT_ALLOCATOR(engraving, RepeatList)
 
     Score* _score = nullptr;
-    mutable unsigned idx1, idx2;     // cached values
 
     bool _expanded = false;
     bool _scoreChanged = true;
@@ -88,7 +88,19 @@ class RepeatList : public std::vector<RepeatSegment*>
     std::set<std::pair<Jump const* const, int> > _jumpsTaken;     // take the jumps only once, so track them during unwind
     std::vector<RepeatListElementList> _rlElements;   // all elements of the score that influence the RepeatList
 
+    // state of the previous unwind, used to only re-unwind the sections which have changed
+    std::vector<std::vector<uint64_t> > _sectionKeys;    // everything the unwinding of a section depends on
+    std::vector<size_t> _sectionFirstSegment;           // index of the first segment of each section
+    bool _crossSectionJumps = false;                    // the sections can't be unwound separately
+
+    // cached lookup tables, rebuilt with the utick/utime of the segments
+    std::vector<int> _segmentUticks;                    // utick of each segment, ascending
+    std::vector<double> _segmentUtimes;                 // utime of each segment, ascending
+    std::vector<int> _tickBoundaries;                   // sorted start and end ticks of all segments
+    std::vector<int> _tickSegments;                     // first segment playing [_tickBoundaries[i], _tickBoundaries[i + 1]), or -1
+
     void collectRepeatListElements();
+    void collectSectionKeys(std::vector<std::vector<uint64_t> >& keys) const;
     std::pair<std::vector<RepeatListElementList>::const_iterator, RepeatListElementList::const_iterator> findMarker(
         String label, std::vector<RepeatListElementList>::const_iterator referenceSectionIt,
         RepeatListElementList::const_iterator referenceRepeatListElementIt) const;
@@ -97,7 +109,11 @@ class RepeatList : public std::vector<RepeatSegment*>
                      RepeatListElementList::const_iterator repeatListElementTargetIt, bool withRepeats, int* const playbackCount,
                      Volta const** const activeVolta, RepeatListElement const** const startRepeatReference) const;
     void unwind();
+    bool unwindSections(size_t firstSection);
     void flatten();
+    void updateLookupTables();
+    size_t segmentIndexFromUTick(int utick) const;
+    size_t segmentIndexFromUTime(double secs) const;
 
 public:
     RepeatList(Score* s);
@@ -48,7 +48,8 @@ compat::DummyElement* RootItem::dummy() const
 void RootItem::init()
 {
 #ifndef ENGRAVING_NO_ACCESSIBILITY
-    setupAccessible();
+    //! NOTE Registered when the first item is focused, see EngravingItem::doInitAccessible()
+    createAccessibleIfNeed();
 #endif
 
     m_dummy->setParent(this);
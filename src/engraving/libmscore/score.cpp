@@ -27,6 +27,7 @@
 
 #include "score.h"
 
+#include <algorithm>
 #include <cmath>
 #include <map>
 
@@ -166,6 +167,9 @@ void MeasureBaseList::push_back(MeasureBase* e)
         e->setNext(0);
     }
     _last = e;
+    if (e->isMeasure()) {
+        _measures.push_back(toMeasure(e));
+    }
 }
 
 //---------------------------------------------------------
@@ -185,6 +189,9 @@ void MeasureBaseList::push_front(MeasureBase* e)
         e->setNext(0);
     }
     _first = e;
+    if (e->isMeasure()) {
+        _measures.insert(_measures.begin(), toMeasure(e));
+    }
 }
 
 //---------------------------------------------------------
@@ -207,6 +214,7 @@ void MeasureBaseList::add(MeasureBase* e)
     e->setPrev(el->prev());
     el->prev()->setNext(e);
     el->setPrev(e);
+    updateIndex();
 }
 
 //---------------------------------------------------------
@@ -226,6 +234,7 @@ void MeasureBaseList::remove(MeasureBase* el)
     } else {
         _last = el->prev();
     }
+    updateIndex();
 }
 
 //---------------------------------------------------------
@@ -250,6 +259,7 @@ void MeasureBaseList::insert(MeasureBase* fm, MeasureBase* lm)
     } else {
         _last = lm;
     }
+    updateIndex();
 }
 
 //---------------------------------------------------------
@@ -274,6 +284,7 @@ void MeasureBaseList::remove(MeasureBase* fm, MeasureBase* lm)
     } else {
         _last = pm;
     }
+    updateIndex();
 }
 
 //---------------------------------------------------------
@@ -303,6 +314,35 @@ void MeasureBaseList::change(MeasureBase* ob, MeasureBase* nb)
     for (EngravingItem* e : nb->el()) {
         e->setParent(nb);
     }
+    updateIndex();
+}
+
+//---------------------------------------------------------
+//   updateIndex
+//---------------------------------------------------------
+
+void MeasureBaseList::updateIndex()
+{
+    _measures.clear();
+    for (MeasureBase* mb = _first; mb; mb = mb->next()) {
+        if (mb->isMeasure()) {
+            _measures.push_back(toMeasure(mb));
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   measureAt
+///   Return the last measure starting at or before \a tick,
+///   nullptr if there is none.
+//---------------------------------------------------------
+
+Measure* MeasureBaseList::measureAt(const Fraction& tick) const
+{
+    auto it = std::upper_bound(_measures.begin(), _measures.end(), tick, [](const Fraction& t, const Measure* m) {
+        return t < m->tick();
+    });
+    return it != _measures.begin() ? *(it - 1) : nullptr;
 }
 
 //---------------------------------------------------------
@@ -463,7 +503,7 @@ Score* Score::clone()
         excerpt->parts().push_back(part);
 
         for (track_idx_t track = part->startTrack(); track < part->endTrack(); ++track) {
-            excerpt->tracksMapping().insert({ track, track });
+            excerpt->addTrackMapping(track, track);
         }
     }
 
@@ -520,6 +560,16 @@ void Score::onElementDestruction(EngravingItem* e)
     score->elementDestroyed().send(e);
 }
 
+//---------------------------------------------------------
+//   itemByEid
+//---------------------------------------------------------
+
+EngravingItem* Score::itemByEid(eid_t eid) const
+{
+    EngravingItem* item = EngravingItem::itemByEid(eid);
+    return item && item->score() == this ? item : nullptr;
+}
+
 //---------------------------------------------------------
 //   addMeasure
 //---------------------------------------------------------
@@ -936,8 +986,9 @@ void Score::setIsOpen(bool open)
 
 void Score::spell()
 {
+    std::vector<std::vector<Note*> > lists(nstaves());
     for (staff_idx_t i = 0; i < nstaves(); ++i) {
-        std::vector<Note*> notes;
+        std::vector<Note*>& notes = lists[i];
         for (Segment* s = firstSegment(SegmentType::All); s; s = s->next1()) {
             track_idx_t strack = i * VOICES;
             track_idx_t etrack = strack + VOICES;
@@ -949,14 +1000,16 @@ void Score::spell()
                 }
             }
         }
-        spellNotelist(notes);
     }
+    spellNotelists(lists);
 }
 
 void Score::spell(staff_idx_t startStaff, staff_idx_t endStaff, Segment* startSegment, Segment* endSegment)
 {
+    std::vector<std::vector<Note*> > lists;
     for (staff_idx_t i = startStaff; i < endStaff; ++i) {
-        std::vector<Note*> notes;
+        lists.emplace_back();
+        std::vector<Note*>& notes = lists.back();
         for (Segment* s = startSegment; s && s != endSegment; s = s->next()) {
             track_idx_t strack = i * VOICES;
             track_idx_t etrack = strack + VOICES;
@@ -969,8 +1022,8 @@ void Score::spell(staff_idx_t startStaff, staff_idx_t endStaff, Segment* startSe
                 }
             }
         }
-        spellNotelist(notes);
     }
+    spellNotelists(lists);
 }
 
 void Score::changeEnharmonicSpelling(bool both)
@@ -1465,6 +1518,9 @@ static void spatiumHasChanged(void* data, EngravingItem* e)
 
 //---------------------------------------------------------
 //   spatiumChanged
+//    only the spatium dependent values of the elements are rescaled,
+//    the page size and margins don't scale with the spatium, so the
+//    system breaks and the page layout are computed again
 //---------------------------------------------------------
 
 void Score::spatiumChanged(double oldValue, double newValue)
@@ -2323,7 +2379,7 @@ bool Score::appendMeasuresFromScore(Score* score, const Fraction& startTick, con
     }
 
     // clone the spanners (only in the range currently copied)
-    auto ospans = score->spanner();
+    const auto& ospans = score->spanner();
     auto lb = ospans.lower_bound(startTick.ticks()), ub = ospans.upper_bound(endTick.ticks());
     for (auto sp = lb; sp != ub; sp++) {
         Spanner* spanner = sp->second;
@@ -3076,6 +3132,9 @@ void Score::cmdConcertPitchChanged(bool flag)
 
     undoChangeStyleVal(Sid::concertPitch, flag);         // change style flag
 
+    std::vector<bool> transposedStaves(nstaves(), false);
+    bool anyTransposed = false;
+
     for (Staff* staff : _staves) {
         if (staff->staffType(Fraction(0, 1))->group() == StaffGroup::PERCUSSION) {         // TODO
             continue;
@@ -3089,35 +3148,40 @@ void Score::cmdConcertPitchChanged(bool flag)
             interval.flip();
         }
 
-        staff_idx_t staffIdx   = staff->idx();
-        track_idx_t startTrack = staffIdx * VOICES;
-        track_idx_t endTrack   = startTrack + VOICES;
+        staff_idx_t staffIdx = staff->idx();
+        transposedStaves[staffIdx] = true;
+        anyTransposed = true;
 
         transposeKeys(staffIdx, staffIdx + 1, Fraction(0, 1), lastSegment()->tick(), interval, true, !flag);
+    }
 
-        for (Segment* segment = firstSegment(SegmentType::ChordRest); segment; segment = segment->next1(SegmentType::ChordRest)) {
-            interval = staff->part()->instrument(segment->tick())->transpose();
+    if (!anyTransposed) {
+        return;
+    }
+
+    // the chord symbols of all the transposed staves in one pass over the score
+    for (Segment* segment = firstSegment(SegmentType::ChordRest); segment; segment = segment->next1(SegmentType::ChordRest)) {
+        for (EngravingItem* e : segment->annotations()) {
+            if (!e->isHarmony() || (e->track() / VOICES) >= transposedStaves.size() || !transposedStaves[e->track() / VOICES]) {
+                continue;
+            }
+            Harmony* h  = toHarmony(e);
+            Interval interval = h->staff()->part()->instrument(segment->tick())->transpose();
             if (!flag) {
                 interval.flip();
             }
-            for (EngravingItem* e : segment->annotations()) {
-                if (!e->isHarmony() || (e->track() < startTrack) || (e->track() >= endTrack)) {
-                    continue;
+            int rootTpc = transposeTpc(h->rootTpc(), interval, true);
+            int baseTpc = transposeTpc(h->baseTpc(), interval, true);
+            for (EngravingObject* se : h->linkList()) {
+                // don't transpose all links
+                // just ones resulting from mmrests
+                Harmony* he = toHarmony(se);              // toHarmony() does not work as e is an ScoreElement
+                if (he->staff() == h->staff()) {
+                    undoTransposeHarmony(he, rootTpc, baseTpc);
                 }
-                Harmony* h  = toHarmony(e);
-                int rootTpc = transposeTpc(h->rootTpc(), interval, true);
-                int baseTpc = transposeTpc(h->baseTpc(), interval, true);
-                for (EngravingObject* se : h->linkList()) {
-                    // don't transpose all links
-                    // just ones resulting from mmrests
-                    Harmony* he = toHarmony(se);              // toHarmony() does not work as e is an ScoreElement
-                    if (he->staff() == h->staff()) {
-                        undoTransposeHarmony(he, rootTpc, baseTpc);
-                    }
-                }
-                //realized harmony should be invalid after a transpose command
-                assert(!h->realizedHarmony().valid());
             }
+            //realized harmony should be invalid after a transpose command
+            assert(!h->realizedHarmony().valid());
         }
     }
 }
@@ -4124,16 +4188,16 @@ void Score::lassoSelect(const RectF& bbox)
             break;
         }
 
-        std::vector<EngravingItem*> items = page->items(frr);
         std::vector<EngravingItem*> itemsToSelect;
-
-        for (EngravingItem* item : items) {
-            if (frr.contains(item->abbox())) {
+        page->updateBspTree();
+        page->visitItems(frr, [&frr, &itemsToSelect](EngravingItem* item) {
+            if (item->pageBoundingRect().intersects(frr) && frr.contains(item->abbox())) {
                 if (item->type() != ElementType::MEASURE && item->selectable()) {
                     itemsToSelect.push_back(item);
                 }
             }
-        }
+            return true;
+        });
 
         select(itemsToSelect, SelectType::ADD, 0);
     }
@@ -4478,10 +4542,10 @@ void Score::addSpanner(Spanner* s)
     _spanner.addSpanner(s);
     s->added();
     if (s->startElement()) {
-        s->startElement()->startingSpanners().push_back(s);
+        s->startElement()->addStartingSpanner(s);
     }
     if (s->endElement()) {
-        s->endElement()->endingSpanners().push_back(s);
+        s->endElement()->addEndingSpanner(s);
     }
 }
 
@@ -4494,10 +4558,10 @@ void Score::removeSpanner(Spanner* s)
     _spanner.removeSpanner(s);
     s->removed();
     if (s->startElement()) {
-        mu::remove_if(s->startElement()->startingSpanners(), [s](Spanner* sp) { return sp == s; });
+        s->startElement()->removeStartingSpanner(s);
     }
     if (s->endElement()) {
-        mu::remove_if(s->endElement()->endingSpanners(), [s](Spanner* sp) { return sp == s; });
+        s->endElement()->removeEndingSpanner(s);
     }
 }
 
@@ -5282,7 +5346,7 @@ void Score::changeSelectedNotesVoice(voice_idx_t voice)
             ChordRest* dstCR = toChordRest(s->element(dstTrack));
             Chord* dstChord  = nullptr;
 
-            if (excerpt() && mu::key(excerpt()->tracksMapping(), dstTrack, mu::nidx) == mu::nidx) {
+            if (excerpt() && excerpt()->masterTrack(dstTrack) == mu::nidx) {
                 break;
             }
 
@@ -5535,6 +5599,7 @@ String Score::name() const
 void Score::addRefresh(const mu::RectF& r)
 {
     _updateState.refresh.unite(r);
+    m_paintDamage.add(r);
     cmdState().setUpdateMode(UpdateMode::Update);
 }
 
@@ -5616,6 +5681,7 @@ void Score::rebuildBspTree()
 {
     for (Page* page : pages()) {
         page->invalidateBspTree();
+        page->updateBspTree();
     }
 }
 
@@ -5738,6 +5804,7 @@ void Score::doLayoutRange(const Fraction& st, const Fraction& et)
 
     m_layoutOptions.updateFromStyle(style());
     m_layout.doLayoutRange(m_layoutOptions, st, et);
+    m_layoutOptions.pageLimit = 0;
 
     if (_resetAutoplace) {
         _resetAutoplace = false;
@@ -5748,6 +5815,89 @@ void Score::doLayoutRange(const Fraction& st, const Fraction& et)
         _resetDefaults = false;
         resetDefaults();
     }
+
+    //! NOTE The trees of the laid out pages are rebuilt here rather than on the first paint,
+    //! the painting doesn't modify the pages
+    for (Page* page : pages()) {
+        page->updateBspTree();
+    }
+}
+
+//---------------------------------------------------------
+//   continueLayout
+//---------------------------------------------------------
+
+void Score::continueLayout(size_t pages)
+{
+    if (m_layout.isComplete()) {
+        return;
+    }
+
+    TRACEFUNC;
+
+    setLayoutPageLimit(pages);
+    doLayoutRange(m_layout.pendingTick(), Fraction(-1, 1));
+}
+
+//---------------------------------------------------------
+//   refineDraftLayout
+//---------------------------------------------------------
+
+void Score::refineDraftLayout()
+{
+    if (!m_layout.hasDraftRange() || !last()) {
+        return;
+    }
+
+    TRACEFUNC;
+
+    Fraction stick = m_layout.draftStartTick();
+    Fraction etick = m_layout.draftEndTick();
+    m_layout.clearDraftRange();
+
+    // the score may have been shortened since the draft
+    if (stick >= last()->endTick()) {
+        stick = last()->tick();
+    }
+    if (etick >= last()->endTick()) {
+        etick = Fraction(-1, 1);
+    }
+
+    const bool draft = m_layoutOptions.draftLayout;
+    m_layoutOptions.draftLayout = false;
+    doLayoutRange(stick, etick);
+    m_layoutOptions.draftLayout = draft;
+}
+
+//---------------------------------------------------------
+//   setLinearLayoutWindow
+//---------------------------------------------------------
+
+void Score::setLinearLayoutWindow(const Fraction& stick, const Fraction& etick)
+{
+    // the pages of an export may be painted concurrently, each of them sets the same window
+    if (m_layoutOptions.linearWindowStart != stick || m_layoutOptions.linearWindowEnd != etick) {
+        m_layoutOptions.linearWindowStart = stick;
+        m_layoutOptions.linearWindowEnd = etick;
+    }
+
+    if (!m_layoutOptions.isLinearMode() || !last()) {
+        return;
+    }
+
+    Fraction st = stick.negative() ? Fraction(0, 1) : stick;
+    Fraction et = etick.negative() ? last()->endTick() : etick;
+    if (m_layout.isLinearRangeStale(st, et)) {
+        doLayoutRange(st, et);
+    }
+}
+
+void Score::setLayoutMode(LayoutMode lm)
+{
+    m_layoutOptions.mode = lm;
+    // the window is set by the view once the score is laid out in continuous view
+    m_layoutOptions.linearWindowStart = Fraction(-1, 1);
+    m_layoutOptions.linearWindowEnd = Fraction(-1, 1);
 }
 
 void Score::createPaddingTable()
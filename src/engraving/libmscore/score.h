@@ -30,6 +30,7 @@
 
 #include <set>
 #include <memory>
+#include <vector>
 
 #include "async/channel.h"
 #include "io/iodevice.h"
@@ -164,15 +165,17 @@ class MeasureBaseList
     int _size;
     MeasureBase* _first = nullptr;
     MeasureBase* _last = nullptr;
+    std::vector<Measure*> _measures;      ///< measures of the list in list (that is tick) order
 
     void push_back(MeasureBase* e);
     void push_front(MeasureBase* e);
+    void updateIndex();
 
 public:
     MeasureBaseList();
     MeasureBase* first() const { return _first; }
     MeasureBase* last()  const { return _last; }
-    void clear() { _first = _last = 0; _size = 0; }
+    void clear() { _first = _last = 0; _size = 0; _measures.clear(); }
     void add(MeasureBase*);
     void remove(MeasureBase*);
     void insert(MeasureBase*, MeasureBase*);
@@ -180,6 +183,9 @@ public:
     void change(MeasureBase* o, MeasureBase* n);
     int size() const { return _size; }
     bool empty() const { return _size == 0; }
+
+    const std::vector<Measure*>& measures() const { return _measures; }
+    Measure* measureAt(const Fraction& tick) const;
 };
 
 //---------------------------------------------------------
@@ -298,6 +304,7 @@ public:
 
     void lock() { _locked = true; }
     void unlock() { _locked = false; }
+    bool locked() const { return _locked; }
 #ifndef NDEBUG
     void dump();
 #endif
@@ -317,6 +324,22 @@ public:
     std::list<EngravingObject*> _deleteList;
 };
 
+//---------------------------------------------------------
+//   PaintDamage
+//    canvas area painted differently since the last reset,
+//    for the views which keep the painted score
+//---------------------------------------------------------
+
+struct PaintDamage
+{
+    mu::RectF rect;
+    bool all = false;
+
+    bool isEmpty() const { return !all && rect.isNull(); }
+    void add(const mu::RectF& r) { rect.unite(r); }
+    void add(const PaintDamage& d) { rect.unite(d.rect); all = all || d.all; }
+};
+
 //---------------------------------------------------------
 //   PaddingTable
 //---------------------------------------------------------
@@ -391,6 +414,7 @@ private:
     int _pageNumberOffset { 0 };          ///< Offset for page numbers.
 
     UpdateState _updateState;
+    PaintDamage m_paintDamage;
 
     MeasureBaseList _measures;            // here are the notes
     std::vector<Part*> _parts;
@@ -526,6 +550,9 @@ public:
 
     static void onElementDestruction(EngravingItem* se);
 
+    // item of this score by EngravingItem::eid(), including the removed ones still kept by the undo stack
+    EngravingItem* itemByEid(eid_t eid) const;
+
     // Score Tree functions
     EngravingObject* scanParent() const override;
     EngravingObjectList scanChildren() const override;
@@ -654,6 +681,7 @@ public:
     void undoChangePitch(Note* note, int pitch, int tpc1, int tpc2);
     void undoChangeFretting(Note* note, int pitch, int string, int fret, int tpc1, int tpc2);
     void spellNotelist(std::vector<Note*>& notes);
+    void spellNotelists(std::vector<std::vector<Note*> >& lists);
     void undoChangeTpc(Note* note, int tpc);
     void undoChangeChordRestLen(ChordRest* cr, const TDuration&);
     void undoTransposeHarmony(Harmony*, int, int);
@@ -770,6 +798,11 @@ public:
     virtual void setInstrumentsChanged(bool);
     void addRefresh(const mu::RectF&);
 
+    const PaintDamage& paintDamage() const { return m_paintDamage; }
+    void addPaintDamage(const mu::RectF& r) { m_paintDamage.add(r); }
+    void setPaintDamageAll() { m_paintDamage.all = true; }
+    void resetPaintDamage() { m_paintDamage = PaintDamage(); }
+
     void cmdToggleAutoplace(bool all);
 
     bool playNote() const { return _updateState._playNote; }
@@ -1049,6 +1082,19 @@ public:
 
     void doLayout();
     void doLayoutRange(const Fraction& st, const Fraction& et);
+    //! The next layout stops after the given number of pages, see continueLayout()
+    void setLayoutPageLimit(size_t pages) { m_layoutOptions.pageLimit = pages; }
+    //! Lays out the next pages (0: all) of a score whose layout has stopped at the page limit
+    void continueLayout(size_t pages);
+    bool isLayoutComplete() const { return m_layout.isComplete(); }
+    //! The next layouts leave out the vertical justification of the pages, see refineDraftLayout()
+    void setDraftLayout(bool v) { m_layoutOptions.draftLayout = v; }
+    bool hasDraftLayout() const { return m_layout.hasDraftRange(); }
+    //! Lays out the pages left as a draft again with the vertical justification
+    void refineDraftLayout();
+    //! Continuous view: limits the layout to the measures starting in the range (negative: no limit)
+    //! and lays out the measures of the range left out by earlier layouts
+    void setLinearLayoutWindow(const Fraction& stick, const Fraction& etick);
 
     SynthesizerState& synthesizerState() { return _synthesizerState; }
     void setSynthesizerState(const SynthesizerState& s);
@@ -1095,8 +1141,15 @@ public:
 
     //! NOTE Layout
     const LayoutOptions& layoutOptions() const { return m_layoutOptions; }
-    void setLayoutMode(LayoutMode lm) { m_layoutOptions.mode = lm; }
+    const Layout& layout() const { return m_layout; }
+    void setLayoutMode(LayoutMode lm);
     void setShowVBox(bool v) { m_layoutOptions.showVBox = v; }
+    void setOptimalSystemBreaks(bool v) { m_layoutOptions.optimalSystemBreaks = v; }
+    void setPipelinedPageLayout(bool v) { m_layoutOptions.pipelinedPageLayout = v; }
+    void setParallelExcerptsLayout(bool v) { m_layoutOptions.parallelExcerptsLayout = v; }
+    //! Record the time of the layout phases in layout().statistics() from the next layout on
+    void setCollectLayoutStatistics(bool v) { m_layoutOptions.collectStatistics = v; }
+    void clearLayoutStatistics() { m_layout.statistics().clear(); }
 
     // temporary methods
     bool isLayoutMode(LayoutMode lm) const { return m_layoutOptions.isMode(lm); }
@@ -21,6 +21,7 @@
  */
 
 #include <cmath>
+#include <map>
 
 #include "io/file.h"
 #include "io/fileinfo.h"
@@ -515,6 +516,17 @@ void Score::writeSegments(XmlWriter& xml, track_idx_t strack, track_idx_t etrack
 
         bool voiceTagWritten = false;
 
+        // the spanners starting or ending in this track by tick, in the order of spanners
+        std::map<Fraction, std::vector<Spanner*> > trackSpanners;
+        for (Spanner* s : spanners) {
+            if (s->track() == track) {
+                trackSpanners[s->tick()].push_back(s);
+            }
+            if (s->effectiveTrack2() == track && !(s->track() == track && s->tick2() == s->tick())) {
+                trackSpanners[s->tick2()].push_back(s);
+            }
+        }
+
         bool timeSigWritten = false;     // for forceTimeSig
         bool crWritten = false;          // for forceTimeSig
         bool keySigWritten = false;      // for forceTimeSig
@@ -576,8 +588,9 @@ void Score::writeSegments(XmlWriter& xml, track_idx_t strack, track_idx_t etrack
             Measure* m = segment->measure();
             // don't write spanners for multi measure rests
 
-            if ((!(m && m->isMMRest())) && segment->isChordRestType()) {
-                for (Spanner* s : spanners) {
+            auto tickSpanners = trackSpanners.find(segment->tick());
+            if ((!(m && m->isMMRest())) && segment->isChordRestType() && tickSpanners != trackSpanners.end()) {
+                for (Spanner* s : tickSpanners->second) {
                     if (s->track() == track) {
                         bool end = false;
                         if (s->anchor() == Spanner::Anchor::CHORD || s->anchor() == Spanner::Anchor::NOTE) {
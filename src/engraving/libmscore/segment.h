@@ -320,6 +320,7 @@ public:
     Fraction shortestChordRest() const;
     void computeCrossBeamType(Segment* nextSeg);
     CrossBeamType crossBeamType() const { return _crossBeamType; }
+    void setCrossBeamType(CrossBeamType type) { _crossBeamType = type; }
 
     bool hasAccidentals() const;
 
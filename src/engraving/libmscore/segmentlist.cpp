@@ -21,6 +21,9 @@
  */
 
 #include "segmentlist.h"
+
+#include <algorithm>
+
 #include "segment.h"
 #include "score.h"
 
@@ -108,6 +111,13 @@ void SegmentList::check()
         ASSERT_X(String(u"SegmentList::check: counted %1 but _size is %d2").arg(n, _size));
         _size = n;
     }
+    size_t i = 0;
+    for (Segment* s = _first; s; s = s->next(), ++i) {
+        if (i >= _index.size() || _index[i] != s) {
+            ASSERT_X("SegmentList::check: index out of sync");
+            break;
+        }
+    }
 }
 
 #endif
@@ -129,6 +139,8 @@ void SegmentList::insert(Segment* e, Segment* el)
         e->setPrev(el->prev());
         el->prev()->setNext(e);
         el->setPrev(e);
+        _index.insert(std::find(_index.begin(), _index.end(), el), e);
+        _types = _types | e->segmentType();
     }
     check();
 }
@@ -170,6 +182,23 @@ void SegmentList::remove(Segment* e)
         e->prev()->setNext(e->next());
         e->next()->setPrev(e->prev());
     }
+    auto it = std::find(_index.begin(), _index.end(), e);
+    if (it != _index.end()) {
+        _index.erase(it);
+    }
+    updateTypes();
+}
+
+//---------------------------------------------------------
+//   updateTypes
+//---------------------------------------------------------
+
+void SegmentList::updateTypes()
+{
+    _types = SegmentType::Invalid;
+    for (const Segment* s : _index) {
+        _types = _types | s->segmentType();
+    }
 }
 
 //---------------------------------------------------------
@@ -187,6 +216,8 @@ void SegmentList::push_back(Segment* e)
     }
     e->setPrev(_last);
     _last = e;
+    _index.push_back(e);
+    _types = _types | e->segmentType();
     check();
 }
 
@@ -205,6 +236,8 @@ void SegmentList::push_front(Segment* e)
     }
     e->setNext(_first);
     _first = e;
+    _index.insert(_index.begin(), e);
+    _types = _types | e->segmentType();
     check();
 }
 
@@ -223,7 +256,10 @@ Segment* SegmentList::firstCRSegment() const
 
 Segment* SegmentList::first(SegmentType types) const
 {
-    for (Segment* s = _first; s; s = s->next()) {
+    if (!hasType(types)) {
+        return 0;
+    }
+    for (Segment* s : _index) {
         if (s->segmentType() & types) {
             return s;
         }
@@ -231,6 +267,20 @@ Segment* SegmentList::first(SegmentType types) const
     return 0;
 }
 
+//---------------------------------------------------------
+//   lowerBound
+///   Return the first segment whose measure relative tick
+///   is not less than \a rtick, nullptr if there is none.
+//---------------------------------------------------------
+
+Segment* SegmentList::lowerBound(const Fraction& rtick) const
+{
+    auto it = std::lower_bound(_index.begin(), _index.end(), rtick, [](const Segment* s, const Fraction& t) {
+        return s->rtick() < t;
+    });
+    return it != _index.end() ? *it : nullptr;
+}
+
 //---------------------------------------------------------
 //   first
 //---------------------------------------------------------
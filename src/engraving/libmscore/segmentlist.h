@@ -23,6 +23,8 @@
 #ifndef __SEGMENTLIST_H__
 #define __SEGMENTLIST_H__
 
+#include <vector>
+
 #include "segment.h"
 
 namespace mu::engraving {
@@ -30,6 +32,9 @@ class Segment;
 
 //---------------------------------------------------------
 //   SegmentList
+//    The segments are linked through Segment::next()/prev(),
+//    and kept in list (that is tick) order in a flat array
+//    besides for binary searches by tick.
 //---------------------------------------------------------
 
 class SegmentList
@@ -37,10 +42,14 @@ class SegmentList
     Segment* _first;          ///< First item of segment list
     Segment* _last;           ///< Last item of segment list
     int _size;                ///< Number of items in segment list
+    std::vector<Segment*> _index;   ///< all items in list order
+    SegmentType _types;       ///< union of the types of all items
+
+    void updateTypes();
 
 public:
     SegmentList() { clear(); }
-    void clear() { _first = _last = 0; _size = 0; }
+    void clear() { _first = _last = 0; _size = 0; _index.clear(); _types = SegmentType::Invalid; }
 #ifndef NDEBUG
     void check();
 #else
@@ -56,6 +65,9 @@ public:
     Segment* last() const { return _last; }
     Segment* last(ElementFlag) const;
     Segment* firstCRSegment() const;
+    Segment* lowerBound(const Fraction& rtick) const;       ///< first segment at or after rtick
+    bool hasType(SegmentType types) const { return _types & types; }
+    const std::vector<Segment*>& index() const { return _index; }
     void remove(Segment*);
     void push_back(Segment*);
     void push_front(Segment*);
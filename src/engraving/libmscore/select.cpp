@@ -25,6 +25,9 @@
  Implementation of class Selection plus other selection related functions.
 */
 
+#include <array>
+#include <unordered_set>
+
 #include "containers.h"
 #include "io/buffer.h"
 #include "rw/xml.h"
@@ -418,12 +421,25 @@ void Selection::clear()
         return;
     }
 
+    //! NOTE A range selection can hold the whole score, so instead of collecting
+    //! the bounding rect of every element its area is refreshed at once
+    const bool refreshAll = _state == SelState::RANGE && !_el.empty();
+    if (refreshAll) {
+        _score->setUpdateAll();
+    }
+
     for (EngravingItem* e : _el) {
         if (e->isSpanner()) {       // TODO: only visible elements should be selectable?
             Spanner* sp = toSpanner(e);
             for (auto s : sp->spannerSegments()) {
-                e->score()->addRefresh(changeSelection(s, false));
+                if (refreshAll) {
+                    s->setSelected(false);
+                } else {
+                    e->score()->addRefresh(changeSelection(s, false));
+                }
             }
+        } else if (refreshAll) {
+            e->setSelected(false);
         } else {
             e->score()->addRefresh(changeSelection(e, false));
         }
@@ -474,7 +490,7 @@ void Selection::appendChord(Chord* chord)
         LOGE() << "selection locked, reason: " << lockReason();
         return;
     }
-    if (chord->beam() && !mu::contains(_el, static_cast<EngravingItem*>(chord->beam()))) {
+    if (chord->beam() && _appendedBeams.insert(chord->beam()).second) {
         _el.push_back(chord->beam());
     }
     if (chord->stem()) {
@@ -564,6 +580,7 @@ void Selection::updateSelectedElements()
         e->setSelected(false);
     }
     _el.clear();
+    _appendedBeams.clear();
 
     // assert:
     size_t staves = _score->nstaves();
@@ -654,6 +671,7 @@ void Selection::updateSelectedElements()
             appendFiltered(sp);       // spanner with start and end in range selection
         }
     }
+    _appendedBeams.clear();
     update();
 }
 
@@ -801,30 +819,29 @@ ByteArray Selection::mimeData() const
     return a;
 }
 
-static bool hasElementInTrack(Segment* startSeg, Segment* endSeg, track_idx_t track)
-{
-    for (Segment* seg = startSeg; seg != endSeg; seg = seg->next1MM()) {
-        if (!seg->enabled()) {
-            continue;
-        }
-        if (seg->element(track)) {
-            return true;
-        }
-    }
-    return false;
-}
+//---------------------------------------------------------
+//   firstElementTicks
+//    tick of the first element in each voice of the staff
+//    starting at startTrack, -1 for the empty voices
+//---------------------------------------------------------
 
-static Fraction firstElementInTrack(Segment* startSeg, Segment* endSeg, track_idx_t track)
+static std::array<Fraction, VOICES> firstElementTicks(Segment* startSeg, Segment* endSeg, track_idx_t startTrack)
 {
-    for (Segment* seg = startSeg; seg != endSeg; seg = seg->next1MM()) {
+    std::array<Fraction, VOICES> ticks;
+    ticks.fill(Fraction(-1, 1));
+    voice_idx_t found = 0;
+    for (Segment* seg = startSeg; seg != endSeg && found < VOICES; seg = seg->next1MM()) {
         if (!seg->enabled()) {
             continue;
         }
-        if (seg->element(track)) {
-            return seg->tick();
+        for (voice_idx_t voice = 0; voice < VOICES; ++voice) {
+            if (ticks[voice] == Fraction(-1, 1) && seg->element(startTrack + voice)) {
+                ticks[voice] = seg->tick();
+                ++found;
+            }
         }
     }
-    return Fraction(-1, 1);
+    return ticks;
 }
 
 ByteArray Selection::staffMimeData() const
@@ -864,10 +881,11 @@ ByteArray Selection::staffMimeData() const
             xml.tag("transposeDiatonic", interval.diatonic);
         }
         xml.startElement("voiceOffset");
+        std::array<Fraction, VOICES> firstTicks = firstElementTicks(seg1, seg2, startTrack);
         for (voice_idx_t voice = 0; voice < VOICES; voice++) {
-            if (hasElementInTrack(seg1, seg2, startTrack + voice)
+            if (firstTicks[voice] != Fraction(-1, 1)
                 && xml.context()->canWriteVoice(voice)) {
-                Fraction offset = firstElementInTrack(seg1, seg2, startTrack + voice) - tickStart();
+                Fraction offset = firstTicks[voice] - tickStart();
                 xml.tag("voice", { { "id", voice } }, offset.ticks());
             }
         }
@@ -1339,17 +1357,17 @@ bool Selection::measureRange(Measure** m1, Measure** m2) const
 const std::list<EngravingItem*> Selection::uniqueElements() const
 {
     std::list<EngravingItem*> l;
+    // the elements of l and everything linked to them
+    std::unordered_set<const EngravingObject*> taken;
 
     for (EngravingItem* e : elements()) {
-        bool alreadyThere = false;
-        for (EngravingItem* ee : l) {
-            if ((ee->links() && ee->links()->contains(e)) || e == ee) {
-                alreadyThere = true;
-                break;
-            }
+        if (mu::contains(taken, static_cast<const EngravingObject*>(e))) {
+            continue;
         }
-        if (!alreadyThere) {
-            l.push_back(e);
+        l.push_back(e);
+        taken.insert(e);
+        if (e->links()) {
+            taken.insert(e->links()->begin(), e->links()->end());
         }
     }
     return l;
@@ -1365,18 +1383,18 @@ const std::list<EngravingItem*> Selection::uniqueElements() const
 std::list<Note*> Selection::uniqueNotes(track_idx_t track) const
 {
     std::list<Note*> l;
+    // the notes of l and everything linked to them
+    std::unordered_set<const EngravingObject*> taken;
 
     for (Note* nn : noteList(track)) {
         for (Note* note : nn->tiedNotes()) {
-            bool alreadyThere = false;
-            for (Note* n : l) {
-                if ((n->links() && n->links()->contains(note)) || n == note) {
-                    alreadyThere = true;
-                    break;
-                }
+            if (mu::contains(taken, static_cast<const EngravingObject*>(note))) {
+                continue;
             }
-            if (!alreadyThere) {
-                l.push_back(note);
+            l.push_back(note);
+            taken.insert(note);
+            if (note->links()) {
+                taken.insert(note->links()->begin(), note->links()->end());
             }
         }
     }
@@ -23,6 +23,8 @@
 #ifndef __SELECT_H__
 #define __SELECT_H__
 
+#include <unordered_set>
+
 #include "durationtype.h"
 #include "mscore.h"
 #include "pitchspelling.h"
@@ -155,6 +157,7 @@ class Selection
     Score* _score;
     SelState _state;
     std::vector<EngravingItem*> _el;            // valid in mode SelState::LIST
+    std::unordered_set<const EngravingItem*> _appendedBeams; // beams already in _el while a range is being collected
 
     staff_idx_t _staffStart = 0;            // valid if selState is SelState::RANGE
     staff_idx_t _staffEnd = 0;
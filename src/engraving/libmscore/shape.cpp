@@ -105,27 +105,32 @@ double Shape::minHorizontalDistance(const Shape& a, Score* score) const
         const EngravingItem* item2 = r2.toItem;
         double by1 = r2.top();
         double by2 = r2.bottom();
+        bool zeroWidth2 = r2.width() == 0;
+        bool lyrics2 = item2 && item2->isLyrics();
         for (const ShapeElement& r1 : *this) {
             const EngravingItem* item1 = r1.toItem;
-            double ay1 = r1.top();
-            double ay2 = r1.bottom();
-            bool intersection = mu::engraving::intersects(ay1, ay2, by1, by2, verticalClearance);
-            double padding = 0;
             KerningType kerningType = KerningType::NON_KERNING;
             if (item1 && item2) {
-                padding = item1->computePadding(item2);
                 kerningType = item1->computeKerningType(item2);
             }
-            if ((intersection && kerningType != KerningType::ALLOW_COLLISION)
-                || (r1.width() == 0 || r2.width() == 0) // Temporary hack: shapes of zero-width are assumed to collide with everyghin
-                || (!item1 && item2 && item2->isLyrics()) // Temporary hack: avoids collision with melisma line
-                || kerningType == KerningType::NON_KERNING) {
-                dist = std::max(dist, r1.right() - r2.left() + padding);
-            }
             if (kerningType == KerningType::KERNING_UNTIL_ORIGIN) { //prepared for future user option, for now always false
                 double origin = r1.left();
                 dist = std::max(dist, origin - r2.left());
             }
+            // Decide whether the pair constrains the distance before computing the padding,
+            // which is by far the most expensive part: most pairs of a dense segment are
+            // vertically apart and kernable and never need it.
+            bool collides = kerningType == KerningType::NON_KERNING
+                            || zeroWidth2 || r1.width() == 0 // Temporary hack: shapes of zero-width are assumed to collide with everyghin
+                            || (!item1 && lyrics2); // Temporary hack: avoids collision with melisma line
+            if (!collides && kerningType != KerningType::ALLOW_COLLISION) {
+                collides = mu::engraving::intersects(r1.top(), r1.bottom(), by1, by2, verticalClearance);
+            }
+            if (!collides) {
+                continue;
+            }
+            double padding = (item1 && item2) ? item1->computePadding(item2) : 0.0;
+            dist = std::max(dist, r1.right() - r2.left() + padding);
         }
     }
     return dist;
@@ -22,6 +22,8 @@
 
 #include "skyline.h"
 
+#include <algorithm>
+
 #include "arpeggio.h"
 #include "beam.h"
 #include "chord.h"
@@ -87,15 +89,20 @@ void Skyline::add(const ShapeElement& r)
 //   insert
 //---------------------------------------------------------
 
-SkylineLine::SegIter SkylineLine::insert(SegIter i, double x, double y, double w, int span)
+size_t SkylineLine::insert(size_t i, double x, double y, double w, int span)
 {
     const double xr = x + w;
     // Only x coordinate change is handled here as width change gets handled
     // in SkylineLine::add().
-    if (i != seg.end() && xr > i->x) {
-        i->x = xr;
+    if (i < m_x.size() && xr > m_x[i]) {
+        m_x[i] = xr;
     }
-    return seg.emplace(i, x, y, w, span);
+    m_x.insert(m_x.begin() + i, x);
+    m_y.insert(m_y.begin() + i, y);
+    m_w.insert(m_w.begin() + i, w);
+    m_span.insert(m_span.begin() + i, span);
+    m_hasPositiveSpan |= span > 0;
+    return i;
 }
 
 //---------------------------------------------------------
@@ -104,25 +111,24 @@ SkylineLine::SegIter SkylineLine::insert(SegIter i, double x, double y, double w
 
 void SkylineLine::append(double x, double y, double w, int span)
 {
-    seg.emplace_back(x, y, w, span);
+    m_x.push_back(x);
+    m_y.push_back(y);
+    m_w.push_back(w);
+    m_span.push_back(span);
+    m_hasPositiveSpan |= span > 0;
 }
 
 //---------------------------------------------------------
 //   getApproxPosition
 //---------------------------------------------------------
 
-SkylineLine::SegIter SkylineLine::find(double x)
+size_t SkylineLine::find(double x) const
 {
-    auto it = std::upper_bound(seg.begin(), seg.end(), x, [](double x, const SkylineSegment& s) { return x < s.x; });
-    if (it == seg.begin()) {
-        return it;
+    auto it = std::upper_bound(m_x.begin(), m_x.end(), x);
+    if (it == m_x.begin()) {
+        return 0;
     }
-    return --it;
-}
-
-SkylineLine::SegConstIter SkylineLine::find(double x) const
-{
-    return const_cast<SkylineLine*>(this)->find(x);
+    return static_cast<size_t>(std::distance(m_x.begin(), it)) - 1;
 }
 
 //---------------------------------------------------------
@@ -166,34 +172,34 @@ void SkylineLine::add(double x, double y, double w, int span)
 
     DP("===add  %f %f %f\n", x, y, w);
 
-    SegIter i = find(x);
-    double cx = seg.empty() ? 0.0 : i->x;
-    for (; i != seg.end(); ++i) {
-        double cy = i->y;
+    size_t i = find(x);
+    double cx = m_x.empty() ? 0.0 : m_x[i];
+    for (; i < m_w.size(); ++i) {
+        double cy = m_y[i];
         if ((x + w) <= cx) {                                            // A
             return;       // break;
         }
-        if (x > (cx + i->w)) {                                          // B
-            cx += i->w;
+        if (x > (cx + m_w[i])) {                                        // B
+            cx += m_w[i];
             continue;
         }
         if ((north && (cy <= y)) || (!north && (cy >= y))) {
-            cx += i->w;
+            cx += m_w[i];
             continue;
         }
-        if ((x >= cx) && ((x + w) < (cx + i->w))) {                     // (E) insert segment
-            DP("    insert at %f %f   x:%f w:%f\n", cx, i->w, x, w);
+        if ((x >= cx) && ((x + w) < (cx + m_w[i]))) {                   // (E) insert segment
+            DP("    insert at %f %f   x:%f w:%f\n", cx, m_w[i], x, w);
             double w1 = x - cx;
             double w2 = w;
-            double w3 = i->w - (w1 + w2);
+            double w3 = m_w[i] - (w1 + w2);
             if (w1 > 0.0000001) {
-                i->w = w1;
+                m_w[i] = w1;
                 ++i;
                 i = insert(i, x, y, w2, span);
                 DP("       A w1 %f w2 %f\n", w1, w2);
             } else {
-                i->w = w2;
-                i->y = y;
+                m_w[i] = w2;
+                m_y[i] = y;
                 DP("       B w2 %f\n", w2);
             }
             if (w3 > 0.0000001) {
@@ -202,27 +208,27 @@ void SkylineLine::add(double x, double y, double w, int span)
                 insert(i, x + w2, cy, w3, span);
             }
             return;
-        } else if ((x <= cx) && ((x + w) >= (cx + i->w))) {                 // F
+        } else if ((x <= cx) && ((x + w) >= (cx + m_w[i]))) {           // F
             DP("    change(F) cx %f y %f\n", cx, y);
-            i->y = y;
+            m_y[i] = y;
         } else if (x < cx) {                                            // C
             double w1 = x + w - cx;
-            i->w    -= w1;
-            DP("    add(C) cx %f y %f w %f w1 %f\n", cx, y, w1, i->w);
+            m_w[i] -= w1;
+            DP("    add(C) cx %f y %f w %f w1 %f\n", cx, y, w1, m_w[i]);
             insert(i, cx, y, w1, span);
             return;
         } else {                                                        // D
             double w1 = x - cx;
-            double w2 = i->w - w1;
+            double w2 = m_w[i] - w1;
             if (w2 > 0.0000001) {
-                i->w = w1;
+                m_w[i] = w1;
                 cx  += w1;
                 DP("    add(D) %f %f\n", y, w2);
                 ++i;
                 i = insert(i, cx, y, w2, span);
             }
         }
-        cx += i->w;
+        cx += m_w[i];
     }
     if (x >= cx) {
         if (x > cx) {
@@ -247,6 +253,15 @@ void Skyline::clear()
     _south.clear();
 }
 
+void SkylineLine::clear()
+{
+    m_x.clear();
+    m_y.clear();
+    m_w.clear();
+    m_span.clear();
+    m_hasPositiveSpan = false;
+}
+
 //-------------------------------------------------------------------
 //   minDistance
 //    a is located below this skyline.
@@ -262,39 +277,95 @@ double SkylineLine::minDistance(const SkylineLine& sl) const
 {
     double dist = MINIMUM_Y;
 
+    const size_t n1 = m_w.size();
+    const size_t n2 = sl.m_w.size();
+    const double* w1 = m_w.data();
+    const double* y1 = m_y.data();
+    const int* span1 = m_span.data();
+    const double* w2 = sl.m_w.data();
+    const double* y2 = sl.m_y.data();
+    const int* span2 = sl.m_span.data();
+
     double x1 = 0.0;
     double x2 = 0.0;
-    auto k   = sl.begin();
-    for (auto i = begin(); i != end(); ++i) {
-        if (i->staffSpan > 0) {
+    size_t k = 0;
+    for (size_t i = 0; i < n1; ++i) {
+        if (span1[i] > 0) {
             continue; // don't add this to the distance because it crosses to the next staff
         }
-        while (k != sl.end() && (x2 + k->w) < x1) {
-            x2 += k->w;
+        while (k < n2 && (x2 + w2[k]) < x1) {
+            x2 += w2[k];
             ++k;
         }
-        if (k == sl.end()) {
+        if (k == n2) {
             break;
         }
         for (;;) {
-            if ((x1 + i->w > x2) && (x1 < x2 + k->w) && k->staffSpan >= 0) {
+            if ((x1 + w1[i] > x2) && (x1 < x2 + w2[k]) && span2[k] >= 0) {
                 // (staffSpan: don't add lower north skyline object if it crosses into our staff)
-                dist = std::max(dist, i->y - k->y);
+                dist = std::max(dist, y1[i] - y2[k]);
             }
-            if (x2 + k->w < x1 + i->w) {
-                x2 += k->w;
+            if (x2 + w2[k] < x1 + w1[i]) {
+                x2 += w2[k];
                 ++k;
-                if (k == sl.end()) {
+                if (k == n2) {
                     break;
                 }
             } else {
                 break;
             }
         }
-        if (k == sl.end()) {
+        if (k == n2) {
             break;
         }
-        x1 += i->w;
+        x1 += w1[i];
+    }
+    return dist;
+}
+
+//-------------------------------------------------------------------
+//   minDistance
+//    Distance of the horizontal edge [x, x + w) at height y to
+//    this skyline: the bottom of something above a north line
+//    or the top of something below a south line.
+//    Same result as adding the edge to a SkylineLine of its own
+//    and comparing the two lines, but only the segments under
+//    the edge are visited.
+//-------------------------------------------------------------------
+
+double SkylineLine::minDistance(double x, double y, double w) const
+{
+    if (!north && m_hasPositiveSpan) {
+        //! NOTE minDistance(const SkylineLine&) stops advancing its x position
+        //! at skipped cross-staff segments, keep its result for such lines
+        SkylineLine sk(true);
+        sk.add(x, y, w);
+        return minDistance(sk);
+    }
+
+    double dist = MINIMUM_Y;
+    if (x < 0.0) {
+        w -= -x;
+        x = 0.0;
+        if (w <= 0.0) {
+            return dist;
+        }
+    }
+
+    const size_t n = m_w.size();
+    const double xr = x + w;
+    for (size_t k = find(x); k < n && m_x[k] < xr; ++k) {
+        if (x >= m_x[k] + m_w[k]) {
+            continue;
+        }
+        if (north) {
+            // (staffSpan: don't add lower north skyline object if it crosses into our staff)
+            if (m_span[k] >= 0) {
+                dist = std::max(dist, y - m_y[k]);
+            }
+        } else if (m_span[k] <= 0) {
+            dist = std::max(dist, m_y[k] - y);
+        }
     }
     return dist;
 }
@@ -319,7 +390,7 @@ void SkylineLine::paint(Painter& painter) const
     double y = 0.0;
 
     bool pvalid = false;
-    for (const SkylineSegment& s : *this) {
+    for (const SkylineSegment s : *this) {
         x2 = x1 + s.w;
         if (valid(s)) {
             if (pvalid && !RealIsEqual(y, s.y)) {
@@ -339,7 +410,7 @@ void SkylineLine::paint(Painter& painter) const
 
 bool SkylineLine::valid() const
 {
-    return !seg.empty();
+    return !m_w.empty();
 }
 
 bool SkylineLine::valid(const SkylineSegment& s) const
@@ -364,7 +435,7 @@ void Skyline::dump(const char* p, bool n) const
 void SkylineLine::dump() const
 {
     double x = 0.0;
-    for (const SkylineSegment& s : *this) {
+    for (const SkylineSegment s : *this) {
         printf("   x %f y %f w %f\n", x, s.y, s.w);
         x += s.w;
     }
@@ -379,13 +450,13 @@ double SkylineLine::max() const
     double val;
     if (north) {
         val = MAXIMUM_Y;
-        for (const SkylineSegment& s : *this) {
-            val = std::min(val, s.y);
+        for (double y : m_y) {
+            val = std::min(val, y);
         }
     } else {
         val = MINIMUM_Y;
-        for (const SkylineSegment& s : *this) {
-            val = std::max(val, s.y);
+        for (double y : m_y) {
+            val = std::max(val, y);
         }
     }
     return val;
@@ -23,6 +23,8 @@
 #ifndef __SKYLINE_H__
 #define __SKYLINE_H__
 
+#include <cstddef>
+#include <iterator>
 #include <vector>
 
 #include "draw/types/geometry.h"
@@ -51,21 +53,48 @@ struct SkylineSegment {
 
 //---------------------------------------------------------
 //   SkylineLine
+//    The segments are stored as separate arrays of x, y,
+//    width and staff span, so the scans of minDistance()
+//    and max() run over contiguous values. Iterating gives
+//    SkylineSegment values.
 //---------------------------------------------------------
 
 class SkylineLine
 {
     const bool north;
-    std::vector<SkylineSegment> seg;
-    typedef std::vector<SkylineSegment>::iterator SegIter;
-    typedef std::vector<SkylineSegment>::const_iterator SegConstIter;
+    std::vector<double> m_x;
+    std::vector<double> m_y;
+    std::vector<double> m_w;
+    std::vector<int> m_span;
+    bool m_hasPositiveSpan = false;
 
-    SegIter insert(SegIter i, double x, double y, double w, int span);
+    size_t insert(size_t i, double x, double y, double w, int span);
     void append(double x, double y, double w, int span);
-    SegIter find(double x);
-    SegConstIter find(double x) const;
+    size_t find(double x) const;
 
 public:
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = SkylineSegment;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = SkylineSegment;
+
+        const_iterator(const SkylineLine* line, size_t idx)
+            : m_line(line), m_idx(idx) {}
+
+        SkylineSegment operator*() const { return m_line->segment(m_idx); }
+        const_iterator& operator++() { ++m_idx; return *this; }
+        bool operator==(const const_iterator& other) const { return m_idx == other.m_idx && m_line == other.m_line; }
+        bool operator!=(const const_iterator& other) const { return !(*this == other); }
+
+    private:
+        const SkylineLine* m_line = nullptr;
+        size_t m_idx = 0;
+    };
+
     SkylineLine(bool n)
         : north(n) {}
     void add(const Shape& s);
@@ -73,19 +102,21 @@ public:
     void add(double x, double y, double w, int span = 0);
     void add(const RectF& r) { add(ShapeElement(r)); }
 
-    void clear() { seg.clear(); }
+    void clear();
     void paint(mu::draw::Painter& painter) const;
     void dump() const;
     double minDistance(const SkylineLine&) const;
+    double minDistance(double x, double y, double w) const;
     double max() const;
     bool valid() const;
     bool valid(const SkylineSegment& s) const;
     bool isNorth() const { return north; }
 
-    SegIter begin() { return seg.begin(); }
-    SegConstIter begin() const { return seg.begin(); }
-    SegIter end() { return seg.end(); }
-    SegConstIter end() const { return seg.end(); }
+    size_t size() const { return m_w.size(); }
+    SkylineSegment segment(size_t i) const { return SkylineSegment(m_x[i], m_y[i], m_w[i], m_span[i]); }
+
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size()); }
 };
 
 //---------------------------------------------------------
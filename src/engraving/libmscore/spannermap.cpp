@@ -24,11 +24,296 @@
 #include "spanner.h"
 #include "part.h"
 
+#include <algorithm>
+
 #include "log.h"
 
 using namespace mu;
 
 namespace mu::engraving {
+//---------------------------------------------------------
+//   SpannerIntervalTree
+//---------------------------------------------------------
+
+void SpannerIntervalTree::insert(Spanner* s, int start, int stop)
+{
+    if (update(s, start, stop)) {
+        return;
+    }
+
+    int n = 0;
+    if (m_freeNodes.empty()) {
+        n = static_cast<int>(m_nodes.size());
+        m_nodes.emplace_back();
+    } else {
+        n = m_freeNodes.back();
+        m_freeNodes.pop_back();
+        m_nodes[n] = Node();
+    }
+
+    Node& node = m_nodes[n];
+    node.start = start;
+    node.stop = stop;
+    node.maxStop = stop;
+    node.seq = m_seq++;
+    node.value = s;
+
+    m_index.emplace(s, n);
+    m_root = insertNode(m_root, n);
+}
+
+bool SpannerIntervalTree::remove(const Spanner* s)
+{
+    auto it = m_index.find(s);
+    if (it == m_index.end()) {
+        return false;
+    }
+
+    int n = it->second;
+    m_index.erase(it);
+    m_root = removeNode(m_root, n);
+    m_nodes[n].value = nullptr;
+    m_freeNodes.push_back(n);
+    return true;
+}
+
+//---------------------------------------------------------
+//   update
+//    returns false if the spanner is not in the tree
+//---------------------------------------------------------
+
+bool SpannerIntervalTree::update(const Spanner* s, int start, int stop)
+{
+    auto it = m_index.find(s);
+    if (it == m_index.end()) {
+        return false;
+    }
+
+    int n = it->second;
+    Node& node = m_nodes[n];
+    if (node.start == start) {
+        if (node.stop != stop) {
+            node.stop = stop;
+            m_root = touchNode(m_root, n);
+        }
+        return true;
+    }
+
+    // the position in the tree changes: reinsert the node, keeping its sequence number
+    m_root = removeNode(m_root, n);
+    node.start = start;
+    node.stop = stop;
+    node.left = -1;
+    node.right = -1;
+    fix(n);
+    m_root = insertNode(m_root, n);
+    return true;
+}
+
+void SpannerIntervalTree::clear()
+{
+    m_nodes.clear();
+    m_freeNodes.clear();
+    m_index.clear();
+    m_root = -1;
+}
+
+void SpannerIntervalTree::findOverlapping(int start, int stop, IntervalList& results) const
+{
+    overlapping(m_root, start, stop, results);
+}
+
+void SpannerIntervalTree::findContained(int start, int stop, IntervalList& results) const
+{
+    contained(m_root, start, stop, results);
+}
+
+//---------------------------------------------------------
+//   less
+//    order of the nodes a and b in the tree
+//---------------------------------------------------------
+
+bool SpannerIntervalTree::less(int a, int b) const
+{
+    const Node& na = m_nodes[a];
+    const Node& nb = m_nodes[b];
+    if (na.start != nb.start) {
+        return na.start < nb.start;
+    }
+    return na.seq < nb.seq;
+}
+
+void SpannerIntervalTree::fix(int n)
+{
+    Node& node = m_nodes[n];
+    node.height = 1 + std::max(height(node.left), height(node.right));
+    node.maxStop = node.stop;
+    if (node.left >= 0) {
+        node.maxStop = std::max(node.maxStop, m_nodes[node.left].maxStop);
+    }
+    if (node.right >= 0) {
+        node.maxStop = std::max(node.maxStop, m_nodes[node.right].maxStop);
+    }
+}
+
+int SpannerIntervalTree::rotateLeft(int n)
+{
+    int r = m_nodes[n].right;
+    m_nodes[n].right = m_nodes[r].left;
+    m_nodes[r].left = n;
+    fix(n);
+    fix(r);
+    return r;
+}
+
+int SpannerIntervalTree::rotateRight(int n)
+{
+    int l = m_nodes[n].left;
+    m_nodes[n].left = m_nodes[l].right;
+    m_nodes[l].right = n;
+    fix(n);
+    fix(l);
+    return l;
+}
+
+int SpannerIntervalTree::balance(int n)
+{
+    fix(n);
+    Node& node = m_nodes[n];
+    int diff = height(node.left) - height(node.right);
+    if (diff > 1) {
+        const Node& l = m_nodes[node.left];
+        if (height(l.left) < height(l.right)) {
+            node.left = rotateLeft(node.left);
+        }
+        return rotateRight(n);
+    }
+    if (diff < -1) {
+        const Node& r = m_nodes[node.right];
+        if (height(r.right) < height(r.left)) {
+            node.right = rotateRight(node.right);
+        }
+        return rotateLeft(n);
+    }
+    return n;
+}
+
+int SpannerIntervalTree::insertNode(int root, int n)
+{
+    if (root < 0) {
+        return n;
+    }
+
+    if (less(n, root)) {
+        int left = insertNode(m_nodes[root].left, n);
+        m_nodes[root].left = left;
+    } else {
+        int right = insertNode(m_nodes[root].right, n);
+        m_nodes[root].right = right;
+    }
+    return balance(root);
+}
+
+int SpannerIntervalTree::removeMin(int root, int& min)
+{
+    if (m_nodes[root].left < 0) {
+        min = root;
+        return m_nodes[root].right;
+    }
+
+    int left = removeMin(m_nodes[root].left, min);
+    m_nodes[root].left = left;
+    return balance(root);
+}
+
+int SpannerIntervalTree::removeNode(int root, int n)
+{
+    if (root < 0) {
+        return -1;
+    }
+
+    if (root == n) {
+        Node& node = m_nodes[n];
+        if (node.left < 0) {
+            return node.right;
+        }
+        if (node.right < 0) {
+            return node.left;
+        }
+
+        int min = -1;
+        int right = removeMin(node.right, min);
+        m_nodes[min].left = node.left;
+        m_nodes[min].right = right;
+        return balance(min);
+    }
+
+    if (less(n, root)) {
+        int left = removeNode(m_nodes[root].left, n);
+        m_nodes[root].left = left;
+    } else {
+        int right = removeNode(m_nodes[root].right, n);
+        m_nodes[root].right = right;
+    }
+    return balance(root);
+}
+
+//---------------------------------------------------------
+//   touchNode
+//    recomputes maxStop on the path to the node n
+//---------------------------------------------------------
+
+int SpannerIntervalTree::touchNode(int root, int n)
+{
+    if (root != n) {
+        if (less(n, root)) {
+            touchNode(m_nodes[root].left, n);
+        } else {
+            touchNode(m_nodes[root].right, n);
+        }
+    }
+    fix(root);
+    return root;
+}
+
+void SpannerIntervalTree::overlapping(int n, int start, int stop, IntervalList& results) const
+{
+    while (n >= 0) {
+        const Node& node = m_nodes[n];
+        if (node.maxStop < start) {
+            return;
+        }
+
+        overlapping(node.left, start, stop, results);
+
+        // the right subtree only has intervals starting after this one
+        if (node.start > stop) {
+            return;
+        }
+        if (node.stop >= start) {
+            results.emplace_back(node.start, node.stop, node.value);
+        }
+        n = node.right;
+    }
+}
+
+void SpannerIntervalTree::contained(int n, int start, int stop, IntervalList& results) const
+{
+    while (n >= 0) {
+        const Node& node = m_nodes[n];
+        if (node.start >= start) {
+            contained(node.left, start, stop, results);
+        }
+        if (node.start > stop) {
+            return;
+        }
+        if (node.start >= start && node.stop <= stop) {
+            results.emplace_back(node.start, node.stop, node.value);
+        }
+        n = node.right;
+    }
+}
+
 //---------------------------------------------------------
 //   SpannerMap
 //---------------------------------------------------------
@@ -36,7 +321,7 @@ namespace mu::engraving {
 SpannerMap::SpannerMap()
     : std::multimap<int, Spanner*>()
 {
-    dirty = true;
+    setDirty();
 }
 
 //---------------------------------------------------------
@@ -46,25 +331,51 @@ SpannerMap::SpannerMap()
 
 void SpannerMap::update() const
 {
-    IntervalList regularIntervals;
-    IntervalList collisionFreeIntervals;
+    tree.clear();
+    for (const auto& pair : *this) {
+        tree.insert(pair.second, pair.second->tick().ticks(), pair.second->tick2().ticks());
+    }
+    dirty = false;
+}
 
-    collectIntervals(regularIntervals, collisionFreeIntervals);
+//---------------------------------------------------------
+//   updateCollisionFree
+//    the collision free tree is needed by playback only,
+//    so layout doesn't pay for it on every change
+//---------------------------------------------------------
 
-    tree = interval_tree::IntervalTree<Spanner*>(regularIntervals);
-    collisionFreeTree = interval_tree::IntervalTree<Spanner*>(collisionFreeIntervals);
-    dirty = false;
+void SpannerMap::updateCollisionFree() const
+{
+    IntervalList collisionFreeIntervals;
+    collectCollisionFreeIntervals(collisionFreeIntervals);
+
+    collisionFreeTree.clear();
+    for (const auto& interval : collisionFreeIntervals) {
+        collisionFreeTree.insert(interval.value, interval.start, interval.stop);
+    }
+    collisionFreeDirty = false;
 }
 
 //---------------------------------------------------------
 //   findContained
 //---------------------------------------------------------
 
-const SpannerMap::IntervalList& SpannerMap::findContained(int start, int stop, bool excludeCollisions) const
+void SpannerMap::ensureUpdated(bool excludeCollisions) const
 {
-    if (dirty) {
+    std::lock_guard<std::mutex> lock(updateMutex);
+
+    if (excludeCollisions) {
+        if (collisionFreeDirty) {
+            updateCollisionFree();
+        }
+    } else if (dirty) {
         update();
     }
+}
+
+const SpannerMap::IntervalList& SpannerMap::findContained(int start, int stop, bool excludeCollisions) const
+{
+    ensureUpdated(excludeCollisions);
 
     results.clear();
 
@@ -83,22 +394,33 @@ const SpannerMap::IntervalList& SpannerMap::findContained(int start, int stop, b
 
 const SpannerMap::IntervalList& SpannerMap::findOverlapping(int start, int stop, bool excludeCollisions) const
 {
-    if (dirty) {
-        update();
-    }
-
     results.clear();
+    findOverlapping(start, stop, results, excludeCollisions);
+    return results;
+}
+
+void SpannerMap::findOverlapping(int start, int stop, IntervalList& intervals, bool excludeCollisions) const
+{
+    ensureUpdated(excludeCollisions);
 
     if (excludeCollisions) {
-        collisionFreeTree.findOverlapping(start, stop, results);
+        collisionFreeTree.findOverlapping(start, stop, intervals);
     } else {
-        tree.findOverlapping(start, stop, results);
+        tree.findOverlapping(start, stop, intervals);
     }
+}
 
-    return results;
+void SpannerMap::collectIntervals(IntervalList& regularIntervals) const
+{
+    regularIntervals.reserve(size());
+    for (const auto& pair : *this) {
+        regularIntervals.push_back(interval_tree::Interval(pair.second->tick().ticks(),
+                                                           pair.second->tick2().ticks(),
+                                                           pair.second));
+    }
 }
 
-void SpannerMap::collectIntervals(IntervalList& regularIntervals, IntervalList& collisionFreeIntervals) const
+void SpannerMap::collectCollisionFreeIntervals(IntervalList& collisionFreeIntervals) const
 {
     using IntervalsByType = std::map<ElementType, IntervalList>;
     using IntervalsByPart = std::map<ID, IntervalsByType>;
@@ -127,10 +449,6 @@ void SpannerMap::collectIntervals(IntervalList& regularIntervals, IntervalList&
         intervalList.emplace_back(interval_tree::Interval<Spanner*>(newSpannerStartTick,
                                                                     newSpannerEndTick,
                                                                     pair.second));
-
-        regularIntervals.push_back(interval_tree::Interval(newSpannerStartTick,
-                                                           newSpannerEndTick,
-                                                           pair.second));
     }
 
     for (const auto& pair : intervalsByPart) {
@@ -149,7 +467,10 @@ void SpannerMap::collectIntervals(IntervalList& regularIntervals, IntervalList&
 void SpannerMap::addSpanner(Spanner* s)
 {
     insert(std::pair<int, Spanner*>(s->tick().ticks(), s));
-    dirty = true;
+    if (!dirty) {
+        tree.insert(s, s->tick().ticks(), s->tick2().ticks());
+    }
+    collisionFreeDirty = true;
 }
 
 //---------------------------------------------------------
@@ -158,17 +479,44 @@ void SpannerMap::addSpanner(Spanner* s)
 
 bool SpannerMap::removeSpanner(Spanner* s)
 {
+    auto removed = [this, s](iterator i) {
+        erase(i);
+        if (!dirty) {
+            tree.remove(s);
+        }
+        collisionFreeDirty = true;
+        return true;
+    };
+
+    // the key of the map may be out of date if the start of the spanner
+    // has changed since it was added, so fall back to a full scan
+    auto range = equal_range(s->tick().ticks());
+    for (auto i = range.first; i != range.second; ++i) {
+        if (i->second == s) {
+            return removed(i);
+        }
+    }
     for (auto i = begin(); i != end(); ++i) {
         if (i->second == s) {
-            erase(i);
-            dirty = true;
-            return true;
+            return removed(i);
         }
     }
     LOGD("%s (%p) not found", s->typeName(), s);
     return false;
 }
 
+//---------------------------------------------------------
+//   updateSpanner
+//---------------------------------------------------------
+
+void SpannerMap::updateSpanner(const Spanner* s)
+{
+    if (!dirty) {
+        tree.update(s, s->tick().ticks(), s->tick2().ticks());
+    }
+    collisionFreeDirty = true;
+}
+
 #ifndef NDEBUG
 //---------------------------------------------------------
 //   dump
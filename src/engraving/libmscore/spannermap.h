@@ -23,12 +23,75 @@
 #ifndef __SPANNERMAP_H__
 #define __SPANNERMAP_H__
 
+#include <cstdint>
 #include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 #include "thirdparty/intervaltree/IntervalTree.h"
 
 namespace mu::engraving {
 class Spanner;
 
+//---------------------------------------------------------
+//   SpannerIntervalTree
+//    balanced (AVL) tree of spanner intervals ordered by start,
+//    each node keeps the maximum stop of its subtree.
+//    Insert, remove and update are O(log n), queries
+//    append to the given list without allocating nodes.
+//    Both bounds of the intervals are inclusive.
+//---------------------------------------------------------
+
+class SpannerIntervalTree
+{
+public:
+    using IntervalList = std::vector<interval_tree::Interval<Spanner*> >;
+
+    void insert(Spanner* s, int start, int stop);
+    bool remove(const Spanner* s);
+    bool update(const Spanner* s, int start, int stop);
+    void clear();
+
+    bool contains(const Spanner* s) const { return m_index.find(s) != m_index.end(); }
+    size_t size() const { return m_index.size(); }
+
+    void findOverlapping(int start, int stop, IntervalList& results) const;
+    void findContained(int start, int stop, IntervalList& results) const;
+
+private:
+    struct Node {
+        int start = 0;
+        int stop = 0;
+        int maxStop = 0;
+        uint64_t seq = 0;       // keeps the order of intervals with the same start stable
+        Spanner* value = nullptr;
+        int left = -1;
+        int right = -1;
+        int height = 1;
+    };
+
+    bool less(int a, int b) const;
+    int height(int n) const { return n < 0 ? 0 : m_nodes[n].height; }
+    void fix(int n);
+    int rotateLeft(int n);
+    int rotateRight(int n);
+    int balance(int n);
+    int insertNode(int root, int n);
+    int removeNode(int root, int n);
+    int removeMin(int root, int& min);
+    int touchNode(int root, int n);
+
+    void overlapping(int n, int start, int stop, IntervalList& results) const;
+    void contained(int n, int start, int stop, IntervalList& results) const;
+
+    std::vector<Node> m_nodes;
+    std::vector<int> m_freeNodes;
+    std::unordered_map<const Spanner*, int> m_index;
+    int m_root = -1;
+    uint64_t m_seq = 0;
+};
+
 //---------------------------------------------------------
 //   SpannerMap
 //---------------------------------------------------------
@@ -36,9 +99,13 @@ class Spanner;
 class SpannerMap : std::multimap<int, Spanner*>
 {
     mutable bool dirty;
-    mutable interval_tree::IntervalTree<Spanner*> tree;
-    mutable interval_tree::IntervalTree<Spanner*> collisionFreeTree;
+    mutable bool collisionFreeDirty;    // the collision free tree is only built when it is queried
+    mutable SpannerIntervalTree tree;   // kept up to date on every add/remove/updateSpanner
+    mutable SpannerIntervalTree collisionFreeTree;
     mutable std::vector<interval_tree::Interval<Spanner*> > results;
+    mutable std::mutex updateMutex;     // the lazy rebuild of the trees can be reached from the workers
+
+    void ensureUpdated(bool excludeCollisions) const;
 
 public:
     typedef typename std::multimap<int, Spanner*>::const_reverse_iterator const_reverse_it;
@@ -48,11 +115,15 @@ public:
 
     SpannerMap();
 
+    //! NOTE These two fill a list shared by the whole map, so they may be called only from the thread that owns the score
     const IntervalList& findContained(int start, int stop, bool excludeCollisions = false) const;
     const IntervalList& findOverlapping(int start, int stop, bool excludeCollisions = false) const;
+    //! NOTE Fills the caller's list, for the queries from the layout and the playback workers
+    void findOverlapping(int start, int stop, IntervalList& intervals, bool excludeCollisions = false) const;
     const std::multimap<int, Spanner*>& map() const { return *this; }
 
-    void collectIntervals(IntervalList& regularIntervals, IntervalList& collisionFreeIntervals) const;
+    void collectIntervals(IntervalList& regularIntervals) const;
+    void collectCollisionFreeIntervals(IntervalList& collisionFreeIntervals) const;
 
     const_reverse_it crbegin() const { return std::multimap<int, Spanner*>::crbegin(); }
     const_reverse_it crend() const { return std::multimap<int, Spanner*>::crend(); }
@@ -60,10 +131,12 @@ public:
     const_it cend() const { return std::multimap<int, Spanner*>::cend(); }
     void addSpanner(Spanner* s);
     bool removeSpanner(Spanner* s);
-    void clear() { std::multimap<int, Spanner*>::clear(); dirty = true; }
+    void updateSpanner(const Spanner* s);       // must be called if a spanner changes start/length
+    void clear() { std::multimap<int, Spanner*>::clear(); tree.clear(); setDirty(); }
     bool empty() const { return std::multimap<int, Spanner*>::empty(); }
     void update() const;
-    void setDirty() const { dirty = true; }     // must be called if a spanner changes start/length
+    void updateCollisionFree() const;
+    void setDirty() const { dirty = true; collisionFreeDirty = true; }     // rebuilds both trees on the next query
 #ifndef NDEBUG
     void dump() const;
 #endif
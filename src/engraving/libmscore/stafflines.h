@@ -56,6 +56,8 @@ public:
     void scanElements(void* data, void (* func)(void*, EngravingItem*), bool all=true) override;
 
     std::vector<mu::LineF>& getLines() { return lines; }
+    const std::vector<mu::LineF>& getLines() const { return lines; }
+    double lineWidth() const { return lw; }
     Measure* measure() const { return (Measure*)explicitParent(); }
     double y1() const;
     void layoutForWidth(double width);
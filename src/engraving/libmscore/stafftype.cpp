@@ -22,6 +22,8 @@
 
 #include "stafftype.h"
 
+#include <mutex>
+
 #include "translation.h"
 #include "io/file.h"
 #include "draw/fontmetrics.h"
@@ -45,6 +47,12 @@ using namespace mu::engraving;
 #define TAB_DEFAULT_LINE_SP   (1.5)
 #define TAB_RESTSYMBDISPL     2.0
 
+//! NOTE The font metrics are computed lazily, also from the notes laid out by the page workers
+//! (see LayoutPage::finishPage) and from the excerpts laid out concurrently (see
+//! MasterScore::doLayoutScoresRange), so they are guarded. The staff types are copied by value,
+//! hence one mutex for all of them.
+static std::recursive_mutex s_fontMetricsMutex;
+
 namespace mu::engraving {
 //---------------------------------------------------------
 //   StaffTypeTablature
@@ -504,6 +512,8 @@ void StaffType::setOnLines(bool val)
 
 void StaffType::setDurationMetrics() const
 {
+    std::lock_guard<std::recursive_mutex> lock(s_fontMetricsMutex);
+
     if (_durationMetricsValid && _refDPI == DPI) {           // metrics are still valid
         return;
     }
@@ -533,6 +543,8 @@ void StaffType::setDurationMetrics() const
 
 void StaffType::setFretMetrics() const
 {
+    std::lock_guard<std::recursive_mutex> lock(s_fontMetricsMutex);
+
     if (_fretMetricsValid && _refDPI == DPI) {
         return;
     }
@@ -569,11 +581,37 @@ void StaffType::setFretMetrics() const
     _fretBoxH = bb.height();
     _fretBoxY = bb.y() + _fretYOffset;
 
+    _fretStringWidths.clear();
+
     // keep track of the conditions under which metrics have been computed
     _refDPI = DPI;
     _fretMetricsValid = true;
 }
 
+//---------------------------------------------------------
+//   fretStringWidth
+//    the same few fret marks are laid out for all the notes
+//    of a tablature, their widths are measured once
+//---------------------------------------------------------
+
+double StaffType::fretStringWidth(const String& fretString) const
+{
+    std::lock_guard<std::recursive_mutex> lock(s_fontMetricsMutex);
+
+    setFretMetrics();
+
+    auto it = _fretStringWidths.find(fretString);
+    if (it != _fretStringWidths.end()) {
+        return it->second;
+    }
+
+    mu::draw::Font f = fretFont();
+    f.setPointSizeF(fretFontSize());
+    double w = mu::draw::FontMetrics::width(f, fretString);
+    _fretStringWidths.emplace(fretString, w);
+    return w;
+}
+
 //---------------------------------------------------------
 //   setDurationFontName / setFretFontName
 //---------------------------------------------------------
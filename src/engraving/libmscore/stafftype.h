@@ -23,6 +23,8 @@
 #ifndef __STAFFTYPE_H__
 #define __STAFFTYPE_H__
 
+#include <unordered_map>
+
 #include "draw/types/color.h"
 #include "draw/types/font.h"
 
@@ -264,6 +266,8 @@ class StaffType
     // (raster units); internally computed: depends upon _onString, _useNumbers
     // and the metrics of the fret font
     mutable bool _fretMetricsValid = false;       // whether fret font metrics are valid or not
+    mutable std::unordered_map<String, double> _fretStringWidths; // widths of the fret marks laid out so far (raster units),
+    // cleared with the fret metrics
     mutable double _refDPI = 0.0;                  // reference value used to last computed metrics and to see if they are still valid
 
     // the array of configured fonts
@@ -369,6 +373,7 @@ public:
     double durationGridYOffset() const { setDurationMetrics(); return _durationGridYOffset; }
     double fretBoxH() const { setFretMetrics(); return _fretBoxH; }
     double fretBoxY() const { setFretMetrics(); return _fretBoxY + _fretFontUserY * SPATIUM20; }
+    double fretStringWidth(const String& fretString) const;
 
     // 2 methods to return the size of a box masking lines under a fret mark
     double fretMaskH() const { return _lineDistance.val() * SPATIUM20; }
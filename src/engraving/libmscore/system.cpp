@@ -2109,34 +2109,4 @@ Fraction System::maxSysTicks() const
     }
     return maxTicks;
 }
-
-bool System::hasCrossStaffOrModifiedBeams()
-{
-    for (MeasureBase* mb : measures()) {
-        if (!mb->isMeasure()) {
-            continue;
-        }
-        for (Segment& seg : toMeasure(mb)->segments()) {
-            if (!seg.isChordRestType()) {
-                continue;
-            }
-            for (EngravingItem* e : seg.elist()) {
-                if (!e || !e->isChordRest()) {
-                    continue;
-                }
-                if (toChordRest(e)->beam() && (toChordRest(e)->beam()->cross() || toChordRest(e)->beam()->userModified())) {
-                    return true;
-                }
-                if (e->isChord() && !toChord(e)->graceNotes().empty()) {
-                    for (Chord* grace : toChord(e)->graceNotes()) {
-                        if (grace->beam() && (grace->beam()->cross() || grace->beam()->userModified())) {
-                            return true;
-                        }
-                    }
-                }
-            }
-        }
-    }
-    return false;
-}
 }
@@ -233,7 +233,6 @@ public:
     Fraction maxSysTicks() const;
 
     double squeezableSpace() const;
-    bool hasCrossStaffOrModifiedBeams();
 
 #ifndef ENGRAVING_NO_ACCESSIBILITY
     AccessibleItemPtr createAccessible() override;
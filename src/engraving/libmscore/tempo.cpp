@@ -22,6 +22,7 @@
 
 #include "tempo.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include "rw/xml.h"
@@ -130,9 +131,34 @@ void TempoMap::normalize()
         tick  = e->first;
         tempo = e->second.tempo.val;
     }
+    updateEventArrays();
     ++_tempoSN;
 }
 
+//---------------------------------------------------------
+//   updateEventArrays
+//---------------------------------------------------------
+
+void TempoMap::updateEventArrays()
+{
+    _eventTicks.clear();
+    _eventTimes.clear();
+    _eventPauses.clear();
+    _eventTempos.clear();
+
+    _eventTicks.reserve(size());
+    _eventTimes.reserve(size());
+    _eventPauses.reserve(size());
+    _eventTempos.reserve(size());
+
+    for (const auto& pair : *this) {
+        _eventTicks.push_back(pair.first);
+        _eventTimes.push_back(pair.second.time);
+        _eventPauses.push_back(pair.second.pause);
+        _eventTempos.push_back(pair.second.tempo.val);
+    }
+}
+
 //---------------------------------------------------------
 //   TempoMap::dump
 //---------------------------------------------------------
@@ -153,6 +179,7 @@ void TempoMap::dump() const
 void TempoMap::clear()
 {
     std::map<int, TEvent>::clear();
+    updateEventArrays();
     ++_tempoSN;
 }
 
@@ -170,6 +197,7 @@ void TempoMap::clearRange(int tick1, int tick2)
         return;
     }
     erase(first, last);
+    updateEventArrays();
     ++_tempoSN;
 }
 
@@ -282,43 +310,62 @@ int TempoMap::time2tick(double time, int t, int* sn) const
 
 //---------------------------------------------------------
 //   tick2time
+//    time of the tick, eventIdx is the index of the last
+//    event at or before the tick, or size() if there is none
 //---------------------------------------------------------
 
-double TempoMap::tick2time(int tick, int* sn) const
+double TempoMap::tick2time(size_t eventIdx, int tick) const
 {
-    double time  = 0.0;
-    double delta = double(tick);
-    BeatsPerSecond tempo = 2.0;
+    double time = 0.0;
+    int ptick = 0;
+    double tempo = 2.0;
+
+    if (eventIdx < _eventTicks.size()) {
+        ptick = _eventTicks[eventIdx];
+        tempo = _eventTempos[eventIdx];
+        time  = _eventTimes[eventIdx];
+    }
 
-    if (!empty()) {
-        int ptick  = 0;
-        auto e = lower_bound(tick);
-        if (e == end()) {
-            auto pe = e;
-            --pe;
-            ptick = pe->first;
-            tempo = pe->second.tempo;
-            time  = pe->second.time;
-        } else if (e->first == tick) {
-            ptick = tick;
-            tempo = e->second.tempo;
-            time  = e->second.time;
-        } else if (e != begin()) {
-            auto pe = e;
-            --pe;
-            ptick = pe->first;
-            tempo = pe->second.tempo;
-            time  = pe->second.time;
-        }
-        delta = double(tick - ptick);
-    } else {
+    return time + double(tick - ptick) / (Constants::division * tempo * _tempoMultiplier.val);
+}
+
+//---------------------------------------------------------
+//   tick2time
+//---------------------------------------------------------
+
+double TempoMap::tick2time(int tick, int* sn) const
+{
+    if (empty()) {
         LOGD("TempoMap: empty");
     }
     if (sn) {
         *sn = _tempoSN;
     }
-    time += delta / (Constants::division * tempo.val * _tempoMultiplier.val);
-    return time;
+
+    auto it = std::upper_bound(_eventTicks.cbegin(), _eventTicks.cend(), tick);
+    size_t eventIdx = it == _eventTicks.cbegin() ? _eventTicks.size() : size_t(it - _eventTicks.cbegin()) - 1;
+    return tick2time(eventIdx, tick);
+}
+
+//---------------------------------------------------------
+//   tick2time
+//    converts the ticks, sorted ascending, in one pass
+//---------------------------------------------------------
+
+void TempoMap::tick2time(const std::vector<int>& sortedTicks, std::vector<double>& times) const
+{
+    times.resize(sortedTicks.size());
+
+    const size_t eventCount = _eventTicks.size();
+    size_t next = 0;    // first event after the current tick
+
+    for (size_t i = 0; i < sortedTicks.size(); ++i) {
+        int tick = sortedTicks[i];
+        while (next < eventCount && _eventTicks[next] <= tick) {
+            ++next;
+        }
+        times[i] = tick2time(next == 0 ? eventCount : next - 1, tick);
+    }
 }
 
 //---------------------------------------------------------
@@ -328,26 +375,29 @@ double TempoMap::tick2time(int tick, int* sn) const
 int TempoMap::time2tick(double time, int* sn) const
 {
     int tick     = 0;
-    double delta = time;
-    BeatsPerSecond tempo = _tempo;
+    double ptime = 0.0;
+    double tempo = 2.0;
 
-    delta = 0.0;
-    tempo = 2.0;
-    for (auto e = begin(); e != end(); ++e) {
+    // first event reached at or after the time
+    auto it = std::lower_bound(_eventTimes.cbegin(), _eventTimes.cend(), time);
+    size_t eventIdx = size_t(it - _eventTimes.cbegin());
+
+    if (eventIdx > 0) {
+        ptime = _eventTimes[eventIdx - 1];
+        tick  = _eventTicks[eventIdx - 1];
+        tempo = _eventTempos[eventIdx - 1];
+    }
+
+    double delta = time - ptime;
+    if (eventIdx < _eventTimes.size()) {
         // if in a pause period, wait on previous tick
-        if ((time <= e->second.time) && (time > e->second.time - e->second.pause)) {
-            delta = (time - (e->second.time - e->second.pause) + delta);
-            break;
-        }
-        if (e->second.time >= time) {
-            break;
+        double pauseStart = _eventTimes[eventIdx] - _eventPauses[eventIdx];
+        if (time > pauseStart) {
+            delta = pauseStart - ptime;
         }
-        delta = e->second.time;
-        tick  = e->first;
-        tempo = e->second.tempo;
     }
-    delta = time - delta;
-    tick += lrint(delta * _tempoMultiplier.val * Constants::division * tempo.val);
+
+    tick += lrint(delta * _tempoMultiplier.val * Constants::division * tempo);
     if (sn) {
         *sn = _tempoSN;
     }
@@ -24,6 +24,7 @@
 #define __AL_TEMPO_H__
 
 #include <map>
+#include <vector>
 
 #include "global/allocator.h"
 #include "global/async/notification.h"
@@ -77,8 +78,17 @@ class TempoMap : public std::map<int, TEvent>
     BeatsPerSecond _tempoMultiplier;
     async::Notification _tempoMultiplierChanged;
 
+    // contiguous copy of the events, so that the conversions
+    // are a binary search and an interpolation
+    std::vector<int> _eventTicks;
+    std::vector<double> _eventTimes;    // including the pause of the event
+    std::vector<double> _eventPauses;
+    std::vector<double> _eventTempos;
+
     void normalize();
+    void updateEventArrays();
     void del(int tick);
+    double tick2time(size_t eventIdx, int tick) const;
 
 public:
     TempoMap();
@@ -94,6 +104,7 @@ public:
     double tick2time(int tick, double time, int* sn) const;
     int time2tick(double time, int* sn = 0) const;
     int time2tick(double time, int tick, int* sn) const;
+    void tick2time(const std::vector<int>& sortedTicks, std::vector<double>& times) const;
     int tempoSN() const { return _tempoSN; }
 
     void setTempo(int t, BeatsPerSecond);
@@ -29,6 +29,8 @@
 
 #include "iengravingfont.h"
 
+#include "infrastructure/textmetricscache.h"
+
 #include "rw/xml.h"
 
 #include "style/defaultstyle.h"
@@ -811,30 +813,7 @@ mu::draw::Font TextFragment::font(const TextBase* t) const
         }
         // check if all symbols are available
         font.setFamily(family, fontType);
-        mu::draw::FontMetrics fm(font);
-
-        bool fail = false;
-        for (size_t i = 0; i < text.size(); ++i) {
-            const Char& c = text.at(i);
-            if (c.isHighSurrogate()) {
-                if (i + 1 == text.size()) {
-                    ASSERT_X("bad string");
-                }
-                const Char& c2 = text.at(i + 1);
-                ++i;
-                char32_t v = Char::surrogateToUcs4(c, c2);
-                if (!fm.inFontUcs4(v)) {
-                    fail = true;
-                    break;
-                }
-            } else {
-                if (!fm.inFont(c)) {
-                    fail = true;
-                    break;
-                }
-            }
-        }
-        if (fail) {
+        if (!TextMetricsCache::isInFont(font, text)) {
             family = String::fromUtf8(FALLBACK_SYMBOLTEXT_FONT);
             fontType = draw::Font::Type::MusicSymbolText;
         }
@@ -907,17 +886,18 @@ void TextBlock::layout(TextBase* t)
         }
     }
 
+    //! NOTE The metrics of the fonts and of the texts are shared by all the texts, see TextMetricsCache
     if (_fragments.empty()) {
-        mu::draw::FontMetrics fm = t->fontMetrics();
-        _bbox.setRect(0.0, -fm.ascent(), 1.0, fm.descent());
-        _lineSpacing = fm.lineSpacing();
+        TextMetricsCache::FontInfo fm = TextMetricsCache::fontInfo(t->font());
+        _bbox.setRect(0.0, -fm.ascent, 1.0, fm.descent);
+        _lineSpacing = fm.lineSpacing;
     } else if (_fragments.size() == 1 && _fragments.front().text.isEmpty()) {
         auto fi = _fragments.begin();
         TextFragment& f = *fi;
         f.pos.setX(x);
-        mu::draw::FontMetrics fm(f.font(t));
+        TextMetricsCache::FontInfo fm = TextMetricsCache::fontInfo(f.font(t));
         if (f.format.valign() != VerticalAlignment::AlignNormal) {
-            double voffset = fm.xHeight() / subScriptSize;   // use original height
+            double voffset = fm.xHeight / subScriptSize;   // use original height
             if (f.format.valign() == VerticalAlignment::AlignSubScript) {
                 voffset *= subScriptOffset;
             } else {
@@ -929,17 +909,17 @@ void TextBlock::layout(TextBase* t)
             f.pos.setY(0.0);
         }
 
-        RectF temp(0.0, -fm.ascent(), 1.0, fm.descent());
+        RectF temp(0.0, -fm.ascent, 1.0, fm.descent);
         _bbox |= temp;
-        _lineSpacing = std::max(_lineSpacing, fm.lineSpacing());
+        _lineSpacing = std::max(_lineSpacing, fm.lineSpacing);
     } else {
-        const auto fiLast = --_fragments.end();
-        for (auto fi = _fragments.begin(); fi != _fragments.end(); ++fi) {
-            TextFragment& f = *fi;
+        for (TextFragment& f : _fragments) {
             f.pos.setX(x);
-            mu::draw::FontMetrics fm(f.font(t));
+            mu::draw::Font font = f.font(t);
+            TextMetricsCache::FontInfo fm = TextMetricsCache::fontInfo(font);
+            TextMetricsCache::RunInfo run = TextMetricsCache::runInfo(font, f.text);
             if (f.format.valign() != VerticalAlignment::AlignNormal) {
-                double voffset = fm.xHeight() / subScriptSize;           // use original height
+                double voffset = fm.xHeight / subScriptSize;           // use original height
                 if (f.format.valign() == VerticalAlignment::AlignSubScript) {
                     voffset *= subScriptOffset;
                 } else {
@@ -950,15 +930,10 @@ void TextBlock::layout(TextBase* t)
                 f.pos.setY(0.0);
             }
 
-            // Optimization: don't calculate character position
-            // for the next fragment if there is no next fragment
-            if (fi != fiLast) {
-                const double w  = fm.width(f.text);
-                x += w;
-            }
+            x += run.width;
 
-            _bbox   |= fm.tightBoundingRect(f.text).translated(f.pos);
-            _lineSpacing = std::max(_lineSpacing, fm.lineSpacing());
+            _bbox   |= run.tightBoundingRect.translated(f.pos);
+            _lineSpacing = std::max(_lineSpacing, fm.lineSpacing);
         }
     }
 
@@ -989,9 +964,9 @@ void TextBlock::layout(TextBase* t)
 //   fragmentsWithoutEmpty
 //---------------------------------------------------------
 
-std::list<TextFragment> TextBlock::fragmentsWithoutEmpty()
+std::vector<TextFragment> TextBlock::fragmentsWithoutEmpty()
 {
-    std::list<TextFragment> list;
+    std::vector<TextFragment> list;
     for (const auto& x : _fragments) {
         if (!x.text.isEmpty()) {
             list.push_back(x);
@@ -1195,7 +1170,7 @@ void TextBlock::removeEmptyFragment()
 //
 //---------------------------------------------------------
 
-std::list<TextFragment>::iterator TextBlock::fragment(int column, int* rcol, int* ridx)
+std::vector<TextFragment>::iterator TextBlock::fragment(int column, int* rcol, int* ridx)
 {
     int col = 0;
     for (auto it = _fragments.begin(); it != _fragments.end(); ++it) {
@@ -1458,9 +1433,8 @@ TextBlock TextBlock::split(int column, TextCursor* cursor)
                         ++it;
                     }
                 }
-                for (; it != _fragments.end(); it = _fragments.erase(it)) {
-                    tl._fragments.push_back(*it);
-                }
+                tl._fragments.insert(tl._fragments.end(), it, _fragments.end());
+                _fragments.erase(it, _fragments.end());
 
                 if (_fragments.size() == 0) {
                     insertEmptyFragmentIfNeeded(cursor);
@@ -24,6 +24,7 @@
 #define __TEXTBASE_H__
 
 #include <variant>
+#include <vector>
 
 #include "modularity/ioc.h"
 
@@ -236,7 +237,7 @@ public:
 
 class TextBlock
 {
-    std::list<TextFragment> _fragments;
+    std::vector<TextFragment> _fragments;
     double _y = 0;
     double _lineSpacing = 0.0;
     mu::RectF _bbox;
@@ -250,9 +251,9 @@ public:
     bool operator !=(const TextBlock& x) const { return _fragments != x._fragments; }
     void draw(mu::draw::Painter*, const TextBase*) const;
     void layout(TextBase*);
-    const std::list<TextFragment>& fragments() const { return _fragments; }
-    std::list<TextFragment>& fragments() { return _fragments; }
-    std::list<TextFragment> fragmentsWithoutEmpty();
+    const std::vector<TextFragment>& fragments() const { return _fragments; }
+    std::vector<TextFragment>& fragments() { return _fragments; }
+    std::vector<TextFragment> fragmentsWithoutEmpty();
     const mu::RectF& boundingRect() const { return _bbox; }
     mu::RectF boundingRect(int col1, int col2, const TextBase*) const;
     size_t columns() const;
@@ -266,7 +267,7 @@ public:
     double xpos(size_t col, const TextBase*) const;
     const CharFormat* formatAt(int) const;
     const TextFragment* fragment(int col) const;
-    std::list<TextFragment>::iterator fragment(int column, int* rcol, int* ridx);
+    std::vector<TextFragment>::iterator fragment(int column, int* rcol, int* ridx);
     double y() const { return _y; }
     void setY(double val) { _y = val; }
     double lineSpacing() const { return _lineSpacing; }
@@ -244,6 +244,20 @@ void TieSegment::editDrag(EditData& ed)
 //    compute help points of slur bezier segment
 //---------------------------------------------------------
 
+bool TieSegment::BezierInput::operator==(const BezierInput& o) const
+{
+    return start == o.start
+           && end == o.end
+           && bezier1Offset == o.bezier1Offset
+           && bezier2Offset == o.bezier2Offset
+           && spatium == o.spatium
+           && thickness == o.thickness
+           && shoulderHeightMin == o.shoulderHeightMin
+           && shoulderHeightMax == o.shoulderHeightMax
+           && up == o.up
+           && styleType == o.styleType;
+}
+
 void TieSegment::computeBezier(PointF shoulderOffset)
 {
     PointF tieStart = ups(Grip::START).p + ups(Grip::START).off;
@@ -255,6 +269,20 @@ void TieSegment::computeBezier(PointF shoulderOffset)
     }
 
     double _spatium = spatium();
+
+    double w = score()->styleMM(Sid::SlurMidWidth) - score()->styleMM(Sid::SlurEndWidth);
+    if (staff()) {
+        w *= staff()->staffMag(tie()->tick());
+    }
+
+    //! NOTE A shoulder offset comes from dragging and changes the bezier offsets, always recompute
+    BezierInput input { tieStart, tieEnd, ups(Grip::BEZIER1).off, ups(Grip::BEZIER2).off, _spatium, w,
+                        shoulderHeightMin, shoulderHeightMax, tie()->up(), tie()->styleType() };
+    if (shoulderOffset.isNull() && _lastBezierInput && *_lastBezierInput == input) {
+        return;
+    }
+    _lastBezierInput = shoulderOffset.isNull() ? std::make_optional(input) : std::nullopt;
+
     double shoulderW = 0.0; // height as fraction of slur-length
     double shoulderH = 0.0;
 
@@ -286,10 +314,6 @@ void TieSegment::computeBezier(PointF shoulderOffset)
     PointF bezier1(bezier1X, -shoulderH);
     PointF bezier2(bezier2X, -shoulderH);
 
-    double w = score()->styleMM(Sid::SlurMidWidth) - score()->styleMM(Sid::SlurEndWidth);
-    if (staff()) {
-        w *= staff()->staffMag(tie()->tick());
-    }
     PointF tieThickness(0.0, w);
 
     PointF bezier1Offset = shoulderOffset + t.map(ups(Grip::BEZIER1).off);
@@ -822,6 +846,8 @@ void TieSegment::setAutoAdjust(const PointF& offset)
             _ups[i].p += diff;
         }
         autoAdjustOffset = offset;
+        // the moved path no longer matches the inputs of the last computeBezier()
+        _lastBezierInput.reset();
     }
 }
 
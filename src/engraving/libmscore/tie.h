@@ -23,6 +23,8 @@
 #ifndef __TIE_H__
 #define __TIE_H__
 
+#include <optional>
+
 #include "slurtie.h"
 
 namespace mu::engraving {
@@ -39,6 +41,24 @@ class TieSegment final : public SlurTieSegment
     double shoulderHeightMin = 0.4;
     double shoulderHeightMax = 1.3;
 
+    //! NOTE The inputs of the last computeBezier(), the tie is laid out several times
+    //! with the same endpoints (adjustY, finalizeSegment, relayouts), the result is kept
+    struct BezierInput {
+        mu::PointF start;
+        mu::PointF end;
+        mu::PointF bezier1Offset;
+        mu::PointF bezier2Offset;
+        double spatium = 0.0;
+        double thickness = 0.0;
+        double shoulderHeightMin = 0.0;
+        double shoulderHeightMax = 0.0;
+        bool up = false;
+        SlurStyleType styleType = SlurStyleType::Undefined;
+
+        bool operator==(const BezierInput& o) const;
+    };
+    std::optional<BezierInput> _lastBezierInput;
+
     void setAutoAdjust(const mu::PointF& offset);
     void setAutoAdjust(double x, double y) { setAutoAdjust(mu::PointF(x, y)); }
     mu::PointF getAutoAdjust() const { return autoAdjustOffset; }
@@ -118,6 +118,7 @@ enum class CommandType {
 
     // Property
     ChangeProperty,
+    ChangeProperties,
 
     // Voices
     ExchangeVoice,
@@ -34,6 +34,8 @@
 
 #include "undo.h"
 
+#include <algorithm>
+
 #include "iengravingfont.h"
 
 #include "bend.h"
@@ -174,7 +176,7 @@ void UndoCommand::cleanup(bool undo)
 
 void UndoCommand::undo(EditData* ed)
 {
-    for (std::list<UndoCommand*>::reverse_iterator it = childList.rbegin(); it != childList.rend(); ++it) {
+    for (auto it = childList.rbegin(); it != childList.rend(); ++it) {
         LOG_UNDO() << "<" << (*it)->name() << ">";
         (*it)->undo(ed);
     }
@@ -248,7 +250,7 @@ bool UndoCommand::hasUnfilteredChildren(const std::vector<UndoCommand::Filter>&
 
 void UndoCommand::filterChildren(UndoCommand::Filter f, EngravingItem* target)
 {
-    std::list<UndoCommand*> acceptedList;
+    std::vector<UndoCommand*> acceptedList;
     for (UndoCommand* cmd : childList) {
         if (cmd->isFiltered(f, target)) {
             delete cmd;
@@ -259,6 +261,19 @@ void UndoCommand::filterChildren(UndoCommand::Filter f, EngravingItem* target)
     childList = std::move(acceptedList);
 }
 
+//---------------------------------------------------------
+//   memoryUsage
+//---------------------------------------------------------
+
+size_t UndoCommand::memoryUsage() const
+{
+    size_t bytes = objectSize() + childList.capacity() * sizeof(UndoCommand*);
+    for (const UndoCommand* cmd : childList) {
+        bytes += cmd->memoryUsage();
+    }
+    return bytes;
+}
+
 //---------------------------------------------------------
 //   unwind
 //---------------------------------------------------------
@@ -294,7 +309,10 @@ UndoStack::~UndoStack()
 {
     size_t idx = 0;
     for (auto c : list) {
-        c->cleanup(idx++ < curIdx);
+        if (c) {
+            c->cleanup(idx < curIdx);
+        }
+        ++idx;
     }
     DeleteAll(list);
 }
@@ -326,12 +344,50 @@ void UndoStack::beginMacro(Score* score)
     curCmd = new UndoMacro(score);
 }
 
+//---------------------------------------------------------
+//   setThreadCommandBuffer
+//---------------------------------------------------------
+
+static thread_local UndoStack::CommandList* s_threadCommandBuffer = nullptr;
+
+void UndoStack::setThreadCommandBuffer(CommandList* buffer)
+{
+    s_threadCommandBuffer = buffer;
+}
+
+//---------------------------------------------------------
+//   appendCommands
+//    appends the commands kept in a thread buffer to the
+//    current macro, in their order
+//---------------------------------------------------------
+
+void UndoStack::appendCommands(CommandList& cmds)
+{
+    IF_ASSERT_FAILED(curCmd || cmds.empty()) {
+        DeleteAll(cmds);
+        cmds.clear();
+        return;
+    }
+
+    propertyBatch = nullptr;
+    for (UndoCommand* cmd : cmds) {
+        curCmd->appendChild(cmd);
+    }
+    cmds.clear();
+}
+
 //---------------------------------------------------------
 //   push
 //---------------------------------------------------------
 
 void UndoStack::push(UndoCommand* cmd, EditData* ed)
 {
+    if (curCmd && s_threadCommandBuffer) {
+        s_threadCommandBuffer->push_back(cmd);
+        cmd->redo(ed);
+        return;
+    }
+
     if (!curCmd) {
         // this can happen for layout() outside of a command (load)
         if (!ScoreLoad::loading()) {
@@ -350,6 +406,7 @@ void UndoStack::push(UndoCommand* cmd, EditData* ed)
         LOG_UNDO() << cmd->name();
     }
 #endif
+    propertyBatch = nullptr;
     curCmd->appendChild(cmd);
     cmd->redo(ed);
 }
@@ -360,15 +417,53 @@ void UndoStack::push(UndoCommand* cmd, EditData* ed)
 
 void UndoStack::push1(UndoCommand* cmd)
 {
+    if (curCmd && s_threadCommandBuffer) {
+        s_threadCommandBuffer->push_back(cmd);
+        return;
+    }
+
     if (!curCmd) {
         if (!ScoreLoad::loading()) {
             LOGW("no active command, UndoStack %p", this);
         }
         return;
     }
+    propertyBatch = nullptr;
     curCmd->appendChild(cmd);
 }
 
+//---------------------------------------------------------
+//   endPropertyBatch
+//---------------------------------------------------------
+
+void UndoStack::endPropertyBatch()
+{
+    assert(propertyBatchLevel > 0);
+    if (--propertyBatchLevel == 0) {
+        propertyBatch = nullptr;
+    }
+}
+
+//---------------------------------------------------------
+//   pushPropertyChange
+///   Record and apply a property change in the batch being
+///   recorded. Commands pushed in between start a new batch
+///   command so that the order of the changes is kept.
+//---------------------------------------------------------
+
+bool UndoStack::pushPropertyChange(EngravingObject* e, Pid id, const PropertyValue& v, PropertyFlags ps)
+{
+    if (propertyBatchLevel == 0 || !curCmd || s_threadCommandBuffer) {
+        return false;
+    }
+    if (!propertyBatch) {
+        propertyBatch = new ChangeProperties();
+        curCmd->appendChild(propertyBatch);
+    }
+    propertyBatch->add(e, id, v, ps);
+    return true;
+}
+
 //---------------------------------------------------------
 //   remove
 //---------------------------------------------------------
@@ -381,17 +476,55 @@ void UndoStack::remove(size_t idx)
     while (list.size() > curIdx) {
         UndoCommand* cmd = mu::takeLast(list);
         stateList.pop_back();
+        heldMemory -= std::min(heldMemory, cmd->memoryUsage());
         cmd->cleanup(false);      // delete elements for which UndoCommand() holds ownership
         delete cmd;
 //            --curIdx;
     }
-    while (list.size() > idx) {
+    while (list.size() > std::max(idx, droppedCount)) {
         UndoCommand* cmd = mu::takeLast(list);
         stateList.pop_back();
+        heldMemory -= std::min(heldMemory, cmd->memoryUsage());
+        cmd->cleanup(true);
+        delete cmd;
+    }
+    curIdx = list.size();
+}
+
+//---------------------------------------------------------
+//   memoryUsage
+//---------------------------------------------------------
+
+size_t UndoStack::memoryUsage() const
+{
+    size_t bytes = sizeof(UndoStack) + list.capacity() * sizeof(UndoMacro*) + stateList.capacity() * sizeof(int);
+    for (const UndoMacro* macro : list) {
+        if (macro) {
+            bytes += macro->memoryUsage();
+        }
+    }
+    return bytes;
+}
+
+//---------------------------------------------------------
+//   dropOldMacros
+//    drop the oldest done macros while the stack is over
+//    its limit, the last one is always kept
+//---------------------------------------------------------
+
+void UndoStack::dropOldMacros()
+{
+    if (MScore::undoMemoryLimit == 0) {
+        return;
+    }
+    while (heldMemory > MScore::undoMemoryLimit && droppedCount + 1 < curIdx) {
+        UndoMacro* cmd = list[droppedCount];
+        list[droppedCount] = nullptr;
+        ++droppedCount;
+        heldMemory -= std::min(heldMemory, cmd->memoryUsage());
         cmd->cleanup(true);
         delete cmd;
     }
-    curIdx = idx;
 }
 
 //---------------------------------------------------------
@@ -402,6 +535,7 @@ void UndoStack::mergeCommands(size_t startIdx)
 {
     assert(startIdx <= curIdx);
 
+    startIdx = std::max(startIdx, droppedCount);
     if (startIdx >= list.size()) {
         return;
     }
@@ -412,6 +546,23 @@ void UndoStack::mergeCommands(size_t startIdx)
         startMacro->append(std::move(*list[idx]));
     }
     remove(startIdx + 1);   // TODO: remove from startIdx to curIdx only
+
+    // the merged macros were emptied before they were removed
+    updateHeldMemory();
+}
+
+//---------------------------------------------------------
+//   updateHeldMemory
+//---------------------------------------------------------
+
+void UndoStack::updateHeldMemory()
+{
+    heldMemory = 0;
+    for (const UndoMacro* macro : list) {
+        if (macro) {
+            heldMemory += macro->memoryUsage();
+        }
+    }
 }
 
 //---------------------------------------------------------
@@ -426,6 +577,7 @@ void UndoStack::pop()
         }
         return;
     }
+    propertyBatch = nullptr;
     UndoCommand* cmd = curCmd->removeChild();
     cmd->undo(0);
 }
@@ -451,14 +603,18 @@ void UndoStack::endMacro(bool rollback)
         while (list.size() > curIdx) {
             UndoCommand* cmd = mu::takeLast(list);
             stateList.pop_back();
+            heldMemory -= std::min(heldMemory, cmd->memoryUsage());
             cmd->cleanup(false);        // delete elements for which UndoCommand() holds ownership
             delete cmd;
         }
         list.push_back(curCmd);
         stateList.push_back(nextState++);
         ++curIdx;
+        heldMemory += curCmd->memoryUsage();
+        dropOldMacros();
     }
     curCmd = 0;
+    propertyBatch = nullptr;
 }
 
 //---------------------------------------------------------
@@ -473,9 +629,10 @@ void UndoStack::reopen()
 
     LOG_UNDO() << "curIdx: " << curIdx << ", size: " << list.size();
     assert(curCmd == 0);
-    assert(curIdx > 0);
+    assert(curIdx > droppedCount);
     --curIdx;
     curCmd = mu::takeAt(list, curIdx);
+    heldMemory -= std::min(heldMemory, curCmd->memoryUsage());
     stateList.erase(stateList.begin() + curIdx);
     for (auto i : curCmd->commands()) {
         LOG_UNDO() << "   " << i->name();
@@ -497,7 +654,7 @@ void UndoStack::undo(EditData* ed)
             return;
         }
     }
-    if (curIdx) {
+    if (canUndo()) {
         --curIdx;
         assert(curIdx < list.size());
         list[curIdx]->undo(ed);
@@ -533,7 +690,7 @@ void UndoMacro::fillSelectionInfo(SelectionInfo& info, const Selection& sel)
     if (sel.isList()) {
         for (EngravingItem* e : sel.elements()) {
             if (canRecordSelectedElement(e)) {
-                info.elements.push_back(e);
+                info.elements.push_back(e->eid());
             } else {
                 // don't remember selection we are unable to restore
                 info.elements.clear();
@@ -548,11 +705,15 @@ void UndoMacro::fillSelectionInfo(SelectionInfo& info, const Selection& sel)
     }
 }
 
-void UndoMacro::applySelectionInfo(const SelectionInfo& info, Selection& sel)
+void UndoMacro::applySelectionInfo(const SelectionInfo& info, Score* score)
 {
+    Selection& sel = score->selection();
     if (!info.elements.empty()) {
-        for (EngravingItem* e : info.elements) {
-            sel.add(e);
+        for (eid_t eid : info.elements) {
+            // the item may have been deleted since, e.g. a relayout replaced it
+            if (EngravingItem* e = score->itemByEid(eid)) {
+                sel.add(e);
+            }
         }
     } else if (info.staffStart != mu::nidx) {
         sel.setRangeTicks(info.tickStart, info.tickEnd, info.staffStart, info.staffEnd);
@@ -577,7 +738,7 @@ void UndoMacro::undo(EditData* ed)
     m_score->setInputState(m_undoInputState);
     if (m_undoSelectionInfo.isValid()) {
         m_score->deselectAll();
-        applySelectionInfo(m_undoSelectionInfo, m_score->selection());
+        applySelectionInfo(m_undoSelectionInfo, m_score);
     }
 }
 
@@ -593,7 +754,7 @@ void UndoMacro::redo(EditData* ed)
     m_score->setInputState(m_redoInputState);
     if (m_redoSelectionInfo.isValid()) {
         m_score->deselectAll();
-        applySelectionInfo(m_redoSelectionInfo, m_score->selection());
+        applySelectionInfo(m_redoSelectionInfo, m_score);
     }
 }
 
@@ -641,6 +802,10 @@ UndoMacro::ChangesInfo UndoMacro::changesInfo() const
         if (type == CommandType::ChangeProperty) {
             auto changeProperty = static_cast<const ChangeProperty*>(command);
             result.changedPropertyIdSet.insert(changeProperty->getId());
+        } else if (type == CommandType::ChangeProperties) {
+            for (Pid id : static_cast<const ChangeProperties*>(command)->propertyIds()) {
+                result.changedPropertyIdSet.insert(id);
+            }
         } else if (type == CommandType::ChangeStyleVal) {
             auto changeStyle = static_cast<const ChangeStyleVal*>(command);
             result.changedStyleIdSet.insert(changeStyle->id());
@@ -1877,15 +2042,7 @@ void ChangeStyleVal::flip(EditData*)
         case Sid::chordModifierAdjust:
         case Sid::chordDescriptionFile: {
             score->chordList()->unload();
-            double emag = score->styleD(Sid::chordExtensionMag);
-            double eadjust = score->styleD(Sid::chordExtensionAdjust);
-            double mmag = score->styleD(Sid::chordModifierMag);
-            double madjust = score->styleD(Sid::chordModifierAdjust);
-            score->chordList()->configureAutoAdjust(emag, eadjust, mmag, madjust);
-            if (score->styleB(Sid::chordsXmlFile)) {
-                score->chordList()->read(u"chords.xml");
-            }
-            score->chordList()->read(score->styleSt(Sid::chordDescriptionFile));
+            score->checkChordList();
             score->chordList()->setCustomChordList(score->styleSt(Sid::chordStyle) == "custom");
         }
         break;
@@ -2455,6 +2612,74 @@ std::vector<const EngravingObject*> ChangeProperty::objectItems() const
     return compoundObjects(element);
 }
 
+//---------------------------------------------------------
+//   ChangeProperties
+//---------------------------------------------------------
+
+void ChangeProperties::flipChange(Change& c)
+{
+    PropertyValue v = c.element->getProperty(c.id);
+    PropertyFlags ps = c.element->propertyFlags(c.id);
+
+    c.element->setProperty(c.id, c.property);
+    c.element->setPropertyFlags(c.id, c.flags);
+    c.property = v;
+    c.flags = ps;
+}
+
+void ChangeProperties::add(EngravingObject* e, Pid i, const PropertyValue& v, PropertyFlags ps)
+{
+    LOG_UNDO() << e->typeName() << int(i) << "(" << propertyName(i) << ")" << e->getProperty(i) << "->" << v;
+
+    m_changes.push_back({ e, i, v, ps });
+    flipChange(m_changes.back());
+}
+
+void ChangeProperties::undo(EditData*)
+{
+    for (auto it = m_changes.rbegin(); it != m_changes.rend(); ++it) {
+        flipChange(*it);
+    }
+}
+
+void ChangeProperties::redo(EditData*)
+{
+    for (Change& c : m_changes) {
+        flipChange(c);
+    }
+}
+
+PropertyIdSet ChangeProperties::propertyIds() const
+{
+    PropertyIdSet ids;
+    for (const Change& c : m_changes) {
+        ids.insert(c.id);
+    }
+    return ids;
+}
+
+std::vector<const EngravingObject*> ChangeProperties::objectItems() const
+{
+    std::vector<const EngravingObject*> objects;
+    for (const Change& c : m_changes) {
+        mu::join(objects, compoundObjects(c.element));
+    }
+    return objects;
+}
+
+bool ChangeProperties::isFiltered(UndoCommand::Filter f, const EngravingItem* target) const
+{
+    if (f != UndoCommand::Filter::ChangePropertyLinked || m_changes.empty()) {
+        return false;
+    }
+    for (const Change& c : m_changes) {
+        if (!mu::contains(target->linkList(), c.element)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 //---------------------------------------------------------
 //   ChangeBracketProperty::flip
 //---------------------------------------------------------
@@ -64,6 +64,7 @@
 
 namespace mu::engraving {
 class Bend;
+class ChangeProperties;
 class Chord;
 class ChordRest;
 class Clef;
@@ -92,14 +93,15 @@ class TremoloBar;
 enum class PlayEventType : char;
 
 #define UNDO_TYPE(t) CommandType type() const override { return t; }
-#define UNDO_NAME(a) const char* name() const override { return a; }
+#define UNDO_NAME(a) const char* name() const override { return a; } \
+    size_t objectSize() const override { return sizeof(*this); }
 #define UNDO_CHANGED_OBJECTS(...) std::vector<const EngravingObject*> objectItems() const override { return __VA_ARGS__; }
 
 class UndoCommand
 {
     OBJECT_ALLOCATOR(engraving, UndoCommand)
 
-    std::list<UndoCommand*> childList;
+    std::vector<UndoCommand*> childList;
 
 protected:
     virtual void flip(EditData*) {}
@@ -123,7 +125,7 @@ public:
     UndoCommand* removeChild() { return mu::takeLast(childList); }
     size_t childCount() const { return childList.size(); }
     void unwind();
-    const std::list<UndoCommand*>& commands() const { return childList; }
+    const std::vector<UndoCommand*>& commands() const { return childList; }
     virtual std::vector<const EngravingObject*> objectItems() const { return {}; }
     virtual void cleanup(bool undo);
 // #ifndef QT_NO_DEBUG
@@ -131,6 +133,11 @@ public:
 // #endif
     virtual CommandType type() const { return CommandType::Unknown; }
 
+    //! NOTE The size of the command object itself, the commands define it with UNDO_NAME
+    virtual size_t objectSize() const { return sizeof(UndoCommand); }
+    //! NOTE The size of the command and of its children, without the items it holds
+    size_t memoryUsage() const;
+
     virtual bool isFiltered(Filter, const EngravingItem* /* target */) const { return false; }
     bool hasFilteredChildren(Filter, const EngravingItem* target) const;
     bool hasUnfilteredChildren(const std::vector<Filter>& filters, const EngravingItem* target) const;
@@ -148,7 +155,7 @@ class UndoMacro : public UndoCommand
     OBJECT_ALLOCATOR(engraving, UndoMacro)
 public:
     struct SelectionInfo {
-        std::vector<EngravingItem*> elements;
+        std::vector<eid_t> elements;
         Fraction tickStart;
         Fraction tickEnd;
         staff_idx_t staffStart = mu::nidx;
@@ -190,9 +197,18 @@ private:
     Score* m_score = nullptr;
 
     static void fillSelectionInfo(SelectionInfo&, const Selection&);
-    static void applySelectionInfo(const SelectionInfo&, Selection&);
+    static void applySelectionInfo(const SelectionInfo&, Score*);
 };
 
+//---------------------------------------------------------
+//   UndoStack
+//    Once the commands of the stack take more than
+//    MScore::undoMemoryLimit bytes (see memoryUsage()), not
+//    counting the items they hold, the oldest macros are dropped. Their slots stay
+//    in the list as nullptr so that the indices kept by the
+//    callers (see getCurIdx()) remain valid.
+//---------------------------------------------------------
+
 class UndoStack
 {
     UndoMacro* curCmd = nullptr;
@@ -202,8 +218,15 @@ class UndoStack
     int cleanState = 0;
     size_t curIdx = 0;
     bool isLocked = false;
+    size_t heldMemory = 0;          // memory used by the macros in list
+    size_t droppedCount = 0;        // number of leading macros dropped from list
+
+    ChangeProperties* propertyBatch = nullptr;     // batch being recorded, the last child of curCmd
+    int propertyBatchLevel = 0;
 
     void remove(size_t idx);
+    void dropOldMacros();
+    void updateHeldMemory();
 
 public:
     UndoStack();
@@ -217,7 +240,11 @@ public:
     void push(UndoCommand*, EditData*);        // push & execute
     void push1(UndoCommand*);
     void pop();
-    bool canUndo() const { return curIdx > 0; }
+
+    void beginPropertyBatch() { ++propertyBatchLevel; }
+    void endPropertyBatch();
+    bool pushPropertyChange(EngravingObject*, Pid, const PropertyValue&, PropertyFlags);   // false if not batching
+    bool canUndo() const { return curIdx > droppedCount; }
     bool canRedo() const { return curIdx < list.size(); }
     bool isClean() const { return cleanState == stateList[curIdx]; }
     size_t getCurIdx() const { return curIdx; }
@@ -230,6 +257,17 @@ public:
 
     void mergeCommands(size_t startIdx);
     void cleanRedoStack() { remove(curIdx); }
+
+    //! NOTE The macros before getCurIdx() are done, the dropped ones are nullptr
+    const std::vector<UndoMacro*>& macros() const { return list; }
+    size_t memoryUsage() const;
+
+    //! NOTE While a buffer is set for the calling thread, the commands pushed on it in a macro
+    //! are executed and kept in the buffer instead of the macro, appendCommands() adds them
+    //! later, see MasterScore::doLayoutScoresRange
+    using CommandList = std::vector<UndoCommand*>;
+    static void setThreadCommandBuffer(CommandList* buffer);
+    void appendCommands(CommandList& cmds);
 };
 
 class InsertPart : public UndoCommand
@@ -634,6 +672,7 @@ public:
     bool isFiltered(UndoCommand::Filter f, const EngravingItem* target) const override;
 
     std::vector<const EngravingObject*> objectItems() const override;
+    size_t objectSize() const override { return sizeof(*this); }
 
     UNDO_TYPE(CommandType::AddElement)
 };
@@ -652,6 +691,7 @@ public:
     const char* name() const override;
 
     bool isFiltered(UndoCommand::Filter f, const EngravingItem* target) const override;
+    size_t objectSize() const override { return sizeof(*this); }
 
     UNDO_TYPE(CommandType::RemoveElement)
     UNDO_CHANGED_OBJECTS({ element })
@@ -1123,6 +1163,45 @@ public:
     }
 };
 
+//---------------------------------------------------------
+//   ChangeProperties
+//    Property changes of a batch (see
+//    UndoStack::beginPropertyBatch()) recorded as one command
+//---------------------------------------------------------
+
+class ChangeProperties : public UndoCommand
+{
+    OBJECT_ALLOCATOR(engraving, ChangeProperties)
+
+    struct Change {
+        EngravingObject* element = nullptr;
+        Pid id;
+        PropertyValue property;
+        PropertyFlags flags;
+    };
+
+    std::vector<Change> m_changes;
+
+    static void flipChange(Change&);
+
+public:
+    void add(EngravingObject* e, Pid i, const PropertyValue& v, PropertyFlags ps);   // record and apply
+    bool empty() const { return m_changes.empty(); }
+
+    void undo(EditData*) override;
+    void redo(EditData*) override;
+
+    PropertyIdSet propertyIds() const;
+
+    UNDO_TYPE(CommandType::ChangeProperties)
+    const char* name() const override { return "ChangeProperties"; }
+    size_t objectSize() const override { return sizeof(*this) + m_changes.capacity() * sizeof(Change); }
+
+    std::vector<const EngravingObject*> objectItems() const override;
+
+    bool isFiltered(UndoCommand::Filter f, const EngravingItem* target) const override;
+};
+
 class ChangeBracketProperty : public ChangeProperty
 {
     OBJECT_ALLOCATOR(engraving, ChangeBracketProperty)
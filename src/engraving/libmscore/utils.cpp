@@ -70,15 +70,12 @@ Measure* Score::tick2measure(const Fraction& tick) const
         return firstMeasure();
     }
 
-    Measure* lm = 0;
-    for (Measure* m = firstMeasure(); m; m = m->nextMeasure()) {
-        if (tick < m->tick()) {
-            assert(lm);
-            return lm;
-        }
-        lm = m;
+    Measure* m = _measures.measureAt(tick);
+    if (m && m != lastMeasure()) {
+        return m;
     }
     // check last measure
+    Measure* lm = lastMeasure();
     if (lm && (tick >= lm->tick()) && (tick <= lm->endTick())) {
         return lm;
     }
@@ -100,14 +97,24 @@ Measure* Score::tick2measureMM(const Fraction& t) const
         tick = Fraction(0, 1);
     }
 
-    Measure* lm = 0;
-
-    for (Measure* m = firstMeasureMM(); m; m = m->nextMeasureMM()) {
-        if (tick < m->tick()) {
-            assert(lm);
-            return lm;
+    Measure* m = _measures.measureAt(tick);
+    if (!m) {
+        m = firstMeasure();
+    }
+    if (m && styleB(Sid::createMultiMeasureRests)) {
+        // the multimeasure rest standing in for m in the MM chain
+        if (m->hasMMRest()) {
+            m = m->mmRest();
+        } else if (m->mmRestCount() < 0) {
+            Measure* mmr = const_cast<Measure*>(m->mmRest1());
+            if (mmr) {
+                m = mmr;
+            }
         }
-        lm = m;
+    }
+    Measure* lm = lastMeasureMM();
+    if (m && m != lm) {
+        return m;
     }
     // check last measure
     if (lm && (tick >= lm->tick()) && (tick <= lm->endTick())) {
@@ -123,12 +130,9 @@ Measure* Score::tick2measureMM(const Fraction& t) const
 
 MeasureBase* Score::tick2measureBase(const Fraction& tick) const
 {
-    for (MeasureBase* mb = first(); mb; mb = mb->next()) {
-        Fraction st = mb->tick();
-        Fraction l  = mb->ticks();
-        if (tick >= st && tick < (st + l)) {
-            return mb;
-        }
+    Measure* m = _measures.measureAt(tick);
+    if (m && tick < m->endTick()) {
+        return m;
     }
 //      LOGD("tick2measureBase %d not found", tick);
     return 0;
@@ -171,19 +175,18 @@ Segment* Score::tick2segment(const Fraction& t, bool first, SegmentType st, bool
         LOGD("no measure for tick %d", tick.ticks());
         return 0;
     }
-    for (Segment* segment   = m->first(st); segment;) {
-        Fraction t1       = segment->tick();
+    const Fraction rtick = tick - m->tick();
+    for (Segment* segment = m->segments().lowerBound(rtick); segment && segment->rtick() == rtick; segment = segment->next()) {
+        if (!(segment->segmentType() & st)) {
+            continue;
+        }
+        if (first) {
+            return segment;
+        }
         Segment* nsegment = segment->next(st);
-        if (tick == t1) {
-            if (first) {
-                return segment;
-            } else {
-                if (!nsegment || tick < nsegment->tick()) {
-                    return segment;
-                }
-            }
+        if (!nsegment || rtick < nsegment->rtick()) {
+            return segment;
         }
-        segment = nsegment;
     }
     LOGD("no segment for tick %d (start search at %d (measure %d))", tick.ticks(), t.ticks(), m->tick().ticks());
     return 0;
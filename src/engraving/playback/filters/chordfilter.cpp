@@ -25,11 +25,18 @@
 #include "libmscore/chord.h"
 
 #include "internal/tremolofilter.h"
+#include "playbackfiltercache.h"
 
 using namespace mu::engraving;
 
 bool ChordFilter::isPlayable(const EngravingItem* item, const RenderingContext& ctx)
 {
+    if (ctx.filterCache && item->isChord()) {
+        if (const PlaybackFilterCache::ChordData* data = ctx.filterCache->chordData(toChord(item))) {
+            return data->isPlayable;
+        }
+    }
+
     return TremoloFilter::isItemPlayable(item, ctx);
 }
 
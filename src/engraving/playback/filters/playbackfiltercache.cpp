@@ -0,0 +1,140 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "playbackfiltercache.h"
+
+#include "libmscore/chord.h"
+#include "libmscore/measure.h"
+#include "libmscore/score.h"
+#include "libmscore/segment.h"
+
+#include "playback/metaparsers/internal/spannersmetaparser.h"
+
+#include "chordfilter.h"
+#include "spannerfilter.h"
+
+using namespace mu::engraving;
+
+const PlaybackFilterCache::ChordData* PlaybackFilterCache::chordData(const Chord* chord) const
+{
+    auto search = m_chordDataMap.find(chord);
+    if (search == m_chordDataMap.cend() || search->second.tick != chord->tick().ticks()) {
+        return nullptr;
+    }
+
+    return &search->second;
+}
+
+void PlaybackFilterCache::update(const Score* score, const int tickFrom, const int tickTo, const std::set<staff_idx_t>& staves)
+{
+    TRACEFUNC;
+
+    for (const Measure* measure = score->tick2measure(Fraction::fromTicks(tickFrom));
+         measure && measure->tick().ticks() <= tickTo; measure = measure->nextMeasure()) {
+        for (const Segment* segment = measure->first(SegmentType::ChordRest); segment; segment = segment->next(SegmentType::ChordRest)) {
+            for (staff_idx_t staffIdx : staves) {
+                for (voice_idx_t voice = 0; voice < VOICES; ++voice) {
+                    const EngravingItem* item = segment->element(staff2track(staffIdx, voice));
+                    if (!item || !item->isChord()) {
+                        continue;
+                    }
+
+                    const Chord* chord = toChord(item);
+                    if (chordData(chord)) {
+                        continue;
+                    }
+
+                    //! NOTE The chord filters only depend on the nominal position of the chord
+                    RenderingContext ctx;
+                    ctx.nominalPositionStartTick = chord->tick().ticks();
+                    ctx.nominalDurationTicks = chord->actualTicks().ticks();
+                    ctx.nominalPositionEndTick = ctx.nominalPositionStartTick + ctx.nominalDurationTicks;
+
+                    ChordData& data = m_chordDataMap[chord];
+                    data.tick = ctx.nominalPositionStartTick;
+                    data.isPlayable = ChordFilter::isItemPlayable(chord, ctx);
+                    data.spannerIntervals.clear();
+
+                    //! NOTE Only the spanners whose changes clear the cache are kept (see invalidate()),
+                    //! the others may be deleted by a change that doesn't reach this chord
+                    SpannerMap::IntervalList intervals;
+                    SpannerFilter::collectChordSpanners(chord, ctx, intervals);
+                    for (const auto& interval : intervals) {
+                        if (SpannersMetaParser::isAbleToParse(interval.value)) {
+                            data.spannerIntervals.push_back(interval);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+void PlaybackFilterCache::invalidate(const ScoreChangesRange& range)
+{
+    //! NOTE These changes may affect the chords outside of the changed range,
+    //! the spanners are the ones kept by the cache (see SpannersMetaParser::isAbleToParse)
+    static const ElementTypeSet STRUCTURE_TYPES = {
+        ElementType::SCORE,
+        ElementType::PART,
+        ElementType::STAFF,
+        ElementType::MEASURE,
+        ElementType::TREMOLO,
+        ElementType::SLUR,
+        ElementType::SLUR_SEGMENT,
+        ElementType::PEDAL,
+        ElementType::PEDAL_SEGMENT,
+        ElementType::LET_RING,
+        ElementType::LET_RING_SEGMENT,
+        ElementType::PALM_MUTE,
+        ElementType::PALM_MUTE_SEGMENT,
+        ElementType::TRILL,
+        ElementType::TRILL_SEGMENT,
+        ElementType::GLISSANDO,
+        ElementType::GLISSANDO_SEGMENT,
+    };
+
+    if (!range.isValidBoundary()) {
+        clear();
+        return;
+    }
+
+    for (const ElementType type : range.changedTypes) {
+        if (STRUCTURE_TYPES.find(type) != STRUCTURE_TYPES.cend()) {
+            clear();
+            return;
+        }
+    }
+
+    for (auto it = m_chordDataMap.begin(); it != m_chordDataMap.end();) {
+        if (it->second.tick >= range.tickFrom && it->second.tick <= range.tickTo) {
+            it = m_chordDataMap.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void PlaybackFilterCache::clear()
+{
+    m_chordDataMap.clear();
+}
@@ -0,0 +1,63 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_ENGRAVING_PLAYBACKFILTERCACHE_H
+#define MU_ENGRAVING_PLAYBACKFILTERCACHE_H
+
+#include <set>
+#include <unordered_map>
+
+#include "types/types.h"
+#include "libmscore/spannermap.h"
+#include "libmscore/types.h"
+
+namespace mu::engraving {
+class Chord;
+class Score;
+
+//! NOTE The filter decisions of the chords, which do not depend on the repeats or on the dynamics and tempo,
+//! so they survive the renders of the unchanged content, e.g. when the tracks are reloaded after a dynamic change
+class PlaybackFilterCache
+{
+public:
+    struct ChordData {
+        int tick = 0;
+        bool isPlayable = false;
+        SpannerMap::IntervalList spannerIntervals;     // only the spanners the playback parses
+    };
+
+    //! NOTE Returns nullptr if the chord is not cached (or has been moved since), the filters are evaluated then,
+    //! which is safe from the render workers, as the spanner queries fill the caller's list
+    const ChordData* chordData(const Chord* chord) const;
+
+    //! NOTE Must be called before the rendering, the cache is only read while the tracks are rendered concurrently
+    void update(const Score* score, const int tickFrom, const int tickTo, const std::set<staff_idx_t>& staves);
+
+    void invalidate(const ScoreChangesRange& range);
+    void clear();
+
+private:
+    std::unordered_map<const Chord*, ChordData> m_chordDataMap;
+};
+}
+
+#endif // MU_ENGRAVING_PLAYBACKFILTERCACHE_H
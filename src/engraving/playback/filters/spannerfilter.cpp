@@ -22,8 +22,10 @@
 
 #include "spannerfilter.h"
 
+#include "libmscore/chord.h"
 #include "libmscore/spanner.h"
 #include "libmscore/pedal.h"
+#include "libmscore/score.h"
 #include "libmscore/segment.h"
 
 using namespace mu;
@@ -81,6 +83,41 @@ int SpannerFilter::spannerActualDurationTicks(const Spanner* spanner, const int
     return nominalDurationTicks;
 }
 
+void SpannerFilter::collectChordSpanners(const Chord* chord, const RenderingContext& ctx, SpannerMap::IntervalList& result)
+{
+    const SpannerMap& spannerMap = chord->score()->spannerMap();
+
+    if (spannerMap.empty()) {
+        return;
+    }
+
+    SpannerMap::IntervalList intervals;
+    spannerMap.findOverlapping(ctx.nominalPositionStartTick,
+                               ctx.nominalPositionEndTick,
+                               intervals,
+                               /*excludeCollisions*/ true);
+
+    for (const auto& interval : intervals) {
+        const Spanner* spanner = interval.value;
+
+        if (isMultiStaffSpanner(spanner)) {
+            if (spanner->part() != chord->part()) {
+                continue;
+            }
+        } else {
+            if (spanner->staffIdx() != chord->staffIdx()) {
+                continue;
+            }
+        }
+
+        if (!isItemPlayable(spanner, ctx)) {
+            continue;
+        }
+
+        result.push_back(interval);
+    }
+}
+
 bool SpannerFilter::isMultiStaffSpanner(const Spanner* spanner)
 {
     static const ElementTypeSet MULTI_STAFF_SPANNERS = {
@@ -23,9 +23,12 @@
 #ifndef MU_ENGRAVING_SPANNERFILTER_H
 #define MU_ENGRAVING_SPANNERFILTER_H
 
+#include "libmscore/spannermap.h"
+
 #include "filterbase.h"
 
 namespace Ms {
+class Chord;
 class Spanner;
 }
 
@@ -38,6 +41,9 @@ public:
     static int spannerActualDurationTicks(const Spanner* spanner, const int nominalDurationTicks);
     static bool isMultiStaffSpanner(const Spanner* spanner);
 
+    //! NOTE The playable spanners which overlap the chord and belong to its staff (or to its part, for the multi-staff ones)
+    static void collectChordSpanners(const Chord* chord, const RenderingContext& ctx, SpannerMap::IntervalList& result);
+
 protected:
     friend class FilterBase<SpannerFilter>;
     static bool isPlayable(const EngravingItem* item, const RenderingContext& ctx);
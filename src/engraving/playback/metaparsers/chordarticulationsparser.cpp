@@ -33,6 +33,7 @@
 #include "playback/utils/arrangementutils.h"
 #include "playback/filters/chordfilter.h"
 #include "playback/filters/spannerfilter.h"
+#include "playback/filters/playbackfiltercache.h"
 #include "internal/spannersmetaparser.h"
 #include "internal/symbolsmetaparser.h"
 #include "internal/annotationsmetaparser.h"
@@ -91,37 +92,20 @@ void ChordArticulationsParser::parseSpanners(const Chord* chord, const Rendering
 {
     const Score* score = chord->score();
 
-    const SpannerMap& spannerMap = score->spannerMap();
+    const PlaybackFilterCache::ChordData* cachedData = ctx.filterCache ? ctx.filterCache->chordData(chord) : nullptr;
 
-    if (spannerMap.empty()) {
-        return;
+    SpannerMap::IntervalList intervals;
+    if (!cachedData) {
+        SpannerFilter::collectChordSpanners(chord, ctx, intervals);
     }
 
-    auto intervals = spannerMap.findOverlapping(ctx.nominalPositionStartTick,
-                                                ctx.nominalPositionEndTick,
-                                                /*excludeCollisions*/ true);
-
-    for (const auto& interval : intervals) {
-        Spanner* spanner = interval.value;
+    for (const auto& interval : cachedData ? cachedData->spannerIntervals : intervals) {
+        const Spanner* spanner = interval.value;
 
         if (!SpannersMetaParser::isAbleToParse(spanner)) {
             continue;
         }
 
-        if (SpannerFilter::isMultiStaffSpanner(spanner)) {
-            if (spanner->part() != chord->part()) {
-                continue;
-            }
-        } else {
-            if (spanner->staffIdx() != chord->staffIdx()) {
-                continue;
-            }
-        }
-
-        if (!SpannerFilter::isItemPlayable(spanner, ctx)) {
-            continue;
-        }
-
         RenderingContext spannerContext = ctx;
         spannerContext.nominalTimestamp = timestampFromTicks(score, interval.start + ctx.positionTickOffset);
         spannerContext.nominalPositionStartTick = interval.start;
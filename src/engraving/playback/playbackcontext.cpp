@@ -180,7 +180,8 @@ void PlaybackContext::handleSpanners(const ID partId, const Score* score, const
         return;
     }
 
-    auto intervals = spannerMap.findOverlapping(segmentStartTick, segmentEndTick);
+    SpannerMap::IntervalList intervals;
+    spannerMap.findOverlapping(segmentStartTick, segmentEndTick, intervals);
     for (const auto& interval : intervals) {
         const Spanner* spanner = interval.value;
 
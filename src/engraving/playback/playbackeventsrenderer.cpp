@@ -59,6 +59,11 @@ static ArticulationMap makeArticulations(ArticulationType persistentArticulation
     return articulations;
 }
 
+void PlaybackEventsRenderer::setFilterCache(const PlaybackFilterCache* cache)
+{
+    m_filterCache = cache;
+}
+
 void PlaybackEventsRenderer::render(const EngravingItem* item, const dynamic_level_t nominalDynamicLevel,
                                     const ArticulationType persistentArticulationApplied,
                                     const ArticulationsProfilePtr profile,
@@ -261,6 +266,7 @@ void PlaybackEventsRenderer::renderNoteEvents(const Chord* chord, const int tick
                          persistentArticulationApplied,
                          articulations,
                          profile);
+    ctx.filterCache = m_filterCache;
 
     if (!ChordFilter::isItemPlayable(chord, ctx)) {
         return;
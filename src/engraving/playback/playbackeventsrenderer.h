@@ -38,6 +38,8 @@ class PlaybackEventsRenderer
 public:
     PlaybackEventsRenderer() = default;
 
+    void setFilterCache(const PlaybackFilterCache* cache);
+
     void render(const EngravingItem* item, const mpe::dynamic_level_t nominalDynamicLevel,
                 const mpe::ArticulationType persistentArticulationApplied, const mpe::ArticulationsProfilePtr profile,
                 mpe::PlaybackEventsMap& result) const;
@@ -72,6 +74,8 @@ private:
     void renderRestEvents(const Rest* rest, const int tickPositionOffset, mpe::PlaybackEventsMap& result) const;
 
     void renderArticulations(const Chord* chord, const RenderingContext& ctx, mpe::PlaybackEventList& result) const;
+
+    const PlaybackFilterCache* m_filterCache = nullptr;
 };
 }
 
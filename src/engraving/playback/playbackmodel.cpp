@@ -22,6 +22,14 @@
 
 #include "playbackmodel.h"
 
+#include <algorithm>
+#include <future>
+#include <limits>
+
+#include "async/async.h"
+#include "concurrency/taskscheduler.h"
+#include "containers.h"
+
 #include "libmscore/fret.h"
 #include "libmscore/instrument.h"
 #include "libmscore/measure.h"
@@ -44,6 +52,18 @@ static const std::string CHORD_SYMBOLS_INSTRUMENT_ID("chord_symbols");
 
 const InstrumentTrackId PlaybackModel::METRONOME_TRACK_ID = { 999, METRONOME_INSTRUMENT_ID };
 
+//! NOTE The amount of measures rendered at once in the streaming mode
+static constexpr int RENDER_CHUNK_MEASURES = 32;
+
+//! NOTE Below that, the rendering on the workers doesn't pay off
+static constexpr size_t MIN_PARTS_TO_RENDER_CONCURRENTLY = 4;
+
+static TaskScheduler* renderWorkers()
+{
+    static TaskScheduler workers;
+    return &workers;
+}
+
 static const Harmony* findChordSymbol(const EngravingItem* item)
 {
     if (item->isHarmony()) {
@@ -55,6 +75,11 @@ static const Harmony* findChordSymbol(const EngravingItem* item)
     return nullptr;
 }
 
+PlaybackModel::~PlaybackModel()
+{
+    MemoryReport::removeSources(this);
+}
+
 void PlaybackModel::load(Score* score)
 {
     if (!score || score->measures()->empty() || !score->lastMeasure()) {
@@ -63,15 +88,36 @@ void PlaybackModel::load(Score* score)
 
     m_score = score;
 
+    MemoryReport::removeSources(this);
+    MemoryReport::addSource(this, score, "playbackData", [this]() {
+        return memoryUsage();
+    });
+    m_dataChanged.setDebugName("engraving.playbackModel.dataChanged");
+    m_renderedToTick = -1;
+
+    m_filterCache.clear();
+    m_renderer.setFilterCache(&m_filterCache);
+
     auto changesChannel = score->changesChannel();
     changesChannel.resetOnReceive(this);
 
     changesChannel.onReceive(this, [this](const ScoreChangesRange& range) {
+        TRACEFUNC_C("PlaybackModel::onScoreChanged");
+
+        //! NOTE Only the filter decisions of the changed content are dropped,
+        //! even if the tracks are rendered again from a wider range
+        m_filterCache.invalidate(range);
+
+        finishRendering();
+
         TickBoundaries tickRange = tickBoundaries(range);
         TrackBoundaries trackRange = trackBoundaries(range);
 
         clearExpiredTracks();
         clearExpiredContexts(trackRange.trackFrom, trackRange.trackTo);
+
+        //! NOTE The dynamics changes are sent along with the events, so the tracks are always resent for them
+        m_keepExpiredEvents = !hasToReloadTracks(range);
         clearExpiredEvents(tickRange.tickFrom, tickRange.tickTo, trackRange.trackFrom, trackRange.trackTo);
 
         InstrumentTrackIdSet oldTracks = existingTrackIdSet();
@@ -79,6 +125,8 @@ void PlaybackModel::load(Score* score)
         ChangedTrackIdSet trackChanges;
         update(tickRange.tickFrom, tickRange.tickTo, trackRange.trackFrom, trackRange.trackTo, &trackChanges);
 
+        removeUnchangedTracks(trackChanges);
+
         notifyAboutChanges(oldTracks, trackChanges);
     });
 
@@ -86,7 +134,16 @@ void PlaybackModel::load(Score* score)
         reload();
     });
 
-    update(0, m_score->lastMeasure()->endTick().ticks(), 0, m_score->ntracks());
+    if (m_streamingEnabled) {
+        int tickTo = chunkEndTick(0);
+        update(0, tickTo - 1, 0, m_score->ntracks());
+        m_renderedToTick = tickTo;
+        m_chunksOldTracks = existingTrackIdSet();
+        m_chunksTrackChanges.clear();
+        scheduleNextChunk();
+    } else {
+        update(0, m_score->lastMeasure()->endTick().ticks(), 0, m_score->ntracks());
+    }
 
     for (const auto& pair : m_playbackDataMap) {
         m_trackAdded.send(pair.first);
@@ -95,8 +152,41 @@ void PlaybackModel::load(Score* score)
     m_dataChanged.notify();
 }
 
+MemoryReport::Entry PlaybackModel::memoryUsage() const
+{
+    //! NOTE The nodes of the maps are counted at three pointers and the value
+    constexpr size_t NODE_SIZE = 3 * sizeof(void*);
+
+    auto eventsMapUsage = [](const PlaybackEventsMap& events, MemoryReport::Entry& entry) {
+        for (const auto& p : events) {
+            entry.count += p.second.size();
+            entry.bytes += NODE_SIZE + sizeof(p) + p.second.capacity() * sizeof(PlaybackEvent);
+        }
+    };
+
+    MemoryReport::Entry entry;
+    for (const auto& p : m_playbackDataMap) {
+        const PlaybackData& data = p.second;
+        entry.bytes += sizeof(p);
+        eventsMapUsage(data.originEvents, entry);
+        entry.bytes += data.dynamicLevelMap.size() * (NODE_SIZE + sizeof(DynamicLevelMap::value_type));
+    }
+
+    for (const auto& p : m_expiredEvents) {
+        for (const ExpiredEvents& expired : p.second) {
+            eventsMapUsage(expired.events, entry);
+        }
+    }
+
+    return entry;
+}
+
 void PlaybackModel::reload()
 {
+    //! NOTE The tracks first found by the pending chunks are not sent yet
+    bool chunksPending = m_renderedToTick >= 0;
+    m_renderedToTick = -1;
+
     int trackFrom = 0;
     size_t trackTo = m_score->ntracks();
 
@@ -114,8 +204,15 @@ void PlaybackModel::reload()
 
     for (auto& pair : m_playbackDataMap) {
         pair.second.mainStream.send(pair.second.originEvents);
+
+        if (chunksPending && !mu::contains(m_chunksOldTracks, pair.first)) {
+            m_trackAdded.send(pair.first);
+        }
     }
 
+    m_chunksOldTracks.clear();
+    m_chunksTrackChanges.clear();
+
     m_dataChanged.notify();
 }
 
@@ -144,6 +241,16 @@ void PlaybackModel::setPlayChordSymbols(const bool isEnabled)
     m_playChordSymbols = isEnabled;
 }
 
+bool PlaybackModel::isStreamingEnabled() const
+{
+    return m_streamingEnabled;
+}
+
+void PlaybackModel::setStreamingEnabled(const bool isEnabled)
+{
+    m_streamingEnabled = isEnabled;
+}
+
 const InstrumentTrackId& PlaybackModel::metronomeTrackId() const
 {
     return METRONOME_TRACK_ID;
@@ -174,6 +281,8 @@ const PlaybackData& PlaybackModel::resolveTrackPlaybackData(const InstrumentTrac
         return empty;
     }
 
+    finishRendering();
+
     update(0, m_score->lastMeasure()->tick().ticks(), part->startTrack(), part->endTrack());
 
     return m_playbackDataMap[trackId];
@@ -262,6 +371,71 @@ async::Channel<InstrumentTrackId> PlaybackModel::trackRemoved() const
     return m_trackRemoved;
 }
 
+int PlaybackModel::chunkEndTick(const int tickFrom) const
+{
+    const Measure* measure = m_score->tick2measure(Fraction::fromTicks(tickFrom));
+    for (int i = 0; measure && i < RENDER_CHUNK_MEASURES; ++i) {
+        measure = measure->nextMeasure();
+    }
+
+    return measure ? measure->tick().ticks() : m_score->lastMeasure()->endTick().ticks();
+}
+
+void PlaybackModel::scheduleNextChunk()
+{
+    if (m_renderedToTick < 0) {
+        return;
+    }
+
+    if (m_renderedToTick >= m_score->lastMeasure()->endTick().ticks()) {
+        m_renderedToTick = -1;
+        return;
+    }
+
+    async::Async::call(this, [this]() {
+        if (m_renderedToTick < 0) {
+            return;
+        }
+
+        renderChunks(chunkEndTick(m_renderedToTick));
+        scheduleNextChunk();
+    });
+}
+
+void PlaybackModel::renderChunks(const int tickTo)
+{
+    TRACEFUNC;
+
+    //! NOTE The range is inclusive, so the chunk ends before the first tick of the next one
+    updateEvents(m_renderedToTick, tickTo - 1, 0, m_score->ntracks(), &m_chunksTrackChanges);
+    m_renderedToTick = tickTo;
+
+    if (m_renderedToTick < m_score->lastMeasure()->endTick().ticks()) {
+        return;
+    }
+
+    //! NOTE The main stream replaces all the events of a track and flushes its sounding notes,
+    //! so the changed tracks are sent once, when the last chunk is rendered
+    m_renderedToTick = -1;
+
+    InstrumentTrackIdSet oldTracks = std::move(m_chunksOldTracks);
+    ChangedTrackIdSet trackChanges = std::move(m_chunksTrackChanges);
+    m_chunksOldTracks.clear();
+    m_chunksTrackChanges.clear();
+
+    notifyAboutChanges(oldTracks, trackChanges);
+}
+
+void PlaybackModel::finishRendering()
+{
+    //! NOTE The changes are applied to the events of the whole score
+    if (m_renderedToTick < 0) {
+        return;
+    }
+
+    renderChunks(m_score->lastMeasure()->endTick().ticks());
+}
+
 void PlaybackModel::update(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
                            ChangedTrackIdSet* trackChanges)
 {
@@ -319,7 +493,7 @@ void PlaybackModel::updateContext(const InstrumentTrackId& trackId)
 }
 
 void PlaybackModel::processSegment(const int tickPositionOffset, const Segment* segment, const std::set<staff_idx_t>& changedStaffIdSet,
-                                   ChangedTrackIdSet* trackChanges)
+                                   const TrackProfilesMap& profiles, TrackEventsMap& result, ChangedTrackIdSet& trackChanges) const
 {
     int segmentStartTick = segment->tick().ticks();
 
@@ -340,18 +514,17 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
 
         InstrumentTrackId trackId = chordSymbolsTrackId(item->part()->id());
 
-        ArticulationsProfilePtr profile = defaultActiculationProfile(trackId);
+        ArticulationsProfilePtr profile = mu::value(profiles, trackId);
         if (!profile) {
             LOGE() << "unsupported instrument family: " << item->part()->id();
             continue;
         }
 
         if (chordSymbol->play()) {
-            m_renderer.renderChordSymbol(chordSymbol, tickPositionOffset, profile,
-                                         m_playbackDataMap[trackId].originEvents);
+            m_renderer.renderChordSymbol(chordSymbol, tickPositionOffset, profile, result[trackId]);
         }
 
-        collectChangesTracks(trackId, trackChanges);
+        trackChanges.insert(trackId);
     }
 
     for (const EngravingItem* item : segment->elist()) {
@@ -385,13 +558,17 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
             int repeatPositionTickOffset = currentMeasureTick - referringMeasureTick;
 
             for (Segment* seg = referringMeasure->first(); seg; seg = seg->next()) {
-                processSegment(tickPositionOffset + repeatPositionTickOffset, seg, { staffIdx }, trackChanges);
+                processSegment(tickPositionOffset + repeatPositionTickOffset, seg, { staffIdx }, profiles, result, trackChanges);
             }
         }
 
-        const PlaybackContext& ctx = m_playbackCtxMap[trackId];
+        //! NOTE The contexts of all the rendered tracks are made by updateContext beforehand,
+        //! the map must not be changed here since the tracks may be rendered from several threads
+        static const PlaybackContext EMPTY_CONTEXT;
+        auto ctxIt = m_playbackCtxMap.find(trackId);
+        const PlaybackContext& ctx = ctxIt != m_playbackCtxMap.cend() ? ctxIt->second : EMPTY_CONTEXT;
 
-        ArticulationsProfilePtr profile = defaultActiculationProfile(trackId);
+        ArticulationsProfilePtr profile = mu::value(profiles, trackId);
         if (!profile) {
             LOGE() << "unsupported instrument family: " << item->part()->id();
             continue;
@@ -399,19 +576,16 @@ void PlaybackModel::processSegment(const int tickPositionOffset, const Segment*
 
         m_renderer.render(item, tickPositionOffset, ctx.appliableDynamicLevel(segmentStartTick + tickPositionOffset),
                           ctx.persistentArticulationType(segmentStartTick + tickPositionOffset), std::move(profile),
-                          m_playbackDataMap[trackId].originEvents);
+                          result[trackId]);
 
-        collectChangesTracks(trackId, trackChanges);
+        trackChanges.insert(trackId);
     }
 }
 
-void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
-                                 ChangedTrackIdSet* trackChanges)
+void PlaybackModel::renderEvents(const int tickFrom, const int tickTo, const std::set<staff_idx_t>& changedStaffIdSet,
+                                 const bool renderMetronome, const TrackProfilesMap& profiles, TrackEventsMap& result,
+                                 ChangedTrackIdSet& trackChanges) const
 {
-    TRACEFUNC;
-
-    std::set<staff_idx_t> changedStaffIdSet = m_score->staffIdsFromRange(trackFrom, trackTo);
-
     for (const RepeatSegment* repeatSegment : repeatList()) {
         int tickPositionOffset = repeatSegment->utick - repeatSegment->tick;
         int repeatStartTick = repeatSegment->tick;
@@ -429,7 +603,7 @@ void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const tra
                 continue;
             }
 
-            for (Segment* segment = measure->first(); segment; segment = segment->next()) {
+            for (Segment* segment = measure->first(); segment && !changedStaffIdSet.empty(); segment = segment->next()) {
                 if (!segment->isChordRestType()) {
                     continue;
                 }
@@ -441,12 +615,95 @@ void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const tra
                     continue;
                 }
 
-                processSegment(tickPositionOffset, segment, changedStaffIdSet, trackChanges);
+                processSegment(tickPositionOffset, segment, changedStaffIdSet, profiles, result, trackChanges);
             }
 
-            m_renderer.renderMetronome(m_score, measureStartTick, measureEndTick, tickPositionOffset,
-                                       m_playbackDataMap[METRONOME_TRACK_ID].originEvents);
-            collectChangesTracks(METRONOME_TRACK_ID, trackChanges);
+            if (renderMetronome) {
+                m_renderer.renderMetronome(m_score, measureStartTick, measureEndTick, tickPositionOffset,
+                                           result[METRONOME_TRACK_ID]);
+                trackChanges.insert(METRONOME_TRACK_ID);
+            }
+        }
+    }
+}
+
+void PlaybackModel::updateEvents(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
+                                 ChangedTrackIdSet* trackChanges)
+{
+    TRACEFUNC;
+
+    std::set<staff_idx_t> changedStaffIdSet = m_score->staffIdsFromRange(trackFrom, trackTo);
+
+    //! NOTE The profiles and the repeat list are resolved here, so that the tracks may be rendered concurrently
+    TrackProfilesMap profiles;
+    for (const auto& pair : m_playbackDataMap) {
+        profiles[pair.first] = defaultActiculationProfile(pair.first);
+    }
+
+    repeatList();
+
+    m_filterCache.update(m_score, tickFrom, tickTo, changedStaffIdSet);
+
+    //! NOTE The contexts and the items are per part, so the parts are rendered independently
+    std::vector<std::set<staff_idx_t> > partStaves;
+    for (const Part* part : m_score->parts()) {
+        std::set<staff_idx_t> staves;
+        for (staff_idx_t staffIdx : changedStaffIdSet) {
+            track_idx_t track = staff2track(staffIdx);
+            if (track >= part->startTrack() && track < part->endTrack()) {
+                staves.insert(staffIdx);
+            }
+        }
+
+        if (!staves.empty()) {
+            partStaves.push_back(std::move(staves));
+        }
+    }
+
+    std::vector<TrackEventsMap> results(partStaves.size() + 1);
+    std::vector<ChangedTrackIdSet> changes(partStaves.size() + 1);
+
+    if (partStaves.size() < MIN_PARTS_TO_RENDER_CONCURRENTLY || renderWorkers()->threadPoolSize() < 2) {
+        renderEvents(tickFrom, tickTo, changedStaffIdSet, true, profiles, results.front(), changes.front());
+    } else {
+        std::vector<std::future<void> > futures;
+        for (size_t i = 0; i < partStaves.size(); ++i) {
+            futures.push_back(renderWorkers()->submit([this, i, tickFrom, tickTo, &partStaves, &profiles, &results, &changes]() {
+                renderEvents(tickFrom, tickTo, partStaves[i], false, profiles, results[i], changes[i]);
+            }));
+        }
+
+        renderEvents(tickFrom, tickTo, {}, true, profiles, results.back(), changes.back());
+
+        for (std::future<void>& future : futures) {
+            future.wait();
+        }
+    }
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        for (auto& pair : results[i]) {
+            mergeEvents(pair.second, m_playbackDataMap[pair.first].originEvents);
+        }
+
+        if (trackChanges) {
+            trackChanges->insert(changes[i].cbegin(), changes[i].cend());
+        }
+    }
+}
+
+void PlaybackModel::mergeEvents(PlaybackEventsMap& source, PlaybackEventsMap& destination)
+{
+    if (destination.empty()) {
+        destination.swap(source);
+        return;
+    }
+
+    for (auto& pair : source) {
+        PlaybackEventList& events = destination[pair.first];
+        if (events.empty()) {
+            events = std::move(pair.second);
+        } else {
+            events.insert(events.end(), std::make_move_iterator(pair.second.begin()), std::make_move_iterator(pair.second.end()));
         }
     }
 }
@@ -517,6 +774,33 @@ bool PlaybackModel::hasToReloadScore(const std::unordered_set<ElementType>& chan
     return false;
 }
 
+bool PlaybackModel::hasToReloadFromChangeTick(const std::unordered_set<ElementType>& changedTypes) const
+{
+    static const std::unordered_set<ElementType> TEMPO_TYPES = {
+        ElementType::GRADUAL_TEMPO_CHANGE,
+        ElementType::GRADUAL_TEMPO_CHANGE_SEGMENT,
+        ElementType::TEMPO_TEXT,
+        ElementType::FERMATA,
+    };
+
+    //! NOTE A tempo change only moves the events after it,
+    //! unless the playback jumps back over the changed tick
+    if (repeatList().size() > 1) {
+        return false;
+    }
+
+    bool hasTempoChanges = false;
+    for (const ElementType type : changedTypes) {
+        if (TEMPO_TYPES.find(type) != TEMPO_TYPES.cend()) {
+            hasTempoChanges = true;
+        } else if (hasToReloadScore({ type })) {
+            return false;
+        }
+    }
+
+    return hasTempoChanges;
+}
+
 bool PlaybackModel::containsTrack(const InstrumentTrackId& trackId) const
 {
     return m_playbackDataMap.find(trackId) != m_playbackDataMap.cend();
@@ -602,7 +886,9 @@ void PlaybackModel::clearExpiredEvents(const int tickFrom, const int tickTo, con
         return;
     }
 
-    if (tickFrom == 0 && m_score->lastMeasure()->endTick().ticks() == tickTo) {
+    const bool toScoreEnd = m_score->lastMeasure()->endTick().ticks() == tickTo;
+
+    if (tickFrom == 0 && toScoreEnd) {
         removeEventsFromRange(trackFrom, trackTo);
         return;
     }
@@ -619,17 +905,49 @@ void PlaybackModel::clearExpiredEvents(const int tickFrom, const int tickTo, con
         timestamp_t timestampFrom = timestampFromTicks(m_score, tickFrom + tickPositionOffset);
         timestamp_t timestampTo = timestampFromTicks(m_score, tickTo + tickPositionOffset);
 
+        // the old events may lie beyond the new score end, e.g. after a tempo change
+        if (toScoreEnd && repeatSegment == m_score->repeatList().back()) {
+            timestampTo = std::numeric_limits<timestamp_t>::max();
+        }
+
         removeEventsFromRange(trackFrom, trackTo, timestampFrom, timestampTo);
     }
 }
 
-void PlaybackModel::collectChangesTracks(const InstrumentTrackId& trackId, ChangedTrackIdSet* result)
+void PlaybackModel::removeUnchangedTracks(ChangedTrackIdSet& trackChanges)
 {
-    if (!result) {
-        return;
+    //! NOTE Resending a track flushes its sounding notes, so the tracks with the same events as before
+    //! (e.g. the metronome and the other instruments of the changed staves) are not resent
+    for (auto it = trackChanges.begin(); it != trackChanges.end();) {
+        auto expired = m_expiredEvents.find(*it);
+        auto data = m_playbackDataMap.find(*it);
+        if (expired == m_expiredEvents.cend() || data == m_playbackDataMap.cend()) {
+            ++it;
+            continue;
+        }
+
+        const PlaybackEventsMap& events = data->second.originEvents;
+
+        bool changed = false;
+        for (const ExpiredEvents& range : expired->second) {
+            auto lowerBound = range.timestampFrom <= 0 ? events.cbegin() : events.lower_bound(range.timestampFrom);
+            auto upperBound = range.timestampTo == -1 ? events.cend() : events.upper_bound(range.timestampTo);
+
+            if (!std::equal(lowerBound, upperBound, range.events.cbegin(), range.events.cend())) {
+                changed = true;
+                break;
+            }
+        }
+
+        if (changed) {
+            ++it;
+        } else {
+            it = trackChanges.erase(it);
+        }
     }
 
-    result->insert(trackId);
+    m_expiredEvents.clear();
+    m_keepExpiredEvents = false;
 }
 
 void PlaybackModel::notifyAboutChanges(const InstrumentTrackIdSet& oldTracks, const InstrumentTrackIdSet& changedTracks)
@@ -667,7 +985,17 @@ void PlaybackModel::removeTrackEvents(const InstrumentTrackId& trackId, const mp
 
     PlaybackData& trackPlaybackData = search->second;
 
+    ExpiredEvents* expired = nullptr;
+    if (m_keepExpiredEvents) {
+        expired = &m_expiredEvents[trackId].emplace_back();
+        expired->timestampFrom = timestampFrom;
+        expired->timestampTo = timestampTo;
+    }
+
     if (timestampFrom == -1 && timestampTo == -1) {
+        if (expired) {
+            expired->events.swap(search->second.originEvents);
+        }
         search->second.originEvents.clear();
         return;
     }
@@ -685,7 +1013,13 @@ void PlaybackModel::removeTrackEvents(const InstrumentTrackId& trackId, const mp
     auto upperBound = trackPlaybackData.originEvents.upper_bound(timestampTo);
 
     for (auto it = lowerBound; it != upperBound;) {
-        it = trackPlaybackData.originEvents.erase(it);
+        if (expired) {
+            auto next = std::next(it);
+            expired->events.insert(trackPlaybackData.originEvents.extract(it));
+            it = next;
+        } else {
+            it = trackPlaybackData.originEvents.erase(it);
+        }
     }
 }
 
@@ -715,7 +1049,9 @@ PlaybackModel::TickBoundaries PlaybackModel::tickBoundaries(const ScoreChangesRa
         || hasToReloadScore(changesRange.changedTypes)
         || !changesRange.isValidBoundary()) {
         const Measure* lastMeasure = m_score->lastMeasure();
-        result.tickFrom = 0;
+        if (!changesRange.isValidBoundary() || !hasToReloadFromChangeTick(changesRange.changedTypes)) {
+            result.tickFrom = 0;
+        }
         result.tickTo = lastMeasure ? lastMeasure->endTick().ticks() : 0;
     }
 
@@ -36,9 +36,11 @@
 #include "mpe/iarticulationprofilesrepository.h"
 
 #include "types/types.h"
+#include "libmscore/memoryreport.h"
 #include "playbackeventsrenderer.h"
 #include "playbacksetupdataresolver.h"
 #include "playbackcontext.h"
+#include "filters/playbackfiltercache.h"
 
 namespace mu::engraving {
 class Score;
@@ -53,9 +55,14 @@ class PlaybackModel : public async::Asyncable
     INJECT(engraving, mpe::IArticulationProfilesRepository, profilesRepository)
 
 public:
+    ~PlaybackModel();
+
     void load(Score* score);
     void reload();
 
+    //! NOTE The memory of the rendered events, approximate: the heap memory of the events is not counted
+    MemoryReport::Entry memoryUsage() const;
+
     async::Notification dataChanged() const;
 
     bool isPlayRepeatsEnabled() const;
@@ -64,6 +71,12 @@ public:
     bool isPlayChordSymbolsEnabled() const;
     void setPlayChordSymbols(const bool isEnabled);
 
+    //! NOTE In the streaming mode only the first measures are rendered on load,
+    //! the next ones are rendered in chunks asynchronously and sent to the tracks streams
+    //! once the last chunk is rendered
+    bool isStreamingEnabled() const;
+    void setStreamingEnabled(const bool isEnabled);
+
     const InstrumentTrackId& metronomeTrackId() const;
     InstrumentTrackId chordSymbolsTrackId(const ID& partId) const;
     bool isChordSymbolsTrack(const InstrumentTrackId& trackId) const;
@@ -96,29 +109,49 @@ private:
         track_idx_t trackTo = mu::nidx;
     };
 
+    //! NOTE The events removed before an update, to find out whether the update changed them
+    struct ExpiredEvents
+    {
+        mpe::timestamp_t timestampFrom = -1;
+        mpe::timestamp_t timestampTo = -1;
+        mpe::PlaybackEventsMap events;
+    };
+
     InstrumentTrackId idKey(const EngravingItem* item) const;
     InstrumentTrackId idKey(const std::vector<const EngravingItem*>& items) const;
     InstrumentTrackId idKey(const ID& partId, const std::string& instrumentId) const;
 
     void update(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
                 ChangedTrackIdSet* trackChanges = nullptr);
+    int chunkEndTick(const int tickFrom) const;
+    void scheduleNextChunk();
+    void renderChunks(const int tickTo);
+    void finishRendering();
+
     void updateSetupData();
     void updateContext(const track_idx_t trackFrom, const track_idx_t trackTo);
     void updateContext(const InstrumentTrackId& trackId);
     void updateEvents(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo,
                       ChangedTrackIdSet* trackChanges = nullptr);
 
+    using TrackEventsMap = std::unordered_map<InstrumentTrackId, mpe::PlaybackEventsMap>;
+    using TrackProfilesMap = std::unordered_map<InstrumentTrackId, mpe::ArticulationsProfilePtr>;
+
+    void renderEvents(const int tickFrom, const int tickTo, const std::set<staff_idx_t>& changedStaffIdSet, const bool renderMetronome,
+                      const TrackProfilesMap& profiles, TrackEventsMap& result, ChangedTrackIdSet& trackChanges) const;
     void processSegment(const int tickPositionOffset, const Segment* segment, const std::set<staff_idx_t>& changedStaffIdSet,
-                        ChangedTrackIdSet* trackChanges);
+                        const TrackProfilesMap& profiles, TrackEventsMap& result, ChangedTrackIdSet& trackChanges) const;
+    static void mergeEvents(mpe::PlaybackEventsMap& source, mpe::PlaybackEventsMap& destination);
 
     bool hasToReloadTracks(const ScoreChangesRange& changesRange) const;
     bool hasToReloadScore(const std::unordered_set<ElementType>& changedTypes) const;
+    bool hasToReloadFromChangeTick(const std::unordered_set<ElementType>& changedTypes) const;
 
     bool containsTrack(const InstrumentTrackId& trackId) const;
     void clearExpiredTracks();
     void clearExpiredContexts(const track_idx_t trackFrom, const track_idx_t trackTo);
     void clearExpiredEvents(const int tickFrom, const int tickTo, const track_idx_t trackFrom, const track_idx_t trackTo);
-    void collectChangesTracks(const InstrumentTrackId& trackId, ChangedTrackIdSet* result);
+    void removeUnchangedTracks(ChangedTrackIdSet& trackChanges);
     void notifyAboutChanges(const InstrumentTrackIdSet& oldTracks, const InstrumentTrackIdSet& changedTracks);
 
     void removeEventsFromRange(const track_idx_t trackFrom, const track_idx_t trackTo, const mpe::timestamp_t timestampFrom = -1,
@@ -138,13 +171,24 @@ private:
     Score* m_score = nullptr;
     bool m_expandRepeats = true;
     bool m_playChordSymbols = true;
+    bool m_streamingEnabled = false;
+
+    // the events are rendered up to this tick, -1 when they are rendered for the whole score
+    int m_renderedToTick = -1;
+    // the tracks before the first chunk and the tracks changed by the chunks, sent after the last one
+    InstrumentTrackIdSet m_chunksOldTracks;
+    ChangedTrackIdSet m_chunksTrackChanges;
 
     PlaybackEventsRenderer m_renderer;
+    PlaybackFilterCache m_filterCache;
     PlaybackSetupDataResolver m_setupResolver;
 
     std::unordered_map<InstrumentTrackId, PlaybackContext> m_playbackCtxMap;
     std::unordered_map<InstrumentTrackId, mpe::PlaybackData> m_playbackDataMap;
 
+    bool m_keepExpiredEvents = false;
+    std::unordered_map<InstrumentTrackId, std::vector<ExpiredEvents> > m_expiredEvents;
+
     async::Notification m_dataChanged;
     async::Channel<InstrumentTrackId> m_trackAdded;
     async::Channel<InstrumentTrackId> m_trackRemoved;
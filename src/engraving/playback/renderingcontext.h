@@ -34,6 +34,8 @@
 #include "playback/utils/pitchutils.h"
 
 namespace mu::engraving {
+class PlaybackFilterCache;
+
 struct RenderingContext {
     mpe::timestamp_t nominalTimestamp = 0;
     mpe::duration_t nominalDuration = 0;
@@ -50,6 +52,8 @@ struct RenderingContext {
     mpe::ArticulationMap commonArticulations;
     mpe::ArticulationsProfilePtr profile;
 
+    const PlaybackFilterCache* filterCache = nullptr;
+
     RenderingContext() = default;
 
     explicit RenderingContext(const mpe::timestamp_t timestamp,
@@ -3022,46 +3022,6 @@ Err Read114::read114(MasterScore* masterScore, XmlReader& e, ReadContext& ctx)
 
     masterScore->connectTies();
 
-    //
-    // remove "middle beam" flags from first ChordRest in
-    // measure
-    //
-    for (Measure* m = masterScore->firstMeasure(); m; m = m->nextMeasure()) {
-        size_t tracks = masterScore->nstaves() * VOICES;
-        bool first = true;
-        for (size_t track = 0; track < tracks; ++track) {
-            for (Segment* s = m->first(); s; s = s->next()) {
-                if (s->segmentType() != SegmentType::ChordRest) {
-                    continue;
-                }
-                ChordRest* cr = toChordRest(s->element(static_cast<int>(track)));
-                if (cr) {
-                    if (!first) {
-                        switch (cr->beamMode()) {
-                        case BeamMode::AUTO:
-                        case BeamMode::BEGIN:
-                        case BeamMode::END:
-                        case BeamMode::NONE:
-                            break;
-                        case BeamMode::MID:
-                        case BeamMode::BEGIN32:
-                        case BeamMode::BEGIN64:
-                            cr->setBeamMode(BeamMode::BEGIN);
-                            break;
-                        case BeamMode::INVALID:
-                            if (cr->isChord()) {
-                                cr->setBeamMode(BeamMode::AUTO);
-                            } else {
-                                cr->setBeamMode(BeamMode::NONE);
-                            }
-                            break;
-                        }
-                        first = false;
-                    }
-                }
-            }
-        }
-    }
     for (MeasureBase* mb = masterScore->first(); mb; mb = mb->next()) {
         if (mb->isVBox()) {
             VBox* b  = toVBox(mb);
@@ -3435,9 +3435,12 @@ Err Read206::read206(mu::engraving::MasterScore* masterScore, XmlReader& e, Read
 
     // fix positions
     //    offset = saved offset - layout position
-    masterScore->doLayout();
-    for (auto i : ctx.fixOffsets()) {
-        i.first->setOffset(i.second - i.first->pos());
+    //! NOTE Only the chord lines need it, the score is laid out after reading anyway
+    if (!ctx.fixOffsets().empty()) {
+        masterScore->doLayout();
+        for (auto i : ctx.fixOffsets()) {
+            i.first->setOffset(i.second - i.first->pos());
+        }
     }
 
     return Err::NoError;
@@ -21,6 +21,10 @@
  */
 #include "scorereader.h"
 
+#include <future>
+#include <memory>
+
+#include "concurrency/taskscheduler.h"
 #include "io/buffer.h"
 
 #include "compat/readstyle.h"
@@ -33,6 +37,8 @@
 #include "../libmscore/excerpt.h"
 #include "../libmscore/imageStore.h"
 
+#include "../layout/layoutcontext.h"
+
 #include "log.h"
 
 using namespace mu::io;
@@ -50,23 +56,35 @@ mu::Ret ScoreReader::loadMscz(MasterScore* masterScore, const MscReader& mscRead
 
     ScoreLoad sl;
 
+    //! NOTE The files are taken from the reader one after another, it isn't thread safe,
+    //! but they are parsed concurrently: the style and the chord list are read on workers,
+    //! and the xml of the excerpts is parsed on workers while the master score is read.
+    //! Everything that touches the scores themselves is done on this thread in the same order as before.
+    TaskScheduler* workers = LayoutContext::workers();
+
     // Read style
+    std::future<void> styleRead;
     {
         ByteArray styleData = mscReader.readStyleFile();
         if (!styleData.empty()) {
-            Buffer buf(&styleData);
-            buf.open(IODevice::ReadOnly);
-            masterScore->style().read(&buf);
+            styleRead = workers->submit([masterScore, styleData]() mutable {
+                Buffer buf(&styleData);
+                buf.open(IODevice::ReadOnly);
+                masterScore->style().read(&buf);
+            });
         }
     }
 
     // Read ChordList
+    std::future<void> chordListRead;
     {
         ByteArray chordListData = mscReader.readChordListFile();
         if (!chordListData.empty()) {
-            Buffer buf(&chordListData);
-            buf.open(IODevice::ReadOnly);
-            masterScore->chordList()->read(&buf);
+            chordListRead = workers->submit([masterScore, chordListData]() mutable {
+                Buffer buf(&chordListData);
+                buf.open(IODevice::ReadOnly);
+                masterScore->chordList()->read(&buf);
+            });
         }
     }
 
@@ -80,6 +98,34 @@ mu::Ret ScoreReader::loadMscz(MasterScore* masterScore, const MscReader& mscRead
         }
     }
 
+    // Parse excerpts, they are only used for 4.x files, older ones have no excerpt files
+    struct ExcerptFile {
+        String name;
+        ByteArray styleData;
+        ByteArray data;
+        std::unique_ptr<XmlReader> xml;
+        std::future<void> parsed;
+    };
+
+    std::vector<String> excerptNames = mscReader.excerptNames();
+    std::vector<ExcerptFile> excerptFiles(excerptNames.size());
+    for (size_t i = 0; i < excerptNames.size(); ++i) {
+        ExcerptFile& file = excerptFiles[i];
+        file.name = excerptNames[i];
+        file.styleData = mscReader.readExcerptStyleFile(file.name);
+        file.data = mscReader.readExcerptFile(file.name);
+        file.parsed = workers->submit([&file]() {
+            file.xml = std::make_unique<XmlReader>(file.data);
+        });
+    }
+
+    if (styleRead.valid()) {
+        styleRead.get();
+    }
+    if (chordListRead.valid()) {
+        chordListRead.get();
+    }
+
     ReadContext masterScoreCtx(masterScore);
     masterScoreCtx.setIgnoreVersionError(ignoreVersionError);
 
@@ -100,9 +146,16 @@ mu::Ret ScoreReader::loadMscz(MasterScore* masterScore, const MscReader& mscRead
     }
 
     // Read excerpts
+    for (ExcerptFile& file : excerptFiles) {
+        file.parsed.get();
+    }
+
+    //! NOTE The excerpts are not read on first access: their elements are linked to the master score
+    //! by the link indexes of this read, and every edit of the master score has to reach them.
+    //! Closed parts are not laid out (see Score::update), which is what makes opening a part slow
     if (masterScore->mscVersion() >= 400) {
-        std::vector<String> excerptNames = mscReader.excerptNames();
-        for (const String& excerptName : excerptNames) {
+        for (ExcerptFile& file : excerptFiles) {
+            const String& excerptName = file.name;
             Score* partScore = masterScore->createScore();
 
             compat::ReadStyleHook::setupDefaultStyle(partScore);
@@ -110,17 +163,14 @@ mu::Ret ScoreReader::loadMscz(MasterScore* masterScore, const MscReader& mscRead
             Excerpt* ex = new Excerpt(masterScore);
             ex->setExcerptScore(partScore);
 
-            ByteArray excerptStyleData = mscReader.readExcerptStyleFile(excerptName);
-            Buffer excerptStyleBuf(&excerptStyleData);
+            Buffer excerptStyleBuf(&file.styleData);
             excerptStyleBuf.open(IODevice::ReadOnly);
             partScore->style().read(&excerptStyleBuf);
 
-            ByteArray excerptData = mscReader.readExcerptFile(excerptName);
-
             ReadContext ctx(partScore);
             ctx.initLinks(masterScoreCtx);
 
-            XmlReader xml(excerptData);
+            XmlReader& xml = *file.xml;
             xml.setDocName(excerptName);
             xml.setContext(&ctx);
 
@@ -129,6 +179,9 @@ mu::Ret ScoreReader::loadMscz(MasterScore* masterScore, const MscReader& mscRead
             partScore->linkMeasures(masterScore);
             ex->setTracksMapping(xml.context()->tracks());
 
+            // the document isn't needed anymore
+            file.xml.reset();
+
             ex->setName(excerptName);
 
             masterScore->addExcerpt(ex);
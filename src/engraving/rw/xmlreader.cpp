@@ -22,6 +22,7 @@
 
 #include "xml.h"
 
+#include "libmscore/property.h"
 #include "libmscore/score.h"
 
 #include "log.h"
@@ -29,6 +30,33 @@
 using namespace mu;
 
 namespace mu::engraving {
+//! NOTE The element names are resolved to property tokens, see EngravingObject::readProperty
+XmlReader::XmlReader()
+{
+    setTokenTable(&propertyNameTokenTable());
+}
+
+XmlReader::XmlReader(const mu::ByteArray& d)
+    : XmlStreamReader(d)
+{
+    setTokenTable(&propertyNameTokenTable());
+}
+
+XmlReader::XmlReader(mu::io::IODevice* d)
+    : XmlStreamReader(d)
+{
+    setTokenTable(&propertyNameTokenTable());
+}
+
+#ifndef NO_QT_SUPPORT
+XmlReader::XmlReader(const QByteArray& d)
+    : XmlStreamReader(d)
+{
+    setTokenTable(&propertyNameTokenTable());
+}
+
+#endif
+
 XmlReader::~XmlReader()
 {
     if (m_selfContext) {
@@ -38,15 +38,12 @@ class XmlReader : public XmlStreamReader
 {
 public:
 
-    XmlReader() = default;
-    XmlReader(const mu::ByteArray& d)
-        : XmlStreamReader(d) {}
-    XmlReader(mu::io::IODevice* d)
-        : XmlStreamReader(d) {}
+    XmlReader();
+    XmlReader(const mu::ByteArray& d);
+    XmlReader(mu::io::IODevice* d);
 
 #ifndef NO_QT_SUPPORT
-    XmlReader(const QByteArray& d)
-        : XmlStreamReader(d) {}
+    XmlReader(const QByteArray& d);
 #endif
 
     XmlReader(const XmlReader&) = delete;
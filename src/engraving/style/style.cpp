@@ -22,6 +22,8 @@
 
 #include "style.h"
 
+#include <atomic>
+
 #include "compat/pageformat.h"
 #include "rw/compat/readchordlisthook.h"
 #include "rw/xml.h"
@@ -37,6 +39,13 @@ using namespace mu;
 using namespace mu::io;
 using namespace mu::engraving;
 
+static std::atomic<uint64_t> s_lastRevision { 0 };
+
+MStyle::MStyle()
+{
+    precomputeValues();
+}
+
 const PropertyValue& MStyle::value(Sid idx) const
 {
     if (idx == Sid::NOSTYLE) {
@@ -72,10 +81,8 @@ void MStyle::set(const Sid t, const PropertyValue& val)
     if (t == Sid::spatium) {
         precomputeValues();
     } else {
-        if (StyleDef::styleValues[idx].valueType() == P_TYPE::SPATIUM) {
-            double _spatium = value(Sid::spatium).toReal();
-            m_precomputedValues[idx] = m_values[idx].value<Spatium>().val() * _spatium;
-        }
+        precomputeValue(t, value(Sid::spatium).toReal());
+        updateRevision();
     }
 }
 
@@ -83,12 +90,47 @@ void MStyle::precomputeValues()
 {
     double _spatium = value(Sid::spatium).toReal();
     for (const StyleDef::StyleValue& t : StyleDef::styleValues) {
-        if (t.valueType() == P_TYPE::SPATIUM) {
-            m_precomputedValues[t.idx()] = value(t.styleIdx()).value<Spatium>().val() * _spatium;
+        precomputeValue(t.styleIdx(), _spatium);
+    }
+    updateRevision();
+}
+
+void MStyle::precomputeValue(Sid idx, double spatium)
+{
+    const size_t i = size_t(idx);
+    const PropertyValue& val = value(idx);
+
+    m_realValues[i] = 0.0;
+    m_intValues[i] = 0;
+
+    switch (val.type()) {
+    case P_TYPE::BOOL:
+    case P_TYPE::INT:
+    case P_TYPE::SIZE_T:
+        m_intValues[i] = val.toInt();
+        break;
+    case P_TYPE::REAL:
+    case P_TYPE::SPATIUM:
+    case P_TYPE::MILLIMETRE:
+        m_realValues[i] = val.toReal();
+        break;
+    default:
+        if (val.isEnum()) {
+            m_intValues[i] = val.toInt();
         }
+        break;
+    }
+
+    if (StyleDef::styleValues[i].valueType() == P_TYPE::SPATIUM) {
+        m_precomputedValues[i] = val.value<Spatium>().val() * spatium;
     }
 }
 
+void MStyle::updateRevision()
+{
+    m_revision = ++s_lastRevision;
+}
+
 bool MStyle::isDefault(Sid idx) const
 {
     return value(idx) == DefaultStyle::resolveStyleDefaults(defaultStyleVersion()).value(idx);
@@ -104,82 +146,109 @@ int MStyle::defaultStyleVersion() const
     return styleI(Sid::defaultsVersion);
 }
 
+//---------------------------------------------------------
+//   styleNameTokens
+//    the token of a style name is its Sid,
+//    so a tag is looked up once instead of compared with every style name
+//---------------------------------------------------------
+
+static const XmlStreamReader::TokenTable& styleNameTokens()
+{
+    static const XmlStreamReader::TokenTable table = []() {
+        XmlStreamReader::TokenTable t;
+        for (int i = 0; i < int(Sid::STYLES); ++i) {
+            AsciiStringView name(MStyle::valueName(Sid(i)));
+            if (t.token(name) == XmlStreamReader::TokenTable::NoToken) {
+                t.add(name, i);
+            }
+        }
+        return t;
+    }();
+    return table;
+}
+
+static Sid styleIdxByName(const AsciiStringView& name)
+{
+    int token = styleNameTokens().token(name);
+    return token != XmlStreamReader::TokenTable::NoToken ? static_cast<Sid>(token) : Sid::NOSTYLE;
+}
+
 bool MStyle::readProperties(XmlReader& e)
 {
-    const AsciiStringView tag(e.name());
+    const Sid sid = styleIdxByName(e.name());
 
-    for (const StyleDef::StyleValue& t : StyleDef::styleValues) {
+    if (sid != Sid::NOSTYLE) {
+        const StyleDef::StyleValue& t = StyleDef::styleValues[size_t(sid)];
         Sid idx = t.styleIdx();
-        if (t.name() == tag) {
-            P_TYPE type = t.valueType();
-            switch (type) {
-            case P_TYPE::SPATIUM:
-                set(idx, Spatium(e.readDouble()));
-                break;
-            case P_TYPE::REAL:
-                set(idx, e.readDouble());
-                break;
-            case P_TYPE::BOOL:
-                set(idx, bool(e.readInt()));
-                break;
-            case P_TYPE::INT:
-                set(idx, e.readInt());
-                break;
-            case P_TYPE::DIRECTION_V:
-                set(idx, DirectionV(e.readInt()));
-                break;
-            case P_TYPE::STRING:
-                set(idx, e.readText());
-                break;
-            case P_TYPE::ALIGN: {
-                Align align = TConv::fromXml(e.readText(), Align());
-                set(idx, align);
-            } break;
-            case P_TYPE::POINT: {
-                double x = e.doubleAttribute("x", 0.0);
-                double y = e.doubleAttribute("y", 0.0);
-                set(idx, PointF(x, y));
-                e.readText();
-            } break;
-            case P_TYPE::SIZE: {
-                double x = e.doubleAttribute("w", 0.0);
-                double y = e.doubleAttribute("h", 0.0);
-                set(idx, SizeF(x, y));
-                e.readText();
-            } break;
-            case P_TYPE::SCALE: {
-                double sx = e.doubleAttribute("w", 0.0);
-                double sy = e.doubleAttribute("h", 0.0);
-                set(idx, ScaleF(sx, sy));
-                e.readText();
-            } break;
-            case P_TYPE::COLOR: {
-                mu::draw::Color c;
-                c.setRed(e.intAttribute("r"));
-                c.setGreen(e.intAttribute("g"));
-                c.setBlue(e.intAttribute("b"));
-                c.setAlpha(e.intAttribute("a", 255));
-                set(idx, c);
-                e.readText();
-            } break;
-            case P_TYPE::PLACEMENT_V:
-                set(idx, PlacementV(e.readText().toInt()));
-                break;
-            case P_TYPE::PLACEMENT_H:
-                set(idx, PlacementH(e.readText().toInt()));
-                break;
-            case P_TYPE::HOOK_TYPE:
-                set(idx, HookType(e.readText().toInt()));
-                break;
-            case P_TYPE::LINE_TYPE:
-                set(idx, TConv::fromXml(e.readAsciiText(), LineType::SOLID));
-                break;
-            default:
-                ASSERT_X(u"unhandled type " + String::number(int(type)));
-            }
-            return true;
+        P_TYPE type = t.valueType();
+        switch (type) {
+        case P_TYPE::SPATIUM:
+            set(idx, Spatium(e.readDouble()));
+            break;
+        case P_TYPE::REAL:
+            set(idx, e.readDouble());
+            break;
+        case P_TYPE::BOOL:
+            set(idx, bool(e.readInt()));
+            break;
+        case P_TYPE::INT:
+            set(idx, e.readInt());
+            break;
+        case P_TYPE::DIRECTION_V:
+            set(idx, DirectionV(e.readInt()));
+            break;
+        case P_TYPE::STRING:
+            set(idx, e.readText());
+            break;
+        case P_TYPE::ALIGN: {
+            Align align = TConv::fromXml(e.readText(), Align());
+            set(idx, align);
+        } break;
+        case P_TYPE::POINT: {
+            double x = e.doubleAttribute("x", 0.0);
+            double y = e.doubleAttribute("y", 0.0);
+            set(idx, PointF(x, y));
+            e.readText();
+        } break;
+        case P_TYPE::SIZE: {
+            double x = e.doubleAttribute("w", 0.0);
+            double y = e.doubleAttribute("h", 0.0);
+            set(idx, SizeF(x, y));
+            e.readText();
+        } break;
+        case P_TYPE::SCALE: {
+            double sx = e.doubleAttribute("w", 0.0);
+            double sy = e.doubleAttribute("h", 0.0);
+            set(idx, ScaleF(sx, sy));
+            e.readText();
+        } break;
+        case P_TYPE::COLOR: {
+            mu::draw::Color c;
+            c.setRed(e.intAttribute("r"));
+            c.setGreen(e.intAttribute("g"));
+            c.setBlue(e.intAttribute("b"));
+            c.setAlpha(e.intAttribute("a", 255));
+            set(idx, c);
+            e.readText();
+        } break;
+        case P_TYPE::PLACEMENT_V:
+            set(idx, PlacementV(e.readText().toInt()));
+            break;
+        case P_TYPE::PLACEMENT_H:
+            set(idx, PlacementH(e.readText().toInt()));
+            break;
+        case P_TYPE::HOOK_TYPE:
+            set(idx, HookType(e.readText().toInt()));
+            break;
+        case P_TYPE::LINE_TYPE:
+            set(idx, TConv::fromXml(e.readAsciiText(), LineType::SOLID));
+            break;
+        default:
+            ASSERT_X(u"unhandled type " + String::number(int(type)));
         }
+        return true;
     }
+
     if (readStyleValCompat(e)) {
         return true;
     }
@@ -420,10 +489,5 @@ const char* MStyle::valueName(const Sid i)
 Sid MStyle::styleIdx(const String& name)
 {
     ByteArray ba = name.toAscii();
-    for (const StyleDef::StyleValue& st : StyleDef::styleValues) {
-        if (st.name() == ba.constChar()) {
-            return st.styleIdx();
-        }
-    }
-    return Sid::NOSTYLE;
+    return styleIdxByName(AsciiStringView(ba.constChar()));
 }
@@ -25,6 +25,7 @@
 
 #include <array>
 #include <cassert>
+#include <cstdint>
 
 #include "io/iodevice.h"
 
@@ -47,24 +48,33 @@ class XmlWriter;
 class MStyle
 {
 public:
-    MStyle() = default;
+    MStyle();
 
     const PropertyValue& styleV(Sid idx) const { return value(idx); }
     Spatium styleS(Sid idx) const
     {
         assert(MStyle::valueType(idx) == P_TYPE::SPATIUM);
-        return value(idx).value<Spatium>();
+        return idx == Sid::NOSTYLE ? Spatium() : Spatium(m_realValues[size_t(idx)]);
     }
 
     Millimetre styleMM(Sid idx) const { assert(MStyle::valueType(idx) == P_TYPE::SPATIUM); return valueMM(idx); }
     String  styleSt(Sid idx) const { assert(MStyle::valueType(idx) == P_TYPE::STRING); return value(idx).value<String>(); }
-    bool     styleB(Sid idx) const { assert(MStyle::valueType(idx) == P_TYPE::BOOL); return value(idx).toBool(); }
-    double   styleD(Sid idx) const { assert(MStyle::valueType(idx) == P_TYPE::REAL); return value(idx).toReal(); }
-    int      styleI(Sid idx) const { /* can be int or enum, so no assert */ return value(idx).toInt(); }
+    bool     styleB(Sid idx) const { assert(MStyle::valueType(idx) == P_TYPE::BOOL); return valueI(idx) != 0; }
+    double   styleD(Sid idx) const { assert(MStyle::valueType(idx) == P_TYPE::REAL); return valueD(idx); }
+    int      styleI(Sid idx) const { /* can be int or enum, so no assert */ return valueI(idx); }
 
     const PropertyValue& value(Sid idx) const;
     Millimetre valueMM(Sid idx) const;
 
+    // typed snapshot of the values, updated on every change:
+    // real, spatium and millimetre values as double, bool, int and enum values as int
+    double valueD(Sid idx) const { return idx == Sid::NOSTYLE ? 0.0 : m_realValues[size_t(idx)]; }
+    int valueI(Sid idx) const { return idx == Sid::NOSTYLE ? 0 : m_intValues[size_t(idx)]; }
+
+    // changes on every modification, for caches depending on the style;
+    // revisions are unique across styles except for copies holding the same values
+    uint64_t revision() const { return m_revision; }
+
     void set(Sid idx, const PropertyValue& v);
 
     bool isDefault(Sid idx) const;
@@ -92,8 +102,14 @@ private:
     bool readStyleValCompat(XmlReader&);
     bool readTextStyleValCompat(XmlReader&);
 
+    void precomputeValue(Sid idx, double spatium);
+    void updateRevision();
+
     std::array<PropertyValue, size_t(Sid::STYLES)> m_values;
     std::array<Millimetre, size_t(Sid::STYLES)> m_precomputedValues;
+    std::array<double, size_t(Sid::STYLES)> m_realValues;
+    std::array<int, size_t(Sid::STYLES)> m_intValues;
+    uint64_t m_revision = 0;
 };
 } // namespace mu::engraving
 
@@ -0,0 +1,165 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "benchmark.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+#include <gtest/gtest.h>
+
+#include "log.h"
+
+using namespace mu::engraving::benchmark;
+
+//! NOTE A batch shorter than this is dominated by the clock resolution and the noise
+static constexpr std::chrono::milliseconds MIN_BATCH_TIME(50);
+static constexpr int BATCH_COUNT = 5;
+static constexpr uint64_t MAX_ITERATIONS = uint64_t(1) << 32;
+
+//! NOTE Bumped when the report layout changes, so the trend tooling can tell the reports apart
+static constexpr int REPORT_VERSION = 1;
+
+static std::string formatNs(double ns)
+{
+    char buf[64];
+    std::snprintf(buf, sizeof(buf), "%.3f", ns);
+    return buf;
+}
+
+static std::string jsonEscaped(const std::string& str)
+{
+    std::string result;
+    result.reserve(str.size());
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            result.push_back('\\');
+        }
+        result.push_back(c);
+    }
+    return result;
+}
+
+Benchmark* Benchmark::instance()
+{
+    static Benchmark b;
+    return &b;
+}
+
+const Result& Benchmark::run(const std::string& name, const Func& func)
+{
+    using clock = std::chrono::steady_clock;
+
+    auto measure = [&func](uint64_t iterations) {
+        auto start = clock::now();
+        func(iterations);
+        return std::chrono::duration<double, std::nano>(clock::now() - start).count();
+    };
+
+    //! NOTE Warm up the caches and find the batch size
+    uint64_t iterations = 1;
+    double elapsedNs = measure(iterations);
+    while (elapsedNs < std::chrono::duration<double, std::nano>(MIN_BATCH_TIME).count() && iterations < MAX_ITERATIONS) {
+        iterations *= 2;
+        elapsedNs = measure(iterations);
+    }
+
+    std::vector<double> samples;
+    for (int i = 0; i < BATCH_COUNT; ++i) {
+        samples.push_back(measure(iterations) / static_cast<double>(iterations));
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    Result result;
+    result.name = name;
+    result.iterations = iterations;
+    result.nsPerOp = samples[samples.size() / 2];
+    result.minNsPerOp = samples.front();
+    result.maxNsPerOp = samples.back();
+
+    LOGI() << name << ": " << formatNs(result.nsPerOp) << " ns/op (" << iterations << " iterations)";
+
+    m_results.push_back(std::move(result));
+    return m_results.back();
+}
+
+void Benchmark::writeJson(std::ostream& out) const
+{
+    //! NOTE Sorted by the name and with the fixed formatting, so the reports of different runs can be diffed
+    std::vector<const Result*> results;
+    for (const Result& r : m_results) {
+        results.push_back(&r);
+    }
+
+    std::sort(results.begin(), results.end(), [](const Result* f, const Result* s) {
+        return f->name < s->name;
+    });
+
+    out << "{\n";
+    out << "  \"version\": " << REPORT_VERSION << ",\n";
+    out << "  \"unit\": \"ns\",\n";
+    out << "  \"benchmarks\": [";
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        const Result* r = results[i];
+        out << (i == 0 ? "\n" : ",\n");
+        out << "    { \"name\": \"" << jsonEscaped(r->name) << "\""
+            << ", \"iterations\": " << r->iterations
+            << ", \"median\": " << formatNs(r->nsPerOp)
+            << ", \"min\": " << formatNs(r->minNsPerOp)
+            << ", \"max\": " << formatNs(r->maxNsPerOp)
+            << " }";
+    }
+
+    out << "\n  ]\n";
+    out << "}\n";
+}
+
+//---------------------------------------------------------
+//   ReportEnvironment
+//---------------------------------------------------------
+
+class ReportEnvironment : public ::testing::Environment
+{
+public:
+    void TearDown() override
+    {
+        const char* path = std::getenv("MU_BENCHMARK_OUTPUT");
+        if (!path || !path[0]) {
+            Benchmark::instance()->writeJson(std::cout);
+            return;
+        }
+
+        std::ofstream file(path);
+        if (!file) {
+            LOGE() << "failed to open the benchmark output: " << path;
+            return;
+        }
+
+        Benchmark::instance()->writeJson(file);
+    }
+};
+
+static ::testing::Environment* const s_reportEnvironment = ::testing::AddGlobalTestEnvironment(new ReportEnvironment());
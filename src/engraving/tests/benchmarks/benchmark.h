@@ -0,0 +1,76 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_ENGRAVING_BENCHMARK_H
+#define MU_ENGRAVING_BENCHMARK_H
+
+#include <string>
+#include <vector>
+#include <chrono>
+#include <functional>
+#include <ostream>
+
+namespace mu::engraving::benchmark {
+//---------------------------------------------------------
+//   Benchmark
+//    runs a function in batches until the batch takes long enough to be measured,
+//    takes the median of a few batches and keeps the result for the JSON report.
+//    The report is written on exit to the file from MU_BENCHMARK_OUTPUT, or to stdout
+//---------------------------------------------------------
+
+struct Result {
+    std::string name;
+    uint64_t iterations = 0;
+    double nsPerOp = 0.0;
+    double minNsPerOp = 0.0;
+    double maxNsPerOp = 0.0;
+};
+
+class Benchmark
+{
+public:
+    static Benchmark* instance();
+
+    //! NOTE The function is called with the number of the iterations to do
+    using Func = std::function<void (uint64_t)>;
+    const Result& run(const std::string& name, const Func& func);
+
+    void writeJson(std::ostream& out) const;
+
+private:
+    Benchmark() = default;
+
+    std::vector<Result> m_results;
+};
+
+template<typename T>
+inline void doNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile ("" : : "r,m" (value) : "memory");
+#else
+    static volatile const void* sink = nullptr;
+    sink = &value;
+#endif
+}
+}
+
+#endif // MU_ENGRAVING_BENCHMARK_H
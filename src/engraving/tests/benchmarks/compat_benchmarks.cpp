@@ -0,0 +1,83 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include "io/dir.h"
+#include "libmscore/masterscore.h"
+
+#include "utils/scorerw.h"
+
+#include "benchmark.h"
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace mu::engraving::benchmark;
+
+class Engraving_CompatBenchmarks : public ::testing::Test
+{
+public:
+    void benchmark(const String& dataDir);
+};
+
+//---------------------------------------------------------
+//   benchmark
+//    read (and lay out) all the old scores of the compat tests,
+//    the reference files are skipped
+//---------------------------------------------------------
+
+void Engraving_CompatBenchmarks::benchmark(const String& dataDir)
+{
+    RetVal<io::paths_t> files = io::Dir::scanFiles(ScoreRW::rootPath() + u"/" + dataDir, { "*.mscx" },
+                                                   io::ScanMode::FilesInCurrentDir);
+    ASSERT_TRUE(files.ret);
+
+    std::vector<String> paths;
+    for (const io::path_t& file : files.val) {
+        if (!file.toString().endsWith(u"-ref.mscx")) {
+            paths.push_back(file.toString());
+        }
+    }
+    ASSERT_FALSE(paths.empty());
+
+    bool allRead = true;
+    Benchmark::instance()->run(dataDir.toStdString() + " read", [&paths, &allRead](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; ++i) {
+            for (const String& path : paths) {
+                MasterScore* score = ScoreRW::readScore(path, true);
+                allRead = allRead && score;
+                delete score;
+            }
+        }
+    });
+
+    EXPECT_TRUE(allRead);
+}
+
+TEST_F(Engraving_CompatBenchmarks, compat114)
+{
+    benchmark(u"compat114_data");
+}
+
+TEST_F(Engraving_CompatBenchmarks, compat206)
+{
+    benchmark(u"compat206_data");
+}
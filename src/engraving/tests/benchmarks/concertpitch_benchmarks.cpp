@@ -0,0 +1,65 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include "libmscore/masterscore.h"
+#include "libmscore/undo.h"
+
+#include "utils/scorerw.h"
+
+#include "benchmark.h"
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace mu::engraving::benchmark;
+
+static const String CONCERTPITCH_DATA_DIR("concertpitch_data/");
+
+class Engraving_ConcertPitchBenchmarks : public ::testing::Test
+{
+};
+
+//---------------------------------------------------------
+//   toggleAndUndo
+//    toggle concert pitch and undo it
+//---------------------------------------------------------
+
+TEST_F(Engraving_ConcertPitchBenchmarks, toggleAndUndo)
+{
+    MasterScore* score = ScoreRW::readScore(CONCERTPITCH_DATA_DIR + "concertpitchbenchmark.mscx");
+    ASSERT_TRUE(score);
+
+    const bool concertPitch = score->styleB(Sid::concertPitch);
+
+    Benchmark::instance()->run("Score::cmdConcertPitchChanged", [score, concertPitch](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; ++i) {
+            score->startCmd();
+            score->cmdConcertPitchChanged(!concertPitch);
+            score->endCmd();
+            score->undoRedo(true, 0);
+        }
+    });
+
+    EXPECT_EQ(score->styleB(Sid::concertPitch), concertPitch);
+
+    delete score;
+}
@@ -0,0 +1,89 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2023 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include "libmscore/chordrest.h"
+#include "libmscore/factory.h"
+#include "libmscore/lyrics.h"
+#include "libmscore/masterscore.h"
+#include "libmscore/measure.h"
+#include "libmscore/segment.h"
+
+#include "utils/scorerw.h"
+
+#include "benchmark.h"
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace mu::engraving::benchmark;
+
+static const String LYRICS_SCORE_PATH(u"all_elements_data/moonlight.mscx");
+
+class Engraving_LyricsBenchmarks : public ::testing::Test
+{
+protected:
+    //! NOTE A syllable for each verse on every chord of the upper staff, as a hymn has them
+    static void addVerses(Score* score, int verseCount)
+    {
+        for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+            for (Segment* s = m->first(SegmentType::ChordRest); s; s = s->next(SegmentType::ChordRest)) {
+                EngravingItem* e = s->element(0);
+                if (!e || !e->isChord()) {
+                    continue;
+                }
+
+                ChordRest* cr = toChordRest(e);
+                for (int verse = 0; verse < verseCount; ++verse) {
+                    Lyrics* lyrics = Factory::createLyrics(cr);
+                    lyrics->setTrack(cr->track());
+                    lyrics->setNo(verse);
+                    lyrics->setPlainText(u"la");
+                    cr->add(lyrics);
+                }
+            }
+        }
+    }
+};
+
+//---------------------------------------------------------
+//   layout
+//    the layout of the whole score with one and with six verses
+//---------------------------------------------------------
+
+TEST_F(Engraving_LyricsBenchmarks, layout)
+{
+    for (int verseCount : { 1, 6 }) {
+        MasterScore* score = ScoreRW::readScore(LYRICS_SCORE_PATH);
+        ASSERT_TRUE(score);
+
+        addVerses(score, verseCount);
+
+        std::string name = "Score::doLayout(" + std::to_string(verseCount) + (verseCount == 1 ? " verse)" : " verses)");
+        Benchmark::instance()->run(name, [score](uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; ++i) {
+                score->doLayout();
+            }
+        });
+
+        delete score;
+    }
+}
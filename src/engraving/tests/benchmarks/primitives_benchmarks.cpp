@@ -0,0 +1,373 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "io/file.h"
+#include "rw/xmlreader.h"
+
+#include "layout/measurewidthcache.h"
+#include "libmscore/factory.h"
+#include "libmscore/masterscore.h"
+#include "libmscore/measure.h"
+#include "libmscore/segment.h"
+#include "libmscore/shape.h"
+#include "libmscore/skyline.h"
+#include "libmscore/slur.h"
+#include "libmscore/spannermap.h"
+#include "libmscore/system.h"
+#include "libmscore/tempo.h"
+#include "style/style.h"
+#include "types/constants.h"
+#include "types/propertyvalue.h"
+
+#include "utils/scorerw.h"
+
+#include "benchmark.h"
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace mu::engraving::benchmark;
+
+static const String SCORE_PATH(u"all_elements_data/goldberg.mscx");
+
+//! NOTE The same queries on every run, so the results of the runs are comparable
+static constexpr unsigned int RANDOM_SEED = 20221014;
+static constexpr size_t QUERY_COUNT = 4096;
+
+class Engraving_PrimitivesBenchmarks : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite()
+    {
+        s_score = ScoreRW::readScore(SCORE_PATH);
+    }
+
+    static void TearDownTestSuite()
+    {
+        delete s_score;
+        s_score = nullptr;
+    }
+
+protected:
+    static std::vector<int> randomTicks(int maxTick)
+    {
+        std::mt19937 gen(RANDOM_SEED);
+        std::uniform_int_distribution<int> dist(0, std::max(maxTick - 1, 0));
+
+        std::vector<int> ticks(QUERY_COUNT);
+        for (int& t : ticks) {
+            t = dist(gen);
+        }
+        return ticks;
+    }
+
+    static MasterScore* s_score;
+};
+
+MasterScore* Engraving_PrimitivesBenchmarks::s_score = nullptr;
+
+TEST_F(Engraving_PrimitivesBenchmarks, Shape_minHorizontalDistance)
+{
+    ASSERT_TRUE(s_score);
+
+    //! NOTE The neighbour segments of the first staff, as the horizontal spacing compares them
+    std::vector<std::pair<const Shape*, const Shape*> > pairs;
+    for (Measure* m = s_score->firstMeasure(); m; m = m->nextMeasure()) {
+        for (Segment* s = m->first(); s && s->next(); s = s->next()) {
+            pairs.push_back({ &s->staffShape(0), &s->next()->staffShape(0) });
+        }
+    }
+    ASSERT_FALSE(pairs.empty());
+
+    Benchmark::instance()->run("Shape::minHorizontalDistance", [&pairs](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; ++i) {
+            const auto& pair = pairs[i % pairs.size()];
+            double d = pair.first->minHorizontalDistance(*pair.second, s_score);
+            doNotOptimize(d);
+        }
+    });
+}
+
+TEST_F(Engraving_PrimitivesBenchmarks, Shape_minHorizontalDistance_denseScores)
+{
+    //! NOTE Dense piano chords and a drum set: most pairs of elements of the neighbour shapes are vertically apart
+    for (const String& path : { String(u"all_elements_data/moonlight.mscx"), String(u"compat206_data/drumset.mscx") }) {
+        MasterScore* score = ScoreRW::readScore(path);
+        ASSERT_TRUE(score);
+
+        std::vector<std::pair<const Shape*, const Shape*> > pairs;
+        for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+            for (Segment* s = m->first(); s && s->next(); s = s->next()) {
+                for (staff_idx_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+                    pairs.push_back({ &s->staffShape(staffIdx), &s->next()->staffShape(staffIdx) });
+                }
+            }
+        }
+        ASSERT_FALSE(pairs.empty());
+
+        Benchmark::instance()->run("Shape::minHorizontalDistance(" + path.toStdString() + ")",
+                                   [&pairs, score](uint64_t iterations) {
+            for (uint64_t i = 0; i < iterations; ++i) {
+                const auto& pair = pairs[i % pairs.size()];
+                double d = pair.first->minHorizontalDistance(*pair.second, score);
+                doNotOptimize(d);
+            }
+        });
+
+        delete score;
+    }
+}
+
+TEST_F(Engraving_PrimitivesBenchmarks, Skyline_minDistance)
+{
+    ASSERT_TRUE(s_score);
+
+    std::vector<std::pair<const Skyline*, const Skyline*> > pairs;
+    for (const System* system : s_score->systems()) {
+        for (staff_idx_t idx = 0; idx + 1 < system->staves().size(); ++idx) {
+            pairs.push_back({ &system->staff(idx)->skyline(), &system->staff(idx + 1)->skyline() });
+        }
+    }
+    ASSERT_FALSE(pairs.empty());
+
+    Benchmark::instance()->run("Skyline::minDistance", [&pairs](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; ++i) {
+            const auto& pair = pairs[i % pairs.size()];
+            double d = pair.first->minDistance(*pair.second);
+            doNotOptimize(d);
+        }
+    });
+}
+
+TEST_F(Engraving_PrimitivesBenchmarks, MeasureWidthCache_computeWidth)
+{
+    ASSERT_TRUE(s_score);
+
+    std::vector<Measure*> measures;
+    for (Measure* m = s_score->firstMeasure(); m; m = m->nextMeasure()) {
+        if (m->system()) {
+            measures.push_back(m);
+        }
+    }
+    ASSERT_FALSE(measures.empty());
+
+    Benchmark::instance()->run("Measure::computeWidth", [&measures](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; ++i) {
+            Measure* m = measures[i % measures.size()];
+            m->computeWidth(m->system()->minSysTicks(), m->system()->maxSysTicks(), 1.0);
+            doNotOptimize(m->width());
+        }
+    });
+
+    //! NOTE Every measure is in the cache, so this is the cost of the fingerprint, the lookup and restoring the result
+    MeasureWidthCache cache;
+    cache.checkStyle(s_score);
+    for (Measure* m : measures) {
+        cache.computeWidth(m, m->system()->minSysTicks(), m->system()->maxSysTicks(), 1.0);
+    }
+
+    Benchmark::instance()->run("MeasureWidthCache::computeWidth(hit)", [&measures, &cache](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; ++i) {
+            Measure* m = measures[i % measures.size()];
+            cache.computeWidth(m, m->system()->minSysTicks(), m->system()->maxSysTicks(), 1.0);
+            doNotOptimize(m->width());
+        }
+    });
+
+    EXPECT_GT(cache.stats().hits, 0);
+}
+
+TEST_F(Engraving_PrimitivesBenchmarks, SpannerMap_findOverlapping)
+{
+    ASSERT_TRUE(s_score);
+
+    //! NOTE A map of its own, with many more spanners than the score has, of the lengths from a beat to a few measures
+    static constexpr int SPANNER_COUNT = 2000;
+    static constexpr int MAX_TICK = SPANNER_COUNT * Constants::division;
+
+    std::mt19937 gen(RANDOM_SEED);
+    std::uniform_int_distribution<int> startDist(0, MAX_TICK);
+    std::uniform_int_distribution<int> lengthDist(Constants::division, Constants::division * 16);
+
+    std::vector<Slur*> slurs;
+    SpannerMap map;
+    for (int i = 0; i < SPANNER_COUNT; ++i) {
+        Slur* slur = Factory::createSlur(s_score->dummy(), false);
+        slur->setTick(Fraction::fromTicks(startDist(gen)));
+        slur->setTicks(Fraction::fromTicks(lengthDist(gen)));
+        map.addSpanner(slur);
+        slurs.push_back(slur);
+    }
+
+    std::vector<int> ticks = randomTicks(MAX_TICK);
+
+    Benchmark::instance()->run("SpannerMap::findOverlapping", [&map, &ticks](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; ++i) {
+            int tick = ticks[i % ticks.size()];
+            const SpannerMap::IntervalList& list = map.findOverlapping(tick, tick + Constants::division * 4);
+            doNotOptimize(list.size());
+        }
+    });
+
+    map.clear();
+    for (Slur* slur : slurs) {
+        delete slur;
+    }
+}
+
+TEST_F(Engraving_PrimitivesBenchmarks, TempoMap_tick2time)
+{
+    static constexpr int TEMPO_COUNT = 500;
+
+    TempoMap tempoMap;
+    for (int i = 0; i < TEMPO_COUNT; ++i) {
+        tempoMap.setTempo(i * Constants::division * 4, BeatsPerSecond(1.0 + (i % 7) * 0.25));
+    }
+
+    std::vector<int> ticks = randomTicks(TEMPO_COUNT * Constants::division * 4);
+
+    Benchmark::instance()->run("TempoMap::tick2time", [&tempoMap, &ticks](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; ++i) {
+            double time = tempoMap.tick2time(ticks[i % ticks.size()]);
+            doNotOptimize(time);
+        }
+    });
+}
+
+TEST_F(Engraving_PrimitivesBenchmarks, Score_tick2segment)
+{
+    ASSERT_TRUE(s_score);
+
+    std::vector<int> ticks = randomTicks(s_score->endTick().ticks());
+
+    Benchmark::instance()->run("Score::tick2segment", [&ticks](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; ++i) {
+            Segment* segment = s_score->tick2segment(Fraction::fromTicks(ticks[i % ticks.size()]));
+            doNotOptimize(segment);
+        }
+    });
+}
+
+TEST_F(Engraving_PrimitivesBenchmarks, Score_tick2measure)
+{
+    //! NOTE A score of its own, long enough for the lookups to matter
+    static constexpr size_t MEASURE_COUNT = 2000;
+
+    MasterScore* score = ScoreRW::readScore(u"all_elements_data/moonlight.mscx");
+    ASSERT_TRUE(score);
+
+    score->startCmd();
+    score->appendMeasures(static_cast<int>(MEASURE_COUNT - score->nmeasures()));
+    score->endCmd();
+    ASSERT_EQ(score->nmeasures(), MEASURE_COUNT);
+
+    std::vector<int> ticks = randomTicks(score->endTick().ticks());
+
+    Benchmark::instance()->run("Score::tick2measure", [score, &ticks](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; ++i) {
+            Measure* m = score->tick2measure(Fraction::fromTicks(ticks[i % ticks.size()]));
+            doNotOptimize(m);
+        }
+    });
+
+    Benchmark::instance()->run("Score::tick2measureMM", [score, &ticks](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; ++i) {
+            Measure* m = score->tick2measureMM(Fraction::fromTicks(ticks[i % ticks.size()]));
+            doNotOptimize(m);
+        }
+    });
+
+    delete score;
+}
+
+TEST_F(Engraving_PrimitivesBenchmarks, PropertyValue_construction)
+{
+    Benchmark::instance()->run("PropertyValue(double)", [](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; ++i) {
+            PropertyValue v(static_cast<double>(i));
+            doNotOptimize(v);
+        }
+    });
+
+    Benchmark::instance()->run("PropertyValue(PointF)", [](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; ++i) {
+            PropertyValue v(PointF(static_cast<double>(i), 1.0));
+            doNotOptimize(v);
+        }
+    });
+
+    const String text(u"Allegro ma non troppo");
+    Benchmark::instance()->run("PropertyValue(String)", [&text](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; ++i) {
+            PropertyValue v(text);
+            doNotOptimize(v);
+        }
+    });
+
+    const PropertyValue source(text);
+    Benchmark::instance()->run("PropertyValue(const PropertyValue&)", [&source](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; ++i) {
+            PropertyValue v(source);
+            doNotOptimize(v);
+        }
+    });
+}
+
+TEST_F(Engraving_PrimitivesBenchmarks, MStyle_value)
+{
+    ASSERT_TRUE(s_score);
+
+    const MStyle& style = s_score->style();
+    const size_t count = static_cast<size_t>(Sid::STYLES);
+
+    Benchmark::instance()->run("MStyle::value", [&style, count](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; ++i) {
+            const PropertyValue& v = style.value(static_cast<Sid>(i % count));
+            doNotOptimize(v);
+        }
+    });
+}
+
+TEST_F(Engraving_PrimitivesBenchmarks, XmlReader_tokenize)
+{
+    ByteArray data;
+    Ret ret = io::File::readFile(ScoreRW::rootPath() + u"/" + SCORE_PATH, data);
+    ASSERT_TRUE(ret);
+
+    //! NOTE One op is the whole score, the size is in the name so the numbers stay comparable if the file changes
+    std::string name = "XmlReader::readNext(" + std::to_string(data.size() / 1024) + " KB)";
+
+    Benchmark::instance()->run(name, [&data](uint64_t iterations) {
+        for (uint64_t i = 0; i < iterations; ++i) {
+            XmlReader xml(data);
+            size_t tokens = 0;
+            while (!xml.atEnd()) {
+                xml.readNext();
+                ++tokens;
+            }
+            doNotOptimize(tokens);
+        }
+    });
+}
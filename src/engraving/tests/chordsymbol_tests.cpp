@@ -29,6 +29,7 @@
 #include "libmscore/masterscore.h"
 #include "libmscore/measure.h"
 #include "libmscore/part.h"
+#include "libmscore/realizedharmony.h"
 #include "libmscore/segment.h"
 
 #include "utils/scorerw.h"
@@ -216,6 +217,53 @@ TEST_F(Engraving_ChordSymbolTests, testTransposePart)
     test_post(score, u"transpose-part");
 }
 
+//---------------------------------------------------------
+//   check that the realized voicings are reused and
+//   regenerated when something they depend on changes
+//---------------------------------------------------------
+TEST_F(Engraving_ChordSymbolTests, testRealizeCache)
+{
+    MasterScore* score = test_pre(u"realize");
+    Harmony* harmony = nullptr;
+    for (Segment* seg = score->firstSegment(SegmentType::ChordRest); seg && !harmony; seg = seg->next1()) {
+        EngravingItem* e = seg->findAnnotation(ElementType::HARMONY, 0, score->ntracks());
+        harmony = e ? toHarmony(e) : nullptr;
+    }
+    ASSERT_TRUE(harmony);
+
+    const int root = harmony->rootTpc();
+    const int bass = harmony->baseTpc();
+    RealizedHarmony& realized = harmony->realizedHarmony();
+
+    realized.setVoicing(Voicing::CLOSE);
+    EXPECT_FALSE(realized.valid());
+    realized.update(root, bass);
+    ASSERT_TRUE(realized.valid());
+    const RealizedHarmony::PitchMap close = realized.notes();
+
+    realized.setVoicing(Voicing::ROOT_ONLY);
+    EXPECT_FALSE(realized.valid());
+    realized.update(root, bass);
+    EXPECT_NE(realized.notes(), close);
+
+    //the cached voicing is the same as a new one
+    realized.setVoicing(Voicing::CLOSE);
+    realized.update(root, bass);
+    EXPECT_EQ(realized.notes(), close);
+    EXPECT_EQ(realized.generateNotes(root, bass, realized.literal(), Voicing::CLOSE, 0), close);
+
+    realized.setDuration(realized.duration() == HDuration::SEGMENT_DURATION
+                         ? HDuration::UNTIL_NEXT_CHORD_SYMBOL : HDuration::SEGMENT_DURATION);
+    EXPECT_FALSE(realized.valid());
+
+    //another transposition is realized again, without the dirty flag
+    realized.update(root, bass);
+    realized.update(root, bass, 2);
+    EXPECT_NE(realized.notes(), close);
+
+    delete score;
+}
+
 //---------------------------------------------------------
 //   check close voicing algorithm
 //---------------------------------------------------------
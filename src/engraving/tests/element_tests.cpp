@@ -104,3 +104,30 @@ TEST_F(Engraving_ElementTests, DISABLED_testIds)
         delete ee;
     }
 }
+
+TEST_F(Engraving_ElementTests, itemByEid)
+{
+    MasterScore* score = compat::ScoreAccess::createMasterScore();
+    MasterScore* otherScore = compat::ScoreAccess::createMasterScore();
+
+    EngravingItem* e = Factory::createItem(ElementType::STAFF_TEXT, score->dummy());
+
+    // the id is stable and the item is found by it
+    eid_t eid = e->eid();
+    EXPECT_NE(eid, 0);
+    EXPECT_EQ(e->eid(), eid);
+    EXPECT_EQ(score->itemByEid(eid), e);
+    EXPECT_EQ(otherScore->itemByEid(eid), nullptr);
+
+    // a clone gets its own id
+    EngravingItem* clone = e->clone();
+    EXPECT_NE(clone->eid(), eid);
+
+    // the deleted item isn't found anymore
+    delete e;
+    EXPECT_EQ(score->itemByEid(eid), nullptr);
+
+    delete clone;
+    delete otherScore;
+    delete score;
+}
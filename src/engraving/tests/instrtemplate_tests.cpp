@@ -0,0 +1,56 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "libmscore/instrtemplate.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+class Engraving_InstrTemplateTests : public ::testing::Test
+{
+};
+
+//---------------------------------------------------------
+//   initInheritsBaseTemplate
+//    a template with <init> gets the data of the template
+//    read before it (see the environment, which loads
+//    instruments.xml)
+//---------------------------------------------------------
+
+TEST_F(Engraving_InstrTemplateTests, initInheritsBaseTemplate)
+{
+    const InstrumentTemplate* base = searchTemplate(u"cavaquinho");
+    ASSERT_TRUE(base);
+
+    const InstrumentTemplate* variant = searchTemplate(u"cavaquinho-tablature");
+    ASSERT_TRUE(variant);
+    EXPECT_NE(variant, base);
+
+    EXPECT_EQ(variant->id, u"cavaquinho-tablature");
+    EXPECT_EQ(variant->stringData.strings(), 4u);
+    EXPECT_EQ(variant->stringData.strings(), base->stringData.strings());
+    EXPECT_EQ(variant->minPitchA, base->minPitchA);
+    EXPECT_EQ(variant->shortNames.size(), base->shortNames.size());
+    EXPECT_EQ(variant->staffGroup, StaffGroup::TAB);
+}
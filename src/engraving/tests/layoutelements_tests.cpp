@@ -26,8 +26,11 @@
 #include "libmscore/measure.h"
 #include "libmscore/page.h"
 #include "libmscore/rest.h"
+#include "libmscore/segment.h"
+#include "libmscore/slur.h"
 #include "libmscore/staff.h"
 #include "libmscore/system.h"
+#include "libmscore/tie.h"
 #include "libmscore/tuplet.h"
 #include "libmscore/chord.h"
 #include "libmscore/note.h"
@@ -152,3 +155,104 @@ TEST_F(Engraving_LayoutElementsTests, tstLayoutCrossStaffArp)
 
     delete score;
 }
+
+//---------------------------------------------------------
+//   slurSegmentPositions
+//    The page positions of all segments of the cross-staff
+//    slurs, in score order
+//---------------------------------------------------------
+
+static std::vector<PointF> slurSegmentPositions(const Score* score)
+{
+    std::vector<PointF> result;
+    for (const auto& pair : score->spanner()) {
+        Spanner* sp = pair.second;
+        if (!sp->isSlur() || !toSlur(sp)->isCrossStaff()) {
+            continue;
+        }
+        for (const SpannerSegment* seg : sp->spannerSegments()) {
+            result.push_back(seg->pagePos());
+            result.push_back(toSlurSegment(seg)->ups(Grip::START).p);
+            result.push_back(toSlurSegment(seg)->ups(Grip::END).p);
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------
+//   tstPipelinedPageLayoutCrossStaffSlurs
+//    The pages finished concurrently on full layout lay out
+//    the cross-staff slurs the same as the serial layout
+//---------------------------------------------------------
+
+TEST_F(Engraving_LayoutElementsTests, tstPipelinedPageLayoutCrossStaffSlurs)
+{
+    MasterScore* score = ScoreRW::readScore(ALL_ELEMENTS_DATA_DIR + "moonlight.mscx");
+    ASSERT_TRUE(score);
+    ASSERT_GT(score->npages(), 1u);
+
+    score->setPipelinedPageLayout(false);
+    score->doLayout();
+    std::vector<PointF> serial = slurSegmentPositions(score);
+    ASSERT_FALSE(serial.empty());
+
+    score->setPipelinedPageLayout(true);
+    for (int i = 0; i < 5; ++i) {
+        score->doLayout();
+        EXPECT_EQ(slurSegmentPositions(score), serial);
+    }
+
+    delete score;
+}
+
+//---------------------------------------------------------
+//   tieSegmentShapes
+//    The bounding boxes and end points of all tie segments,
+//    in score order
+//---------------------------------------------------------
+
+static std::vector<RectF> tieSegmentShapes(const Score* score)
+{
+    std::vector<RectF> result;
+    for (Segment* s = score->firstSegment(SegmentType::ChordRest); s; s = s->next1(SegmentType::ChordRest)) {
+        for (EngravingItem* e : s->elist()) {
+            if (!e || !e->isChord()) {
+                continue;
+            }
+            for (const Note* note : toChord(e)->notes()) {
+                if (!note->tieFor()) {
+                    continue;
+                }
+                for (const SpannerSegment* seg : note->tieFor()->spannerSegments()) {
+                    const TieSegment* tieSeg = toTieSegment(seg);
+                    result.push_back(tieSeg->canvasBoundingRect());
+                    result.push_back(RectF(tieSeg->ups(Grip::START).p, tieSeg->ups(Grip::END).p));
+                }
+            }
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------
+//   tstRelayoutKeepsTies
+//    The bezier of a tie is kept when its inputs don't change,
+//    laying out again must not move the ties
+//---------------------------------------------------------
+
+TEST_F(Engraving_LayoutElementsTests, tstRelayoutKeepsTies)
+{
+    MasterScore* score = ScoreRW::readScore(ALL_ELEMENTS_DATA_DIR + "goldberg.mscx");
+    ASSERT_TRUE(score);
+
+    score->doLayout();
+    std::vector<RectF> first = tieSegmentShapes(score);
+    ASSERT_FALSE(first.empty());
+
+    for (int i = 0; i < 3; ++i) {
+        score->doLayout();
+        EXPECT_EQ(tieSegmentShapes(score), first);
+    }
+
+    delete score;
+}
@@ -0,0 +1,160 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "layout/measurewidthcache.h"
+#include "libmscore/masterscore.h"
+#include "libmscore/measure.h"
+#include "libmscore/segment.h"
+#include "libmscore/system.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String SCORE_PATH(u"all_elements_data/goldberg.mscx");
+
+class Engraving_MeasureWidthCacheTests : public ::testing::Test
+{
+public:
+    struct Spacing {
+        double width = 0.0;
+        std::vector<double> x;
+        std::vector<double> widths;
+        std::vector<double> stretches;
+    };
+
+    static Spacing spacing(const Measure* m)
+    {
+        Spacing result;
+        result.width = m->width();
+        for (const Segment* s = m->first(); s; s = s->next()) {
+            result.x.push_back(s->x());
+            result.widths.push_back(s->width());
+            result.stretches.push_back(s->stretch());
+        }
+        return result;
+    }
+
+    //! NOTE So that only a computation or a restored result gives the values back
+    static void resetSpacing(Measure* m)
+    {
+        m->setWidth(0.0);
+        for (Segment* s = m->first(); s; s = s->next()) {
+            s->setPosX(0.0);
+            s->setWidth(0.0);
+            s->setStretch(0.0);
+        }
+    }
+
+    //! NOTE EXPECT_EQ compares the double values exactly
+    static void compare(const Spacing& actual, const Spacing& expected)
+    {
+        EXPECT_EQ(actual.width, expected.width);
+        EXPECT_EQ(actual.x, expected.x);
+        EXPECT_EQ(actual.widths, expected.widths);
+        EXPECT_EQ(actual.stretches, expected.stretches);
+    }
+
+    static void computeWidth(MeasureWidthCache& cache, Measure* m)
+    {
+        cache.computeWidth(m, m->system()->minSysTicks(), m->system()->maxSysTicks(), 1.0);
+    }
+};
+
+//---------------------------------------------------------
+///   restoredWidths
+///   a hit gives the same spacing as Measure::computeWidth()
+//---------------------------------------------------------
+
+TEST_F(Engraving_MeasureWidthCacheTests, restoredWidths)
+{
+    MasterScore* score = ScoreRW::readScore(SCORE_PATH);
+    ASSERT_TRUE(score);
+
+    MeasureWidthCache cache;
+    cache.checkStyle(score);
+
+    size_t measures = 0;
+    for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+        if (!m->system()) {
+            continue;
+        }
+        ++measures;
+
+        m->computeWidth(m->system()->minSysTicks(), m->system()->maxSysTicks(), 1.0);
+        Spacing expected = spacing(m);
+
+        resetSpacing(m);
+        computeWidth(cache, m);
+        compare(spacing(m), expected);
+
+        resetSpacing(m);
+        computeWidth(cache, m);
+        compare(spacing(m), expected);
+    }
+
+    ASSERT_GT(measures, 0);
+
+    const MeasureWidthCache::Stats& stats = cache.stats();
+    EXPECT_EQ(stats.hits + stats.misses + stats.bypassed, measures * 2);
+    EXPECT_GT(stats.hits, 0);
+    //! NOTE Each measure is computed twice, the second time is a hit unless the measure bypassed the cache
+    EXPECT_LE(stats.misses, measures);
+    EXPECT_EQ(cache.entriesCount(), stats.misses);
+
+    delete score;
+}
+
+//---------------------------------------------------------
+///   styleChange
+///   the results are dropped when a spacing style changes
+//---------------------------------------------------------
+
+TEST_F(Engraving_MeasureWidthCacheTests, styleChange)
+{
+    MasterScore* score = ScoreRW::readScore(SCORE_PATH);
+    ASSERT_TRUE(score);
+
+    MeasureWidthCache cache;
+    cache.checkStyle(score);
+
+    for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+        if (m->system()) {
+            computeWidth(cache, m);
+        }
+    }
+    ASSERT_GT(cache.entriesCount(), 0);
+
+    cache.checkStyle(score);
+    EXPECT_GT(cache.entriesCount(), 0);
+
+    score->setStyleValue(Sid::minNoteDistance, score->styleV(Sid::minNoteDistance).value<Spatium>() * 2);
+    cache.checkStyle(score);
+    EXPECT_EQ(cache.entriesCount(), 0);
+
+    delete score;
+}
@@ -0,0 +1,109 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include "libmscore/chord.h"
+#include "libmscore/masterscore.h"
+#include "libmscore/memoryreport.h"
+#include "libmscore/segment.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String MEMORYREPORT_DATA_DIR("all_elements_data/");
+
+class Engraving_MemoryReportTests : public ::testing::Test
+{
+};
+
+//---------------------------------------------------------
+//   subsystems
+//    the elements of the score and the items held by the
+//    undo stack are reported
+//---------------------------------------------------------
+
+TEST_F(Engraving_MemoryReportTests, subsystems)
+{
+    MasterScore* score = ScoreRW::readScore(MEMORYREPORT_DATA_DIR + "goldberg.mscx");
+    ASSERT_TRUE(score);
+
+    MemoryReport before = MemoryReport::collect(score);
+    EXPECT_EQ(before.subsystems().at("elements").count, before.total().count);
+    EXPECT_GT(before.subsystems().at("elements").bytes, 0u);
+    EXPECT_TRUE(before.subsystems().count("undoStack"));
+    EXPECT_TRUE(before.subsystems().count("layoutCaches"));
+
+    Segment* segment = score->firstSegment(SegmentType::ChordRest);
+    ASSERT_TRUE(segment);
+    EngravingItem* chord = segment->element(0);
+    ASSERT_TRUE(chord && chord->isChord());
+
+    score->startCmd();
+    score->select(chord);
+    score->cmdDeleteSelection();
+    score->endCmd();
+
+    // the chord is replaced by a rest, the undo stack holds the removed chord
+    MemoryReport after = MemoryReport::collect(score);
+    EXPECT_LT(after.types().at(ElementType::CHORD).count, before.types().at(ElementType::CHORD).count);
+    EXPECT_GT(after.subsystems().at("undoStack").count, before.subsystems().at("undoStack").count);
+    EXPECT_GT(after.subsystems().at("undoStack").bytes,
+              before.subsystems().at("undoStack").bytes + MemoryReport::itemSize(ElementType::CHORD));
+
+    delete score;
+}
+
+//---------------------------------------------------------
+//   sources
+//    the registered sources are reported for their score
+//    until they are removed
+//---------------------------------------------------------
+
+TEST_F(Engraving_MemoryReportTests, sources)
+{
+    MasterScore* score = ScoreRW::readScore(MEMORYREPORT_DATA_DIR + "moonlight.mscx");
+    ASSERT_TRUE(score);
+
+    int owner = 0;
+    MemoryReport::addSource(&owner, score, "test", []() {
+        MemoryReport::Entry entry;
+        entry.count = 2;
+        entry.bytes = 100;
+        return entry;
+    });
+    MemoryReport::addSource(&owner, nullptr, "other", []() {
+        return MemoryReport::Entry();
+    });
+
+    MemoryReport report = MemoryReport::collect(score);
+    ASSERT_TRUE(report.subsystems().count("test"));
+    EXPECT_EQ(report.subsystems().at("test").count, 2u);
+    EXPECT_EQ(report.subsystems().at("test").bytes, 100u);
+    EXPECT_FALSE(report.subsystems().count("other"));
+
+    MemoryReport::removeSources(&owner);
+    EXPECT_FALSE(MemoryReport::collect(score).subsystems().count("test"));
+
+    delete score;
+}
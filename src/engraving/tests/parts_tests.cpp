@@ -40,6 +40,8 @@
 #include "libmscore/stafftype.h"
 #include "libmscore/undo.h"
 
+#include "layout/layoutcontext.h"
+
 #include "utils/scorerw.h"
 #include "utils/scorecomp.h"
 
@@ -1146,6 +1148,68 @@ TEST_F(Engraving_PartsTests, createPartStemless)
     testPartCreation(u"part-stemless");
 }
 
+//---------------------------------------------------------
+//   parallelExcerptsLayoutInCmd
+//    The excerpts laid out concurrently in a command get
+//    the same multimeasure rests as the serial layout, and
+//    the undo of the command removes them
+//---------------------------------------------------------
+
+static std::vector<std::pair<int, int> > mmRests(Score* score)
+{
+    std::vector<std::pair<int, int> > result;
+    for (Measure* m = score->firstMeasureMM(); m; m = m->nextMeasureMM()) {
+        result.push_back({ m->tick().ticks(), m->mmRestCount() });
+    }
+    return result;
+}
+
+TEST_F(Engraving_PartsTests, parallelExcerptsLayoutInCmd)
+{
+    MasterScore* score = ScoreRW::readScore(PARTS_DATA_DIR + u"part-empty.mscx");
+    ASSERT_TRUE(score);
+    createParts(score);
+
+    std::vector<Score*> scores { score };
+    for (Excerpt* ex : score->excerpts()) {
+        ex->excerptScore()->style().set(Sid::createMultiMeasureRests, true);
+        scores.push_back(ex->excerptScore());
+    }
+
+    score->setParallelExcerptsLayout(false);
+    score->startCmd();
+    EXPECT_EQ(score->doLayoutScoresRange(scores, Fraction(0, 1), Fraction(-1, 1)), 0u);
+    score->endCmd();
+
+    std::vector<std::vector<std::pair<int, int> > > serial;
+    for (Excerpt* ex : score->excerpts()) {
+        EXPECT_TRUE(ex->excerptScore()->firstMeasure()->mmRest());
+        serial.push_back(mmRests(ex->excerptScore()));
+    }
+    score->undoRedo(true, 0);
+
+    if (LayoutContext::workers()->threadPoolSize() < 2) {
+        delete score;
+        GTEST_SKIP() << "the excerpts are laid out concurrently with 2 layout workers at least";
+    }
+
+    score->setParallelExcerptsLayout(true);
+    score->startCmd();
+    EXPECT_EQ(score->doLayoutScoresRange(scores, Fraction(0, 1), Fraction(-1, 1)), score->excerpts().size());
+    score->endCmd();
+
+    for (size_t i = 0; i < score->excerpts().size(); ++i) {
+        EXPECT_EQ(mmRests(score->excerpts().at(i)->excerptScore()), serial.at(i));
+    }
+
+    score->undoRedo(true, 0);
+    for (Excerpt* ex : score->excerpts()) {
+        EXPECT_FALSE(ex->excerptScore()->firstMeasure()->mmRest());
+    }
+
+    delete score;
+}
+
 //---------------------------------------------------------
 //   staffStyles
 //---------------------------------------------------------
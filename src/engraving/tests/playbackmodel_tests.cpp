@@ -33,6 +33,8 @@
 #include "libmscore/part.h"
 #include "libmscore/measure.h"
 #include "libmscore/chord.h"
+#include "libmscore/note.h"
+#include "libmscore/segment.h"
 
 #include "playback/playbackmodel.h"
 
@@ -379,8 +381,8 @@ TEST_F(Engraving_PlaybackModelTests, Repeat_Last_Measure)
  * @details In this case we're building up a playback model of a simple score - Violin, 4/4, 120bpm, Treble Cleff, 4 measures
  *          Additionally, there is a simple repeat from measure 2 up to measure 3. In total, we'll be playing 6 measures overall
  *
- *          When the model will be loaded we'll emulate a change notification on the 2-nd measure, so that there will be updated events
- *          on the main stream channel
+ *          When the model will be loaded we'll change a note on the 2-nd measure and emulate a change notification,
+ *          so that there will be updated events on the main stream channel
  */
 TEST_F(Engraving_PlaybackModelTests, SimpleRepeat_Changes_Notification)
 {
@@ -408,11 +410,20 @@ TEST_F(Engraving_PlaybackModelTests, SimpleRepeat_Changes_Notification)
     PlaybackData result = model.resolveTrackPlaybackData(part->id(), part->instrumentId().toStdString());
 
     // [THEN] Updated events map will match our expectations
-    result.mainStream.onReceive(this, [expectedChangedEventsCount](const PlaybackEventsMap& updatedEvents) {
+    int receivedCount = 0;
+    result.mainStream.onReceive(this, [expectedChangedEventsCount, &receivedCount](const PlaybackEventsMap& updatedEvents) {
         EXPECT_EQ(updatedEvents.size(), expectedChangedEventsCount);
+        ++receivedCount;
     });
 
     // [WHEN] Notation has been changed on the 2-nd measure
+    Segment* segment = score->tick2segment(Fraction::fromTicks(1920), true, SegmentType::ChordRest);
+    ASSERT_TRUE(segment);
+    Chord* chord = toChord(segment->element(0));
+    ASSERT_TRUE(chord);
+    Note* note = chord->upNote();
+    note->setPitch(note->pitch() + 12);
+
     ScoreChangesRange range;
     range.tickFrom = 1920;
     range.tickTo = 3840;
@@ -421,6 +432,56 @@ TEST_F(Engraving_PlaybackModelTests, SimpleRepeat_Changes_Notification)
     range.changedTypes = { ElementType::NOTE };
 
     score->changesChannel().send(range);
+
+    // [THEN] The changed track has been resent once
+    EXPECT_EQ(receivedCount, 1);
+}
+
+/**
+ * @brief PlaybackModelTests_Unchanged_Events_Not_Resent
+ * @details In this case we're building up a playback model of a simple score with a repeat,
+ *          and emulate a change notification on the 2-nd measure with nothing changed actually,
+ *          so that the track events stay the same and must not be resent (resending flushes the sounding notes)
+ */
+TEST_F(Engraving_PlaybackModelTests, Unchanged_Events_Not_Resent)
+{
+    // [GIVEN] Simple piece of score (Violin, 4/4, 120 bpm, Treble Cleff)
+    Score* score = ScoreRW::readScore(PLAYBACK_MODEL_TEST_FILES_DIR + "repeat_range/repeat_range.mscx");
+
+    ASSERT_TRUE(score);
+    ASSERT_EQ(score->parts().size(), 1);
+
+    const Part* part = score->parts().at(0);
+
+    // [GIVEN] The articulation profiles repository will be returning profiles for StringsArticulation family
+    ON_CALL(*m_repositoryMock, defaultProfile(ArticulationFamily::Strings)).WillByDefault(Return(m_defaultProfile));
+
+    // [GIVEN] The playback model requested to be loaded
+    PlaybackModel model;
+    model.setprofilesRepository(m_repositoryMock);
+    model.load(score);
+
+    PlaybackData result = model.resolveTrackPlaybackData(part->id(), part->instrumentId().toStdString());
+    PlaybackEventsMap eventsBefore = result.originEvents;
+
+    bool received = false;
+    result.mainStream.onReceive(this, [&received](const PlaybackEventsMap&) {
+        received = true;
+    });
+
+    // [WHEN] A change notification on the 2-nd measure has been sent without an actual change
+    ScoreChangesRange range;
+    range.tickFrom = 1920;
+    range.tickTo = 3840;
+    range.staffIdxFrom = 0;
+    range.staffIdxTo = 0;
+    range.changedTypes = { ElementType::NOTE };
+
+    score->changesChannel().send(range);
+
+    // [THEN] The events are the same and haven't been resent
+    EXPECT_FALSE(received);
+    EXPECT_EQ(model.resolveTrackPlaybackData(part->id(), part->instrumentId().toStdString()).originEvents, eventsBefore);
 }
 
 /**
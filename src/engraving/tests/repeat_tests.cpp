@@ -39,6 +39,7 @@ class Engraving_RepeatTests : public ::testing::Test
 {
 public:
     void repeat(const char* path, const String& ref);
+    void compareWithFullUnwind(MasterScore* score);
 };
 
 void Engraving_RepeatTests::repeat(const char* path, const String& ref)
@@ -410,3 +411,89 @@ TEST_F(Engraving_RepeatTests, DISABLED_repeat67) {
     // Jump at skipped open volta end with end repeat at end of score: #327681
     repeat("repeat67.mscx", u"1;2; 1");
 }
+
+//---------------------------------------------------------
+//   compareWithFullUnwind
+//    the cached repeat list of the score must match a repeat
+//    list unwound from scratch, and so must its conversions
+//---------------------------------------------------------
+
+void Engraving_RepeatTests::compareWithFullUnwind(MasterScore* score)
+{
+    const RepeatList& cached = score->repeatList();
+    RepeatList full(score);
+    full.update(true);
+
+    ASSERT_EQ(cached.size(), full.size());
+    for (size_t i = 0; i < full.size(); ++i) {
+        EXPECT_EQ(cached.at(i)->tick, full.at(i)->tick);
+        EXPECT_EQ(cached.at(i)->utick, full.at(i)->utick);
+        EXPECT_EQ(cached.at(i)->len(), full.at(i)->len());
+        EXPECT_EQ(cached.at(i)->playbackCount, full.at(i)->playbackCount);
+        EXPECT_DOUBLE_EQ(cached.at(i)->pause, full.at(i)->pause);
+        EXPECT_EQ(cached.at(i)->measureList(), full.at(i)->measureList());
+    }
+
+    constexpr int step = Constants::division / 4;
+
+    for (int tick = 0; tick <= score->endTick().ticks(); tick += step) {
+        // first segment playing the tick, or the last one
+        int utick = full.back()->utick + (tick - full.back()->tick);
+        for (const RepeatSegment* rs : full) {
+            if (tick >= rs->tick && tick < rs->tick + rs->len()) {
+                utick = rs->utick + (tick - rs->tick);
+                break;
+            }
+        }
+        EXPECT_EQ(cached.tick2utick(tick), utick);
+    }
+
+    for (int utick = 0; utick < full.ticks(); utick += step) {
+        // last segment starting at or before the utick
+        const RepeatSegment* segment = full.front();
+        for (const RepeatSegment* rs : full) {
+            if (rs->utick <= utick) {
+                segment = rs;
+            }
+        }
+        EXPECT_EQ(cached.utick2tick(utick), utick - (segment->utick - segment->tick));
+        EXPECT_DOUBLE_EQ(cached.utick2utime(utick), full.utick2utime(utick));
+    }
+}
+
+TEST_F(Engraving_RepeatTests, incrementalUnwind)
+{
+    for (int i = 1; i <= 67; ++i) {
+        String path = REPEAT_DATA_DIR + String(u"repeat%1%2.mscx").arg(String(i < 10 ? u"0" : u""), String::number(i));
+        MasterScore* score = ScoreRW::readScore(path);
+        ASSERT_TRUE(score);
+
+        score->setExpandRepeats(true);
+        compareWithFullUnwind(score);
+
+        // nothing changed, all the sections are taken over
+        score->setPlaylistDirty();
+        compareWithFullUnwind(score);
+
+        // change the number of repeats of the last end repeat,
+        // then remove it, which only affects its own section
+        Measure* lastRepeatEnd = nullptr;
+        for (Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+            if (m->repeatEnd()) {
+                lastRepeatEnd = m;
+            }
+        }
+
+        if (lastRepeatEnd) {
+            lastRepeatEnd->setRepeatCount(lastRepeatEnd->repeatCount() + 1);
+            score->setPlaylistDirty();
+            compareWithFullUnwind(score);
+
+            lastRepeatEnd->setRepeatEnd(false);
+            score->setPlaylistDirty();
+            compareWithFullUnwind(score);
+        }
+
+        delete score;
+    }
+}
@@ -0,0 +1,330 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "libmscore/masterscore.h"
+#include "libmscore/measure.h"
+#include "libmscore/segment.h"
+#include "libmscore/shape.h"
+#include "libmscore/skyline.h"
+#include "libmscore/system.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+static const String SCORE_PATH(u"all_elements_data/goldberg.mscx");
+
+static constexpr unsigned int RANDOM_SEED = 20221014;
+static constexpr int RANDOM_LINE_COUNT = 20000;
+
+//---------------------------------------------------------
+//   ReferenceSkylineLine
+//    SkylineLine as it was with a vector of segments,
+//    the results of the current one must be the same
+//    to the last bit
+//---------------------------------------------------------
+
+class ReferenceSkylineLine
+{
+public:
+    explicit ReferenceSkylineLine(bool north)
+        : m_north(north) {}
+
+    const std::vector<SkylineSegment>& segments() const { return m_seg; }
+
+    void add(double x, double y, double w, int span)
+    {
+        if (x < 0.0) {
+            w -= -x;
+            x = 0.0;
+            if (w <= 0.0) {
+                return;
+            }
+        }
+
+        SegIter i = find(x);
+        double cx = m_seg.empty() ? 0.0 : i->x;
+        for (; i != m_seg.end(); ++i) {
+            double cy = i->y;
+            if ((x + w) <= cx) {
+                return;
+            }
+            if (x > (cx + i->w)) {
+                cx += i->w;
+                continue;
+            }
+            if ((m_north && (cy <= y)) || (!m_north && (cy >= y))) {
+                cx += i->w;
+                continue;
+            }
+            if ((x >= cx) && ((x + w) < (cx + i->w))) {
+                double w1 = x - cx;
+                double w2 = w;
+                double w3 = i->w - (w1 + w2);
+                if (w1 > 0.0000001) {
+                    i->w = w1;
+                    ++i;
+                    i = insert(i, x, y, w2, span);
+                } else {
+                    i->w = w2;
+                    i->y = y;
+                }
+                if (w3 > 0.0000001) {
+                    ++i;
+                    insert(i, x + w2, cy, w3, span);
+                }
+                return;
+            } else if ((x <= cx) && ((x + w) >= (cx + i->w))) {
+                i->y = y;
+            } else if (x < cx) {
+                double w1 = x + w - cx;
+                i->w -= w1;
+                insert(i, cx, y, w1, span);
+                return;
+            } else {
+                double w1 = x - cx;
+                double w2 = i->w - w1;
+                if (w2 > 0.0000001) {
+                    i->w = w1;
+                    cx += w1;
+                    ++i;
+                    i = insert(i, cx, y, w2, span);
+                }
+            }
+            cx += i->w;
+        }
+        if (x >= cx) {
+            if (x > cx) {
+                m_seg.emplace_back(cx, m_north ? MAXIMUM_Y : MINIMUM_Y, x - cx, span);
+            }
+            m_seg.emplace_back(x, y, w, span);
+        } else if (x + w > cx) {
+            m_seg.emplace_back(cx, y, x + w - cx, span);
+        }
+    }
+
+    double minDistance(const ReferenceSkylineLine& sl) const
+    {
+        double dist = MINIMUM_Y;
+
+        double x1 = 0.0;
+        double x2 = 0.0;
+        auto k = sl.m_seg.begin();
+        for (auto i = m_seg.begin(); i != m_seg.end(); ++i) {
+            if (i->staffSpan > 0) {
+                continue;
+            }
+            while (k != sl.m_seg.end() && (x2 + k->w) < x1) {
+                x2 += k->w;
+                ++k;
+            }
+            if (k == sl.m_seg.end()) {
+                break;
+            }
+            for (;;) {
+                if ((x1 + i->w > x2) && (x1 < x2 + k->w) && k->staffSpan >= 0) {
+                    dist = std::max(dist, i->y - k->y);
+                }
+                if (x2 + k->w < x1 + i->w) {
+                    x2 += k->w;
+                    ++k;
+                    if (k == sl.m_seg.end()) {
+                        break;
+                    }
+                } else {
+                    break;
+                }
+            }
+            if (k == sl.m_seg.end()) {
+                break;
+            }
+            x1 += i->w;
+        }
+        return dist;
+    }
+
+    double max() const
+    {
+        double val = m_north ? MAXIMUM_Y : MINIMUM_Y;
+        for (const SkylineSegment& s : m_seg) {
+            val = m_north ? std::min(val, s.y) : std::max(val, s.y);
+        }
+        return val;
+    }
+
+private:
+    using SegIter = std::vector<SkylineSegment>::iterator;
+
+    static constexpr double MAXIMUM_Y = 1000000.0;
+    static constexpr double MINIMUM_Y = -1000000.0;
+
+    SegIter insert(SegIter i, double x, double y, double w, int span)
+    {
+        const double xr = x + w;
+        if (i != m_seg.end() && xr > i->x) {
+            i->x = xr;
+        }
+        return m_seg.emplace(i, x, y, w, span);
+    }
+
+    SegIter find(double x)
+    {
+        auto it = std::upper_bound(m_seg.begin(), m_seg.end(), x, [](double x, const SkylineSegment& s) { return x < s.x; });
+        if (it == m_seg.begin()) {
+            return it;
+        }
+        return --it;
+    }
+
+    const bool m_north;
+    std::vector<SkylineSegment> m_seg;
+};
+
+class Engraving_SkylineTests : public ::testing::Test
+{
+public:
+    struct Lines {
+        SkylineLine line;
+        ReferenceSkylineLine reference;
+
+        explicit Lines(bool north)
+            : line(north), reference(north) {}
+
+        void add(double x, double y, double w, int span = 0)
+        {
+            line.add(x, y, w, span);
+            reference.add(x, y, w, span);
+        }
+    };
+
+    //! NOTE EXPECT_EQ compares the double values exactly
+    static void compareSegments(const Lines& lines)
+    {
+        const std::vector<SkylineSegment>& expected = lines.reference.segments();
+        ASSERT_EQ(lines.line.size(), expected.size());
+
+        size_t i = 0;
+        for (const SkylineSegment s : lines.line) {
+            EXPECT_EQ(s.x, expected[i].x);
+            EXPECT_EQ(s.y, expected[i].y);
+            EXPECT_EQ(s.w, expected[i].w);
+            EXPECT_EQ(s.staffSpan, expected[i].staffSpan);
+            ++i;
+        }
+    }
+
+    static void fillRandom(std::mt19937& gen, Lines& lines)
+    {
+        std::uniform_int_distribution<int> countDist(0, 40);
+        std::uniform_real_distribution<double> xDist(-5.0, 100.0);
+        std::uniform_real_distribution<double> yDist(-20.0, 20.0);
+        std::uniform_real_distribution<double> wDist(0.0, 15.0);
+        std::uniform_int_distribution<int> spanDist(-1, 1);
+
+        int count = countDist(gen);
+        for (int i = 0; i < count; ++i) {
+            lines.add(xDist(gen), yDist(gen), wDist(gen), spanDist(gen));
+        }
+    }
+};
+
+//---------------------------------------------------------
+///   randomLines
+///   random segments, overlapping, outside of the line
+///   and crossing staves
+//---------------------------------------------------------
+
+TEST_F(Engraving_SkylineTests, randomLines)
+{
+    std::mt19937 gen(RANDOM_SEED);
+
+    for (int i = 0; i < RANDOM_LINE_COUNT; ++i) {
+        Lines south(false);
+        Lines north(true);
+        fillRandom(gen, south);
+        fillRandom(gen, north);
+
+        compareSegments(south);
+        compareSegments(north);
+
+        EXPECT_EQ(south.line.max(), south.reference.max());
+        EXPECT_EQ(north.line.max(), north.reference.max());
+        EXPECT_EQ(south.line.minDistance(north.line), south.reference.minDistance(north.reference));
+
+        if (HasFailure()) {
+            FAIL() << "line " << i;
+        }
+    }
+}
+
+//---------------------------------------------------------
+///   scoreShapes
+///   the skylines of the systems of a laid out score,
+///   built from the shapes of its segments
+//---------------------------------------------------------
+
+TEST_F(Engraving_SkylineTests, scoreShapes)
+{
+    MasterScore* score = ScoreRW::readScore(SCORE_PATH);
+    ASSERT_TRUE(score);
+
+    for (const System* system : score->systems()) {
+        std::vector<Lines> south(score->nstaves(), Lines(false));
+        std::vector<Lines> north(score->nstaves(), Lines(true));
+
+        for (const MeasureBase* mb : system->measures()) {
+            if (!mb->isMeasure()) {
+                continue;
+            }
+            const Measure* m = toMeasure(mb);
+            for (const Segment* s = m->first(); s; s = s->next()) {
+                if (!s->enabled()) {
+                    continue;
+                }
+                double x = m->x() + s->x();
+                for (staff_idx_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+                    for (const ShapeElement& r : s->staffShape(staffIdx)) {
+                        south[staffIdx].add(x + r.x(), r.bottom(), r.width());
+                        north[staffIdx].add(x + r.x(), r.top(), r.width());
+                    }
+                }
+            }
+        }
+
+        for (staff_idx_t staffIdx = 0; staffIdx < score->nstaves(); ++staffIdx) {
+            compareSegments(south[staffIdx]);
+            compareSegments(north[staffIdx]);
+            if (staffIdx + 1 < score->nstaves()) {
+                EXPECT_EQ(south[staffIdx].line.minDistance(north[staffIdx + 1].line),
+                          south[staffIdx].reference.minDistance(north[staffIdx + 1].reference));
+            }
+        }
+    }
+
+    delete score;
+}
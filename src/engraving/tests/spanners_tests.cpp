@@ -22,6 +22,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <random>
+
 #include "libmscore/chord.h"
 #include "libmscore/excerpt.h"
 #include "libmscore/factory.h"
@@ -31,6 +34,7 @@
 #include "libmscore/masterscore.h"
 #include "libmscore/measure.h"
 #include "libmscore/part.h"
+#include "libmscore/spannermap.h"
 #include "libmscore/staff.h"
 #include "libmscore/system.h"
 #include "libmscore/undo.h"
@@ -593,3 +597,91 @@ TEST_F(Engraving_SpannersTests, spanners16)
     EXPECT_TRUE(ScoreComp::saveCompareScore(score, u"smallstaff01.mscx", SPANNERS_DATA_DIR + u"smallstaff01-ref.mscx"));
     delete score;
 }
+
+//---------------------------------------------------------
+//   Incremental interval tree against a brute force scan
+//   on random inserts, updates and removals
+//---------------------------------------------------------
+
+TEST_F(Engraving_SpannersTests, spannerIntervalTree)
+{
+    struct Entry {
+        int start = 0;
+        int stop = 0;
+        bool inTree = false;
+    };
+
+    constexpr int count = 200;
+    std::vector<Entry> entries(count);
+    // the tree never dereferences the spanners
+    std::vector<char> storage(count);
+    auto spanner = [&storage](int i) { return reinterpret_cast<Spanner*>(&storage[i]); };
+    auto index = [&storage](const Spanner* s) { return int(reinterpret_cast<const char*>(s) - storage.data()); };
+
+    auto sorted = [&index](SpannerIntervalTree::IntervalList list) {
+        std::vector<int> result;
+        for (const auto& interval : list) {
+            result.push_back(index(interval.value));
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    };
+
+    SpannerIntervalTree tree;
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> tickDist(0, 1000);
+    std::uniform_int_distribution<int> lengthDist(0, 100);
+    std::uniform_int_distribution<int> entryDist(0, count - 1);
+
+    for (int step = 0; step < 5000; ++step) {
+        int i = entryDist(random);
+        Entry& e = entries[i];
+        int start = tickDist(random);
+        int stop = start + lengthDist(random);
+
+        switch (step % 3) {
+        case 0:
+            tree.insert(spanner(i), start, stop);
+            e = { start, stop, true };
+            break;
+        case 1:
+            EXPECT_EQ(tree.update(spanner(i), start, stop), e.inTree);
+            if (e.inTree) {
+                e.start = start;
+                e.stop = stop;
+            }
+            break;
+        case 2:
+            EXPECT_EQ(tree.remove(spanner(i)), e.inTree);
+            e.inTree = false;
+            break;
+        }
+
+        int from = tickDist(random);
+        int to = from + lengthDist(random) * 2;
+
+        std::vector<int> overlapping;
+        std::vector<int> contained;
+        for (int j = 0; j < count; ++j) {
+            const Entry& ej = entries[j];
+            if (!ej.inTree) {
+                continue;
+            }
+            if (ej.stop >= from && ej.start <= to) {
+                overlapping.push_back(j);
+            }
+            if (ej.start >= from && ej.stop <= to) {
+                contained.push_back(j);
+            }
+        }
+
+        SpannerIntervalTree::IntervalList results;
+        tree.findOverlapping(from, to, results);
+        EXPECT_TRUE(std::is_sorted(results.begin(), results.end(), [](const auto& a, const auto& b) { return a.start < b.start; }));
+        EXPECT_EQ(sorted(results), overlapping);
+
+        results.clear();
+        tree.findContained(from, to, results);
+        EXPECT_EQ(sorted(results), contained);
+    }
+}
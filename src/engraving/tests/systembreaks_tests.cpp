@@ -0,0 +1,121 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "layout/layoutsystembreaks.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+class Engraving_SystemBreaksTests : public ::testing::Test
+{
+public:
+    static std::vector<LayoutSystemBreaks::Item> items(const std::vector<double>& widths)
+    {
+        std::vector<LayoutSystemBreaks::Item> result;
+        for (double w : widths) {
+            LayoutSystemBreaks::Item item;
+            item.width = w;
+            result.push_back(item);
+        }
+        return result;
+    }
+
+    static LayoutSystemBreaks::Params params(double systemWidth)
+    {
+        LayoutSystemBreaks::Params p;
+        p.systemWidth = systemWidth;
+        p.lastSystemFillLimit = 0.3;
+        return p;
+    }
+};
+
+//---------------------------------------------------------
+///   balanced
+///   greedy filling gives 45, 50, 20 (the last system is
+///   stretched to more than twice its width), the optimal
+///   breaks give 45, 40, 30
+//---------------------------------------------------------
+
+TEST_F(Engraving_SystemBreaksTests, balanced)
+{
+    std::vector<size_t> starts = LayoutSystemBreaks::computeBreaks(items({ 25, 20, 25, 15, 10, 10, 10 }), params(50));
+    EXPECT_EQ(starts, std::vector<size_t>({ 0, 2, 4 }));
+}
+
+//---------------------------------------------------------
+///   shortLastSystem
+///   a short last system isn't justified, so it costs nothing
+//---------------------------------------------------------
+
+TEST_F(Engraving_SystemBreaksTests, shortLastSystem)
+{
+    std::vector<size_t> starts = LayoutSystemBreaks::computeBreaks(items({ 10, 10, 10, 10, 10, 10, 10, 10, 10 }), params(40));
+    EXPECT_EQ(starts, std::vector<size_t>({ 0, 4, 8 }));
+}
+
+//---------------------------------------------------------
+///   noBreak
+///   systems don't end after measures with nobreak
+//---------------------------------------------------------
+
+TEST_F(Engraving_SystemBreaksTests, noBreak)
+{
+    std::vector<LayoutSystemBreaks::Item> list = items({ 10, 10, 10, 10, 10, 10 });
+    list[2].noBreak = true;
+
+    std::vector<size_t> starts = LayoutSystemBreaks::computeBreaks(list, params(30));
+    for (size_t start : starts) {
+        EXPECT_NE(start, 3u);
+    }
+    EXPECT_EQ(starts.front(), 0u);
+}
+
+//---------------------------------------------------------
+///   overfull
+///   a measure wider than the system gets a system of its own
+//---------------------------------------------------------
+
+TEST_F(Engraving_SystemBreaksTests, overfull)
+{
+    std::vector<size_t> starts = LayoutSystemBreaks::computeBreaks(items({ 10, 60, 10 }), params(50));
+    EXPECT_EQ(starts, std::vector<size_t>({ 0, 1, 2 }));
+}
+
+//---------------------------------------------------------
+///   squeeze
+///   measures may be squeezed into a system if they have
+///   enough squeezable space
+//---------------------------------------------------------
+
+TEST_F(Engraving_SystemBreaksTests, squeeze)
+{
+    std::vector<LayoutSystemBreaks::Item> list = items({ 26, 26 });
+    LayoutSystemBreaks::Params p = params(50);
+    EXPECT_EQ(LayoutSystemBreaks::computeBreaks(list, p).size(), 2u);
+
+    list[0].squeezable = 10;
+    list[1].squeezable = 10;
+    p.squeezability = 0.3;
+    EXPECT_EQ(LayoutSystemBreaks::computeBreaks(list, p).size(), 1u);
+}
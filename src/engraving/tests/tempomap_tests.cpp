@@ -256,3 +256,58 @@ TEST_F(Engraving_TempoMapTests, GRADUAL_TEMPO_CHANGE_DOESNT_OVERWRITE_OTHER_TEMP
         EXPECT_TRUE(RealIsEqual(RealRound(tempoMap->at(pair.first).tempo.val, 2), RealRound(pair.second.val, 2)));
     }
 }
+
+/**
+ * @brief TempoMapTests_TIME_CONVERSION
+ * @details Tempo changes, a pause and a tempo multiplier are set on an empty tempomap.
+ *          Time of the ticks must be the sum of the durations of the tempo segments and pauses before them,
+ *          converting them in one pass must give the same times and converting the times back must give the ticks
+ */
+TEST_F(Engraving_TempoMapTests, TIME_CONVERSION)
+{
+    // [GIVEN] 120 BPM, 60 BPM from the 2-nd measure with a pause of 1 second, 240 BPM from the 4-th measure
+    TempoMap tempoMap;
+    tempoMap.setTempo(0, BeatsPerSecond(2.0));
+    tempoMap.setTempo(4 * Constants::division, BeatsPerSecond(1.0));
+    tempoMap.setPause(4 * Constants::division, 1.0);
+    tempoMap.setTempo(12 * Constants::division, BeatsPerSecond(4.0));
+
+    for (double multiplier : { 1.0, 1.5 }) {
+        tempoMap.setTempoMultiplier(multiplier);
+
+        // [GIVEN] Expected time of a tick, in seconds, the pause isn't affected by the multiplier
+        auto expectedTime = [multiplier](int tick) {
+            double beats = double(tick) / Constants::division;
+            double time = std::min(beats, 4.0) / 2.0;
+            if (beats > 4.0) {
+                time += (std::min(beats, 12.0) - 4.0) / 1.0;
+            }
+            if (beats > 12.0) {
+                time += (beats - 12.0) / 4.0;
+            }
+            return time / multiplier + (beats >= 4.0 ? 1.0 : 0.0);
+        };
+
+        std::vector<int> ticks;
+        for (int tick = 0; tick <= 16 * Constants::division; tick += Constants::division / 4) {
+            ticks.push_back(tick);
+        }
+
+        // [WHEN] The ticks are converted one by one and in one pass
+        std::vector<double> times;
+        tempoMap.tick2time(ticks, times);
+        ASSERT_EQ(times.size(), ticks.size());
+
+        // [THEN] The times match our expectations and convert back to the ticks
+        for (size_t i = 0; i < ticks.size(); ++i) {
+            double time = tempoMap.tick2time(ticks[i]);
+            EXPECT_NEAR(time, expectedTime(ticks[i]), 1e-9);
+            EXPECT_DOUBLE_EQ(times[i], time);
+            EXPECT_EQ(tempoMap.time2tick(time), ticks[i]);
+        }
+
+        // [THEN] The time in the pause is converted to the tick of the pause
+        double pauseStart = 2.0 / multiplier;
+        EXPECT_EQ(tempoMap.time2tick(pauseStart + 0.5 / multiplier), 4 * Constants::division);
+    }
+}
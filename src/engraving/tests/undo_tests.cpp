@@ -0,0 +1,127 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include "libmscore/masterscore.h"
+#include "libmscore/measure.h"
+#include "libmscore/mscore.h"
+#include "libmscore/undo.h"
+
+#include "utils/scorerw.h"
+
+using namespace mu;
+using namespace mu::engraving;
+
+class Engraving_UndoTests : public ::testing::Test
+{
+public:
+    void TearDown() override
+    {
+        MScore::undoMemoryLimit = m_memoryLimit;
+    }
+
+    static void changeStretch(MasterScore* score, double stretch)
+    {
+        score->startCmd();
+        score->firstMeasure()->undoChangeProperty(Pid::USER_STRETCH, stretch);
+        score->endCmd();
+    }
+
+private:
+    size_t m_memoryLimit = MScore::undoMemoryLimit;
+};
+
+//---------------------------------------------------------
+//   memoryLimit
+//    the oldest macros are dropped once the commands take
+//    more than the limit, the last one is always kept
+//---------------------------------------------------------
+
+TEST_F(Engraving_UndoTests, memoryLimit)
+{
+    MasterScore* score = ScoreRW::readScore(u"test.mscx");
+    ASSERT_TRUE(score);
+
+    UndoStack* stack = score->undoStack();
+    changeStretch(score, 1.5);
+    ASSERT_EQ(stack->getCurIdx(), 1u);
+    size_t macroMemory = stack->last()->memoryUsage();
+
+    //! NOTE Room for three macros like the first one
+    MScore::undoMemoryLimit = 3 * macroMemory + macroMemory / 2;
+    for (int i = 0; i < 9; ++i) {
+        changeStretch(score, 2.0 + i);
+    }
+
+    EXPECT_EQ(stack->getCurIdx(), 10u);
+    EXPECT_EQ(stack->macros().size(), 10u);
+
+    size_t keptMacros = 0;
+    for (const UndoMacro* macro : stack->macros()) {
+        if (macro) {
+            ++keptMacros;
+        }
+    }
+    EXPECT_EQ(keptMacros, 3u);
+    EXPECT_EQ(stack->macros().front(), nullptr);
+
+    //! NOTE Only the kept macros can be undone, and redone again
+    size_t undone = 0;
+    while (stack->canUndo()) {
+        score->undoRedo(/* undo */ true, nullptr);
+        ++undone;
+    }
+    EXPECT_EQ(undone, 3u);
+    EXPECT_DOUBLE_EQ(score->firstMeasure()->userStretch(), 2.0 + 5);
+
+    while (stack->canRedo()) {
+        score->undoRedo(/* undo */ false, nullptr);
+    }
+    EXPECT_DOUBLE_EQ(score->firstMeasure()->userStretch(), 2.0 + 8);
+
+    delete score;
+}
+
+//---------------------------------------------------------
+//   noMemoryLimit
+//---------------------------------------------------------
+
+TEST_F(Engraving_UndoTests, noMemoryLimit)
+{
+    MasterScore* score = ScoreRW::readScore(u"test.mscx");
+    ASSERT_TRUE(score);
+
+    MScore::undoMemoryLimit = 0;
+    for (int i = 0; i < 10; ++i) {
+        changeStretch(score, 2.0 + i);
+    }
+
+    size_t undone = 0;
+    while (score->undoStack()->canUndo()) {
+        score->undoRedo(/* undo */ true, nullptr);
+        ++undone;
+    }
+    EXPECT_EQ(undone, 10u);
+
+    delete score;
+}
@@ -27,6 +27,75 @@
 
 using namespace mu::engraving;
 
+PropertyValue::PropertyValue(const PropertyValue& v)
+    : m_type(v.m_type)
+{
+    copyData(v);
+}
+
+PropertyValue::PropertyValue(PropertyValue&& v) noexcept
+    : m_type(v.m_type)
+{
+    if (v.isInlineData()) {
+        copyData(v);
+    } else {
+        m_shared = std::move(v.m_shared);
+        m_data = m_shared.get();
+    }
+    v.reset();
+}
+
+PropertyValue::~PropertyValue()
+{
+    reset();
+}
+
+PropertyValue& PropertyValue::operator=(const PropertyValue& v)
+{
+    if (this != &v) {
+        reset();
+        m_type = v.m_type;
+        copyData(v);
+    }
+    return *this;
+}
+
+PropertyValue& PropertyValue::operator=(PropertyValue&& v) noexcept
+{
+    if (this != &v) {
+        reset();
+        m_type = v.m_type;
+        if (v.isInlineData()) {
+            copyData(v);
+        } else {
+            m_shared = std::move(v.m_shared);
+            m_data = m_shared.get();
+        }
+        v.reset();
+    }
+    return *this;
+}
+
+void PropertyValue::copyData(const PropertyValue& v)
+{
+    if (v.isInlineData()) {
+        m_data = v.m_data->copyTo(m_inline);
+    } else {
+        m_shared = v.m_shared;
+        m_data = m_shared.get();
+    }
+}
+
+void PropertyValue::reset()
+{
+    if (isInlineData()) {
+        m_data->~IArg();
+    }
+    m_data = nullptr;
+    m_shared.reset();
+    m_type = P_TYPE::UNDEFINED;
+}
+
 bool PropertyValue::isValid() const
 {
     return m_type != P_TYPE::UNDEFINED;
@@ -79,7 +148,7 @@ bool PropertyValue::operator ==(const PropertyValue& v) const
         return false;
     }
 
-    return v.m_type == m_type && v.m_data->equal(m_data.get());
+    return v.m_type == m_type && v.m_data->equal(m_data);
 }
 
 #ifndef NO_QT_SUPPORT
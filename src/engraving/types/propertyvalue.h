@@ -25,6 +25,8 @@
 #include <any>
 #include <string>
 #include <memory>
+#include <new>
+#include <typeinfo>
 #include <cassert>
 
 #include "types/string.h"
@@ -111,6 +113,12 @@ class PropertyValue
 {
 public:
     PropertyValue() = default;
+    PropertyValue(const PropertyValue& v);
+    PropertyValue(PropertyValue&& v) noexcept;
+    ~PropertyValue();
+
+    PropertyValue& operator=(const PropertyValue& v);
+    PropertyValue& operator=(PropertyValue&& v) noexcept;
 
     // Base
     PropertyValue(bool v)
@@ -280,7 +288,7 @@ public:
             return T();
         }
 
-        Arg<T>* at = get<T>();
+        const Arg<T>* at = get<T>();
         if (!at) {
             //! HACK Temporary hack for int to enum
             if constexpr (std::is_enum<T>::value) {
@@ -318,7 +326,7 @@ public:
             //! HACK Temporary hack for real to Spatium
             if constexpr (std::is_same<T, Spatium>::value) {
                 if (P_TYPE::REAL == m_type) {
-                    Arg<double>* srv = get<double>();
+                    const Arg<double>* srv = get<double>();
                     assert(srv);
                     return srv ? Spatium(srv->v) : Spatium();
                 }
@@ -334,7 +342,7 @@ public:
             //! HACK Temporary hack for real to Millimetre
             if constexpr (std::is_same<T, Millimetre>::value) {
                 if (P_TYPE::REAL == m_type) {
-                    Arg<double>* mrv = get<double>();
+                    const Arg<double>* mrv = get<double>();
                     assert(mrv);
                     return mrv ? Millimetre(mrv->v) : Millimetre();
                 }
@@ -401,10 +409,13 @@ private:
 
         virtual bool isEnum() const = 0;
         virtual int enumToInt() const = 0;
+
+        // copy constructs the value into the inline buffer of another PropertyValue
+        virtual IArg* copyTo(void* buf) const = 0;
     };
 
     template<typename T>
-    struct Arg : public IArg {
+    struct Arg final : public IArg {
         T v;
         Arg(const T& v)
             : IArg(), v(v) {}
@@ -412,11 +423,16 @@ private:
         bool equal(const IArg* a) const override
         {
             assert(a);
-            const Arg<T>* at = dynamic_cast<const Arg<T>*>(a);
+            const Arg<T>* at = cast<T>(a);
             assert(at);
             return at ? at->v == v : false;
         }
 
+        IArg* copyTo(void* buf) const override
+        {
+            return new (buf) Arg<T>(v);
+        }
+
         //! HACK Temporary hack for enum to int
         bool isEnum() const override
         {
@@ -433,20 +449,58 @@ private:
         }
     };
 
+    //! NOTE Scalars, enums, points, colors, fractions etc. are stored in place,
+    //! only the values that don't fit (strings, vectors, paths...) are shared on the heap
+    static constexpr size_t INLINE_SIZE = 3 * sizeof(void*);
+    static constexpr size_t INLINE_ALIGN = alignof(void*) > alignof(double) ? alignof(void*) : alignof(double);
+
+    template<typename T>
+    static constexpr bool isInline()
+    {
+        return std::is_trivially_copyable<T>::value
+               && sizeof(Arg<T>) <= INLINE_SIZE
+               && alignof(Arg<T>) <= INLINE_ALIGN;
+    }
+
     template<typename T>
-    inline std::shared_ptr<IArg> make_data(const T& v) const
+    static const Arg<T>* cast(const IArg* a)
     {
-        return std::shared_ptr<IArg>(new Arg<T>(v));
+        // all of the Arg<T> are final, so an exact type check is enough
+        return a && typeid(*a) == typeid(Arg<T>) ? static_cast<const Arg<T>*>(a) : nullptr;
     }
 
     template<typename T>
-    inline Arg<T>* get() const
+    inline IArg* make_data(const T& v)
     {
-        return dynamic_cast<Arg<T>*>(m_data.get());
+        if constexpr (isInline<T>()) {
+            return new (m_inline) Arg<T>(v);
+        } else {
+            m_shared = std::make_shared<Arg<T> >(v);
+            return m_shared.get();
+        }
+    }
+
+    template<typename T>
+    inline const Arg<T>* get() const
+    {
+        return cast<T>(m_data);
     }
 
+    bool isInlineData() const
+    {
+        const unsigned char* data = reinterpret_cast<const unsigned char*>(m_data);
+        return data >= m_inline && data < m_inline + INLINE_SIZE;
+    }
+
+    void copyData(const PropertyValue& v);
+    void reset();
+
+    // declared before m_data, make_data() fills them in the constructors' initializer lists
+    std::shared_ptr<IArg> m_shared;
+    alignas(INLINE_ALIGN) unsigned char m_inline[INLINE_SIZE];
+
     P_TYPE m_type = P_TYPE::UNDEFINED;
-    std::shared_ptr<IArg> m_data = nullptr;
+    IArg* m_data = nullptr;                // points either to m_inline or to m_shared
 };
 }
 
@@ -54,6 +54,9 @@ using system_idx_t = size_t;
 using part_idx_t = size_t;
 using page_idx_t = size_t;
 
+// id of an item, unique for the lifetime of the item, 0 - not assigned
+using eid_t = uint64_t;
+
 //-------------------------------------------------------------------
 ///   The value of this enum determines the "stacking order"
 ///   of elements on the canvas.
@@ -139,13 +139,13 @@ public:
         return std::prev(upper)->second;
     }
 
-    EventSequence eventsToBePlayed(const msecs_t nextMsecs)
+    //! NOTE Returns all the events of the next block, keyed by their offset from the block start,
+    //! so that the synthesizers can apply them at the exact sample instead of the block start
+    EventSequenceMap eventsToBePlayed(const msecs_t nextMsecs)
     {
         ONLY_AUDIO_WORKER_THREAD;
 
-        EventSequence result;
-
-        result.clear();
+        EventSequenceMap result;
 
         if (!m_isActive) {
             handleOffStream(result, nextMsecs);
@@ -156,10 +156,11 @@ public:
             return result;
         }
 
+        const msecs_t blockStart = m_playbackPosition;
         m_playbackPosition += nextMsecs;
 
-        handleMainStream(result);
-        handleDynamicChanges(result);
+        handleMainStream(result, blockStart);
+        handleDynamicChanges(result, blockStart);
 
         return result;
     }
@@ -180,6 +181,7 @@ protected:
     void updateOffSequenceIterator()
     {
         m_currentOffSequenceIt = m_offStreamEvents.cbegin();
+        m_offStreamPosition = 0;
     }
 
     void updateDynamicChangesIterator()
@@ -187,48 +189,53 @@ protected:
         m_currentDynamicsIt = m_dynamicEvents.lower_bound(m_playbackPosition);
     }
 
-    void handleOffStream(EventSequence& result, const msecs_t nextMsecs)
+    //! NOTE The timestamps of the off stream events are relative to the moment they were received
+    void handleOffStream(EventSequenceMap& result, const msecs_t nextMsecs)
     {
-        if (m_offStreamEvents.empty() || m_currentOffSequenceIt == m_offStreamEvents.cend()) {
+        if (m_offStreamEvents.empty()) {
             return;
         }
 
-        if (m_currentOffSequenceIt->first <= nextMsecs) {
-            result = m_currentOffSequenceIt->second;
+        const msecs_t blockStart = m_offStreamPosition;
+        m_offStreamPosition += nextMsecs;
+
+        while (m_currentOffSequenceIt != m_offStreamEvents.cend() && m_currentOffSequenceIt->first < m_offStreamPosition) {
+            appendEvents(result, m_currentOffSequenceIt, blockStart);
             m_currentOffSequenceIt = m_offStreamEvents.erase(m_currentOffSequenceIt);
-        } else {
-            auto node = m_offStreamEvents.extract(m_currentOffSequenceIt);
-            node.key() -= nextMsecs;
-            m_offStreamEvents.insert(std::move(node));
-            updateOffSequenceIterator();
         }
     }
 
-    void handleMainStream(EventSequence& result)
+    void handleMainStream(EventSequenceMap& result, const msecs_t blockStart)
     {
-        if (m_currentMainSequenceIt->first <= m_playbackPosition) {
-            result.insert(m_currentMainSequenceIt->second.cbegin(),
-                          m_currentMainSequenceIt->second.cend());
-
+        while (m_currentMainSequenceIt != m_mainStreamEvents.cend() && m_currentMainSequenceIt->first < m_playbackPosition) {
+            appendEvents(result, m_currentMainSequenceIt, blockStart);
             m_currentMainSequenceIt = std::next(m_currentMainSequenceIt);
         }
     }
 
-    void handleDynamicChanges(EventSequence& result)
+    void handleDynamicChanges(EventSequenceMap& result, const msecs_t blockStart)
     {
-        if (m_dynamicEvents.empty() || m_currentDynamicsIt == m_dynamicEvents.cend()) {
+        if (m_dynamicEvents.empty()) {
             return;
         }
 
-        if (m_currentDynamicsIt->first <= m_playbackPosition) {
-            result.insert(m_currentDynamicsIt->second.cbegin(),
-                          m_currentDynamicsIt->second.cend());
-
+        while (m_currentDynamicsIt != m_dynamicEvents.cend() && m_currentDynamicsIt->first < m_playbackPosition) {
+            appendEvents(result, m_currentDynamicsIt, blockStart);
             m_currentDynamicsIt = std::next(m_currentDynamicsIt);
         }
     }
 
+    void appendEvents(EventSequenceMap& result, SequenceIterator it, const msecs_t blockStart) const
+    {
+        //! NOTE The events, which are already late (e.g. after a seek), are played at the block start
+        msecs_t offset = it->first > blockStart ? it->first - blockStart : 0;
+
+        EventSequence& sequence = result[offset];
+        sequence.insert(it->second.cbegin(), it->second.cend());
+    }
+
     mutable msecs_t m_playbackPosition = 0;
+    msecs_t m_offStreamPosition = 0;
 
     SequenceIterator m_currentMainSequenceIt;
     SequenceIterator m_currentOffSequenceIt;
@@ -69,6 +69,11 @@ void AbstractSynthesizer::revokePlayingNotes()
     ONLY_AUDIO_WORKER_THREAD;
 }
 
+unsigned int AbstractSynthesizer::activeVoicesCount() const
+{
+    return 0;
+}
+
 void AbstractSynthesizer::updateRenderingMode(const RenderMode /*mode*/)
 {
     ONLY_AUDIO_WORKER_THREAD;
@@ -54,6 +54,9 @@ public:
     virtual void flushSound() = 0;
     virtual void revokePlayingNotes();
 
+    //! NOTE For the diagnostics, 0 if the synth can't tell
+    virtual unsigned int activeVoicesCount() const;
+
     virtual bool isValid() const = 0;
     virtual bool isActive() const = 0;
     virtual void setIsActive(bool arg) = 0;
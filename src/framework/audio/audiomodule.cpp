@@ -35,6 +35,7 @@
 #include "internal/audiooutputdevicecontroller.h"
 
 #include "internal/worker/audioengine.h"
+#include "internal/worker/eventaudiosource.h"
 #include "internal/worker/playback.h"
 
 #include "internal/soundfontrepository.h"
@@ -166,6 +167,12 @@ void AudioModule::onInit(const framework::IApplication::RunMode& mode)
 
     s_audioBuffer->init(s_audioConfiguration->audioChannelsCount(),
                         s_audioConfiguration->renderStep());
+    s_audioBuffer->setLowLatencyMode(s_audioConfiguration->isLowLatencyModeEnabled());
+    EventAudioSource::setFreezeOptions(s_audioConfiguration->isAutoFreezeEnabled(),
+                                       s_audioConfiguration->frozenTracksMemoryLimitMb() * 1024 * 1024);
+    s_audioBuffer->setDemandCallback([]() {
+        s_audioWorker->wakeUp();
+    });
 
     s_audioOutputController->init();
 
@@ -236,6 +243,10 @@ void AudioModule::setupAudioWorker(const IAudioDriver::Spec& activeSpec)
         AudioEngine::instance()->setSampleRate(activeSpec.sampleRate);
         AudioEngine::instance()->setReadBufferSize(activeSpec.samples);
 
+        LOGI() << "audio buffer latency: "
+               << s_audioBuffer->framesToReserve() * 1000 / (activeSpec.channels * activeSpec.sampleRate) << " ms"
+               << ", driver buffer: " << activeSpec.samples * 1000 / activeSpec.sampleRate << " ms";
+
         auto fluidResolver = std::make_shared<FluidResolver>();
         s_synthResolver->registerResolver(AudioSourceType::Fluid, fluidResolver);
         s_synthResolver->init(s_audioConfiguration->defaultAudioInputParams());
@@ -23,7 +23,9 @@
 #ifndef MU_AUDIO_AUDIOTYPES_H
 #define MU_AUDIO_AUDIOTYPES_H
 
+#include <chrono>
 #include <variant>
+#include <vector>
 #include <memory>
 #include <set>
 #include <string>
@@ -46,6 +48,7 @@ using volume_db_t = float;
 using volume_dbfs_t = float;
 using gain_t = float;
 using balance_t = float;
+using aux_channel_idx_t = uint8_t;
 
 using TrackSequenceId = int32_t;
 using TrackSequenceIdList = std::vector<TrackSequenceId>;
@@ -59,6 +62,9 @@ using PlaybackSetupData = mpe::PlaybackSetupData;
 
 static constexpr int MINIMUM_BUFFER_SIZE = 1024;
 
+//! NOTE The shared buses (e.g. a common reverb), which the tracks can send their signal to
+static constexpr aux_channel_idx_t AUX_CHANNEL_NUM = 2;
+
 enum class SoundTrackType {
     Undefined = -1,
     MP3,
@@ -89,6 +95,13 @@ struct SoundTrackFormat {
     }
 };
 
+struct SoundTrackDestination {
+    io::path_t path;
+    SoundTrackFormat format;
+};
+
+using SoundTrackDestinations = std::vector<SoundTrackDestination>;
+
 using AudioSourceName = std::string;
 using AudioResourceId = std::string;
 using AudioResourceIdList = std::vector<AudioResourceId>;
@@ -223,10 +236,24 @@ struct AudioFxParams {
 
 using AudioFxChain = std::map<AudioFxChainOrder, AudioFxParams>;
 
+struct AuxSendParams {
+    gain_t signalAmount = 0.f; // [0; 1]
+    bool active = false;
+
+    bool operator ==(const AuxSendParams& other) const
+    {
+        return signalAmount == other.signalAmount
+               && active == other.active;
+    }
+};
+
+using AuxSendsParams = std::vector<AuxSendParams>;
+
 struct AudioOutputParams {
     AudioFxChain fxChain;
     volume_db_t volume = 0.f;
     balance_t balance = 0.f;
+    AuxSendsParams auxSends;
     bool muted = false;
 
     bool operator ==(const AudioOutputParams& other) const
@@ -234,6 +261,7 @@ struct AudioOutputParams {
         return fxChain == other.fxChain
                && volume == other.volume
                && balance == other.balance
+               && auxSends == other.auxSends
                && muted == other.muted;
     }
 };
@@ -290,7 +318,8 @@ using AudioSignalChanges = async::Channel<audioch_t, AudioSignalVal>;
 struct AudioSignalsNotifier {
     void updateSignalValues(const audioch_t audioChNumber, const float newAmplitude, const volume_dbfs_t newPressure)
     {
-        AudioSignalVal& signalVal = m_signalValuesMap[audioChNumber];
+        ChannelSignal& channelSignal = m_signalValuesMap[audioChNumber];
+        AudioSignalVal& signalVal = channelSignal.sentVal;
 
         volume_dbfs_t validatedPressure = std::max(newPressure, MINIMUM_OPERABLE_DBFS_LEVEL);
 
@@ -302,8 +331,19 @@ struct AudioSignalsNotifier {
             return;
         }
 
+        //! NOTE The meters are only repainted a few times per second, so the values of the blocks in between
+        //! are dropped instead of being sent across the threads. A dropped value isn't kept: the next blocks
+        //! bring the current level, which is sent once the interval has passed. The mixer renders blocks while
+        //! the playback is paused or stopped too, and the silence is sent at once, it is the last value
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        bool isSilence = RealIsEqual(validatedPressure, MINIMUM_OPERABLE_DBFS_LEVEL);
+        if (!isSilence && now - channelSignal.sentTime < MINIMAL_SEND_INTERVAL) {
+            return;
+        }
+
         signalVal.amplitude = newAmplitude;
         signalVal.pressure = validatedPressure;
+        channelSignal.sentTime = now;
 
         audioSignalChanges.send(audioChNumber, signalVal);
     }
@@ -313,8 +353,14 @@ struct AudioSignalsNotifier {
 private:
     static constexpr volume_dbfs_t PRESSURE_MINIMAL_VALUABLE_DIFF = 2.5f;
     static constexpr volume_dbfs_t MINIMUM_OPERABLE_DBFS_LEVEL = -100.f;
+    static constexpr std::chrono::milliseconds MINIMAL_SEND_INTERVAL { 40 };
 
-    std::map<audioch_t, AudioSignalVal> m_signalValuesMap;
+    struct ChannelSignal {
+        AudioSignalVal sentVal;
+        std::chrono::steady_clock::time_point sentTime;
+    };
+
+    std::map<audioch_t, ChannelSignal> m_signalValuesMap;
 };
 
 enum class PlaybackStatus {
@@ -341,6 +387,32 @@ enum class RenderMode {
     RealTimeMode,
     OfflineMode
 };
+
+//! NOTE The load is the share of the block duration spent on processing it, 1.0 means the deadline was hit exactly
+struct AudioChannelPerformance {
+    TrackId trackId = -1;
+    bool isAux = false;
+    float load = 0.f;
+    float fxLoad = 0.f;
+    float maxLoad = 0.f;
+    unsigned int activeVoices = 0;
+};
+
+struct AudioPerformanceStats {
+    uint64_t blocksCount = 0;
+    uint64_t deadlineMissCount = 0;
+    double averageBlockUsecs = 0.0;
+    double maxBlockUsecs = 0.0;
+    double blockDeadlineUsecs = 0.0;
+    float load = 0.f;
+    float maxLoad = 0.f;
+
+    uint64_t bufferUnderrunCount = 0;
+    uint64_t missedFramesCount = 0;
+
+    unsigned int activeVoices = 0;
+    std::vector<AudioChannelPerformance> channels;
+};
 }
 
 #endif // MU_AUDIO_AUDIOTYPES_H
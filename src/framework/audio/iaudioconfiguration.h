@@ -54,6 +54,15 @@ public:
     virtual async::Notification driverBufferSizeChanged() const = 0;
     virtual samples_t renderStep() const = 0;
 
+    virtual bool isLowLatencyModeEnabled() const = 0;
+    virtual void setLowLatencyModeEnabled(bool enabled) = 0;
+
+    //! NOTE The heavy tracks may be rendered into the memory while the playback is stopped
+    virtual bool isAutoFreezeEnabled() const = 0;
+    virtual void setAutoFreezeEnabled(bool enabled) = 0;
+    virtual size_t frozenTracksMemoryLimitMb() const = 0;
+    virtual void setFrozenTracksMemoryLimitMb(size_t limit) = 0;
+
     virtual unsigned int sampleRate() const = 0;
     virtual void setSampleRate(unsigned int sampleRate) = 0;
     virtual async::Notification sampleRateChanged() const = 0;
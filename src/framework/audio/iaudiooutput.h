@@ -46,14 +46,29 @@ public:
     virtual void clearMasterOutputParams() = 0;
     virtual async::Channel<AudioOutputParams> masterOutputParamsChanged() const = 0;
 
+    virtual async::Promise<AudioOutputParams> auxOutputParams(const aux_channel_idx_t index) const = 0;
+    virtual void setAuxOutputParams(const aux_channel_idx_t index, const AudioOutputParams& params) = 0;
+    virtual async::Channel<aux_channel_idx_t, AudioOutputParams> auxOutputParamsChanged() const = 0;
+
     virtual async::Promise<AudioResourceMetaList> availableOutputResources() const = 0;
 
     virtual async::Promise<AudioSignalChanges> signalChanges(const TrackSequenceId sequenceId, const TrackId trackId) const = 0;
     virtual async::Promise<AudioSignalChanges> masterSignalChanges() const = 0;
 
+    //! NOTE How many times the output device didn't get enough rendered frames
+    virtual async::Promise<uint64_t> bufferUnderrunCount() const = 0;
+
+    //! NOTE The render timings, deadline misses, underruns and voices since the playback start (or the last reset)
+    virtual async::Promise<AudioPerformanceStats> performanceStats() const = 0;
+    virtual void resetPerformanceStats() = 0;
+
     virtual async::Promise<bool> saveSoundTrack(const TrackSequenceId sequenceId, const io::path_t& destination,
                                                 const SoundTrackFormat& format) = 0;
 
+    //! NOTE The sound track is rendered once and encoded into all the destinations in parallel,
+    //! their formats must have the same sample rate
+    virtual async::Promise<bool> saveSoundTracks(const TrackSequenceId sequenceId, const SoundTrackDestinations& destinations) = 0;
+
     virtual framework::Progress saveSoundTrackProgress(const TrackSequenceId sequenceId) = 0;
 
     virtual void clearAllFx() = 0;
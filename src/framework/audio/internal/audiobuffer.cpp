@@ -132,9 +132,9 @@ void AudioBuffer::forward()
     const auto currentReadIdx = m_readIndex.load(std::memory_order_acquire);
     size_t nextWriteIdx = currentWriteIdx;
 
-    samples_t framesToReserve = DEFAULT_SIZE / 2;
+    const size_t requiredFrames = framesToReserve();
 
-    while (reservedFrames(nextWriteIdx, currentReadIdx) < framesToReserve) {
+    while (reservedFrames(nextWriteIdx, currentReadIdx) < requiredFrames) {
         m_source->process(m_data.data() + nextWriteIdx, m_renderStep);
 
         nextWriteIdx = incrementWriteIndex(nextWriteIdx, m_renderStep);
@@ -153,8 +153,8 @@ void AudioBuffer::pop(float* dest, size_t sampleCount)
     }
 
     if (reservedFrames(currentWriteIdx, currentReadIdx) < (sampleCount * 2)) {
-        static size_t missingFramesTotal = 0;
-        missingFramesTotal += (sampleCount * 2);
+        m_underrunCount.fetch_add(1, std::memory_order_relaxed);
+        uint64_t missingFramesTotal = m_missedFramesCount.fetch_add(sampleCount * 2, std::memory_order_relaxed) + sampleCount * 2;
         LOGD() << "\n FRAMES MISSED " << sampleCount * 2 << ", reserve: " <<
             reservedFrames(currentWriteIdx, currentReadIdx) << ", total: " << missingFramesTotal;
     }
@@ -182,6 +182,10 @@ void AudioBuffer::pop(float* dest, size_t sampleCount)
     }
 
     m_readIndex.store(newReadIdx, std::memory_order_release);
+
+    if (m_demandCallback && reservedFrames(currentWriteIdx, newReadIdx) < framesToReserve()) {
+        m_demandCallback();
+    }
 }
 
 void AudioBuffer::setMinSamplesToReserve(size_t lag)
@@ -192,11 +196,103 @@ void AudioBuffer::setMinSamplesToReserve(size_t lag)
     m_minSamplesToReserve = lag;
 }
 
+void AudioBuffer::setLowLatencyMode(bool enabled)
+{
+    m_lowLatencyMode = enabled;
+}
+
+size_t AudioBuffer::framesToReserve() const
+{
+    if (!m_lowLatencyMode) {
+        return DEFAULT_SIZE / 2;
+    }
+
+    size_t samplesPerRead = std::max(m_minSamplesToReserve, static_cast<size_t>(m_renderStep));
+
+    return std::min(samplesPerRead * m_audioChannelsCount * 2, DEFAULT_SIZE / 2);
+}
+
+void AudioBuffer::setDemandCallback(const DemandCallback& callback)
+{
+    m_demandCallback = callback;
+}
+
+AudioBuffer::ReaderId AudioBuffer::addReader()
+{
+    for (size_t i = 0; i < MAX_READERS; ++i) {
+        bool expected = false;
+        if (m_readers[i].used.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+            m_readers[i].readIndex.store(m_writeIndex.load(std::memory_order_acquire), std::memory_order_release);
+            return static_cast<ReaderId>(i);
+        }
+    }
+
+    LOGE() << "too many audio buffer readers";
+
+    return INVALID_READER;
+}
+
+void AudioBuffer::removeReader(ReaderId reader)
+{
+    IF_ASSERT_FAILED(reader >= 0 && static_cast<size_t>(reader) < MAX_READERS) {
+        return;
+    }
+
+    m_readers[reader].used.store(false, std::memory_order_release);
+}
+
+AudioBuffer::ReadRegion AudioBuffer::read(ReaderId reader)
+{
+    ReadRegion result;
+
+    IF_ASSERT_FAILED(reader >= 0 && static_cast<size_t>(reader) < MAX_READERS && m_readers[reader].used) {
+        return result;
+    }
+
+    const size_t currentWriteIdx = m_writeIndex.load(std::memory_order_acquire);
+    const size_t currentReadIdx = m_readIndex.load(std::memory_order_acquire);
+    size_t readerIdx = m_readers[reader].readIndex.load(std::memory_order_relaxed);
+
+    //! NOTE The reader fell behind the device, the frames it missed may be already overwritten
+    if (reservedFrames(readerIdx, currentReadIdx) > reservedFrames(currentWriteIdx, currentReadIdx)) {
+        readerIdx = currentReadIdx;
+    }
+
+    size_t available = reservedFrames(currentWriteIdx, readerIdx);
+    size_t tillEnd = DEFAULT_SIZE - readerIdx;
+
+    result.data = m_data.data() + readerIdx;
+    result.size = std::min(available, tillEnd);
+
+    if (available > result.size) {
+        result.wrappedData = m_data.data();
+        result.wrappedSize = available - result.size;
+    }
+
+    m_readers[reader].readIndex.store(currentWriteIdx, std::memory_order_release);
+
+    return result;
+}
+
+uint64_t AudioBuffer::underrunCount() const
+{
+    return m_underrunCount.load(std::memory_order_relaxed);
+}
+
+uint64_t AudioBuffer::missedFramesCount() const
+{
+    return m_missedFramesCount.load(std::memory_order_relaxed);
+}
+
 void AudioBuffer::reset()
 {
     m_readIndex.store(0, std::memory_order_release);
     m_writeIndex.store(0, std::memory_order_release);
 
+    for (Reader& reader : m_readers) {
+        reader.readIndex.store(0, std::memory_order_release);
+    }
+
     m_data = SILENT_FRAMES;
 }
 
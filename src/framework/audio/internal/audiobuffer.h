@@ -25,6 +25,7 @@
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <functional>
 
 #include "iaudiosource.h"
 #include "audiotypes.h"
@@ -56,6 +57,34 @@ public:
     void pop(float* dest, size_t sampleCount);
     void setMinSamplesToReserve(size_t lag);
 
+    //! NOTE The additional readers (meters, taps) get the rendered frames in place, without holding the producer back.
+    //! A region stays valid until the next forward(), so the readers must be served on the worker thread
+    using ReaderId = int;
+    static constexpr ReaderId INVALID_READER = -1;
+
+    struct ReadRegion {
+        const float* data = nullptr;
+        size_t size = 0;
+        const float* wrappedData = nullptr;
+        size_t wrappedSize = 0;
+    };
+
+    ReaderId addReader();
+    void removeReader(ReaderId reader);
+    ReadRegion read(ReaderId reader);
+
+    uint64_t underrunCount() const;
+    uint64_t missedFramesCount() const;
+
+    //! NOTE In the low latency mode the buffer keeps only a couple of driver reads in reserve
+    //! instead of the half of its size
+    void setLowLatencyMode(bool enabled);
+    size_t framesToReserve() const;
+
+    //! NOTE Called from the driver thread, when the reserve falls below the required one
+    using DemandCallback = std::function<void ()>;
+    void setDemandCallback(const DemandCallback& callback);
+
     void reset();
 
 private:
@@ -63,11 +92,26 @@ private:
     size_t incrementWriteIndex(const size_t writeIdx, const samples_t samplesPerChannel);
 
     size_t m_minSamplesToReserve = 0;
+    std::atomic<bool> m_lowLatencyMode = false;
+
+    DemandCallback m_demandCallback = nullptr;
 
     alignas(cache_line_size) std::atomic<size_t> m_writeIndex = 0;
     alignas(cache_line_size) std::atomic<size_t> m_readIndex = 0;
     alignas(cache_line_size) std::vector<float> m_data;
 
+    static constexpr size_t MAX_READERS = 4;
+
+    struct Reader {
+        std::atomic<bool> used = false;
+        std::atomic<size_t> readIndex = 0;
+    };
+
+    alignas(cache_line_size) Reader m_readers[MAX_READERS];
+
+    std::atomic<uint64_t> m_underrunCount = 0;
+    std::atomic<uint64_t> m_missedFramesCount = 0;
+
     samples_t m_samplesPerChannel = 0;
     audioch_t m_audioChannelsCount = 0;
 
@@ -20,6 +20,9 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 #include "audioconfiguration.h"
+
+#include <algorithm>
+
 #include "settings.h"
 #include "stringutils.h"
 
@@ -43,6 +46,9 @@ static const Settings::Key AUDIO_API_KEY("audio", "io/audioApi");
 static const Settings::Key AUDIO_OUTPUT_DEVICE_ID_KEY("audio", "io/outputDevice");
 static const Settings::Key AUDIO_BUFFER_SIZE_KEY("audio", "io/bufferSize");
 static const Settings::Key AUDIO_SAMPLE_RATE_KEY("audio", "io/sampleRate");
+static const Settings::Key AUDIO_LOW_LATENCY_MODE_KEY("audio", "io/lowLatencyMode");
+static const Settings::Key AUDIO_AUTO_FREEZE_KEY("audio", "playback/autoFreeze");
+static const Settings::Key AUDIO_FROZEN_TRACKS_MEMORY_LIMIT_KEY("audio", "playback/frozenTracksMemoryLimitMb");
 
 static const Settings::Key USER_SOUNDFONTS_PATHS("midi", "application/paths/mySoundfonts");
 
@@ -74,6 +80,10 @@ void AudioConfiguration::init()
         m_driverSampleRateChanged.notify();
     });
 
+    settings()->setDefaultValue(AUDIO_LOW_LATENCY_MODE_KEY, Val(false));
+    settings()->setDefaultValue(AUDIO_AUTO_FREEZE_KEY, Val(false));
+    settings()->setDefaultValue(AUDIO_FROZEN_TRACKS_MEMORY_LIMIT_KEY, Val(512));
+
     settings()->setDefaultValue(USER_SOUNDFONTS_PATHS, Val(globalConfiguration()->userDataPath() + "/SoundFonts"));
     settings()->valueChanged(USER_SOUNDFONTS_PATHS).onReceive(nullptr, [this](const Val&) {
         m_soundFontDirsChanged.send(soundFontDirectories());
@@ -146,6 +156,36 @@ samples_t AudioConfiguration::renderStep() const
     return 512;
 }
 
+bool AudioConfiguration::isLowLatencyModeEnabled() const
+{
+    return settings()->value(AUDIO_LOW_LATENCY_MODE_KEY).toBool();
+}
+
+void AudioConfiguration::setLowLatencyModeEnabled(bool enabled)
+{
+    settings()->setSharedValue(AUDIO_LOW_LATENCY_MODE_KEY, Val(enabled));
+}
+
+bool AudioConfiguration::isAutoFreezeEnabled() const
+{
+    return settings()->value(AUDIO_AUTO_FREEZE_KEY).toBool();
+}
+
+void AudioConfiguration::setAutoFreezeEnabled(bool enabled)
+{
+    settings()->setSharedValue(AUDIO_AUTO_FREEZE_KEY, Val(enabled));
+}
+
+size_t AudioConfiguration::frozenTracksMemoryLimitMb() const
+{
+    return static_cast<size_t>(std::max(settings()->value(AUDIO_FROZEN_TRACKS_MEMORY_LIMIT_KEY).toInt(), 0));
+}
+
+void AudioConfiguration::setFrozenTracksMemoryLimitMb(size_t limit)
+{
+    settings()->setSharedValue(AUDIO_FROZEN_TRACKS_MEMORY_LIMIT_KEY, Val(static_cast<int>(limit)));
+}
+
 unsigned int AudioConfiguration::sampleRate() const
 {
     return settings()->value(AUDIO_SAMPLE_RATE_KEY).toInt();
@@ -53,6 +53,14 @@ public:
     async::Notification driverBufferSizeChanged() const override;
     samples_t renderStep() const override;
 
+    bool isLowLatencyModeEnabled() const override;
+    void setLowLatencyModeEnabled(bool enabled) override;
+
+    bool isAutoFreezeEnabled() const override;
+    void setAutoFreezeEnabled(bool enabled) override;
+    size_t frozenTracksMemoryLimitMb() const override;
+    void setFrozenTracksMemoryLimitMb(size_t limit) override;
+
     unsigned int sampleRate() const override;
     void setSampleRate(unsigned int sampleRate) override;
     async::Notification sampleRateChanged() const override;
@@ -39,6 +39,9 @@ public:
     static void setupWorkerThread();
     static std::thread::id workerThread();
     static bool isWorkerThread();
+
+    //! NOTE The threads of AudioWorkerPool, which process the audio blocks with the worker thread
+    static void setupWorkerPoolThread();
 };
 }
 
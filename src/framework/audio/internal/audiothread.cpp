@@ -25,6 +25,8 @@
 #include "runtime.h"
 #include "async/processevents.h"
 
+#include "internal/dsp/audiomathutils.h"
+
 #ifdef Q_OS_WASM
 #include <emscripten/html5.h>
 #endif
@@ -33,6 +35,9 @@ using namespace mu::audio;
 
 std::thread::id AudioThread::ID;
 
+//! NOTE The worker still has to process the incoming events when the driver doesn't ask for data
+static constexpr std::chrono::milliseconds MAX_IDLE_TIME(2);
+
 AudioThread::~AudioThread()
 {
     if (m_running) {
@@ -62,6 +67,7 @@ void AudioThread::stop(const Runnable& onFinished)
 {
     m_onFinished = onFinished;
     m_running = false;
+    wakeUp();
     if (m_thread) {
         m_thread->join();
     }
@@ -72,10 +78,20 @@ bool AudioThread::isRunning() const
     return m_running;
 }
 
+void AudioThread::wakeUp()
+{
+    //! NOTE Notifying without the lock, so the driver callback never blocks on the mutex;
+    //! a missed notification only costs us one idle timeout
+    m_wakeRequested.store(true, std::memory_order_release);
+    m_wakeCondition.notify_one();
+}
+
 void AudioThread::main()
 {
     mu::runtime::setThreadName("audio_worker");
 
+    dsp::setFlushDenormalsToZero();
+
     AudioThread::ID = std::this_thread::get_id();
 
     if (m_onStart) {
@@ -89,7 +105,11 @@ void AudioThread::main()
             m_mainLoopBody();
         }
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        std::unique_lock<std::mutex> lock(m_wakeMutex);
+        m_wakeCondition.wait_for(lock, MAX_IDLE_TIME, [this]() {
+            return m_wakeRequested.load(std::memory_order_acquire);
+        });
+        m_wakeRequested.store(false, std::memory_order_relaxed);
     }
 
     if (m_onFinished) {
@@ -27,6 +27,8 @@
 #include <thread>
 #include <atomic>
 #include <functional>
+#include <mutex>
+#include <condition_variable>
 
 namespace mu::audio {
 class AudioThread
@@ -43,6 +45,10 @@ public:
     void stop(const Runnable& onFinished = nullptr);
     bool isRunning() const;
 
+    //! NOTE Wakes the worker up before the idle timeout expires,
+    //! safe to call from the driver callback
+    void wakeUp();
+
 private:
     void main();
 
@@ -52,6 +58,10 @@ private:
 
     std::unique_ptr<std::thread> m_thread = nullptr;
     std::atomic<bool> m_running = false;
+
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wakeCondition;
+    std::atomic<bool> m_wakeRequested = false;
 };
 using AudioThreadPtr = std::shared_ptr<AudioThread>;
 }
@@ -24,8 +24,14 @@
 #define MU_AUDIO_AUDIOMATHUTILS_H
 
 #include <cstdlib>
+#include <cstdint>
 #include <limits>
 
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define MU_AUDIO_SSE_CONTROL_REGISTER
+#endif
+
 #include "audiotypes.h"
 
 namespace mu::audio::dsp {
@@ -70,6 +76,100 @@ inline void multiplySamples(float* buffer, const audioch_t& audioChannelsCount,
     }
 }
 
+//! NOTE The kernels below keep the loops flat and the accumulators independent,
+//! so the compiler can vectorize them on any target without the platform specific intrinsics
+
+inline void mixSamples(float* outBuffer, const float* inBuffer, const size_t samplesCount)
+{
+    for (size_t i = 0; i < samplesCount; ++i) {
+        outBuffer[i] += inBuffer[i];
+    }
+}
+
+//! NOTE The same multiplier for all the channels, the interleaved buffer is processed as a whole
+inline void multiplyAllSamples(float* buffer, const size_t samplesCount, const float multiplier)
+{
+    for (size_t i = 0; i < samplesCount; ++i) {
+        buffer[i] *= multiplier;
+    }
+}
+
+inline float applyGain(float* buffer, const audioch_t audioChannelsCount, const audioch_t audioChannelNumber,
+                       const samples_t samplesPerChannel, const gain_t gain)
+{
+    float squaredSum = 0.f;
+
+    for (samples_t s = 0; s < samplesPerChannel; ++s) {
+        size_t idx = s * audioChannelsCount + audioChannelNumber;
+
+        float resultSample = buffer[idx] * gain;
+        buffer[idx] = resultSample;
+        squaredSum += resultSample * resultSample;
+    }
+
+    return squaredSum;
+}
+
+inline void applyStereoGain(float* buffer, const samples_t samplesPerChannel, const gain_t leftGain, const gain_t rightGain,
+                            float& leftSquaredSum, float& rightSquaredSum)
+{
+    constexpr size_t LANES = 4;
+
+    float leftSums[LANES] = { 0.f };
+    float rightSums[LANES] = { 0.f };
+
+    samples_t s = 0;
+    for (; s + LANES <= samplesPerChannel; s += LANES) {
+        float* frames = buffer + s * 2;
+
+        for (size_t lane = 0; lane < LANES; ++lane) {
+            float left = frames[lane * 2] * leftGain;
+            float right = frames[lane * 2 + 1] * rightGain;
+
+            frames[lane * 2] = left;
+            frames[lane * 2 + 1] = right;
+
+            leftSums[lane] += left * left;
+            rightSums[lane] += right * right;
+        }
+    }
+
+    for (; s < samplesPerChannel; ++s) {
+        float left = buffer[s * 2] * leftGain;
+        float right = buffer[s * 2 + 1] * rightGain;
+
+        buffer[s * 2] = left;
+        buffer[s * 2 + 1] = right;
+
+        leftSums[0] += left * left;
+        rightSums[0] += right * right;
+    }
+
+    leftSquaredSum = (leftSums[0] + leftSums[1]) + (leftSums[2] + leftSums[3]);
+    rightSquaredSum = (rightSums[0] + rightSums[1]) + (rightSums[2] + rightSums[3]);
+}
+
+//! NOTE Makes the current thread treat the denormal floats as zero (FTZ/DAZ), the decaying tails
+//! of the reverbs and envelopes turn into denormals, which are extremely slow on most CPUs
+inline void setFlushDenormalsToZero()
+{
+#if defined(MU_AUDIO_SSE_CONTROL_REGISTER)
+    // FTZ is the bit 15, DAZ is the bit 6
+    _mm_setcsr(_mm_getcsr() | 0x8040);
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+    // FZ is the bit 24 of FPCR
+    uint64_t fpcr = 0;
+    __asm__ __volatile__ ("mrs %0, fpcr" : "=r" (fpcr));
+    __asm__ __volatile__ ("msr fpcr, %0" : : "r" (fpcr | (uint64_t(1) << 24)));
+#endif
+}
+
+//! NOTE For the recursive state, which must not decay into denormals even without FTZ (e.g. on WASM)
+inline float flushDenormal(const float value)
+{
+    return std::abs(value) < 1e-15f ? 0.f : value;
+}
+
 template<typename T>
 constexpr T convertFloatSamples(float value)
 {
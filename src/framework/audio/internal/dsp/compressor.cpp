@@ -67,15 +67,13 @@ void Compressor::process(const float linearRms, float* buffer, const audioch_t&
 
     float dbDiff = computeGain(dbGain) - dbGain;
 
-    m_feedbackGain = dbDiff;
+    m_feedbackGain = flushDenormal(dbDiff);
     float gainFact = linearFromDecibels(dbDiff * (1.f + m_feedbackFactor));
 
     float currentGainReduction = std::min(gainFact, m_previousGainReduction);
 
     // apply gain
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount; ++audioChNum) {
-        multiplySamples(buffer, audioChannelsCount, audioChNum, samplesPerChannel, currentGainReduction);
-    }
+    multiplyAllSamples(buffer, samplesPerChannel * audioChannelsCount, currentGainReduction);
 
-    m_previousGainReduction = currentGainReduction;
+    m_previousGainReduction = flushDenormal(currentGainReduction);
 }
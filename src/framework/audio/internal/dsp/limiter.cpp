@@ -64,7 +64,7 @@ void Limiter::process(const float& linearRms, float* buffer, const audioch_t& au
 
     // gain smoothing
     float smoothedGain = gainSmoothing(computedGain);
-    m_previousGainReduction = smoothedGain;
+    m_previousGainReduction = flushDenormal(smoothedGain);
 
     // gain make-up
     float makeUpGain = smoothedGain + m_filterConfig.makeUpGain();
@@ -73,7 +73,5 @@ void Limiter::process(const float& linearRms, float* buffer, const audioch_t& au
     float totalLinearGain = linearFromDecibels(makeUpGain);
 
     // apply linear gain
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount; ++audioChNum) {
-        multiplySamples(buffer, audioChannelsCount, audioChNum, samplesPerChannel, totalLinearGain);
-    }
+    multiplyAllSamples(buffer, samplesPerChannel * audioChannelsCount, totalLinearGain);
 }
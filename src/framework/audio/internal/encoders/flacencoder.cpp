@@ -22,6 +22,8 @@
 
 #include "flacencoder.h"
 
+#include <algorithm>
+
 #include "FLAC++/encoder.h"
 
 #include "log.h"
@@ -108,19 +110,17 @@ size_t FlacEncoder::encode(samples_t samplesPerChannel, const float* input)
     uint32_t frameSize = 1024;
     size_t stepSize = frameSize * m_format.audioChannelsNumber;
 
-    std::vector<FLAC__int32> buff(samplesPerChannel * sizeof(float));
+    std::vector<FLAC__int32> buff(totalSamplesNumber);
 
     for (size_t i = 0; i < buff.size(); ++i) {
         buff[i] = static_cast<FLAC__int32>(dsp::convertFloatSamples<FLAC__int16>(input[i]));
     }
 
-    std::vector<FLAC__int32> intermBuff(stepSize);
-
     for (size_t i = 0; i < totalSamplesNumber; i += stepSize) {
-        std::copy(buff.data() + i, buff.data() + i + stepSize, intermBuff.data());
+        size_t samplesCount = std::min(stepSize, totalSamplesNumber - i);
 
-        if (m_flac->process_interleaved(intermBuff.data(), frameSize)) {
-            result += stepSize;
+        if (m_flac->process_interleaved(buff.data() + i, samplesCount / m_format.audioChannelsNumber)) {
+            result += samplesCount;
         } else {
             break;
         }
@@ -32,7 +32,7 @@ using namespace mu::audio::encode;
 size_t OggEncoder::encode(samples_t samplesPerChannel, const float* input)
 {
     m_progress.progressChanged.send(0, 100, "");
-    int code = ope_encoder_write_float(m_opusEncoder, input, samplesPerChannel + m_format.sampleRate * 2);
+    int code = ope_encoder_write_float(m_opusEncoder, input, samplesPerChannel);
     m_progress.progressChanged.send(100, 100, "");
 
     return code == OPE_OK ? samplesPerChannel : 0;
@@ -40,7 +40,8 @@ size_t OggEncoder::encode(samples_t samplesPerChannel, const float* input)
 
 size_t OggEncoder::flush()
 {
-    return ope_encoder_flush_header(m_opusEncoder);
+    //! NOTE Drains the samples buffered by the encoder, so the end of the sound track isn't cut off
+    return ope_encoder_drain(m_opusEncoder);
 }
 
 size_t OggEncoder::requiredOutputBufferSize(samples_t /*totalSamplesNumber*/) const
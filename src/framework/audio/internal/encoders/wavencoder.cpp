@@ -22,6 +22,7 @@
 
 #include "wavencoder.h"
 
+#include <algorithm>
 #include <map>
 
 #include "async/async.h"
@@ -99,23 +100,17 @@ size_t WavEncoder::encode(samples_t samplesPerChannel, const float* input)
 
     header.write(m_fileStream);
 
-    int total = header.samplesPerChannel;
-    int progressStep = (total * 5) / 100; // every 5%
-    QVector<samples_t> progressValues;
-    for (samples_t sampleIdx = 0; sampleIdx < header.samplesPerChannel;) {
-        progressValues << sampleIdx;
-        sampleIdx += progressStep;
-    }
+    //! NOTE The input is already interleaved 32 bit float, so it's written by chunks of 5% of the total
+    samples_t total = header.samplesPerChannel;
+    samples_t progressStep = std::max<samples_t>((total * 5) / 100, 1);
 
-    for (samples_t sampleIdx = 0; sampleIdx < header.samplesPerChannel; ++sampleIdx) {
-        for (audioch_t audioChNum = 0; audioChNum < m_format.audioChannelsNumber; ++audioChNum) {
-            int idx = sampleIdx * m_format.audioChannelsNumber + audioChNum;
-            m_fileStream.write(reinterpret_cast<const char*>(input + idx), 4);
-        }
+    for (samples_t sampleIdx = 0; sampleIdx < total; sampleIdx += progressStep) {
+        samples_t samplesCount = std::min(progressStep, total - sampleIdx);
 
-        if (progressValues.contains(sampleIdx)) {
-            m_progress.progressChanged.send(sampleIdx, total, "");
-        }
+        m_fileStream.write(reinterpret_cast<const char*>(input + sampleIdx * m_format.audioChannelsNumber),
+                           samplesCount * m_format.audioChannelsNumber * sizeof(float));
+
+        m_progress.progressChanged.send(sampleIdx, total, "");
     }
 
     return samplesPerChannel * m_format.audioChannelsNumber;
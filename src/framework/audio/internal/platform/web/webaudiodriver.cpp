@@ -22,11 +22,17 @@
 #include "webaudiodriver.h"
 #include "log.h"
 
+#include "config.h"
+
 #include <emscripten.h>
 #include <emscripten/val.h>
 #include <emscripten/bind.h>
 #include <emscripten/html5.h>
 
+#ifdef BUILD_WASM_AUDIO_WORKLET
+#include <emscripten/webaudio.h>
+#endif
+
 using namespace mu::audio;
 using namespace emscripten;
 
@@ -60,6 +66,91 @@ void audioCallback(emscripten::val event)
     }
 }
 
+#ifdef BUILD_WASM_AUDIO_WORKLET
+//! NOTE The worklet only takes the rendered frames out of the audio buffer, in fixed quanta of frames.
+//! The buffer is still filled by the audio thread loop, which runs on the main browser thread
+static constexpr int WORKLET_FRAMES = 128;
+static constexpr int WORKLET_STACK_SIZE = 64 * 1024;
+static const char* WORKLET_PROCESSOR_NAME = "musescore-audio";
+
+static EMSCRIPTEN_WEBAUDIO_T workletContext = 0;
+alignas(16) static uint8_t workletStack[WORKLET_STACK_SIZE];
+
+EM_BOOL workletProcess(int /*numInputs*/, const AudioSampleFrame* /*inputs*/, int numOutputs, AudioSampleFrame* outputs,
+                       int /*numParams*/, const AudioParamFrame* /*params*/, void* /*userData*/)
+{
+    if (!format || numOutputs < 1) {
+        return EM_TRUE;
+    }
+
+    AudioSampleFrame& output = outputs[0];
+    int channels = output.numberOfChannels;
+    int sampleCount = WORKLET_FRAMES * channels;
+
+    //! NOTE The buffer is allocated on open, nothing is allocated in the worklet thread
+    if (static_cast<int>(buffer.size()) < sampleCount) {
+        std::fill(output.data, output.data + sampleCount, 0.f);
+        return EM_TRUE;
+    }
+
+    format->callback(nullptr, reinterpret_cast<uint8_t*>(buffer.data()), sampleCount * sizeof(float));
+
+    //! NOTE The engine renders interleaved samples, the worklet outputs are planar
+    for (int j = 0; j < channels; ++j) {
+        float* channelData = output.data + j * WORKLET_FRAMES;
+        for (int i = 0; i < WORKLET_FRAMES; ++i) {
+            channelData[i] = buffer[i * channels + j];
+        }
+    }
+
+    return EM_TRUE;
+}
+
+void onWorkletProcessorCreated(EMSCRIPTEN_WEBAUDIO_T ctx, EM_BOOL success, void* /*userData*/)
+{
+    if (!success) {
+        LOGE() << "can't create audio worklet processor";
+        return;
+    }
+
+    int outputChannelCounts[1] = { format->channels };
+
+    EmscriptenAudioWorkletNodeCreateOptions options;
+    options.numberOfInputs = 0;
+    options.numberOfOutputs = 1;
+    options.outputChannelCounts = outputChannelCounts;
+
+    EMSCRIPTEN_AUDIO_WORKLET_NODE_T node = emscripten_create_wasm_audio_worklet_node(ctx, WORKLET_PROCESSOR_NAME, &options,
+                                                                                     &workletProcess, nullptr);
+
+    EM_ASM({
+        emscriptenGetAudioObject($0).connect(emscriptenGetAudioObject($1).destination);
+    }, node, ctx);
+}
+
+void onWorkletThreadStarted(EMSCRIPTEN_WEBAUDIO_T ctx, EM_BOOL success, void* /*userData*/)
+{
+    if (!success) {
+        LOGE() << "can't start audio worklet thread";
+        return;
+    }
+
+    WebAudioWorkletProcessorCreateOptions options;
+    options.name = WORKLET_PROCESSOR_NAME;
+    options.numAudioParams = 0;
+    options.audioParamDescriptors = nullptr;
+
+    emscripten_create_wasm_audio_worklet_processor_async(ctx, &options, &onWorkletProcessorCreated, nullptr);
+}
+
+EM_BOOL mouseCallback(int eventType, const EmscriptenMouseEvent* e, void* userData)
+{
+    if (emscripten_audio_context_state(workletContext) != AUDIO_CONTEXT_STATE_RUNNING) {
+        emscripten_resume_audio_context_sync(workletContext);
+    }
+    return true;
+}
+#else
 EM_BOOL mouseCallback(int eventType, const EmscriptenMouseEvent* e, void* userData)
 {
     if (context["state"].as<std::string>() == std::string("suspended")) {
@@ -67,6 +158,7 @@ EM_BOOL mouseCallback(int eventType, const EmscriptenMouseEvent* e, void* userDa
     }
     return true;
 }
+#endif
 }
 EMSCRIPTEN_BINDINGS(events)
 {
@@ -88,6 +180,23 @@ bool WebAudioDriver::open(const Spec& spec, Spec* activeSpec)
         return true;
     }
 
+#ifdef BUILD_WASM_AUDIO_WORKLET
+    web::workletContext = emscripten_create_audio_context(nullptr);
+
+    *activeSpec = spec;
+    activeSpec->format = Format::AudioF32;
+    activeSpec->sampleRate = EM_ASM_INT({
+        return emscriptenGetAudioObject($0).sampleRate;
+    }, web::workletContext);
+    //! NOTE The worklet quantum is smaller than the buffer size, which sets how much the audio buffer reserves
+    activeSpec->samples = spec.samples;
+    web::format = activeSpec;
+
+    web::buffer.resize(web::WORKLET_FRAMES * spec.channels, 0.f);
+
+    emscripten_start_wasm_audio_worklet_thread_async(web::workletContext, web::workletStack, sizeof(web::workletStack),
+                                                     &web::onWorkletThreadStarted, nullptr);
+#else
     auto AudioContext = val::global("AudioContext");
     if (!AudioContext.as<bool>()) {
         AudioContext = val::global("webkitAudioContext");
@@ -109,6 +218,7 @@ bool WebAudioDriver::open(const Spec& spec, Spec* activeSpec)
 
     audioNode.set("onaudioprocess", val::module_property("audioCallback"));
     audioNode.call<val>("connect", web::context["destination"]);
+#endif
 
     emscripten_set_mousedown_callback(EMSCRIPTEN_EVENT_TARGET_WINDOW, nullptr, true, web::mouseCallback);
     m_opened = true;
@@ -117,7 +227,13 @@ bool WebAudioDriver::open(const Spec& spec, Spec* activeSpec)
 
 void WebAudioDriver::close()
 {
+#ifdef BUILD_WASM_AUDIO_WORKLET
+    EM_ASM({
+        emscriptenGetAudioObject($0).close();
+    }, web::workletContext);
+#else
     web::context.call<val>("close");
+#endif
 }
 
 bool WebAudioDriver::isOpened() const
@@ -151,10 +267,20 @@ mu::async::Notification WebAudioDriver::availableOutputDevicesChanged() const
 
 void WebAudioDriver::resume()
 {
+#ifdef BUILD_WASM_AUDIO_WORKLET
+    emscripten_resume_audio_context_sync(web::workletContext);
+#else
     web::context.call<val>("resume");
+#endif
 }
 
 void WebAudioDriver::suspend()
 {
+#ifdef BUILD_WASM_AUDIO_WORKLET
+    EM_ASM({
+        emscriptenGetAudioObject($0).suspend();
+    }, web::workletContext);
+#else
     web::context.call<val>("suspend");
+#endif
 }
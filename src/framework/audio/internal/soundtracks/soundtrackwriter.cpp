@@ -23,6 +23,7 @@
 #include "soundtrackwriter.h"
 
 #include "internal/worker/audioengine.h"
+#include "internal/worker/audioworkerpool.h"
 #include "internal/encoders/mp3encoder.h"
 #include "internal/encoders/oggencoder.h"
 #include "internal/encoders/flacencoder.h"
@@ -40,43 +41,65 @@ static constexpr int ENCODE_STEP = 1;
 
 SoundTrackWriter::SoundTrackWriter(const io::path_t& destination, const SoundTrackFormat& format, const msecs_t totalDuration,
                                    IAudioSourcePtr source)
+    : SoundTrackWriter({ SoundTrackDestination { destination, format } }, totalDuration, std::move(source))
+{
+}
+
+SoundTrackWriter::SoundTrackWriter(const SoundTrackDestinations& destinations, const msecs_t totalDuration, IAudioSourcePtr source)
     : m_source(std::move(source))
 {
-    if (!m_source) {
+    if (!m_source || destinations.empty()) {
         return;
     }
 
-    samples_t totalSamplesNumber = (totalDuration / 1000000.f) * sizeof(float) * format.sampleRate;
+    //! NOTE The audio is rendered once for all the destinations
+    sample_rate_t sampleRate = destinations.front().format.sampleRate;
+    samples_t totalSamplesNumber = (totalDuration / 1000000.f) * sampleRate * config()->audioChannelsCount();
     m_inputBuffer.resize(totalSamplesNumber);
     m_intermBuffer.resize(config()->renderStep() * config()->audioChannelsCount());
 
-    m_encoderPtr = createEncoder(format.type);
-
-    if (!m_encoderPtr) {
-        return;
+    for (const SoundTrackDestination& destination : destinations) {
+        if (destination.format.sampleRate != sampleRate) {
+            LOGE() << "The formats of the destinations have different sample rates";
+            m_encoders.clear();
+            return;
+        }
+
+        encode::AbstractAudioEncoderPtr encoder = createEncoder(destination.format.type);
+        if (!encoder) {
+            m_encoders.clear();
+            return;
+        }
+
+        encoder->init(destination.path, destination.format, totalSamplesNumber);
+        m_encoders.push_back(std::move(encoder));
     }
 
-    m_encoderPtr->init(destination, format, totalSamplesNumber);
-    m_encoderPtr->progress().progressChanged.onReceive(this, [this](int64_t current, int64_t total, std::string) {
-        sendStepProgress(ENCODE_STEP, current, total);
-    });
+    //! NOTE Several encoders run on the workers, which can't notify, the progress is sent when all of them are done
+    if (m_encoders.size() == 1) {
+        m_encoders.front()->progress().progressChanged.onReceive(this, [this](int64_t current, int64_t total, std::string) {
+            sendStepProgress(ENCODE_STEP, current, total);
+        });
+    }
 }
 
 bool SoundTrackWriter::write()
 {
     TRACEFUNC;
 
-    if (!m_source || !m_encoderPtr) {
+    if (!m_source || m_encoders.empty()) {
         return false;
     }
 
     AudioEngine::instance()->setMode(RenderMode::OfflineMode);
 
-    m_source->setSampleRate(m_encoderPtr->format().sampleRate);
+    m_source->setSampleRate(m_encoders.front()->format().sampleRate);
     m_source->setIsActive(true);
 
     DEFER {
-        m_encoderPtr->flush();
+        for (encode::AbstractAudioEncoderPtr& encoder : m_encoders) {
+            encoder->flush();
+        }
 
         AudioEngine::instance()->setMode(RenderMode::RealTimeMode);
 
@@ -88,11 +111,7 @@ bool SoundTrackWriter::write()
         return false;
     }
 
-    if (m_encoderPtr->encode(m_inputBuffer.size() / sizeof(float), m_inputBuffer.data()) == 0) {
-        return false;
-    }
-
-    return true;
+    return encodeInputBuffer();
 }
 
 framework::Progress SoundTrackWriter::progress()
@@ -141,10 +160,44 @@ bool SoundTrackWriter::prepareInputBuffer()
     return true;
 }
 
+bool SoundTrackWriter::encodeInputBuffer()
+{
+    samples_t samplesPerChannel = m_inputBuffer.size() / config()->audioChannelsCount();
+
+    if (m_encoders.size() == 1) {
+        return m_encoders.front()->encode(samplesPerChannel, m_inputBuffer.data()) != 0;
+    }
+
+    struct EncodeContext {
+        SoundTrackWriter* writer = nullptr;
+        samples_t samplesPerChannel = 0;
+        std::vector<size_t> encodedSizes;
+    };
+
+    EncodeContext context { this, samplesPerChannel, std::vector<size_t>(m_encoders.size(), 0) };
+
+    AudioWorkerPool::instance()->run([](void* data, size_t jobIdx) {
+        EncodeContext* ctx = static_cast<EncodeContext*>(data);
+        SoundTrackWriter* writer = ctx->writer;
+        ctx->encodedSizes[jobIdx] = writer->m_encoders[jobIdx]->encode(ctx->samplesPerChannel, writer->m_inputBuffer.data());
+    }, &context, m_encoders.size());
+
+    sendStepProgress(ENCODE_STEP, 1, 1);
+
+    return std::find(context.encodedSizes.cbegin(), context.encodedSizes.cend(), 0) == context.encodedSizes.cend();
+}
+
 void SoundTrackWriter::sendStepProgress(int step, int64_t current, int64_t total)
 {
     int stepRange = step == PREPARE_STEP ? 80 : 20;
     int stepProgressStart = step == PREPARE_STEP ? 0 : 80;
     int stepCurrentProgress = stepProgressStart + ((current * 100 / total) * stepRange) / 100;
+
+    //! NOTE The progress is reported after every render step, so notify only when the percentage changes
+    if (stepCurrentProgress == m_lastProgress) {
+        return;
+    }
+
+    m_lastProgress = stepCurrentProgress;
     m_progress.progressChanged.send(stepCurrentProgress, 100, "");
 }
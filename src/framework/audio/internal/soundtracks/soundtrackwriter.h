@@ -40,6 +40,7 @@ class SoundTrackWriter : public async::Asyncable
     INJECT_STATIC(audio, IAudioConfiguration, config)
 public:
     SoundTrackWriter(const io::path_t& destination, const SoundTrackFormat& format, const msecs_t totalDuration, IAudioSourcePtr source);
+    SoundTrackWriter(const SoundTrackDestinations& destinations, const msecs_t totalDuration, IAudioSourcePtr source);
 
     bool write();
     framework::Progress progress();
@@ -47,6 +48,7 @@ public:
 private:
     encode::AbstractAudioEncoderPtr createEncoder(const SoundTrackType& type) const;
     bool prepareInputBuffer();
+    bool encodeInputBuffer();
 
     void sendStepProgress(int step, int64_t current, int64_t total);
 
@@ -55,9 +57,10 @@ private:
     std::vector<float> m_inputBuffer;
     std::vector<float> m_intermBuffer;
 
-    encode::AbstractAudioEncoderPtr m_encoderPtr = nullptr;
+    std::vector<encode::AbstractAudioEncoderPtr> m_encoders;
 
     framework::Progress m_progress;
+    int m_lastProgress = -1;
 };
 }
 
@@ -34,6 +34,8 @@
 #include "sfcachedloader.h"
 #include "audioerrors.h"
 #include "audiotypes.h"
+#include "internal/worker/audioworkerpool.h"
+#include "internal/dsp/audiomathutils.h"
 
 using namespace mu;
 using namespace mu::midi;
@@ -50,15 +52,51 @@ static constexpr msecs_t MIN_NOTE_LENGTH = 10;
 /// @see https://www.fluidsynth.org/api/settings_synth.html
 static const audioch_t FLUID_AUDIO_CHANNELS_PAIR = 1;
 
+//! NOTE The midi channels of an instrument with many articulations and voices are split across several fluid instances,
+//! which share the sound fonts loaded once in SoundFontCache and render in parallel
+static constexpr midi::channel_t CHANNELS_PER_PARTITION = 4;
+static constexpr size_t MAX_PARTITIONS_COUNT = 4;
+
 struct mu::audio::synth::Fluid {
     fluid_settings_t* settings = nullptr;
-    fluid_synth_t* synth = nullptr;
+
+    //! NOTE The first one is the main instance, it renders the channels [0, CHANNELS_PER_PARTITION)
+    std::vector<fluid_synth_t*> synths;
+
+    float* outBuffer = nullptr;
+    samples_t samplesToRender = 0;
+    std::vector<float> partitionsBuffer;
+    std::vector<int> partitionsResult;
 
     ~Fluid()
     {
-        delete_fluid_synth(synth);
+        deleteSynths();
         delete_fluid_settings(settings);
     }
+
+    fluid_synth_t* mainSynth() const
+    {
+        return synths.empty() ? nullptr : synths.front();
+    }
+
+    fluid_synth_t* synthForChannel(const midi::channel_t channelIdx) const
+    {
+        if (synths.empty()) {
+            return nullptr;
+        }
+
+        size_t partitionIdx = std::min<size_t>(channelIdx / CHANNELS_PER_PARTITION, synths.size() - 1);
+        return synths.at(partitionIdx);
+    }
+
+    void deleteSynths()
+    {
+        for (fluid_synth_t* synth : synths) {
+            delete_fluid_synth(synth);
+        }
+
+        synths.clear();
+    }
 };
 
 FluidSynth::FluidSynth(const AudioSourceParams& params)
@@ -71,7 +109,7 @@ FluidSynth::FluidSynth(const AudioSourceParams& params)
 
 bool FluidSynth::isValid() const
 {
-    return m_fluid->synth != nullptr;
+    return m_fluid->mainSynth() != nullptr;
 }
 
 SoundFontFormats FluidSynth::soundFontFormats() const
@@ -151,24 +189,54 @@ Ret FluidSynth::init()
 
 void FluidSynth::createFluidInstance()
 {
-    m_fluid->synth = new_fluid_synth(m_fluid->settings);
+    fluid_synth_t* synth = new_fluid_synth(m_fluid->settings);
+    if (!synth) {
+        return;
+    }
 
     fluid_sfloader_t* sfloader = new_fluid_sfloader(loadSoundFont, delete_fluid_sfloader);
 
     fluid_sfloader_set_data(sfloader, m_fluid->settings);
-    fluid_synth_add_sfloader(m_fluid->synth, sfloader);
+    fluid_synth_add_sfloader(synth, sfloader);
+
+    m_fluid->synths.push_back(synth);
+}
+
+void FluidSynth::addPartitionsForChannel(const midi::channel_t channelIdx)
+{
+    size_t requiredCount = std::min<size_t>(channelIdx / CHANNELS_PER_PARTITION + 1, MAX_PARTITIONS_COUNT);
+
+    while (m_fluid->synths.size() < requiredCount) {
+        size_t oldCount = m_fluid->synths.size();
+        createFluidInstance();
+
+        if (m_fluid->synths.size() == oldCount) {
+            LOGE() << "failed to create a fluid partition for the channel: " << channelIdx;
+            return;
+        }
+
+        //! NOTE The sound fonts are taken from the cache, so they are not loaded again
+        fluid_synth_t* synth = m_fluid->synths.back();
+        for (const io::path_t& sfont : m_sfontPaths) {
+            fluid_synth_sfload(synth, sfont.c_str(), 0);
+        }
+
+        fluid_synth_activate_key_tuning(synth, 0, 0, "standard", NULL, true);
+    }
 }
 
 bool FluidSynth::handleEvent(const midi::Event& event)
 {
+    fluid_synth_t* synth = m_fluid->synthForChannel(event.channel());
+
     int ret = FLUID_OK;
     switch (event.opcode()) {
     case Event::Opcode::NoteOn: {
-        ret = fluid_synth_noteon(m_fluid->synth, event.channel(), event.note(), event.velocity());
+        ret = fluid_synth_noteon(synth, event.channel(), event.note(), event.velocity());
         m_tuning.add(event.note(), event.pitchTuningCents());
     } break;
     case Event::Opcode::NoteOff: {
-        ret = fluid_synth_noteoff(m_fluid->synth, event.channel(), event.note());
+        ret = fluid_synth_noteoff(synth, event.channel(), event.note());
         m_tuning.add(event.note(), event.pitchTuningCents());
     } break;
     case Event::Opcode::ControlChange: {
@@ -179,10 +247,10 @@ bool FluidSynth::handleEvent(const midi::Event& event)
         }
     } break;
     case Event::Opcode::ProgramChange: {
-        fluid_synth_program_change(m_fluid->synth, event.channel(), event.program());
+        fluid_synth_program_change(synth, event.channel(), event.program());
     } break;
     case Event::Opcode::PitchBend: {
-        ret = fluid_synth_pitch_bend(m_fluid->synth, event.channel(), event.data());
+        ret = fluid_synth_pitch_bend(synth, event.channel(), event.data());
     } break;
     default: {
         LOGD() << "not supported event type: " << event.opcodeString();
@@ -206,9 +274,8 @@ void FluidSynth::setSampleRate(unsigned int sampleRate)
         fluid_settings_setnum(m_fluid->settings, "synth.sample-rate", static_cast<double>(m_sampleRate));
     }
 
-    if (m_fluid->synth) {
-        delete_fluid_synth(m_fluid->synth);
-    }
+    //! NOTE The partitions are made again by setupSound
+    m_fluid->deleteSynths();
 
     createFluidInstance();
     addSoundFonts(std::vector<io::path_t>(m_sfontPaths.cbegin(), m_sfontPaths.cend()));
@@ -217,18 +284,22 @@ void FluidSynth::setSampleRate(unsigned int sampleRate)
 
 Ret FluidSynth::addSoundFonts(const std::vector<io::path_t>& sfonts)
 {
-    IF_ASSERT_FAILED(m_fluid->synth) {
+    IF_ASSERT_FAILED(m_fluid->mainSynth()) {
         return make_ret(Err::SynthNotInited);
     }
 
     bool ok = true;
     for (const io::path_t& sfont : sfonts) {
-        if (fluid_synth_sfload(m_fluid->synth, sfont.c_str(), 0) == FLUID_FAILED) {
+        if (fluid_synth_sfload(m_fluid->mainSynth(), sfont.c_str(), 0) == FLUID_FAILED) {
             LOGE() << "failed load soundfont: " << sfont;
             ok = false;
             continue;
         }
 
+        for (size_t i = 1; i < m_fluid->synths.size(); ++i) {
+            fluid_synth_sfload(m_fluid->synths.at(i), sfont.c_str(), 0);
+        }
+
         LOGI() << "success load soundfont: " << sfont;
         m_sfontPaths.insert(sfont);
     }
@@ -248,22 +319,27 @@ AudioSourceType FluidSynth::type() const
 
 void FluidSynth::setupSound(const PlaybackSetupData& setupData)
 {
-    IF_ASSERT_FAILED(m_fluid->synth) {
+    IF_ASSERT_FAILED(m_fluid->mainSynth()) {
         return;
     }
 
-    fluid_synth_activate_key_tuning(m_fluid->synth, 0, 0, "standard", NULL, true);
+    for (fluid_synth_t* synth : m_fluid->synths) {
+        fluid_synth_activate_key_tuning(synth, 0, 0, "standard", NULL, true);
+    }
 
     auto setupChannel = [this](const midi::channel_t channelIdx, const midi::Program& program) {
-        fluid_synth_set_interp_method(m_fluid->synth, channelIdx, FLUID_INTERP_DEFAULT);
-        fluid_synth_pitch_wheel_sens(m_fluid->synth, channelIdx, 24);
-        fluid_synth_bank_select(m_fluid->synth, channelIdx, program.bank);
-        fluid_synth_program_change(m_fluid->synth, channelIdx, program.program);
-        fluid_synth_cc(m_fluid->synth, channelIdx, 7, DEFAULT_MIDI_VOLUME);
-        fluid_synth_cc(m_fluid->synth, channelIdx, 74, 0);
-        fluid_synth_set_portamento_mode(m_fluid->synth, channelIdx, FLUID_CHANNEL_PORTAMENTO_MODE_EACH_NOTE);
-        fluid_synth_set_legato_mode(m_fluid->synth, channelIdx, FLUID_CHANNEL_LEGATO_MODE_RETRIGGER);
-        fluid_synth_activate_tuning(m_fluid->synth, channelIdx, 0, 0, 0);
+        addPartitionsForChannel(channelIdx);
+
+        fluid_synth_t* synth = m_fluid->synthForChannel(channelIdx);
+        fluid_synth_set_interp_method(synth, channelIdx, FLUID_INTERP_DEFAULT);
+        fluid_synth_pitch_wheel_sens(synth, channelIdx, 24);
+        fluid_synth_bank_select(synth, channelIdx, program.bank);
+        fluid_synth_program_change(synth, channelIdx, program.program);
+        fluid_synth_cc(synth, channelIdx, 7, DEFAULT_MIDI_VOLUME);
+        fluid_synth_cc(synth, channelIdx, 74, 0);
+        fluid_synth_set_portamento_mode(synth, channelIdx, FLUID_CHANNEL_PORTAMENTO_MODE_EACH_NOTE);
+        fluid_synth_set_legato_mode(synth, channelIdx, FLUID_CHANNEL_LEGATO_MODE_RETRIGGER);
+        fluid_synth_activate_tuning(synth, channelIdx, 0, 0, 0);
     };
 
     m_sequencer.channelAdded().onReceive(this, setupChannel);
@@ -284,23 +360,37 @@ void FluidSynth::setupEvents(const mpe::PlaybackData& playbackData)
 
 void FluidSynth::revokePlayingNotes()
 {
-    IF_ASSERT_FAILED(m_fluid->synth) {
+    IF_ASSERT_FAILED(m_fluid->mainSynth()) {
         return;
     }
 
-    fluid_synth_all_notes_off(m_fluid->synth, -1);
+    for (fluid_synth_t* synth : m_fluid->synths) {
+        fluid_synth_all_notes_off(synth, -1);
+    }
+}
+
+unsigned int FluidSynth::activeVoicesCount() const
+{
+    int count = 0;
+    for (fluid_synth_t* synth : m_fluid->synths) {
+        count += fluid_synth_get_active_voice_count(synth);
+    }
+
+    return static_cast<unsigned int>(std::max(count, 0));
 }
 
 void FluidSynth::flushSound()
 {
-    IF_ASSERT_FAILED(m_fluid->synth) {
+    IF_ASSERT_FAILED(m_fluid->mainSynth()) {
         return;
     }
 
     revokePlayingNotes();
 
-    fluid_synth_all_sounds_off(m_fluid->synth, -1);
-    fluid_synth_cc(m_fluid->synth, -1, 121, 127);
+    for (fluid_synth_t* synth : m_fluid->synths) {
+        fluid_synth_all_sounds_off(synth, -1);
+        fluid_synth_cc(synth, -1, 121, 127);
+    }
 }
 
 bool FluidSynth::isActive() const
@@ -335,35 +425,95 @@ unsigned int FluidSynth::audioChannelsCount() const
 
 samples_t FluidSynth::process(float* buffer, samples_t samplesPerChannel)
 {
-    IF_ASSERT_FAILED(samplesPerChannel > 0) {
+    IF_ASSERT_FAILED(samplesPerChannel > 0 && m_fluid->mainSynth()) {
         return 0;
     }
 
     msecs_t nextMsecs = samplesToMsecs(samplesPerChannel, m_sampleRate);
 
-    const FluidSequencer::EventSequence& sequence = m_sequencer.eventsToBePlayed(nextMsecs);
+    const FluidSequencer::EventSequenceMap sequences = m_sequencer.eventsToBePlayed(nextMsecs);
+
+    //! NOTE The block is rendered in parts between the events, so each event starts at its own sample
+    //! (fluid itself still quantizes them to its internal 64 samples blocks)
+    samples_t renderedSamples = 0;
+    const unsigned int channelCount = audioChannelsCount();
+
+    for (const auto& pair : sequences) {
+        samples_t eventSample = std::min(microSecsToSamples(pair.first, m_sampleRate), samplesPerChannel);
+
+        if (eventSample > renderedSamples) {
+            if (!render(buffer + renderedSamples * channelCount, eventSample - renderedSamples)) {
+                return 0;
+            }
+
+            renderedSamples = eventSample;
+        }
 
-    if (!sequence.empty()) {
         m_tuning.reset();
+
+        for (const FluidSequencer::EventType& event : pair.second) {
+            handleEvent(std::get<midi::Event>(event));
+        }
     }
 
-    for (const FluidSequencer::EventType& event : sequence) {
-        handleEvent(std::get<midi::Event>(event));
+    if (renderedSamples < samplesPerChannel) {
+        if (!render(buffer + renderedSamples * channelCount, samplesPerChannel - renderedSamples)) {
+            return 0;
+        }
     }
 
-    fluid_synth_tune_notes(m_fluid->synth, 0, 0, m_tuning.size(), m_tuning.keys.data(), m_tuning.pitches.data(), true);
+    return samplesPerChannel;
+}
 
-    unsigned int channelCount = audioChannelsCount();
+bool FluidSynth::render(float* buffer, samples_t samplesPerChannel)
+{
+    //! NOTE Besides, the api calls release the finished voices, which must not happen while the partitions render in parallel,
+    //! because the samples of the shared sound fonts are reference counted
+    for (fluid_synth_t* synth : m_fluid->synths) {
+        fluid_synth_tune_notes(synth, 0, 0, m_tuning.size(), m_tuning.keys.data(), m_tuning.pitches.data(), true);
+    }
 
-    int result = fluid_synth_write_float(m_fluid->synth, samplesPerChannel,
-                                         buffer, 0, channelCount,
-                                         buffer, 1, channelCount);
+    const size_t partitionsCount = m_fluid->synths.size();
+    const size_t samplesCount = samplesPerChannel * audioChannelsCount();
 
-    if (result != FLUID_OK) {
-        return 0;
+    if (m_fluid->partitionsBuffer.size() < (partitionsCount - 1) * samplesCount) {
+        m_fluid->partitionsBuffer.resize((partitionsCount - 1) * samplesCount);
     }
 
-    return samplesPerChannel;
+    m_fluid->partitionsResult.resize(partitionsCount);
+    m_fluid->outBuffer = buffer;
+    m_fluid->samplesToRender = samplesPerChannel;
+
+    AudioWorkerPool::instance()->run(&FluidSynth::renderPartition, m_fluid.get(), partitionsCount);
+
+    for (size_t i = 0; i < partitionsCount; ++i) {
+        if (m_fluid->partitionsResult[i] != FLUID_OK) {
+            return false;
+        }
+    }
+
+    for (size_t i = 1; i < partitionsCount; ++i) {
+        dsp::mixSamples(buffer, m_fluid->partitionsBuffer.data() + (i - 1) * samplesCount, samplesCount);
+    }
+
+    return true;
+}
+
+void FluidSynth::renderPartition(void* context, size_t partitionIdx)
+{
+    Fluid* fluid = static_cast<Fluid*>(context);
+
+    unsigned int channelCount = FLUID_AUDIO_CHANNELS_PAIR * 2;
+
+    //! NOTE The main instance writes into the output buffer, the others into their own part of the partitions buffer
+    float* buffer = fluid->outBuffer;
+    if (partitionIdx > 0) {
+        buffer = fluid->partitionsBuffer.data() + (partitionIdx - 1) * fluid->samplesToRender * channelCount;
+    }
+
+    fluid->partitionsResult[partitionIdx] = fluid_synth_write_float(fluid->synths[partitionIdx], fluid->samplesToRender,
+                                                                    buffer, 0, channelCount,
+                                                                    buffer, 1, channelCount);
 }
 
 async::Channel<unsigned int> FluidSynth::audioChannelsCountChanged() const
@@ -387,7 +537,7 @@ int FluidSynth::setExpressionLevel(int level)
     midi::channel_t lastChannelIdx = m_sequencer.channels().lastIndex();
 
     for (midi::channel_t i = 0; i < lastChannelIdx; ++i) {
-        fluid_synth_cc(m_fluid->synth, i, midi::EXPRESSION_CONTROLLER, level);
+        fluid_synth_cc(m_fluid->synthForChannel(i), i, midi::EXPRESSION_CONTROLLER, level);
     }
 
     return FLUID_OK;
@@ -395,12 +545,14 @@ int FluidSynth::setExpressionLevel(int level)
 
 int FluidSynth::setControllerValue(const midi::Event& event)
 {
+    fluid_synth_t* synth = m_fluid->synthForChannel(event.channel());
+
     int currentValue = 0;
-    fluid_synth_get_cc(m_fluid->synth, event.channel(), event.index(), &currentValue);
+    fluid_synth_get_cc(synth, event.channel(), event.index(), &currentValue);
 
     if (event.data() == static_cast<uint32_t>(currentValue)) {
         return FLUID_OK;
     }
 
-    return fluid_synth_cc(m_fluid->synth, event.channel(), event.index(),  event.data());
+    return fluid_synth_cc(synth, event.channel(), event.index(),  event.data());
 }
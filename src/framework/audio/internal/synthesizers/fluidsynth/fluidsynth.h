@@ -61,6 +61,7 @@ public:
     void setPlaybackPosition(const msecs_t newPosition) override;
 
     void revokePlayingNotes() override; // all channels
+    unsigned int activeVoicesCount() const override;
 
     unsigned int audioChannelsCount() const override;
     samples_t process(float* buffer, samples_t samplesPerChannel) override;
@@ -99,6 +100,11 @@ private:
 
     Ret init();
     void createFluidInstance();
+    void addPartitionsForChannel(const midi::channel_t channelIdx);
+
+    bool render(float* buffer, samples_t samplesPerChannel);
+
+    static void renderPartition(void* context, size_t partitionIdx);
 
     bool handleEvent(const midi::Event& event);
 
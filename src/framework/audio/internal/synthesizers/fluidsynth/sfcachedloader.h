@@ -30,7 +30,10 @@ extern "C" {
 #include <cstdio>
 #include <vector>
 #include <map>
+#include <list>
+#include <mutex>
 #include <string>
+#include <algorithm>
 
 #include <sfloader/fluid_sfont.h>
 #include <sfloader/fluid_defsfont.h>
@@ -44,6 +47,14 @@ struct SoundFontData
     std::FILE* fileStream = nullptr;
 };
 
+using PresetNotifyFunc = int (*)(fluid_preset_t* preset, int reason, int chan);
+
+//! NOTE The samples of a preset are loaded when it's selected on a channel (synth.dynamic-sample-loading),
+//!     so only the presets used by the score are in memory. Unselecting the last one unloads the samples,
+//!     that's why a few of the recently unselected presets are kept loaded: making the synths again
+//!     (e.g. on a sample rate change or for a frozen track) then neither reads nor decodes (SF3) them again
+static constexpr size_t MAX_RELEASED_PRESETS_COUNT = 32;
+
 struct SoundFontCache : public std::map<std::string, SoundFontData> {
     static SoundFontCache* instance()
     {
@@ -51,6 +62,11 @@ struct SoundFontCache : public std::map<std::string, SoundFontData> {
         return &s;
     }
 
+    //! NOTE The presets are shared by the synths of all tracks, which may be processed in parallel
+    std::mutex presetsMutex;
+    PresetNotifyFunc defaultPresetNotify = nullptr;
+    std::list<fluid_preset_t*> releasedPresets;
+
 private:
     SoundFontCache() = default;
     ~SoundFontCache()
@@ -114,6 +130,62 @@ long tellSoundFont(void* handle)
     return std::ftell(static_cast<std::FILE*>(handle));
 }
 
+int notifyPreset(fluid_preset_t* preset, int reason, int chan)
+{
+    SoundFontCache* cache = SoundFontCache::instance();
+    std::lock_guard<std::mutex> lock(cache->presetsMutex);
+
+    if (!cache->defaultPresetNotify) {
+        return FLUID_OK;
+    }
+
+    std::list<fluid_preset_t*>& released = cache->releasedPresets;
+
+    if (reason == FLUID_PRESET_SELECTED) {
+        auto it = std::find(released.begin(), released.end(), preset);
+
+        //! NOTE The samples are still loaded, the selection takes over the pending release
+        if (it != released.end()) {
+            released.erase(it);
+            return FLUID_OK;
+        }
+    } else if (reason == FLUID_PRESET_UNSELECTED) {
+        released.push_back(preset);
+
+        if (released.size() <= MAX_RELEASED_PRESETS_COUNT) {
+            return FLUID_OK;
+        }
+
+        preset = released.front();
+        released.pop_front();
+    }
+
+    return cache->defaultPresetNotify(preset, reason, chan);
+}
+
+void setupPresetsNotify(fluid_defsfont_t* defsfont)
+{
+    if (!defsfont->dynamic_samples) {
+        return;
+    }
+
+    SoundFontCache* cache = SoundFontCache::instance();
+
+    for (fluid_list_t* list = defsfont->preset; list; list = fluid_list_next(list)) {
+        fluid_preset_t* preset = static_cast<fluid_preset_t*>(fluid_list_get(list));
+        if (!preset || !preset->notify) {
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(cache->presetsMutex);
+            cache->defaultPresetNotify = preset->notify;
+        }
+
+        preset->notify = notifyPreset;
+    }
+}
+
 int deleteSoundFont(fluid_sfont_t* /*sfont*/)
 {
     //!Note Prevent removal of sound-fonts by Fluid instances,
@@ -166,6 +238,8 @@ fluid_sfont_t* loadSoundFont(fluid_sfloader_t* loader, const char* filename)
         return nullptr;
     }
 
+    setupPresetsNotify(defsfont);
+
     SoundFontData& sfData = SoundFontCache::instance()->operator[](filename);
     sfData.soundFontPtr = result;
 
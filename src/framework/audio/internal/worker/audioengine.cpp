@@ -142,6 +142,8 @@ void AudioEngine::setMode(const RenderMode newMode)
 
     m_currentMode = newMode;
 
+    m_mixer->setDeadlineMonitored(m_currentMode == RenderMode::RealTimeMode);
+
     if (m_currentMode == RenderMode::RealTimeMode) {
         m_buffer->setSource(m_mixer->mixedSource());
     } else {
@@ -163,3 +165,74 @@ MixerPtr AudioEngine::mixer() const
     ONLY_AUDIO_WORKER_THREAD;
     return m_mixer;
 }
+
+uint64_t AudioEngine::bufferUnderrunCount() const
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    IF_ASSERT_FAILED(m_buffer) {
+        return 0;
+    }
+
+    return m_buffer->underrunCount();
+}
+
+AudioPerformanceStats AudioEngine::performanceStats() const
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    IF_ASSERT_FAILED(m_mixer && m_buffer) {
+        return AudioPerformanceStats();
+    }
+
+    AudioPerformanceStats stats = m_mixer->performanceStats();
+    stats.bufferUnderrunCount = m_buffer->underrunCount() - m_underrunsAtReset;
+    stats.missedFramesCount = m_buffer->missedFramesCount() - m_missedFramesAtReset;
+
+    return stats;
+}
+
+void AudioEngine::resetPerformanceStats()
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    if (!m_inited) {
+        return;
+    }
+
+    m_mixer->resetPerformanceStats();
+
+    //! NOTE The buffer counters are also exposed as the running totals, so they aren't reset
+    m_underrunsAtReset = m_buffer->underrunCount();
+    m_missedFramesAtReset = m_buffer->missedFramesCount();
+}
+
+void AudioEngine::logPerformanceSummary() const
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    if (!m_inited) {
+        return;
+    }
+
+    AudioPerformanceStats stats = performanceStats();
+
+    LOGI() << "audio performance: blocks: " << stats.blocksCount
+           << ", deadline misses: " << stats.deadlineMissCount
+           << ", block avg/max/deadline: " << stats.averageBlockUsecs << "/" << stats.maxBlockUsecs
+           << "/" << stats.blockDeadlineUsecs << " us"
+           << ", load avg/max: " << stats.load << "/" << stats.maxLoad
+           << ", underruns: " << stats.bufferUnderrunCount
+           << ", missed frames: " << stats.missedFramesCount
+           << ", voices: " << stats.activeVoices;
+
+    for (const AudioChannelPerformance& channel : stats.channels) {
+        if (channel.maxLoad < 0.1f) {
+            continue;
+        }
+
+        LOGI() << "heavy " << (channel.isAux ? "aux channel" : "track") << ": " << channel.trackId
+               << ", load avg/max: " << channel.load << "/" << channel.maxLoad
+               << ", fx load: " << channel.fxLoad;
+    }
+}
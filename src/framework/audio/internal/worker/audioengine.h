@@ -56,6 +56,13 @@ public:
 
     MixerPtr mixer() const;
 
+    uint64_t bufferUnderrunCount() const;
+
+    //! NOTE The counters since the last reset, e.g. since the playback start
+    AudioPerformanceStats performanceStats() const;
+    void resetPerformanceStats();
+    void logPerformanceSummary() const;
+
 private:
     AudioEngine();
 
@@ -66,6 +73,9 @@ private:
     MixerPtr m_mixer = nullptr;
     std::shared_ptr<AudioBuffer> m_buffer = nullptr;
 
+    uint64_t m_underrunsAtReset = 0;
+    uint64_t m_missedFramesAtReset = 0;
+
     RenderMode m_currentMode = RenderMode::Undefined;
     async::Notification m_modeChanges;
 };
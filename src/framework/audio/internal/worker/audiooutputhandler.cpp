@@ -140,6 +140,49 @@ Channel<AudioOutputParams> AudioOutputHandler::masterOutputParamsChanged() const
     return m_masterOutputParamsChanged;
 }
 
+Promise<AudioOutputParams> AudioOutputHandler::auxOutputParams(const aux_channel_idx_t index) const
+{
+    return Promise<AudioOutputParams>([this, index](auto resolve, auto reject) {
+        ONLY_AUDIO_WORKER_THREAD;
+
+        IF_ASSERT_FAILED(mixer()) {
+            return reject(static_cast<int>(Err::Undefined), "undefined reference to a mixer");
+        }
+
+        RetVal<MixerChannelPtr> aux = mixer()->auxChannel(index);
+
+        if (!aux.ret) {
+            return reject(aux.ret.code(), aux.ret.text());
+        }
+
+        return resolve(aux.val->outputParams());
+    }, AudioThread::ID);
+}
+
+void AudioOutputHandler::setAuxOutputParams(const aux_channel_idx_t index, const AudioOutputParams& params)
+{
+    Async::call(this, [this, index, params]() {
+        ONLY_AUDIO_WORKER_THREAD;
+
+        IF_ASSERT_FAILED(mixer()) {
+            return;
+        }
+
+        RetVal<MixerChannelPtr> aux = mixer()->auxChannel(index);
+
+        if (aux.ret) {
+            aux.val->applyOutputParams(params);
+        }
+    }, AudioThread::ID);
+}
+
+Channel<aux_channel_idx_t, AudioOutputParams> AudioOutputHandler::auxOutputParamsChanged() const
+{
+    ONLY_AUDIO_MAIN_OR_WORKER_THREAD;
+
+    return m_auxOutputParamsChanged;
+}
+
 Promise<AudioResourceMetaList> AudioOutputHandler::availableOutputResources() const
 {
     return Promise<AudioResourceMetaList>([this](auto resolve, auto /*reject*/) {
@@ -181,10 +224,42 @@ Promise<AudioSignalChanges> AudioOutputHandler::masterSignalChanges() const
     }, AudioThread::ID);
 }
 
+Promise<uint64_t> AudioOutputHandler::bufferUnderrunCount() const
+{
+    return Promise<uint64_t>([](auto resolve, auto /*reject*/) {
+        ONLY_AUDIO_WORKER_THREAD;
+
+        return resolve(AudioEngine::instance()->bufferUnderrunCount());
+    }, AudioThread::ID);
+}
+
+Promise<AudioPerformanceStats> AudioOutputHandler::performanceStats() const
+{
+    return Promise<AudioPerformanceStats>([](auto resolve, auto /*reject*/) {
+        ONLY_AUDIO_WORKER_THREAD;
+
+        return resolve(AudioEngine::instance()->performanceStats());
+    }, AudioThread::ID);
+}
+
+void AudioOutputHandler::resetPerformanceStats()
+{
+    Async::call(this, []() {
+        ONLY_AUDIO_WORKER_THREAD;
+
+        AudioEngine::instance()->resetPerformanceStats();
+    }, AudioThread::ID);
+}
+
 Promise<bool> AudioOutputHandler::saveSoundTrack(const TrackSequenceId sequenceId, const io::path_t& destination,
                                                  const SoundTrackFormat& format)
 {
-    return Promise<bool>([this, sequenceId, destination, format](auto resolve, auto reject) {
+    return saveSoundTracks(sequenceId, { SoundTrackDestination { destination, format } });
+}
+
+Promise<bool> AudioOutputHandler::saveSoundTracks(const TrackSequenceId sequenceId, const SoundTrackDestinations& destinations)
+{
+    return Promise<bool>([this, sequenceId, destinations](auto resolve, auto reject) {
         ONLY_AUDIO_WORKER_THREAD;
 
         IF_ASSERT_FAILED(mixer()) {
@@ -200,7 +275,7 @@ Promise<bool> AudioOutputHandler::saveSoundTrack(const TrackSequenceId sequenceI
         s->player()->stop();
         s->player()->seek(0);
         msecs_t totalDuration = s->player()->duration();
-        SoundTrackWriter writer(destination, format, totalDuration, mixer());
+        SoundTrackWriter writer(destinations, totalDuration, mixer());
 
         framework::Progress progress = saveSoundTrackProgress(sequenceId);
         writer.progress().progressChanged.onReceive(this, [&progress](int64_t current, int64_t total, std::string title) {
@@ -280,4 +355,14 @@ void AudioOutputHandler::ensureMixerSubscriptions() const
             m_masterOutputParamsChanged.send(params);
         });
     }
+
+    for (aux_channel_idx_t idx = 0; idx < AUX_CHANNEL_NUM; ++idx) {
+        RetVal<MixerChannelPtr> aux = mixer()->auxChannel(idx);
+
+        if (aux.ret && !aux.val->outputParamsChanged().isConnected()) {
+            aux.val->outputParamsChanged().onReceive(this, [this, idx](const AudioOutputParams& params) {
+                m_auxOutputParamsChanged.send(idx, params);
+            });
+        }
+    }
 }
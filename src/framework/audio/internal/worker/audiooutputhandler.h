@@ -48,13 +48,23 @@ public:
     void clearMasterOutputParams() override;
     async::Channel<AudioOutputParams> masterOutputParamsChanged() const override;
 
+    async::Promise<AudioOutputParams> auxOutputParams(const aux_channel_idx_t index) const override;
+    void setAuxOutputParams(const aux_channel_idx_t index, const AudioOutputParams& params) override;
+    async::Channel<aux_channel_idx_t, AudioOutputParams> auxOutputParamsChanged() const override;
+
     async::Promise<AudioResourceMetaList> availableOutputResources() const override;
 
     async::Promise<AudioSignalChanges> signalChanges(const TrackSequenceId sequenceId, const TrackId trackId) const override;
     async::Promise<AudioSignalChanges> masterSignalChanges() const override;
 
+    async::Promise<uint64_t> bufferUnderrunCount() const override;
+
+    async::Promise<AudioPerformanceStats> performanceStats() const override;
+    void resetPerformanceStats() override;
+
     async::Promise<bool> saveSoundTrack(const TrackSequenceId sequenceId, const io::path_t& destination,
                                         const SoundTrackFormat& format) override;
+    async::Promise<bool> saveSoundTracks(const TrackSequenceId sequenceId, const SoundTrackDestinations& destinations) override;
 
     framework::Progress saveSoundTrackProgress(const TrackSequenceId sequenceId) override;
 
@@ -69,6 +79,7 @@ private:
     IGetTrackSequence* m_getSequence = nullptr;
 
     mutable async::Channel<AudioOutputParams> m_masterOutputParamsChanged;
+    mutable async::Channel<aux_channel_idx_t, AudioOutputParams> m_auxOutputParamsChanged;
     mutable async::Channel<TrackSequenceId, TrackId, AudioOutputParams> m_outputParamsChanged;
 
     QHash<TrackSequenceId, framework::Progress> m_saveSoundTracksMap;
@@ -0,0 +1,173 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "audioworkerpool.h"
+
+#include <chrono>
+
+#include "internal/audiosanitizer.h"
+#include "internal/dsp/audiomathutils.h"
+
+using namespace mu::audio;
+
+//! NOTE A worker waits for the next block without sleeping for this time
+static constexpr std::chrono::microseconds SPIN_DURATION(1000);
+
+//! NOTE A job may run the nested jobs (e.g. a synth rendering its partitions), they are processed inline,
+//! because the workers are busy with the outer jobs anyway
+static thread_local bool s_isProcessingJobs = false;
+
+AudioWorkerPool* AudioWorkerPool::instance()
+{
+    static size_t hardwareThreads = std::thread::hardware_concurrency();
+    static AudioWorkerPool pool(hardwareThreads > 2 ? hardwareThreads / 2 - 1 : 0);
+    return &pool;
+}
+
+AudioWorkerPool::AudioWorkerPool(size_t threadCount)
+{
+    m_threads.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        m_threads.emplace_back(&AudioWorkerPool::workerLoop, this);
+    }
+}
+
+AudioWorkerPool::~AudioWorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_isActive = false;
+    }
+    m_wakeUp.notify_all();
+
+    for (std::thread& thread : m_threads) {
+        thread.join();
+    }
+}
+
+size_t AudioWorkerPool::threadCount() const
+{
+    return m_threads.size();
+}
+
+void AudioWorkerPool::run(JobFunc func, void* context, size_t jobCount)
+{
+    if (jobCount == 0) {
+        return;
+    }
+
+    if (m_threads.empty() || jobCount == 1 || s_isProcessingJobs) {
+        for (size_t i = 0; i < jobCount; ++i) {
+            func(context, i);
+        }
+        return;
+    }
+
+    m_func = func;
+    m_context = context;
+    m_jobCount = jobCount;
+    m_nextJobIdx = 0;
+    m_doneJobCount = 0;
+
+    //! NOTE The generation is odd while the jobs are open to the workers
+    m_generation.fetch_add(1);
+
+    if (m_sleepingWorkerCount > 0) {
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+        m_wakeUp.notify_all();
+    }
+
+    processJobs();
+
+    while (m_doneJobCount.load(std::memory_order_acquire) < jobCount) {
+        std::this_thread::yield();
+    }
+
+    //! NOTE The jobs are closed, the next run may change them once no worker looks at them anymore
+    m_generation.fetch_add(1);
+
+    while (m_activeWorkerCount > 0) {
+        std::this_thread::yield();
+    }
+}
+
+void AudioWorkerPool::processJobs()
+{
+    const size_t jobCount = m_jobCount;
+
+    s_isProcessingJobs = true;
+
+    for (;;) {
+        size_t jobIdx = m_nextJobIdx.fetch_add(1, std::memory_order_acq_rel);
+        if (jobIdx >= jobCount) {
+            break;
+        }
+
+        m_func(m_context, jobIdx);
+
+        m_doneJobCount.fetch_add(1, std::memory_order_release);
+    }
+
+    s_isProcessingJobs = false;
+}
+
+void AudioWorkerPool::workerLoop()
+{
+    AudioSanitizer::setupWorkerPoolThread();
+    dsp::setFlushDenormalsToZero();
+
+    uint64_t lastGeneration = m_generation;
+    auto lastJobsTime = std::chrono::steady_clock::now();
+
+    auto hasNewJobs = [this, &lastGeneration]() {
+        uint64_t generation = m_generation;
+        return (generation & 1) && generation != lastGeneration;
+    };
+
+    while (m_isActive) {
+        m_activeWorkerCount.fetch_add(1);
+
+        uint64_t generation = m_generation;
+        bool isOpen = (generation & 1) && generation != lastGeneration;
+        if (isOpen) {
+            lastGeneration = generation;
+            processJobs();
+        }
+
+        m_activeWorkerCount.fetch_sub(1);
+
+        if (isOpen) {
+            lastJobsTime = std::chrono::steady_clock::now();
+            continue;
+        }
+
+        if (std::chrono::steady_clock::now() - lastJobsTime < SPIN_DURATION) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_sleepMutex);
+        ++m_sleepingWorkerCount;
+        m_wakeUp.wait(lock, [this, &hasNewJobs]() { return hasNewJobs() || !m_isActive; });
+        --m_sleepingWorkerCount;
+        lastJobsTime = std::chrono::steady_clock::now();
+    }
+}
@@ -0,0 +1,74 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_AUDIO_AUDIOWORKERPOOL_H
+#define MU_AUDIO_AUDIOWORKERPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mu::audio {
+//! NOTE The workers which process the jobs of an audio block in parallel, with the calling thread.
+//! The threads are made once, a run neither allocates nor locks, unless a worker has fallen asleep
+//! after a long time without jobs
+class AudioWorkerPool
+{
+public:
+    using JobFunc = void (*)(void* context, size_t jobIdx);
+
+    static AudioWorkerPool* instance();
+
+    explicit AudioWorkerPool(size_t threadCount);
+    ~AudioWorkerPool();
+
+    size_t threadCount() const;
+
+    //! NOTE Runs the jobs with the indexes [0, jobCount) and returns when all of them are done
+    void run(JobFunc func, void* context, size_t jobCount);
+
+private:
+    void workerLoop();
+    void processJobs();
+
+    std::vector<std::thread> m_threads;
+
+    JobFunc m_func = nullptr;
+    void* m_context = nullptr;
+    size_t m_jobCount = 0;
+
+    std::atomic<size_t> m_nextJobIdx = 0;
+    std::atomic<size_t> m_doneJobCount = 0;
+    std::atomic<size_t> m_activeWorkerCount = 0;
+    std::atomic<uint64_t> m_generation = 0;
+    std::atomic<bool> m_isActive = true;
+
+    std::atomic<size_t> m_sleepingWorkerCount = 0;
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wakeUp;
+};
+}
+
+#endif // MU_AUDIO_AUDIOWORKERPOOL_H
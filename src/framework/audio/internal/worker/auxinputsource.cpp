@@ -0,0 +1,61 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "auxinputsource.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace mu::audio;
+
+AuxInputSource::AuxInputSource(const audioch_t audioChannelsCount)
+    : m_audioChannelsCount(audioChannelsCount)
+{
+}
+
+void AuxInputSource::prepare(const samples_t samplesPerChannel)
+{
+    m_buffer.resize(samplesPerChannel * m_audioChannelsCount);
+    std::fill(m_buffer.begin(), m_buffer.end(), 0.f);
+}
+
+void AuxInputSource::addSignal(const float* buffer, const samples_t samplesPerChannel, const gain_t signalAmount)
+{
+    size_t samplesCount = std::min(static_cast<size_t>(samplesPerChannel * m_audioChannelsCount), m_buffer.size());
+
+    for (size_t i = 0; i < samplesCount; ++i) {
+        m_buffer[i] += buffer[i] * signalAmount;
+    }
+}
+
+unsigned int AuxInputSource::audioChannelsCount() const
+{
+    return m_audioChannelsCount;
+}
+
+mu::audio::samples_t AuxInputSource::process(float* buffer, samples_t samplesPerChannel)
+{
+    size_t samplesCount = std::min(static_cast<size_t>(samplesPerChannel * m_audioChannelsCount), m_buffer.size());
+    std::memcpy(buffer, m_buffer.data(), samplesCount * sizeof(float));
+
+    //! NOTE The aux fx (e.g. a reverb) have to keep processing the silence to let their tails fade out
+    return samplesPerChannel;
+}
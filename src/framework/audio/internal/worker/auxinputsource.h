@@ -0,0 +1,51 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_AUDIO_AUXINPUTSOURCE_H
+#define MU_AUDIO_AUXINPUTSOURCE_H
+
+#include <vector>
+
+#include "abstractaudiosource.h"
+
+namespace mu::audio {
+//! NOTE The input of an aux channel: collects the signal sent by the tracks during the current block
+class AuxInputSource : public AbstractAudioSource
+{
+public:
+    explicit AuxInputSource(const audioch_t audioChannelsCount);
+
+    void prepare(const samples_t samplesPerChannel);
+    void addSignal(const float* buffer, const samples_t samplesPerChannel, const gain_t signalAmount);
+
+    // IAudioSource
+    unsigned int audioChannelsCount() const override;
+    samples_t process(float* buffer, samples_t samplesPerChannel) override;
+
+private:
+    std::vector<float> m_buffer;
+    audioch_t m_audioChannelsCount = 0;
+};
+
+using AuxInputSourcePtr = std::shared_ptr<AuxInputSource>;
+}
+
+#endif // MU_AUDIO_AUXINPUTSOURCE_H
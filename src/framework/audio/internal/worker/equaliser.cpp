@@ -23,6 +23,8 @@
 
 #include <cmath>
 
+#include "internal/dsp/audiomathutils.h"
+
 #include "log.h"
 
 using namespace mu::audio;
@@ -45,17 +47,40 @@ void Equaliser::setActive(bool active)
 
 void Equaliser::process(float* buffer, unsigned int sampleCount)
 {
+    if (m_a[0] == 0.f) {
+        return;
+    }
+
+    //! NOTE The coefficients are normalized and the state is kept in locals for the block,
+    //! so the loop has neither a division nor stores of the history
+    const float a0Inv = 1.f / m_a[0];
+    const float b0 = m_b[0] * a0Inv;
+    const float b1 = m_b[1] * a0Inv;
+    const float b2 = m_b[2] * a0Inv;
+    const float a1 = m_a[1] * a0Inv;
+    const float a2 = m_a[2] * a0Inv;
+
+    float x1 = m_x[0];
+    float x2 = m_x[1];
+    float y1 = m_y[0];
+    float y2 = m_y[1];
+
     for (unsigned int i = 0; i < sampleCount; ++i) {
-        m_x[2] = m_x[1];
-        m_x[1] = m_x[0];
-        m_x[0] = buffer[i];
+        float x0 = buffer[i];
+        float y0 = b0 * x0 + b1 * x1 + b2 * x2 - a1 * y1 - a2 * y2;
 
-        m_y[2] = m_y[1];
-        m_y[1] = m_y[0];
-        m_y[0] = (m_b[2] * m_x[2] + m_b[1] * m_x[1] + m_b[0] * m_x[0] - m_a[1] * m_y[1] - m_a[2] * m_y[2]) / m_a[0];
+        x2 = x1;
+        x1 = x0;
+        y2 = y1;
+        y1 = y0;
 
-        buffer[i] = m_y[0];
+        buffer[i] = y0;
     }
+
+    m_x[0] = x1;
+    m_x[1] = x2;
+    m_y[0] = dsp::flushDenormal(y1);
+    m_y[1] = dsp::flushDenormal(y2);
 }
 
 void Equaliser::calculate()
@@ -22,6 +22,10 @@
 
 #include "eventaudiosource.h"
 
+#include <atomic>
+#include <chrono>
+#include <cstring>
+
 #include "log.h"
 
 #include "internal/audiosanitizer.h"
@@ -31,6 +35,42 @@ using namespace mu::audio;
 using namespace mu::audio::synth;
 using namespace mu::mpe;
 
+static constexpr samples_t FREEZE_BLOCK_SIZE = 512;
+static constexpr int FREEZE_BLOCKS_PER_CYCLE = 4;
+static constexpr secs_t FREEZE_TAIL_SECS = 3;
+static constexpr secs_t FREEZE_MAX_DURATION_SECS = 15 * 60;
+
+//! NOTE The track is frozen automatically, when its synth takes more than this share of the real time
+static constexpr float AUTO_FREEZE_SYNTH_LOAD = 0.2f;
+
+static std::atomic<bool> s_autoFreezeEnabled = false;
+static std::atomic<size_t> s_frozenCachesMemoryLimit = 0;
+static std::atomic<size_t> s_frozenCachesMemory = 0;
+static constexpr float SYNTH_LOAD_SMOOTHING = 0.05f;
+
+static constexpr float LOOP_FADE_OUT_SECS = 0.05f;
+
+static samples_t loopFadeOutSamples(const samples_t sampleRate)
+{
+    return static_cast<samples_t>(LOOP_FADE_OUT_SECS * sampleRate);
+}
+
+static msecs_t eventsEndTimestamp(const PlaybackEventsMap& events)
+{
+    msecs_t result = 0;
+
+    for (const auto& pair : events) {
+        for (const PlaybackEvent& event : pair.second) {
+            if (const NoteEvent* noteEvent = std::get_if<NoteEvent>(&event)) {
+                const ArrangementContext& arrangement = noteEvent->arrangementCtx();
+                result = std::max(result, arrangement.actualTimestamp + arrangement.actualDuration);
+            }
+        }
+    }
+
+    return result;
+}
+
 EventAudioSource::EventAudioSource(const TrackId trackId, const mpe::PlaybackData& playbackData)
     : m_trackId(trackId), m_playbackData(playbackData)
 {
@@ -38,16 +78,28 @@ EventAudioSource::EventAudioSource(const TrackId trackId, const mpe::PlaybackDat
 
     m_playbackData.mainStream.onReceive(this, [this](const PlaybackEventsMap& events) {
         m_playbackData.originEvents = events;
+        invalidateFrozenCache();
+        resumeFreezing();
     });
 
     m_playbackData.dynamicLevelChanges.onReceive(this, [this](const DynamicLevelMap& changes) {
         m_playbackData.dynamicLevelMap = changes;
+        invalidateFrozenCache();
+        resumeFreezing();
     });
 }
 
 EventAudioSource::~EventAudioSource()
 {
     m_playbackData.mainStream.resetOnReceive(this);
+
+    invalidateFrozenCache();
+}
+
+void EventAudioSource::setFreezeOptions(bool autoFreezeEnabled, size_t cachesMemoryLimitBytes)
+{
+    s_autoFreezeEnabled = autoFreezeEnabled;
+    s_frozenCachesMemoryLimit = cachesMemoryLimitBytes;
 }
 
 bool EventAudioSource::isActive() const
@@ -69,14 +121,44 @@ void EventAudioSource::setIsActive(const bool active)
         return;
     }
 
+    stopPlayingFromCache();
+
+    if (m_fadingSynth) {
+        resetPreRollSynth(std::move(m_fadingSynth));
+    }
+
     m_synth->setIsActive(active);
     m_synth->flushSound();
+
+    if (m_frozenCache.isReady()) {
+        m_frozenCache.synth = nullptr;
+    }
+
+    if (active) {
+        return;
+    }
+
+    if (m_isPreRollSynthPending) {
+        preparePreRollSynth();
+    }
+
+    //! NOTE The heavy tracks are frozen when the playback stops, not from process(), which must not allocate
+    if (s_autoFreezeEnabled && !m_isFrozen && !m_isAutoFreezeBlocked && m_synthLoad > AUTO_FREEZE_SYNTH_LOAD) {
+        LOGI() << "freezing the heavy track, trackId: " << m_trackId << ", synth load: " << m_synthLoad;
+        setIsFrozen(true);
+    }
+
+    resumeFreezing();
 }
 
 void EventAudioSource::setSampleRate(unsigned int sampleRate)
 {
     ONLY_AUDIO_WORKER_THREAD;
 
+    if (m_sampleRate != sampleRate) {
+        invalidateFrozenCache();
+    }
+
     m_sampleRate = sampleRate;
 
     if (!m_synth) {
@@ -84,6 +166,8 @@ void EventAudioSource::setSampleRate(unsigned int sampleRate)
     }
 
     m_synth->setSampleRate(sampleRate);
+
+    resumeFreezing();
 }
 
 unsigned int EventAudioSource::audioChannelsCount() const
@@ -116,7 +200,33 @@ samples_t EventAudioSource::process(float* buffer, samples_t samplesPerChannel)
         return 0;
     }
 
-    return m_synth->process(buffer, samplesPerChannel);
+    if (m_isFrozen) {
+        if (m_frozenCache.isReady() && m_synth->isActive()) {
+            return processFrozen(buffer, samplesPerChannel);
+        }
+
+        if (!m_synth->isActive()) {
+            renderFrozenChunk();
+        }
+    }
+
+    stopPlayingFromCache();
+
+    auto processingStart = std::chrono::steady_clock::now();
+
+    samples_t result = m_synth->process(buffer, samplesPerChannel);
+
+    if (m_fadingSynth && m_fadingSamplesLeft > 0) {
+        mixFadingSynth(buffer, samplesPerChannel);
+        result = samplesPerChannel;
+    }
+
+    if (m_synth->isActive()) {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - processingStart;
+        updateSynthLoad(elapsed.count(), samplesPerChannel);
+    }
+
+    return result;
 }
 
 void EventAudioSource::seek(const msecs_t newPositionMsecs)
@@ -127,10 +237,124 @@ void EventAudioSource::seek(const msecs_t newPositionMsecs)
         return;
     }
 
+    if (m_isPlayingFromCache) {
+        m_synth->setPlaybackPosition(newPositionMsecs);
+        m_cachePosition = newPositionMsecs * m_sampleRate / 1000000;
+        return;
+    }
+
+    //! NOTE The synth which has faded out waits here to become the pre-roll synth again
+    if (m_fadingSynth && m_fadingSamplesLeft == 0) {
+        resetPreRollSynth(std::move(m_fadingSynth));
+        m_fadingSynth = nullptr;
+    }
+
+    if (m_preRollSynth && !m_fadingSynth && newPositionMsecs == m_preRollPosition && m_synth->isActive()) {
+        m_fadingSynth = std::move(m_synth);
+        m_fadingSamplesLeft = loopFadeOutSamples(m_sampleRate);
+        m_synth = std::move(m_preRollSynth);
+        return;
+    }
+
     m_synth->setPlaybackPosition(newPositionMsecs);
     m_synth->revokePlayingNotes();
 }
 
+void EventAudioSource::setPreRollPosition(const msecs_t positionMsecs)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    if (m_preRollPosition == positionMsecs) {
+        return;
+    }
+
+    m_preRollPosition = positionMsecs;
+
+    if (m_preRollPosition < 0) {
+        m_preRollSynth = nullptr;
+        m_isPreRollSynthPending = false;
+        return;
+    }
+
+    if (m_preRollSynth) {
+        resetPreRollSynth(std::move(m_preRollSynth));
+    } else {
+        preparePreRollSynth();
+    }
+}
+
+void EventAudioSource::preparePreRollSynth()
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    //! NOTE The plugin instruments are registered per track, so there can't be a second instance
+    if (m_preRollPosition < 0 || m_preRollSynth || !m_synth || m_params.type() == AudioSourceType::Vsti) {
+        m_isPreRollSynthPending = false;
+        return;
+    }
+
+    //! NOTE Making a synth can take long (e.g. it loads the sound font), and the blocks are rendered
+    //! on this thread, so while the playback goes it's postponed till the stop
+    if (m_synth->isActive()) {
+        m_isPreRollSynthPending = true;
+        return;
+    }
+
+    m_isPreRollSynthPending = false;
+
+    synth::ISynthesizerPtr synth = synthResolver()->resolveSynth(m_trackId, m_params, m_playbackData.setupData);
+    if (!synth) {
+        return;
+    }
+
+    //! NOTE The synths take turns to be the live one, so the pre-roll synth follows all the streams too
+    synth->setSampleRate(m_sampleRate);
+    synth->setup(m_playbackData);
+
+    resetPreRollSynth(std::move(synth));
+}
+
+void EventAudioSource::resetPreRollSynth(synth::ISynthesizerPtr synth)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    if (m_preRollPosition < 0 || m_preRollSynth) {
+        return;
+    }
+
+    synth->flushSound();
+    synth->setPlaybackPosition(m_preRollPosition);
+    synth->setIsActive(true);
+
+    m_preRollSynth = std::move(synth);
+}
+
+void EventAudioSource::mixFadingSynth(float* buffer, samples_t samplesPerChannel)
+{
+    const audioch_t channelsCount = m_fadingSynth->audioChannelsCount();
+    const size_t bufferSize = samplesPerChannel * channelsCount;
+
+    if (m_fadingBuffer.size() < bufferSize) {
+        m_fadingBuffer.resize(bufferSize);
+    }
+
+    std::fill(m_fadingBuffer.begin(), m_fadingBuffer.begin() + bufferSize, 0.f);
+    m_fadingSynth->process(m_fadingBuffer.data(), samplesPerChannel);
+
+    const samples_t fadingSamplesTotal = loopFadeOutSamples(m_sampleRate);
+
+    for (samples_t s = 0; s < samplesPerChannel && m_fadingSamplesLeft > 0; ++s, --m_fadingSamplesLeft) {
+        float gain = static_cast<float>(m_fadingSamplesLeft) / fadingSamplesTotal;
+
+        for (audioch_t ch = 0; ch < channelsCount; ++ch) {
+            size_t idx = s * channelsCount + ch;
+            buffer[idx] += m_fadingBuffer[idx] * gain;
+        }
+    }
+
+    //! NOTE The faded synth is handed back on the audio worker thread (see seek and setIsActive), not in the render callback
+}
+
 const AudioInputParams& EventAudioSource::inputParams() const
 {
     return m_params;
@@ -142,6 +366,12 @@ void EventAudioSource::applyInputParams(const AudioInputParams& requiredParams)
         return;
     }
 
+    stopPlayingFromCache();
+    invalidateFrozenCache();
+
+    m_preRollSynth = nullptr;
+    m_fadingSynth = nullptr;
+
     SynthCtx ctx = currentSynthCtx();
 
     m_synth = synthResolver()->resolveSynth(m_trackId, requiredParams, m_playbackData.setupData);
@@ -164,6 +394,8 @@ void EventAudioSource::applyInputParams(const AudioInputParams& requiredParams)
 
     m_params = m_synth->params();
     m_paramsChanges.send(m_params);
+
+    preparePreRollSynth();
 }
 
 async::Channel<AudioInputParams> EventAudioSource::inputParamsChanged() const
@@ -171,6 +403,208 @@ async::Channel<AudioInputParams> EventAudioSource::inputParamsChanged() const
     return m_paramsChanges;
 }
 
+unsigned int EventAudioSource::activeVoicesCount() const
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    if (!m_synth || m_isPlayingFromCache) {
+        return 0;
+    }
+
+    unsigned int count = m_synth->activeVoicesCount();
+    if (m_fadingSynth && m_fadingSamplesLeft > 0) {
+        count += m_fadingSynth->activeVoicesCount();
+    }
+
+    return count;
+}
+
+bool EventAudioSource::isFrozen() const
+{
+    return m_isFrozen;
+}
+
+void EventAudioSource::setIsFrozen(bool frozen)
+{
+    if (m_isFrozen == frozen) {
+        return;
+    }
+
+    //! NOTE The plugin instruments are registered per track, so there can't be a second instance to render the track offline
+    if (frozen && m_params.type() == AudioSourceType::Vsti) {
+        m_isAutoFreezeBlocked = true;
+        return;
+    }
+
+    m_isFrozen = frozen;
+
+    if (!m_isFrozen) {
+        stopPlayingFromCache();
+        invalidateFrozenCache();
+        return;
+    }
+
+    resumeFreezing();
+}
+
+samples_t EventAudioSource::processFrozen(float* buffer, samples_t samplesPerChannel)
+{
+    if (!m_isPlayingFromCache) {
+        m_cachePosition = m_synth->playbackPosition() * m_sampleRate / 1000000;
+        m_isPlayingFromCache = true;
+    }
+
+    const audioch_t channelsCount = m_synth->audioChannelsCount();
+    const samples_t cachedSamplesPerChannel = m_frozenCache.totalSamplesPerChannel;
+
+    samples_t samplesToCopy = 0;
+    if (m_cachePosition < cachedSamplesPerChannel) {
+        samplesToCopy = std::min(samplesPerChannel, cachedSamplesPerChannel - m_cachePosition);
+        std::memcpy(buffer, m_frozenCache.samples.data() + m_cachePosition * channelsCount,
+                    samplesToCopy * channelsCount * sizeof(float));
+    }
+
+    std::fill(buffer + samplesToCopy * channelsCount, buffer + samplesPerChannel * channelsCount, 0.f);
+
+    m_cachePosition += samplesPerChannel;
+
+    return samplesPerChannel;
+}
+
+void EventAudioSource::resumeFreezing()
+{
+    if (m_isFrozen && m_synth && !m_synth->isActive()) {
+        startFreezing();
+    }
+}
+
+void EventAudioSource::startFreezing()
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    if (!m_isFrozen || m_frozenCache.synth || m_frozenCache.isReady() || m_sampleRate == 0) {
+        return;
+    }
+
+    msecs_t endTimestamp = eventsEndTimestamp(m_playbackData.originEvents);
+    if (endTimestamp <= 0) {
+        m_isFrozen = false;
+        m_isAutoFreezeBlocked = true;
+        return;
+    }
+
+    samples_t totalSamplesPerChannel = (endTimestamp * m_sampleRate / 1000000) + FREEZE_TAIL_SECS * m_sampleRate;
+    if (totalSamplesPerChannel > static_cast<samples_t>(FREEZE_MAX_DURATION_SECS) * m_sampleRate) {
+        LOGW() << "the track is too long to be frozen, trackId: " << m_trackId;
+        m_isFrozen = false;
+        m_isAutoFreezeBlocked = true;
+        return;
+    }
+
+    //! NOTE The offline synth gets a copy of the events without the streams, so it doesn't play the live changes
+    mpe::PlaybackData offlineData;
+    offlineData.originEvents = m_playbackData.originEvents;
+    offlineData.setupData = m_playbackData.setupData;
+    offlineData.dynamicLevelMap = m_playbackData.dynamicLevelMap;
+
+    synth::ISynthesizerPtr synth = synthResolver()->resolveSynth(m_trackId, m_params, m_playbackData.setupData);
+    if (!synth) {
+        m_isFrozen = false;
+        m_isAutoFreezeBlocked = true;
+        return;
+    }
+
+    size_t reservedBytes = static_cast<size_t>(totalSamplesPerChannel) * synth->audioChannelsCount() * sizeof(float);
+    if (s_frozenCachesMemory + reservedBytes > s_frozenCachesMemoryLimit) {
+        LOGW() << "no memory left to freeze the track, trackId: " << m_trackId;
+        m_isFrozen = false;
+        m_isAutoFreezeBlocked = true;
+        return;
+    }
+
+    synth->setSampleRate(m_sampleRate);
+    synth->setup(offlineData);
+    synth->setPlaybackPosition(0);
+    synth->setIsActive(true);
+
+    s_frozenCachesMemory += reservedBytes;
+
+    m_frozenCache.synth = std::move(synth);
+    m_frozenCache.reservedBytes = reservedBytes;
+    m_frozenCache.totalSamplesPerChannel = totalSamplesPerChannel;
+    m_frozenCache.renderedSamplesPerChannel = 0;
+    m_frozenCache.samples.clear();
+    m_frozenCache.samples.reserve(reservedBytes / sizeof(float));
+}
+
+void EventAudioSource::renderFrozenChunk()
+{
+    if (m_frozenCache.isReady()) {
+        return;
+    }
+
+    //! NOTE The synths are created and released on the audio worker thread only (see resumeFreezing and setIsActive),
+    //! while the chunks may be rendered by the pool
+    if (!m_frozenCache.synth) {
+        return;
+    }
+
+    const audioch_t channelsCount = m_frozenCache.synth->audioChannelsCount();
+
+    for (int i = 0; i < FREEZE_BLOCKS_PER_CYCLE && !m_frozenCache.isReady(); ++i) {
+        samples_t samplesPerChannel = std::min(FREEZE_BLOCK_SIZE,
+                                               m_frozenCache.totalSamplesPerChannel - m_frozenCache.renderedSamplesPerChannel);
+
+        size_t offset = m_frozenCache.samples.size();
+        //! NOTE The last block is rendered short, so the samples never grow past the reserved capacity
+        m_frozenCache.samples.resize(offset + samplesPerChannel * channelsCount, 0.f);
+
+        //! NOTE A synth, which loads its instrument in the background, renders nothing until it's loaded
+        if (m_frozenCache.synth->process(m_frozenCache.samples.data() + offset, samplesPerChannel) == 0) {
+            m_frozenCache.samples.resize(offset);
+            break;
+        }
+
+        m_frozenCache.renderedSamplesPerChannel += samplesPerChannel;
+    }
+}
+
+void EventAudioSource::invalidateFrozenCache()
+{
+    m_isAutoFreezeBlocked = false;
+
+    if (m_frozenCache.totalSamplesPerChannel == 0 && !m_frozenCache.synth) {
+        return;
+    }
+
+    s_frozenCachesMemory -= m_frozenCache.reservedBytes;
+    m_frozenCache = FrozenCache();
+}
+
+void EventAudioSource::stopPlayingFromCache()
+{
+    if (!m_isPlayingFromCache) {
+        return;
+    }
+
+    m_isPlayingFromCache = false;
+
+    //! NOTE The synth didn't advance while the cache was played
+    if (m_synth) {
+        m_synth->setPlaybackPosition(m_cachePosition * 1000000 / m_sampleRate);
+    }
+}
+
+void EventAudioSource::updateSynthLoad(const double elapsedSecs, const samples_t samplesPerChannel)
+{
+    if (m_sampleRate == 0 || samplesPerChannel == 0) {
+        return;
+    }
+
+    float blockLoad = static_cast<float>(elapsedSecs * m_sampleRate / samplesPerChannel);
+    m_synthLoad += (blockLoad - m_synthLoad) * SYNTH_LOAD_SMOOTHING;
+}
+
 EventAudioSource::SynthCtx EventAudioSource::currentSynthCtx() const
 {
     if (!m_synth) {
@@ -50,12 +50,38 @@ public:
     samples_t process(float* buffer, samples_t samplesPerChannel) override;
 
     void seek(const msecs_t newPositionMsecs) override;
+    void setPreRollPosition(const msecs_t positionMsecs) override;
 
     const AudioInputParams& inputParams() const override;
     void applyInputParams(const AudioInputParams& requiredParams) override;
     async::Channel<AudioInputParams> inputParamsChanged() const override;
 
+    unsigned int activeVoicesCount() const override;
+
+    //! NOTE A frozen track is rendered once into the memory, while the playback is stopped,
+    //! and then played back from there until its events or the sound change
+    bool isFrozen() const;
+    void setIsFrozen(bool frozen);
+
+    //! NOTE The heavy tracks are only frozen automatically if it's enabled in the preferences,
+    //! and the caches of all the tracks together never take more than the given memory
+    static void setFreezeOptions(bool autoFreezeEnabled, size_t cachesMemoryLimitBytes);
+
 private:
+    struct FrozenCache
+    {
+        std::vector<float> samples;
+        size_t reservedBytes = 0;
+        samples_t renderedSamplesPerChannel = 0;
+        samples_t totalSamplesPerChannel = 0;
+        synth::ISynthesizerPtr synth = nullptr;
+
+        bool isReady() const
+        {
+            return totalSamplesPerChannel > 0 && renderedSamplesPerChannel >= totalSamplesPerChannel;
+        }
+    };
+
     struct SynthCtx
     {
         bool isActive = false;
@@ -71,6 +97,19 @@ private:
     SynthCtx currentSynthCtx() const;
     void restoreSynthCtx(SynthCtx&& ctx);
 
+    samples_t processFrozen(float* buffer, samples_t samplesPerChannel);
+    void startFreezing();
+    void resumeFreezing();
+    void renderFrozenChunk();
+    void invalidateFrozenCache();
+    void stopPlayingFromCache();
+
+    void updateSynthLoad(const double elapsedSecs, const samples_t samplesPerChannel);
+
+    void preparePreRollSynth();
+    void resetPreRollSynth(synth::ISynthesizerPtr synth);
+    void mixFadingSynth(float* buffer, samples_t samplesPerChannel);
+
     TrackId m_trackId = -1;
     mpe::PlaybackData m_playbackData;
     synth::ISynthesizerPtr m_synth = nullptr;
@@ -78,6 +117,23 @@ private:
     async::Channel<AudioInputParams> m_paramsChanges;
 
     samples_t m_sampleRate = 0;
+
+    bool m_isFrozen = false;
+    bool m_isAutoFreezeBlocked = false;
+    FrozenCache m_frozenCache;
+    bool m_isPlayingFromCache = false;
+    samples_t m_cachePosition = 0;
+
+    float m_synthLoad = 0.f;
+
+    //! NOTE The pre-roll synth waits at the loop start, so the jump to there just swaps the synths
+    //! and lets the notes of the previous pass fade out instead of being revoked
+    msecs_t m_preRollPosition = -1;
+    synth::ISynthesizerPtr m_preRollSynth = nullptr;
+    bool m_isPreRollSynthPending = false;
+    synth::ISynthesizerPtr m_fadingSynth = nullptr;
+    samples_t m_fadingSamplesLeft = 0;
+    std::vector<float> m_fadingBuffer;
 };
 }
 
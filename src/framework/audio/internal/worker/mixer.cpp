@@ -23,11 +23,14 @@
 
 #include "async/async.h"
 #include "log.h"
+#include "defer.h"
 
 #include <limits>
+#include <algorithm>
+#include <numeric>
+#include <chrono>
 
-#include "concurrency/taskscheduler.h"
-
+#include "audioworkerpool.h"
 #include "internal/audiosanitizer.h"
 #include "internal/audiothread.h"
 #include "internal/dsp/audiomathutils.h"
@@ -37,6 +40,15 @@ using namespace mu;
 using namespace mu::audio;
 using namespace mu::async;
 
+static TrackId auxTrackId(const aux_channel_idx_t index)
+{
+    //! NOTE The fx of the aux channels are resolved like the track ones, so they need the ids which never clash with the tracks
+    return std::numeric_limits<TrackId>::max() - static_cast<TrackId>(index);
+}
+
+//! NOTE The weight of the last block in the averaged load, the same as for the channels
+static constexpr float BLOCK_LOAD_SMOOTHING = 0.05f;
+
 Mixer::Mixer()
 {
     ONLY_AUDIO_WORKER_THREAD;
@@ -87,11 +99,48 @@ Ret Mixer::removeChannel(const TrackId id)
     return make_ret(Err::InvalidTrackId);
 }
 
+RetVal<MixerChannelPtr> Mixer::auxChannel(const aux_channel_idx_t index) const
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    RetVal<MixerChannelPtr> result;
+
+    if (index >= m_auxChannels.size()) {
+        result.val = nullptr;
+        result.ret = make_ret(Err::InvalidTrackId);
+        return result;
+    }
+
+    result.val = m_auxChannels[index].channel;
+    result.ret = make_ret(Ret::Code::Ok);
+
+    return result;
+}
+
 void Mixer::setAudioChannelsCount(const audioch_t count)
 {
     ONLY_AUDIO_WORKER_THREAD;
 
+    if (m_audioChannelsCount == count) {
+        return;
+    }
+
     m_audioChannelsCount = count;
+
+    createAuxChannels();
+}
+
+void Mixer::createAuxChannels()
+{
+    m_auxChannels.clear();
+
+    for (aux_channel_idx_t idx = 0; idx < AUX_CHANNEL_NUM; ++idx) {
+        AuxChannel aux;
+        aux.input = std::make_shared<AuxInputSource>(m_audioChannelsCount);
+        aux.channel = std::make_shared<MixerChannel>(auxTrackId(idx), aux.input, m_sampleRate);
+
+        m_auxChannels.push_back(std::move(aux));
+    }
 }
 
 void Mixer::setSampleRate(unsigned int sampleRate)
@@ -105,6 +154,10 @@ void Mixer::setSampleRate(unsigned int sampleRate)
     for (auto& channel : m_mixerChannels) {
         channel.second->setSampleRate(sampleRate);
     }
+
+    for (AuxChannel& aux : m_auxChannels) {
+        aux.channel->setSampleRate(sampleRate);
+    }
 }
 
 unsigned int Mixer::audioChannelsCount() const
@@ -118,6 +171,14 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
 {
     ONLY_AUDIO_WORKER_THREAD;
 
+    auto processingStart = std::chrono::steady_clock::now();
+    DEFER {
+        if (m_isDeadlineMonitored) {
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - processingStart;
+            updateBlockPerformance(elapsed.count(), samplesPerChannel);
+        }
+    };
+
     for (IClockPtr clock : m_clocks) {
         clock->forward((samplesPerChannel * 1000000) / m_sampleRate);
     }
@@ -130,31 +191,39 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
 
     samples_t masterChannelSampleCount = 0;
 
-    std::vector<std::future<std::vector<float> > > futureList;
+    //! NOTE The graph is processed by the dependency levels: the tracks first, then the aux channels fed by their sends.
+    //! The channels of one level don't depend on each other, so they are processed concurrently
+    for (AuxChannel& aux : m_auxChannels) {
+        aux.input->prepare(samplesPerChannel);
+        aux.hasSignal = false;
+    }
 
+    m_processedChannels.clear();
     for (const auto& pair : m_mixerChannels) {
-        MixerChannelPtr channel = pair.second;
-        std::future<std::vector<float> > future = TaskScheduler::instance()->submit([this, samplesPerChannel,
-                                                                                     channel]() -> std::vector<float> {
-            thread_local std::vector<float> buffer(samplesPerChannel * audioChannelsCount(), 0.f);
-            thread_local std::vector<float> silent_buffer(samplesPerChannel * audioChannelsCount(), 0.f);
+        m_processedChannels.push_back(pair.second.get());
+    }
 
-            buffer = silent_buffer;
+    processChannels(samplesPerChannel);
 
-            if (channel) {
-                channel->process(buffer.data(), samplesPerChannel);
-            }
+    for (size_t i = 0; i < m_processedChannels.size(); ++i) {
+        mixOutputFromChannel(outBuffer, m_channelBuffers[i].data(), samplesPerChannel);
+        sendToAuxChannels(m_processedChannels[i]->outputParams(), m_channelBuffers[i].data(), samplesPerChannel);
 
-            return buffer;
-        });
+        masterChannelSampleCount = std::max(samplesPerChannel, masterChannelSampleCount);
+    }
 
-        futureList.emplace_back(std::move(future));
+    //! NOTE An aux channel without fx keeps silent until a track sends a signal to it
+    m_processedChannels.clear();
+    for (const AuxChannel& aux : m_auxChannels) {
+        if (aux.hasSignal || !aux.channel->outputParams().fxChain.empty()) {
+            m_processedChannels.push_back(aux.channel.get());
+        }
     }
 
-    for (size_t i = 0; i < futureList.size(); ++i) {
-        mixOutputFromChannel(outBuffer, futureList[i].get().data(), samplesPerChannel);
+    processChannels(samplesPerChannel);
 
-        masterChannelSampleCount = std::max(samplesPerChannel, masterChannelSampleCount);
+    for (size_t i = 0; i < m_processedChannels.size(); ++i) {
+        mixOutputFromChannel(outBuffer, m_channelBuffers[i].data(), samplesPerChannel);
     }
 
     if (m_masterParams.muted || masterChannelSampleCount == 0) {
@@ -175,6 +244,61 @@ samples_t Mixer::process(float* outBuffer, samples_t samplesPerChannel)
     return masterChannelSampleCount;
 }
 
+void Mixer::processChannels(samples_t samplesPerChannel)
+{
+    //! NOTE The buffers are reallocated only when the channels or the block size change
+    const size_t bufferSize = samplesPerChannel * audioChannelsCount();
+    if (m_channelBuffers.size() < m_processedChannels.size()) {
+        m_channelBuffers.resize(m_processedChannels.size());
+    }
+    for (size_t i = 0; i < m_processedChannels.size(); ++i) {
+        m_channelBuffers[i].resize(bufferSize);
+    }
+
+    m_processedSamplesPerChannel = samplesPerChannel;
+
+    //! NOTE The heaviest channels (e.g. with a heavy plugin) are taken first, so the lighter ones
+    //! fill the other workers meanwhile, instead of a heavy one starting last and making the block longer
+    m_processingOrder.resize(m_processedChannels.size());
+    std::iota(m_processingOrder.begin(), m_processingOrder.end(), 0);
+    std::sort(m_processingOrder.begin(), m_processingOrder.end(), [this](size_t left, size_t right) {
+        float leftLoad = m_processedChannels[left]->cpuLoad();
+        float rightLoad = m_processedChannels[right]->cpuLoad();
+        return leftLoad != rightLoad ? leftLoad > rightLoad : left < right;
+    });
+
+    AudioWorkerPool::instance()->run(&Mixer::processChannel, this, m_processedChannels.size());
+}
+
+void Mixer::sendToAuxChannels(const AudioOutputParams& params, const float* buffer, samples_t samplesPerChannel)
+{
+    size_t auxCount = std::min(params.auxSends.size(), m_auxChannels.size());
+
+    for (size_t idx = 0; idx < auxCount; ++idx) {
+        const AuxSendParams& send = params.auxSends[idx];
+        if (!send.active || RealIsNull(send.signalAmount)) {
+            continue;
+        }
+
+        AuxChannel& aux = m_auxChannels[idx];
+        aux.input->addSignal(buffer, samplesPerChannel, send.signalAmount);
+        aux.hasSignal = true;
+    }
+}
+
+void Mixer::processChannel(void* mixer, size_t jobIdx)
+{
+    Mixer* self = static_cast<Mixer*>(mixer);
+    const size_t channelIdx = self->m_processingOrder[jobIdx];
+
+    std::vector<float>& buffer = self->m_channelBuffers[channelIdx];
+    std::fill(buffer.begin(), buffer.end(), 0.f);
+
+    if (MixerChannel* channel = self->m_processedChannels[channelIdx]) {
+        channel->process(buffer.data(), self->m_processedSamplesPerChannel);
+    }
+}
+
 void Mixer::setIsActive(bool arg)
 {
     ONLY_AUDIO_WORKER_THREAD;
@@ -266,6 +390,82 @@ async::Channel<audioch_t, AudioSignalVal> Mixer::masterAudioSignalChanges() cons
     return m_audioSignalNotifier.audioSignalChanges;
 }
 
+void Mixer::setDeadlineMonitored(bool monitored)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    m_isDeadlineMonitored = monitored;
+}
+
+AudioPerformanceStats Mixer::performanceStats() const
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    AudioPerformanceStats stats;
+    stats.blocksCount = m_blockPerformance.blocksCount;
+    stats.deadlineMissCount = m_blockPerformance.deadlineMissCount;
+    stats.averageBlockUsecs = m_blockPerformance.blocksCount > 0
+                              ? m_blockPerformance.sumUsecs / m_blockPerformance.blocksCount
+                              : 0.0;
+    stats.maxBlockUsecs = m_blockPerformance.maxUsecs;
+    stats.blockDeadlineUsecs = m_blockPerformance.deadlineUsecs;
+    stats.load = m_blockPerformance.load;
+    stats.maxLoad = m_blockPerformance.maxLoad;
+
+    for (const auto& pair : m_mixerChannels) {
+        AudioChannelPerformance channel = pair.second->performance();
+        stats.activeVoices += channel.activeVoices;
+        stats.channels.push_back(std::move(channel));
+    }
+
+    for (const AuxChannel& aux : m_auxChannels) {
+        AudioChannelPerformance channel = aux.channel->performance();
+        channel.isAux = true;
+        stats.channels.push_back(std::move(channel));
+    }
+
+    return stats;
+}
+
+void Mixer::resetPerformanceStats()
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    m_blockPerformance = BlockPerformance();
+
+    for (const auto& pair : m_mixerChannels) {
+        pair.second->resetPerformance();
+    }
+
+    for (const AuxChannel& aux : m_auxChannels) {
+        aux.channel->resetPerformance();
+    }
+}
+
+void Mixer::updateBlockPerformance(const double elapsedSecs, const samples_t samplesPerChannel)
+{
+    if (m_sampleRate == 0 || samplesPerChannel == 0) {
+        return;
+    }
+
+    BlockPerformance& perf = m_blockPerformance;
+
+    const double usecs = elapsedSecs * 1000000.0;
+    perf.deadlineUsecs = static_cast<double>(samplesPerChannel) * 1000000.0 / m_sampleRate;
+
+    ++perf.blocksCount;
+    perf.sumUsecs += usecs;
+    perf.maxUsecs = std::max(perf.maxUsecs, usecs);
+
+    if (usecs > perf.deadlineUsecs) {
+        ++perf.deadlineMissCount;
+    }
+
+    float blockLoad = static_cast<float>(usecs / perf.deadlineUsecs);
+    perf.load += (blockLoad - perf.load) * BLOCK_LOAD_SMOOTHING;
+    perf.maxLoad = std::max(perf.maxLoad, blockLoad);
+}
+
 void Mixer::mixOutputFromChannel(float* outBuffer, float* inBuffer, unsigned int samplesCount)
 {
     IF_ASSERT_FAILED(outBuffer && inBuffer) {
@@ -276,13 +476,7 @@ void Mixer::mixOutputFromChannel(float* outBuffer, float* inBuffer, unsigned int
         return;
     }
 
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-        for (samples_t s = 0; s < samplesCount; ++s) {
-            int idx = s * audioChannelsCount() + audioChNum;
-
-            outBuffer[idx] += inBuffer[idx];
-        }
-    }
+    dsp::mixSamples(outBuffer, inBuffer, samplesCount * audioChannelsCount());
 }
 
 void Mixer::completeOutput(float* buffer, const samples_t& samplesPerChannel)
@@ -293,24 +487,31 @@ void Mixer::completeOutput(float* buffer, const samples_t& samplesPerChannel)
 
     float totalSquaredSum = 0.f;
 
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-        float singleChannelSquaredSum = 0.f;
+    const audioch_t channelsCount = audioChannelsCount();
+    const gain_t volumeGain = dsp::linearFromDecibels(m_masterParams.volume);
 
-        gain_t totalGain = dsp::balanceGain(m_masterParams.balance, audioChNum) * dsp::linearFromDecibels(m_masterParams.volume);
+    if (channelsCount == 2) {
+        float leftSquaredSum = 0.f;
+        float rightSquaredSum = 0.f;
 
-        for (samples_t s = 0; s < samplesPerChannel; ++s) {
-            int idx = s * audioChannelsCount() + audioChNum;
+        dsp::applyStereoGain(buffer, samplesPerChannel,
+                             dsp::balanceGain(m_masterParams.balance, 0) * volumeGain,
+                             dsp::balanceGain(m_masterParams.balance, 1) * volumeGain,
+                             leftSquaredSum, rightSquaredSum);
 
-            float resultSample = buffer[idx] * totalGain;
-            buffer[idx] = resultSample;
+        notifyAboutAudioSignalChanges(0, dsp::samplesRootMeanSquare(leftSquaredSum, samplesPerChannel));
+        notifyAboutAudioSignalChanges(1, dsp::samplesRootMeanSquare(rightSquaredSum, samplesPerChannel));
 
-            float squaredSample = resultSample * resultSample;
-            totalSquaredSum += squaredSample;
-            singleChannelSquaredSum += squaredSample;
-        }
+        totalSquaredSum = leftSquaredSum + rightSquaredSum;
+    } else {
+        for (audioch_t audioChNum = 0; audioChNum < channelsCount; ++audioChNum) {
+            gain_t totalGain = dsp::balanceGain(m_masterParams.balance, audioChNum) * volumeGain;
+            float singleChannelSquaredSum = dsp::applyGain(buffer, channelsCount, audioChNum, samplesPerChannel, totalGain);
+
+            notifyAboutAudioSignalChanges(audioChNum, dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesPerChannel));
 
-        float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesPerChannel);
-        notifyAboutAudioSignalChanges(audioChNum, rms);
+            totalSquaredSum += singleChannelSquaredSum;
+        }
     }
 
     if (!m_limiter->isActive()) {
@@ -30,6 +30,7 @@
 
 #include "abstractaudiosource.h"
 #include "mixerchannel.h"
+#include "auxinputsource.h"
 #include "internal/dsp/limiter.h"
 #include "ifxresolver.h"
 #include "iclock.h"
@@ -47,6 +48,8 @@ public:
     RetVal<MixerChannelPtr> addChannel(const TrackId trackId, IAudioSourcePtr source);
     Ret removeChannel(const TrackId id);
 
+    RetVal<MixerChannelPtr> auxChannel(const aux_channel_idx_t index) const;
+
     void setAudioChannelsCount(const audioch_t count);
 
     void addClock(IClockPtr clock);
@@ -59,6 +62,11 @@ public:
 
     async::Channel<audioch_t, AudioSignalVal> masterAudioSignalChanges() const;
 
+    //! NOTE The deadline misses make sense only when rendering for the device, not while exporting
+    void setDeadlineMonitored(bool monitored);
+    AudioPerformanceStats performanceStats() const;
+    void resetPerformanceStats();
+
     // IAudioSource
     void setSampleRate(unsigned int sampleRate) override;
     unsigned int audioChannelsCount() const override;
@@ -66,23 +74,56 @@ public:
     void setIsActive(bool arg) override;
 
 private:
+    struct AuxChannel {
+        MixerChannelPtr channel = nullptr;
+        AuxInputSourcePtr input = nullptr;
+        bool hasSignal = false;
+    };
+
+    void createAuxChannels();
+    void processChannels(samples_t samplesPerChannel);
+    void sendToAuxChannels(const AudioOutputParams& params, const float* buffer, samples_t samplesPerChannel);
+
+    static void processChannel(void* mixer, size_t jobIdx);
+
     void mixOutputFromChannel(float* outBuffer, float* inBuffer, unsigned int samplesCount);
     void completeOutput(float* buffer, const samples_t& samplesPerChannel);
     void notifyAboutAudioSignalChanges(const audioch_t audioChannelNumber, const float linearRms) const;
+    void updateBlockPerformance(const double elapsedSecs, const samples_t samplesPerChannel);
 
     std::vector<float> m_writeCacheBuff;
 
+    //! NOTE The channels processed in the current block and their buffers, which are kept between the blocks
+    std::vector<MixerChannel*> m_processedChannels;
+    std::vector<std::vector<float> > m_channelBuffers;
+    std::vector<size_t> m_processingOrder;
+    samples_t m_processedSamplesPerChannel = 0;
+
     AudioOutputParams m_masterParams;
     async::Channel<AudioOutputParams> m_masterOutputParamsChanged;
     std::vector<IFxProcessorPtr> m_masterFxProcessors = {};
 
     std::map<TrackId, MixerChannelPtr> m_mixerChannels = {};
+    std::vector<AuxChannel> m_auxChannels;
     dsp::LimiterPtr m_limiter = nullptr;
 
     std::set<IClockPtr> m_clocks;
     audioch_t m_audioChannelsCount = 0;
 
     mutable AudioSignalsNotifier m_audioSignalNotifier;
+
+    struct BlockPerformance {
+        uint64_t blocksCount = 0;
+        uint64_t deadlineMissCount = 0;
+        double sumUsecs = 0.0;
+        double maxUsecs = 0.0;
+        double deadlineUsecs = 0.0;
+        float load = 0.f;
+        float maxLoad = 0.f;
+    };
+
+    bool m_isDeadlineMonitored = false;
+    BlockPerformance m_blockPerformance;
 };
 
 using MixerPtr = std::shared_ptr<Mixer>;
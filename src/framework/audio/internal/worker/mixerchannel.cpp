@@ -22,16 +22,22 @@
 #include "mixerchannel.h"
 
 #include <algorithm>
+#include <chrono>
 
 #include "log.h"
+#include "defer.h"
 
 #include "internal/dsp/audiomathutils.h"
 #include "internal/audiosanitizer.h"
+#include "track.h"
 
 using namespace mu;
 using namespace mu::audio;
 using namespace mu::async;
 
+//! NOTE The weight of the last block in the averaged cpu load
+static constexpr float CPU_LOAD_SMOOTHING = 0.05f;
+
 MixerChannel::MixerChannel(const TrackId trackId, IAudioSourcePtr source, const unsigned int sampleRate)
     : m_trackId(trackId),
     m_sampleRate(sampleRate),
@@ -137,6 +143,7 @@ void MixerChannel::setSampleRate(unsigned int sampleRate)
         return;
     }
 
+    m_sampleRate = sampleRate;
     m_audioSource->setSampleRate(sampleRate);
 
     for (IFxProcessorPtr fx : m_fxProcessors) {
@@ -174,6 +181,13 @@ samples_t MixerChannel::process(float* buffer, samples_t samplesPerChannel)
         return 0;
     }
 
+    auto processingStart = std::chrono::steady_clock::now();
+    std::chrono::duration<double> fxElapsed(0.0);
+    DEFER {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - processingStart;
+        updateCpuLoad(elapsed.count(), fxElapsed.count(), samplesPerChannel);
+    };
+
     samples_t processedSamplesCount = m_audioSource->process(buffer, samplesPerChannel);
 
     if (processedSamplesCount == 0 || m_params.muted) {
@@ -186,6 +200,8 @@ samples_t MixerChannel::process(float* buffer, samples_t samplesPerChannel)
         return processedSamplesCount;
     }
 
+    auto fxStart = std::chrono::steady_clock::now();
+
     for (IFxProcessorPtr fx : m_fxProcessors) {
         if (!fx->active()) {
             continue;
@@ -193,34 +209,91 @@ samples_t MixerChannel::process(float* buffer, samples_t samplesPerChannel)
         fx->process(buffer, samplesPerChannel);
     }
 
+    fxElapsed = std::chrono::steady_clock::now() - fxStart;
+
     completeOutput(buffer, samplesPerChannel);
 
     return processedSamplesCount;
 }
 
+float MixerChannel::cpuLoad() const
+{
+    return m_cpuLoad.load(std::memory_order_relaxed);
+}
+
+AudioChannelPerformance MixerChannel::performance() const
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    AudioChannelPerformance result;
+    result.trackId = m_trackId;
+    result.load = m_cpuLoad.load(std::memory_order_relaxed);
+    result.fxLoad = m_fxLoad.load(std::memory_order_relaxed);
+    result.maxLoad = m_maxCpuLoad.load(std::memory_order_relaxed);
+
+    //! NOTE Only the track inputs have the voices, the aux channels are fed by the sends
+    if (const ITrackAudioInput* input = dynamic_cast<const ITrackAudioInput*>(m_audioSource.get())) {
+        result.activeVoices = input->activeVoicesCount();
+    }
+
+    return result;
+}
+
+void MixerChannel::resetPerformance()
+{
+    m_maxCpuLoad.store(0.f, std::memory_order_relaxed);
+}
+
+void MixerChannel::updateCpuLoad(const double elapsedSecs, const double fxElapsedSecs, const samples_t samplesPerChannel)
+{
+    if (m_sampleRate == 0 || samplesPerChannel == 0) {
+        return;
+    }
+
+    const double blockSecs = static_cast<double>(samplesPerChannel) / m_sampleRate;
+
+    float blockLoad = static_cast<float>(elapsedSecs / blockSecs);
+    float load = m_cpuLoad.load(std::memory_order_relaxed);
+    m_cpuLoad.store(load + (blockLoad - load) * CPU_LOAD_SMOOTHING, std::memory_order_relaxed);
+
+    float fxBlockLoad = static_cast<float>(fxElapsedSecs / blockSecs);
+    float fxLoad = m_fxLoad.load(std::memory_order_relaxed);
+    m_fxLoad.store(fxLoad + (fxBlockLoad - fxLoad) * CPU_LOAD_SMOOTHING, std::memory_order_relaxed);
+
+    if (blockLoad > m_maxCpuLoad.load(std::memory_order_relaxed)) {
+        m_maxCpuLoad.store(blockLoad, std::memory_order_relaxed);
+    }
+}
+
 void MixerChannel::completeOutput(float* buffer, unsigned int samplesCount) const
 {
     float totalSquaredSum = 0.f;
 
-    for (audioch_t audioChNum = 0; audioChNum < audioChannelsCount(); ++audioChNum) {
-        float singleChannelSquaredSum = 0.f;
+    const audioch_t channelsCount = audioChannelsCount();
+    const gain_t volumeGain = dsp::linearFromDecibels(m_params.volume);
 
-        gain_t totalGain = dsp::balanceGain(m_params.balance, audioChNum) * dsp::linearFromDecibels(m_params.volume);
+    if (channelsCount == 2) {
+        float leftSquaredSum = 0.f;
+        float rightSquaredSum = 0.f;
 
-        for (unsigned int s = 0; s < samplesCount; ++s) {
-            int idx = s * audioChannelsCount() + audioChNum;
+        dsp::applyStereoGain(buffer, samplesCount,
+                             dsp::balanceGain(m_params.balance, 0) * volumeGain,
+                             dsp::balanceGain(m_params.balance, 1) * volumeGain,
+                             leftSquaredSum, rightSquaredSum);
 
-            float resultSample = buffer[idx] * totalGain;
-            buffer[idx] = resultSample;
+        notifyAboutAudioSignalChanges(0, dsp::samplesRootMeanSquare(leftSquaredSum, samplesCount));
+        notifyAboutAudioSignalChanges(1, dsp::samplesRootMeanSquare(rightSquaredSum, samplesCount));
 
-            float squaredSample = resultSample * resultSample;
-            singleChannelSquaredSum += squaredSample;
-            totalSquaredSum += squaredSample;
-        }
+        totalSquaredSum = leftSquaredSum + rightSquaredSum;
+    } else {
+        for (audioch_t audioChNum = 0; audioChNum < channelsCount; ++audioChNum) {
+            gain_t totalGain = dsp::balanceGain(m_params.balance, audioChNum) * volumeGain;
+            float singleChannelSquaredSum = dsp::applyGain(buffer, channelsCount, audioChNum, samplesCount, totalGain);
 
-        float rms = dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesCount);
+            notifyAboutAudioSignalChanges(audioChNum, dsp::samplesRootMeanSquare(singleChannelSquaredSum, samplesCount));
 
-        notifyAboutAudioSignalChanges(audioChNum, rms);
+            totalSquaredSum += singleChannelSquaredSum;
+        }
     }
 
     if (!m_compressor->isActive()) {
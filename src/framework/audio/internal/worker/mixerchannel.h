@@ -22,6 +22,8 @@
 #ifndef MU_AUDIO_MIXERCHANNEL_H
 #define MU_AUDIO_MIXERCHANNEL_H
 
+#include <atomic>
+
 #include "modularity/ioc.h"
 
 #include "async/asyncable.h"
@@ -53,7 +55,15 @@ public:
     async::Channel<unsigned int> audioChannelsCountChanged() const override;
     samples_t process(float* buffer, samples_t samplesPerChannel) override;
 
+    //! NOTE The share of the real time spent on processing the channel (source and fx), averaged over the recent blocks
+    float cpuLoad() const;
+
+    AudioChannelPerformance performance() const;
+    void resetPerformance();
+
 private:
+    void updateCpuLoad(const double elapsedSecs, const double fxElapsedSecs, const samples_t samplesPerChannel);
+
     void completeOutput(float* buffer, unsigned int samplesCount) const;
     void notifyAboutAudioSignalChanges(const audioch_t audioChannelNumber, const float linearRms) const;
 
@@ -67,6 +77,10 @@ private:
 
     dsp::CompressorPtr m_compressor = nullptr;
 
+    std::atomic<float> m_cpuLoad = 0.f;
+    std::atomic<float> m_fxLoad = 0.f;
+    std::atomic<float> m_maxCpuLoad = 0.f;
+
     mutable async::Channel<AudioOutputParams> m_paramsChanges;
     mutable AudioSignalsNotifier m_audioSignalNotifier;
 };
@@ -35,6 +35,9 @@ using namespace mu::async;
 PlayerHandler::PlayerHandler(IGetTrackSequence* getSequence)
     : m_getSequence(getSequence)
 {
+    //! NOTE The position is sent at every audio block, the main thread only needs the latest one
+    m_playbackPositionMsecsChanged.setCoalescing(true);
+    m_playbackPositionMsecsChanged.setDebugName("audio.playbackPositionMsecs");
 }
 
 PlayerHandler::~PlayerHandler()
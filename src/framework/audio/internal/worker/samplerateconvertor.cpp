@@ -20,62 +20,109 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 #include "samplerateconvertor.h"
-#include "log.h"
+
 #include <cmath>
+#include <numeric>
+
+#include "log.h"
 
 using namespace mu::audio;
 
+//! NOTE Kaiser window beta for about 80 dB of the stop band attenuation
+static constexpr double KAISER_BETA = 7.857;
+
+static double zeroBessel(double x)
+{
+    double sum = 1.0;
+    double term = 1.0;
+    double halfX = x / 2.0;
+
+    for (int k = 1; k < 50; ++k) {
+        term *= halfX / k;
+        double squaredTerm = term * term;
+        sum += squaredTerm;
+
+        if (squaredTerm < sum * 1e-12) {
+            break;
+        }
+    }
+
+    return sum;
+}
+
 SampleRateConvertor::SampleRateConvertor(const std::vector<float>& data,
                                          unsigned int channelsCount,
                                          unsigned int sampleRateIn,
                                          unsigned int sampleRateOut)
-    : m_data(data), m_fir(), m_channelsCount(channelsCount), m_sampleRateIn(sampleRateIn), m_sampleRateOut(sampleRateOut)
+    : m_data(data), m_channelsCount(channelsCount), m_sampleRateIn(sampleRateIn), m_sampleRateOut(sampleRateOut)
 {
-    m_fir.resize(FIR_LENGTH, 0);
-    m_y.resize(FIR_LENGTH, 0);
-    initWindow();
+    initFilter();
 }
 
 std::vector<float> SampleRateConvertor::convert()
 {
     std::vector<float> out;
-    auto resultSamples = m_data.size() * m_sampleRateOut / (m_channelsCount * m_sampleRateIn);
 
-    out.resize(resultSamples * m_channelsCount);
-    for (unsigned sample = 0; sample < resultSamples; ++sample) {
-        for (unsigned int channel = 0; channel < m_channelsCount; ++channel) {
-            out[sample * m_channelsCount + channel] = y(sample, channel);
-        }
+    if (m_channelsCount == 0) {
+        return out;
     }
 
+    auto resultSamples = static_cast<unsigned long long>(m_data.size()) * m_sampleRateOut / (m_channelsCount * m_sampleRateIn);
+
+    out.resize(resultSamples * m_channelsCount);
+    unsigned int converted = convertBlock(out.data(), 0, static_cast<unsigned int>(resultSamples));
+    out.resize(converted * m_channelsCount);
+
     return out;
 }
 
 unsigned int SampleRateConvertor::convert(float* buffer, unsigned int from, unsigned int count)
 {
-    unsigned int sample = from;
+    return convertBlock(buffer, from, count);
+}
+
+unsigned int SampleRateConvertor::convertBlock(float* buffer, unsigned int from, unsigned int count) const
+{
+    const long long inputSamples = m_channelsCount > 0 ? static_cast<long long>(m_data.size() / m_channelsCount) : 0;
+    const int halfLength = FILTER_LENGTH / 2;
+
     unsigned int converted = 0;
 
-    for (converted = 0; converted < count; ++converted, ++sample) {
+    for (; converted < count; ++converted) {
+        unsigned long long sample = from + converted;
+        if (!availableSamples(static_cast<unsigned int>(sample))) {
+            break;
+        }
+
+        unsigned long long position = sample * m_M;
+        long long zeroInputSample = static_cast<long long>(position / m_L);
+        unsigned long long phase = (position % m_L) * m_phasesCount / m_L;
+
+        const float* taps = m_filter.data() + phase * FILTER_LENGTH;
+        float* out = buffer + converted * m_channelsCount;
+
+        long long firstInputSample = zeroInputSample - halfLength + 1;
+
+        //! NOTE The taps are clamped only near the edges of the data
+        unsigned int firstTap = firstInputSample < 0 ? static_cast<unsigned int>(-firstInputSample) : 0;
+        unsigned int lastTap = FILTER_LENGTH;
+        if (firstInputSample + FILTER_LENGTH > inputSamples) {
+            lastTap = static_cast<unsigned int>(std::max<long long>(inputSamples - firstInputSample, 0));
+        }
+
         for (unsigned int channel = 0; channel < m_channelsCount; ++channel) {
-            if (!availableSamples(sample)) {
-                return converted;
+            const float* in = m_data.data() + firstInputSample * m_channelsCount + channel;
+
+            float y = 0.f;
+            for (unsigned int tap = firstTap; tap < lastTap; ++tap) {
+                y += in[tap * m_channelsCount] * taps[tap];
             }
-            buffer[converted * m_channelsCount + channel] = y(sample, channel);
+
+            out[channel] = y;
         }
     }
-    return converted;
-}
 
-float SampleRateConvertor::y(unsigned int sample, unsigned int channel) const
-{
-    switch (m_method) {
-    case SINC:
-        return ySinc(sample, channel);
-    case FIR:
-        return yFIR(sample, channel);
-    }
-    return 0.f;
+    return converted;
 }
 
 void SampleRateConvertor::setChannelCount(unsigned int count)
@@ -87,7 +134,7 @@ void SampleRateConvertor::setSampleRateIn(unsigned int sampleRate)
 {
     if (m_sampleRateIn != sampleRate) {
         m_sampleRateIn = sampleRate;
-        initWindow();
+        initFilter();
     }
 }
 
@@ -95,116 +142,69 @@ void SampleRateConvertor::setSampleRateOut(unsigned int sampleRate)
 {
     if (m_sampleRateOut != sampleRate) {
         m_sampleRateOut = sampleRate;
-        initWindow();
+        initFilter();
     }
 }
 
-float SampleRateConvertor::ySinc(unsigned int sample, unsigned int channel) const
+bool SampleRateConvertor::availableSamples(unsigned int sample) const
 {
-    double currentOutputSampleTime = sample / static_cast<double>(m_sampleRateOut);
-    auto zeroInputSample = std::floor(currentOutputSampleTime * m_sampleRateIn);
+    if (m_channelsCount == 0) {
+        return false;
+    }
 
-    float out = 0.f;
-    for (unsigned int i = 0; i < USE_SAMPLES; ++i) {
-        int currentSample = zeroInputSample + i - USE_SAMPLES / 2;
-        double currentInputSampleTime = currentSample / static_cast<double>(m_sampleRateIn);
+    // first sample for conversion points out of the input buffer
+    unsigned long long zeroInputSample = static_cast<unsigned long long>(sample) * m_M / m_L;
+    long long firstInputSample = static_cast<long long>(zeroInputSample) - FILTER_LENGTH / 2;
 
-        if (currentSample < 0 || currentSample * m_channelsCount + channel >= m_data.size()) {
-            continue;
-        }
-        out += m_data.at(currentSample * m_channelsCount + channel) * sinc(currentOutputSampleTime - currentInputSampleTime);
-    }
-    return out;
+    return firstInputSample < static_cast<long long>(m_data.size() / m_channelsCount);
 }
 
-float SampleRateConvertor::yFIR(unsigned int sample, unsigned int channel) const
+void SampleRateConvertor::initFilter()
 {
-    auto x = [this, &channel](int m) -> float {
-        int pos = m * m_M / m_L * m_channelsCount + channel;
-        if (pos >= 0 && pos < static_cast<int>(m_data.size())) {
-            return m_data.at(pos);
-        }
-        return 0.f;
-    };
-
-    float y = 0.f;
-    for (unsigned int i = 0; i < FIR_LENGTH; ++i) {
-        int t = sample - static_cast<int>(i);
-        y += x(t) * m_fir[i];
+    if (m_sampleRateIn == 0 || m_sampleRateOut == 0) {
+        return;
     }
-    return y;
-}
 
-bool SampleRateConvertor::availableSamples(unsigned int sample) const
-{
-    float currentOutputSampleTime = sample / static_cast<float>(m_sampleRateOut);
-    auto firstInputSample = std::floor(currentOutputSampleTime * m_sampleRateIn) - USE_SAMPLES / 2;
+    unsigned int divider = std::gcd(m_sampleRateIn, m_sampleRateOut);
+    m_M = m_sampleRateIn / divider;
+    m_L = m_sampleRateOut / divider;
 
-    // first sample for conversion points out of the input buffer
-    if (firstInputSample * m_channelsCount >= m_data.size()) {
-        return false;
-    }
-    return true;
-}
+    //! NOTE The phases are quantized, when the ratio of the sample rates has too many of them
+    m_phasesCount = std::min(m_L, MAX_PHASES_COUNT);
+    m_filter.assign(m_phasesCount * FILTER_LENGTH, 0.f);
 
-inline double zeroBessel(double x)
-{
-    //return std::cyl_bessel_i(0, x);
+    //! NOTE The cutoff follows the lower of the rates to prevent the aliasing on downsampling
+    const double cutoff = std::min(1.0, m_sampleRateOut / static_cast<double>(m_sampleRateIn));
+    const double halfLength = FILTER_LENGTH / 2.0;
+    const double windowNorm = zeroBessel(KAISER_BETA);
 
-    double s = 1, y = 1;
-    int m = 1;
+    for (unsigned int phase = 0; phase < m_phasesCount; ++phase) {
+        double fraction = phase / static_cast<double>(m_phasesCount);
+        float* taps = m_filter.data() + phase * FILTER_LENGTH;
 
-    while (y > std::numeric_limits<float>::min()) {
-        m += 2;
-        y *= x * x / (4 * m * m);
-        s += s * y;
-    }
+        double sum = 0.0;
 
-    return s;
-}
+        for (unsigned int tap = 0; tap < FILTER_LENGTH; ++tap) {
+            //! distance from the output sample to this input sample, in the input samples
+            double distance = (static_cast<double>(tap) - halfLength + 1.0) - fraction;
 
-void SampleRateConvertor::initWindow()
-{
-    int max = std::max(m_sampleRateIn, m_sampleRateOut), min = std::min(m_sampleRateIn, m_sampleRateOut);
-    int maxCommonDivider = 1;
-    while (max % min != 0) {
-        maxCommonDivider = max % min;
-        max = min;
-        min = maxCommonDivider;
-    }
-    m_M = m_sampleRateIn / maxCommonDivider;
-    m_L = m_sampleRateOut / maxCommonDivider;
-    double fStop = std::min(m_sampleRateIn, m_sampleRateOut) / 2,
-           fIntermediateSampleRate = m_sampleRateIn * m_M,
-           attenuation = 96 /*dB*/;
-    int M = FIR_LENGTH;
-    int Np = (M - 1) / 2;
-
-    double alpha = 0.1102 * (attenuation - 8.7);
-    double A[FIR_LENGTH];
-
-    A[0] = 2 * fStop / fIntermediateSampleRate;
-    for (int j = 1; j <= Np; j++) {
-        A[j]  = std::sin(2 * j * M_PI * fStop / fIntermediateSampleRate) / j * M_PI;
-    }
+            double sincArg = M_PI * cutoff * distance;
+            double sinc = distance == 0.0 ? 1.0 : std::sin(sincArg) / sincArg;
 
-    for (int j = 0; j <= Np; j++) {
-        m_fir[Np + j]  = A[j];
-        m_fir[Np + j] *= zeroBessel(alpha * std::sqrt(1 - (j * j / (Np * Np))));
-        m_fir[Np + j] /= zeroBessel(alpha);
-    }
+            double windowArg = distance / halfLength;
+            double window = std::abs(windowArg) >= 1.0 ? 0.0
+                            : zeroBessel(KAISER_BETA * std::sqrt(1.0 - windowArg * windowArg)) / windowNorm;
 
-    for (int j = 0; j < Np; j++) {
-        m_fir[j] = m_fir[M - 1 - j];
-    }
-}
+            double value = cutoff * sinc * window;
+            taps[tap] = static_cast<float>(value);
+            sum += value;
+        }
 
-double SampleRateConvertor::sinc(double value) const
-{
-    if (value == 0) {
-        return 1.f;
+        //! NOTE Every phase is normalized to the unity gain on DC
+        if (sum != 0.0) {
+            for (unsigned int tap = 0; tap < FILTER_LENGTH; ++tap) {
+                taps[tap] = static_cast<float>(taps[tap] / sum);
+            }
+        }
     }
-    double sincArg = M_PI * value * m_sampleRateIn;
-    double gain = std::min(1.0, m_sampleRateOut / static_cast<double>(m_sampleRateIn));
-    return gain * std::sin(sincArg) / sincArg;
 }
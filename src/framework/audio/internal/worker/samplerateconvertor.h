@@ -23,14 +23,13 @@
 #define MU_AUDIO_SAMPLERATECONVERTOR_H
 
 #include <vector>
-#include <deque>
+
 namespace mu::audio {
+//! NOTE Polyphase windowed sinc resampler: the filter of every phase is precomputed,
+//! so an output sample costs FILTER_LENGTH multiply-adds per channel
 class SampleRateConvertor
 {
 public:
-    enum Method {
-        SINC, FIR
-    };
     explicit SampleRateConvertor(const std::vector<float>& data, unsigned int channelsCount, unsigned int sampleRateIn,
                                  unsigned int sampleRateOut);
 
@@ -45,34 +44,28 @@ public:
     void setSampleRateOut(unsigned int sampleRate);
 
 private:
-
-    //! return value of sinc function (LPF) with consideration of used sampleRates
-    double sinc(double value) const;
-
-    //! output sample value
-    float y(unsigned int sample, unsigned int channel) const;
-    float ySinc(unsigned int sample, unsigned int channel) const;
-    float yFIR(unsigned int sample, unsigned int channel) const;
+    //! convert the output samples [from, from + count) into the buffer, returns the number of the converted samples
+    unsigned int convertBlock(float* buffer, unsigned int from, unsigned int count) const;
 
     //! return true if there are samples in input buffer for conversion
     bool availableSamples(unsigned int sample) const;
 
-    //! calculate window function values
-    void initWindow();
+    //! calculate the filter tables of all the phases
+    void initFilter();
+
+    const static unsigned int FILTER_LENGTH = 16; //!< this value defines the quality and complexity of SRC.
+    const static unsigned int MAX_PHASES_COUNT = 512;
 
-    const static unsigned int USE_SAMPLES = 16; //!< this value defines the quality and complexity of SRC.
     const std::vector<float>& m_data;
 
-    //! values of window function for USE_SAMPLES
-    const static unsigned int FIR_LENGTH = 33;
+    //! the output sample n takes the input samples around n * m_M / m_L
     unsigned int m_M = 1, m_L = 1;
-    std::vector<float> m_fir;
-    mutable std::deque<float> m_y;
+    unsigned int m_phasesCount = 1;
+    std::vector<float> m_filter; //!< m_phasesCount x FILTER_LENGTH
 
     unsigned int m_channelsCount;
     unsigned int m_sampleRateIn;
     unsigned int m_sampleRateOut;
-    Method m_method = FIR;
 };
 }
 
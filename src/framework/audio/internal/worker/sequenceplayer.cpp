@@ -25,6 +25,7 @@
 #include "log.h"
 
 #include "internal/audiosanitizer.h"
+#include "audioengine.h"
 
 using namespace mu;
 using namespace mu::audio;
@@ -43,6 +44,15 @@ SequencePlayer::SequencePlayer(IGetTracks* getTracks, IClockPtr clock)
         for (auto& pair : tracks()) {
             pair.second->inputHandler->setIsActive(status == PlaybackStatus::Running);
         }
+
+        //! NOTE The performance counters cover one playback run and are summarised when it ends
+        if (status == PlaybackStatus::Running) {
+            AudioEngine::instance()->resetPerformanceStats();
+            m_isPerformanceRun = true;
+        } else if (m_isPerformanceRun) {
+            AudioEngine::instance()->logPerformanceSummary();
+            m_isPerformanceRun = false;
+        }
     });
 }
 
@@ -123,7 +133,15 @@ Ret SequencePlayer::setLoop(const msecs_t fromMsec, const msecs_t toMsec)
 {
     ONLY_AUDIO_WORKER_THREAD;
 
-    return m_clock->setTimeLoop(fromMsec * 1000, toMsec * 1000);
+    Ret ret = m_clock->setTimeLoop(fromMsec * 1000, toMsec * 1000);
+
+    if (ret) {
+        for (auto& pair : tracks()) {
+            pair.second->inputHandler->setPreRollPosition(fromMsec * 1000);
+        }
+    }
+
+    return ret;
 }
 
 void SequencePlayer::resetLoop()
@@ -131,6 +149,10 @@ void SequencePlayer::resetLoop()
     ONLY_AUDIO_WORKER_THREAD;
 
     m_clock->resetTimeLoop();
+
+    for (auto& pair : tracks()) {
+        pair.second->inputHandler->setPreRollPosition(-1);
+    }
 }
 
 Channel<msecs_t> SequencePlayer::playbackPositionMSecs() const
@@ -54,6 +54,7 @@ private:
 
     IGetTracks* m_getTracks = nullptr;
     IClockPtr m_clock = nullptr;
+    bool m_isPerformanceRun = false;
 };
 }
 
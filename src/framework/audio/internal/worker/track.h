@@ -46,9 +46,14 @@ public:
     virtual ~ITrackAudioInput() = default;
 
     virtual void seek(const msecs_t newPositionMsecs) = 0;
+
+    //! NOTE A position the playback is expected to jump to (e.g. the loop start), -1 if there is none
+    virtual void setPreRollPosition(const msecs_t positionMsecs) = 0;
     virtual const AudioInputParams& inputParams() const = 0;
     virtual void applyInputParams(const AudioInputParams& requiredParams) = 0;
     virtual async::Channel<AudioInputParams> inputParamsChanged() const = 0;
+
+    virtual unsigned int activeVoicesCount() const = 0;
 };
 
 class ITrackAudioOutput : public IAudioSource
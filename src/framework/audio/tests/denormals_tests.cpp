@@ -0,0 +1,143 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "audio/internal/dsp/audiomathutils.h"
+#include "audio/internal/dsp/compressor.h"
+#include "audio/internal/dsp/limiter.h"
+
+using namespace mu::audio;
+
+namespace mu::audio {
+class Audio_DenormalsTests : public ::testing::Test
+{
+public:
+    struct Result {
+        int64_t loudNsPerBlock = 0;
+        int64_t silenceNsPerBlock = 0;
+        size_t subnormalsCount = 0;
+    };
+
+    static constexpr unsigned int SAMPLE_RATE = 48000;
+    static constexpr audioch_t CHANNELS = 2;
+    static constexpr samples_t FRAMES = 512;
+    static constexpr size_t SAMPLES = FRAMES * CHANNELS;
+
+    static constexpr int LOUD_BLOCKS = 200;
+    static constexpr int SILENCE_BLOCKS = 2000;
+
+    //! NOTE The chain of the master channel: the gain, then the compressor and the limiter
+    static Result processLoudPassageThenSilence()
+    {
+        using clock = std::chrono::steady_clock;
+
+        //! NOTE The same as on the audio worker threads
+        dsp::setFlushDenormalsToZero();
+
+        dsp::Compressor compressor(SAMPLE_RATE);
+        compressor.setIsActive(true);
+
+        dsp::Limiter limiter(SAMPLE_RATE);
+        limiter.setIsActive(true);
+
+        std::vector<float> buffer(SAMPLES);
+
+        //! NOTE The silence is the decaying tail of the loud passage (like a reverb tail),
+        //! it goes down through the denormal range in the first half of the silent blocks
+        const float decay = std::exp(-2.f * 110.f / (SILENCE_BLOCKS * FRAMES));
+        float amplitude = 1.f;
+        float phase = 0.f;
+
+        Result result;
+
+        auto processBlock = [&](bool silence) {
+            for (samples_t s = 0; s < FRAMES; ++s) {
+                if (silence) {
+                    amplitude *= decay;
+                }
+
+                phase += 0.05f;
+                buffer[s * CHANNELS] = amplitude * std::sin(phase);
+                buffer[s * CHANNELS + 1] = amplitude * std::cos(phase);
+            }
+
+            float leftSquaredSum = 0.f;
+            float rightSquaredSum = 0.f;
+            dsp::applyStereoGain(buffer.data(), FRAMES, 0.5f, 0.5f, leftSquaredSum, rightSquaredSum);
+
+            float rms = dsp::samplesRootMeanSquare(leftSquaredSum + rightSquaredSum, SAMPLES);
+            compressor.process(rms, buffer.data(), CHANNELS, FRAMES);
+            limiter.process(rms, buffer.data(), CHANNELS, FRAMES);
+
+            if (silence) {
+                for (float sample : buffer) {
+                    if (std::fpclassify(sample) == FP_SUBNORMAL) {
+                        ++result.subnormalsCount;
+                    }
+                }
+            }
+        };
+
+        clock::time_point start = clock::now();
+        for (int i = 0; i < LOUD_BLOCKS; ++i) {
+            processBlock(false);
+        }
+        result.loudNsPerBlock = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count() / LOUD_BLOCKS;
+
+        start = clock::now();
+        for (int i = 0; i < SILENCE_BLOCKS; ++i) {
+            processBlock(true);
+        }
+        result.silenceNsPerBlock = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count()
+                                   / SILENCE_BLOCKS;
+
+        return result;
+    }
+};
+}
+
+TEST_F(Audio_DenormalsTests, SilenceAfterLoudPassage)
+{
+    // [GIVEN] The FTZ/DAZ mode is per thread, so the chain runs on its own thread, like on the audio worker
+    Result result;
+
+    // [WHEN] Process a loud passage, then its decaying tail
+    std::thread thread([&result]() {
+        result = processLoudPassageThenSilence();
+    });
+    thread.join();
+
+    RecordProperty("loud_ns_per_block", std::to_string(result.loudNsPerBlock));
+    RecordProperty("silence_ns_per_block", std::to_string(result.silenceNsPerBlock));
+
+#if defined(MU_AUDIO_SSE_CONTROL_REGISTER) || (defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__)))
+    // [THEN] There are no denormals in the output
+    EXPECT_EQ(result.subnormalsCount, 0u);
+#else
+    GTEST_SKIP() << "No FTZ control on this platform";
+#endif
+}
@@ -0,0 +1,211 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2024 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#include "audio/internal/dsp/audiomathutils.h"
+
+using namespace mu::audio;
+
+namespace mu::audio {
+class Audio_DspKernelsTests : public ::testing::Test
+{
+public:
+
+    static constexpr audioch_t CHANNELS = 2;
+    static constexpr samples_t FRAMES = 512;
+    static constexpr size_t SAMPLES = FRAMES * CHANNELS;
+
+    //! NOTE The typical render block, the same iterations count for every kernel, so the timings are comparable
+    static constexpr int ITERATIONS = 20000;
+
+    static std::vector<float> makeBuffer(float seed)
+    {
+        std::vector<float> buffer(SAMPLES);
+        for (size_t i = 0; i < SAMPLES; ++i) {
+            buffer[i] = std::sin(seed + 0.01f * static_cast<float>(i)) * 0.5f;
+        }
+
+        return buffer;
+    }
+
+    template<typename Func>
+    void benchmark(const std::string& name, Func func)
+    {
+        using clock = std::chrono::steady_clock;
+
+        clock::time_point start = clock::now();
+        for (int i = 0; i < ITERATIONS; ++i) {
+            func();
+        }
+
+        auto nsecs = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count();
+        RecordProperty(name + "_ns_per_block", std::to_string(nsecs / ITERATIONS));
+    }
+};
+}
+
+//! NOTE The reference is the per channel scalar loop the kernels replace
+static float scalarApplyGain(float* buffer, audioch_t channels, audioch_t channel, samples_t frames, gain_t gain)
+{
+    float squaredSum = 0.f;
+    for (samples_t s = 0; s < frames; ++s) {
+        float& sample = buffer[s * channels + channel];
+        sample *= gain;
+        squaredSum += sample * sample;
+    }
+
+    return squaredSum;
+}
+
+TEST_F(Audio_DspKernelsTests, MixSamples)
+{
+    // [GIVEN] Two blocks
+    std::vector<float> out = makeBuffer(0.f);
+    std::vector<float> in = makeBuffer(1.f);
+
+    std::vector<float> expected = out;
+    for (size_t i = 0; i < SAMPLES; ++i) {
+        expected[i] += in[i];
+    }
+
+    // [WHEN] Mix the second one into the first one
+    dsp::mixSamples(out.data(), in.data(), SAMPLES);
+
+    // [THEN] Every sample is the sum
+    for (size_t i = 0; i < SAMPLES; ++i) {
+        EXPECT_FLOAT_EQ(out[i], expected[i]);
+    }
+
+    benchmark("mixSamples", [&]() {
+        dsp::mixSamples(out.data(), in.data(), SAMPLES);
+    });
+}
+
+TEST_F(Audio_DspKernelsTests, MultiplyAllSamples)
+{
+    // [GIVEN] A block
+    std::vector<float> buffer = makeBuffer(0.f);
+    std::vector<float> expected = buffer;
+
+    // [GIVEN] The same multiplier applied channel by channel
+    for (audioch_t ch = 0; ch < CHANNELS; ++ch) {
+        dsp::multiplySamples(expected.data(), CHANNELS, ch, FRAMES, 0.7f);
+    }
+
+    // [WHEN] Multiply the whole interleaved block at once
+    dsp::multiplyAllSamples(buffer.data(), SAMPLES, 0.7f);
+
+    // [THEN] The result is the same
+    for (size_t i = 0; i < SAMPLES; ++i) {
+        EXPECT_FLOAT_EQ(buffer[i], expected[i]);
+    }
+
+    //! NOTE Alternates the multipliers, so the buffer neither grows nor decays during the iterations
+    bool up = true;
+    benchmark("multiplyAllSamples", [&]() {
+        dsp::multiplyAllSamples(buffer.data(), SAMPLES, up ? 2.f : 0.5f);
+        up = !up;
+    });
+
+    benchmark("multiplySamples_perChannel", [&]() {
+        for (audioch_t ch = 0; ch < CHANNELS; ++ch) {
+            dsp::multiplySamples(expected.data(), CHANNELS, ch, FRAMES, up ? 2.f : 0.5f);
+        }
+        up = !up;
+    });
+}
+
+TEST_F(Audio_DspKernelsTests, ApplyGain)
+{
+    // [GIVEN] A block
+    std::vector<float> buffer = makeBuffer(0.f);
+    std::vector<float> expected = buffer;
+
+    // [WHEN] Apply the gain to each channel
+    for (audioch_t ch = 0; ch < CHANNELS; ++ch) {
+        float expectedSum = scalarApplyGain(expected.data(), CHANNELS, ch, FRAMES, 0.8f);
+        float sum = dsp::applyGain(buffer.data(), CHANNELS, ch, FRAMES, 0.8f);
+
+        // [THEN] The squared sum matches the reference
+        EXPECT_NEAR(sum, expectedSum, expectedSum * 1e-5f);
+    }
+
+    // [THEN] The samples match the reference
+    for (size_t i = 0; i < SAMPLES; ++i) {
+        EXPECT_FLOAT_EQ(buffer[i], expected[i]);
+    }
+
+    bool up = true;
+    float sum = 0.f;
+    benchmark("applyGain", [&]() {
+        for (audioch_t ch = 0; ch < CHANNELS; ++ch) {
+            sum += dsp::applyGain(buffer.data(), CHANNELS, ch, FRAMES, up ? 2.f : 0.5f);
+        }
+        up = !up;
+    });
+
+    EXPECT_GT(sum, 0.f);
+}
+
+TEST_F(Audio_DspKernelsTests, ApplyStereoGain)
+{
+    // [GIVEN] A stereo block, the frames count is not a multiple of the lanes count, so the tail is covered too
+    constexpr samples_t frames = FRAMES - 3;
+
+    std::vector<float> buffer = makeBuffer(0.f);
+    std::vector<float> expected = buffer;
+
+    float expectedLeftSum = scalarApplyGain(expected.data(), CHANNELS, 0, frames, 0.6f);
+    float expectedRightSum = scalarApplyGain(expected.data(), CHANNELS, 1, frames, 1.2f);
+
+    // [WHEN] Apply the gains to both channels at once
+    float leftSum = 0.f;
+    float rightSum = 0.f;
+    dsp::applyStereoGain(buffer.data(), frames, 0.6f, 1.2f, leftSum, rightSum);
+
+    // [THEN] The squared sums match the reference, up to the summation order
+    EXPECT_NEAR(leftSum, expectedLeftSum, expectedLeftSum * 1e-5f);
+    EXPECT_NEAR(rightSum, expectedRightSum, expectedRightSum * 1e-5f);
+
+    // [THEN] The samples match the reference, the ones after the frames count are untouched
+    for (size_t i = 0; i < SAMPLES; ++i) {
+        EXPECT_FLOAT_EQ(buffer[i], expected[i]);
+    }
+
+    bool up = true;
+    benchmark("applyStereoGain", [&]() {
+        dsp::applyStereoGain(buffer.data(), FRAMES, up ? 2.f : 0.5f, up ? 2.f : 0.5f, leftSum, rightSum);
+        up = !up;
+    });
+
+    benchmark("applyGain_perChannel", [&]() {
+        leftSum = scalarApplyGain(expected.data(), CHANNELS, 0, FRAMES, up ? 2.f : 0.5f);
+        rightSum = scalarApplyGain(expected.data(), CHANNELS, 1, FRAMES, up ? 2.f : 0.5f);
+        up = !up;
+    });
+
+    EXPECT_GT(leftSum + rightSum, 0.f);
+}
@@ -68,8 +68,12 @@ bool BufferedPaintProvider::isActive() const
 
 void BufferedPaintProvider::beginObject(const std::string& name, const PointF& pagePos)
 {
+    //! NOTE The object is painted with the state left by the previous ones
+    DrawData::State state = currentState();
+
     // add new object
     m_currentObjects.push(DrawData::Object(name, pagePos));
+    m_currentObjects.top().datas.back().state = state;
 
 #ifdef TRACE_DRAW_OBJ_ENABLED
     m_drawObjectsLogger->beginObject(name, pagePos);
@@ -111,8 +115,27 @@ const DrawData::State& BufferedPaintProvider::currentState() const
     return currentData().state;
 }
 
-DrawData::Data& BufferedPaintProvider::editableData()
+static bool hasOtherKind(const DrawData::Data& data, bool hasPaths, bool hasPolygons, bool hasTexts, bool hasPixmaps)
+{
+    return (!hasPaths && !data.paths.empty()) || (!hasPolygons && !data.polygons.empty())
+           || (!hasTexts && !data.texts.empty()) || (!hasPixmaps && !data.pixmaps.empty());
+}
+
+DrawData::Data& BufferedPaintProvider::editableData(DrawKind kind)
 {
+    DrawData::Data& data = m_currentObjects.top().datas.back();
+
+    bool isOtherKind = hasOtherKind(data, kind == DrawKind::Path, kind == DrawKind::Polygon,
+                                    kind == DrawKind::Text, kind == DrawKind::Pixmap);
+    if (!isOtherKind) {
+        return data;
+    }
+
+    {
+        DrawData::Data newData;
+        newData.state = data.state;
+        m_currentObjects.top().datas.push_back(std::move(newData));
+    }
     return m_currentObjects.top().datas.back();
 }
 
@@ -216,7 +239,7 @@ void BufferedPaintProvider::drawPath(const PainterPath& path)
     } else if (st.brush.style() == BrushStyle::NoBrush) {
         mode = DrawMode::Stroke;
     }
-    editableData().paths.push_back({ path, st.pen, st.brush, mode });
+    editableData(DrawKind::Path).paths.push_back({ path, st.pen, st.brush, mode });
 }
 
 void BufferedPaintProvider::drawPolygon(const PointF* points, size_t pointCount, PolygonMode mode)
@@ -225,49 +248,51 @@ void BufferedPaintProvider::drawPolygon(const PointF* points, size_t pointCount,
     for (size_t i = 0; i < pointCount; ++i) {
         pol[i] = PointF(points[i].x(), points[i].y());
     }
-    editableData().polygons.push_back(DrawPolygon { pol, mode });
+    editableData(DrawKind::Polygon).polygons.push_back(DrawPolygon { pol, mode });
 }
 
 void BufferedPaintProvider::drawText(const PointF& point, const String& text)
 {
-    editableData().texts.push_back(DrawText { DrawText::Point, RectF(point, SizeF()), 0, text });
+    editableData(DrawKind::Text).texts.push_back(DrawText { DrawText::Point, RectF(point, SizeF()), 0, text });
 }
 
 void BufferedPaintProvider::drawText(const RectF& rect, int flags, const String& text)
 {
-    editableData().texts.push_back(DrawText { DrawText::Rect, rect, flags, text });
+    editableData(DrawKind::Text).texts.push_back(DrawText { DrawText::Rect, rect, flags, text });
 }
 
 void BufferedPaintProvider::drawTextWorkaround(const Font& f, const PointF& pos, const String& text)
 {
     setFont(f);
-    drawText(pos, text);
+    editableData(DrawKind::Text).texts.push_back(DrawText { DrawText::Workaround, RectF(pos, SizeF()), 0, text });
 }
 
 void BufferedPaintProvider::drawSymbol(const PointF& point, char32_t ucs4Code)
 {
-    drawText(point, String::fromUcs4(&ucs4Code, 1));
+    editableData(DrawKind::Text).texts.push_back(DrawText { DrawText::Symbol, RectF(point, SizeF()), 0,
+                                                            String::fromUcs4(&ucs4Code, 1) });
 }
 
 void BufferedPaintProvider::drawPixmap(const PointF& p, const Pixmap& pm)
 {
-    editableData().pixmaps.push_back(DrawPixmap { DrawPixmap::Single, RectF(p, SizeF()), pm, PointF() });
+    editableData(DrawKind::Pixmap).pixmaps.push_back(DrawPixmap { DrawPixmap::Single, RectF(p, SizeF()), pm, PointF() });
 }
 
 void BufferedPaintProvider::drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF& offset)
 {
-    editableData().pixmaps.push_back(DrawPixmap { DrawPixmap::Tiled, rect, pm, offset });
+    editableData(DrawKind::Pixmap).pixmaps.push_back(DrawPixmap { DrawPixmap::Tiled, rect, pm, offset });
 }
 
 #ifndef NO_QT_SUPPORT
 void BufferedPaintProvider::drawPixmap(const PointF& p, const QPixmap& pm)
 {
-    editableData().pixmaps.push_back(DrawPixmap { DrawPixmap::Single, RectF(p, SizeF()), Pixmap::fromQPixmap(pm), PointF() });
+    editableData(DrawKind::Pixmap).pixmaps.push_back(DrawPixmap { DrawPixmap::Single, RectF(p, SizeF()), Pixmap::fromQPixmap(pm),
+                                                                  PointF() });
 }
 
 void BufferedPaintProvider::drawTiledPixmap(const RectF& rect, const QPixmap& pm, const PointF& offset)
 {
-    editableData().pixmaps.push_back(DrawPixmap { DrawPixmap::Tiled, rect, Pixmap::fromQPixmap(pm), offset });
+    editableData(DrawKind::Pixmap).pixmaps.push_back(DrawPixmap { DrawPixmap::Tiled, rect, Pixmap::fromQPixmap(pm), offset });
 }
 
 #endif
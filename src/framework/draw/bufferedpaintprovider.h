@@ -95,8 +95,15 @@ public:
 
 private:
 
+    enum class DrawKind {
+        Path,
+        Polygon,
+        Text,
+        Pixmap
+    };
+
     const DrawData::Data& currentData() const;
-    DrawData::Data& editableData();
+    DrawData::Data& editableData(DrawKind kind);
 
     const DrawData::State& currentState() const;
     DrawData::State& editableState();
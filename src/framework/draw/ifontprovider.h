@@ -23,6 +23,8 @@
 #ifndef MU_DRAW_IFONTPROVIDER_H
 #define MU_DRAW_IFONTPROVIDER_H
 
+#include <vector>
+
 #include "modularity/imoduleexport.h"
 
 #include "io/path.h"
@@ -40,6 +42,9 @@ public:
 
     virtual int addSymbolFont(const String& family, const io::path_t& path) = 0;
     virtual int addTextFont(const io::path_t& path) = 0;
+
+    //! NOTE The file is loaded the first time a font of this family (or a family substituted by it) is measured
+    virtual void addLazyTextFont(const String& family, const io::path_t& path) = 0;
     virtual void insertSubstitution(const String& familyName, const String& substituteName) = 0;
 
     virtual double lineSpacing(const Font& f) const = 0;
@@ -63,6 +68,10 @@ public:
     // Score symbols
     virtual RectF symBBox(const Font& f, char32_t ucs4, double DPI_F) const = 0;
     virtual double symAdvance(const Font& f, char32_t ucs4, double DPI_F) const = 0;
+
+    //! NOTE The bboxes and the advances of several symbols at once
+    virtual void symMetrics(const Font& f, const std::vector<char32_t>& ucs4s, double DPI_F, std::vector<RectF>& bboxes,
+                            std::vector<double>& advances) const = 0;
 };
 }
 
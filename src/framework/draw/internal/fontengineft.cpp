@@ -21,7 +21,9 @@
  */
 #include "fontengineft.h"
 
-#include <QHash>
+#include <atomic>
+#include <memory>
+#include <mutex>
 
 #include "io/file.h"
 
@@ -49,17 +51,64 @@ static bool _init_ft()
     return error == 0;
 }
 
+//! NOTE Moved form sym.cpp ScoreFont::computeMetrics: the bbox is in 1/64 pixels
+//! of the 200 pixels size (see load), so it is divided by 640 / DPI_F, and the advance in 1/65536 pixels
+static constexpr double BBOX_UNITS_PER_DPI = 640.0;
+static constexpr double ADVANCE_UNITS_PER_DPI = 655360.0;
+// the metrics for DPI_F = 1 are the ones of the 20 pixels size
+static constexpr double PIXEL_SIZE_PER_DPI = 20.0;
+
 struct mu::draw::FTGlyphMetrics
 {
-    FT_BBox bb;
-    double linearHoriAdvance = 0.0;
+    enum State : uint8_t {
+        Unknown = 0,
+        Missing,
+        Loaded
+    };
+
+    std::atomic<uint8_t> state { Unknown };
+
+    // for DPI_F = 1
+    double xMin = 0.0;
+    double yMin = 0.0;
+    double xMax = 0.0;
+    double yMax = 0.0;
+    double advance = 0.0;
+};
+
+//! NOTE The metrics are kept in pages of 256 glyphs, a page is never moved once it is made,
+//! so the loaded metrics are read without a lock
+static constexpr char32_t MAX_UCS4 = 0x10FFFF;
+static constexpr size_t METRICS_PAGE_BITS = 8;
+static constexpr size_t METRICS_PAGE_SIZE = size_t(1) << METRICS_PAGE_BITS;
+static constexpr size_t METRICS_PAGE_COUNT = (size_t(MAX_UCS4) >> METRICS_PAGE_BITS) + 1;
+
+struct FTGlyphMetricsPage {
+    FTGlyphMetrics glyphs[METRICS_PAGE_SIZE];
 };
 
 struct mu::draw::FTData
 {
     ByteArray fontData;
     FT_Face face = nullptr;
-    QHash<char32_t, FTGlyphMetrics> metrics;
+
+    std::unique_ptr<std::atomic<FTGlyphMetricsPage*>[]> metricsPages;
+    std::mutex faceMutex; // FreeType faces are not for several threads at once
+
+    FTData()
+        : metricsPages(new std::atomic<FTGlyphMetricsPage*>[METRICS_PAGE_COUNT])
+    {
+        for (size_t i = 0; i < METRICS_PAGE_COUNT; ++i) {
+            metricsPages[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ~FTData()
+    {
+        for (size_t i = 0; i < METRICS_PAGE_COUNT; ++i) {
+            delete metricsPages[i].load(std::memory_order_relaxed);
+        }
+    }
 };
 
 FontEngineFT::FontEngineFT()
@@ -99,55 +148,132 @@ bool FontEngineFT::load(const io::path_t& path)
     return true;
 }
 
+static QRectF scaledBBox(const FTGlyphMetrics& gm, double dpi_f)
+{
+    QRectF bbox;
+    bbox.setCoords(gm.xMin * dpi_f, -gm.yMax * dpi_f, gm.xMax * dpi_f, -gm.yMin * dpi_f);
+    return bbox;
+}
+
 QRectF FontEngineFT::bbox(char32_t ucs4, double dpi_f) const
 {
-    FTGlyphMetrics* gm = glyphMetrics(ucs4);
+    const FTGlyphMetrics* gm = glyphMetrics(ucs4);
     if (!gm) {
         return QRectF();
     }
 
-    const FT_BBox& bb = gm->bb;
-    //! NOTE Moved form sym.cpp ScoreFont::computeMetrics as is
-    double m = 640.0 / dpi_f;
-    QRectF bbox;
-    bbox.setCoords(bb.xMin / m, -bb.yMax / m, bb.xMax / m, -bb.yMin / m);
-    return bbox;
+    return scaledBBox(*gm, dpi_f);
 }
 
 double FontEngineFT::advance(char32_t ucs4, double dpi_f) const
 {
-    FTGlyphMetrics* gm = glyphMetrics(ucs4);
+    const FTGlyphMetrics* gm = glyphMetrics(ucs4);
     if (!gm) {
         return 0.0;
     }
 
-    //! NOTE Moved form sym.cpp ScoreFont::computeMetrics as is
-    return gm->linearHoriAdvance * dpi_f / 655360.0;
+    return gm->advance * dpi_f;
 }
 
-FTGlyphMetrics* FontEngineFT::glyphMetrics(char32_t ucs4) const
+void FontEngineFT::metrics(const char32_t* ucs4s, size_t count, double dpi_f, QRectF* bboxes, double* advances) const
 {
-    if (m_data->metrics.contains(ucs4)) {
-        return &m_data->metrics[ucs4];
+    for (size_t i = 0; i < count; ++i) {
+        const FTGlyphMetrics* gm = glyphMetrics(ucs4s[i]);
+        if (bboxes) {
+            bboxes[i] = gm ? scaledBBox(*gm, dpi_f) : QRectF();
+        }
+        if (advances) {
+            advances[i] = gm ? gm->advance * dpi_f : 0.0;
+        }
     }
+}
 
-    FT_UInt index = FT_Get_Char_Index(m_data->face, ucs4);
-    if (index == 0) {
-        return nullptr;
+bool FontEngineFT::textMetrics(const std::u32string& text, double pixelSize, double* advance, QRectF* tightBBox) const
+{
+    const double dpi_f = pixelSize / PIXEL_SIZE_PER_DPI;
+
+    double x = 0.0;
+    QRectF rect;
+    for (char32_t ucs4 : text) {
+        const FTGlyphMetrics* gm = glyphMetrics(ucs4);
+        if (!gm) {
+            return false;
+        }
+
+        if (tightBBox) {
+            QRectF bbox = scaledBBox(*gm, dpi_f);
+            if (bbox.isValid()) {
+                rect |= bbox.translated(x, 0.0);
+            }
+        }
+
+        x += gm->advance * dpi_f;
     }
 
-    if (FT_Load_Glyph(m_data->face, index, FT_LOAD_DEFAULT) != 0) {
+    if (advance) {
+        *advance = x;
+    }
+    if (tightBBox) {
+        *tightBBox = rect;
+    }
+
+    return true;
+}
+
+const FTGlyphMetrics* FontEngineFT::glyphMetrics(char32_t ucs4) const
+{
+    if (ucs4 > MAX_UCS4) {
         return nullptr;
     }
 
+    const FTGlyphMetricsPage* page = m_data->metricsPages[ucs4 >> METRICS_PAGE_BITS].load(std::memory_order_acquire);
+    if (page) {
+        const FTGlyphMetrics& gm = page->glyphs[ucs4 & (METRICS_PAGE_SIZE - 1)];
+        switch (gm.state.load(std::memory_order_acquire)) {
+        case FTGlyphMetrics::Loaded: return &gm;
+        case FTGlyphMetrics::Missing: return nullptr;
+        default: break;
+        }
+    }
+
+    return loadGlyphMetrics(ucs4);
+}
+
+const FTGlyphMetrics* FontEngineFT::loadGlyphMetrics(char32_t ucs4) const
+{
+    std::lock_guard<std::mutex> lock(m_data->faceMutex);
+
+    std::atomic<FTGlyphMetricsPage*>& pagePtr = m_data->metricsPages[ucs4 >> METRICS_PAGE_BITS];
+    FTGlyphMetricsPage* page = pagePtr.load(std::memory_order_acquire);
+    if (!page) {
+        page = new FTGlyphMetricsPage();
+        pagePtr.store(page, std::memory_order_release);
+    }
+
+    FTGlyphMetrics& gm = page->glyphs[ucs4 & (METRICS_PAGE_SIZE - 1)];
+
+    // it may have been loaded by another thread meanwhile
+    uint8_t state = gm.state.load(std::memory_order_acquire);
+    if (state != FTGlyphMetrics::Unknown) {
+        return state == FTGlyphMetrics::Loaded ? &gm : nullptr;
+    }
+
     FT_BBox bb;
-    if (FT_Outline_Get_BBox(&m_data->face->glyph->outline, &bb) != 0) {
+    FT_UInt index = FT_Get_Char_Index(m_data->face, ucs4);
+    if (index == 0
+        || FT_Load_Glyph(m_data->face, index, FT_LOAD_DEFAULT) != 0
+        || FT_Outline_Get_BBox(&m_data->face->glyph->outline, &bb) != 0) {
+        gm.state.store(FTGlyphMetrics::Missing, std::memory_order_release);
         return nullptr;
     }
 
-    FTGlyphMetrics& gm = m_data->metrics[ucs4];
-    gm.bb = bb;
-    gm.linearHoriAdvance = m_data->face->glyph->linearHoriAdvance;
+    gm.xMin = bb.xMin / BBOX_UNITS_PER_DPI;
+    gm.yMin = bb.yMin / BBOX_UNITS_PER_DPI;
+    gm.xMax = bb.xMax / BBOX_UNITS_PER_DPI;
+    gm.yMax = bb.yMax / BBOX_UNITS_PER_DPI;
+    gm.advance = m_data->face->glyph->linearHoriAdvance / ADVANCE_UNITS_PER_DPI;
+
+    gm.state.store(FTGlyphMetrics::Loaded, std::memory_order_release);
 
     return &gm;
 }
@@ -22,12 +22,17 @@
 #ifndef MU_DRAW_FONTENGINEFT_H
 #define MU_DRAW_FONTENGINEFT_H
 
+#include <string>
+
 #include <QRectF>
 #include "io/path.h"
 
 namespace mu::draw {
 struct FTData;
 struct FTGlyphMetrics;
+
+//! NOTE The metrics of the glyphs are kept for any DPI and scaled when they are asked.
+//! They may be asked from several threads: the known ones are read without waiting
 class FontEngineFT
 {
 public:
@@ -39,9 +44,17 @@ public:
     QRectF bbox(char32_t ucs4, double DPI_F) const;
     double advance(char32_t ucs4, double DPI_F) const;
 
+    //! NOTE The metrics of several glyphs at once, the missing glyphs get an empty bbox and no advance
+    void metrics(const char32_t* ucs4s, size_t count, double DPI_F, QRectF* bboxes, double* advances) const;
+
+    //! NOTE The advance and the tight bbox of a text in the font of the given pixel size,
+    //! without kerning; false if a glyph is missing
+    bool textMetrics(const std::u32string& text, double pixelSize, double* advance, QRectF* tightBBox) const;
+
 private:
 
-    FTGlyphMetrics* glyphMetrics(char32_t ucs4) const;
+    const FTGlyphMetrics* glyphMetrics(char32_t ucs4) const;
+    const FTGlyphMetrics* loadGlyphMetrics(char32_t ucs4) const;
 
     FTData* m_data = nullptr;
 };
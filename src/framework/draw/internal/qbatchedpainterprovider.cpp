@@ -0,0 +1,319 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "qbatchedpainterprovider.h"
+
+#include <QFont>
+#include <QGlyphRun>
+#include <QPainter>
+
+using namespace mu::draw;
+
+static constexpr size_t MAX_GLYPH_BATCHES = 16;
+
+QBatchedPainterProvider::QBatchedPainterProvider(QPainter* painter, bool ownsPainter)
+    : QPainterProvider(painter, ownsPainter)
+{
+}
+
+QBatchedPainterProvider::~QBatchedPainterProvider()
+{
+    if (isActive()) {
+        flush();
+    }
+}
+
+IPaintProviderPtr QBatchedPainterProvider::make(QPainter* qp, bool ownsPainter)
+{
+    return std::make_shared<QBatchedPainterProvider>(qp, ownsPainter);
+}
+
+bool QBatchedPainterProvider::endTarget(bool endDraw)
+{
+    flush();
+    return QPainterProvider::endTarget(endDraw);
+}
+
+void QBatchedPainterProvider::setAntialiasing(bool arg)
+{
+    if (m_painter->testRenderHint(QPainter::Antialiasing) != arg) {
+        flush();
+    }
+
+    QPainterProvider::setAntialiasing(arg);
+}
+
+void QBatchedPainterProvider::setCompositionMode(CompositionMode mode)
+{
+    flush();
+    QPainterProvider::setCompositionMode(mode);
+}
+
+void QBatchedPainterProvider::setFont(const Font& font)
+{
+    //! NOTE The text and the symbols are usually drawn with the same pen in other fonts,
+    //! the glyphs of all the fonts stay in the batch
+    if (font != this->font()) {
+        m_currentGlyphBatch = -1;
+    }
+
+    QPainterProvider::setFont(font);
+}
+
+void QBatchedPainterProvider::setPen(const Pen& pen)
+{
+    if (pen != this->pen()) {
+        flush();
+    }
+
+    QPainterProvider::setPen(pen);
+}
+
+void QBatchedPainterProvider::setNoPen()
+{
+    if (pen().style() != PenStyle::NoPen) {
+        flush();
+    }
+
+    QPainterProvider::setNoPen();
+}
+
+void QBatchedPainterProvider::save()
+{
+    flush();
+    QPainterProvider::save();
+}
+
+void QBatchedPainterProvider::restore()
+{
+    flush();
+    QPainterProvider::restore();
+
+    //! NOTE The font may be restored too
+    m_currentGlyphBatch = -1;
+}
+
+void QBatchedPainterProvider::setTransform(const Transform& transform)
+{
+    //! NOTE The elements are mostly drawn with their own translation,
+    //! a batch continues as long as the scaling is the same
+    if (m_isBatchTransformSet) {
+        bool isSameScaling = transform.m11() == m_batchTransform.m11() && transform.m12() == m_batchTransform.m12()
+                             && transform.m21() == m_batchTransform.m21() && transform.m22() == m_batchTransform.m22()
+                             && transform.m13() == m_batchTransform.m13() && transform.m23() == m_batchTransform.m23()
+                             && transform.m33() == m_batchTransform.m33();
+        if (!isSameScaling) {
+            flush();
+        }
+    }
+
+    QPainterProvider::setTransform(transform);
+
+    if (m_isBatchTransformSet) {
+        m_batchOffset = m_batchInverted.map(transform.map(PointF()));
+    }
+}
+
+void QBatchedPainterProvider::drawPath(const PainterPath& path)
+{
+    flush();
+    QPainterProvider::drawPath(path);
+}
+
+void QBatchedPainterProvider::drawPolygon(const PointF* points, size_t pointCount, PolygonMode mode)
+{
+    //! NOTE The dashes start again on each line, so only the solid ones are batched
+    if (mode == PolygonMode::Polyline && pointCount == 2 && pen().style() == PenStyle::SolidLine) {
+        beginBatch();
+        m_lines.emplace_back(toBatch(points[0]), toBatch(points[1]));
+        return;
+    }
+
+    flush();
+    QPainterProvider::drawPolygon(points, pointCount, mode);
+}
+
+void QBatchedPainterProvider::drawText(const PointF& point, const String& text)
+{
+    flush();
+    QPainterProvider::drawText(point, text);
+}
+
+void QBatchedPainterProvider::drawText(const RectF& rect, int flags, const String& text)
+{
+    flush();
+    QPainterProvider::drawText(rect, flags, text);
+}
+
+void QBatchedPainterProvider::drawTextWorkaround(const Font& f, const PointF& pos, const String& text)
+{
+    flush();
+    QPainterProvider::drawTextWorkaround(f, pos, text);
+}
+
+void QBatchedPainterProvider::drawSymbol(const PointF& point, char32_t ucs4Code)
+{
+    GlyphBatch& glyphBatch = currentGlyphBatch();
+
+    //! NOTE Without the glyph in the font the text drawing takes it from another one
+    quint32 glyph = glyphIndex(glyphBatch, ucs4Code);
+    if (glyph == 0) {
+        flush();
+        QPainterProvider::drawSymbol(point, ucs4Code);
+        return;
+    }
+
+    beginBatch();
+    glyphBatch.glyphs.push_back(glyph);
+    glyphBatch.positions.push_back(toBatch(point));
+    m_hasGlyphs = true;
+}
+
+void QBatchedPainterProvider::drawPixmap(const PointF& point, const Pixmap& pm)
+{
+    flush();
+    QPainterProvider::drawPixmap(point, pm);
+}
+
+void QBatchedPainterProvider::drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF& offset)
+{
+    flush();
+    QPainterProvider::drawTiledPixmap(rect, pm, offset);
+}
+
+void QBatchedPainterProvider::drawPixmap(const PointF& point, const QPixmap& pm)
+{
+    flush();
+    QPainterProvider::drawPixmap(point, pm);
+}
+
+void QBatchedPainterProvider::drawTiledPixmap(const RectF& rect, const QPixmap& pm, const PointF& offset)
+{
+    flush();
+    QPainterProvider::drawTiledPixmap(rect, pm, offset);
+}
+
+void QBatchedPainterProvider::setClipRect(const RectF& rect)
+{
+    flush();
+    QPainterProvider::setClipRect(rect);
+}
+
+void QBatchedPainterProvider::setClipping(bool enable)
+{
+    flush();
+    QPainterProvider::setClipping(enable);
+}
+
+void QBatchedPainterProvider::flush()
+{
+    if (hasBatch()) {
+        m_painter->setTransform(Transform::toQTransform(m_batchTransform));
+
+        if (!m_lines.empty()) {
+            m_painter->drawLines(m_lines.data(), static_cast<int>(m_lines.size()));
+        }
+
+        for (GlyphBatch& glyphBatch : m_glyphBatches) {
+            if (glyphBatch.glyphs.isEmpty()) {
+                continue;
+            }
+
+            QGlyphRun glyphRun;
+            glyphRun.setRawFont(glyphBatch.rawFont);
+            glyphRun.setGlyphIndexes(glyphBatch.glyphs);
+            glyphRun.setPositions(glyphBatch.positions);
+            m_painter->drawGlyphRun(QPointF(), glyphRun);
+
+            glyphBatch.glyphs.clear();
+            glyphBatch.positions.clear();
+        }
+
+        m_painter->setTransform(Transform::toQTransform(transform()));
+    }
+
+    m_lines.clear();
+    m_hasGlyphs = false;
+    m_isBatchTransformSet = false;
+
+    if (m_glyphBatches.size() > MAX_GLYPH_BATCHES) {
+        m_glyphBatches.clear();
+        m_currentGlyphBatch = -1;
+    }
+}
+
+bool QBatchedPainterProvider::hasBatch() const
+{
+    return !m_lines.empty() || m_hasGlyphs;
+}
+
+void QBatchedPainterProvider::beginBatch()
+{
+    if (m_isBatchTransformSet) {
+        return;
+    }
+
+    m_batchTransform = transform();
+    m_batchInverted = m_batchTransform.inverted();
+    m_batchOffset = PointF();
+    m_isBatchTransformSet = true;
+}
+
+QPointF QBatchedPainterProvider::toBatch(const PointF& point) const
+{
+    return QPointF(point.x() + m_batchOffset.x(), point.y() + m_batchOffset.y());
+}
+
+QBatchedPainterProvider::GlyphBatch& QBatchedPainterProvider::currentGlyphBatch()
+{
+    if (m_currentGlyphBatch >= 0) {
+        return m_glyphBatches[m_currentGlyphBatch];
+    }
+
+    for (size_t i = 0; i < m_glyphBatches.size(); ++i) {
+        if (m_glyphBatches[i].font == font()) {
+            m_currentGlyphBatch = static_cast<int>(i);
+            return m_glyphBatches[i];
+        }
+    }
+
+    GlyphBatch glyphBatch;
+    glyphBatch.font = font();
+    glyphBatch.rawFont = QRawFont::fromFont(QFont(m_painter->font(), m_painter->device()));
+    m_glyphBatches.push_back(std::move(glyphBatch));
+    m_currentGlyphBatch = static_cast<int>(m_glyphBatches.size()) - 1;
+
+    return m_glyphBatches.back();
+}
+
+quint32 QBatchedPainterProvider::glyphIndex(GlyphBatch& batch, char32_t ucs4Code) const
+{
+    auto it = batch.glyphIndexes.constFind(ucs4Code);
+    if (it != batch.glyphIndexes.constEnd()) {
+        return it.value();
+    }
+
+    QVector<quint32> indexes = batch.rawFont.glyphIndexesForString(QString::fromUcs4(&ucs4Code, 1));
+    quint32 index = indexes.size() == 1 ? indexes.front() : 0;
+    batch.glyphIndexes.insert(ucs4Code, index);
+
+    return index;
+}
@@ -0,0 +1,114 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_DRAW_QBATCHEDPAINTERPROVIDER_H
+#define MU_DRAW_QBATCHEDPAINTERPROVIDER_H
+
+#include <vector>
+
+#include <QHash>
+#include <QLineF>
+#include <QRawFont>
+#include <QVector>
+
+#include "qpainterprovider.h"
+
+namespace mu::draw {
+//! NOTE Collects the symbols and the solid lines drawn with the same pen and scaling,
+//! and draws them with one glyph run for each font and one drawLines call instead of one call for each.
+//! The paint engines of the GPU render targets draw such a call as one batch.
+//! The batch is drawn before anything else is drawn or the state changes,
+//! so the QPainter must not be used directly while the provider is active
+class QBatchedPainterProvider : public QPainterProvider
+{
+public:
+    QBatchedPainterProvider(QPainter* painter, bool ownsPainter = false);
+    ~QBatchedPainterProvider() override;
+
+    static IPaintProviderPtr make(QPainter* qp, bool ownsPainter = false);
+
+    bool endTarget(bool endDraw = false) override;
+
+    void setAntialiasing(bool arg) override;
+    void setCompositionMode(CompositionMode mode) override;
+
+    void setFont(const Font& font) override;
+
+    void setPen(const Pen& pen) override;
+    void setNoPen() override;
+
+    void save() override;
+    void restore() override;
+
+    void setTransform(const Transform& transform) override;
+
+    // drawing functions
+    void drawPath(const PainterPath& path) override;
+    void drawPolygon(const PointF* points, size_t pointCount, PolygonMode mode) override;
+
+    void drawText(const PointF& point, const String& text) override;
+    void drawText(const RectF& rect, int flags, const String& text) override;
+    void drawTextWorkaround(const Font& f, const PointF& pos, const String& text) override;
+
+    void drawSymbol(const PointF& point, char32_t ucs4Code) override;
+
+    void drawPixmap(const PointF& point, const Pixmap& pm) override;
+    void drawTiledPixmap(const RectF& rect, const Pixmap& pm, const PointF& offset = PointF()) override;
+
+    void drawPixmap(const PointF& point, const QPixmap& pm) override;
+    void drawTiledPixmap(const RectF& rect, const QPixmap& pm, const PointF& offset = PointF()) override;
+
+    void setClipRect(const RectF& rect) override;
+    void setClipping(bool enable) override;
+
+    void flush();
+
+private:
+    bool hasBatch() const;
+    void beginBatch();
+    QPointF toBatch(const PointF& point) const;
+
+    struct GlyphBatch {
+        Font font;
+        QRawFont rawFont;
+        QHash<char32_t, quint32> glyphIndexes;
+        QVector<quint32> glyphs;
+        QVector<QPointF> positions;
+    };
+
+    GlyphBatch& currentGlyphBatch();
+    quint32 glyphIndex(GlyphBatch& batch, char32_t ucs4Code) const;
+
+    Transform m_batchTransform;
+    Transform m_batchInverted;
+    bool m_isBatchTransformSet = false;
+    PointF m_batchOffset;   // of the current transform in the coordinates of the batch
+
+    // kept for the glyph indexes of their fonts, only the glyphs are drawn and cleared on flush
+    std::vector<GlyphBatch> m_glyphBatches;
+    int m_currentGlyphBatch = -1;
+    bool m_hasGlyphs = false;
+
+    std::vector<QLineF> m_lines;
+};
+}
+
+#endif // MU_DRAW_QBATCHEDPAINTERPROVIDER_H
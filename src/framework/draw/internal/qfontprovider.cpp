@@ -28,6 +28,8 @@
 #include "engraving/libmscore/mscore.h"
 #include "fontengineft.h"
 
+#include "log.h"
+
 using namespace mu;
 using namespace mu::draw;
 
@@ -55,7 +57,11 @@ static FontPaintDevice device;
 
 int QFontProvider::addSymbolFont(const String& family, const io::path_t& path)
 {
-    m_symbolsFonts[family] = path;
+    {
+        std::lock_guard<std::mutex> lock(m_symEnginesMutex);
+        m_symbolsFonts[family] = path;
+        m_textEngines.clear();
+    }
     return QFontDatabase::addApplicationFont(path.toQString());
 }
 
@@ -64,6 +70,55 @@ int QFontProvider::addTextFont(const io::path_t& path)
     return QFontDatabase::addApplicationFont(path.toQString());
 }
 
+void QFontProvider::addLazyTextFont(const String& family, const io::path_t& path)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_symEnginesMutex);
+        m_textFonts[family] = path;
+        m_textEngines.clear();
+    }
+
+    std::lock_guard<std::mutex> lock(m_lazyTextFontsMutex);
+    m_lazyTextFonts[family] = path;
+    m_resolvedFamilies.clear();
+    m_hasLazyTextFonts = true;
+}
+
+QFont QFontProvider::qfont(const Font& f) const
+{
+    QFont font = f.toQFont();
+    if (m_hasLazyTextFonts) {
+        std::lock_guard<std::mutex> lock(m_lazyTextFontsMutex);
+        if (!m_resolvedFamilies.contains(font.family())) {
+            m_resolvedFamilies.insert(font.family());
+            loadLazyTextFont(font.family());
+            m_hasLazyTextFonts = !m_lazyTextFonts.isEmpty();
+        }
+    }
+
+    return font;
+}
+
+void QFontProvider::loadLazyTextFont(const QString& family) const
+{
+    auto it = m_lazyTextFonts.find(family);
+    if (it != m_lazyTextFonts.end()) {
+        io::path_t path = it.value();
+        m_lazyTextFonts.erase(it);
+
+        if (QFontDatabase::addApplicationFont(path.toQString()) == -1) {
+            LOGE() << "Fatal error: cannot load internal font " << path;
+        }
+    }
+
+    //! NOTE Qt falls back to the substitutes silently, so they must be loaded as well
+    for (const QString& substitute : QFont::substitutes(family)) {
+        if (m_lazyTextFonts.contains(substitute)) {
+            loadLazyTextFont(substitute);
+        }
+    }
+}
+
 void QFontProvider::insertSubstitution(const String& familyName, const String& substituteName)
 {
     QFont::insertSubstitution(familyName, substituteName);
@@ -71,37 +126,43 @@ void QFontProvider::insertSubstitution(const String& familyName, const String& s
 
 double QFontProvider::lineSpacing(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).lineSpacing();
+    return QFontMetricsF(qfont(f), &device).lineSpacing();
 }
 
 double QFontProvider::xHeight(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).xHeight();
+    return QFontMetricsF(qfont(f), &device).xHeight();
 }
 
 double QFontProvider::height(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).height();
+    return QFontMetricsF(qfont(f), &device).height();
 }
 
 double QFontProvider::ascent(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).ascent();
+    return QFontMetricsF(qfont(f), &device).ascent();
 }
 
 double QFontProvider::descent(const Font& f) const
 {
-    return QFontMetricsF(f.toQFont(), &device).descent();
+    return QFontMetricsF(qfont(f), &device).descent();
 }
 
 bool QFontProvider::inFont(const Font& f, Char ch) const
 {
-    return QFontMetricsF(f.toQFont(), &device).inFont(ch);
+    if (FontEngineFT* engine = textEngine(f)) {
+        if (engine->advance(ch.unicode(), 1.0) > 0.0) {
+            return true;
+        }
+    }
+
+    return QFontMetricsF(qfont(f), &device).inFont(ch);
 }
 
 bool QFontProvider::inFontUcs4(const Font& f, char32_t ucs4) const
 {
-    if (!QFontMetricsF(f.toQFont(), &device).inFontUcs4(ucs4)) {
+    if (!QFontMetricsF(qfont(f), &device).inFontUcs4(ucs4)) {
         return false;
     }
 
@@ -113,32 +174,47 @@ bool QFontProvider::inFontUcs4(const Font& f, char32_t ucs4) const
 
 double QFontProvider::horizontalAdvance(const Font& f, const String& string) const
 {
-    return QFontMetricsF(f.toQFont(), &device).horizontalAdvance(string);
+    double advance = 0.0;
+    if (textMetrics(f, string, &advance, nullptr)) {
+        return advance;
+    }
+
+    return QFontMetricsF(qfont(f), &device).horizontalAdvance(string.toQStringNoCopy());
 }
 
 double QFontProvider::horizontalAdvance(const Font& f, const Char& ch) const
 {
-    return QFontMetricsF(f.toQFont(), &device).horizontalAdvance(ch);
+    double advance = 0.0;
+    if (!ch.isSurrogate() && textMetrics(f, String(ch), &advance, nullptr)) {
+        return advance;
+    }
+
+    return QFontMetricsF(qfont(f), &device).horizontalAdvance(ch);
 }
 
 RectF QFontProvider::boundingRect(const Font& f, const String& string) const
 {
-    return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).boundingRect(string));
+    return RectF::fromQRectF(QFontMetricsF(qfont(f), &device).boundingRect(string.toQStringNoCopy()));
 }
 
 RectF QFontProvider::boundingRect(const Font& f, const Char& ch) const
 {
-    return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).boundingRect(ch));
+    return RectF::fromQRectF(QFontMetricsF(qfont(f), &device).boundingRect(ch));
 }
 
 RectF QFontProvider::boundingRect(const Font& f, const RectF& r, int flags, const String& string) const
 {
-    return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).boundingRect(r.toQRectF(), flags, string));
+    return RectF::fromQRectF(QFontMetricsF(qfont(f), &device).boundingRect(r.toQRectF(), flags, string.toQStringNoCopy()));
 }
 
 RectF QFontProvider::tightBoundingRect(const Font& f, const String& string) const
 {
-    return RectF::fromQRectF(QFontMetricsF(f.toQFont(), &device).tightBoundingRect(string));
+    RectF rect;
+    if (textMetrics(f, string, nullptr, &rect)) {
+        return rect;
+    }
+
+    return RectF::fromQRectF(QFontMetricsF(qfont(f), &device).tightBoundingRect(string.toQStringNoCopy()));
 }
 
 // Score symbols
@@ -196,13 +272,50 @@ double QFontProvider::symAdvance(const Font& f, char32_t ucs4, double dpi_f) con
     return symAdvance;
 }
 
+void QFontProvider::symMetrics(const Font& f, const std::vector<char32_t>& ucs4s, double dpi_f, std::vector<RectF>& bboxes,
+                               std::vector<double>& advances) const
+{
+    bboxes.assign(ucs4s.size(), RectF());
+    advances.assign(ucs4s.size(), 0.0);
+
+    FontEngineFT* engine = symEngine(f);
+    if (!engine) {
+        return;
+    }
+
+    std::vector<QRectF> rects(ucs4s.size());
+    engine->metrics(ucs4s.data(), ucs4s.size(), dpi_f, rects.data(), advances.data());
+
+    for (size_t i = 0; i < ucs4s.size(); ++i) {
+        bboxes[i] = RectF::fromQRectF(rects[i]);
+
+        //! NOTE The symbols missing in the font are looked for in its substitutes
+        if (!bboxes[i].isValid()) {
+            bboxes[i] = symBBox(f, ucs4s[i], dpi_f);
+        }
+
+        if (RealIsNull(advances[i])) {
+            advances[i] = symAdvance(f, ucs4s[i], dpi_f);
+        }
+    }
+}
+
 FontEngineFT* QFontProvider::symEngine(const Font& f) const
 {
+    //! NOTE The symbols may be measured from several threads
+    std::lock_guard<std::mutex> lock(m_symEnginesMutex);
+
     QString path = m_symbolsFonts.value(f.family()).toQString();
     if (path.isEmpty()) {
         return nullptr;
     }
 
+    return loadedEngine(path);
+}
+
+FontEngineFT* QFontProvider::loadedEngine(const QString& path) const
+{
+    //! NOTE Called with m_symEnginesMutex locked
     FontEngineFT* engine = m_symEngines.value(path, nullptr);
     if (!engine) {
         engine = new FontEngineFT();
@@ -214,3 +327,58 @@ FontEngineFT* QFontProvider::symEngine(const Font& f) const
     }
     return engine;
 }
+
+FontEngineFT* QFontProvider::textEngine(const Font& f) const
+{
+    //! NOTE Qt synthesizes the styles the files don't have, and measures the other fonts with the system ones
+    if (f.bold() || f.italic() || f.weight() != Font::Normal) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(m_symEnginesMutex);
+
+    auto it = m_textEngines.find(f.family());
+    if (it != m_textEngines.end()) {
+        return it->second;
+    }
+
+    QString family = f.family();
+
+    //! NOTE The text is drawn by Qt, so the font must be known to it as well
+    {
+        std::lock_guard<std::mutex> lazyLock(m_lazyTextFontsMutex);
+        loadLazyTextFont(family);
+        m_hasLazyTextFonts = !m_lazyTextFonts.isEmpty();
+    }
+
+    QString path = m_symbolsFonts.value(family, m_textFonts.value(family)).toQString();
+    FontEngineFT* engine = path.isEmpty() ? nullptr : loadedEngine(path);
+    m_textEngines[f.family()] = engine;
+
+    return engine;
+}
+
+bool QFontProvider::textMetrics(const Font& f, const String& text, double* advance, RectF* tightBBox) const
+{
+    double pixelSize = f.pointSizeF() > 0 ? f.pointSizeF() * mu::engraving::DPI / 72.0 : f.pixelSize();
+    if (pixelSize <= 0) {
+        return false;
+    }
+
+    FontEngineFT* engine = textEngine(f);
+    if (!engine) {
+        return false;
+    }
+
+    //! NOTE A text with a glyph missing in the font is measured by Qt, with the fallback fonts
+    QRectF rect;
+    if (!engine->textMetrics(text.toStdU32String(), pixelSize, advance, tightBBox ? &rect : nullptr)) {
+        return false;
+    }
+
+    if (tightBBox) {
+        *tightBBox = RectF::fromQRectF(rect);
+    }
+
+    return true;
+}
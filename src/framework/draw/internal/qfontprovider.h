@@ -22,7 +22,12 @@
 #ifndef MU_DRAW_QFONTPROVIDER_H
 #define MU_DRAW_QFONTPROVIDER_H
 
+#include <atomic>
+#include <map>
+#include <mutex>
+
 #include <QHash>
+#include <QSet>
 #include "ifontprovider.h"
 
 namespace mu::draw {
@@ -34,6 +39,7 @@ public:
 
     int addSymbolFont(const String& family, const io::path_t& path) override;
     int addTextFont(const io::path_t& path) override;
+    void addLazyTextFont(const String& family, const io::path_t& path) override;
     void insertSubstitution(const String& familyName, const String& substituteName) override;
 
     double lineSpacing(const Font& f) const override;
@@ -57,13 +63,32 @@ public:
     // Score symbols
     RectF symBBox(const Font& f, char32_t ucs4, double DPI_F) const override;
     double symAdvance(const Font& f, char32_t ucs4, double DPI_F) const override;
+    void symMetrics(const Font& f, const std::vector<char32_t>& ucs4s, double DPI_F, std::vector<RectF>& bboxes,
+                    std::vector<double>& advances) const override;
 
 private:
 
     FontEngineFT* symEngine(const Font& f) const;
+    FontEngineFT* loadedEngine(const QString& path) const;
+
+    //! NOTE The fonts that engraving loads from its own files are measured directly by FreeType,
+    //! without QFont and the font database
+    FontEngineFT* textEngine(const Font& f) const;
+    bool textMetrics(const Font& f, const String& text, double* advance, RectF* tightBBox) const;
+
+    QFont qfont(const Font& f) const;
+    void loadLazyTextFont(const QString& family) const;
+
+    mutable QHash<QString /*family*/, io::path_t> m_lazyTextFonts;
+    QHash<QString /*family*/, io::path_t> m_textFonts;
+    mutable QSet<QString /*family*/> m_resolvedFamilies;
+    mutable std::atomic<bool> m_hasLazyTextFonts = false;
+    mutable std::mutex m_lazyTextFontsMutex;
 
     QHash<QString /*family*/, io::path_t> m_symbolsFonts;
     mutable QHash<QString /*path*/, FontEngineFT*> m_symEngines;
+    mutable std::map<String /*family*/, FontEngineFT*> m_textEngines;
+    mutable std::mutex m_symEnginesMutex;
 };
 }
 
@@ -231,12 +231,12 @@ void QPainterProvider::drawPolygon(const PointF* points, size_t pointCount, Poly
 
 void QPainterProvider::drawText(const PointF& point, const String& text)
 {
-    m_painter->drawText(point.toQPointF(), text);
+    m_painter->drawText(point.toQPointF(), text.toQStringNoCopy());
 }
 
 void QPainterProvider::drawText(const RectF& rect, int flags, const String& text)
 {
-    m_painter->drawText(rect.toQRectF(), flags, text);
+    m_painter->drawText(rect.toQRectF(), flags, text.toQStringNoCopy());
 }
 
 void QPainterProvider::drawTextWorkaround(const Font& f, const PointF& pos, const String& text)
@@ -302,7 +302,8 @@ void QPainterProvider::drawTextWorkaround(const Font& f, const PointF& pos, cons
 
 void QPainterProvider::drawSymbol(const PointF& point, char32_t ucs4Code)
 {
-    static QHash<char32_t, QString> cache;
+    //! NOTE Pages may be painted concurrently, each thread keeps its own cache
+    static thread_local QHash<char32_t, QString> cache;
     if (!cache.contains(ucs4Code)) {
         cache[ucs4Code] = QString::fromUcs4(&ucs4Code, 1);
     }
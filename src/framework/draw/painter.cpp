@@ -26,6 +26,7 @@
 
 #ifndef NO_QT_SUPPORT
 #include "internal/qpainterprovider.h"
+#include "internal/qbatchedpainterprovider.h"
 #endif
 
 #include "log.h"
@@ -56,6 +57,17 @@ Painter::Painter(QPainter* qp, const std::string& name, bool ownsQPainter)
     init();
 }
 
+Painter::Painter(QPainter* qp, const std::string& name, Mode mode)
+    : m_name(name)
+{
+    if (mode == Mode::Batched) {
+        m_provider = QBatchedPainterProvider::make(qp);
+    } else {
+        m_provider = QPainterProvider::make(qp);
+    }
+    init();
+}
+
 #endif
 
 Painter::~Painter()
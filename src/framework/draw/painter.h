@@ -50,8 +50,16 @@ public:
     Painter(IPaintProviderPtr provider, const std::string& name);
 
 #ifndef NO_QT_SUPPORT
+    //! NOTE Batched: the symbols and the lines are drawn in batches, see QBatchedPainterProvider,
+    //! the QPainter must not be used directly until the painter is destroyed
+    enum class Mode {
+        Immediate,
+        Batched
+    };
+
     Painter(QPaintDevice* dp, const std::string& name);
     Painter(QPainter* qp, const std::string& name, bool ownsQPainter = false);
+    Painter(QPainter* qp, const std::string& name, Mode mode);
 #endif
 
     ~Painter();
@@ -26,6 +26,7 @@
 #include <QSvgRenderer>
 
 #include "internal/qpainterprovider.h"
+#include "internal/qbatchedpainterprovider.h"
 #endif
 
 #include "log.h"
@@ -67,6 +68,11 @@ void SvgRenderer::render(Painter* painter, const RectF& rect)
     IPaintProviderPtr paintProvider = painter->provider();
     std::shared_ptr<QPainterProvider> qPaintProvider = std::dynamic_pointer_cast<QPainterProvider>(paintProvider);
     if (qPaintProvider) {
+        //! NOTE The batch goes under the image
+        if (auto batchedProvider = std::dynamic_pointer_cast<QBatchedPainterProvider>(paintProvider)) {
+            batchedProvider->flush();
+        }
+
         m_qSvgRenderer->render(qPaintProvider->qpainter(), rect.toQRectF());
     }
 #else
@@ -27,6 +27,8 @@
 #include "draw/painter.h"
 
 #include "draw/internal/qpainterprovider.h"
+#include "draw/bufferedpaintprovider.h"
+#include "draw/utils/drawdatapaint.h"
 
 using namespace mu;
 using namespace mu::draw;
@@ -156,3 +158,106 @@ TEST_F(Draw_PainterTests, Painter_SaveRestore)
 
     EXPECT_EQ(painter.provider()->transform(), worldTransform * expectedViewTransform);
 }
+
+static QImage paintLines(Painter::Mode mode)
+{
+    QImage pd(100, 100, QImage::Format_ARGB32_Premultiplied);
+    pd.fill(Qt::white);
+
+    QPainter qp(&pd);
+
+    {
+        Painter painter(&qp, "test", mode);
+        painter.setPen(Pen(Color::BLACK, 1.0));
+
+        for (int i = 0; i < 5; ++i) {
+            painter.save();
+            painter.translate(10.0, 10.0 + i * 15.0);
+            painter.drawLine(LineF(0.0, 0.0, 80.0, 0.0));
+            painter.drawLine(LineF(i * 10.0, 0.0, i * 10.0, 10.0));
+            painter.restore();
+
+            painter.translate(1.0, 0.0);
+            painter.drawLine(LineF(0.0, 5.0, 10.0, 5.0));
+        }
+
+        painter.setPen(Pen(Color::RED, 1.0));
+        painter.drawLine(LineF(0.0, 0.0, 100.0, 100.0));
+    }
+
+    return pd;
+}
+
+TEST_F(Draw_PainterTests, Painter_Batched_SameAsImmediate)
+{
+    //! DO Draw the same lines with and without batches
+    QImage immediate = paintLines(Painter::Mode::Immediate);
+    QImage batched = paintLines(Painter::Mode::Batched);
+
+    //! CHECK The images are the same
+    EXPECT_EQ(immediate, batched);
+}
+
+TEST_F(Draw_PainterTests, BufferedPainter_KeepsPaintOrder)
+{
+    //! GIVEN Painter which records
+    std::shared_ptr<BufferedPaintProvider> provider = std::make_shared<BufferedPaintProvider>();
+    Painter painter(provider, "test");
+
+    //! DO Draw a line, a text and a line with the same state
+    painter.drawLine(LineF(0.0, 0.0, 10.0, 0.0));
+    painter.drawText(PointF(0.0, 0.0), String(u"a"));
+    painter.drawLine(LineF(0.0, 5.0, 10.0, 5.0));
+    painter.endDraw();
+
+    //! CHECK The recorded data keeps the order
+    DrawDataPtr data = provider->drawData();
+    ASSERT_EQ(data->objects.size(), 1);
+
+    const std::vector<DrawData::Data>& datas = data->objects.front().datas;
+    ASSERT_EQ(datas.size(), 3);
+    EXPECT_EQ(datas.at(0).polygons.size(), 1);
+    EXPECT_EQ(datas.at(1).texts.size(), 1);
+    EXPECT_EQ(datas.at(2).polygons.size(), 1);
+}
+
+TEST_F(Draw_PainterTests, DrawDataPaint_ReplayOnCurrentTransform)
+{
+    //! GIVEN Line recorded with a translation
+    std::shared_ptr<BufferedPaintProvider> recordProvider = std::make_shared<BufferedPaintProvider>();
+    {
+        Painter recorder(recordProvider, "record");
+        recorder.translate(10.0, 20.0);
+        recorder.drawLine(LineF(0.0, 0.0, 10.0, 0.0));
+        recorder.endDraw();
+    }
+
+    //! DO Replay it with a painter which is translated too
+    std::shared_ptr<BufferedPaintProvider> provider = std::make_shared<BufferedPaintProvider>();
+    Painter painter(provider, "test");
+    painter.translate(100.0, 0.0);
+
+    DrawDataPaint::replay(&painter, recordProvider->drawData());
+
+    //! CHECK The transform of the painter is restored
+    Transform painterTransform;
+    painterTransform.translate(100.0, 0.0);
+    EXPECT_EQ(provider->transform(), painterTransform);
+
+    painter.endDraw();
+
+    //! CHECK The line is drawn with both translations
+    Transform lineTransform;
+    lineTransform.translate(110.0, 20.0);
+
+    bool isLineFound = false;
+    for (const DrawData::Object& obj : provider->drawData()->objects) {
+        for (const DrawData::Data& d : obj.datas) {
+            if (!d.polygons.empty()) {
+                EXPECT_EQ(d.state.transform, lineTransform);
+                isLineFound = true;
+            }
+        }
+    }
+    EXPECT_TRUE(isLineFound);
+}
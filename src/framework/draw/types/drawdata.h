@@ -68,11 +68,13 @@ struct DrawText {
     enum Mode {
         Undefined = 0,
         Point,
-        Rect
+        Rect,
+        Symbol,         // the text is one symbol
+        Workaround      // drawn with drawTextWorkaround and the font of the state
     };
 
     Mode mode = Mode::Undefined;
-    RectF rect;     // If mode is Point when use topLeft point
+    RectF rect;     // If mode is Point, Symbol or Workaround when use topLeft point
     int flags = 0;
     String text;
 };
@@ -109,6 +111,8 @@ struct DrawData
         bool operator!=(const State& o) const { return !this->operator==(o); }
     };
 
+    //! NOTE The primitives of a data are drawn by kind,
+    //! so the recording starts a new data when the kind changes, to keep the paint order
     struct Data {
         State state;
 
@@ -283,10 +283,13 @@ static void fromObj(const JsonObject& obj, DrawPolygon& pol)
 static JsonObject toObj(const DrawText& text)
 {
     JsonObject o;
-    if (text.mode == DrawText::Point) {
-        o["point"] = toArr(text.rect.topLeft());
-    } else {
+    if (text.mode == DrawText::Rect) {
         o["rect"] = toArr(text.rect);
+    } else {
+        o["point"] = toArr(text.rect.topLeft());
+    }
+    if (text.mode == DrawText::Symbol || text.mode == DrawText::Workaround) {
+        o["mode"] = static_cast<int>(text.mode);
     }
     o["flags"] = text.flags;
     o["text"] = text.text;
@@ -298,7 +301,7 @@ static void fromObj(const JsonObject& obj, DrawText& text)
     if (obj.contains("point")) {
         PointF point;
         fromArr(obj["point"].toArray(), point);
-        text.mode = DrawText::Point;
+        text.mode = obj.contains("mode") ? static_cast<DrawText::Mode>(obj["mode"].toInt()) : DrawText::Point;
         text.rect = RectF(point, SizeF());
     } else {
         fromArr(obj["rect"].toArray(), text.rect);
@@ -42,34 +42,113 @@ void DrawDataPaint::paint(Painter* painter, const DrawDataPtr& data, const Color
             provider->setAntialiasing(st.isAntialiasing);
             provider->setCompositionMode(st.compositionMode);
 
-            for (const DrawPath& path : d.paths) {
-                provider->setPen(path.pen);
-                provider->setBrush(path.brush);
-                provider->drawPath(path.path);
-            }
+            drawData(provider.get(), d);
+        }
+    }
+}
 
-            for (const DrawPolygon& pl : d.polygons) {
-                if (pl.polygon.empty()) {
-                    continue;
-                }
-                provider->drawPolygon(&pl.polygon[0], pl.polygon.size(), pl.mode);
-            }
+void DrawDataPaint::replay(Painter* painter, const DrawDataPtr& data, const ObjectFilter& isObjectShown)
+{
+    IPaintProviderPtr provider = painter->provider();
 
-            for (const DrawText& t : d.texts) {
-                if (t.mode == DrawText::Point) {
-                    provider->drawText(t.rect.topLeft(), t.text);
-                } else {
-                    provider->drawText(t.rect, t.flags, t.text);
-                }
-            }
+    const Pen oldPen = provider->pen();
+    const Brush oldBrush = provider->brush();
+    const Font oldFont = provider->font();
+    const Transform baseTransform = provider->transform();
+
+    //! NOTE There are no getters for these, they are set when they change from one data to the next
+    bool isStateSet = false;
+    bool isAntialiasing = false;
+    CompositionMode compositionMode = CompositionMode::SourceOver;
 
-            for (const DrawPixmap& px : d.pixmaps) {
-                if (px.mode == DrawPixmap::Single) {
-                    provider->drawPixmap(px.rect.topLeft(), px.pm);
-                } else {
-                    provider->drawTiledPixmap(px.rect, px.pm, px.offset);
-                }
+    for (size_t i = 0; i < data->objects.size(); ++i) {
+        if (isObjectShown && !isObjectShown(i)) {
+            continue;
+        }
+
+        for (const DrawData::Data& d : data->objects.at(i).datas) {
+            const DrawData::State& st = d.state;
+
+            //! NOTE Set only on change, so that the batches of the provider are kept
+            if (provider->pen() != st.pen) {
+                provider->setPen(st.pen);
+            }
+            if (provider->brush() != st.brush) {
+                provider->setBrush(st.brush);
+            }
+            if (provider->font() != st.font) {
+                provider->setFont(st.font);
             }
+            Transform transform = st.transform * baseTransform;
+            if (!(provider->transform() == transform)) {
+                provider->setTransform(transform);
+            }
+            if (!isStateSet || isAntialiasing != st.isAntialiasing) {
+                isAntialiasing = st.isAntialiasing;
+                provider->setAntialiasing(isAntialiasing);
+            }
+            if (!isStateSet || compositionMode != st.compositionMode) {
+                compositionMode = st.compositionMode;
+                provider->setCompositionMode(compositionMode);
+            }
+            isStateSet = true;
+
+            drawData(provider.get(), d);
+        }
+    }
+
+    provider->setPen(oldPen);
+    provider->setBrush(oldBrush);
+    provider->setFont(oldFont);
+    provider->setTransform(baseTransform);
+}
+
+void DrawDataPaint::drawText(IPaintProvider* provider, const DrawData::State& state, const DrawText& text)
+{
+    switch (text.mode) {
+    case DrawText::Point:
+        provider->drawText(text.rect.topLeft(), text.text);
+        break;
+    case DrawText::Symbol: {
+        std::u32string ucs4 = text.text.toStdU32String();
+        if (!ucs4.empty()) {
+            provider->drawSymbol(text.rect.topLeft(), ucs4.front());
+        }
+    } break;
+    case DrawText::Workaround:
+        provider->drawTextWorkaround(state.font, text.rect.topLeft(), text.text);
+        break;
+    case DrawText::Rect:
+    case DrawText::Undefined:
+        provider->drawText(text.rect, text.flags, text.text);
+        break;
+    }
+}
+
+void DrawDataPaint::drawData(IPaintProvider* provider, const DrawData::Data& d)
+{
+    for (const DrawPath& path : d.paths) {
+        provider->setPen(path.pen);
+        provider->setBrush(path.brush);
+        provider->drawPath(path.path);
+    }
+
+    for (const DrawPolygon& pl : d.polygons) {
+        if (pl.polygon.empty()) {
+            continue;
+        }
+        provider->drawPolygon(&pl.polygon[0], pl.polygon.size(), pl.mode);
+    }
+
+    for (const DrawText& t : d.texts) {
+        drawText(provider, d.state, t);
+    }
+
+    for (const DrawPixmap& px : d.pixmaps) {
+        if (px.mode == DrawPixmap::Single) {
+            provider->drawPixmap(px.rect.topLeft(), px.pm);
+        } else {
+            provider->drawTiledPixmap(px.rect, px.pm, px.offset);
         }
     }
 }
@@ -22,6 +22,8 @@
 #ifndef MU_DRAW_DRAWDATAPAINT_H
 #define MU_DRAW_DRAWDATAPAINT_H
 
+#include <functional>
+
 #include "../painter.h"
 #include "../types/drawdata.h"
 
@@ -32,6 +34,16 @@ public:
     DrawDataPaint() = default;
 
     static void paint(Painter* painter, const DrawDataPtr& data, const Color& overlay = Color());
+
+    //! NOTE Paints again what was recorded with a painter without transform, on top of the current transform of the painter.
+    //! The objects for which isObjectShown returns false are skipped
+    using ObjectFilter = std::function<bool (size_t index)>;
+    static void replay(Painter* painter, const DrawDataPtr& data, const ObjectFilter& isObjectShown = nullptr);
+
+    static void drawText(IPaintProvider* provider, const DrawData::State& state, const DrawText& text);
+
+private:
+    static void drawData(IPaintProvider* provider, const DrawData::Data& data);
 };
 }
 
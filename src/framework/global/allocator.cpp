@@ -21,8 +21,10 @@
  */
 #include "allocator.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
+#include <set>
 #include <sstream>
 
 #include "stringutils.h"
@@ -30,7 +32,7 @@
 
 using namespace mu;
 
-int ObjectAllocator::used = 0;
+std::atomic<int> ObjectAllocator::used = 0;
 size_t ObjectAllocator::DEFAULT_BLOCK_SIZE(1024 * 256); // 256 kB
 
 static inline size_t align(size_t n)
@@ -66,6 +68,8 @@ void* ObjectAllocator::alloc(size_t size)
 {
     size = align(size);
 
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
     if (!m_chunkSize) {
         m_chunkSize = size;
     }
@@ -74,7 +78,10 @@ void* ObjectAllocator::alloc(size_t size)
 
     if (!m_free) {
         Block b = allocateBlock(m_chunkSize);
-        m_blocks.push_back(b);
+        auto it = std::upper_bound(m_blocks.begin(), m_blocks.end(), b.begin, [](const Chunk* begin, const Block& block) {
+            return begin < block.begin;
+        });
+        m_blocks.insert(it, b);
         m_free = b.begin;
     }
 
@@ -93,12 +100,19 @@ void* ObjectAllocator::alloc(size_t size)
     return freeChunk;
 }
 
-void ObjectAllocator::free(void* chunk, size_t size)
+bool ObjectAllocator::free(void* chunk, size_t size)
 {
 #ifdef NDEBUG
     UNUSED(size);
 #endif
-    assert(m_chunkSize == size);
+
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+    if (findBlock(chunk) == m_blocks.cend()) {
+        return false;
+    }
+
+    assert(m_chunkSize == align(size));
 
     // The freed chunk's next pointer points to the
     // current allocation pointer:
@@ -109,10 +123,14 @@ void ObjectAllocator::free(void* chunk, size_t size)
     m_free = reinterpret_cast<Chunk*>(chunk);
 
     m_statistic.totalFreeCount++;
+
+    return true;
 }
 
 void ObjectAllocator::cleanup()
 {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
     if (m_blocks.empty()) {
         return;
     }
@@ -153,6 +171,94 @@ void ObjectAllocator::cleanup()
     m_free = m_blocks.front().begin;
 }
 
+size_t ObjectAllocator::releaseFreeBlocks()
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+    if (m_blocks.empty()) {
+        return 0;
+    }
+
+    std::vector<size_t> freeCounts(m_blocks.size(), 0);
+    for (Chunk* free = m_free; free; free = free->next) {
+        auto it = findBlock(free);
+        assert(it != m_blocks.cend());
+        ++freeCounts[std::distance(m_blocks.cbegin(), it)];
+    }
+
+    size_t releasedBytes = 0;
+    std::vector<Block> blocks;
+    std::vector<Block> released;
+    for (size_t bi = 0; bi < m_blocks.size(); ++bi) {
+        const Block& b = m_blocks.at(bi);
+        if (freeCounts.at(bi) == b.chunkCount) {
+            released.push_back(b);
+            releasedBytes += b.chunkCount * b.chunkSize;
+        } else {
+            blocks.push_back(b);
+        }
+    }
+
+    if (released.empty()) {
+        return 0;
+    }
+
+    m_blocks = std::move(blocks);
+
+    // relink the free chunks of the remaining blocks
+    Chunk* free = m_free;
+    m_free = nullptr;
+    Chunk* last = nullptr;
+    while (free) {
+        Chunk* next = free->next;
+        if (findBlock(free) != m_blocks.cend()) {
+            free->next = nullptr;
+            if (last) {
+                last->next = free;
+            } else {
+                m_free = free;
+            }
+            last = free;
+        }
+        free = next;
+    }
+
+    for (const Block& b : released) {
+        std::free(b.begin);
+    }
+
+    return releasedBytes;
+}
+
+std::vector<ObjectAllocator::Block>::const_iterator ObjectAllocator::findBlock(const void* ptr) const
+{
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(ptr);
+    auto it = std::upper_bound(m_blocks.cbegin(), m_blocks.cend(), p, [](const uint8_t* p, const Block& block) {
+        return p < reinterpret_cast<const uint8_t*>(block.begin);
+    });
+
+    if (it == m_blocks.cbegin()) {
+        return m_blocks.cend();
+    }
+
+    --it;
+    const uint8_t* begin = reinterpret_cast<const uint8_t*>(it->begin);
+    if (p < begin + it->chunkCount * it->chunkSize) {
+        return it;
+    }
+
+    return m_blocks.cend();
+}
+
+size_t ObjectAllocator::freeChunkCount() const
+{
+    size_t count = 0;
+    for (Chunk* free = m_free; free; free = free->next) {
+        ++count;
+    }
+    return count;
+}
+
 ObjectAllocator::Block ObjectAllocator::allocateBlock(size_t chunkSize) const
 {
     size_t blockSize = std::max(DEFAULT_BLOCK_SIZE, chunkSize);
@@ -187,6 +293,8 @@ void* ObjectAllocator::not_supported(const char* info)
 
 ObjectAllocator::Info ObjectAllocator::stateInfo() const
 {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
     Info info;
     info.module = m_module;
     info.name = m_name;
@@ -199,11 +307,7 @@ ObjectAllocator::Info ObjectAllocator::stateInfo() const
         info.totalChunks += b.chunkCount;
     }
 
-    Chunk* free = m_free;
-    while (free) {
-        ++info.freeChunks;
-        free = free->next;
-    }
+    info.freeChunks = freeChunkCount();
 
     return info;
 }
@@ -213,16 +317,19 @@ ObjectAllocator::Info ObjectAllocator::stateInfo() const
 // ============================================
 void AllocatorsRegister::reg(ObjectAllocator* a)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
     m_allocators.push_back(a);
 }
 
 void AllocatorsRegister::unreg(ObjectAllocator* a)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
     m_allocators.remove(a);
 }
 
 void AllocatorsRegister::cleanupAll(const std::string& module)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
     for (ObjectAllocator* a : m_allocators) {
         if (a->module() == module) {
             a->cleanup();
@@ -230,6 +337,31 @@ void AllocatorsRegister::cleanupAll(const std::string& module)
     }
 }
 
+size_t AllocatorsRegister::releaseFreeBlocks(const std::string& module)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    size_t releasedBytes = 0;
+    for (ObjectAllocator* a : m_allocators) {
+        if (a->module() == module) {
+            releasedBytes += a->releaseFreeBlocks();
+        }
+    }
+    return releasedBytes;
+}
+
+std::vector<ObjectAllocator::Info> AllocatorsRegister::stateInfo(const std::string& module) const
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    std::vector<ObjectAllocator::Info> infos;
+    infos.reserve(m_allocators.size());
+    for (const ObjectAllocator* a : m_allocators) {
+        if (module.empty() || a->module() == module) {
+            infos.push_back(a->stateInfo());
+        }
+    }
+    return infos;
+}
+
 #define FORMAT(str, width) mu::strings::leftJustified(str, width)
 #define TITLE(str) FORMAT(std::string(str), 20)
 #define VALUE(val) FORMAT(std::to_string(val), 20)
@@ -239,15 +371,15 @@ void AllocatorsRegister::printStatistic(const std::string& title)
     std::stringstream stream;
     stream << "\n\n";
     stream << title << "\n";
-    stream << "allocators: " << m_allocators.size() << '\n';
+    std::vector<ObjectAllocator::Info> infos = stateInfo();
+    stream << "allocators: " << infos.size() << '\n';
     stream << TITLE("Object") << TITLE("Total alloc") << TITLE("Total free") << TITLE("Used (leak?)") << TITLE("Object size") << "\n";
 
     uint64_t totalBytes = 0;
     uint64_t totalAllocatedCount = 0;
     uint64_t totalFreeCount = 0;
     uint64_t totalUsedCount = 0;
-    for (ObjectAllocator* a : m_allocators) {
-        ObjectAllocator::Info info = a->stateInfo();
+    for (const ObjectAllocator::Info& info : infos) {
         stream << FORMAT(info.name, 20)
                << VALUE(info.totalAllocatedCount)
                << VALUE(info.totalFreeCount)
@@ -273,13 +405,13 @@ void AllocatorsRegister::printState(const std::string& title)
     std::stringstream stream;
     stream << "\n\n";
     stream << title << "\n";
-    stream << "allocators: " << m_allocators.size() << '\n';
+    std::vector<ObjectAllocator::Info> infos = stateInfo();
+    stream << "allocators: " << infos.size() << '\n';
     stream << TITLE("Object") << TITLE("blockCount") << TITLE("totalChunks") << TITLE("freeChunks") << TITLE("chunkSize")
            << TITLE("allocatedBytes") << "\n";
 
     uint64_t totalBytes = 0;
-    for (ObjectAllocator* a : m_allocators) {
-        ObjectAllocator::Info info = a->stateInfo();
+    for (const ObjectAllocator::Info& info : infos) {
         stream << FORMAT(info.name, 20)
                << VALUE(info.blockCount)
                << VALUE(info.totalChunks)
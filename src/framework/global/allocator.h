@@ -22,9 +22,11 @@
 #ifndef MU_GLOBAL_ALLOCATOR_H
 #define MU_GLOBAL_ALLOCATOR_H
 
+#include <atomic>
 #include <cstdint>
 #include <vector>
 #include <list>
+#include <mutex>
 #include <string>
 
 namespace mu {
@@ -38,9 +40,7 @@ public: \
         return ObjectAllocator::enabled() ? allocator().alloc(sz) : ::operator new(sz); \
     } \
     static void operator delete(void* ptr, size_t sz) { \
-        if (ObjectAllocator::enabled()) { \
-            allocator().free(ptr, sz); \
-        } else { \
+        if (!ObjectAllocator::available() || !allocator().free(ptr, sz)) { \
             ::operator delete(ptr, sz); \
         } \
     } \
@@ -74,9 +74,15 @@ public:
     const char* name() const;
 
     void* alloc(size_t size);
-    void free(void* ptr, size_t size);
+    //! NOTE Returns false if the pointer wasn't allocated by this allocator,
+    //! e.g. the object was created while the allocator was disabled
+    bool free(void* ptr, size_t size);
     void cleanup();
 
+    //! NOTE Returns the memory of the blocks without used chunks to the system,
+    //! returns the number of released bytes
+    size_t releaseFreeBlocks();
+
     template<class T>
     static void destroyer(void* ptr)
     {
@@ -104,16 +110,22 @@ public:
 
     Info stateInfo() const;
 
-    static bool enabled()
+    static bool available()
     {
     #ifdef CUSTOM_ALLOCATOR_DISABLED
         return false;
     #else
-        return used;
+        return true;
     #endif
     }
 
-    static int used;
+    static bool enabled()
+    {
+        return available() && used > 0;
+    }
+
+    //! NOTE The number of the open projects, new objects are taken from the pools while there is any
+    static std::atomic<int> used;
 
 private:
     struct Chunk {
@@ -134,13 +146,19 @@ private:
     };
 
     Block allocateBlock(size_t chunkSize) const;
+    std::vector<Block>::const_iterator findBlock(const void* ptr) const;
+    size_t freeChunkCount() const;
+
+    //! NOTE Objects of the same type are created concurrently by the layout workers.
+    //! Recursive, because destroying an object in cleanup() can destroy others of the same type
+    mutable std::recursive_mutex m_mutex;
 
     const char* m_module = nullptr;
     const char* m_name = nullptr;
     size_t m_chunkSize = 0;
     destroyer_t m_dtor = nullptr;
     Chunk* m_free = nullptr;
-    std::vector<Block> m_blocks;
+    std::vector<Block> m_blocks; // sorted by the address
 
     struct Statistic
     {
@@ -165,11 +183,15 @@ public:
     void unreg(ObjectAllocator* a);
 
     void cleanupAll(const std::string& module);
+    size_t releaseFreeBlocks(const std::string& module);
+
+    std::vector<ObjectAllocator::Info> stateInfo(const std::string& module = std::string()) const;
 
     void printStatistic(const std::string& title);
     void printState(const std::string& title);
 
 private:
+    mutable std::recursive_mutex m_mutex;
     std::list<ObjectAllocator*> m_allocators;
 };
 }
@@ -26,6 +26,9 @@
 namespace mu::async {
 template<typename ... T>
 using Channel = deto::async::Channel<T...>;
+
+using InvokerStats = deto::async::InvokerStats;
+using deto::async::namedStats;
 }
 
 #endif // MU_ASYNC_CHANNEL_H
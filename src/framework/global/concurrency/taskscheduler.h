@@ -1,211 +1,527 @@
-/*
- * SPDX-License-Identifier: GPL-3.0-only
- * MuseScore-CLA-applies
- *
- * MuseScore
- * Music Composition & Notation
- *
- * Copyright (C) 2022 MuseScore BVBA and others
- *
- * This program is free software: you can redistribute it and/or modify
- * it under the terms of the GNU General Public License version 3 as
- * published by the Free Software Foundation.
- *
- * This program is distributed in the hope that it will be useful,
- * but WITHOUT ANY WARRANTY; without even the implied warranty of
- * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- * GNU General Public License for more details.
- *
- * You should have received a copy of the GNU General Public License
- * along with this program.  If not, see <https://www.gnu.org/licenses/>.
- */
-
-#ifndef MU_GLOBAL_TASKCHEDULER_H
-#define MU_GLOBAL_TASKCHEDULER_H
-
-#include <condition_variable>
-#include <functional>
-#include <future>
-#include <memory>
-#include <mutex>
-#include <atomic>
-#include <queue>
-#include <thread>
-#include <type_traits>
-#include <utility>
-
-#include "log.h"
-
-namespace mu {
-typedef std::invoke_result_t<decltype(std::thread::hardware_concurrency)> thread_pool_size_t;
-
-class TaskScheduler
-{
-public:
-
-    //!Note Would be moved into globalmodule.cpp for better lifetime control
-    static TaskScheduler* instance()
-    {
-        static TaskScheduler s;
-        return &s;
-    }
-
-    explicit TaskScheduler(const thread_pool_size_t desiredThreadCount = 0)
-        : m_threadPoolSize(vaildateThreadPoolCapacity(desiredThreadCount)),
-        m_threadPool(std::make_unique<std::thread[]>(vaildateThreadPoolCapacity(desiredThreadCount)))
-    {
-        setupThreads();
-    }
-
-    ~TaskScheduler()
-    {
-        waitForAllTasksComplete();
-        terminateThreads();
-    }
-
-    thread_pool_size_t threadPoolSize() const
-    {
-        return m_threadPoolSize;
-    }
-
-    template<typename FuncT, typename ... ArgsT>
-    void push(FuncT&& task, ArgsT&&... args)
-    {
-        std::function<void()> taskFunctor = std::bind(std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
-        {
-            const std::lock_guard lock(m_mutex);
-            m_taskQueue.push(taskFunctor);
-        }
-        m_newTaskAvailableCv.notify_one();
-    }
-
-    template<typename FuncT, typename ... ArgsT, typename ReturnT = std::invoke_result_t<std::decay_t<FuncT>, std::decay_t<ArgsT>...> >
-    std::future<ReturnT> submit(FuncT&& task, ArgsT&&... args)
-    {
-        std::function<ReturnT()> taskFunctor = std::bind(std::forward<FuncT>(task), std::forward<ArgsT>(args)...);
-        std::shared_ptr<std::promise<ReturnT> > promise = std::make_shared<std::promise<ReturnT> >();
-        push([taskFunctor, promise] {
-            try {
-                if constexpr (std::is_void_v<ReturnT>) {
-                    std::invoke(taskFunctor);
-                    promise->set_value();
-                } else {
-                    promise->set_value(std::invoke(taskFunctor));
-                }
-            } catch (...) {
-                try {
-                    promise->set_exception(std::current_exception());
-                } catch (...) {
-                    LOGE() << "Unable to schedule a task";
-                }
-            }
-        });
-
-        return promise->get_future();
-    }
-
-    void waitForAllTasksComplete()
-    {
-        m_isWaitingForAllTasksDone = true;
-        std::unique_lock<std::mutex> tasks_lock(m_mutex);
-        m_taskFinishedCv.wait(tasks_lock, [this] { return m_taskQueue.empty(); });
-        m_isWaitingForAllTasksDone = false;
-    }
-
-    const std::set<std::thread::id>& threadIdSet() const
-    {
-        static std::set<std::thread::id> result;
-
-        if (result.empty()) {
-            for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
-                result.insert(m_threadPool[i].get_id());
-            }
-        }
-
-        return result;
-    }
-
-    bool containsThread(const std::thread::id& id) const
-    {
-        const auto& idSet = threadIdSet();
-        return idSet.find(id) != idSet.cend();
-    }
-
-private:
-    void setupThreads()
-    {
-        m_isActive = true;
-        for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
-            m_threadPool[i] = std::thread(&TaskScheduler::th_workerLoop, this);
-        }
-    }
-
-    void terminateThreads()
-    {
-        m_isActive = false;
-        m_newTaskAvailableCv.notify_all();
-        for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
-            m_threadPool[i].join();
-        }
-    }
-
-    thread_pool_size_t vaildateThreadPoolCapacity(const thread_pool_size_t desiredThreadCount)
-    {
-        thread_pool_size_t maxCapacity = std::thread::hardware_concurrency();
-
-        if (maxCapacity <= 1) {
-            return 1;
-        }
-
-        thread_pool_size_t optimalCapacity = maxCapacity / 2;
-
-        if (desiredThreadCount <= 0) {
-            return optimalCapacity;
-        }
-
-        return desiredThreadCount;
-    }
-
-    void th_workerLoop()
-    {
-        while (m_isActive) {
-            std::unique_lock<std::mutex> lock(m_mutex);
-            m_newTaskAvailableCv.wait(lock, [this] { return !m_taskQueue.empty() || !m_isActive; });
-
-            if (!m_isActive) {
-                return;
-            }
-
-            std::function<void()> task = m_taskQueue.front();
-            m_taskQueue.pop();
-
-            bool isQueueEmpty = m_taskQueue.empty();
-
-            lock.unlock();
-
-            task();
-
-            if (m_isWaitingForAllTasksDone) {
-                m_taskFinishedCv.notify_one();
-            }
-
-            if (isQueueEmpty) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(1));
-            }
-        }
-    }
-
-    std::atomic<bool> m_isActive = false;
-    std::atomic<bool> m_isWaitingForAllTasksDone = false;
-
-    mutable std::mutex m_mutex;
-    std::condition_variable m_newTaskAvailableCv;
-    std::condition_variable m_taskFinishedCv;
-    std::queue<std::function<void()> > m_taskQueue;
-
-    thread_pool_size_t m_threadPoolSize = 0;
-    std::unique_ptr<std::thread[]> m_threadPool = nullptr;
-};
-}
-
-#endif // MU_GLOBAL_TASKCHEDULER_H
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef MU_GLOBAL_TASKCHEDULER_H
+#define MU_GLOBAL_TASKCHEDULER_H
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <set>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "log.h"
+
+namespace mu {
+typedef std::invoke_result_t<decltype(std::thread::hardware_concurrency)> thread_pool_size_t;
+
+//! NOTE The workers always take the highest priority task available
+enum class TaskPriority {
+    Realtime = 0,   // ex audio
+    Normal,         // ex layout, painting
+    Background      // ex I/O, autosave
+};
+
+//! NOTE Each worker has its own deques, the tasks pushed from a worker go to its deques
+//! and are taken back by it last in first out, the idle workers steal them first in first out.
+//! The tasks pushed from other threads go to the shared deques and are taken first in first out,
+//! so a scheduler with one worker runs them in the order they were pushed.
+class TaskScheduler
+{
+public:
+
+    //!Note Would be moved into globalmodule.cpp for better lifetime control
+    static TaskScheduler* instance()
+    {
+        static TaskScheduler s;
+        return &s;
+    }
+
+    explicit TaskScheduler(const thread_pool_size_t desiredThreadCount = 0)
+        : m_threadPoolSize(vaildateThreadPoolCapacity(desiredThreadCount)),
+        m_threadPool(std::make_unique<std::thread[]>(m_threadPoolSize)),
+        m_workerQueues(std::make_unique<Queues[]>(m_threadPoolSize))
+    {
+        setupThreads();
+    }
+
+    ~TaskScheduler()
+    {
+        waitForAllTasksComplete();
+        terminateThreads();
+    }
+
+    thread_pool_size_t threadPoolSize() const
+    {
+        return m_threadPoolSize;
+    }
+
+    template<typename FuncT, typename ... ArgsT>
+    void push(FuncT&& task, ArgsT&&... args)
+    {
+        post(TaskPriority::Normal, std::bind(std::forward<FuncT>(task), std::forward<ArgsT>(args)...));
+    }
+
+    template<typename FuncT, typename ... ArgsT, typename ReturnT = std::invoke_result_t<std::decay_t<FuncT>, std::decay_t<ArgsT>...> >
+    std::future<ReturnT> submit(FuncT&& task, ArgsT&&... args)
+    {
+        return submitWithPriority(TaskPriority::Normal, std::bind(std::forward<FuncT>(task), std::forward<ArgsT>(args)...));
+    }
+
+    template<typename FuncT, typename ReturnT = std::invoke_result_t<std::decay_t<FuncT> > >
+    std::future<ReturnT> submitWithPriority(TaskPriority priority, FuncT&& task)
+    {
+        std::function<ReturnT()> taskFunctor = std::forward<FuncT>(task);
+        std::shared_ptr<std::promise<ReturnT> > promise = std::make_shared<std::promise<ReturnT> >();
+        post(priority, [taskFunctor, promise] {
+            try {
+                if constexpr (std::is_void_v<ReturnT>) {
+                    std::invoke(taskFunctor);
+                    promise->set_value();
+                } else {
+                    promise->set_value(std::invoke(taskFunctor));
+                }
+            } catch (...) {
+                try {
+                    promise->set_exception(std::current_exception());
+                } catch (...) {
+                    LOGE() << "Unable to schedule a task";
+                }
+            }
+        });
+
+        return promise->get_future();
+    }
+
+    void post(TaskPriority priority, std::function<void()> task)
+    {
+        const WorkerSlot& slot = currentWorker();
+        Queues& queues = slot.scheduler == this ? m_workerQueues[slot.index] : m_sharedQueues;
+        {
+            const std::lock_guard lock(queues.mutex);
+            queues.tasks[static_cast<size_t>(priority)].push_back(std::move(task));
+        }
+
+        {
+            const std::lock_guard lock(m_mutex);
+            ++m_pendingCount;
+        }
+        m_newTaskAvailableCv.notify_one();
+    }
+
+    //! NOTE Waits for the pushed tasks to be done, on a worker it can only wait for them to be taken
+    void waitForAllTasksComplete()
+    {
+        const bool onWorker = currentWorker().scheduler == this;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_taskFinishedCv.wait(lock, [this, onWorker] {
+            return m_pendingCount == 0 && (onWorker || m_runningCount == 0);
+        });
+    }
+
+    //! NOTE Runs one pending task on the calling thread, if there is one.
+    //! Used to help instead of blocking while waiting for other tasks
+    bool runPendingTask()
+    {
+        std::function<void()> task;
+        if (!takeTask(task)) {
+            return false;
+        }
+
+        runTask(task);
+        return true;
+    }
+
+    //! NOTE Calls func(i) for each i in [begin, end), in chunks of grainSize items.
+    //! The calling thread takes chunks too, so it never waits for a worker which has not started,
+    //! and a parallelFor nested in a task can't block the workers.
+    //! The first exception is rethrown on the calling thread, the chunks not started yet are skipped then
+    template<typename FuncT>
+    void parallelFor(size_t begin, size_t end, FuncT&& func, size_t grainSize = 1, TaskPriority priority = TaskPriority::Normal)
+    {
+        if (begin >= end) {
+            return;
+        }
+
+        grainSize = std::max<size_t>(grainSize, 1);
+        const size_t chunkCount = (end - begin + grainSize - 1) / grainSize;
+
+        struct State {
+            std::function<void(size_t)> func;
+            size_t end = 0;
+            size_t grainSize = 1;
+            std::atomic<size_t> next = 0;
+            std::atomic<bool> failed = false;
+            std::exception_ptr error;
+            size_t running = 0;
+            std::mutex mutex;
+            std::condition_variable finishedCv;
+        };
+
+        std::shared_ptr<State> state = std::make_shared<State>();
+        state->func = std::forward<FuncT>(func);
+        state->end = end;
+        state->grainSize = grainSize;
+        state->next = begin;
+
+        auto work = [state]() {
+            {
+                const std::lock_guard lock(state->mutex);
+                ++state->running;
+            }
+
+            while (!state->failed) {
+                const size_t from = state->next.fetch_add(state->grainSize);
+                if (from >= state->end) {
+                    break;
+                }
+
+                const size_t to = std::min(from + state->grainSize, state->end);
+                try {
+                    for (size_t i = from; i < to; ++i) {
+                        state->func(i);
+                    }
+                } catch (...) {
+                    const std::lock_guard lock(state->mutex);
+                    if (!state->error) {
+                        state->error = std::current_exception();
+                    }
+                    state->failed = true;
+                }
+            }
+
+            {
+                const std::lock_guard lock(state->mutex);
+                --state->running;
+            }
+            state->finishedCv.notify_all();
+        };
+
+        const size_t helperCount = std::min<size_t>(chunkCount, m_threadPoolSize + 1) - 1;
+        for (size_t i = 0; i < helperCount; ++i) {
+            post(priority, work);
+        }
+
+        work();
+
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->finishedCv.wait(lock, [&state] { return state->running == 0; });
+
+        // the helpers which start from now on find no chunk left, they don't use func anymore
+        state->next = state->end;
+        if (state->error) {
+            std::rethrow_exception(state->error);
+        }
+    }
+
+private:
+    friend class TaskGroup;
+
+    struct Queues {
+        std::mutex mutex;
+        std::array<std::deque<std::function<void()> >, 3> tasks;
+    };
+
+    struct WorkerSlot {
+        const TaskScheduler* scheduler = nullptr;
+        size_t index = 0;
+    };
+
+    static WorkerSlot& currentWorker()
+    {
+        thread_local WorkerSlot slot;
+        return slot;
+    }
+
+    void setupThreads()
+    {
+        m_isActive = true;
+        for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
+            m_threadPool[i] = std::thread(&TaskScheduler::th_workerLoop, this, static_cast<size_t>(i));
+            m_threadIdSet.insert(m_threadPool[i].get_id());
+        }
+    }
+
+    void terminateThreads()
+    {
+        {
+            const std::lock_guard lock(m_mutex);
+            m_isActive = false;
+        }
+        m_newTaskAvailableCv.notify_all();
+        for (thread_pool_size_t i = 0; i < m_threadPoolSize; ++i) {
+            m_threadPool[i].join();
+        }
+    }
+
+    thread_pool_size_t vaildateThreadPoolCapacity(const thread_pool_size_t desiredThreadCount)
+    {
+        thread_pool_size_t maxCapacity = std::thread::hardware_concurrency();
+
+        if (maxCapacity <= 1) {
+            return 1;
+        }
+
+        thread_pool_size_t optimalCapacity = maxCapacity / 2;
+
+        if (desiredThreadCount <= 0) {
+            return optimalCapacity;
+        }
+
+        return desiredThreadCount;
+    }
+
+    static bool popFront(Queues& queues, size_t priority, std::function<void()>& task)
+    {
+        const std::lock_guard lock(queues.mutex);
+        std::deque<std::function<void()> >& deque = queues.tasks[priority];
+        if (deque.empty()) {
+            return false;
+        }
+
+        task = std::move(deque.front());
+        deque.pop_front();
+        return true;
+    }
+
+    static bool popBack(Queues& queues, size_t priority, std::function<void()>& task)
+    {
+        const std::lock_guard lock(queues.mutex);
+        std::deque<std::function<void()> >& deque = queues.tasks[priority];
+        if (deque.empty()) {
+            return false;
+        }
+
+        task = std::move(deque.back());
+        deque.pop_back();
+        return true;
+    }
+
+    //! NOTE For each priority: the own deque, then the shared one, then the ones of the other workers
+    bool takeTask(std::function<void()>& task)
+    {
+        const WorkerSlot& slot = currentWorker();
+        const bool onWorker = slot.scheduler == this;
+
+        for (size_t priority = 0; priority < m_sharedQueues.tasks.size(); ++priority) {
+            bool taken = onWorker && popBack(m_workerQueues[slot.index], priority, task);
+            if (!taken) {
+                taken = popFront(m_sharedQueues, priority, task);
+            }
+
+            for (size_t i = 1; !taken && i <= m_threadPoolSize; ++i) {
+                const size_t victim = (slot.index + i) % m_threadPoolSize;
+                if (onWorker && victim == slot.index) {
+                    continue;
+                }
+                taken = popFront(m_workerQueues[victim], priority, task);
+            }
+
+            if (taken) {
+                const std::lock_guard lock(m_mutex);
+                --m_pendingCount;
+                ++m_runningCount;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void runTask(std::function<void()>& task)
+    {
+        task();
+        task = nullptr;
+
+        {
+            const std::lock_guard lock(m_mutex);
+            --m_runningCount;
+        }
+        m_taskFinishedCv.notify_all();
+    }
+
+    void th_workerLoop(size_t index)
+    {
+        WorkerSlot& slot = currentWorker();
+        slot.scheduler = this;
+        slot.index = index;
+
+        std::function<void()> task;
+        while (true) {
+            if (takeTask(task)) {
+                runTask(task);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_newTaskAvailableCv.wait(lock, [this] { return m_pendingCount > 0 || !m_isActive; });
+
+            if (!m_isActive) {
+                return;
+            }
+        }
+    }
+
+public:
+    const std::set<std::thread::id>& threadIdSet() const
+    {
+        return m_threadIdSet;
+    }
+
+    bool containsThread(const std::thread::id& id) const
+    {
+        return m_threadIdSet.find(id) != m_threadIdSet.cend();
+    }
+
+private:
+    bool m_isActive = false;
+    size_t m_pendingCount = 0;
+    size_t m_runningCount = 0;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_newTaskAvailableCv;
+    std::condition_variable m_taskFinishedCv;
+
+    thread_pool_size_t m_threadPoolSize = 0;
+    std::unique_ptr<std::thread[]> m_threadPool = nullptr;
+    std::unique_ptr<Queues[]> m_workerQueues = nullptr;
+    Queues m_sharedQueues;
+    std::set<std::thread::id> m_threadIdSet;
+};
+
+//! NOTE A set of tasks which are waited for and can be cancelled together.
+//! The tasks not started when the group is cancelled are skipped,
+//! the running ones can check isCancelled() to stop early.
+//! While waiting, the calling thread runs pending tasks instead of blocking a worker
+class TaskGroup
+{
+public:
+    explicit TaskGroup(TaskScheduler* scheduler, TaskPriority priority = TaskPriority::Normal)
+        : m_scheduler(scheduler), m_priority(priority), m_state(std::make_shared<State>())
+    {
+    }
+
+    ~TaskGroup()
+    {
+        try {
+            wait();
+        } catch (...) {
+            LOGE() << "task group failed";
+        }
+    }
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    void run(std::function<void()> task)
+    {
+        {
+            const std::lock_guard lock(m_state->mutex);
+            ++m_state->pending;
+        }
+
+        std::shared_ptr<State> state = m_state;
+        m_scheduler->post(m_priority, [state, task = std::move(task)]() {
+            if (!state->cancelled) {
+                try {
+                    task();
+                } catch (...) {
+                    const std::lock_guard lock(state->mutex);
+                    if (!state->error) {
+                        state->error = std::current_exception();
+                    }
+                    state->cancelled = true;
+                }
+            }
+
+            {
+                const std::lock_guard lock(state->mutex);
+                --state->pending;
+            }
+            state->finishedCv.notify_all();
+        });
+    }
+
+    //! NOTE Rethrows the first exception thrown by a task of the group
+    void wait()
+    {
+        while (pendingCount() > 0) {
+            if (m_scheduler->runPendingTask()) {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(m_state->mutex);
+            m_state->finishedCv.wait_for(lock, std::chrono::milliseconds(1), [this] { return m_state->pending == 0; });
+        }
+
+        std::exception_ptr error;
+        {
+            const std::lock_guard lock(m_state->mutex);
+            std::swap(error, m_state->error);
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    void cancel()
+    {
+        m_state->cancelled = true;
+    }
+
+    bool isCancelled() const
+    {
+        return m_state->cancelled;
+    }
+
+private:
+    struct State {
+        std::mutex mutex;
+        std::condition_variable finishedCv;
+        size_t pending = 0;
+        std::atomic<bool> cancelled = false;
+        std::exception_ptr error;
+    };
+
+    size_t pendingCount() const
+    {
+        const std::lock_guard lock(m_state->mutex);
+        return m_state->pending;
+    }
+
+    TaskScheduler* m_scheduler = nullptr;
+    TaskPriority m_priority = TaskPriority::Normal;
+    std::shared_ptr<State> m_state;
+};
+}
+
+#endif // MU_GLOBAL_TASKCHEDULER_H
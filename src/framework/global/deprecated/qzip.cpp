@@ -570,6 +570,24 @@ public:
     };
 
     void addEntry(EntryType type, const QString& fileName, const QByteArray& contents);
+
+    void initEntryHeader(FileHeader& header, EntryType type, const QString& fileName);
+
+    bool startStreamEntry(const QString& fileName);
+    void writeStreamEntry(const char* data, qint64 len);
+    void finishStreamEntry();
+
+    //! NOTE State of the entry being streamed, see MQZipWriter::startFile
+    bool streaming = false;
+    bool streamDeflated = false;
+    z_stream stream;
+    FileHeader streamHeader;
+    uint streamCrc = 0;
+    qint64 streamSize = 0;
+    qint64 streamCompressedSize = 0;
+    QByteArray streamOut;
+
+    void deflateStreamEntry(int flush);
 };
 
 LocalFileHeader CentralFileHeader::toLocalHeader() const
@@ -746,6 +764,20 @@ void MQZipWriterPrivate::addEntry(EntryType type, const QString& fileName,
     crc_32 = ::crc32(crc_32, (const uchar*)contents.constData(), contents.length());
     writeUInt(header.h.crc_32, crc_32);
 
+    initEntryHeader(header, type, fileName);
+
+    fileHeaders.append(header);
+
+    LocalFileHeader h = header.h.toLocalHeader();
+    device->write((const char*)&h, sizeof(LocalFileHeader));
+    device->write(header.file_name);
+    device->write(data);
+    start_of_directory = device->pos();
+    dirtyFileTree = true;
+}
+
+void MQZipWriterPrivate::initEntryHeader(FileHeader& header, EntryType type, const QString& fileName)
+{
     // if bit 11 is set, the filename and comment fields must be encoded using UTF-8
     ushort general_purpose_bits = Utf8Names; // always use utf-8
     writeUShort(header.h.general_purpose_bits, general_purpose_bits);
@@ -783,14 +815,117 @@ void MQZipWriterPrivate::addEntry(EntryType type, const QString& fileName,
     }
     writeUInt(header.h.external_file_attributes, mode << 16);
     writeUInt(header.h.offset_local_header, start_of_directory);
+}
 
-    fileHeaders.append(header);
+//! NOTE The local header is written with empty sizes and crc first
+//! and is rewritten once the entry is finished, so the device must be seekable
+bool MQZipWriterPrivate::startStreamEntry(const QString& fileName)
+{
+    if (!(device->isOpen() || device->open(QIODevice::WriteOnly))) {
+        status = MQZipWriter::FileOpenError;
+        return false;
+    }
+    device->seek(start_of_directory);
 
-    LocalFileHeader h = header.h.toLocalHeader();
+    streamDeflated = compressionPolicy != MQZipWriter::NeverCompress;
+    if (streamDeflated) {
+        memset(&stream, 0, sizeof(z_stream));
+        if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            qWarning("QZip: failed to init the deflate stream");
+            status = MQZipWriter::FileError;
+            return false;
+        }
+        streamOut.resize(64 * 1024);
+    }
+
+    memset(&streamHeader.h, 0, sizeof(CentralFileHeader));
+    writeUInt(streamHeader.h.signature, 0x02014b50);
+    writeUShort(streamHeader.h.version_needed, ZIP_VERSION);
+    writeMSDosDate(streamHeader.h.last_mod_file, QDateTime::currentDateTime());
+    if (streamDeflated) {
+        writeUShort(streamHeader.h.compression_method, CompressionMethodDeflated);
+    }
+    initEntryHeader(streamHeader, File, fileName);
+
+    LocalFileHeader h = streamHeader.h.toLocalHeader();
     device->write((const char*)&h, sizeof(LocalFileHeader));
-    device->write(header.file_name);
-    device->write(data);
-    start_of_directory = device->pos();
+    device->write(streamHeader.file_name);
+
+    streamCrc = ::crc32(0, 0, 0);
+    streamSize = 0;
+    streamCompressedSize = 0;
+    streaming = true;
+    return true;
+}
+
+void MQZipWriterPrivate::deflateStreamEntry(int flush)
+{
+    int res = Z_OK;
+    do {
+        stream.next_out = reinterpret_cast<Bytef*>(streamOut.data());
+        stream.avail_out = static_cast<uInt>(streamOut.size());
+        res = deflate(&stream, flush);
+        const qint64 produced = streamOut.size() - stream.avail_out;
+        if (produced > 0) {
+            device->write(streamOut.constData(), produced);
+            streamCompressedSize += produced;
+        }
+    } while (res == Z_OK && stream.avail_out == 0);
+
+    if (res != Z_OK && res != Z_STREAM_END && res != Z_BUF_ERROR) {
+        qWarning("QZip: failed to deflate the streamed file");
+        status = MQZipWriter::FileError;
+    }
+}
+
+void MQZipWriterPrivate::writeStreamEntry(const char* data, qint64 len)
+{
+    if (!streaming || len <= 0) {
+        return;
+    }
+
+    streamCrc = ::crc32(streamCrc, reinterpret_cast<const Bytef*>(data), static_cast<uInt>(len));
+    streamSize += len;
+
+    if (!streamDeflated) {
+        device->write(data, len);
+        streamCompressedSize += len;
+        return;
+    }
+
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+    stream.avail_in = static_cast<uInt>(len);
+    deflateStreamEntry(Z_NO_FLUSH);
+}
+
+void MQZipWriterPrivate::finishStreamEntry()
+{
+    if (!streaming) {
+        return;
+    }
+    streaming = false;
+
+    if (streamDeflated) {
+        stream.next_in = nullptr;
+        stream.avail_in = 0;
+        deflateStreamEntry(Z_FINISH);
+        deflateEnd(&stream);
+        streamOut.clear();
+    }
+
+    writeUInt(streamHeader.h.crc_32, streamCrc);
+    writeUInt(streamHeader.h.compressed_size, static_cast<uint>(streamCompressedSize));
+    writeUInt(streamHeader.h.uncompressed_size, static_cast<uint>(streamSize));
+
+    fileHeaders.append(streamHeader);
+
+    const qint64 end = device->pos();
+    LocalFileHeader h = streamHeader.h.toLocalHeader();
+    device->seek(readUInt(streamHeader.h.offset_local_header));
+    device->write((const char*)&h, sizeof(LocalFileHeader));
+    device->seek(end);
+
+    start_of_directory = end;
     dirtyFileTree = true;
 }
 
@@ -1350,6 +1485,35 @@ void MQZipWriter::addFile(const QString& fileName, QIODevice* device)
     }
 }
 
+/*!
+    Start a file in the archive with the \a fileName whose contents are
+    written in pieces with writeFile() and completed with finishFile().
+    The contents are deflated as they arrive, so they never have to be held
+    in memory at once. The underlying device must be seekable.
+    No other entry can be added until the file is finished.
+*/
+bool MQZipWriter::startFile(const QString& fileName)
+{
+    Q_ASSERT(!d->streaming);
+    return d->startStreamEntry(QDir::fromNativeSeparators(fileName));
+}
+
+/*!
+    Append \a len bytes of \a data to the file started with startFile().
+*/
+void MQZipWriter::writeFile(const char* data, qint64 len)
+{
+    d->writeStreamEntry(data, len);
+}
+
+/*!
+    Complete the file started with startFile().
+*/
+void MQZipWriter::finishFile()
+{
+    d->finishStreamEntry();
+}
+
 /*!
     Create a new directory in the archive with the specified \a dirName and
     the \a permissions;
@@ -1379,6 +1543,8 @@ void MQZipWriter::addSymLink(const QString& fileName, const QString& destination
 */
 void MQZipWriter::close()
 {
+    d->finishStreamEntry();
+
     if (!(d->device->openMode() & QIODevice::WriteOnly)) {
         d->device->close();
         return;
@@ -102,6 +102,10 @@ public:
 
     void addFile(const QString& fileName, QIODevice* device);
 
+    bool startFile(const QString& fileName);
+    void writeFile(const char* data, qint64 len);
+    void finishFile();
+
     void addDirectory(const QString& dirName);
 
     void addSymLink(const QString& fileName, const QString& destination);
@@ -21,12 +21,16 @@
  */
 #include "globalmodule.h"
 
+#include <cstdlib>
+#include <exception>
+
 #include "modularity/ioc.h"
 #include "internal/globalconfiguration.h"
 
 #include "log.h"
 #include "logremover.h"
 #include "thirdparty/haw_logger/logger/logdefdest.h"
+#include "thirdparty/haw_logger/logger/asynclogdest.h"
 #include "version.h"
 #include "config.h"
 
@@ -54,6 +58,19 @@ static std::shared_ptr<GlobalConfiguration> s_globalConf = std::make_shared<Glob
 
 static Invoker s_asyncInvoker;
 
+static std::terminate_handler s_prevTerminateHandler = nullptr;
+
+static void flushLogsAndTerminate()
+{
+    haw::logger::AsyncLogDest::flushAll();
+
+    if (s_prevTerminateHandler) {
+        s_prevTerminateHandler();
+    }
+
+    std::abort();
+}
+
 std::string GlobalModule::moduleName() const
 {
     return "global";
@@ -82,9 +99,14 @@ void GlobalModule::onPreInit(const IApplication::RunMode& mode)
     Logger* logger = Logger::instance();
     logger->clearDests();
 
+    //! NOTE The messages are formatted and written by a background thread,
+    //! so that logging does not block the audio workers and the layout.
+    //! There are no threads on wasm, the destinations are written directly there
+    std::vector<LogDest*> dests;
+
     //! Console
     if (mode == IApplication::RunMode::Editor || mu::runtime::isDebug()) {
-        logger->addDest(new ConsoleLogDest(LogLayout("${time} | ${type|5} | ${thread} | ${tag|10} | ${message}")));
+        dests.push_back(new ConsoleLogDest(LogLayout("${time} | ${type|5} | ${thread} | ${tag|10} | ${message}")));
     }
 
     io::path_t logPath = s_globalConf->userAppDataPath() + "/logs";
@@ -101,7 +123,18 @@ void GlobalModule::onPreInit(const IApplication::RunMode& mode)
     FileLogDest* logFile = new FileLogDest(logFilePath.toStdString(),
                                            LogLayout("${datetime} | ${type|5} | ${thread} | ${tag|10} | ${message}"));
 
-    logger->addDest(logFile);
+    dests.push_back(logFile);
+
+#ifdef Q_OS_WASM
+    for (LogDest* dest : dests) {
+        logger->addDest(dest);
+    }
+#else
+    logger->addDest(new AsyncLogDest(dests));
+
+    //! NOTE Write what is still buffered before going down
+    s_prevTerminateHandler = std::set_terminate(flushLogsAndTerminate);
+#endif
 
 #ifdef LOGGER_DEBUGLEVEL_ENABLED
     logger->setLevel(haw::logger::Debug);
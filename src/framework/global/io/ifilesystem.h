@@ -61,6 +61,11 @@ public:
     virtual bool readFile(const io::path_t& filePath, ByteArray& data) const = 0;
     virtual Ret writeFile(const io::path_t& filePath, const ByteArray& data) const = 0;
 
+    //! NOTE Maps the file into memory for reading, returns nullptr if it can't be mapped.
+    //! The data stays valid until unmapFile is called with it
+    virtual const uint8_t* mapFile(const io::path_t& filePath, size_t& size) const = 0;
+    virtual void unmapFile(const uint8_t* data) const = 0;
+
     //! NOTE File info
     virtual io::path_t canonicalFilePath(const io::path_t& filePath) const = 0;
     virtual io::path_t absolutePath(const io::path_t& filePath) const = 0;
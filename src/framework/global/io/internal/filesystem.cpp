@@ -35,6 +35,15 @@
 using namespace mu;
 using namespace mu::io;
 
+FileSystem::~FileSystem()
+{
+    std::lock_guard lock(m_mappedFilesMutex);
+    for (auto& pair : m_mappedFiles) {
+        delete pair.second;
+    }
+    m_mappedFiles.clear();
+}
+
 Ret FileSystem::exists(const io::path_t& path) const
 {
     QFileInfo fileInfo(path.toQString());
@@ -170,6 +179,44 @@ Ret FileSystem::writeFile(const io::path_t& filePath, const ByteArray& data) con
     return true;
 }
 
+const uint8_t* FileSystem::mapFile(const io::path_t& filePath, size_t& size) const
+{
+    QFile* file = new QFile(filePath.toQString());
+    if (!file->open(QIODevice::ReadOnly) || file->size() == 0) {
+        delete file;
+        return nullptr;
+    }
+
+    uchar* data = file->map(0, file->size());
+    if (!data) {
+        LOGD() << "failed map file: " << filePath << ", error: " << file->errorString();
+        delete file;
+        return nullptr;
+    }
+
+    //! NOTE The mapping stays valid after the file is closed
+    size = static_cast<size_t>(file->size());
+    file->close();
+
+    std::lock_guard lock(m_mappedFilesMutex);
+    m_mappedFiles[data] = file;
+
+    return data;
+}
+
+void FileSystem::unmapFile(const uint8_t* data) const
+{
+    std::lock_guard lock(m_mappedFilesMutex);
+    auto it = m_mappedFiles.find(data);
+    if (it == m_mappedFiles.end()) {
+        return;
+    }
+
+    it->second->unmap(const_cast<uchar*>(data));
+    delete it->second;
+    m_mappedFiles.erase(it);
+}
+
 Ret FileSystem::makePath(const io::path_t& path) const
 {
     if (!QDir().mkpath(path.toQString())) {
@@ -22,12 +22,19 @@
 #ifndef MU_SYSTEM_FILESYSTEM_H
 #define MU_SYSTEM_FILESYSTEM_H
 
+#include <map>
+#include <mutex>
+
 #include "../ifilesystem.h"
 
+class QFile;
+
 namespace mu::io {
 class FileSystem : public IFileSystem
 {
 public:
+    ~FileSystem() override;
+
     Ret exists(const io::path_t& path) const override;
     Ret remove(const io::path_t& path) const override;
     Ret removeFolderIfEmpty(const io::path_t& path) const override;
@@ -45,6 +52,9 @@ public:
     bool readFile(const io::path_t& filePath, ByteArray& data) const override;
     Ret writeFile(const io::path_t& filePath, const ByteArray& data) const override;
 
+    const uint8_t* mapFile(const io::path_t& filePath, size_t& size) const override;
+    void unmapFile(const uint8_t* data) const override;
+
     void setAttribute(const io::path_t& path, Attribute attribute) const override;
     bool setPermissionsAllowedForAll(const io::path_t& path) const override;
 
@@ -59,6 +69,9 @@ private:
     Ret removeFile(const io::path_t& path) const;
     Ret removeDir(const io::path_t& path, bool recursively = true) const;
     Ret copyRecursively(const io::path_t& src, const io::path_t& dst) const;
+
+    mutable std::mutex m_mappedFilesMutex;
+    mutable std::map<const uint8_t*, QFile*> m_mappedFiles;
 };
 }
 
@@ -0,0 +1,96 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "mappedfile.h"
+
+#include "log.h"
+
+using namespace mu::io;
+
+MappedFile::MappedFile(const path_t& filePath)
+    : m_filePath(filePath)
+{
+}
+
+MappedFile::~MappedFile()
+{
+    close();
+    unmap();
+}
+
+path_t MappedFile::filePath() const
+{
+    return m_filePath;
+}
+
+bool MappedFile::isMapped() const
+{
+    return m_mappedData != nullptr;
+}
+
+void MappedFile::unmap()
+{
+    if (m_mappedData) {
+        fileSystem()->unmapFile(m_mappedData);
+        m_mappedData = nullptr;
+        m_mappedSize = 0;
+    }
+}
+
+bool MappedFile::doOpen(OpenMode m)
+{
+    IF_ASSERT_FAILED(m == OpenMode::ReadOnly) {
+        return false;
+    }
+
+    unmap();
+    m_data = ByteArray();
+
+    m_mappedData = fileSystem()->mapFile(m_filePath, m_mappedSize);
+    if (m_mappedData) {
+        return true;
+    }
+
+    //! NOTE Empty files and some file systems can't be mapped
+    return fileSystem()->readFile(m_filePath, m_data);
+}
+
+size_t MappedFile::dataSize() const
+{
+    return m_mappedData ? m_mappedSize : m_data.size();
+}
+
+const uint8_t* MappedFile::rawData() const
+{
+    return m_mappedData ? m_mappedData : m_data.constData();
+}
+
+bool MappedFile::resizeData(size_t)
+{
+    NOT_SUPPORTED;
+    return false;
+}
+
+size_t MappedFile::writeData(const uint8_t*, size_t)
+{
+    NOT_SUPPORTED;
+    return 0;
+}
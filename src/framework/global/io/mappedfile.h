@@ -0,0 +1,67 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_IO_MAPPEDFILE_H
+#define MU_IO_MAPPEDFILE_H
+
+#include "iodevice.h"
+#include "path.h"
+
+#include "modularity/ioc.h"
+#include "ifilesystem.h"
+
+namespace mu::io {
+//! NOTE Read only file, mapped into memory instead of being read
+//! (read if it can't be mapped), so only the parts actually accessed are loaded
+class MappedFile : public IODevice
+{
+    INJECT_STATIC(io, IFileSystem, fileSystem)
+public:
+
+    MappedFile(const path_t& filePath);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    path_t filePath() const;
+    bool isMapped() const;
+
+protected:
+
+    bool doOpen(OpenMode m) override;
+    size_t dataSize() const override;
+    const uint8_t* rawData() const override;
+    bool resizeData(size_t size) override;
+    size_t writeData(const uint8_t* data, size_t len) override;
+
+private:
+
+    void unmap();
+
+    path_t m_filePath;
+    const uint8_t* m_mappedData = nullptr;
+    size_t m_mappedSize = 0;
+    ByteArray m_data;   // if not mapped
+};
+}
+
+#endif // MU_IO_MAPPEDFILE_H
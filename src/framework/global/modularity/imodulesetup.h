@@ -43,6 +43,10 @@ public:
 
     virtual void onPreInit(const framework::IApplication::RunMode& mode) { (void)mode; }
     virtual void onInit(const framework::IApplication::RunMode& mode) { (void)mode; }
+    //! NOTE Called on a worker right after onInit, all of them are finished before onAllInited.
+    //! Only for the work which doesn't touch the UI, the Qt objects and the other modules
+    //! (ex parsing the data files), the module has to guard the state it fills here
+    virtual void onConcurrentInit(const framework::IApplication::RunMode& mode) { (void)mode; }
     virtual void onAllInited(const framework::IApplication::RunMode& mode) { (void)mode; }
     virtual void onDelayedInit() {}
     virtual void onDeinit() {}
@@ -26,11 +26,13 @@
 #include <memory>
 #include "modulesioc.h"
 
+//! NOTE The getters are called in the inner loops of the layout and painting,
+//! so the service is resolved once and returned by reference, without touching its ref count
 #define INJECT(Module, Interface, getter) \
 private: \
     mutable std::shared_ptr<Interface> _##getter = nullptr; \
 public: \
-    std::shared_ptr<Interface> getter() const {  \
+    const std::shared_ptr<Interface>& getter() const {  \
         if (!_##getter) { \
             _##getter = mu::modularity::ioc()->resolve<Interface>(#Module); \
         } \
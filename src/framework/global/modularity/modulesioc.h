@@ -24,7 +24,7 @@
 #define MU_MODULARITY_MODULESIOC_H
 
 #include <memory>
-#include <map>
+#include <unordered_map>
 #include <string>
 #include <cassert>
 #include <iostream>
@@ -119,20 +119,39 @@ public:
 
     void reset()
     {
+        m_interned.clear();
         m_map.clear();
     }
 
 private:
 
+    struct Service {
+        IModuleExportCreator* c = nullptr;
+        std::string sourceModule;
+        std::shared_ptr<IModuleExportInterface> p;
+    };
+
     ModulesIoC() = default;
 
-    void unregisterService(const std::string& id)
+    void unregisterService(const char* id)
     {
-        m_map.erase(id);
+        auto it = m_map.find(id);
+        if (it == m_map.end()) {
+            return;
+        }
+
+        for (auto internedIt = m_interned.begin(); internedIt != m_interned.end();) {
+            if (internedIt->second == &it->second) {
+                internedIt = m_interned.erase(internedIt);
+            } else {
+                ++internedIt;
+            }
+        }
+        m_map.erase(it);
     }
 
     void registerService(const std::string& module,
-                         const std::string& id,
+                         const char* id,
                          std::shared_ptr<IModuleExportInterface> p,
                          IModuleExportCreator* c)
     {
@@ -147,18 +166,38 @@ private:
         inj.sourceModule = module;
         inj.c = c;
         inj.p = p;
-        m_map[id] = inj;
+        Service& service = m_map[id];
+        service = inj;
+        m_interned[id] = &service;
     }
 
-    std::shared_ptr<IModuleExportInterface> doResolvePtrById(const std::string& resolveModule, const std::string& id)
+    //! NOTE The ids are the static strings of INTERFACE_ID, so they are interned by their address
+    //! on register. An id resolved from another copy of the string is found by its hash.
+    //! Resolving only reads the maps, so the services can be resolved from any thread
+    Service* findService(const char* id)
     {
-        (void)(resolveModule); //! TODO add statistics collection / monitoring, who resolves what
+        auto internedIt = m_interned.find(id);
+        if (internedIt != m_interned.end()) {
+            return internedIt->second;
+        }
+
         auto it = m_map.find(id);
         if (it == m_map.end()) {
             return nullptr;
         }
 
-        Service& inj = it->second;
+        return &it->second;
+    }
+
+    std::shared_ptr<IModuleExportInterface> doResolvePtrById(const std::string& resolveModule, const char* id)
+    {
+        (void)(resolveModule); //! TODO add statistics collection / monitoring, who resolves what
+        Service* found = findService(id);
+        if (!found) {
+            return nullptr;
+        }
+
+        Service& inj = *found;
         if (inj.p) {
             return inj.p;
         }
@@ -170,13 +209,8 @@ private:
         return nullptr;
     }
 
-    struct Service {
-        IModuleExportCreator* c = nullptr;
-        std::string sourceModule;
-        std::shared_ptr<IModuleExportInterface> p;
-    };
-
-    std::map<std::string, Service > m_map;
+    std::unordered_map<std::string, Service > m_map;
+    std::unordered_map<const char*, Service*> m_interned;
 };
 
 template<class T>
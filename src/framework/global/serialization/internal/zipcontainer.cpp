@@ -21,10 +21,14 @@
  */
 #include "zipcontainer.h"
 
+#include <algorithm>
 #include <ctime>
 #include <cstring>
+#include <future>
+#include <vector>
 #include <zlib.h>
 
+#include "concurrency/taskscheduler.h"
 #include "io/dir.h"
 
 #include "log.h"
@@ -110,78 +114,138 @@ static void writeMSDosDate(uint8_t* dest, const std::tm& dt)
     }
 }
 
-static int inflate(Bytef* dest, ulong* destLen, const Bytef* source, ulong sourceLen)
+//! NOTE Inflates a raw deflate stream into a buffer, growing it when the expected size was too small
+static int inflate(const uint8_t* source, size_t sourceLen, ByteArray& dest)
 {
     z_stream stream;
-    int err;
+    std::memset(&stream, 0, sizeof(stream));
 
-    stream.next_in = const_cast<Bytef*>(source);
-    stream.avail_in = (uInt)sourceLen;
-    if ((uLong)stream.avail_in != sourceLen) {
-        return Z_BUF_ERROR;
+    int err = inflateInit2(&stream, -MAX_WBITS);
+    if (err != Z_OK) {
+        return err;
     }
 
-    stream.next_out = dest;
-    stream.avail_out = (uInt) * destLen;
-    if ((uLong)stream.avail_out != *destLen) {
-        return Z_BUF_ERROR;
-    }
+    stream.next_in = const_cast<Bytef*>(source);
+    stream.avail_in = static_cast<uInt>(sourceLen);
 
-    stream.zalloc = (alloc_func)0;
-    stream.zfree = (free_func)0;
+    size_t done = 0;
+    while (true) {
+        if (done == dest.size()) {
+            dest.resize(std::max(dest.size() * 2, size_t(1024)));
+        }
+        stream.next_out = dest.data() + done;
+        stream.avail_out = static_cast<uInt>(dest.size() - done);
 
-    err = inflateInit2(&stream, -MAX_WBITS);
-    if (err != Z_OK) {
-        return err;
-    }
+        err = inflate(&stream, Z_NO_FLUSH);
+        done = stream.total_out;
 
-    err = inflate(&stream, Z_FINISH);
-    if (err != Z_STREAM_END) {
-        inflateEnd(&stream);
-        if (err == Z_NEED_DICT || (err == Z_BUF_ERROR && stream.avail_in == 0)) {
-            return Z_DATA_ERROR;
+        if (err == Z_STREAM_END) {
+            break;
+        }
+        if (err != Z_OK && !(err == Z_BUF_ERROR && stream.avail_out == 0)) {
+            inflateEnd(&stream);
+            if (err == Z_NEED_DICT || (err == Z_BUF_ERROR && stream.avail_in == 0)) {
+                return Z_DATA_ERROR;
+            }
+            return err;
         }
-        return err;
     }
-    *destLen = stream.total_out;
 
-    err = inflateEnd(&stream);
-    return err;
+    dest.resize(done);
+    return inflateEnd(&stream);
 }
 
-static int deflate(Bytef* dest, ulong* destLen, const Bytef* source, ulong sourceLen)
+//! NOTE Inflates a raw deflate stream chunk by chunk, without holding all the inflated data
+static int inflate(const uint8_t* source, size_t sourceLen, const ZipContainer::DataHandler& onData)
 {
     z_stream stream;
-    int err;
+    std::memset(&stream, 0, sizeof(stream));
+
+    int err = inflateInit2(&stream, -MAX_WBITS);
+    if (err != Z_OK) {
+        return err;
+    }
 
     stream.next_in = const_cast<Bytef*>(source);
-    stream.avail_in = (uInt)sourceLen;
-    stream.next_out = dest;
-    stream.avail_out = (uInt) * destLen;
-    if ((uLong)stream.avail_out != *destLen) {
-        return Z_BUF_ERROR;
+    stream.avail_in = static_cast<uInt>(sourceLen);
+
+    constexpr size_t CHUNK_SIZE = 64 * 1024;
+    std::vector<uint8_t> chunk(CHUNK_SIZE);
+
+    while (true) {
+        stream.next_out = chunk.data();
+        stream.avail_out = static_cast<uInt>(chunk.size());
+
+        err = inflate(&stream, Z_NO_FLUSH);
+
+        size_t len = chunk.size() - stream.avail_out;
+        if (len > 0 && !onData(chunk.data(), len)) {
+            inflateEnd(&stream);
+            return Z_STREAM_END;
+        }
+
+        if (err == Z_STREAM_END) {
+            break;
+        }
+        if (err != Z_OK && !(err == Z_BUF_ERROR && stream.avail_out == 0)) {
+            inflateEnd(&stream);
+            if (err == Z_NEED_DICT || (err == Z_BUF_ERROR && stream.avail_in == 0)) {
+                return Z_DATA_ERROR;
+            }
+            return err;
+        }
     }
 
-    stream.zalloc = (alloc_func)0;
-    stream.zfree = (free_func)0;
-    stream.opaque = (voidpf)0;
+    return inflateEnd(&stream);
+}
 
-    err = deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+//! NOTE Deflates a block of a raw deflate stream. The blocks are deflated independently
+//! and joined into one stream, all of them except of the last one end on a byte boundary
+//! with a full flush, only the last one finishes the stream
+static int deflateBlock(const uint8_t* source, size_t sourceLen, int level, bool last, ByteArray& dest)
+{
+    z_stream stream;
+    std::memset(&stream, 0, sizeof(stream));
+
+    int err = deflateInit2(&stream, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
     if (err != Z_OK) {
         return err;
     }
 
-    err = deflate(&stream, Z_FINISH);
-    if (err != Z_STREAM_END) {
+    // the bound is for a finished stream, a full flush adds an empty stored block
+    dest.resize(deflateBound(&stream, (uLong)sourceLen) + 16);
+
+    stream.next_in = const_cast<Bytef*>(source);
+    stream.avail_in = (uInt)sourceLen;
+    stream.next_out = dest.data();
+    stream.avail_out = (uInt)dest.size();
+
+    err = deflate(&stream, last ? Z_FINISH : Z_FULL_FLUSH);
+    bool done = last ? (err == Z_STREAM_END) : (err == Z_OK && stream.avail_in == 0);
+    if (!done) {
         deflateEnd(&stream);
-        return err == Z_OK ? Z_BUF_ERROR : err;
+        return err == Z_OK || err == Z_STREAM_END ? Z_BUF_ERROR : err;
     }
-    *destLen = stream.total_out;
 
-    err = deflateEnd(&stream);
-    return err;
+    dest.resize(stream.total_out);
+
+    deflateEnd(&stream);
+    return Z_OK;
 }
 
+//! NOTE The entries are deflated on their own workers, not on the shared ones, which are used by the audio
+static mu::TaskScheduler* compressionWorkers()
+{
+    static mu::TaskScheduler workers;
+    return &workers;
+}
+
+// the large entries are split into the blocks deflated in parallel
+static constexpr size_t DEFLATE_BLOCK_SIZE = 1024 * 1024;
+
+// the entries are written, when so much data is waiting to be deflated
+static constexpr size_t MAX_PENDING_SIZE = 64 * 1024 * 1024;
+
 namespace WindowsFileAttributes {
 enum {
     Dir        = 0x10, // FILE_ATTRIBUTE_DIRECTORY
@@ -379,18 +443,44 @@ struct ZipContainer::Impl {
     ZipContainer::Status status = ZipContainer::NoError;
 
     ZipContainer::CompressionPolicy compressionPolicy = ZipContainer::AlwaysCompress;
+    int compressionLevel = Z_DEFAULT_COMPRESSION;
 
     enum EntryType {
         Directory, File, Symlink
     };
 
     void addEntry(EntryType type, const std::string& fileName, const ByteArray& contents);
+    bool addUnchangedEntry(Impl* source, const std::string& fileName, const ByteArray& contents);
+
+    //! NOTE The added entries are deflated on the workers and written in order,
+    //! when they are done, so that several of them are deflated at once
+    struct PendingEntry {
+        FileHeader header;
+        ByteArray data;                                 // stored as it is
+        std::vector<std::future<ByteArray> > blocks;    // deflated
+    };
+
+    std::vector<PendingEntry> pendingEntries;
+    size_t pendingSize = 0;
+
+    std::vector<std::future<ByteArray> > deflateBlocks(const ByteArray& contents) const;
+    void writePendingEntries();
 
     Impl(IODevice* d)
         : device(d) {}
 
     void scanFiles();
     ZipContainer::FileInfo fillFileInfo(int index) const;
+
+    struct EntryData {
+        const uint8_t* data = nullptr;      // view of the device data, not copied
+        size_t compressedSize = 0;
+        size_t uncompressedSize = 0;
+        int compressionMethod = 0;
+        const FileHeader* header = nullptr;
+    };
+
+    bool entryData(const std::string& fileName, EntryData& entry);
 };
 
 void ZipContainer::Impl::scanFiles()
@@ -551,7 +641,6 @@ void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, c
         status = ZipContainer::FileOpenError;
         return;
     }
-    device->seek(start_of_directory);
 
     // don't compress small files
     ZipContainer::CompressionPolicy compression = compressionPolicy;
@@ -573,34 +662,15 @@ void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, c
     std::time_t t = std::time(0);   // get time now
     std::tm* now = std::localtime(&t);
     writeMSDosDate(header.h.last_mod_file, *now);
-    ByteArray data = contents;
+
+    PendingEntry entry;
     if (compression == ZipContainer::AlwaysCompress) {
         writeUShort(header.h.compression_method, CompressionMethodDeflated);
-
-        ulong len = (ulong)contents.size();
-        // shamelessly copied form zlib
-        len += (len >> 12) + (len >> 14) + 11;
-        int res;
-        do {
-            data.resize(len);
-            res = deflate((uint8_t*)data.data(), &len, (const uint8_t*)contents.constData(), (ulong)contents.size());
-
-            switch (res) {
-            case Z_OK:
-                data.resize(len);
-                break;
-            case Z_MEM_ERROR:
-                LOGW("Zip: Z_MEM_ERROR: Not enough memory to compress file, skipping");
-                data.resize(0);
-                break;
-            case Z_BUF_ERROR:
-                len *= 2;
-                break;
-            }
-        } while (res == Z_BUF_ERROR);
+        entry.blocks = deflateBlocks(contents);
+    } else {
+        entry.data = contents;
     }
 // TODO add a check if data.size() > contents.size().  Then try to store the original and revert the compression method to be uncompressed
-    writeUInt(header.h.compressed_size, (uint)data.size());
     uint crc_32 = ::crc32(0, 0, 0);
     crc_32 = ::crc32(crc_32, (const uint8_t*)contents.constData(), (uint)contents.size());
     writeUInt(header.h.crc_32, crc_32);
@@ -645,6 +715,172 @@ void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, c
         break;
     }
     writeUInt(header.h.external_file_attributes, mode << 16);
+
+    entry.header = header;
+    pendingEntries.push_back(std::move(entry));
+
+    pendingSize += contents.size();
+    if (pendingSize > MAX_PENDING_SIZE) {
+        writePendingEntries();
+    }
+}
+
+std::vector<std::future<ByteArray> > ZipContainer::Impl::deflateBlocks(const ByteArray& contents) const
+{
+    // the raw data isn't owned, it may be gone before it's deflated
+    ByteArray source = contents.isRawData() ? ByteArray(contents.constData(), contents.size()) : contents;
+
+    size_t size = source.size();
+    size_t count = std::max(size_t(1), (size + DEFLATE_BLOCK_SIZE - 1) / DEFLATE_BLOCK_SIZE);
+    int level = compressionLevel;
+
+    std::vector<std::future<ByteArray> > blocks;
+    blocks.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        size_t offset = i * DEFLATE_BLOCK_SIZE;
+        size_t len = std::min(DEFLATE_BLOCK_SIZE, size - offset);
+        bool last = i == count - 1;
+
+        blocks.push_back(compressionWorkers()->submit([source, offset, len, last, level]() {
+            ByteArray block;
+            int res = deflateBlock(source.constData() + offset, len, level, last, block);
+            if (res != Z_OK) {
+                LOGW("Zip: deflate error %d", res);
+                return ByteArray();
+            }
+            return block;
+        }));
+    }
+
+    return blocks;
+}
+
+void ZipContainer::Impl::writePendingEntries()
+{
+    if (pendingEntries.empty()) {
+        return;
+    }
+
+    device->seek(start_of_directory);
+
+    for (PendingEntry& entry : pendingEntries) {
+        std::vector<ByteArray> blocks;
+        size_t compressedSize = entry.data.size();
+        if (!entry.blocks.empty()) {
+            compressedSize = 0;
+            for (std::future<ByteArray>& block : entry.blocks) {
+                blocks.push_back(block.get());
+                // a finished deflate stream is never empty
+                if (blocks.back().empty()) {
+                    status = ZipContainer::FileWriteError;
+                }
+                compressedSize += blocks.back().size();
+            }
+        }
+
+        if (status != ZipContainer::NoError) {
+            continue;
+        }
+
+        FileHeader& header = entry.header;
+        writeUInt(header.h.compressed_size, (uint)compressedSize);
+        writeUInt(header.h.offset_local_header, start_of_directory);
+
+        fileHeaders.push_back(header);
+
+        LocalFileHeader h = header.h.toLocalHeader();
+        device->write((const uint8_t*)&h, sizeof(LocalFileHeader));
+        device->write(header.file_name);
+        if (blocks.empty()) {
+            device->write(entry.data);
+        } else {
+            for (const ByteArray& block : blocks) {
+                device->write(block);
+            }
+        }
+        start_of_directory = (uint)device->pos();
+    }
+
+    pendingEntries.clear();
+    pendingSize = 0;
+    dirtyFileTree = true;
+}
+
+bool ZipContainer::Impl::addUnchangedEntry(Impl* source, const std::string& fileName, const ByteArray& contents)
+{
+    EntryData entry;
+    if (!source->entryData(fileName, entry)) {
+        return false;
+    }
+
+    if (entry.uncompressedSize != contents.size()) {
+        return false;
+    }
+
+    switch (compressionPolicy) {
+    case ZipContainer::AlwaysCompress:
+        if (entry.compressionMethod != CompressionMethodDeflated) {
+            return false;
+        }
+        break;
+    case ZipContainer::NeverCompress:
+        if (entry.compressionMethod != CompressionMethodStored) {
+            return false;
+        }
+        break;
+    case ZipContainer::AutoCompress:
+        if (entry.compressionMethod != CompressionMethodStored && entry.compressionMethod != CompressionMethodDeflated) {
+            return false;
+        }
+        break;
+    }
+
+    uint crc_32 = ::crc32(0, 0, 0);
+    crc_32 = ::crc32(crc_32, (const uint8_t*)contents.constData(), (uint)contents.size());
+    if (crc_32 != readUInt(entry.header->h.crc_32)) {
+        return false;
+    }
+
+    //! NOTE The checksum may match by chance, so the data is compared too,
+    //! inflating is still much cheaper than deflating
+    if (entry.compressionMethod == CompressionMethodStored) {
+        if (std::memcmp(entry.data, contents.constData(), contents.size()) != 0) {
+            return false;
+        }
+    } else {
+        size_t pos = 0;
+        bool same = true;
+        int res = inflate(entry.data, entry.compressedSize, [&contents, &pos, &same](const uint8_t* data, size_t len) {
+            if (pos + len > contents.size() || std::memcmp(data, contents.constData() + pos, len) != 0) {
+                same = false;
+                return false;
+            }
+            pos += len;
+            return true;
+        });
+
+        if (res != Z_OK || !same || pos != contents.size()) {
+            return false;
+        }
+    }
+
+    if (!(device->isOpen() || device->open(IODevice::WriteOnly))) {
+        status = ZipContainer::FileOpenError;
+        return false;
+    }
+
+    // keep the order of the entries
+    writePendingEntries();
+    device->seek(start_of_directory);
+
+    FileHeader header;
+    header.h = entry.header->h;
+    header.file_name = entry.header->file_name;
+
+    // the sizes are in the local header, there is no data descriptor after the data
+    writeUShort(header.h.general_purpose_bits, readUShort(header.h.general_purpose_bits) & ~HasDataDescriptor);
+    writeUShort(header.h.extra_field_length, 0);
+    writeUShort(header.h.file_comment_length, 0);
     writeUInt(header.h.offset_local_header, start_of_directory);
 
     fileHeaders.push_back(header);
@@ -652,9 +888,11 @@ void ZipContainer::Impl::addEntry(EntryType type, const std::string& fileName, c
     LocalFileHeader h = header.h.toLocalHeader();
     device->write((const uint8_t*)&h, sizeof(LocalFileHeader));
     device->write(header.file_name);
-    device->write(data);
+    device->write(entry.data, entry.compressedSize);
     start_of_directory = (uint)device->pos();
     dirtyFileTree = true;
+
+    return true;
 }
 
 ZipContainer::ZipContainer(IODevice* device)
@@ -687,88 +925,131 @@ int ZipContainer::count() const
     return (int)p->fileHeaders.size();
 }
 
-ByteArray ZipContainer::fileData(const std::string& fileName) const
+bool ZipContainer::Impl::entryData(const std::string& fileName, EntryData& entry)
 {
-    p->scanFiles();
+    scanFiles();
 
     size_t i;
-    for (i = 0; i < p->fileHeaders.size(); ++i) {
-        if (p->fileHeaders.at(i).file_name == ByteArray::fromRawData(fileName.c_str(), fileName.size())) {
+    for (i = 0; i < fileHeaders.size(); ++i) {
+        if (fileHeaders.at(i).file_name == ByteArray::fromRawData(fileName.c_str(), fileName.size())) {
             break;
         }
     }
 
-    if (i == p->fileHeaders.size()) {
-        return ByteArray();
+    if (i == fileHeaders.size()) {
+        return false;
     }
 
-    FileHeader header = p->fileHeaders.at(i);
+    const FileHeader& header = fileHeaders.at(i);
 
     ushort version_needed = readUShort(header.h.version_needed);
     if (version_needed > ZIP_VERSION) {
         LOGW("Zip: .ZIP specification version %d implementationis needed to extract the data.", version_needed);
-        return ByteArray();
+        return false;
     }
 
     ushort general_purpose_bits = readUShort(header.h.general_purpose_bits);
-    int compressed_size = readUInt(header.h.compressed_size);
-    int uncompressed_size = readUInt(header.h.uncompressed_size);
-    int start = readUInt(header.h.offset_local_header);
+    uint compressed_size = readUInt(header.h.compressed_size);
+    uint uncompressed_size = readUInt(header.h.uncompressed_size);
+    uint start = readUInt(header.h.offset_local_header);
 
-    p->device->seek(start);
+    device->seek(start);
     LocalFileHeader lh;
-    p->device->read((uint8_t*)&lh, sizeof(LocalFileHeader));
+    device->read((uint8_t*)&lh, sizeof(LocalFileHeader));
     uint skip = readUShort(lh.file_name_length) + readUShort(lh.extra_field_length);
-    p->device->seek(p->device->pos() + skip);
-
-    int compression_method = readUShort(lh.compression_method);
+    device->seek(device->pos() + skip);
 
     if ((general_purpose_bits & Encrypted) != 0) {
         LOGW("Zip: Unsupported encryption method is needed to extract the data.");
+        return false;
+    }
+
+    //! NOTE The devices keep their data in memory (or mapped into memory),
+    //! so the compressed data is used in place instead of being copied
+    size_t dataPos = device->pos();
+    if (dataPos + compressed_size > device->size()) {
+        LOGW("Zip: The entry exceeds the end of the archive.");
+        status = ZipContainer::FileReadError;
+        return false;
+    }
+
+    entry.data = device->readData() + dataPos;
+    entry.compressedSize = compressed_size;
+    entry.uncompressedSize = uncompressed_size;
+    entry.compressionMethod = readUShort(lh.compression_method);
+    entry.header = &header;
+
+    return true;
+}
+
+ByteArray ZipContainer::fileData(const std::string& fileName) const
+{
+    Impl::EntryData entry;
+    if (!p->entryData(fileName, entry)) {
         return ByteArray();
     }
 
-    ByteArray compressed = p->device->read(compressed_size);
-    if (compression_method == CompressionMethodStored) {
+    if (entry.compressionMethod == CompressionMethodStored) {
         // no compression
-        compressed.truncate(uncompressed_size);
-        return compressed;
-    } else if (compression_method == CompressionMethodDeflated) {
-        // Deflate
-        //qDebug("compressed=%d", compressed.size());
-        compressed.truncate(compressed_size);
-        ByteArray baunzip;
-        ulong len = std::max(uncompressed_size,  1);
-        int res;
-        do {
-            baunzip.resize(len);
-            res = inflate((uint8_t*)baunzip.data(), &len,
-                          (const uint8_t*)compressed.constData(), compressed_size);
-
-            switch (res) {
-            case Z_OK:
-                if ((size_t)len != baunzip.size()) {
-                    baunzip.resize(len);
-                }
-                break;
-            case Z_MEM_ERROR:
-                LOGW("Zip: Z_MEM_ERROR: Not enough memory");
-                break;
-            case Z_BUF_ERROR:
-                len *= 2;
-                break;
-            case Z_DATA_ERROR:
-                LOGW("Zip: Z_DATA_ERROR: Input data is corrupted");
-                break;
-            }
-        } while (res == Z_BUF_ERROR);
-        return baunzip;
+        return ByteArray(entry.data, std::min(entry.compressedSize, entry.uncompressedSize));
+    } else if (entry.compressionMethod == CompressionMethodDeflated) {
+        // Deflate, the size is known from the header, so it's usually inflated in one go
+        ByteArray baunzip(std::max(entry.uncompressedSize, size_t(1)));
+        int res = inflate(entry.data, entry.compressedSize, baunzip);
+        switch (res) {
+        case Z_OK:
+            return baunzip;
+        case Z_MEM_ERROR:
+            LOGW("Zip: Z_MEM_ERROR: Not enough memory");
+            break;
+        case Z_DATA_ERROR:
+            LOGW("Zip: Z_DATA_ERROR: Input data is corrupted");
+            break;
+        default:
+            LOGW("Zip: inflate error %d", res);
+            break;
+        }
+        return ByteArray();
     }
 
-    LOGW("Zip: Unsupported compression method %d is needed to extract the data.", compression_method);
+    LOGW("Zip: Unsupported compression method %d is needed to extract the data.", entry.compressionMethod);
     return ByteArray();
 }
 
+bool ZipContainer::fileData(const std::string& fileName, const DataHandler& onData) const
+{
+    Impl::EntryData entry;
+    if (!p->entryData(fileName, entry)) {
+        return false;
+    }
+
+    if (entry.compressionMethod == CompressionMethodStored) {
+        // no compression, the data is passed as it is in the archive
+        onData(entry.data, std::min(entry.compressedSize, entry.uncompressedSize));
+        return true;
+    } else if (entry.compressionMethod == CompressionMethodDeflated) {
+        int res = inflate(entry.data, entry.compressedSize, onData);
+        switch (res) {
+        case Z_OK:
+        case Z_STREAM_END:
+            return true;
+        case Z_MEM_ERROR:
+            LOGW("Zip: Z_MEM_ERROR: Not enough memory");
+            break;
+        case Z_DATA_ERROR:
+            LOGW("Zip: Z_DATA_ERROR: Input data is corrupted");
+            break;
+        default:
+            LOGW("Zip: inflate error %d", res);
+            break;
+        }
+        return false;
+    }
+
+    LOGW("Zip: Unsupported compression method %d is needed to extract the data.", entry.compressionMethod);
+    return false;
+}
+
 ZipContainer::Status ZipContainer::status() const
 {
     return p->status;
@@ -784,11 +1065,26 @@ ZipContainer::CompressionPolicy ZipContainer::compressionPolicy() const
     return p->compressionPolicy;
 }
 
+void ZipContainer::setCompressionLevel(int level)
+{
+    p->compressionLevel = level;
+}
+
+int ZipContainer::compressionLevel() const
+{
+    return p->compressionLevel;
+}
+
 void ZipContainer::addFile(const std::string& fileName, const ByteArray& data)
 {
     p->addEntry(Impl::File, Dir::fromNativeSeparators(fileName).toStdString(), data);
 }
 
+bool ZipContainer::addUnchangedFile(const ZipContainer& source, const std::string& fileName, const ByteArray& data)
+{
+    return p->addUnchangedEntry(source.p, Dir::fromNativeSeparators(fileName).toStdString(), data);
+}
+
 void ZipContainer::addDirectory(const std::string& dirName)
 {
     std::string name(Dir::fromNativeSeparators(dirName).toStdString());
@@ -806,6 +1102,8 @@ void ZipContainer::close()
         return;
     }
 
+    p->writePendingEntries();
+
     //qDebug("Zip::close writing directory, %d entries", p->fileHeaders.size());
     p->device->seek(p->start_of_directory);
     // write new directory
@@ -23,6 +23,7 @@
 #define MU_GLOBAL_ZIPCONTAINER_H
 
 #include <ctime>
+#include <functional>
 #include <string>
 #include "io/iodevice.h"
 
@@ -64,6 +65,11 @@ public:
 
     ByteArray fileData(const std::string& fileName) const;
 
+    //! NOTE Passes the data of the file chunk by chunk while it's inflated,
+    //! the handler returns false to stop reading
+    using DataHandler = std::function<bool (const uint8_t* data, size_t len)>;
+    bool fileData(const std::string& fileName, const DataHandler& onData) const;
+
     // Write
     enum CompressionPolicy {
         AlwaysCompress,
@@ -74,7 +80,17 @@ public:
     void setCompressionPolicy(CompressionPolicy policy);
     CompressionPolicy compressionPolicy() const;
 
+    //! NOTE The zlib levels, from 1 (fastest) to 9 (smallest), -1 is the default one
+    void setCompressionLevel(int level);
+    int compressionLevel() const;
+
     void addFile(const std::string& fileName, const ByteArray& data);
+
+    //! NOTE Copies the entry of the source container without recompressing it,
+    //! if it holds the same data and is compressed as the policy requires.
+    //! Returns false and adds nothing otherwise, then the file is to be added
+    bool addUnchangedFile(const ZipContainer& source, const std::string& fileName, const ByteArray& data);
+
     void addDirectory(const std::string& dirName);
 
 private:
@@ -20,7 +20,11 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 #include "textstream.h"
-#include <sstream>
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
 
 using namespace mu;
 
@@ -44,70 +48,70 @@ void TextStream::setDevice(io::IODevice* device)
 void TextStream::flush()
 {
     if (m_device && m_device->isOpen()) {
-        m_device->write(m_buf);
+        m_device->write(reinterpret_cast<const uint8_t*>(m_buf.data()), m_buf.size());
         m_buf.clear();
     }
 }
 
+template<typename T>
+void TextStream::writeInteger(T val)
+{
+    char buf[24];
+    std::to_chars_result res = std::to_chars(buf, buf + sizeof(buf), val);
+    write(buf, res.ptr - buf);
+}
+
 TextStream& TextStream::operator<<(char ch)
 {
-    write(&ch, 1);
+    m_buf.push_back(ch);
+    flushIfFull();
     return *this;
 }
 
 TextStream& TextStream::operator<<(int val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    writeInteger(val);
     return *this;
 }
 
 TextStream& TextStream::operator<<(unsigned int val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    writeInteger(val);
     return *this;
 }
 
 TextStream& TextStream::operator<<(double val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    // the same as the default formatting of streams
+    char buf[32];
+    int len = std::snprintf(buf, sizeof(buf), "%g", val);
+    if (len > 0) {
+        write(buf, std::min(static_cast<size_t>(len), sizeof(buf) - 1));
+    }
     return *this;
 }
 
 TextStream& TextStream::operator<<(signed long int val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    writeInteger(val);
     return *this;
 }
 
 TextStream& TextStream::operator<<(unsigned long int val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    writeInteger(val);
     return *this;
 }
 
 TextStream& TextStream::operator<<(signed long long val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    writeInteger(val);
     return *this;
 }
 
 TextStream& TextStream::operator<<(unsigned long long val)
 {
-    std::stringstream ss;
-    ss << val;
-    write(ss.str().c_str(), ss.str().size());
+    writeInteger(val);
     return *this;
 }
 
@@ -147,14 +151,20 @@ TextStream& TextStream::operator<<(const AsciiStringView& s)
 
 TextStream& TextStream::operator<<(const String& s)
 {
-    ByteArray b = s.toUtf8();
-    write(reinterpret_cast<const char*>(b.constData()), b.size());
+    // encoded right into the buffer
+    s.toUtf8(m_buf);
+    flushIfFull();
     return *this;
 }
 
 void TextStream::write(const char* ch, size_t len)
 {
-    m_buf.push_back(reinterpret_cast<const uint8_t*>(ch), len);
+    m_buf.append(ch, len);
+    flushIfFull();
+}
+
+void TextStream::flushIfFull()
+{
     if (m_device && m_buf.size() > TEXTSTREAM_BUFFERSIZE) {
         flush();
     }
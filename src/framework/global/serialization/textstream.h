@@ -22,6 +22,8 @@
 #ifndef MU_GLOBAL_TEXTSTREAM_H
 #define MU_GLOBAL_TEXTSTREAM_H
 
+#include <string>
+
 #include "io/iodevice.h"
 #include "types/bytearray.h"
 #include "types/string.h"
@@ -60,10 +62,16 @@ public:
     TextStream& operator<<(const QString& s);
 #endif
 
-private:
     void write(const char* ch, size_t len);
+
+private:
+    template<typename T>
+    void writeInteger(T val);
+
+    void flushIfFull();
+
     io::IODevice* m_device = nullptr;
-    ByteArray m_buf;
+    std::string m_buf; // reused between the flushes
 };
 }
 
@@ -36,8 +36,26 @@ struct XmlStreamReader::Xml {
     XMLNode* node = nullptr;
     XMLError err;
     String customErr;
+
+    const XMLNode* tokenNode = nullptr;
+    int nameToken = XmlStreamReader::TokenTable::NoToken;
 };
 
+//---------------------------------------------------------
+//   TokenTable
+//---------------------------------------------------------
+
+void XmlStreamReader::TokenTable::add(const AsciiStringView& name, int token)
+{
+    m_tokens.emplace(std::string_view(name.ascii(), name.size()), token);
+}
+
+int XmlStreamReader::TokenTable::token(const AsciiStringView& name) const
+{
+    auto it = m_tokens.find(std::string_view(name.ascii(), name.size()));
+    return it != m_tokens.end() ? it->second : NoToken;
+}
+
 XmlStreamReader::XmlStreamReader()
 {
     m_xml = new Xml();
@@ -46,8 +64,17 @@ XmlStreamReader::XmlStreamReader()
 XmlStreamReader::XmlStreamReader(IODevice* device)
 {
     m_xml = new Xml();
-    ByteArray data = device->readAll();
-    setData(data);
+
+    IF_ASSERT_FAILED(device->isReadable()) {
+        setData(ByteArray());
+        return;
+    }
+
+    //! NOTE The devices keep their data in memory, so it's parsed in place instead of being read into a copy
+    size_t pos = device->pos();
+    size_t size = device->size();
+    setData(device->readData() + pos, size - pos);
+    device->seek(size);
 }
 
 XmlStreamReader::XmlStreamReader(const ByteArray& data)
@@ -72,9 +99,16 @@ XmlStreamReader::~XmlStreamReader()
 }
 
 void XmlStreamReader::setData(const ByteArray& data)
+{
+    setData(data.constData(), data.size());
+}
+
+void XmlStreamReader::setData(const uint8_t* data, size_t size)
 {
     m_xml->doc.Clear();
-    m_xml->err = m_xml->doc.Parse(reinterpret_cast<const char*>(data.constData()), data.size());
+    m_xml->node = nullptr;
+    m_xml->tokenNode = nullptr;
+    m_xml->err = m_xml->doc.Parse(reinterpret_cast<const char*>(data), size);
     m_token = m_xml->err == XML_SUCCESS ? TokenType::NoToken : TokenType::Invalid;
     m_xml->customErr.clear();
 
@@ -83,6 +117,17 @@ void XmlStreamReader::setData(const ByteArray& data)
     }
 }
 
+void XmlStreamReader::setTokenTable(const TokenTable* table)
+{
+    m_tokenTable = table;
+    m_xml->tokenNode = nullptr;
+}
+
+const XmlStreamReader::TokenTable* XmlStreamReader::tokenTable() const
+{
+    return m_tokenTable;
+}
+
 bool XmlStreamReader::readNextStartElement()
 {
     while (readNext() != Invalid) {
@@ -248,6 +293,33 @@ AsciiStringView XmlStreamReader::name() const
     return (m_xml->node && m_xml->node->ToElement()) ? m_xml->node->Value() : AsciiStringView();
 }
 
+int XmlStreamReader::nameToken() const
+{
+    if (!m_tokenTable || !m_xml->node || !m_xml->node->ToElement()) {
+        return TokenTable::NoToken;
+    }
+
+    if (m_xml->tokenNode != m_xml->node) {
+        m_xml->tokenNode = m_xml->node;
+        m_xml->nameToken = m_tokenTable->token(m_xml->node->Value());
+    }
+    return m_xml->nameToken;
+}
+
+int XmlStreamReader::nameToken(const AsciiStringView& name) const
+{
+    if (!m_tokenTable) {
+        return TokenTable::NoToken;
+    }
+
+    // mostly it's the name of the current element, taken from the reader
+    AsciiStringView currentName = this->name();
+    if (name.ascii() == currentName.ascii() && name.size() == currentName.size()) {
+        return nameToken();
+    }
+    return m_tokenTable->token(name);
+}
+
 bool XmlStreamReader::hasAttribute(const char* name) const
 {
     if (m_token != TokenType::StartElement) {
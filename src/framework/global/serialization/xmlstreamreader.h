@@ -25,6 +25,8 @@
 #include <vector>
 #include <list>
 #include <map>
+#include <string_view>
+#include <unordered_map>
 
 #include "io/iodevice.h"
 #include "types/bytearray.h"
@@ -66,6 +68,21 @@ public:
         String value;
     };
 
+    //! NOTE Maps the names of elements to integer tokens,
+    //! so that a reader can dispatch on them instead of comparing strings.
+    //! Filled once and then shared between the readers, the names must outlive it
+    class TokenTable
+    {
+    public:
+        static constexpr int NoToken = -1;
+
+        void add(const AsciiStringView& name, int token);
+        int token(const AsciiStringView& name) const;
+
+    private:
+        std::unordered_map<std::string_view, int> m_tokens;
+    };
+
     XmlStreamReader();
     explicit XmlStreamReader(io::IODevice* device);
     explicit XmlStreamReader(const ByteArray& data);
@@ -78,6 +95,10 @@ public:
     XmlStreamReader& operator=(const XmlStreamReader&) = delete;
 
     void setData(const ByteArray& data);
+    void setData(const uint8_t* data, size_t size);
+
+    void setTokenTable(const TokenTable* table);
+    const TokenTable* tokenTable() const;
 
     bool readNextStartElement();
     bool atEnd() const;
@@ -94,6 +115,10 @@ public:
     bool isWhitespace() const;
 
     AsciiStringView name() const;
+    //! NOTE Token of the current element name, looked up once per element
+    int nameToken() const;
+    //! NOTE Token of the given name, cached if it's the name of the current element
+    int nameToken(const AsciiStringView& name) const;
 
     bool hasAttribute(const char* name) const;
     String attribute(const char* name) const;
@@ -128,6 +153,7 @@ private:
 
     Xml* m_xml = nullptr;
     TokenType m_token = TokenType::NoToken;
+    const TokenTable* m_tokenTable = nullptr;
 
     std::map<String, String> m_entities;
 };
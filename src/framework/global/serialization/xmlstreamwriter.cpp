@@ -21,7 +21,9 @@
  */
 #include "xmlstreamwriter.h"
 
-#include "containers.h"
+#include <algorithm>
+#include <cstring>
+
 #include "textstream.h"
 
 #include "log.h"
@@ -29,16 +31,61 @@
 using namespace mu;
 
 struct XmlStreamWriter::Impl {
-    std::list<std::string> stack;
+    std::vector<std::string> stack;
     TextStream stream;
+    std::string utf8; // reused for the values to escape
 
     void putLevel()
     {
-        size_t level = stack.size();
-        for (size_t i = 0; i < level * 2; ++i) {
-            stream << ' ';
+        static const char SPACES[] = "                                                                ";
+        size_t count = stack.size() * 2;
+        while (count > 0) {
+            size_t n = std::min(count, sizeof(SPACES) - 1);
+            stream.write(SPACES, n);
+            count -= n;
         }
     }
+
+    //! NOTE The same as String::toXmlEscaped, but on UTF-8 and right into the stream,
+    //! the escaped characters are all ASCII, so the multibyte sequences are kept as is
+    void putEscaped(const char* s, size_t len)
+    {
+        size_t run = 0;
+        for (size_t i = 0; i < len; ++i) {
+            const char* replacement = nullptr;
+            unsigned char c = static_cast<unsigned char>(s[i]);
+            switch (c) {
+            case '<': replacement = "&lt;";
+                break;
+            case '>': replacement = "&gt;";
+                break;
+            case '&': replacement = "&amp;";
+                break;
+            case '\"': replacement = "&quot;";
+                break;
+            default:
+                // invalid characters in xml 1.0 are dropped
+                if (c < 0x20 && c != 0x09 && c != 0x0A && c != 0x0D) {
+                    replacement = "";
+                }
+                break;
+            }
+
+            if (replacement) {
+                stream.write(s + run, i - run);
+                stream << replacement;
+                run = i + 1;
+            }
+        }
+        stream.write(s + run, len - run);
+    }
+
+    void putEscaped(const String& s)
+    {
+        utf8.clear();
+        s.toUtf8(utf8);
+        putEscaped(utf8.data(), utf8.size());
+    }
 };
 
 XmlStreamWriter::XmlStreamWriter()
@@ -114,11 +161,15 @@ void XmlStreamWriter::writeValue(const Value& v)
         break;
     case 7: m_impl->stream << std::get<double>(v);
         break;
-    case 8: m_impl->stream << escapeString(AsciiStringView(std::get<const char*>(v)));
-        break;
-    case 9: m_impl->stream << escapeString(std::get<AsciiStringView>(v));
-        break;
-    case 10: m_impl->stream << escapeString(std::get<String>(v));
+    case 8: {
+        const char* s = std::get<const char*>(v);
+        m_impl->putEscaped(s, s ? std::strlen(s) : 0);
+    } break;
+    case 9: {
+        const AsciiStringView& s = std::get<AsciiStringView>(v);
+        m_impl->putEscaped(s.ascii(), s.size());
+    } break;
+    case 10: m_impl->putEscaped(std::get<String>(v));
         break;
     default:
         LOGI() << "index: " << v.index();
@@ -159,8 +210,13 @@ void XmlStreamWriter::startElementRaw(const String& name)
 void XmlStreamWriter::endElement()
 {
     m_impl->putLevel();
-    m_impl->stream << "</" << mu::takeLast(m_impl->stack) << '>' << '\n';
-    flush();
+    m_impl->stream << "</" << m_impl->stack.back() << '>' << '\n';
+    m_impl->stack.pop_back();
+
+    //! NOTE The stream buffers the document, it's passed to the device as soon as it's complete
+    if (m_impl->stack.empty()) {
+        flush();
+    }
 }
 
 // <element attr="value" />
@@ -22,12 +22,14 @@
 #ifndef MU_GLOBAL_ZIPREADER_H
 #define MU_GLOBAL_ZIPREADER_H
 
+#include <functional>
 #include <vector>
 
 #include "io/path.h"
 #include "io/iodevice.h"
 
 namespace mu {
+class ZipContainer;
 class ZipReader
 {
 public:
@@ -54,7 +56,15 @@ public:
     std::vector<FileInfo> fileInfoList() const;
     ByteArray fileData(const std::string& fileName) const;
 
+    //! NOTE Passes the data chunk by chunk while it's inflated, the handler returns false to stop reading
+    using DataHandler = std::function<bool (const uint8_t* data, size_t len)>;
+    bool fileData(const std::string& fileName, const DataHandler& onData) const;
+
 private:
+    friend class ZipWriter;
+
+    const ZipContainer* container() const;
+
     struct Impl;
     Impl* m_impl = nullptr;
     io::path_t m_filePath;
@@ -21,6 +21,7 @@
  */
 #include "zipwriter.h"
 
+#include "zipreader.h"
 #include "internal/zipcontainer.h"
 #include "io/file.h"
 
@@ -89,8 +90,28 @@ bool ZipWriter::hasError() const
     return m_impl->zip->status() != ZipContainer::NoError;
 }
 
+void ZipWriter::setCompressionEnabled(bool enabled)
+{
+    m_impl->zip->setCompressionPolicy(enabled ? ZipContainer::AlwaysCompress : ZipContainer::NeverCompress);
+}
+
+void ZipWriter::setCompressionLevel(int level)
+{
+    m_impl->zip->setCompressionLevel(level);
+}
+
 void ZipWriter::addFile(const std::string& fileName, const ByteArray& data)
 {
     m_impl->zip->addFile(fileName, data);
     flush();
 }
+
+bool ZipWriter::addUnchangedFile(const ZipReader& source, const std::string& fileName, const ByteArray& data)
+{
+    if (!m_impl->zip->addUnchangedFile(*source.container(), fileName, data)) {
+        return false;
+    }
+
+    flush();
+    return true;
+}
@@ -26,6 +26,7 @@
 #include "io/iodevice.h"
 
 namespace mu {
+class ZipReader;
 class ZipWriter
 {
 public:
@@ -37,8 +38,19 @@ public:
     void close();
     bool hasError() const;
 
+    //! NOTE The files are always compressed by default
+    void setCompressionEnabled(bool enabled);
+
+    //! NOTE The zlib levels, from 1 (fastest) to 9 (smallest), -1 is the default one.
+    //! The files are deflated in parallel, the large ones split into blocks
+    void setCompressionLevel(int level);
+
     void addFile(const std::string& fileName, const ByteArray& data);
 
+    //! NOTE Copies the file from the source as it's compressed there, if the data is the same,
+    //! returns false if it isn't, then the file is to be added with addFile
+    bool addUnchangedFile(const ZipReader& source, const std::string& fileName, const ByteArray& data);
+
 private:
 
     void flush();
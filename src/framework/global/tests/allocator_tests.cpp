@@ -202,3 +202,62 @@ TEST_F(Global_AllocatorTests, Many_NewCleanup)
     EXPECT_EQ(info.totalChunks, 12); // DEFAULT_BLOCK_SIZE * 3
     EXPECT_EQ(info.freeChunks, 12);
 }
+
+TEST_F(Global_AllocatorTests, Many_NewDeleteReleaseFreeBlocks)
+{
+    //! GIVEN the default size of the allocator block is less than the size of all items
+    size_t itemSize = sizeof(Item13);
+    ObjectAllocator::DEFAULT_BLOCK_SIZE = itemSize * 4;  // bytes
+
+    //! GIVEN Item created while the allocator is disabled
+    int used = ObjectAllocator::used.exchange(0);
+    ItemBase* heapItem = new Item13(100);
+    ObjectAllocator::used = used;
+
+    //! DO Create Items (more then one block size)
+    std::vector<ItemBase*> items;
+    for (size_t i = 0; i < 10; ++i) {
+        items.push_back(new Item13(static_cast<uint8_t>(i)));
+    }
+
+    //! CHECK Allocator state
+    ObjectAllocator::Info info = Item13::allocator().stateInfo();
+    EXPECT_EQ(info.blockCount, 3);
+    EXPECT_EQ(info.freeChunks, 2);
+
+    //! DO Destroy the item not taken from the allocator
+    delete heapItem;
+
+    //! CHECK Allocator state is not changed
+    info = Item13::allocator().stateInfo();
+    EXPECT_EQ(info.freeChunks, 2);
+
+    //! DO Destroy all items except the two last
+    for (size_t i = 0; i < 8; ++i) {
+        delete items.at(i);
+    }
+
+    //! DO Release free blocks
+    size_t releasedBytes = Item13::allocator().releaseFreeBlocks();
+
+    //! CHECK Only the blocks without used chunks are released
+    EXPECT_EQ(releasedBytes, itemSize * 8);
+    info = Item13::allocator().stateInfo();
+    EXPECT_EQ(info.blockCount, 1);
+    EXPECT_EQ(info.totalChunks, 4);
+    EXPECT_EQ(info.freeChunks, 2);
+
+    //! CHECK The remaining items are alive
+    EXPECT_TRUE(items.at(8)->alive());
+    EXPECT_TRUE(items.at(9)->alive());
+
+    //! DO Destroy the remaining items and release free blocks
+    delete items.at(8);
+    delete items.at(9);
+    Item13::allocator().releaseFreeBlocks();
+
+    //! CHECK Allocator state
+    info = Item13::allocator().stateInfo();
+    EXPECT_EQ(info.blockCount, 0);
+    EXPECT_EQ(info.freeChunks, 0);
+}
@@ -0,0 +1,183 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "thirdparty/haw_logger/logger/asynclogdest.h"
+
+using namespace haw::logger;
+
+class Global_AsyncLogDestTests : public ::testing::Test
+{
+public:
+};
+
+namespace {
+struct CapturedMessages {
+    std::mutex mutex;
+    std::vector<LogMsg> messages;
+
+    size_t size()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return messages.size();
+    }
+};
+
+class CapturingLogDest : public LogDest
+{
+public:
+    explicit CapturingLogDest(CapturedMessages& captured)
+        : LogDest(LogLayout("${message}")), m_captured(captured) {}
+
+    std::string name() const override { return "CapturingLogDest"; }
+
+    void write(const LogMsg& logMsg) override
+    {
+        std::lock_guard<std::mutex> lock(m_captured.mutex);
+        m_captured.messages.push_back(logMsg);
+    }
+
+private:
+    CapturedMessages& m_captured;
+};
+
+LogMsg siteMessage(const Type& type, const std::string& message, int line)
+{
+    LogMsg msg(type, "Test", message);
+    msg.file = __FILE__;
+    msg.line = line;
+    return msg;
+}
+}
+
+TEST_F(Global_AsyncLogDestTests, WritesThreadsInLoggedOrder)
+{
+    //! GIVE A destination written by several threads
+    CapturedMessages captured;
+    AsyncLogDest dest({ new CapturingLogDest(captured) });
+
+    const int threadCount = 4;
+    const int messagesPerThread = 40;
+
+    //! DO Every thread logs a sequence of numbered messages
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&dest, t]() {
+            for (int i = 0; i < messagesPerThread; ++i) {
+                dest.write(LogMsg(Logger::INFO, "Test", std::to_string(t) + ":" + std::to_string(i)));
+            }
+        });
+    }
+
+    for (std::thread& th : threads) {
+        th.join();
+    }
+
+    dest.flush();
+
+    //! CHECK All the messages are written and the messages of each thread keep their order
+    ASSERT_EQ(captured.messages.size(), size_t(threadCount * messagesPerThread));
+
+    std::vector<int> next(threadCount, 0);
+    for (const LogMsg& msg : captured.messages) {
+        size_t sep = msg.message.find(':');
+        int t = std::stoi(msg.message.substr(0, sep));
+        int i = std::stoi(msg.message.substr(sep + 1));
+        EXPECT_EQ(i, next[t]);
+        next[t] = i + 1;
+    }
+}
+
+TEST_F(Global_AsyncLogDestTests, ErrorsAreNotRateLimited)
+{
+    //! GIVE A destination
+    CapturedMessages captured;
+    AsyncLogDest dest({ new CapturingLogDest(captured) });
+
+    const size_t count = AsyncLogDest::MAX_MESSAGES_PER_SITE_PER_SECOND * 2;
+
+    //! DO Log more than the rate limit from one warning site and one error site
+    for (size_t i = 0; i < count; ++i) {
+        dest.write(siteMessage(Logger::WARN, "warning", 1));
+        dest.write(siteMessage(Logger::ERRR, "error", 2));
+    }
+
+    dest.flush();
+
+    //! CHECK The warnings are limited, the errors are all written
+    size_t warnings = 0;
+    size_t errors = 0;
+    for (const LogMsg& msg : captured.messages) {
+        if (msg.message == "warning") {
+            ++warnings;
+        } else if (msg.message == "error") {
+            ++errors;
+        }
+    }
+
+    EXPECT_EQ(warnings, AsyncLogDest::MAX_MESSAGES_PER_SITE_PER_SECOND);
+    EXPECT_EQ(errors, count);
+}
+
+TEST_F(Global_AsyncLogDestTests, ErrorsAreWrittenSynchronously)
+{
+    //! GIVE A destination with some buffered messages
+    CapturedMessages captured;
+    AsyncLogDest dest({ new CapturingLogDest(captured) });
+
+    dest.write(LogMsg(Logger::INFO, "Test", "info"));
+
+    //! DO Log an error
+    dest.write(LogMsg(Logger::ERRR, "Test", "error"));
+
+    //! CHECK The error and everything logged before it are written before write() returns
+    ASSERT_EQ(captured.size(), 2u);
+    EXPECT_EQ(captured.messages[0].message, "info");
+    EXPECT_EQ(captured.messages[1].message, "error");
+}
+
+TEST_F(Global_AsyncLogDestTests, LongMessagesAreWrittenWhole)
+{
+    //! GIVE A destination
+    CapturedMessages captured;
+    AsyncLogDest dest({ new CapturingLogDest(captured) });
+
+    //! DO Log messages over the reserved size, then a short one into the same records
+    const size_t ringCapacity = AsyncLogDest::RING_CAPACITY;
+    std::string longMessage(AsyncLogDest::RESERVED_MESSAGE_SIZE * 4, 'x');
+    for (size_t i = 0; i < ringCapacity; ++i) {
+        dest.write(LogMsg(Logger::INFO, "Test", longMessage));
+    }
+    dest.flush();
+
+    dest.write(LogMsg(Logger::INFO, "Test", "short"));
+    dest.flush();
+
+    //! CHECK The records hold exactly what was pushed into them
+    ASSERT_EQ(captured.messages.size(), ringCapacity + 1);
+    EXPECT_EQ(captured.messages.front().message, longMessage);
+    EXPECT_EQ(captured.messages.back().message, "short");
+}
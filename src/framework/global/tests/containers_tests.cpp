@@ -22,6 +22,8 @@
 #include <gtest/gtest.h>
 
 #include "containers.h"
+#include "types/sharedmap.h"
+#include "types/sharedhashmap.h"
 
 using namespace mu;
 
@@ -61,3 +63,26 @@ TEST_F(Global_Types_ContainersTests, FindLessOrEqual)
     // [THEN] Return cend()
     EXPECT_EQ(it, map.cend());
 }
+
+TEST_F(Global_Types_ContainersTests, SharedMaps_Empty_Detach)
+{
+    // [GIVEN] Default constructed maps, which share the empty data
+    SharedMap<int, std::string> map1;
+    SharedMap<int, std::string> map2;
+    SharedHashMap<int, std::string> hashMap1;
+    SharedHashMap<int, std::string> hashMap2;
+
+    // [WHEN] One map of each kind is changed
+    map1[1] = "value 1";
+    hashMap1.insert({ 1, "value 1" });
+
+    // [THEN] The other maps are still empty
+    EXPECT_EQ(map1.size(), 1);
+    EXPECT_TRUE(map2.empty());
+    EXPECT_EQ(hashMap1.size(), 1);
+    EXPECT_TRUE(hashMap2.empty());
+
+    // [THEN] A new map is empty as well
+    EXPECT_TRUE((SharedMap<int, std::string>().empty()));
+    EXPECT_TRUE((SharedHashMap<int, std::string>().empty()));
+}
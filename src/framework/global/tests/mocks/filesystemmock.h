@@ -42,6 +42,9 @@ public:
     MOCK_METHOD(bool, readFile, (const io::path_t& filePath, ByteArray & data), (const, override));
     MOCK_METHOD(Ret, writeFile, (const io::path_t& filePath, const ByteArray& data), (const, override));
 
+    MOCK_METHOD(const uint8_t*, mapFile, (const io::path_t& filePath, size_t & size), (const, override));
+    MOCK_METHOD(void, unmapFile, (const uint8_t* data), (const, override));
+
     MOCK_METHOD(Ret, makePath, (const io::path_t&), (const, override));
 
     MOCK_METHOD(RetVal<io::paths_t>, scanFiles, (const io::path_t&, const std::vector<std::string>&, ScanMode), (const, override));
@@ -131,6 +131,21 @@ TEST_F(Global_Types_StringTests, String_Convert)
         EXPECT_EQ(qstr, qstr_origin);
     }
 
+    {
+        //! GIVEN Some String
+        String str(u"123abcПыф");
+        //! DO without copy
+        QString qstr = str.toQStringNoCopy();
+        //! CHECK
+        EXPECT_EQ(qstr, QString("123abcПыф"));
+
+        //! CHECK Compare with QString
+        EXPECT_TRUE(str == QString("123abcПыф"));
+        EXPECT_FALSE(str == QString("123abcПы"));
+        EXPECT_FALSE(str == QString("123abcПыx"));
+        EXPECT_TRUE(String() == QString());
+    }
+
     {
         //! GIVEN Some std::string
         std::string sstr_origin = "123abcПыф";
@@ -0,0 +1,121 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "concurrency/taskscheduler.h"
+
+using namespace mu;
+
+class Global_Concurrency_TaskSchedulerTests : public ::testing::Test
+{
+public:
+};
+
+TEST_F(Global_Concurrency_TaskSchedulerTests, OneWorkerRunsTasksInOrder)
+{
+    //! GIVE A scheduler with one worker
+    TaskScheduler scheduler(1);
+    std::vector<int> order;
+
+    //! DO Push the tasks from this thread
+    for (int i = 0; i < 100; ++i) {
+        scheduler.push([&order, i]() { order.push_back(i); });
+    }
+    scheduler.waitForAllTasksComplete();
+
+    //! CHECK They are run in the order they were pushed
+    ASSERT_EQ(order.size(), 100u);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(order[i], i);
+    }
+}
+
+TEST_F(Global_Concurrency_TaskSchedulerTests, Submit)
+{
+    TaskScheduler scheduler(2);
+
+    std::future<int> result = scheduler.submit([](int a, int b) { return a + b; }, 2, 3);
+    std::future<int> prioritized = scheduler.submitWithPriority(TaskPriority::Realtime, []() { return 7; });
+
+    EXPECT_EQ(result.get(), 5);
+    EXPECT_EQ(prioritized.get(), 7);
+}
+
+TEST_F(Global_Concurrency_TaskSchedulerTests, ParallelFor)
+{
+    //! GIVE
+    TaskScheduler scheduler(4);
+    std::vector<std::atomic<int> > visits(1000);
+
+    //! DO Nested in the tasks of a group, so the workers also wait for their own loops
+    TaskGroup group(&scheduler);
+    for (int task = 0; task < 10; ++task) {
+        group.run([&scheduler, &visits]() {
+            scheduler.parallelFor(0, visits.size(), [&visits](size_t i) { ++visits[i]; }, 7);
+        });
+    }
+    group.wait();
+
+    //! CHECK Each index is visited once per loop
+    for (const std::atomic<int>& v : visits) {
+        EXPECT_EQ(v.load(), 10);
+    }
+}
+
+TEST_F(Global_Concurrency_TaskSchedulerTests, ParallelForRethrows)
+{
+    TaskScheduler scheduler(2);
+
+    EXPECT_THROW(scheduler.parallelFor(0, 100, [](size_t i) {
+        if (i == 42) {
+            throw std::runtime_error("failed");
+        }
+    }), std::runtime_error);
+}
+
+TEST_F(Global_Concurrency_TaskSchedulerTests, CancelledGroupSkipsTasks)
+{
+    //! GIVE A worker busy until the group is cancelled
+    TaskScheduler scheduler(1);
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    scheduler.push([released]() { released.wait(); });
+
+    std::atomic<int> runCount = 0;
+    TaskGroup group(&scheduler);
+    for (int i = 0; i < 10; ++i) {
+        group.run([&runCount]() { ++runCount; });
+    }
+
+    //! DO
+    group.cancel();
+    release.set_value();
+    group.wait();
+
+    //! CHECK
+    EXPECT_TRUE(group.isCancelled());
+    EXPECT_EQ(runCount.load(), 0);
+}
@@ -0,0 +1,166 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "io/buffer.h"
+#include "serialization/zipreader.h"
+#include "serialization/zipwriter.h"
+
+using namespace mu;
+using namespace mu::io;
+
+class Global_Serialization_ZipTests : public ::testing::Test
+{
+public:
+};
+
+static ByteArray makeData(const std::string& text, size_t repeat)
+{
+    std::string data;
+    for (size_t i = 0; i < repeat; ++i) {
+        data += text;
+    }
+    return ByteArray(data.c_str(), data.size());
+}
+
+TEST_F(Global_Serialization_ZipTests, AddUnchangedFile)
+{
+    //! GIVEN Zip with two files
+    ByteArray unchanged = makeData("<Note><pitch>60</pitch></Note>\n", 1000);
+    ByteArray changed = makeData("<Rest/>\n", 1000);
+
+    ByteArray previousData;
+    {
+        Buffer buf(&previousData);
+        buf.open(IODevice::WriteOnly);
+        ZipWriter zip(&buf);
+        zip.addFile("unchanged.mscx", unchanged);
+        zip.addFile("changed.mscx", changed);
+        zip.close();
+    }
+
+    //! DO Write new zip, copying the files from the previous one if they are the same
+    ByteArray newChanged = makeData("<Chord/>\n", 1000);
+
+    ByteArray newData;
+    {
+        Buffer previousBuf(&previousData);
+        previousBuf.open(IODevice::ReadOnly);
+        ZipReader previous(&previousBuf);
+
+        Buffer buf(&newData);
+        buf.open(IODevice::WriteOnly);
+        ZipWriter zip(&buf);
+
+        EXPECT_TRUE(zip.addUnchangedFile(previous, "unchanged.mscx", unchanged));
+        EXPECT_FALSE(zip.addUnchangedFile(previous, "changed.mscx", newChanged));
+        zip.addFile("changed.mscx", newChanged);
+        EXPECT_FALSE(zip.addUnchangedFile(previous, "missing.mscx", unchanged));
+
+        zip.close();
+        EXPECT_FALSE(zip.hasError());
+    }
+
+    //! CHECK
+    Buffer buf(&newData);
+    buf.open(IODevice::ReadOnly);
+    ZipReader zip(&buf);
+
+    EXPECT_EQ(zip.fileInfoList().size(), 2);
+    EXPECT_EQ(zip.fileData("unchanged.mscx"), unchanged);
+    EXPECT_EQ(zip.fileData("changed.mscx"), newChanged);
+}
+
+TEST_F(Global_Serialization_ZipTests, AddUnchangedFile_OtherCompression)
+{
+    //! GIVEN Compressed zip
+    ByteArray data = makeData("<Note><pitch>60</pitch></Note>\n", 100);
+
+    ByteArray previousData;
+    {
+        Buffer buf(&previousData);
+        buf.open(IODevice::WriteOnly);
+        ZipWriter zip(&buf);
+        zip.addFile("score.mscx", data);
+        zip.close();
+    }
+
+    //! DO Write uncompressed zip
+    Buffer previousBuf(&previousData);
+    previousBuf.open(IODevice::ReadOnly);
+    ZipReader previous(&previousBuf);
+
+    ByteArray newData;
+    Buffer buf(&newData);
+    buf.open(IODevice::WriteOnly);
+    ZipWriter zip(&buf);
+    zip.setCompressionEnabled(false);
+
+    //! CHECK The compressed file isn't copied
+    EXPECT_FALSE(zip.addUnchangedFile(previous, "score.mscx", data));
+}
+
+TEST_F(Global_Serialization_ZipTests, AddFile_LargeAndSmall)
+{
+    //! GIVEN Files larger than a deflate block, and small ones
+    ByteArray large;
+    for (size_t i = 0; i < 300000; ++i) {
+        std::string line = "<Note><pitch>" + std::to_string(i % 128) + "</pitch></Note>\n";
+        large.push_back(reinterpret_cast<const uint8_t*>(line.c_str()), line.size());
+    }
+    ByteArray small = makeData("<Rest/>\n", 10);
+
+    for (int level : { 1, -1, 9 }) {
+        //! DO Write them
+        ByteArray zipData;
+        {
+            Buffer buf(&zipData);
+            buf.open(IODevice::WriteOnly);
+            ZipWriter zip(&buf);
+            zip.setCompressionLevel(level);
+            zip.addFile("small1.mscx", small);
+            zip.addFile("large.mscx", large);
+            zip.addFile("small2.mscx", small);
+            zip.close();
+            EXPECT_FALSE(zip.hasError());
+        }
+
+        //! CHECK They are read in order and compressed
+        EXPECT_LT(zipData.size(), large.size() / 4);
+
+        Buffer buf(&zipData);
+        buf.open(IODevice::ReadOnly);
+        ZipReader zip(&buf);
+
+        std::vector<ZipReader::FileInfo> files = zip.fileInfoList();
+        ASSERT_EQ(files.size(), 3);
+        EXPECT_EQ(files.at(0).filePath, "small1.mscx");
+        EXPECT_EQ(files.at(1).filePath, "large.mscx");
+        EXPECT_EQ(files.at(2).filePath, "small2.mscx");
+
+        EXPECT_EQ(zip.fileData("small1.mscx"), small);
+        EXPECT_EQ(zip.fileData("large.mscx"), large);
+        EXPECT_EQ(zip.fileData("small2.mscx"), small);
+    }
+}
@@ -27,9 +27,19 @@ public:
 
     void send(const T&... d)
     {
+        //! NOTE Fast path, nobody receives, no need to pack the data
+        if (!m_ptr || !m_ptr->hasCallBacks(Receive)) {
+            if (m_ptr) {
+                m_ptr->countSend();
+            }
+            return;
+        }
+
         NotifyData nd;
-        nd.setArg<T...>(0, d ...);
-        ptr()->invoke(Receive, nd);
+        if constexpr (sizeof...(T) > 0) {
+            nd.setArg<T...>(0, d ...);
+        }
+        m_ptr->invoke(Receive, nd);
     }
 
     template<typename Func>
@@ -59,6 +69,24 @@ public:
         return m_ptr && ptr()->isConnected();
     }
 
+    //! NOTE For the channels of a latest value, ex a position: a send to a receiver on another thread
+    //! replaces the delivery still queued for it, instead of being queued after it
+    void setCoalescing(bool arg)
+    {
+        ptr()->setCoalescing(arg);
+    }
+
+    //! NOTE The named channels are listed by namedStats()
+    void setDebugName(const std::string& name)
+    {
+        ptr()->setDebugName(name);
+    }
+
+    InvokerStats stats() const
+    {
+        return ptr()->stats();
+    }
+
 private:
 
     enum CallType {
@@ -77,7 +105,14 @@ private:
         Call f;
         ReceiveCall(Call _f)
             : f(_f) {}
-        void received(const NotifyData& d) { std::apply(f, d.args<Arg...>()); }
+        void received(const NotifyData& d)
+        {
+            if constexpr (sizeof...(Arg) == 0) {
+                f();
+            } else {
+                std::apply(f, d.args<Arg...>());
+            }
+        }
     };
 
     struct IClose {
@@ -1,17 +1,28 @@
 #include "abstractinvoker.h"
 
 #include <cassert>
+#include <set>
 
 #include "queuedinvoker.h"
 
 using namespace deto::async;
 
+static std::mutex s_namedMutex;
+static std::set<AbstractInvoker*> s_named;
+
 AbstractInvoker::AbstractInvoker()
 {
 }
 
 AbstractInvoker::~AbstractInvoker()
 {
+    {
+        std::lock_guard<std::mutex> lock(s_namedMutex);
+        if (!m_debugName.empty()) {
+            s_named.erase(this);
+        }
+    }
+
     std::lock_guard<std::mutex> lock(m_qInvokersMutex);
     for (QInvoker* qi : m_qInvokers) {
         qi->invalidate();
@@ -25,13 +36,26 @@ void AbstractInvoker::invoke(int type)
 
 void AbstractInvoker::invoke(int type, const NotifyData& data)
 {
+    countSend();
+
     auto it = m_callbacks.find(type);
-    if (it == m_callbacks.end()) {
+    if (it == m_callbacks.end() || it->second.empty()) {
         return;
     }
 
     std::thread::id threadID = std::this_thread::get_id();
 
+    //! NOTE Fast path, a single receiver, no need to copy the collection
+    if (it->second.size() == 1) {
+        CallBack c = it->second.front();
+        if (c.threadID == threadID) {
+            invokeCallback(type, c, data);
+        } else {
+            invokeQueued(type, c, data);
+        }
+        return;
+    }
+
     //! NOTE: explicit copy because collection can be modified from elsewhere
     CallBacks callbacks = it->second;
 
@@ -43,15 +67,92 @@ void AbstractInvoker::invoke(int type, const NotifyData& data)
         if (c.threadID == threadID) {
             invokeCallback(type, c, data);
         } else {
-            QInvoker* qi = new QInvoker(this, type, c, data);
-            QueuedInvoker::instance()->invoke(c.threadID, [qi]() {
-                qi->invoke();
-                delete qi;
-            });
+            invokeQueued(type, c, data);
         }
     }
 }
 
+void AbstractInvoker::invokeQueued(int type, const CallBack& c, const NotifyData& data)
+{
+    if (m_coalescing && coalesceQueued(type, c, data)) {
+        ++m_coalescedCount;
+        return;
+    }
+
+    ++m_queuedCount;
+    QInvoker* qi = new QInvoker(this, type, c, data);
+    QueuedInvoker::instance()->invoke(c.threadID, [qi]() {
+        qi->invoke();
+        delete qi;
+    });
+}
+
+bool AbstractInvoker::coalesceQueued(int type, const CallBack& c, const NotifyData& data)
+{
+    std::lock_guard<std::mutex> lock(m_qInvokersMutex);
+    for (QInvoker* qi : m_qInvokers) {
+        if (qi->type != type || qi->call.call != c.call) {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> qiLock(qi->mutex);
+        if (!qi->started && qi->invoker) {
+            qi->data = data;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void AbstractInvoker::countSend()
+{
+    ++m_sendCount;
+}
+
+void AbstractInvoker::setCoalescing(bool arg)
+{
+    m_coalescing = arg;
+}
+
+void AbstractInvoker::setDebugName(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(s_namedMutex);
+    m_debugName = name;
+    if (m_debugName.empty()) {
+        s_named.erase(this);
+    } else {
+        s_named.insert(this);
+    }
+}
+
+InvokerStats AbstractInvoker::stats() const
+{
+    std::lock_guard<std::mutex> lock(s_namedMutex);
+    return statsLocked();
+}
+
+InvokerStats AbstractInvoker::statsLocked() const
+{
+    InvokerStats s;
+    s.name = m_debugName;
+    s.sendCount = m_sendCount;
+    s.queuedCount = m_queuedCount;
+    s.coalescedCount = m_coalescedCount;
+    return s;
+}
+
+std::vector<InvokerStats> AbstractInvoker::namedStats()
+{
+    std::lock_guard<std::mutex> lock(s_namedMutex);
+    std::vector<InvokerStats> result;
+    result.reserve(s_named.size());
+    for (const AbstractInvoker* invoker : s_named) {
+        result.push_back(invoker->statsLocked());
+    }
+    return result;
+}
+
 void AbstractInvoker::invokeCallback(int type, const CallBack& c, const NotifyData& data)
 {
     assert(c.threadID == std::this_thread::get_id());
@@ -98,6 +199,12 @@ int AbstractInvoker::CallBacks::receiverIndexOf(Asyncable* receiver) const
     return -1;
 }
 
+bool AbstractInvoker::hasCallBacks(int type) const
+{
+    auto it = m_callbacks.find(type);
+    return it != m_callbacks.end() && !it->second.empty();
+}
+
 bool AbstractInvoker::CallBacks::containsReceiver(Asyncable* receiver) const
 {
     return receiverIndexOf(receiver) > -1;
@@ -1,7 +1,10 @@
 #ifndef DETO_ASYNC_ABSTRACTINVOKER_H
 #define DETO_ASYNC_ABSTRACTINVOKER_H
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 #include <list>
 #include <iostream>
@@ -22,8 +25,7 @@ public:
     template<typename ... T>
     void setArg(int i, const T&... val)
     {
-        IArg* p = new Arg<T...>(val ...);
-        m_args.insert(m_args.begin() + i, std::shared_ptr<IArg>(p));
+        m_args.insert(m_args.begin() + i, std::make_shared<Arg<T...> >(val ...));
     }
 
     template<typename T>
@@ -63,6 +65,14 @@ private:
     std::vector<std::shared_ptr<IArg> > m_args;
 };
 
+//! NOTE Counters of an invoker, to find the chatty producers
+struct InvokerStats {
+    std::string name;
+    uint64_t sendCount = 0;         // all the sends, received or not
+    uint64_t queuedCount = 0;       // the deliveries queued to another thread
+    uint64_t coalescedCount = 0;    // the sends which replaced a delivery still queued
+};
+
 class QueuedInvoker;
 class AbstractInvoker : public Asyncable::IConnectable
 {
@@ -73,6 +83,16 @@ public:
     void invoke(int type, const NotifyData& data);
 
     bool isConnected() const;
+    bool hasCallBacks(int type) const;
+
+    void countSend();
+
+    void setCoalescing(bool arg);
+    void setDebugName(const std::string& name);
+    InvokerStats stats() const;
+
+    //! NOTE The stats of the invokers which have a debug name
+    static std::vector<InvokerStats> namedStats();
 
     static void processEvents();
     static void onMainThreadInvoke(const std::function<void(const std::function<void()>&, bool)>& f);
@@ -108,6 +128,7 @@ protected:
         int type = -1;
         CallBack call;
         NotifyData data;
+        bool started = false;
 
         QInvoker(AbstractInvoker* i, int t, CallBack c, NotifyData d)
             : invoker(i), type(t), call(c), data(d)
@@ -125,13 +146,16 @@ protected:
         void invoke()
         {
             AbstractInvoker* inv = nullptr;
+            NotifyData d;
             {
                 std::lock_guard<std::mutex> lock(mutex);
                 inv = invoker;
+                started = true;
+                d = data;
             }
 
             if (inv) {
-                inv->invokeCallback(type, call, data);
+                inv->invokeCallback(type, call, d);
             }
         }
 
@@ -143,6 +167,8 @@ protected:
     };
 
     void invokeCallback(int type, const CallBack& c, const NotifyData& data);
+    void invokeQueued(int type, const CallBack& c, const NotifyData& data);
+    bool coalesceQueued(int type, const CallBack& c, const NotifyData& data);
 
     void addCallBack(int type, Asyncable* receiver, void* call, Asyncable::AsyncMode mode = Asyncable::AsyncMode::AsyncSetRepeat);
     void removeCallBack(int type, Asyncable* receiver);
@@ -153,10 +179,19 @@ protected:
 
     bool containsReceiver(Asyncable* receiver) const;
 
+    //! NOTE s_namedMutex must be locked, it guards m_debugName
+    InvokerStats statsLocked() const;
+
     std::map<int /*type*/, CallBacks > m_callbacks;
 
     std::mutex m_qInvokersMutex;
     std::list<QInvoker*> m_qInvokers;
+
+    std::atomic<bool> m_coalescing = false;
+    std::string m_debugName;
+    std::atomic<uint64_t> m_sendCount = 0;
+    std::atomic<uint64_t> m_queuedCount = 0;
+    std::atomic<uint64_t> m_coalescedCount = 0;
 };
 
 inline void processEvents()
@@ -164,6 +199,11 @@ inline void processEvents()
     AbstractInvoker::processEvents();
 }
 
+inline std::vector<InvokerStats> namedStats()
+{
+    return AbstractInvoker::namedStats();
+}
+
 inline void onMainThreadInvoke(const std::function<void(const std::function<void()>&, bool)>& f)
 {
     AbstractInvoker::onMainThreadInvoke(f);
@@ -41,6 +41,16 @@ public:
         return m_ch.isConnected();
     }
 
+    void setDebugName(const std::string& name)
+    {
+        m_ch.setDebugName(name);
+    }
+
+    InvokerStats stats() const
+    {
+        return m_ch.stats();
+    }
+
 private:
     Channel<> m_ch;
 };
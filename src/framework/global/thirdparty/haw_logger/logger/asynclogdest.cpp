@@ -0,0 +1,267 @@
+#include "asynclogdest.h"
+
+#include <algorithm>
+#include <cassert>
+
+using namespace haw::logger;
+
+static constexpr std::chrono::milliseconds WRITE_INTERVAL(20);
+static constexpr std::chrono::seconds RATE_LIMIT_WINDOW(1);
+
+static std::atomic<uint64_t> s_lastDestId = 0;
+
+static std::mutex s_destsMutex;
+static std::vector<AsyncLogDest*> s_dests;
+
+AsyncLogDest::Ring::Ring()
+{
+    for (Record& record : records) {
+        record.msg.tag.reserve(RESERVED_TAG_SIZE);
+        record.msg.message.reserve(RESERVED_MESSAGE_SIZE);
+    }
+}
+
+bool AsyncLogDest::Ring::push(uint64_t seq, const LogMsg& msg)
+{
+    size_t h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) >= RING_CAPACITY) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    Record& record = records[h % RING_CAPACITY];
+    record.seq = seq;
+    record.msg = msg;
+
+    head.store(h + 1, std::memory_order_release);
+    return true;
+}
+
+AsyncLogDest::AsyncLogDest(const std::vector<LogDest*>& dests)
+    : LogDest(LogLayout("${message}")), m_id(++s_lastDestId), m_dests(dests)
+{
+    m_thread = std::thread([this]() { run(); });
+
+    std::lock_guard<std::mutex> lock(s_destsMutex);
+    s_dests.push_back(this);
+}
+
+AsyncLogDest::~AsyncLogDest()
+{
+    {
+        std::lock_guard<std::mutex> lock(s_destsMutex);
+        s_dests.erase(std::remove(s_dests.begin(), s_dests.end(), this), s_dests.end());
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_waitMutex);
+        m_running = false;
+    }
+    m_waitCond.notify_one();
+
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+
+    drain();
+
+    for (LogDest* d : m_dests) {
+        delete d;
+    }
+}
+
+std::string AsyncLogDest::name() const
+{
+    return "AsyncLogDest";
+}
+
+bool AsyncLogDest::isThreadSafe() const
+{
+    return true;
+}
+
+void AsyncLogDest::write(const LogMsg& logMsg)
+{
+    std::shared_ptr<Ring> ring = threadRing();
+
+    bool isError = logMsg.type == Logger::ERRR;
+    if (!isError && isRateLimited(*ring, logMsg)) {
+        return;
+    }
+
+    push(*ring, logMsg);
+
+    if (isError) {
+        drain();
+    }
+}
+
+void AsyncLogDest::push(Ring& ring, const LogMsg& logMsg)
+{
+    ring.push(m_seq.fetch_add(1, std::memory_order_relaxed), logMsg);
+}
+
+std::shared_ptr<AsyncLogDest::Ring> AsyncLogDest::threadRing()
+{
+    //! NOTE The ring stays alive until both the thread and the destination are done with it,
+    //! the destination is identified by its id, because the address may be reused
+    struct ThreadRing {
+        uint64_t destId = 0;
+        std::shared_ptr<Ring> ring;
+
+        ~ThreadRing()
+        {
+            if (ring) {
+                ring->finished = true;
+            }
+        }
+    };
+
+    thread_local ThreadRing t_ring;
+
+    if (t_ring.destId != m_id || !t_ring.ring) {
+        if (t_ring.ring) {
+            t_ring.ring->finished = true;
+        }
+
+        t_ring.destId = m_id;
+        t_ring.ring = std::make_shared<Ring>();
+
+        std::lock_guard<std::mutex> lock(m_ringsMutex);
+        m_rings.push_back(t_ring.ring);
+    }
+
+    return t_ring.ring;
+}
+
+bool AsyncLogDest::isRateLimited(Ring& ring, const LogMsg& logMsg)
+{
+    if (!logMsg.file) {
+        return false;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    SiteStat& stat = ring.sites[{ logMsg.file, logMsg.line }];
+
+    if (now - stat.windowStart >= RATE_LIMIT_WINDOW) {
+        if (stat.suppressed > 0) {
+            LogMsg note(Logger::WARN, logMsg.tag, "suppressed " + std::to_string(stat.suppressed)
+                        + " messages from " + logMsg.file + ":" + std::to_string(logMsg.line));
+            push(ring, note);
+        }
+
+        stat.windowStart = now;
+        stat.count = 0;
+        stat.suppressed = 0;
+    }
+
+    if (stat.count >= MAX_MESSAGES_PER_SITE_PER_SECOND) {
+        ++stat.suppressed;
+        return true;
+    }
+
+    ++stat.count;
+    return false;
+}
+
+void AsyncLogDest::run()
+{
+    while (m_running) {
+        {
+            std::unique_lock<std::mutex> lock(m_waitMutex);
+            m_waitCond.wait_for(lock, WRITE_INTERVAL, [this]() { return !m_running; });
+        }
+
+        drain();
+    }
+}
+
+void AsyncLogDest::flush()
+{
+    drain();
+}
+
+void AsyncLogDest::flushAll()
+{
+    std::unique_lock<std::mutex> lock(s_destsMutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return;
+    }
+
+    for (AsyncLogDest* dest : s_dests) {
+        dest->tryDrain();
+    }
+}
+
+void AsyncLogDest::drain()
+{
+    std::lock_guard<std::mutex> drainLock(m_drainMutex);
+
+    std::vector<std::shared_ptr<Ring> > rings;
+    {
+        std::lock_guard<std::mutex> lock(m_ringsMutex);
+        rings = m_rings;
+    }
+
+    drainRings(rings);
+}
+
+bool AsyncLogDest::tryDrain()
+{
+    std::unique_lock<std::mutex> drainLock(m_drainMutex, std::try_to_lock);
+    if (!drainLock.owns_lock()) {
+        return false;
+    }
+
+    std::vector<std::shared_ptr<Ring> > rings;
+    {
+        std::unique_lock<std::mutex> lock(m_ringsMutex, std::try_to_lock);
+        if (!lock.owns_lock()) {
+            return false;
+        }
+        rings = m_rings;
+    }
+
+    drainRings(rings);
+    return true;
+}
+
+void AsyncLogDest::drainRings(const std::vector<std::shared_ptr<Ring> >& rings)
+{
+    m_batch.clear();
+
+    size_t dropped = 0;
+    for (const std::shared_ptr<Ring>& ring : rings) {
+        //! NOTE Read before the records, so a finished ring is only removed once it is empty
+        bool finished = ring->finished.load(std::memory_order_acquire);
+
+        size_t t = ring->tail.load(std::memory_order_relaxed);
+        size_t h = ring->head.load(std::memory_order_acquire);
+        for (; t != h; ++t) {
+            m_batch.push_back(ring->records[t % RING_CAPACITY]);
+        }
+        ring->tail.store(t, std::memory_order_release);
+
+        dropped += ring->dropped.exchange(0, std::memory_order_relaxed);
+
+        if (finished) {
+            std::lock_guard<std::mutex> lock(m_ringsMutex);
+            m_rings.erase(std::remove(m_rings.begin(), m_rings.end(), ring), m_rings.end());
+        }
+    }
+
+    //! NOTE The messages of the different threads are written in the order they were logged
+    std::sort(m_batch.begin(), m_batch.end(), [](const Record& r1, const Record& r2) {
+        return r1.seq < r2.seq;
+    });
+
+    if (dropped > 0) {
+        m_batch.push_back({ 0, LogMsg(Logger::WARN, "Logger", std::to_string(dropped) + " messages dropped, the log buffer is full") });
+    }
+
+    for (const Record& record : m_batch) {
+        for (LogDest* dest : m_dests) {
+            dest->write(record.msg);
+        }
+    }
+}
@@ -0,0 +1,100 @@
+#ifndef HAW_ASYNCLOGDEST_H
+#define HAW_ASYNCLOGDEST_H
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "logger.h"
+
+namespace haw::logger {
+//! NOTE The messages are pushed into a lock-free ring buffer of the calling thread
+//! and are formatted and written to the destinations by a background thread.
+//! The messages of a call site over the rate limit are dropped, their count is written instead.
+//! The errors are never rate limited and are written before write() returns,
+//! so they are not lost if the process goes down right after them
+class AsyncLogDest : public LogDest
+{
+public:
+    explicit AsyncLogDest(const std::vector<LogDest*>& dests);
+    ~AsyncLogDest() override;
+
+    std::string name() const override;
+    void write(const LogMsg& logMsg) override;
+    bool isThreadSafe() const override;
+
+    //! NOTE Writes the pushed messages on the calling thread
+    void flush();
+
+    //! NOTE Writes the pushed messages of all the destinations, for the crash and terminate handlers.
+    //! Does not wait for a lock, so it may skip a destination that is being written at the moment
+    static void flushAll();
+
+    static constexpr size_t RING_CAPACITY = 1024;
+    static constexpr size_t MAX_MESSAGES_PER_SITE_PER_SECOND = 50;
+
+    //! NOTE The strings of the records are reserved up front and are copied, not moved, out of the ring,
+    //! so pushing a message of up to these sizes does not allocate on the calling thread
+    static constexpr size_t RESERVED_TAG_SIZE = 32;
+    static constexpr size_t RESERVED_MESSAGE_SIZE = 256;
+
+private:
+    struct Record {
+        uint64_t seq = 0;
+        LogMsg msg;
+    };
+
+    struct SiteStat {
+        std::chrono::steady_clock::time_point windowStart;
+        size_t count = 0;
+        size_t suppressed = 0;
+    };
+
+    //! NOTE Single producer (the owning thread), single consumer (the writing thread)
+    struct Ring {
+        std::array<Record, RING_CAPACITY> records;
+        std::atomic<size_t> head = 0;
+        std::atomic<size_t> tail = 0;
+        std::atomic<size_t> dropped = 0;
+        std::atomic<bool> finished = false;
+
+        //! NOTE Only used by the producer
+        std::map<std::pair<const char*, int>, SiteStat> sites;
+
+        Ring();
+        bool push(uint64_t seq, const LogMsg& msg);
+    };
+
+    std::shared_ptr<Ring> threadRing();
+    bool isRateLimited(Ring& ring, const LogMsg& logMsg);
+    void push(Ring& ring, const LogMsg& logMsg);
+
+    void run();
+    void drain();
+    bool tryDrain();
+    void drainRings(const std::vector<std::shared_ptr<Ring> >& rings);
+
+    const uint64_t m_id = 0;
+    std::vector<LogDest*> m_dests;
+
+    std::atomic<uint64_t> m_seq = 0;
+
+    std::mutex m_ringsMutex;
+    std::vector<std::shared_ptr<Ring> > m_rings;
+
+    std::mutex m_drainMutex;
+    std::vector<Record> m_batch;
+
+    std::mutex m_waitMutex;
+    std::condition_variable m_waitCond;
+    std::atomic<bool> m_running = true;
+    std::thread m_thread;
+};
+}
+
+#endif // HAW_ASYNCLOGDEST_H
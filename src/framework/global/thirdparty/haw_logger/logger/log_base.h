@@ -25,7 +25,8 @@
 #define IF_LOGLEVEL(level)  if (haw::logger::Logger::instance()->isLevel(level))
 
 #define LOG_STREAM(type, tag, funcInfo) haw::logger::LogInput(type, tag, funcInfo).stream
-#define LOG(type, tag)  LOG_STREAM(type, tag, FUNCNAME(FUNC_INFO) + ": ")
+#define LOG_STREAM_AT(type, tag, funcInfo) haw::logger::LogInput(type, tag, funcInfo, __FILE__, __LINE__).stream
+#define LOG(type, tag)  LOG_STREAM_AT(type, tag, FUNCNAME(FUNC_INFO) + ": ")
 
 #define LOGE_T(tag) IF_LOGLEVEL(haw::logger::Normal) LOG(haw::logger::Logger::ERRR, tag)
 #define LOGW_T(tag) IF_LOGLEVEL(haw::logger::Normal) LOG(haw::logger::Logger::WARN, tag)
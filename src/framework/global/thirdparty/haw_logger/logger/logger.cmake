@@ -6,6 +6,8 @@ set(HAW_LOGGER_SRC
     ${CMAKE_CURRENT_LIST_DIR}/logger.h
     ${CMAKE_CURRENT_LIST_DIR}/logdefdest.cpp
     ${CMAKE_CURRENT_LIST_DIR}/logdefdest.h
+    ${CMAKE_CURRENT_LIST_DIR}/asynclogdest.cpp
+    ${CMAKE_CURRENT_LIST_DIR}/asynclogdest.h
     ${CMAKE_CURRENT_LIST_DIR}/helpful.cpp
     ${CMAKE_CURRENT_LIST_DIR}/helpful.h
 )
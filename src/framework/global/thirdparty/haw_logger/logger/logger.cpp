@@ -48,7 +48,13 @@ DateTime DateTime::now()
     milliseconds ms_d = duration_cast< milliseconds >(system_clock::now().time_since_epoch());
 
     std::time_t sec = static_cast<std::time_t>(ms_d.count() / 1000);
-    std::tm* tm = std::localtime(&sec);
+    //! NOTE The messages are created on any thread, std::localtime returns a shared buffer
+    std::tm tmBuf {};
+#ifdef _WIN32
+    std::tm* tm = localtime_s(&tmBuf, &sec) == 0 ? &tmBuf : nullptr;
+#else
+    std::tm* tm = localtime_r(&sec, &tmBuf);
+#endif
     assert(tm);
     if (!tm) {
         return DateTime();
@@ -312,11 +318,20 @@ void Logger::setupDefault()
 
 void Logger::write(const LogMsg& logMsg)
 {
-    std::lock_guard<std::mutex> locker(m_mutex);
-    if (isAsseptMsg(logMsg.type)) {
-        for (LogDest* dest : m_dests) {
+    if (!isAsseptMsg(logMsg.type)) {
+        return;
+    }
+
+    //! NOTE The destinations may be changed by another thread
+    std::lock_guard<std::mutex> destsLocker(m_destsMutex);
+    for (LogDest* dest : m_dests) {
+        if (dest->isThreadSafe()) {
             dest->write(logMsg);
+            continue;
         }
+
+        std::lock_guard<std::mutex> locker(m_mutex);
+        dest->write(logMsg);
     }
 }
 
@@ -336,16 +351,19 @@ bool Logger::isType(const Type& type) const
 void Logger::addDest(LogDest* dest)
 {
     assert(dest);
+    std::lock_guard<std::mutex> locker(m_destsMutex);
     m_dests.push_back(dest);
 }
 
 std::vector<LogDest*> Logger::dests() const
 {
+    std::lock_guard<std::mutex> locker(m_destsMutex);
     return m_dests;
 }
 
 void Logger::clearDests()
 {
+    std::lock_guard<std::mutex> locker(m_destsMutex);
     for (LogDest* d : m_dests) {
         delete d;
     }
@@ -429,6 +447,13 @@ LogInput::LogInput(const Type& type, const std::string& tag, const std::string&
 {
 }
 
+LogInput::LogInput(const Type& type, const std::string& tag, const std::string& funcInfo, const char* file, int line)
+    : m_msg(type, tag), m_funcInfo(funcInfo)
+{
+    m_msg.file = file;
+    m_msg.line = line;
+}
+
 LogInput::~LogInput()
 {
     m_msg.message = m_funcInfo + m_stream.str();
@@ -74,6 +74,10 @@ public:
     std::string message;
     DateTime datetime;
     std::thread::id thread;
+
+    //! NOTE The call site, if known
+    const char* file = nullptr;
+    int line = 0;
 };
 
 //! Layout ---------------------------------
@@ -121,6 +125,9 @@ public:
     virtual std::string name() const = 0;
     virtual void write(const LogMsg& logMsg) = 0;
 
+    //! NOTE If not, the writes are serialized by the logger
+    virtual bool isThreadSafe() const { return false; }
+
     LogLayout layout() const;
 
 protected:
@@ -173,6 +180,7 @@ private:
 
     Level m_level = Normal;
     std::vector<LogDest*> m_dests;
+    mutable std::mutex m_destsMutex;
     std::vector<Type> m_types;
     std::mutex m_mutex;
 };
@@ -182,6 +190,7 @@ class LogInput
 {
 public:
     explicit LogInput(const Type& type, const std::string& tag, const std::string& funcInfo);
+    explicit LogInput(const Type& type, const std::string& tag, const std::string& funcInfo, const char* file, int line);
     ~LogInput();
 
     Stream& stream();
@@ -10,6 +10,9 @@
 using namespace haw::profiler;
 
 Profiler::Options Profiler::m_options;
+std::atomic<bool> Profiler::m_tracingEnabled(false);
+
+thread_local Profiler::TraceBuffer* Profiler::m_threadTraceBuffer = nullptr;
 
 constexpr int MAIN_THREAD_INDEX(0);
 
@@ -21,6 +24,7 @@ Profiler* Profiler::instance()
 
 Profiler::Profiler()
 {
+    m_traces.start = std::chrono::steady_clock::now();
     setup(Options(), new Printer());
 }
 
@@ -79,6 +83,10 @@ void Profiler::stepTime(const std::string& tag, const std::string& info, bool is
     printer()->printStep(tag, timer->beginMs(), timer->stepMs(), info);
 
     timer->nextStep();
+
+    if (isTracingEnabled()) {
+        traceStep(tag, info);
+    }
 }
 
 Profiler::FuncTimer* Profiler::beginFunc(const std::string& func)
@@ -149,6 +157,14 @@ const std::string& Profiler::staticInfo(const std::string& info)
 
 void Profiler::clear()
 {
+    {
+        std::lock_guard<std::mutex> lock(m_traces.mutex);
+        for (std::unique_ptr<TraceBuffer>& buf : m_traces.buffers) {
+            std::lock_guard<std::mutex> bufLock(buf->mutex);
+            buf->written = 0;
+        }
+        m_traces.steps.clear();
+    }
     {
         std::lock_guard<std::mutex> lock(m_funcs.mutex);
 
@@ -253,6 +269,194 @@ bool Profiler::save(const std::string& filePath)
     return ok;
 }
 
+void Profiler::setTracingEnabled(bool arg)
+{
+    m_tracingEnabled.store(arg, std::memory_order_relaxed);
+}
+
+Profiler::TraceBuffer* Profiler::threadTraceBuffer()
+{
+    if (m_threadTraceBuffer) {
+        return m_threadTraceBuffer;
+    }
+
+    std::lock_guard<std::mutex> lock(m_traces.mutex);
+
+    //! NOTE Buffers are never released, the threads keep raw pointers to them
+    if (m_traces.buffers.size() >= m_options.funcsMaxThreadCount) {
+        return nullptr;
+    }
+
+    std::unique_ptr<TraceBuffer> buf = std::make_unique<TraceBuffer>();
+    buf->thread = std::this_thread::get_id();
+    buf->events.resize(std::max<size_t>(m_options.traceBufferSize, 1));
+
+    m_threadTraceBuffer = buf.get();
+    m_traces.buffers.push_back(std::move(buf));
+
+    return m_threadTraceBuffer;
+}
+
+bool Profiler::traceBegin(const std::string& func)
+{
+    TraceBuffer* buf = threadTraceBuffer();
+    if (!buf) {
+        return false;
+    }
+
+    buf->add(&func, m_traces.timeNs(), true);
+    return true;
+}
+
+void Profiler::traceEnd(const std::string& func)
+{
+    TraceBuffer* buf = threadTraceBuffer();
+    if (buf) {
+        buf->add(&func, m_traces.timeNs(), false);
+    }
+}
+
+void Profiler::traceStep(const std::string& tag, const std::string& info)
+{
+    std::lock_guard<std::mutex> lock(m_traces.mutex);
+
+    TraceStep step;
+    step.name = tag + ": " + info;
+    step.thread = std::this_thread::get_id();
+    step.timeNs = m_traces.timeNs();
+    m_traces.steps.push_back(std::move(step));
+
+    if (m_traces.steps.size() > m_options.traceBufferSize) {
+        m_traces.steps.pop_front();
+    }
+}
+
+static void jsonEscapeTo(std::string& out, const std::string& str)
+{
+    for (char c : str) {
+        switch (c) {
+        case '"': out.append("\\\""); break;
+        case '\\': out.append("\\\\"); break;
+        case '\n': out.append("\\n"); break;
+        case '\t': out.append("\\t"); break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                out.push_back(' ');
+            } else {
+                out.push_back(c);
+            }
+        }
+    }
+}
+
+static std::string formatMicroseconds(int64_t ns)
+{
+    //! NOTE The trace format expects microseconds, the fraction keeps the nanosecond resolution
+    std::string str = std::to_string(ns / 1000);
+    int64_t rest = ns % 1000;
+    str.push_back('.');
+    str.push_back(static_cast<char>('0' + rest / 100));
+    str.push_back(static_cast<char>('0' + (rest / 10) % 10));
+    str.push_back(static_cast<char>('0' + rest % 10));
+    return str;
+}
+
+std::string Profiler::traceString() const
+{
+    std::thread::id mainThread;
+    {
+        std::lock_guard<std::mutex> lock(m_funcs.mutex);
+        mainThread = m_funcs.threads[MAIN_THREAD_INDEX];
+    }
+
+    std::vector<TraceBuffer*> buffers;
+    std::deque<TraceStep> steps;
+    {
+        std::lock_guard<std::mutex> lock(m_traces.mutex);
+        for (const std::unique_ptr<TraceBuffer>& buf : m_traces.buffers) {
+            buffers.push_back(buf.get());
+        }
+        steps = m_traces.steps;
+    }
+
+    std::string out;
+    out.reserve(1024 * 1024);
+    out.append("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+    bool first = true;
+    auto beginEvent = [&out, &first]() {
+        out.append(first ? "\n" : ",\n");
+        first = false;
+    };
+
+    auto appendEvent = [&out, &beginEvent](const std::string& name, char phase, int64_t timeNs, size_t tid) {
+        beginEvent();
+        out.append("{\"name\":\"");
+        jsonEscapeTo(out, name);
+        out.append("\",\"ph\":\"");
+        out.push_back(phase);
+        out.append("\",\"ts\":");
+        out.append(formatMicroseconds(timeNs));
+        out.append(",\"pid\":1,\"tid\":");
+        out.append(std::to_string(tid));
+        out.append(phase == 'i' ? ",\"s\":\"t\"}" : "}");
+    };
+
+    std::unordered_map<std::thread::id, size_t> tids;
+    for (size_t tid = 0; tid < buffers.size(); ++tid) {
+        TraceBuffer* buf = buffers[tid];
+        tids[buf->thread] = tid;
+
+        beginEvent();
+        out.append("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":");
+        out.append(std::to_string(tid));
+        out.append(",\"args\":{\"name\":\"");
+        out.append(buf->thread == mainThread ? std::string("Main thread") : "Thread " + std::to_string(tid));
+        out.append("\"}}");
+
+        std::vector<TraceEvent> events = buf->snapshot();
+
+        //! NOTE The ring buffer may have dropped the begin of the oldest calls,
+        //! such ends are skipped and the calls still running are closed at the last timestamp
+        std::vector<const std::string*> stack;
+        int64_t lastNs = 0;
+        for (const TraceEvent& ev : events) {
+            if (ev.isBegin) {
+                stack.push_back(ev.name);
+            } else if (!stack.empty()) {
+                stack.pop_back();
+            } else {
+                continue;
+            }
+
+            appendEvent(*ev.name, ev.isBegin ? 'B' : 'E', ev.timeNs, tid);
+            lastNs = ev.timeNs;
+        }
+
+        while (!stack.empty()) {
+            appendEvent(*stack.back(), 'E', lastNs, tid);
+            stack.pop_back();
+        }
+    }
+
+    for (const TraceStep& step : steps) {
+        auto it = tids.find(step.thread);
+        size_t tid = it != tids.end() ? it->second : buffers.size();
+        appendEvent(step.name, 'i', step.timeNs, tid);
+    }
+
+    out.append("\n]}\n");
+
+    return out;
+}
+
+bool Profiler::saveTrace(const std::string& filePath)
+{
+    std::string content = traceString();
+    bool ok = save_file(filePath, content);
+    return ok;
+}
+
 bool Profiler::save_file(const std::string& path, const std::string& content)
 {
     FILE* pFile = fopen(path.c_str(), "w");
@@ -369,6 +573,41 @@ int Profiler::FuncsData::addThread(std::thread::id th)
     return -1;
 }
 
+void Profiler::TraceBuffer::add(const std::string* name, int64_t timeNs, bool isBegin)
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    TraceEvent& ev = this->events[this->written % this->events.size()];
+    ev.name = name;
+    ev.timeNs = timeNs;
+    ev.isBegin = isBegin;
+
+    ++this->written;
+}
+
+std::vector<Profiler::TraceEvent> Profiler::TraceBuffer::snapshot()
+{
+    std::lock_guard<std::mutex> lock(this->mutex);
+
+    size_t size = this->events.size();
+    size_t count = std::min(this->written, size);
+    size_t begin = this->written - count;
+
+    std::vector<TraceEvent> result;
+    result.reserve(count);
+    for (size_t i = begin; i < this->written; ++i) {
+        result.push_back(this->events[i % size]);
+    }
+
+    return result;
+}
+
+int64_t Profiler::TracesData::timeNs() const
+{
+    auto elapsed = std::chrono::steady_clock::now() - this->start;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+}
+
 using mclock = std::chrono::high_resolution_clock;
 
 void Profiler::ElapsedTimer::start()
@@ -1,13 +1,17 @@
 #ifndef HAW_PROFILER_H
 #define HAW_PROFILER_H
 
+#include <cstdint>
 #include <string>
 #include <list>
 #include <vector>
 #include <set>
+#include <deque>
+#include <memory>
 #include <unordered_map>
 #include <thread>
 #include <mutex>
+#include <atomic>
 #include <chrono>
 #include <sstream>
 
@@ -53,6 +57,14 @@
 #define PROFILER_PRINT haw::profiler::Profiler::instance()->printThreadsData();
 #endif
 
+#ifndef PROFILER_TRACE_START
+#define PROFILER_TRACE_START haw::profiler::Profiler::instance()->setTracingEnabled(true);
+#endif
+
+#ifndef PROFILER_TRACE_SAVE
+#define PROFILER_TRACE_SAVE(path) haw::profiler::Profiler::instance()->saveTrace(path);
+#endif
+
 #else
 
 #define TRACEFUNC
@@ -61,6 +73,8 @@
 #define STEP_TIME
 #define PROFILER_CLEAR
 #define PROFILER_PRINT
+#define PROFILER_TRACE_START
+#define PROFILER_TRACE_SAVE(path)
 
 #endif
 
@@ -76,6 +90,7 @@ public:
         bool funcsTimeEnabled{ true };
         bool funcsTraceEnabled{ false };
         size_t funcsMaxThreadCount{ 100 };
+        size_t traceBufferSize{ 1 << 16 }; //! NOTE Events per thread, the oldest are overwritten
         int dataTopCount{ 150 };
         Options() {}
     };
@@ -161,6 +176,17 @@ public:
 
     bool save(const std::string& filePath);
 
+    //! NOTE Tracing records begin/end events of the marked functions into per thread ring buffers,
+    //! the result is exported in the Chrome trace event format (chrome://tracing, Perfetto)
+    static bool isTracingEnabled();
+    void setTracingEnabled(bool arg);
+
+    bool traceBegin(const std::string& func);
+    void traceEnd(const std::string& func);
+
+    std::string traceString() const;
+    bool saveTrace(const std::string& filePath);
+
 private:
     Profiler();
     ~Profiler();
@@ -168,6 +194,7 @@ private:
     friend struct FuncMarker;
 
     static Options m_options;
+    static std::atomic<bool> m_tracingEnabled;
 
     struct StepTimer {
         ElapsedTimer beginTime;
@@ -197,12 +224,49 @@ private:
         int addThread(std::thread::id th);
     };
 
+    struct TraceEvent {
+        const std::string* name{ nullptr };
+        int64_t timeNs{ 0 };
+        bool isBegin{ true };
+    };
+
+    struct TraceBuffer {
+        std::mutex mutex;
+        std::thread::id thread;
+        std::vector<TraceEvent> events;
+        size_t written{ 0 };
+
+        void add(const std::string* name, int64_t timeNs, bool isBegin);
+        std::vector<TraceEvent> snapshot();
+    };
+
+    struct TraceStep {
+        std::string name;
+        std::thread::id thread;
+        int64_t timeNs{ 0 };
+    };
+
+    struct TracesData {
+        mutable std::mutex mutex;
+        std::vector<std::unique_ptr<TraceBuffer> > buffers;
+        std::deque<TraceStep> steps;
+        std::chrono::steady_clock::time_point start;
+
+        int64_t timeNs() const;
+    };
+
+    static thread_local TraceBuffer* m_threadTraceBuffer;
+
+    TraceBuffer* threadTraceBuffer();
+    void traceStep(const std::string& tag, const std::string& info);
+
     bool save_file(const std::string& path, const std::string& content);
 
     Printer* m_printer{ nullptr };
 
     StepsData m_steps;
     mutable FuncsData m_funcs;
+    mutable TracesData m_traces;
 
     size_t m_stackCounter{ 0 };
 };
@@ -215,10 +279,19 @@ struct FuncMarker
         if (Profiler::m_options.funcsTimeEnabled) {
             timer = Profiler::instance()->beginFunc(fn);
         }
+
+        if (Profiler::isTracingEnabled()) {
+            traced = Profiler::instance()->traceBegin(fn);
+        }
     }
 
     ~FuncMarker()
     {
+        //! NOTE Closed even if tracing was switched off meanwhile, so the begin/end pairs stay balanced
+        if (traced) {
+            Profiler::instance()->traceEnd(func);
+        }
+
         if (Profiler::m_options.funcsTimeEnabled) {
             Profiler::instance()->endFunc(timer, func);
         }
@@ -228,7 +301,13 @@ struct FuncMarker
 
     Profiler::FuncTimer* timer{ nullptr };
     const std::string& func;
+    bool traced{ false };
 };
+
+inline bool Profiler::isTracingEnabled()
+{
+    return m_tracingEnabled.load(std::memory_order_relaxed);
+}
 }
 
 #endif // XTZ_PROFILER_H
@@ -37,9 +37,11 @@ public:
     typedef typename Data::iterator iterator;
     typedef typename Data::const_iterator const_iterator;
 
+    //! NOTE The empty maps share one data until they are changed,
+    //! so that a default constructed map costs no allocation
     SharedHashMap()
+        : m_dataPtr(emptyData())
     {
-        m_dataPtr = std::make_shared<Data>();
     }
 
     SharedHashMap(const size_t reserveSize)
@@ -210,6 +212,12 @@ public:
     }
 
 protected:
+    static const DataPtr& emptyData()
+    {
+        static const DataPtr empty = std::make_shared<Data>();
+        return empty;
+    }
+
     void ensureDetach()
     {
         if (!m_dataPtr) {
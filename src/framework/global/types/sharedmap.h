@@ -39,9 +39,11 @@ public:
     typedef typename Data::reverse_iterator reverse_iterator;
     typedef typename Data::const_reverse_iterator const_reverse_iterator;
 
+    //! NOTE The empty maps share one data until they are changed,
+    //! so that a default constructed map costs no allocation
     SharedMap()
+        : m_dataPtr(emptyData())
     {
-        m_dataPtr = std::make_shared<Data>();
     }
 
     SharedMap(std::initializer_list<PairType> initList)
@@ -225,6 +227,12 @@ public:
     }
 
 protected:
+    static const DataPtr& emptyData()
+    {
+        static const DataPtr empty = std::make_shared<Data>();
+        return empty;
+    }
+
     void ensureDetach()
     {
         if (!m_dataPtr) {
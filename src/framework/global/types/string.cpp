@@ -414,6 +414,11 @@ ByteArray String::toUtf8() const
     return ba;
 }
 
+void String::toUtf8(std::string& dst) const
+{
+    UtfCodec::utf16to8(std::u16string_view(constStr()), dst);
+}
+
 String String::fromAscii(const char* str, size_t size)
 {
     if (!str) {
@@ -513,6 +518,22 @@ QString String::toQString() const
     return QString(reinterpret_cast<const QChar*>(constStr().data()), static_cast<int>(size()));
 }
 
+QString String::toQStringNoCopy() const
+{
+    static_assert(sizeof(QChar) == sizeof(char16_t));
+    return QString::fromRawData(reinterpret_cast<const QChar*>(constStr().data()), static_cast<int>(size()));
+}
+
+bool String::operator ==(const QString& s) const
+{
+    const std::u16string& str = constStr();
+    if (str.size() != static_cast<size_t>(s.size())) {
+        return false;
+    }
+
+    return std::char_traits<char16_t>::compare(str.data(), reinterpret_cast<const char16_t*>(s.constData()), str.size()) == 0;
+}
+
 #endif
 
 size_t String::size() const
@@ -206,8 +206,11 @@ public:
     String& operator=(const QString& str) { *this = fromQString(str); return *this; }
     static String fromQString(const QString& str);
     QString toQString() const;
+    //! NOTE The result refers to the data of this string, so it must not outlive it or its next change.
+    //! For passing the text to the Qt functions that do not keep it
+    QString toQStringNoCopy() const;
 
-    inline bool operator ==(const QString& s) const { return toQString() == s; }
+    bool operator ==(const QString& s) const;
     inline bool operator !=(const QString& s) const { return !operator ==(s); }
 #endif
 
@@ -246,6 +249,8 @@ public:
 
     static String fromUtf8(const char* str);
     ByteArray toUtf8() const;
+    //! NOTE Appends to the given buffer, so that it can be reused
+    void toUtf8(std::string& dst) const;
 
     static String fromAscii(const char* str, size_t size = mu::nidx);
     ByteArray toAscii(bool* ok = nullptr) const;
@@ -46,7 +46,8 @@ public:
     virtual MidiDeviceID deviceID() const = 0;
     virtual async::Notification deviceChanged() const = 0;
 
-    virtual async::Channel<tick_t, Event> eventReceived() const = 0;
+    //! NOTE The timestamp is taken on the driver thread, see currentTimestamp()
+    virtual async::Channel<tick_t, Event, timestamp_t> eventReceived() const = 0;
 };
 }
 
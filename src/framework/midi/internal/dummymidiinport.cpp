@@ -57,7 +57,7 @@ MidiDeviceID DummyMidiInPort::deviceID() const
     return m_deviceID;
 }
 
-async::Channel<tick_t, Event> DummyMidiInPort::eventReceived() const
+async::Channel<tick_t, Event, timestamp_t> DummyMidiInPort::eventReceived() const
 {
     return m_eventReceived;
 }
@@ -225,7 +225,7 @@ mu::async::Notification AlsaMidiInPort::deviceChanged() const
     return m_deviceChanged;
 }
 
-mu::async::Channel<tick_t, Event> AlsaMidiInPort::eventReceived() const
+mu::async::Channel<tick_t, Event, timestamp_t> AlsaMidiInPort::eventReceived() const
 {
     return m_eventReceived;
 }
@@ -282,6 +282,8 @@ void AlsaMidiInPort::doProcess()
             continue;
         }
 
+        const timestamp_t receivedAt = currentTimestamp();
+
         switch (ev->type) {
         case SND_SEQ_EVENT_SYSEX:
         {
@@ -338,10 +340,11 @@ void AlsaMidiInPort::doProcess()
 
         e = e.toMIDI20();
         if (e) {
-            m_eventReceived.send(static_cast<tick_t>(ev->time.tick), e);
+            m_eventReceived.send(static_cast<tick_t>(ev->time.tick), e, receivedAt);
         }
 
-        sleep();
+        //! NOTE Don't sleep while there are pending events, otherwise every note of a chord
+        //! would be delayed by the previous ones
     }
 }
 
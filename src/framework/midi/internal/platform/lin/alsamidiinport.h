@@ -49,7 +49,7 @@ public:
     MidiDeviceID deviceID() const override;
     async::Notification deviceChanged() const override;
 
-    async::Channel<tick_t, Event> eventReceived() const override;
+    async::Channel<tick_t, Event, timestamp_t> eventReceived() const override;
 
 private:
     Ret run();
@@ -72,7 +72,7 @@ private:
 
     mutable std::mutex m_devicesMutex;
 
-    async::Channel<tick_t, Event > m_eventReceived;
+    async::Channel<tick_t, Event, timestamp_t> m_eventReceived;
 };
 }
 
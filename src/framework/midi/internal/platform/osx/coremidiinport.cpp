@@ -189,13 +189,14 @@ void CoreMidiInPort::initCore()
     QString portName = "MuseScore MIDI input port";
     if (__builtin_available(macOS 11.0, *)) {
         MIDIReceiveBlock receiveBlock = ^ (const MIDIEventList* eventList, void* /*srcConnRefCon*/) {
+            const timestamp_t receivedAt = currentTimestamp();
             const MIDIEventPacket* packet = eventList->packet;
             for (UInt32 index = 0; index < eventList->numPackets; index++) {
                 // Handle packet
                 if (packet->wordCount != 0 && packet->wordCount <= 4) {
                     Event e = Event::fromRawData(packet->words, packet->wordCount);
                     if (e) {
-                        m_eventReceived.send((tick_t)packet->timeStamp, e);
+                        m_eventReceived.send((tick_t)packet->timeStamp, e, receivedAt);
                     }
                 } else if (packet->wordCount > 4) {
                     LOGW() << "unsupported midi message size " << packet->wordCount << " bytes";
@@ -210,6 +211,7 @@ void CoreMidiInPort::initCore()
     } else {
         MIDIReadBlock readBlock = ^ (const MIDIPacketList* packetList, void* /*srcConnRefCon*/)
         {
+            const timestamp_t receivedAt = currentTimestamp();
             const MIDIPacket* packet = packetList->packet;
             for (UInt32 index = 0; index < packetList->numPackets; index++) {
                 if (packet->length != 0 && packet->length <= 4) {
@@ -218,7 +220,7 @@ void CoreMidiInPort::initCore()
 
                     auto e = Event::fromMIDI10Package(message).toMIDI20();
                     if (e) {
-                        m_eventReceived.send((tick_t)packet->timeStamp, e);
+                        m_eventReceived.send((tick_t)packet->timeStamp, e, receivedAt);
                     }
                 } else if (packet->length > 4) {
                     LOGW() << "unsupported midi message size " << packet->length << " bytes";
@@ -310,7 +312,7 @@ async::Notification CoreMidiInPort::deviceChanged() const
     return m_deviceChanged;
 }
 
-async::Channel<tick_t, Event> CoreMidiInPort::eventReceived() const
+async::Channel<tick_t, Event, timestamp_t> CoreMidiInPort::eventReceived() const
 {
     return m_eventReceived;
 }
@@ -45,7 +45,7 @@ public:
     MidiDeviceID deviceID() const override;
     async::Notification deviceChanged() const override;
 
-    async::Channel<tick_t, Event> eventReceived() const override;
+    async::Channel<tick_t, Event, timestamp_t> eventReceived() const override;
 
 private:
     Ret run();
@@ -61,7 +61,7 @@ private:
 
     bool m_running = false;
 
-    async::Channel<tick_t, Event > m_eventReceived;
+    async::Channel<tick_t, Event, timestamp_t> m_eventReceived;
 };
 }
 
@@ -141,9 +141,11 @@ static void CALLBACK process(HMIDIIN hMidiIn, UINT wMsg, DWORD_PTR dwInstance, D
 
 void WinMidiInPort::doProcess(uint32_t message, tick_t timing)
 {
+    const timestamp_t receivedAt = currentTimestamp();
+
     auto e = Event::fromMIDI10Package(message).toMIDI20();
     if (e) {
-        m_eventReceived.send(timing, e);
+        m_eventReceived.send(timing, e, receivedAt);
     }
 }
 
@@ -221,7 +223,7 @@ mu::async::Notification WinMidiInPort::deviceChanged() const
     return m_deviceChanged;
 }
 
-mu::async::Channel<tick_t, Event> WinMidiInPort::eventReceived() const
+mu::async::Channel<tick_t, Event, timestamp_t> WinMidiInPort::eventReceived() const
 {
     return m_eventReceived;
 }
@@ -48,7 +48,7 @@ public:
     MidiDeviceID deviceID() const override;
     async::Notification deviceChanged() const override;
 
-    async::Channel<tick_t, Event> eventReceived() const override;
+    async::Channel<tick_t, Event, timestamp_t> eventReceived() const override;
 
     // internal;
     void doProcess(uint32_t message, tick_t timing);
@@ -68,7 +68,7 @@ private:
 
     mutable std::mutex m_devicesMutex;
 
-    async::Channel<tick_t, Event > m_eventReceived;
+    async::Channel<tick_t, Event, timestamp_t> m_eventReceived;
 };
 }
 
@@ -31,6 +31,7 @@
 #include <functional>
 #include <set>
 #include <cassert>
+#include <chrono>
 #include "async/channel.h"
 #include "types/retval.h"
 #include "midievent.h"
@@ -46,6 +47,16 @@ using note_idx_t = uint8_t;
 using TempoMap = std::map<tick_t, tempo_t>;
 using Events = std::map<tick_t, std::vector<Event> >;
 
+//! NOTE Microseconds of the steady clock, taken when the driver hands an input event over to us,
+//! so the latency of everything that reacts on the event can be measured against it
+using timestamp_t = int64_t;
+
+inline timestamp_t currentTimestamp()
+{
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
 static constexpr int EXPRESSION_CONTROLLER = 11;
 
 struct Program {
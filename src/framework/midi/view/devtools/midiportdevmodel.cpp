@@ -28,8 +28,9 @@ using namespace mu::midi;
 MidiPortDevModel::MidiPortDevModel(QObject* parent)
     : QObject(parent)
 {
-    midiInPort()->eventReceived().onReceive(this, [this](tick_t tick, const Event& event) {
-        QString str = "tick: " + QString::number(tick) + " " + QString::fromStdString(event.to_string());
+    midiInPort()->eventReceived().onReceive(this, [this](tick_t tick, const Event& event, timestamp_t receivedAt) {
+        QString str = "tick: " + QString::number(tick) + " latency: " + QString::number(currentTimestamp() - receivedAt) + "us "
+                      + QString::fromStdString(event.to_string());
         LOGI() << str;
 
         m_inputEvents.prepend(str);
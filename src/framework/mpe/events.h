@@ -23,6 +23,7 @@
 #ifndef MU_MPE_EVENTS_H
 #define MU_MPE_EVENTS_H
 
+#include <array>
 #include <variant>
 #include <vector>
 #include <optional>
@@ -227,15 +228,54 @@ private:
             return;
         }
 
+        m_expressionCtx.expressionCurve = scaledExpressionCurve(appliedOffsetMap, articulationDynamicLevel, actualDynamicLevel,
+                                                                requiredVelocityFraction);
+    }
+
+    //! NOTE Most notes of a passage get the same curve, so the last scaled curves are kept and shared
+    //! between the events, per thread since the events are rendered from several threads
+    static ExpressionCurve scaledExpressionCurve(const ExpressionCurve& source, const dynamic_level_t articulationDynamicLevel,
+                                                 const dynamic_level_t actualDynamicLevel, const float requiredVelocityFraction)
+    {
+        struct CachedCurve {
+            ExpressionCurve source;
+            dynamic_level_t articulationDynamicLevel = 0;
+            dynamic_level_t actualDynamicLevel = 0;
+            float requiredVelocityFraction = 0.f;
+            ExpressionCurve result;
+            bool isValid = false;
+        };
+
+        static constexpr size_t CACHE_SIZE = 16;
+        thread_local std::array<CachedCurve, CACHE_SIZE> cache;
+        thread_local size_t nextIdx = 0;
+
+        for (const CachedCurve& cached : cache) {
+            if (cached.isValid
+                && cached.articulationDynamicLevel == articulationDynamicLevel
+                && cached.actualDynamicLevel == actualDynamicLevel
+                && RealIsEqual(cached.requiredVelocityFraction, requiredVelocityFraction)
+                && cached.source == source) {
+                return cached.result;
+            }
+        }
+
+        ExpressionCurve result = source;
+
         float ratio = static_cast<float>(actualDynamicLevel) / static_cast<float>(articulationDynamicLevel);
 
-        for (auto& pair : m_expressionCtx.expressionCurve) {
+        for (auto& pair : result) {
             pair.second = static_cast<dynamic_level_t>(RealRound(pair.second * ratio, 0));
         }
 
         if (!RealIsNull(requiredVelocityFraction)) {
-            m_expressionCtx.expressionCurve.amplifyVelocity(requiredVelocityFraction);
+            result.amplifyVelocity(requiredVelocityFraction);
         }
+
+        cache[nextIdx] = { source, articulationDynamicLevel, actualDynamicLevel, requiredVelocityFraction, result, true };
+        nextIdx = (nextIdx + 1) % CACHE_SIZE;
+
+        return result;
     }
 
     ArrangementContext m_arrangementCtx;
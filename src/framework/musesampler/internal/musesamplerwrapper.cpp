@@ -24,6 +24,8 @@
 
 #include <cstring>
 
+#include "async/async.h"
+#include "internal/audiosanitizer.h"
 #include "realfn.h"
 
 using namespace mu;
@@ -48,6 +50,10 @@ MuseSamplerWrapper::MuseSamplerWrapper(MuseSamplerLibHandlerPtr samplerLib, cons
 
 MuseSamplerWrapper::~MuseSamplerWrapper()
 {
+    if (m_trackLoading.valid()) {
+        m_trackLoading.wait();
+    }
+
     if (!m_samplerLib || !m_sampler) {
         return;
     }
@@ -106,9 +112,13 @@ samples_t MuseSamplerWrapper::process(float* buffer, audio::samples_t samplesPer
     if (!isActive()) {
         msecs_t nextMicros = samplesToMsecs(samplesPerChannel, m_sampleRate);
 
-        const MuseSamplerSequencer::EventSequence& sequence = m_sequencer.eventsToBePlayed(nextMicros);
-        for (const MuseSamplerSequencer::EventType& event : sequence) {
-            handleAuditionEvents(event);
+        //! NOTE The main stream is scheduled by the sampler itself at the exact positions,
+        //! only the audition events come through the sequencer and they start at the block start
+        const MuseSamplerSequencer::EventSequenceMap sequences = m_sequencer.eventsToBePlayed(nextMicros);
+        for (const auto& pair : sequences) {
+            for (const MuseSamplerSequencer::EventType& event : pair.second) {
+                handleAuditionEvents(event);
+            }
         }
     }
 
@@ -158,34 +168,55 @@ bool MuseSamplerWrapper::isValid() const
 
 void MuseSamplerWrapper::setupSound(const mpe::PlaybackSetupData& setupData)
 {
-    // Check by exact info:
-    int unique_id = params().resourceMeta.attributeVal(u"museUID").toInt();
-    m_track = m_samplerLib->addTrack(m_sampler, unique_id);
-    if (m_track != nullptr) {
-        m_sequencer.init(m_samplerLib, m_sampler, m_track);
+    IF_ASSERT_FAILED(m_samplerLib && m_sampler) {
         return;
+    }
+
+    if (m_trackLoading.valid()) {
+        m_trackLoading.wait();
+    }
+
+    //! NOTE Adding a track loads the instrument presets, which takes a while. So it's done in the background
+    //! as soon as the instrument is known, instead of blocking the audio worker, and the track starts playing once it's loaded
+    int uniqueId = params().resourceMeta.attributeVal(u"museUID").toInt();
+
+    m_trackLoading = std::async(std::launch::async, [this, samplerLib = m_samplerLib, sampler = m_sampler, uniqueId, setupData]() {
+        ms_Track track = loadTrack(samplerLib, sampler, uniqueId, setupData);
+
+        async::Async::call(this, [this, track]() {
+            applyLoadedTrack(track);
+        }, AudioSanitizer::workerThread());
+
+        return track;
+    });
+}
+
+ms_Track MuseSamplerWrapper::loadTrack(MuseSamplerLibHandlerPtr samplerLib, ms_MuseSampler sampler, int uniqueId,
+                                       const mpe::PlaybackSetupData& setupData)
+{
+    // Check by exact info:
+    ms_Track track = samplerLib->addTrack(sampler, uniqueId);
+    if (track != nullptr) {
+        return track;
     } else {
-        LOGE() << "Could not add instrument with ID of " << unique_id;
+        LOGE() << "Could not add instrument with ID of " << uniqueId;
     }
 
     LOGE() << "Something went wrong; falling back to MPE info.";
-    IF_ASSERT_FAILED(m_samplerLib) {
-        return;
-    }
 
     if (!setupData.musicXmlSoundId.has_value()) {
         LOGE() << "Unable to setup MuseSampler";
-        return;
+        return nullptr;
     }
 
     String soundId = setupData.toString();
 
-    auto matchingInstrumentList = m_samplerLib->getMatchingInstrumentList(soundId.toAscii().constChar(),
-                                                                          setupData.musicXmlSoundId->c_str());
+    auto matchingInstrumentList = samplerLib->getMatchingInstrumentList(soundId.toAscii().constChar(),
+                                                                        setupData.musicXmlSoundId->c_str());
 
     if (matchingInstrumentList == nullptr) {
         LOGE() << "Unable to get instrument list";
-        return;
+        return nullptr;
     } else {
         LOGD() << "Successfully got instrument list";
     }
@@ -194,13 +225,13 @@ void MuseSamplerWrapper::setupSound(const mpe::PlaybackSetupData& setupData)
     int internalId = -1;
 
     // TODO: display all of these in MuseScore, and let the user choose!
-    while (auto instrument = m_samplerLib->getNextInstrument(matchingInstrumentList))
+    while (auto instrument = samplerLib->getNextInstrument(matchingInstrumentList))
     {
-        internalId = m_samplerLib->getInstrumentId(instrument);
-        const char* internalName = m_samplerLib->getInstrumentName(instrument);
-        const char* internalCategory = m_samplerLib->getInstrumentCategory(instrument);
-        const char* instrumentPack = m_samplerLib->getInstrumentPackage(instrument);
-        const char* musicXmlId = m_samplerLib->getMusicXmlSoundId(instrument);
+        internalId = samplerLib->getInstrumentId(instrument);
+        const char* internalName = samplerLib->getInstrumentName(instrument);
+        const char* internalCategory = samplerLib->getInstrumentCategory(instrument);
+        const char* instrumentPack = samplerLib->getInstrumentPackage(instrument);
+        const char* musicXmlId = samplerLib->getMusicXmlSoundId(instrument);
 
         LOGD() << internalId
                << ": " << instrumentPack
@@ -216,19 +247,61 @@ void MuseSamplerWrapper::setupSound(const mpe::PlaybackSetupData& setupData)
 
     if (firstInternalId == -1) {
         LOGE() << "Unable to find sound for " << soundId;
-        return;
+        return nullptr;
     }
 
-    m_track = m_samplerLib->addTrack(m_sampler, firstInternalId);
+    return samplerLib->addTrack(sampler, firstInternalId);
+}
+
+void MuseSamplerWrapper::applyLoadedTrack(ms_Track track)
+{
+    ONLY_AUDIO_WORKER_THREAD;
+
+    if (!track) {
+        m_pendingPlaybackData.reset();
+        return;
+    }
 
+    m_track = track;
     m_sequencer.init(m_samplerLib, m_sampler, m_track);
+
+    //! NOTE The playback state may have changed while the track was loading
+    msecs_t position = m_sequencer.playbackPosition();
+
+    if (m_pendingPlaybackData) {
+        m_sequencer.load(m_pendingPlaybackData.value());
+        m_pendingPlaybackData.reset();
+    }
+
+    m_samplerLib->setPlaying(m_sampler, isActive());
+    setCurrentPosition(microSecsToSamples(position, m_sampleRate));
+
+    LOGD() << "MuseSampler track is loaded";
 }
 
 void MuseSamplerWrapper::setupEvents(const mpe::PlaybackData& playbackData)
 {
     ONLY_AUDIO_WORKER_THREAD;
 
-    m_sequencer.load(playbackData);
+    if (m_track) {
+        m_sequencer.load(playbackData);
+        return;
+    }
+
+    //! NOTE The events are added to the track once it's loaded, until then only the latest changes are kept
+    m_pendingPlaybackData = playbackData;
+
+    m_pendingPlaybackData->mainStream.onReceive(this, [this](const mpe::PlaybackEventsMap& changes) {
+        if (m_pendingPlaybackData) {
+            m_pendingPlaybackData->originEvents = changes;
+        }
+    });
+
+    m_pendingPlaybackData->dynamicLevelChanges.onReceive(this, [this](const mpe::DynamicLevelMap& changes) {
+        if (m_pendingPlaybackData) {
+            m_pendingPlaybackData->dynamicLevelMap = changes;
+        }
+    });
 }
 
 void MuseSamplerWrapper::updateRenderingMode(const audio::RenderMode mode)
@@ -253,6 +326,10 @@ void MuseSamplerWrapper::setPlaybackPosition(const audio::msecs_t newPosition)
 {
     m_sequencer.setPlaybackPosition(newPosition);
 
+    if (!m_track) {
+        return;
+    }
+
     setCurrentPosition(microSecsToSamples(newPosition, m_sampleRate));
 }
 
@@ -263,7 +340,7 @@ bool MuseSamplerWrapper::isActive() const
 
 void MuseSamplerWrapper::setIsActive(bool arg)
 {
-    IF_ASSERT_FAILED(m_samplerLib && m_sampler && m_track) {
+    IF_ASSERT_FAILED(m_samplerLib && m_sampler) {
         return;
     }
 
@@ -273,6 +350,11 @@ void MuseSamplerWrapper::setIsActive(bool arg)
 
     m_sequencer.setActive(arg);
 
+    //! NOTE Applied once the track is loaded
+    if (!m_track) {
+        return;
+    }
+
     m_samplerLib->setPlaying(m_sampler, arg);
 
     if (!isActive()) {
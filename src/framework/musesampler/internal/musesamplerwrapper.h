@@ -24,6 +24,8 @@
 #define MU_MUSESAMPLER_MUSESAMPLERWRAPPER_H
 
 #include <memory>
+#include <future>
+#include <optional>
 
 #include "audio/abstractsynthesizer.h"
 #include "async/channel.h"
@@ -60,6 +62,10 @@ protected:
     bool isActive() const override;
     void setIsActive(bool arg) override;
 
+    static ms_Track loadTrack(MuseSamplerLibHandlerPtr samplerLib, ms_MuseSampler sampler, int uniqueId,
+                              const mpe::PlaybackSetupData& setupData);
+    void applyLoadedTrack(ms_Track track);
+
     void handleAuditionEvents(const MuseSamplerSequencer::EventType& event);
     void setCurrentPosition(const audio::samples_t samples);
     void extractOutputSamples(audio::samples_t samples, float* output);
@@ -71,6 +77,9 @@ protected:
     ms_Track m_track = nullptr;
     ms_OutputBuffer m_bus;
 
+    std::future<ms_Track> m_trackLoading;
+    std::optional<mpe::PlaybackData> m_pendingPlaybackData;
+
     audio::samples_t m_currentPosition = 0;
 
     std::vector<float> m_leftChannel;
@@ -43,7 +43,7 @@ void EditMidiMappingModel::load(int originType, int originValue)
 {
     midiRemote()->setIsSettingMode(true);
 
-    midiInPort()->eventReceived().onReceive(this, [this](tick_t, const Event& event) {
+    midiInPort()->eventReceived().onReceive(this, [this](tick_t, const Event& event, timestamp_t) {
         if (event.opcode() == Event::Opcode::NoteOn || event.opcode() == Event::Opcode::ControlChange) {
             m_event = remoteEventFromMidiEvent(event);
             emit mappingTitleChanged(mappingTitle());
@@ -177,22 +177,27 @@ async::Channel<unsigned int> VstSynthesiser::audioChannelsCountChanged() const
 
 audio::samples_t VstSynthesiser::process(float* buffer, audio::samples_t samplesPerChannel)
 {
-    if (!buffer) {
+    if (!buffer || samplesPerChannel == 0) {
         return 0;
     }
 
     audio::msecs_t nextMsecs = samplesToMsecs(samplesPerChannel, m_sampleRate);
 
-    const VstSequencer::EventSequence& sequence = m_sequencer.eventsToBePlayed(nextMsecs);
-
-    for (const VstSequencer::EventType& event : sequence) {
-        if (std::holds_alternative<VstEvent>(event)) {
-            m_vstAudioClient->handleEvent(std::get<VstEvent>(event));
-        } else if (std::holds_alternative<PluginParamInfo>(event)) {
-            m_vstAudioClient->handleParamChange(std::get<PluginParamInfo>(event));
-        } else {
-            audio::gain_t newGain = std::get<audio::gain_t>(event);
-            m_vstAudioClient->setVolumeGain(newGain);
+    const VstSequencer::EventSequenceMap sequences = m_sequencer.eventsToBePlayed(nextMsecs);
+
+    for (const auto& pair : sequences) {
+        //! NOTE The plugin applies the events at their offsets within the block by itself
+        audio::samples_t sampleOffset = std::min(microSecsToSamples(pair.first, m_sampleRate), samplesPerChannel - 1);
+
+        for (const VstSequencer::EventType& event : pair.second) {
+            if (std::holds_alternative<VstEvent>(event)) {
+                m_vstAudioClient->handleEvent(std::get<VstEvent>(event), sampleOffset);
+            } else if (std::holds_alternative<PluginParamInfo>(event)) {
+                m_vstAudioClient->handleParamChange(std::get<PluginParamInfo>(event), sampleOffset);
+            } else {
+                audio::gain_t newGain = std::get<audio::gain_t>(event);
+                m_vstAudioClient->setVolumeGain(newGain);
+            }
         }
     }
 
@@ -50,18 +50,21 @@ void VstAudioClient::init(VstPluginType&& type, VstPluginPtr plugin, audio::audi
     m_audioChannelsCount = audioChannelsCount;
 }
 
-bool VstAudioClient::handleEvent(const VstEvent& event)
+bool VstAudioClient::handleEvent(const VstEvent& event, const audio::samples_t sampleOffset)
 {
     ensureActivity();
 
-    if (m_eventList.addEvent(const_cast<VstEvent&>(event)) == Steinberg::kResultTrue) {
+    VstEvent offsetEvent = event;
+    offsetEvent.sampleOffset = static_cast<Steinberg::int32>(sampleOffset);
+
+    if (m_eventList.addEvent(offsetEvent) == Steinberg::kResultTrue) {
         return true;
     }
 
     return false;
 }
 
-bool VstAudioClient::handleParamChange(const PluginParamInfo& param)
+bool VstAudioClient::handleParamChange(const PluginParamInfo& param, const audio::samples_t sampleOffset)
 {
     IF_ASSERT_FAILED(m_pluginPtr && m_pluginPtr->provider()) {
         return false;
@@ -72,7 +75,7 @@ bool VstAudioClient::handleParamChange(const PluginParamInfo& param)
     Steinberg::int32 dummyIdx = 0;
     Steinberg::Vst::IParamValueQueue* queue = m_paramChanges.addParameterData(param.id, dummyIdx);
     if (queue) {
-        queue->addPoint(0, param.defaultNormalizedValue, dummyIdx);
+        queue->addPoint(static_cast<Steinberg::int32>(sampleOffset), param.defaultNormalizedValue, dummyIdx);
     }
 
     return true;
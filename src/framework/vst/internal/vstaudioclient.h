@@ -29,6 +29,8 @@
 #include "vsttypes.h"
 
 namespace mu::vst {
+//! NOTE The plugin is processed in the process of the app, on the worker that renders its track.
+//! The tracks are rendered concurrently (see AudioWorkerPool), so a heavy plugin only holds up its own track
 class VstAudioClient
 {
 public:
@@ -37,8 +39,8 @@ public:
 
     void init(VstPluginType&& type, VstPluginPtr plugin, audio::audioch_t&& audioChannelsCount = 2);
 
-    bool handleEvent(const VstEvent& event);
-    bool handleParamChange(const PluginParamInfo& param);
+    bool handleEvent(const VstEvent& event, const audio::samples_t sampleOffset = 0);
+    bool handleParamChange(const PluginParamInfo& param, const audio::samples_t sampleOffset = 0);
     void setVolumeGain(const audio::gain_t newVolumeGain);
 
     audio::samples_t process(float* output, audio::samples_t samplesPerChannel);
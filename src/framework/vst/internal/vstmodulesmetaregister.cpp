@@ -51,13 +51,20 @@ void VstModulesMetaRegister::registerPath(const audio::AudioResourceId& resource
     io::File file(m_knownPluginsDir + "/" + resourceId + ".json");
     file.open(io::IODevice::WriteOnly);
 
+    //! NOTE Until the module is loaded, the plugin stays disabled. So a plugin, which crashed the scan,
+    //! isn't scanned again until its module is modified
+    QString modified = modifiedTime(path);
+
     QJsonObject obj;
     obj.insert(QStringLiteral("enabled"), false);
     obj.insert(QStringLiteral("type"), "");
     obj.insert(QStringLiteral("meta"), "");
     obj.insert(QStringLiteral("path"), path.toQString());
+    obj.insert(QStringLiteral("modified"), modified);
 
-    m_paths.emplace(resourceId, path);
+    m_paths[resourceId] = path;
+    m_modifiedTimes[resourceId] = modified;
+    removeMeta(resourceId);
 
     file.write(QJsonDocument(obj).toJson());
     file.close();
@@ -105,6 +112,7 @@ void VstModulesMetaRegister::registerPlugin(const audio::AudioResourceId& resour
             obj.insert(QStringLiteral("type"), pluginTypeToString(currentType));
             obj.insert(QStringLiteral("meta"), metaToJson(meta));
             obj.insert(QStringLiteral("path"), pluginPath->second.toQString());
+            obj.insert(QStringLiteral("modified"), m_modifiedTimes[resourceId]);
 
             m_metaMap[currentType].insert(std::move(meta));
 
@@ -120,6 +128,27 @@ void VstModulesMetaRegister::clear()
 {
     m_paths.clear();
     m_metaMap.clear();
+    m_modifiedTimes.clear();
+}
+
+QString VstModulesMetaRegister::modifiedTime(const io::path_t& path) const
+{
+    return fileSystem()->lastModified(path).toString().toQString();
+}
+
+void VstModulesMetaRegister::removeMeta(const audio::AudioResourceId& resourceId)
+{
+    for (auto& pair : m_metaMap) {
+        audio::AudioResourceMetaSet& metaSet = pair.second;
+
+        for (auto it = metaSet.begin(); it != metaSet.end();) {
+            if (it->id == resourceId) {
+                it = metaSet.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
 }
 
 const io::path_t& VstModulesMetaRegister::pluginPath(const audio::AudioResourceId& resourceId) const
@@ -164,6 +193,22 @@ bool VstModulesMetaRegister::isEmpty() const
     return m_metaMap.empty() && m_paths.empty();
 }
 
+bool VstModulesMetaRegister::isActual(const io::path_t& path) const
+{
+    audio::AudioResourceId resourceId = io::basename(path).toStdString();
+    if (!exists(resourceId)) {
+        return false;
+    }
+
+    //! NOTE The plugins scanned before the modification times were stored are taken as they are
+    auto search = m_modifiedTimes.find(resourceId);
+    if (search == m_modifiedTimes.cend() || search->second.isEmpty()) {
+        return true;
+    }
+
+    return search->second == modifiedTime(path);
+}
+
 void VstModulesMetaRegister::load()
 {
     RetVal<io::paths_t> paths = fileSystem()->scanFiles(m_knownPluginsDir,
@@ -189,7 +234,10 @@ void VstModulesMetaRegister::load()
         }
 
         io::path_t pluginPath(object.value(QStringLiteral("path")).toString().toStdString());
-        m_paths.emplace(io::basename(pluginPath).toStdString(), std::move(pluginPath));
+        audio::AudioResourceId resourceId = io::basename(pluginPath).toStdString();
+
+        m_modifiedTimes.emplace(resourceId, object.value(QStringLiteral("modified")).toString());
+        m_paths.emplace(std::move(resourceId), std::move(pluginPath));
 
         file.close();
     }
@@ -56,9 +56,15 @@ public:
     bool exists(const io::path_t& path) const;
     bool isEmpty() const;
 
+    //! NOTE The plugin is known and its module hasn't been modified since it was scanned
+    bool isActual(const io::path_t& path) const;
+
 private:
     void clear();
 
+    QString modifiedTime(const io::path_t& path) const;
+    void removeMeta(const audio::AudioResourceId& resourceId);
+
     void load();
     void save();
 
@@ -73,6 +79,7 @@ private:
 
     std::map<VstPluginType, audio::AudioResourceMetaSet> m_metaMap;
     PathMap m_paths;
+    std::unordered_map<audio::AudioResourceId, QString> m_modifiedTimes;
 };
 }
 
@@ -143,14 +143,15 @@ void VstModulesRepository::refresh()
 
     m_modules.clear();
 
+    //! NOTE Only the new and the modified plugins are scanned, the others are taken from the known plugins
     for (const std::string& pluginPath : pluginPathsFromDefaultLocation()) {
-        if (!m_knownPlugins.exists(io::path_t(pluginPath))) {
+        if (!m_knownPlugins.isActual(io::path_t(pluginPath))) {
             addModule(io::path_t(pluginPath));
         }
     }
 
     for (const io::path_t& pluginPath : pluginPathsFromCustomLocations(configuration()->userVstDirectories())) {
-        if (!m_knownPlugins.exists(pluginPath)) {
+        if (!m_knownPlugins.isActual(pluginPath)) {
             addModule(pluginPath);
         }
     }
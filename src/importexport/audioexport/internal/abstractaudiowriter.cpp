@@ -91,6 +91,25 @@ mu::framework::Progress AbstractAudioWriter::progress() const
     return m_progress;
 }
 
+mu::Ret AbstractAudioWriter::writeFormats(INotationPtr notation, const WriterDevices& writers, const Options& options)
+{
+    audio::SoundTrackDestinations destinations;
+    for (const auto& [writer, device] : writers) {
+        const AbstractAudioWriter* audioWriter = dynamic_cast<const AbstractAudioWriter*>(writer.get());
+        QFile* file = qobject_cast<QFile*>(device);
+        if (!audioWriter || !file) {
+            return INotationWriter::writeFormats(notation, writers, options);
+        }
+
+        destinations.push_back({ io::path_t(QFileInfo(*file).absoluteFilePath()), audioWriter->soundTrackFormat() });
+    }
+
+    //! NOTE The formats are rendered together at the export sample rate
+    doWriteAndWait(notation, destinations);
+
+    return make_ret(Ret::Code::Ok);
+}
+
 void AbstractAudioWriter::doWriteAndWait(INotationPtr notation, QIODevice& destinationDevice, const audio::SoundTrackFormat& format)
 {
     //!Note Temporary workaround, since QIODevice is the alias for QIODevice, which falls with SIGSEGV
@@ -101,6 +120,11 @@ void AbstractAudioWriter::doWriteAndWait(INotationPtr notation, QIODevice& desti
     QFileInfo info(*file);
     QString path = info.absoluteFilePath();
 
+    doWriteAndWait(notation, { audio::SoundTrackDestination { io::path_t(path), format } });
+}
+
+void AbstractAudioWriter::doWriteAndWait(INotationPtr notation, const audio::SoundTrackDestinations& destinations)
+{
     m_isCompleted = false;
 
     playbackController()->setNotation(notation);
@@ -112,7 +136,7 @@ void AbstractAudioWriter::doWriteAndWait(INotationPtr notation, QIODevice& desti
     });
 
     playback()->sequenceIdList()
-    .onResolve(this, [this, path, &format](const audio::TrackSequenceIdList& sequenceIdList) {
+    .onResolve(this, [this, destinations](const audio::TrackSequenceIdList& sequenceIdList) {
         m_progress.started.notify();
 
         for (const audio::TrackSequenceId sequenceId : sequenceIdList) {
@@ -121,9 +145,11 @@ void AbstractAudioWriter::doWriteAndWait(INotationPtr notation, QIODevice& desti
                 m_progress.progressChanged.send(current, total, title);
             });
 
-            playback()->audioOutput()->saveSoundTrack(sequenceId, io::path_t(path), std::move(format))
-            .onResolve(this, [this, path](const bool /*result*/) {
-                LOGD() << "Successfully saved sound track by path: " << path;
+            playback()->audioOutput()->saveSoundTracks(sequenceId, destinations)
+            .onResolve(this, [this, destinations](const bool /*result*/) {
+                for (const audio::SoundTrackDestination& destination : destinations) {
+                    LOGD() << "Successfully saved sound track by path: " << destination.path;
+                }
                 m_isCompleted = true;
                 m_progress.finished.send(make_ok());
             })
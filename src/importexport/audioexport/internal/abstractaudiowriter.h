@@ -45,13 +45,17 @@ public:
 
     Ret write(notation::INotationPtr notation, QIODevice& destinationDevice, const Options& options = Options()) override;
     Ret writeList(const notation::INotationPtrList& notations, QIODevice& destinationDevice, const Options& options = Options()) override;
+    Ret writeFormats(notation::INotationPtr notation, const WriterDevices& writers, const Options& options = Options()) override;
 
     bool supportsProgressNotifications() const override;
     framework::Progress progress() const override;
     void abort() override;
 
 protected:
+    virtual audio::SoundTrackFormat soundTrackFormat() const = 0;
+
     void doWriteAndWait(notation::INotationPtr notation, QIODevice& destinationDevice, const audio::SoundTrackFormat& format);
+    void doWriteAndWait(notation::INotationPtr notation, const audio::SoundTrackDestinations& destinations);
 
     UnitType unitTypeFromOptions(const Options& options) const;
     framework::Progress m_progress;
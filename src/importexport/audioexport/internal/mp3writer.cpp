@@ -29,14 +29,17 @@ using namespace mu::framework;
 
 mu::Ret Mp3Writer::write(notation::INotationPtr notation, QIODevice& destinationDevice, const Options&)
 {
-    const audio::SoundTrackFormat format {
+    doWriteAndWait(notation, destinationDevice, soundTrackFormat());
+
+    return make_ret(Ret::Code::Ok);
+}
+
+mu::audio::SoundTrackFormat Mp3Writer::soundTrackFormat() const
+{
+    return {
         audio::SoundTrackType::MP3,
         static_cast<audio::sample_rate_t>(configuration()->exportSampleRate()),
         2 /* audioChannelsNumber */,
         configuration()->exportMp3Bitrate()
     };
-
-    doWriteAndWait(notation, destinationDevice, format);
-
-    return make_ret(Ret::Code::Ok);
 }
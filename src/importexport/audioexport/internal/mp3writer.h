@@ -30,6 +30,9 @@ class Mp3Writer : public AbstractAudioWriter
 {
 public:
     Ret write(notation::INotationPtr notation, QIODevice& destinationDevice, const Options& options = Options()) override;
+
+protected:
+    audio::SoundTrackFormat soundTrackFormat() const override;
 };
 }
 
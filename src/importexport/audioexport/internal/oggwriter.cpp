@@ -29,14 +29,17 @@ using namespace mu::io;
 
 mu::Ret OggWriter::write(notation::INotationPtr notation, QIODevice& destinationDevice, const Options&)
 {
-    const audio::SoundTrackFormat format {
+    doWriteAndWait(notation, destinationDevice, soundTrackFormat());
+
+    return make_ret(Ret::Code::Ok);
+}
+
+mu::audio::SoundTrackFormat OggWriter::soundTrackFormat() const
+{
+    return {
         audio::SoundTrackType::OGG,
         static_cast<audio::sample_rate_t>(configuration()->exportSampleRate()),
         2 /* audioChannelsNumber */,
         128 /* bitRate */
     };
-
-    doWriteAndWait(notation, destinationDevice, format);
-
-    return make_ret(Ret::Code::Ok);
 }
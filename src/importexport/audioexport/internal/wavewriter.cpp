@@ -29,14 +29,17 @@ using namespace mu::framework;
 
 mu::Ret WaveWriter::write(notation::INotationPtr notation, QIODevice& destinationDevice, const Options&)
 {
-    const audio::SoundTrackFormat format {
+    doWriteAndWait(notation, destinationDevice, soundTrackFormat());
+
+    return make_ret(Ret::Code::Ok);
+}
+
+mu::audio::SoundTrackFormat WaveWriter::soundTrackFormat() const
+{
+    return {
         audio::SoundTrackType::WAV,
         static_cast<audio::sample_rate_t>(configuration()->exportSampleRate()),
         2 /* audioChannelsNumber */,
         0 /* bitRate */
     };
-
-    doWriteAndWait(notation, destinationDevice, format);
-
-    return make_ret(Ret::Code::Ok);
 }
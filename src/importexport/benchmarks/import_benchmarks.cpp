@@ -0,0 +1,231 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <gtest/gtest.h>
+
+#include <QBuffer>
+#include <QFile>
+
+#include "io/file.h"
+
+#include "importexport/capella/internal/capella.h"
+#include "importexport/midi/internal/midishared/midifile.h"
+#include "importexport/musedata/internal/musedata.h"
+#include "importexport/musicxml/internal/musicxml/exportxml.h"
+
+#include "importbenchmark.h"
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace mu::iex::benchmark;
+
+namespace mu::iex::bb {
+extern Err importBB(MasterScore* score, const QString& name);
+}
+
+namespace mu::iex::bww {
+extern Err importBww(MasterScore* score, const QString& path);
+}
+
+namespace mu::iex::capella {
+extern Err importCapella(MasterScore*, const QString& name);
+extern Err importCapXml(MasterScore*, const QString& name);
+}
+
+namespace mu::iex::midi {
+extern Err importMidi(MasterScore*, const QString& name);
+}
+
+extern Err importOve(MasterScore*, const QString& name);
+
+namespace mu::engraving {
+extern Err importGTP(MasterScore*, mu::io::IODevice* io, bool createLinkedTabForce = false);
+extern Err importMusicXml(MasterScore*, const QString&);
+extern Err importCompressedMusicXml(MasterScore*, const QString&);
+}
+
+//! NOTE The corpora are the data folders of the importer tests,
+//! the reference files next to them are filtered out by the suffix
+static io::path_t corpusDir(const char* format)
+{
+    return io::path_t(iex_benchmarks_DATA_ROOT) + "/" + format;
+}
+
+static io::path_t oldCorpusDir(const char* format)
+{
+    return io::path_t(iex_benchmarks_OLD_DATA_ROOT) + "/" + format;
+}
+
+class Import_Benchmarks : public ::testing::Test
+{
+};
+
+TEST_F(Import_Benchmarks, BB)
+{
+    auto importFunc = [](MasterScore* score, const io::path_t& path) {
+        return mu::iex::bb::importBB(score, path.toQString());
+    };
+
+    EXPECT_GT(ImportBenchmark::instance()->runCorpus("bb", corpusDir("bb/tests/data"),
+                                                     { "*.mgu", "*.MGU", "*.sgu", "*.SGU" }, importFunc), 0u);
+}
+
+TEST_F(Import_Benchmarks, Bww)
+{
+    auto importFunc = [](MasterScore* score, const io::path_t& path) {
+        return mu::iex::bww::importBww(score, path.toQString());
+    };
+
+    EXPECT_GT(ImportBenchmark::instance()->runCorpus("bww", corpusDir("bww/tests/data"), { "*.bww" }, importFunc), 0u);
+}
+
+TEST_F(Import_Benchmarks, Capella)
+{
+    auto parseFunc = [](const io::path_t& path) {
+        QFile file(path.toQString());
+        if (!file.open(QIODevice::ReadOnly)) {
+            return false;
+        }
+
+        mu::iex::capella::Capella cf;
+        try {
+            cf.read(&file);
+        }
+        catch (mu::iex::capella::Capella::Error) {
+            return false;
+        }
+
+        return true;
+    };
+
+    auto importFunc = [](MasterScore* score, const io::path_t& path) {
+        return mu::iex::capella::importCapella(score, path.toQString());
+    };
+
+    EXPECT_GT(ImportBenchmark::instance()->runCorpus("cap", corpusDir("capella/tests/data"), { "*.cap" }, importFunc, parseFunc), 0u);
+}
+
+TEST_F(Import_Benchmarks, CapXml)
+{
+    auto importFunc = [](MasterScore* score, const io::path_t& path) {
+        return mu::iex::capella::importCapXml(score, path.toQString());
+    };
+
+    EXPECT_GT(ImportBenchmark::instance()->runCorpus("capx", corpusDir("capella/tests/data"), { "*.capx" }, importFunc), 0u);
+}
+
+TEST_F(Import_Benchmarks, GuitarPro)
+{
+    auto importFunc = [](MasterScore* score, const io::path_t& path) {
+        mu::io::File file(path);
+        return mu::engraving::importGTP(score, &file);
+    };
+
+    EXPECT_GT(ImportBenchmark::instance()->runCorpus("guitarpro", corpusDir("guitarpro/tests/data"),
+                                                     { "*.gp", "*.gp3", "*.gp4", "*.gp5", "*.gpx" }, importFunc), 0u);
+}
+
+TEST_F(Import_Benchmarks, Midi)
+{
+    auto parseFunc = [](const io::path_t& path) {
+        QFile file(path.toQString());
+        if (!file.open(QIODevice::ReadOnly)) {
+            return false;
+        }
+
+        mu::iex::midi::MidiFile mf;
+        try {
+            return mf.read(&file);
+        }
+        catch (QString) {
+            return false;
+        }
+    };
+
+    auto importFunc = [](MasterScore* score, const io::path_t& path) {
+        return mu::iex::midi::importMidi(score, path.toQString());
+    };
+
+    EXPECT_GT(ImportBenchmark::instance()->runCorpus("midi", corpusDir("midi/tests/midiimport_data"), { "*.mid" }, importFunc,
+                                                     parseFunc), 0u);
+}
+
+TEST_F(Import_Benchmarks, MusicXml)
+{
+    auto importFunc = [](MasterScore* score, const io::path_t& path) {
+        return mu::engraving::importMusicXml(score, path.toQString());
+    };
+
+    //! NOTE Round trip, the imported score is exported back into memory
+    auto exportFunc = [](Score* score) {
+        QBuffer buffer;
+        buffer.open(QIODevice::WriteOnly);
+        return mu::engraving::saveXml(score, &buffer);
+    };
+
+    EXPECT_GT(ImportBenchmark::instance()->runCorpus("musicxml", corpusDir("musicxml/tests/data"), { "*.xml" }, importFunc, nullptr,
+                                                     exportFunc), 0u);
+}
+
+TEST_F(Import_Benchmarks, CompressedMusicXml)
+{
+    auto importFunc = [](MasterScore* score, const io::path_t& path) {
+        return mu::engraving::importCompressedMusicXml(score, path.toQString());
+    };
+
+    EXPECT_GT(ImportBenchmark::instance()->runCorpus("mxl", corpusDir("musicxml/tests/data"), { "*.mxl" }, importFunc), 0u);
+}
+
+TEST_F(Import_Benchmarks, MuseData)
+{
+    auto parseFunc = [](const io::path_t& path) {
+        //! NOTE The parts are only read into lines here, the score is not touched before convert()
+        mu::iex::musedata::MuseData md(nullptr);
+        return md.read(path.toQString());
+    };
+
+    auto importFunc = [](MasterScore* score, const io::path_t& path) {
+        mu::iex::musedata::MuseData md(score);
+        if (!md.read(path.toQString())) {
+            return Err::FileUnknownError;
+        }
+
+        md.convert();
+        return Err::NoError;
+    };
+
+    EXPECT_GT(ImportBenchmark::instance()->runCorpus("musedata", oldCorpusDir("md"), { "*.md" }, importFunc, parseFunc), 0u);
+}
+
+TEST_F(Import_Benchmarks, Ove)
+{
+    auto importFunc = [](MasterScore* score, const io::path_t& path) {
+        return importOve(score, path.toQString());
+    };
+
+    size_t okCount = 0;
+    for (const char* dir : { "testoves/bdat", "testoves/ove3", "testoves/structure" }) {
+        okCount += ImportBenchmark::instance()->runCorpus("ove", oldCorpusDir(dir), { "*.ove" }, importFunc);
+    }
+
+    EXPECT_GT(okCount, 0u);
+}
@@ -0,0 +1,321 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "importbenchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+#include <QtGlobal>
+
+#if defined(Q_OS_WIN)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(Q_OS_LINUX)
+#include <cstring>
+#else
+#include <sys/resource.h>
+#endif
+
+#include <gtest/gtest.h>
+
+#include "io/dir.h"
+#include "io/fileinfo.h"
+
+#include "engraving/compat/scoreaccess.h"
+#include "engraving/infrastructure/localfileinfoprovider.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::engraving;
+using namespace mu::iex::benchmark;
+
+//! NOTE Bumped when the report layout changes, so the trend tooling can tell the reports apart
+static constexpr int REPORT_VERSION = 2;
+
+//! NOTE The slowest files are also printed to the log, so a run is useful without the report
+static constexpr size_t SLOWEST_FILES_LOG_COUNT = 5;
+
+using Clock = std::chrono::steady_clock;
+
+static double elapsedMs(const Clock::time_point& start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+static double totalMs(const FileResult& r)
+{
+    return std::max(r.parseMs, 0.0) + r.convertMs + r.layoutMs + std::max(r.exportMs, 0.0);
+}
+
+static std::string formatMs(double ms)
+{
+    char buf[64];
+    std::snprintf(buf, sizeof(buf), "%.3f", ms);
+    return buf;
+}
+
+static std::string jsonEscaped(const std::string& str)
+{
+    std::string result;
+    result.reserve(str.size());
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            result.push_back('\\');
+        }
+        result.push_back(c);
+    }
+    return result;
+}
+
+//---------------------------------------------------------
+//   resetPeakMemory
+//    only Linux allows to reset the peak, on the other systems
+//    the peak of a file is the peak of the process so far
+//---------------------------------------------------------
+
+static void resetPeakMemory()
+{
+#if defined(Q_OS_LINUX)
+    if (FILE* f = std::fopen("/proc/self/clear_refs", "w")) {
+        std::fputs("5", f);
+        std::fclose(f);
+    }
+#endif
+}
+
+static uint64_t peakMemoryKb()
+{
+#if defined(Q_OS_WIN)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.PeakWorkingSetSize / 1024;
+    }
+    return 0;
+#elif defined(Q_OS_LINUX)
+    uint64_t peak = 0;
+    if (FILE* f = std::fopen("/proc/self/status", "r")) {
+        char line[256];
+        while (std::fgets(line, sizeof(line), f)) {
+            if (std::strncmp(line, "VmHWM:", 6) == 0) {
+                peak = std::strtoull(line + 6, nullptr, 10);
+                break;
+            }
+        }
+        std::fclose(f);
+    }
+    return peak;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#if defined(Q_OS_MAC)
+    return static_cast<uint64_t>(usage.ru_maxrss) / 1024; // bytes on macOS
+#else
+    return static_cast<uint64_t>(usage.ru_maxrss);
+#endif
+#endif
+}
+
+ImportBenchmark* ImportBenchmark::instance()
+{
+    static ImportBenchmark b;
+    return &b;
+}
+
+size_t ImportBenchmark::runCorpus(const std::string& format, const io::path_t& dir, const std::vector<std::string>& filters,
+                                  const ImportFunc& importFunc, const ParseFunc& parseFunc, const ExportFunc& exportFunc)
+{
+    RetVal<io::paths_t> files = io::Dir::scanFiles(dir, filters, io::ScanMode::FilesInCurrentDir);
+    if (!files.ret) {
+        LOGE() << "failed to scan the corpus: " << dir << ", err: " << files.ret.toString();
+        return 0;
+    }
+
+    std::sort(files.val.begin(), files.val.end());
+
+    std::vector<FileResult> corpus;
+    size_t okCount = 0;
+    double corpusMs = 0.0;
+
+    for (const io::path_t& path : files.val) {
+        FileResult r = runFile(format, path, importFunc, parseFunc, exportFunc);
+        if (r.ok) {
+            ++okCount;
+        }
+
+        corpusMs += totalMs(r);
+        corpus.push_back(std::move(r));
+    }
+
+    m_results.insert(m_results.end(), corpus.begin(), corpus.end());
+
+    std::sort(corpus.begin(), corpus.end(), [](const FileResult& f, const FileResult& s) {
+        return totalMs(f) > totalMs(s);
+    });
+
+    LOGI() << format << ": " << okCount << "/" << files.val.size() << " files in " << formatMs(corpusMs) << " ms";
+    for (size_t i = 0; i < corpus.size() && i < SLOWEST_FILES_LOG_COUNT; ++i) {
+        const FileResult& r = corpus[i];
+        LOGI() << "    " << r.file << ": " << formatMs(totalMs(r)) << " ms (convert " << formatMs(r.convertMs)
+               << " ms, layout " << formatMs(r.layoutMs) << " ms"
+               << (r.exportMs >= 0.0 ? ", export " + formatMs(r.exportMs) + " ms" : std::string())
+               << "), peak " << r.peakMemoryKb << " KB";
+    }
+
+    return okCount;
+}
+
+FileResult ImportBenchmark::runFile(const std::string& format, const io::path_t& path, const ImportFunc& importFunc,
+                                    const ParseFunc& parseFunc, const ExportFunc& exportFunc) const
+{
+    FileResult result;
+    result.format = format;
+    result.file = io::filename(path).toStdString();
+
+    resetPeakMemory();
+
+    if (parseFunc) {
+        Clock::time_point start = Clock::now();
+        bool parsed = parseFunc(path);
+        result.parseMs = elapsedMs(start);
+
+        if (!parsed) {
+            result.peakMemoryKb = peakMemoryKb();
+            return result;
+        }
+    }
+
+    MasterScore* score = compat::ScoreAccess::createMasterScoreWithBaseStyle();
+    score->setFileInfoProvider(std::make_shared<LocalFileInfoProvider>(path));
+
+    Err err = Err::NoError;
+    {
+        ScoreLoad sl;
+        Clock::time_point start = Clock::now();
+        err = importFunc(score, path);
+        //! NOTE The import parses the file once more, that time is not the conversion
+        result.convertMs = std::max(elapsedMs(start) - std::max(result.parseMs, 0.0), 0.0);
+    }
+
+    if (err == Err::NoError) {
+        Clock::time_point start = Clock::now();
+        for (Score* s : score->scoreList()) {
+            s->doLayout();
+        }
+        result.layoutMs = elapsedMs(start);
+        result.pageCount = static_cast<int>(score->npages());
+        result.ok = true;
+
+        if (exportFunc) {
+            start = Clock::now();
+            result.ok = exportFunc(score);
+            result.exportMs = elapsedMs(start);
+
+            if (!result.ok) {
+                LOGW() << "failed to export: " << path;
+            }
+        }
+    } else {
+        LOGW() << "failed to import: " << path << ", err: " << static_cast<int>(err);
+    }
+
+    delete score;
+
+    result.peakMemoryKb = peakMemoryKb();
+
+    return result;
+}
+
+void ImportBenchmark::writeJson(std::ostream& out) const
+{
+    //! NOTE Sorted by the format and the file and with the fixed formatting,
+    //! so the reports of different runs can be diffed
+    std::vector<const FileResult*> results;
+    for (const FileResult& r : m_results) {
+        results.push_back(&r);
+    }
+
+    std::sort(results.begin(), results.end(), [](const FileResult* f, const FileResult* s) {
+        return f->format != s->format ? f->format < s->format : f->file < s->file;
+    });
+
+    out << "{\n";
+    out << "  \"version\": " << REPORT_VERSION << ",\n";
+    out << "  \"unit\": \"ms\",\n";
+    out << "  \"memoryUnit\": \"KB\",\n";
+    out << "  \"imports\": [";
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        const FileResult* r = results[i];
+        out << (i == 0 ? "\n" : ",\n");
+        out << "    { \"format\": \"" << jsonEscaped(r->format) << "\""
+            << ", \"file\": \"" << jsonEscaped(r->file) << "\""
+            << ", \"ok\": " << (r->ok ? "true" : "false");
+        if (r->parseMs >= 0.0) {
+            out << ", \"parse\": " << formatMs(r->parseMs);
+        }
+        out << ", \"convert\": " << formatMs(r->convertMs)
+            << ", \"layout\": " << formatMs(r->layoutMs);
+        if (r->exportMs >= 0.0) {
+            out << ", \"export\": " << formatMs(r->exportMs);
+        }
+        out << ", \"pages\": " << r->pageCount
+            << ", \"peakMemory\": " << r->peakMemoryKb
+            << " }";
+    }
+
+    out << "\n  ]\n";
+    out << "}\n";
+}
+
+//---------------------------------------------------------
+//   ReportEnvironment
+//---------------------------------------------------------
+
+class ReportEnvironment : public ::testing::Environment
+{
+public:
+    void TearDown() override
+    {
+        const char* path = std::getenv("MU_BENCHMARK_OUTPUT");
+        if (!path || !path[0]) {
+            ImportBenchmark::instance()->writeJson(std::cout);
+            return;
+        }
+
+        std::ofstream file(path);
+        if (!file) {
+            LOGE() << "failed to open the benchmark output: " << path;
+            return;
+        }
+
+        ImportBenchmark::instance()->writeJson(file);
+    }
+};
+
+static ::testing::Environment* const s_reportEnvironment = ::testing::AddGlobalTestEnvironment(new ReportEnvironment());
@@ -0,0 +1,88 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_IMPORTEXPORT_IMPORTBENCHMARK_H
+#define MU_IMPORTEXPORT_IMPORTBENCHMARK_H
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <ostream>
+
+#include "io/path.h"
+
+#include "engraving/engravingerrors.h"
+#include "engraving/libmscore/masterscore.h"
+
+namespace mu::iex::benchmark {
+//---------------------------------------------------------
+//   ImportBenchmark
+//    imports every file of a corpus once, times the parsing, the conversion
+//    and the first layout separately and records the peak memory of each file,
+//    optionally also exports the laid out score and times the export.
+//    The report is written on exit to the file from MU_BENCHMARK_OUTPUT, or to stdout
+//---------------------------------------------------------
+
+struct FileResult {
+    std::string format;
+    std::string file;
+    bool ok = false;
+    //! NOTE Negative when the importer has no separate parser to time,
+    //! then the parsing is counted in the conversion time
+    double parseMs = -1.0;
+    double convertMs = 0.0;
+    double layoutMs = 0.0;
+    //! NOTE Negative when the corpus is not exported
+    double exportMs = -1.0;
+    int pageCount = 0;
+    uint64_t peakMemoryKb = 0;
+};
+
+class ImportBenchmark
+{
+public:
+    static ImportBenchmark* instance();
+
+    //! NOTE Parses the file into the importer's own model only, without a score
+    using ParseFunc = std::function<bool (const io::path_t& path)>;
+    //! NOTE Parses (once more) and converts the file into the score
+    using ImportFunc = std::function<engraving::Err (engraving::MasterScore* score, const io::path_t& path)>;
+    //! NOTE Exports the laid out score in memory
+    using ExportFunc = std::function<bool (engraving::Score* score)>;
+
+    //! NOTE Returns the number of the files imported successfully
+    size_t runCorpus(const std::string& format, const io::path_t& dir, const std::vector<std::string>& filters,
+                     const ImportFunc& importFunc, const ParseFunc& parseFunc = nullptr,
+                     const ExportFunc& exportFunc = nullptr);
+
+    void writeJson(std::ostream& out) const;
+
+private:
+    ImportBenchmark() = default;
+
+    FileResult runFile(const std::string& format, const io::path_t& path, const ImportFunc& importFunc,
+                       const ParseFunc& parseFunc, const ExportFunc& exportFunc) const;
+
+    std::vector<FileResult> m_results;
+};
+}
+
+#endif // MU_IMPORTEXPORT_IMPORTBENCHMARK_H
@@ -461,10 +461,17 @@ public:
         textToBrailleASCII[QChar(0xE526)] = "n";
     }
 
-    QString braille(QChar c);
-    QString braille(QString text);
+    QString braille(QChar c) const;
+    QString braille(QString text) const;
 };
 
+//! NOTE The translation table is built once, it's only read afterwards
+static const TextToUEBBraille& textToUEBBraille()
+{
+    static const TextToUEBBraille s_textToBraille;
+    return s_textToBraille;
+}
+
 // Braille export is implemented according to Music Braille Code 2015
 // published by the Braille Authority of North America
 // http://www.brailleauthority.org/music/Music_Braille_Code_2015.pdf
@@ -588,7 +595,7 @@ void ExportBrailleImpl::credits(QIODevice& device)
                     for (const EngravingItem* element : mb->el()) {
                         if (element->isText()) {
                             const Text* text = toText(element);
-                            out << TextToUEBBraille().braille(text->plainText()).toUtf8() << Qt::endl;
+                            out << textToUEBBraille().braille(text->plainText()).toUtf8() << Qt::endl;
                         }
                     }
                 }
@@ -602,11 +609,11 @@ void ExportBrailleImpl::credits(QIODevice& device)
     for (QString type : creators) {
         QString creator = score->metaTag(type);
         if (!creator.isEmpty()) {
-            out << TextToUEBBraille().braille(QString("%1 %2").arg(type).arg(creator)).toUtf8() << Qt::endl;
+            out << textToUEBBraille().braille(QString("%1 %2").arg(type).arg(creator)).toUtf8() << Qt::endl;
         }
     }
     if (!score->metaTag(u"copyright").isEmpty()) {
-        out << TextToUEBBraille().braille(QString("© %2").arg(score->metaTag(u"copyright"))).toUtf8() << Qt::endl;
+        out << textToUEBBraille().braille(QString("© %2").arg(score->metaTag(u"copyright"))).toUtf8() << Qt::endl;
     }
     out << Qt::endl;
     out.flush();
@@ -617,7 +624,7 @@ void ExportBrailleImpl::instruments(QIODevice& device)
     //Print staff number to instrument mapping.
     QTextStream out(&device);
     for (size_t i = 0; i < score->staves().size(); ++i) {
-        out << TextToUEBBraille().braille(QString("%1 %2").arg(i + 1).arg(score->staves()[i]->part()->instrumentName())) << Qt::endl;
+        out << textToUEBBraille().braille(QString("%1 %2").arg(i + 1).arg(score->staves()[i]->part()->instrumentName())) << Qt::endl;
     }
     out << Qt::endl;
     out.flush();
@@ -643,8 +650,7 @@ bool ExportBrailleImpl::write(QIODevice& device)
         // if we are at the beginning of the line
         // we write the measure number
         if (currentLineLength == 0) {
-            TextToUEBBraille textToBraille;
-            QString measureNumber = textToBraille.braille(QString::number(m->no() + 1)).remove(0, 1) + " ";
+            QString measureNumber = textToUEBBraille().braille(QString::number(m->no() + 1)).remove(0, 1) + " ";
             int measureNumberLen = measureNumber.size();
             line[0] += measureNumber;
             for (size_t i = 1; i < nrStaves; i++) {
@@ -913,7 +919,7 @@ QString ExportBrailleImpl::brailleMMRest(MMRest* mmRest)
     }
 
     resetOctave(mmRest->staffIdx());
-    return TextToUEBBraille().braille(QString::number(mmRest->measure()->mmRestCount())) + BRAILLE_REST_MEASURE;
+    return textToUEBBraille().braille(QString::number(mmRest->measure()->mmRestCount())) + BRAILLE_REST_MEASURE;
 }
 
 QString ExportBrailleImpl::brailleRest(Rest* rest)
@@ -1739,7 +1745,7 @@ QString ExportBrailleImpl::brailleDynamic(Dynamic* dynamic)
 
     resetOctave(dynamic->staffIdx());
     // Table 22C. Page 19. Music Braille Code 2015
-    return ">" + TextToUEBBraille().braille(dynamic->plainText());
+    return ">" + textToUEBBraille().braille(dynamic->plainText());
 }
 
 QString ExportBrailleImpl::brailleTempoText(TempoText* tempoText, int staffIdx)
@@ -1769,13 +1775,13 @@ QString ExportBrailleImpl::brailleTempoText(TempoText* tempoText, int staffIdx)
             result += " ";
             return result;
         } else {
-            QString result = BRAILLE_MUSIC_PARENTHESES + dots1 + BRAILLE_EQUALS_METRONOME + TextToUEBBraille().braille(secondPart)
+            QString result = BRAILLE_MUSIC_PARENTHESES + dots1 + BRAILLE_EQUALS_METRONOME + textToUEBBraille().braille(secondPart)
                              + BRAILLE_MUSIC_PARENTHESES;
             result += " ";
             return result;
         }
     } else {
-        return ">" + TextToUEBBraille().braille(text.toLower()) + "'";
+        return ">" + textToUEBBraille().braille(text.toLower()) + "'";
     }
 }
 
@@ -1799,13 +1805,13 @@ QString ExportBrailleImpl::brailleKeySig(KeySig* keySig)
         //Section 6.5. Page 61. Music Braille Code 2015.
         //Table 6. Page 5. Music Braille Code 2015.
         switch (keySig->key()) {
-        case Key::C_B: brailleKeySig = QString(TextToUEBBraille().braille("7") + brailleAccidentalType(AccidentalType::FLAT));
+        case Key::C_B: brailleKeySig = QString(textToUEBBraille().braille("7") + brailleAccidentalType(AccidentalType::FLAT));
             break;
-        case Key::G_B: brailleKeySig = QString(TextToUEBBraille().braille("6") + brailleAccidentalType(AccidentalType::FLAT));
+        case Key::G_B: brailleKeySig = QString(textToUEBBraille().braille("6") + brailleAccidentalType(AccidentalType::FLAT));
             break;
-        case Key::D_B: brailleKeySig = QString(TextToUEBBraille().braille("5") + brailleAccidentalType(AccidentalType::FLAT));
+        case Key::D_B: brailleKeySig = QString(textToUEBBraille().braille("5") + brailleAccidentalType(AccidentalType::FLAT));
             break;
-        case Key::A_B: brailleKeySig = QString(TextToUEBBraille().braille("4") + brailleAccidentalType(AccidentalType::FLAT));
+        case Key::A_B: brailleKeySig = QString(textToUEBBraille().braille("4") + brailleAccidentalType(AccidentalType::FLAT));
             break;
         case Key::E_B: brailleKeySig = QString(brailleAccidentalType(AccidentalType::FLAT) + brailleAccidentalType(
                                                    AccidentalType::FLAT) + brailleAccidentalType(AccidentalType::FLAT));
@@ -1822,13 +1828,13 @@ QString ExportBrailleImpl::brailleKeySig(KeySig* keySig)
         case Key::A:   brailleKeySig = QString(brailleAccidentalType(AccidentalType::SHARP) + brailleAccidentalType(
                                                    AccidentalType::SHARP) + brailleAccidentalType(AccidentalType::SHARP));
             break;
-        case Key::E:   brailleKeySig = QString(TextToUEBBraille().braille("4") + brailleAccidentalType(AccidentalType::SHARP));
+        case Key::E:   brailleKeySig = QString(textToUEBBraille().braille("4") + brailleAccidentalType(AccidentalType::SHARP));
             break;
-        case Key::B:   brailleKeySig = QString(TextToUEBBraille().braille("5") + brailleAccidentalType(AccidentalType::SHARP));
+        case Key::B:   brailleKeySig = QString(textToUEBBraille().braille("5") + brailleAccidentalType(AccidentalType::SHARP));
             break;
-        case Key::F_S: brailleKeySig = QString(TextToUEBBraille().braille("6") + brailleAccidentalType(AccidentalType::SHARP));
+        case Key::F_S: brailleKeySig = QString(textToUEBBraille().braille("6") + brailleAccidentalType(AccidentalType::SHARP));
             break;
-        case Key::C_S: brailleKeySig = QString(TextToUEBBraille().braille("7") + brailleAccidentalType(AccidentalType::SHARP));
+        case Key::C_S: brailleKeySig = QString(textToUEBBraille().braille("7") + brailleAccidentalType(AccidentalType::SHARP));
             break;
         case Key::INVALID: return QString();
         case Key::NUM_OF:  return QString();     //TODO What is this?
@@ -2374,7 +2380,7 @@ QString ExportBrailleImpl::brailleHairpinBefore(ChordRest* chordRest, const std:
             if (beginText.endsWith("'")) {
                 beginText = beginText.left(beginText.lastIndexOf("'"));
             }
-            beginTextBraille = QString(">") + TextToUEBBraille().braille(beginText);
+            beginTextBraille = QString(">") + textToUEBBraille().braille(beginText);
             resetOctave(hairpin->staffIdx());
         }
 
@@ -2485,7 +2491,7 @@ QString ExportBrailleImpl::brailleMarker(Marker* marker)
     case MarkerType::TOCODASYM:
         return BRAILLE_TOCODA;
     case MarkerType::USER:
-        return QString(">") + TextToUEBBraille().braille(marker->plainText().toQString().toLower()) + QString("> ");
+        return QString(">") + textToUEBBraille().braille(marker->plainText().toQString().toLower()) + QString("> ");
     }
     return QString();
 }
@@ -2506,7 +2512,7 @@ QString ExportBrailleImpl::brailleJump(Jump* jump)
     case JumpType::DS:
         return BRAILLE_DAL_SEGNO;
     case JumpType::USER:
-        return QString(">") + TextToUEBBraille().braille(jump->plainText().toQString().toLower()) + QString("> ");
+        return QString(">") + textToUEBBraille().braille(jump->plainText().toQString().toLower()) + QString("> ");
     case JumpType::DC_AL_DBLCODA:
     case JumpType::DS_AL_DBLCODA:
     case JumpType::DSS:
@@ -2520,15 +2526,16 @@ QString ExportBrailleImpl::brailleJump(Jump* jump)
     return QString();
 }
 
-QString TextToUEBBraille::braille(QChar c)
+QString TextToUEBBraille::braille(QChar c) const
 {
-    if (textToBrailleASCII[c] != nullptr) {
-        return QString(textToBrailleASCII[c]);
+    QString brailleChar = textToBrailleASCII.value(c);
+    if (!brailleChar.isEmpty()) {
+        return brailleChar;
     }
     return QString(c);
 }
 
-QString TextToUEBBraille::braille(QString text)
+QString TextToUEBBraille::braille(QString text) const
 {
     QString buffer, t, p;
     QTextStream rez(&buffer), tmp(&t);
@@ -22,6 +22,7 @@
 
 #include "importgtp.h"
 
+#include <algorithm>
 #include <cmath>
 
 #include "serialization/xmldom.h"
@@ -245,7 +246,7 @@ std::unique_ptr<IGPDomBuilder> GuitarPro6::createGPDomBuilder() const
 //   readBit
 //---------------------------------------------------------
 
-int GuitarPro6::readBit(ByteArray* buffer)
+int GuitarPro6::readBit(const ByteArray* buffer)
 {
     // calculate the byte index by dividing the position in bits by the bits per byte
     size_t byteIndex = position / BITS_IN_BYTE;
@@ -254,8 +255,9 @@ int GuitarPro6::readBit(ByteArray* buffer)
     int byteOffset = ((BITS_IN_BYTE - 1) - (position % BITS_IN_BYTE));
 
     // calculate the bit which we want to read
-    char byte = (byteIndex < buffer->size()) ? (*buffer)[byteIndex] : char(0);
-    int bit = (((byte & 0xff) >> byteOffset) & 0x01);
+    // (read through the const data, called for every bit of the file)
+    uint8_t byte = (byteIndex < buffer->size()) ? buffer->constData()[byteIndex] : uint8_t(0);
+    int bit = ((byte >> byteOffset) & 0x01);
 
     // increment our current position so we know this bit has been read
     position++;
@@ -266,7 +268,7 @@ int GuitarPro6::readBit(ByteArray* buffer)
 //   readBits
 //---------------------------------------------------------
 
-int GuitarPro6::readBits(ByteArray* buffer, int bitsToRead)
+int GuitarPro6::readBits(const ByteArray* buffer, int bitsToRead)
 {
     int bits = 0;
     for (int i = (bitsToRead - 1); i >= 0; i--) {
@@ -279,7 +281,7 @@ int GuitarPro6::readBits(ByteArray* buffer, int bitsToRead)
 //   readBitsReversed
 //---------------------------------------------------------
 
-int GuitarPro6::readBitsReversed(ByteArray* buffer, int bitsToRead)
+int GuitarPro6::readBitsReversed(const ByteArray* buffer, int bitsToRead)
 {
     int bits = 0;
     for (int i = 0; i < bitsToRead; i++) {
@@ -292,23 +294,23 @@ int GuitarPro6::readBitsReversed(ByteArray* buffer, int bitsToRead)
 //   getBytes
 //---------------------------------------------------------
 
-ByteArray GuitarPro6::getBytes(ByteArray* buffer, int offset, int length)
+ByteArray GuitarPro6::getBytes(const ByteArray* buffer, int offset, int length)
 {
-    ByteArray newBytes;
-    // compute new bytes from our buffer and return byte array
-    for (int i = 0; i < length; i++) {
-        if (static_cast<int>(buffer->size()) > offset + i) {
-            newBytes.insert(i, ((*buffer)[offset + i]));
-        }
+    // copy the bytes from our buffer at once, leaving out the ones past its end
+    size_t bufferSize = buffer->size();
+    if (offset < 0 || length <= 0 || static_cast<size_t>(offset) >= bufferSize) {
+        return ByteArray();
     }
-    return newBytes;
+
+    size_t count = std::min(static_cast<size_t>(length), bufferSize - static_cast<size_t>(offset));
+    return ByteArray(buffer->constData() + offset, count);
 }
 
 //---------------------------------------------------------
 //   readInteger
 //---------------------------------------------------------
 
-int GuitarPro6::readInteger(ByteArray* buffer, int offset)
+int GuitarPro6::readInteger(const ByteArray* buffer, int offset)
 {
     // assign four bytes and take them from the buffer
     char bytes[4];
@@ -326,7 +328,7 @@ int GuitarPro6::readInteger(ByteArray* buffer, int offset)
 //   readString
 //---------------------------------------------------------
 
-ByteArray GuitarPro6::readString(ByteArray* buffer, int offset, int length)
+ByteArray GuitarPro6::readString(const ByteArray* buffer, int offset, int length)
 {
     ByteArray filename;
     // compute the string by iterating through the buffer
@@ -409,11 +411,11 @@ void GuitarPro6::readGPX(ByteArray* buffer)
         int length             = readInteger(buffer, position / BITS_IN_BYTE);
         ByteArray bcfsBuffer;
         bcfsBuffer.reserve(length);
-        int positionCounter    = 0;
         while ((position / BITS_IN_BYTE) < length) {
             // read the bit indicating compression information
             int flag = readBits(buffer, 1);
 
+            // the decompressed bytes are always appended
             if (flag) {
                 int bits = readBits(buffer, 4);
                 int offs = readBitsReversed(buffer, bits);
@@ -421,14 +423,12 @@ void GuitarPro6::readGPX(ByteArray* buffer)
 
                 int pos = (static_cast<int>(bcfsBuffer.size()) - offs);
                 for (int i = 0; i < (size > offs ? offs : size); i++) {
-                    bcfsBuffer.insert(positionCounter, bcfsBuffer[pos + i]);
-                    positionCounter++;
+                    bcfsBuffer.push_back(bcfsBuffer.at(pos + i));
                 }
             } else {
                 int size = readBitsReversed(buffer, 2);
                 for (int i = 0; i < size; i++) {
-                    bcfsBuffer.insert(positionCounter, readBits(buffer, 8));
-                    positionCounter++;
+                    bcfsBuffer.push_back(static_cast<uint8_t>(readBits(buffer, 8)));
                 }
             }
         }
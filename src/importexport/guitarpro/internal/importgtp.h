@@ -436,13 +436,13 @@ class GuitarPro6 : public GuitarPro
 
     void parseFile(const char* filename, ByteArray* data);
 
-    int readBit(ByteArray* buffer);
-    ByteArray getBytes(ByteArray* buffer, int offset, int length);
+    int readBit(const ByteArray* buffer);
+    ByteArray getBytes(const ByteArray* buffer, int offset, int length);
     void readGPX(ByteArray* buffer);
-    int readInteger(ByteArray* buffer, int offset);
-    ByteArray readString(ByteArray* buffer, int offset, int length);
-    int readBits(ByteArray* buffer, int bitsToRead);
-    int readBitsReversed(ByteArray* buffer, int bitsToRead);
+    int readInteger(const ByteArray* buffer, int offset);
+    ByteArray readString(const ByteArray* buffer, int offset, int length);
+    int readBits(const ByteArray* buffer, int bitsToRead);
+    int readBitsReversed(const ByteArray* buffer, int bitsToRead);
     int findNumMeasures(GPPartInfo* partInfo);
     void readMasterTracks(XmlDomNode* masterTrack);
     void readDrumNote(Note* note, int element, int variation);
@@ -49,6 +49,10 @@ public:
 
     virtual int trimMarginPixelSize() const = 0;
     virtual void setTrimMarginPixelSize(std::optional<int> pixelSize) = 0;
+
+    //! NOTE The number of threads painting the pages of a multi-page export, 0 for all the cores
+    virtual int exportThreadCount() const = 0;
+    virtual void setExportThreadCount(std::optional<int> count) = 0;
 };
 }
 
@@ -21,6 +21,13 @@
  */
 #include "abstractimagewriter.h"
 
+#include <algorithm>
+
+#include "concurrency/taskscheduler.h"
+#include "draw/painter.h"
+
+#include "libmscore/score.h"
+
 #include "log.h"
 
 using namespace mu::iex::imagesexport;
@@ -68,6 +75,67 @@ mu::Ret AbstractImageWriter::writeList(const INotationPtrList&, QIODevice&, cons
     return Ret(Ret::Code::NotSupported);
 }
 
+//! NOTE The pages are painted on their own workers, not on the shared ones, which are used by the audio
+static mu::TaskScheduler* paintWorkers()
+{
+    static mu::TaskScheduler workers(std::thread::hardware_concurrency());
+    return &workers;
+}
+
+//---------------------------------------------------------
+//   paintPagesConcurrently
+//    The first page is painted on the calling thread: it finishes
+//    the layout and sets the score up for printing, so the other
+//    pages only read the score while they are painted.
+//    The images are painted through QPixmap and QPixmapCache,
+//    which may only be used on the GUI thread, so the scores
+//    with images are painted serially.
+//---------------------------------------------------------
+
+static void findImage(void* data, mu::engraving::EngravingItem* e)
+{
+    if (e->isImage()) {
+        *static_cast<bool*>(data) = true;
+    }
+}
+
+void AbstractImageWriter::paintPagesConcurrently(engraving::Score* score, size_t pageCount, int threadCount,
+                                                 const PaintPageFunc& paintPage) const
+{
+    if (pageCount == 0) {
+        return;
+    }
+
+    paintPage(0);
+
+    size_t streamCount = threadCount > 0 ? static_cast<size_t>(threadCount) : paintWorkers()->threadPoolSize();
+    streamCount = std::min(streamCount, pageCount - 1);
+
+    bool hasImages = false;
+    score->scanElements(&hasImages, findImage);
+
+    // the debugging provider of the painter is shared by all the painters
+    if (streamCount <= 1 || hasImages || draw::Painter::extended) {
+        for (size_t pageIndex = 1; pageIndex < pageCount; ++pageIndex) {
+            paintPage(pageIndex);
+        }
+        return;
+    }
+
+    std::vector<std::future<void> > streams;
+    for (size_t stream = 0; stream < streamCount; ++stream) {
+        streams.push_back(paintWorkers()->submit([&paintPage, pageCount, streamCount, stream]() {
+            for (size_t pageIndex = 1 + stream; pageIndex < pageCount; pageIndex += streamCount) {
+                paintPage(pageIndex);
+            }
+        }));
+    }
+
+    for (std::future<void>& stream : streams) {
+        stream.get();
+    }
+}
+
 INotationWriter::UnitType AbstractImageWriter::unitTypeFromOptions(const Options& options) const
 {
     std::vector<UnitType> supported = supportedUnitTypes();
@@ -22,8 +22,14 @@
 #ifndef MU_IMPORTEXPORT_ABSTRACTIMAGEWRITER_H
 #define MU_IMPORTEXPORT_ABSTRACTIMAGEWRITER_H
 
+#include <functional>
+
 #include "project/inotationwriter.h"
 
+namespace mu::engraving {
+class Score;
+}
+
 namespace mu::iex::imagesexport {
 class AbstractImageWriter : public project::INotationWriter
 {
@@ -36,6 +42,9 @@ public:
 
 protected:
     UnitType unitTypeFromOptions(const Options& options) const;
+
+    using PaintPageFunc = std::function<void (size_t pageIndex)>;
+    void paintPagesConcurrently(engraving::Score* score, size_t pageCount, int threadCount, const PaintPageFunc& paintPage) const;
 };
 }
 
@@ -82,3 +82,13 @@ void ImagesExportConfiguration::setTrimMarginPixelSize(std::optional<int> pixelS
 {
     m_trimMarginPixelSize = pixelSize;
 }
+
+int ImagesExportConfiguration::exportThreadCount() const
+{
+    return m_exportThreadCount ? m_exportThreadCount.value() : 0;
+}
+
+void ImagesExportConfiguration::setExportThreadCount(std::optional<int> count)
+{
+    m_exportThreadCount = count;
+}
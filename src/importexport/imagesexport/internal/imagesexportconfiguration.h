@@ -42,8 +42,12 @@ public:
     int trimMarginPixelSize() const override;
     void setTrimMarginPixelSize(std::optional<int> pixelSize) override;
 
+    int exportThreadCount() const override;
+    void setExportThreadCount(std::optional<int> count) override;
+
 private:
     std::optional<int> m_trimMarginPixelSize;
+    std::optional<int> m_exportThreadCount;
     std::optional<float> m_customExportPngDpi;
 };
 }
@@ -51,6 +51,8 @@ mu::Ret PdfWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
         return make_ret(Ret::Code::UnknownError);
     }
 
+    notation->painting()->prepareView(RectF(), /*isPrinting*/ true);
+
     QPdfWriter pdfWriter(&destinationDevice);
     preparePdfWriter(pdfWriter, notation->projectWorkTitleAndPartName(), notation->painting()->pageSizeInch().toQSizeF());
 
@@ -103,6 +105,8 @@ mu::Ret PdfWriter::writeList(const INotationPtrList& notations, QIODevice& desti
             return make_ret(Ret::Code::UnknownError);
         }
 
+        notation->painting()->prepareView(RectF(), /*isPrinting*/ true);
+
         if (notation != firstNotation) {
             QSizeF size = notation->painting()->pageSizeInch().toQSizeF();
             pdfWriter.setPageSize(QPageSize(size, QPageSize::Inch));
@@ -47,6 +47,38 @@ mu::Ret PngWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
         return make_ret(Ret::Code::UnknownError);
     }
 
+    notation->painting()->prepareView(RectF(), /*isPrinting*/ true);
+
+    QImage image = paintPage(notation, options.value(OptionKey::PAGE_NUMBER, Val(0)).toInt(), options);
+    image.save(&destinationDevice, "png");
+
+    return true;
+}
+
+mu::Ret PngWriter::writePages(INotationPtr notation, const std::vector<QIODevice*>& devices, const Options& options)
+{
+    IF_ASSERT_FAILED(notation) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    mu::engraving::Score* score = notation->elements()->msScore();
+    IF_ASSERT_FAILED(score) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    notation->painting()->prepareView(RectF(), /*isPrinting*/ true);
+
+    //! NOTE Each page is painted with its own painter, and saved to its device when it's ready
+    paintPagesConcurrently(score, devices.size(), configuration()->exportThreadCount(), [this, notation, &devices, &options](size_t pageIndex) {
+        QImage image = paintPage(notation, static_cast<int>(pageIndex), options);
+        image.save(devices[pageIndex], "png");
+    });
+
+    return true;
+}
+
+QImage PngWriter::paintPage(INotationPtr notation, int pageNumber, const Options& options) const
+{
     const float CANVAS_DPI = configuration()->exportPngDpiResolution();
     const SizeF pageSizeInch = notation->painting()->pageSizeInch();
 
@@ -63,15 +95,14 @@ mu::Ret PngWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
     mu::draw::Painter painter(&image, "pngwriter");
 
     INotationPainting::Options opt;
-    opt.fromPage = options.value(OptionKey::PAGE_NUMBER, Val(0)).toInt();
+    opt.fromPage = pageNumber;
     opt.toPage = opt.fromPage;
     opt.trimMarginPixelSize = configuration()->trimMarginPixelSize();
     opt.deviceDpi = CANVAS_DPI;
     opt.printPageBackground = false; //Already printed
 
     notation->painting()->paintPng(&painter, opt);
+    painter.endDraw();
 
-    image.save(&destinationDevice, "png");
-
-    return true;
+    return image;
 }
@@ -23,6 +23,8 @@
 #ifndef MU_IMPORTEXPORT_PNGWRITER_H
 #define MU_IMPORTEXPORT_PNGWRITER_H
 
+#include <QImage>
+
 #include "abstractimagewriter.h"
 
 #include "../iimagesexportconfiguration.h"
@@ -36,6 +38,10 @@ class PngWriter : public AbstractImageWriter
 public:
     std::vector<project::INotationWriter::UnitType> supportedUnitTypes() const override;
     Ret write(notation::INotationPtr notation, QIODevice& destinationDevice, const Options& options = Options()) override;
+    Ret writePages(notation::INotationPtr notation, const std::vector<QIODevice*>& devices, const Options& options = Options()) override;
+
+private:
+    QImage paintPage(notation::INotationPtr notation, int pageNumber, const Options& options) const;
 };
 }
 
@@ -21,6 +21,7 @@
  */
 
 #include <QTextStream>
+#include <QHash>
 #include <QBuffer>
 #include <QFile>
 #include <QTextCodec>
@@ -172,10 +173,12 @@ public:
     QIODevice* outputDevice;
     QTextStream* stream;
     int resolution;
+    bool reuseGlyphs = false;
 
-    QString header;
 //    QString defs; // NEEDED FOR GRADIENTS
-    QString body;
+
+    // Ids of the glyph outlines already defined, by font and text
+    QHash<QString, int> glyphIds;
 
     QBrush brush;
     QPen pen;
@@ -231,11 +234,16 @@ private:
     qreal _dx { 0.0 };
     qreal _dy { 0.0 };
 
+// Font and text of the text item being drawn, when its outline can be reused
+    QString _glyphKey;
+
 protected:
 // The mu::engraving::EngravingItem being generated right now
     const mu::engraving::EngravingItem* _element = NULL;
 
     void writeImage(const QRectF& r, const QByteArray& imageData, const QString& mimeFormat);
+    void writePathData(const QPainterPath& p, qreal dx, qreal dy);
+    void writeGlyphUse(const QPainterPath& p);
 
 // SVG strings as constants
 #define SVG_SPACE    ' '
@@ -282,6 +290,14 @@ protected:
 #define SVG_IMAGE       "<image"
 #define SVG_PATH        "<path"
 #define SVG_POLYLINE    "<polyline"
+#define SVG_USE         "<use"
+
+#define SVG_DEFS_BEGIN  "<defs>"
+#define SVG_DEFS_END    "</defs>"
+
+#define SVG_ID          " id=\""
+#define SVG_HREF        " xlink:href=\"#"
+#define SVG_GLYPH_ID    "g"
 
 #define SVG_PRESERVE_ASPECT " preserveAspectRatio=\""
 
@@ -321,6 +337,7 @@ public:
     void popGroup();
 
     void drawPath(const QPainterPath& path);
+    void drawTextItem(const QPointF& p, const QTextItem& textItem);
     void drawPixmap(const QRectF& r, const QPixmap& pm, const QRectF& sr);
     void drawPolygon(const QPoint* points, int pointCount, PolygonDrawMode mode) { QPaintEngine::drawPolygon(points, pointCount, mode); }
     void drawPolygon(const QPointF* points, int pointCount, PolygonDrawMode mode);
@@ -354,6 +371,13 @@ public:
         d_func()->attributes.description = description;
     }
 
+    bool reuseGlyphs() const { return d_func()->reuseGlyphs; }
+    void setReuseGlyphs(bool reuse)
+    {
+        Q_ASSERT(!isActive());
+        d_func()->reuseGlyphs = reuse;
+    }
+
     QIODevice* outputDevice() const { return d_func()->outputDevice; }
     void setOutputDevice(QIODevice* device)
     {
@@ -952,6 +976,35 @@ void SvgGenerator::setResolution(int dpi)
     d->engine->setResolution(dpi);
 }
 
+/*!
+    \property SvgGenerator::reuseGlyphs
+    \brief whether the outline of each glyph is written only once
+
+    When set, the outline of a text item is defined once per font and text,
+    and every drawing of it refers to that definition with a \c<use> element.
+    This makes documents with many repeated symbols much smaller. The ids of
+    the definitions are only unique within the document, so documents that
+    are inlined in the same page may clash; the default is \c false.
+
+    \note It is not possible to change this property while a
+    QPainter is active on the generator.
+*/
+bool SvgGenerator::reuseGlyphs() const
+{
+    Q_D(const SvgGenerator);
+    return d->engine->reuseGlyphs();
+}
+
+void SvgGenerator::setReuseGlyphs(bool reuse)
+{
+    Q_D(SvgGenerator);
+    if (d->engine->isActive()) {
+        LOGW("SvgGenerator::setReuseGlyphs(), cannot change it while SVG is being generated");
+        return;
+    }
+    d->engine->setReuseGlyphs(reuse);
+}
+
 /*!
     Returns the paint engine used to render graphics to be converted to SVG
     format information.
@@ -1034,9 +1087,16 @@ bool SvgPaintEngine::begin(QPaintDevice*)
         return false;
     }
 
+    d->glyphIds.clear();
+
+    // Stream straight to the output device, nothing written later depends on what follows
+    d->stream = new QTextStream(d->outputDevice);
+#ifndef QT_NO_TEXTCODEC
+    d->stream->setCodec(QTextCodec::codecForName("UTF-8"));
+#endif
+
     // Stream the headers
-    d->stream = new QTextStream(&d->header);
-    stream() << "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>" << Qt::endl << SVG_BEGIN;
+    stream() << "<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"no\"?>" << '\n' << SVG_BEGIN;
     if (d->viewBox.isValid()) {
         // viewBox has floating point values, size width/height is integer
         stream() << SVG_WIDTH << d->viewBox.width() << SVG_PX << SVG_QUOTE
@@ -1045,24 +1105,22 @@ bool SvgPaintEngine::begin(QPaintDevice*)
         stream() << SVG_VIEW_BOX << d->viewBox.left()
                  << SVG_SPACE << d->viewBox.top()
                  << SVG_SPACE << d->viewBox.width()
-                 << SVG_SPACE << d->viewBox.height() << SVG_QUOTE << Qt::endl;
+                 << SVG_SPACE << d->viewBox.height() << SVG_QUOTE << '\n';
     }
     stream() << " xmlns=\"http://www.w3.org/2000/svg\""
                 " xmlns:xlink=\"http://www.w3.org/1999/xlink\""
-                " version=\"1.2\" baseProfile=\"tiny\">" << Qt::endl;
+                " version=\"1.2\" baseProfile=\"tiny\">" << '\n';
     if (!d->attributes.title.isEmpty()) {
-        stream() << SVG_TITLE_BEGIN << d->attributes.title.toHtmlEscaped() << SVG_TITLE_END << Qt::endl;
+        stream() << SVG_TITLE_BEGIN << d->attributes.title.toHtmlEscaped() << SVG_TITLE_END << '\n';
     }
     if (!d->attributes.description.isEmpty()) {
-        stream() << SVG_DESC_BEGIN << d->attributes.description.toHtmlEscaped() << SVG_DESC_END << Qt::endl;
+        stream() << SVG_DESC_BEGIN << d->attributes.description.toHtmlEscaped() << SVG_DESC_END << '\n';
     }
 
 // <defs> is currently empty. It's necessary for gradients.
 //    d->stream->setString(&d->defs);
 //    *d->stream << "<defs>\n";
 
-    // Point the stream at the body string, for other functions to populate
-    d->stream->setString(&d->body);
     return true;
 }
 
@@ -1074,20 +1132,10 @@ bool SvgPaintEngine::end()
 //    d->stream->setString(&d->defs);
 //    stream() << "</defs>\n";
 
-    // Point the stream at the real output device (the .svg file)
-    d->stream->setDevice(d->outputDevice);
-
-#ifndef QT_NO_TEXTCODEC
-    d->stream->setCodec(QTextCodec::codecForName("UTF-8"));
-#endif
-
-    // Stream our strings out to the device, in order
-    stream() << d->header;
-//    stream() << d->defs;
-    stream() << d->body;
     stream() << SVG_END << Qt::endl;
 
     delete d->stream;
+    d->stream = nullptr;
     return true;
 }
 
@@ -1146,7 +1194,7 @@ void SvgPaintEngine::writeImage(const QRectF& r, const QByteArray& imageData, co
              << SVG_PRESERVE_ASPECT << SVG_NONE << SVG_QUOTE;
 
     stream() << " xlink:href=\"data:" << mimeFormat << ";base64,"
-             << imageData.toBase64() << SVG_QUOTE << SVG_ELEMENT_END << Qt::endl;
+             << imageData.toBase64() << SVG_QUOTE << SVG_ELEMENT_END << '\n';
 }
 
 void SvgPaintEngine::updateState(const QPaintEngineState& s)
@@ -1203,6 +1251,11 @@ void SvgPaintEngine::updateState(const QPaintEngineState& s)
 
 void SvgPaintEngine::drawPath(const QPainterPath& p)
 {
+    if (!_glyphKey.isEmpty()) {
+        writeGlyphUse(p);
+        return;
+    }
+
     stream() << SVG_PATH << stateString;
 
     // fill-rule is here because UpdateState() doesn't have a QPainterPath arg
@@ -1213,10 +1266,58 @@ void SvgPaintEngine::drawPath(const QPainterPath& p)
 
     // Path data
     stream() << SVG_D;
+    writePathData(p, _dx, _dy);
+    stream() << SVG_QUOTE << SVG_ELEMENT_END << '\n';
+}
+
+void SvgPaintEngine::drawTextItem(const QPointF& p, const QTextItem& textItem)
+{
+    // Text items without characters, like glyph runs, can't be told apart and are drawn as plain paths
+    if (!d_func()->reuseGlyphs || textItem.text().isEmpty()) {
+        QPaintEngine::drawTextItem(p, textItem);
+        return;
+    }
+
+    // The default implementation fills the outline of the text at the origin translated to p,
+    // drawPath() turns it into a reference to the outline
+    _glyphKey = textItem.font().key() + QLatin1Char('|') + textItem.text();
+    QPaintEngine::drawTextItem(p, textItem);
+    _glyphKey.clear();
+}
+
+void SvgPaintEngine::writeGlyphUse(const QPainterPath& p)
+{
+    Q_D(SvgPaintEngine);
+
+    int id = d->glyphIds.value(_glyphKey, 0);
+    if (id == 0) {
+        // Defined at the first use, so that the document can be streamed
+        id = d->glyphIds.size() + 1;
+        d->glyphIds.insert(_glyphKey, id);
+
+        stream() << SVG_DEFS_BEGIN << SVG_PATH << SVG_ID << SVG_GLYPH_ID << id << SVG_QUOTE;
+        if (p.fillRule() == Qt::OddEvenFill) {
+            stream() << SVG_FILL_RULE;
+        }
+        stream() << SVG_D;
+        writePathData(p, 0, 0);
+        stream() << SVG_QUOTE << SVG_ELEMENT_END << SVG_DEFS_END << '\n';
+    }
+
+    stream() << SVG_USE << stateString << SVG_HREF << SVG_GLYPH_ID << id << SVG_QUOTE;
+    if (_dx != 0 || _dy != 0) {
+        stream() << SVG_X << SVG_QUOTE << _dx << SVG_QUOTE
+                 << SVG_Y << SVG_QUOTE << _dy << SVG_QUOTE;
+    }
+    stream() << SVG_ELEMENT_END << '\n';
+}
+
+void SvgPaintEngine::writePathData(const QPainterPath& p, qreal dx, qreal dy)
+{
     for (int i = 0; i < p.elementCount(); ++i) {
         const QPainterPath::Element& e = p.elementAt(i);
-        qreal x = e.x + _dx;
-        qreal y = e.y + _dy;
+        qreal x = e.x + dx;
+        qreal y = e.y + dy;
         switch (e.type) {
         case QPainterPath::MoveToElement:
             stream() << SVG_MOVE << x << SVG_COMMA << y;
@@ -1230,8 +1331,8 @@ void SvgPaintEngine::drawPath(const QPainterPath& p)
             while (i < p.elementCount()) {
                 const QPainterPath::Element& ee = p.elementAt(i);
                 if (ee.type == QPainterPath::CurveToDataElement) {
-                    stream() << SVG_SPACE << ee.x + _dx
-                             << SVG_COMMA << ee.y + _dy;
+                    stream() << SVG_SPACE << ee.x + dx
+                             << SVG_COMMA << ee.y + dy;
                     ++i;
                 } else {
                     --i;
@@ -1246,7 +1347,6 @@ void SvgPaintEngine::drawPath(const QPainterPath& p)
             stream() << SVG_SPACE;
         }
     }
-    stream() << SVG_QUOTE << SVG_ELEMENT_END << Qt::endl;
 }
 
 void SvgPaintEngine::drawPolygon(const QPointF* points, int pointCount,
@@ -1269,7 +1369,7 @@ void SvgPaintEngine::drawPolygon(const QPointF* points, int pointCount,
                 stream() << SVG_SPACE;
             }
         }
-        stream() << SVG_QUOTE << SVG_ELEMENT_END << Qt::endl;
+        stream() << SVG_QUOTE << SVG_ELEMENT_END << '\n';
     } else {
         path.closeSubpath();
         drawPath(path);
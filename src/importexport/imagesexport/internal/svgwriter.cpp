@@ -53,30 +53,114 @@ mu::Ret SvgWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
         return make_ret(Ret::Code::UnknownError);
     }
 
+    notation->painting()->prepareView(RectF(), /*isPrinting*/ true);
+
     mu::engraving::Score* score = notation->elements()->msScore();
     IF_ASSERT_FAILED(score) {
         return make_ret(Ret::Code::UnknownError);
     }
 
+    const size_t PAGE_NUMBER = options.value(OptionKey::PAGE_NUMBER, Val(0)).toInt();
+    if (PAGE_NUMBER >= score->pages().size()) {
+        return false;
+    }
+
+    double pixelRatioBackup = beginPrinting(score, options);
+    writePage(score, PAGE_NUMBER, destinationDevice, options);
+    endPrinting(score, pixelRatioBackup);
+
+    return true;
+}
+
+mu::Ret SvgWriter::writePages(INotationPtr notation, const std::vector<QIODevice*>& devices, const Options& options)
+{
+    IF_ASSERT_FAILED(notation) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    notation->painting()->prepareView(RectF(), /*isPrinting*/ true);
+
+    mu::engraving::Score* score = notation->elements()->msScore();
+    IF_ASSERT_FAILED(score && devices.size() <= score->pages().size()) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    //! NOTE Each page is painted with its own generator, the score is set up once for all of them
+    double pixelRatioBackup = beginPrinting(score, options);
+    paintPagesConcurrently(score, devices.size(), configuration()->exportThreadCount(), [this, score, &devices, &options](size_t pageIndex) {
+        writePage(score, pageIndex, *devices[pageIndex], options);
+    });
+    endPrinting(score, pixelRatioBackup);
+
+    return true;
+}
+
+double SvgWriter::beginPrinting(mu::engraving::Score* score, const Options& options) const
+{
     score->setPrinting(true); // don’t print page break symbols etc.
 
     mu::engraving::MScore::pdfPrinting = true;
     mu::engraving::MScore::svgPrinting = true;
 
-    const std::vector<mu::engraving::Page*>& pages = score->pages();
-    double pixelRationBackup = mu::engraving::MScore::pixelRatio;
+    double pixelRatioBackup = mu::engraving::MScore::pixelRatio;
+    mu::engraving::MScore::pixelRatio = mu::engraving::DPI / SvgGenerator().logicalDpiX();
 
-    const size_t PAGE_NUMBER = options.value(OptionKey::PAGE_NUMBER, Val(0)).toInt();
-    if (PAGE_NUMBER >= pages.size()) {
-        return false;
+    BeatsColors beatsColors = parseBeatsColors(options.value(OptionKey::BEATS_COLORS, Val()).toQVariant());
+    if (beatsColors.isEmpty()) {
+        return pixelRatioBackup;
+    }
+
+    // Set color for elements on beats
+    int beatIndex = 0;
+    for (const mu::engraving::RepeatSegment* repeatSegment : score->repeatList()) {
+        for (const mu::engraving::Measure* measure : repeatSegment->measureList()) {
+            for (mu::engraving::Segment* segment = measure->first(); segment; segment = segment->next()) {
+                if (!segment->isChordRestType()) {
+                    continue;
+                }
+
+                if (beatsColors.contains(beatIndex)) {
+                    for (EngravingItem* element : segment->elist()) {
+                        if (!element) {
+                            continue;
+                        }
+
+                        if (element->isChord()) {
+                            for (Note* note : toChord(element)->notes()) {
+                                note->setColor(beatsColors[beatIndex]);
+                            }
+                        } else if (element->isChordRest()) {
+                            element->setColor(beatsColors[beatIndex]);
+                        }
+                    }
+                }
+
+                beatIndex++;
+            }
+        }
     }
 
-    mu::engraving::Page* page = pages.at(PAGE_NUMBER);
+    return pixelRatioBackup;
+}
+
+void SvgWriter::endPrinting(mu::engraving::Score* score, double pixelRatioBackup) const
+{
+    mu::engraving::MScore::pixelRatio = pixelRatioBackup;
+    score->setPrinting(false);
+    mu::engraving::MScore::pdfPrinting = false;
+    mu::engraving::MScore::svgPrinting = false;
+}
+
+void SvgWriter::writePage(mu::engraving::Score* score, size_t pageNumber, QIODevice& destinationDevice, const Options& options) const
+{
+    const std::vector<mu::engraving::Page*>& pages = score->pages();
+    mu::engraving::Page* page = pages.at(pageNumber);
 
     SvgGenerator printer;
     QString title(score->name());
-    printer.setTitle(pages.size() > 1 ? QString("%1 (%2)").arg(title).arg(PAGE_NUMBER + 1) : title);
+    printer.setTitle(pages.size() > 1 ? QString("%1 (%2)").arg(title).arg(pageNumber + 1) : title);
     printer.setOutputDevice(&destinationDevice);
+    printer.setReuseGlyphs(options.value(OptionKey::REUSE_GLYPHS, Val(false)).toBool());
 
     const int TRIM_MARGIN_SIZE = configuration()->trimMarginPixelSize();
 
@@ -96,8 +180,6 @@ mu::Ret SvgWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
         painter.translate(-pageRect.topLeft());
     }
 
-    mu::engraving::MScore::pixelRatio = mu::engraving::DPI / printer.logicalDpiX();
-
     if (!options[OptionKey::TRANSPARENT_BACKGROUND].toBool()) {
         painter.fillRect(pageRect, mu::draw::Color::WHITE);
     }
@@ -149,56 +231,32 @@ mu::Ret SvgWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
                     }
                 }
             } else {   // Draw staff lines once per system
-                mu::engraving::StaffLines* firstSL = system->firstMeasure()->staffLines(static_cast<int>(staffIndex))->clone();
-                mu::engraving::StaffLines* lastSL =  system->lastMeasure()->staffLines(static_cast<int>(staffIndex));
+                const mu::engraving::StaffLines* firstSL = system->firstMeasure()->staffLines(static_cast<int>(staffIndex));
+                const mu::engraving::StaffLines* lastSL =  system->lastMeasure()->staffLines(static_cast<int>(staffIndex));
 
                 qreal lastX =  lastSL->bbox().right()
                               + lastSL->pagePos().x()
                               - firstSL->pagePos().x();
-                std::vector<mu::LineF>& lines = firstSL->getLines();
+
+                //! NOTE The lines of the first measure are drawn up to the end of the system
+                //! without a clone of them, the pages may be painted concurrently
+                std::vector<mu::LineF> lines = firstSL->getLines();
                 for (size_t l = 0, c = lines.size(); l < c; l++) {
                     lines[l].setP2(mu::PointF(lastX, lines[l].p2().y()));
                 }
 
                 printer.setElement(firstSL);
-                engraving::Paint::paintElement(painter, firstSL);
+                mu::PointF pos = firstSL->pagePos();
+                painter.translate(pos);
+                painter.setPen(mu::draw::Pen(firstSL->curColor(), firstSL->lineWidth(), mu::draw::PenStyle::SolidLine,
+                                             mu::draw::PenCapStyle::FlatCap));
+                painter.drawLines(lines);
+                painter.translate(-pos);
             }
         }
     }
 
-    BeatsColors beatsColors = parseBeatsColors(options.value(OptionKey::BEATS_COLORS, Val()).toQVariant());
-
-    // 2nd pass: Set color for elements on beats
-    int beatIndex = 0;
-    for (const mu::engraving::RepeatSegment* repeatSegment : score->repeatList()) {
-        for (const mu::engraving::Measure* measure : repeatSegment->measureList()) {
-            for (mu::engraving::Segment* segment = measure->first(); segment; segment = segment->next()) {
-                if (!segment->isChordRestType()) {
-                    continue;
-                }
-
-                if (beatsColors.contains(beatIndex)) {
-                    for (EngravingItem* element : segment->elist()) {
-                        if (!element) {
-                            continue;
-                        }
-
-                        if (element->isChord()) {
-                            for (Note* note : toChord(element)->notes()) {
-                                note->setColor(beatsColors[beatIndex]);
-                            }
-                        } else if (element->isChordRest()) {
-                            element->setColor(beatsColors[beatIndex]);
-                        }
-                    }
-                }
-
-                beatIndex++;
-            }
-        }
-    }
-
-    // 3rd pass: the rest of the elements
+    // 2nd pass: the rest of the elements
     std::vector<mu::engraving::EngravingItem*> elements = page->elements();
     std::sort(elements.begin(), elements.end(), mu::engraving::elementLessThan);
 
@@ -225,14 +283,6 @@ mu::Ret SvgWriter::write(INotationPtr notation, QIODevice& destinationDevice, co
     }
 
     painter.endDraw(); // Writes MuseScore SVG file to disk, finally
-
-    // Clean up and return
-    mu::engraving::MScore::pixelRatio = pixelRationBackup;
-    score->setPrinting(false);
-    mu::engraving::MScore::pdfPrinting = false;
-    mu::engraving::MScore::svgPrinting = false;
-
-    return true;
 }
 
 SvgWriter::BeatsColors SvgWriter::parseBeatsColors(const QVariant& obj) const
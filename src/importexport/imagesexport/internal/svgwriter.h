@@ -36,10 +36,15 @@ class SvgWriter : public AbstractImageWriter
 public:
     std::vector<project::INotationWriter::UnitType> supportedUnitTypes() const override;
     Ret write(notation::INotationPtr notation, QIODevice& destinationDevice, const Options& options = Options()) override;
+    Ret writePages(notation::INotationPtr notation, const std::vector<QIODevice*>& devices, const Options& options = Options()) override;
 
 private:
     using BeatsColors = QHash<int /* beatIndex */, QColor>;
 
+    double beginPrinting(engraving::Score* score, const Options& options) const;
+    void endPrinting(engraving::Score* score, double pixelRatioBackup) const;
+    void writePage(engraving::Score* score, size_t pageNumber, QIODevice& destinationDevice, const Options& options) const;
+
     BeatsColors parseBeatsColors(const QVariant& obj) const;
 };
 }
@@ -22,6 +22,8 @@
 
 #include "exportmidi.h"
 
+#include <future>
+
 #include "libmscore/key.h"
 #include "libmscore/masterscore.h"
 #include "libmscore/note.h"
@@ -34,11 +36,22 @@
 
 #include "engraving/compat/midi/event.h"
 
+#include "concurrency/taskscheduler.h"
+
 #include "log.h"
 
 using namespace mu::engraving;
 
 namespace mu::iex::midi {
+// below that, writing the tracks on the workers doesn't pay off
+static constexpr size_t MIN_STAVES_TO_WRITE_CONCURRENTLY = 4;
+
+static TaskScheduler* writeWorkers()
+{
+    static TaskScheduler workers;
+    return &workers;
+}
+
 //---------------------------------------------------------
 //   writeHeader
 //---------------------------------------------------------
@@ -228,128 +241,173 @@ bool ExportMidi::write(QIODevice* device, bool midiExpandRepeats, bool exportRPN
         tracks.push_back(MidiTrack());
     }
 
-    EventMap events;
-    m_score->renderMidi(&events, false, midiExpandRepeats, synthState);
+    std::vector<StaffEvents> staffEvents(tracks.size());
+    {
+        EventMap events;
+        m_score->renderMidi(&events, false, midiExpandRepeats, synthState);
+
+        // distribute the events between the staves they are written to,
+        // releasing the events of the whole score on the way
+        for (auto i = events.begin(); i != events.end(); i = events.erase(i)) {
+            const NPlayEvent& event = i->second;
+            if (event.isMuted()) {
+                continue;
+            }
+
+            const int staffIdx = event.getOriginatingStaff();
+            if (staffIdx >= 0 && staffIdx < static_cast<int>(staffEvents.size())) {
+                staffEvents[staffIdx].emplace_back(i->first, event);
+            }
+
+            // the restruck notes are turned off in the staff they were playing in
+            const int restrikeStaffIdx = event.discard() - 1;
+            if (event.velo() > 0 && restrikeStaffIdx >= 0 && restrikeStaffIdx != staffIdx
+                && restrikeStaffIdx < static_cast<int>(staffEvents.size())) {
+                staffEvents[restrikeStaffIdx].emplace_back(i->first, event);
+            }
+        }
+    }
 
     m_pauseMap.calculate(m_score);
     writeHeader();
 
-    int staffIdx = 0;
-    for (auto& track: tracks) {
-        Staff* staff = m_score->staff(staffIdx);
-        Part* part   = staff->part();
-
-        track.setOutPort(part->midiPort());
-        track.setOutChannel(part->midiChannel());
-
-        // Pass through the all instruments in the part
-        for (const auto& pair : part->instruments()) {
-            // Pass through the all channels of the instrument
-            // "normal", "pizzicato", "tremolo" for Strings,
-            // "normal", "mute" for Trumpet
-            for (const InstrChannel* instrChan : pair.second->channel()) {
-                const InstrChannel* ch = part->masterScore()->playbackChannel(instrChan);
-                char port    = part->masterScore()->midiPort(ch->channel());
-                char channel = part->masterScore()->midiChannel(ch->channel());
-
-                if (staff->isTop()) {
-                    track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_RESET_ALL_CTRL, 0));
-                    // We need this to get the correct pitch of bends
-                    // Hidden under preferences because some software
-                    // crashes when receiving RPNs: https://musescore.org/en/node/37431
-                    if (channel != 9 && exportRPNs) {
-                        // set pitch bend sensitivity to 12 semitones:
-                        track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_LRPN, 0));
-                        track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_HRPN, 0));
-                        track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_HDATA, 12));
-
-                        // reset fine tuning
-                        /*track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_LRPN, 1));
-                        track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_HRPN, 0));
-                        track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_HDATA, 64));*/
-
-                        // deactivate rpn
-                        track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_LRPN, 127));
-                        track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_HRPN, 127));
-                    }
+    if (tracks.size() < MIN_STAVES_TO_WRITE_CONCURRENTLY) {
+        for (staff_idx_t staffIdx = 0; staffIdx < tracks.size(); ++staffIdx) {
+            writeTrack(tracks[staffIdx], staffIdx, staffEvents[staffIdx], exportRPNs);
+            StaffEvents().swap(staffEvents[staffIdx]);
+        }
+    } else {
+        // the tracks are written from the events of their own staff only
+        std::vector<std::future<void> > futures;
+        futures.reserve(tracks.size());
+        for (staff_idx_t staffIdx = 0; staffIdx < tracks.size(); ++staffIdx) {
+            futures.push_back(writeWorkers()->submit([this, &tracks, &staffEvents, staffIdx, exportRPNs]() {
+                writeTrack(tracks[staffIdx], staffIdx, staffEvents[staffIdx], exportRPNs);
+                StaffEvents().swap(staffEvents[staffIdx]);
+            }));
+        }
+        for (auto& future : futures) {
+            future.get();
+        }
+    }
 
-                    if (ch->program() != -1) {
-                        track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_PROGRAM, ch->program()));
-                    }
-                    track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_VOLUME, ch->volume()));
-                    track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_PANPOT, ch->pan()));
-                    track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_REVERB_SEND, ch->reverb()));
-                    track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_CHORUS_SEND, ch->chorus()));
+    return !m_midiFile.write(device);
+}
+
+//---------------------------------------------------------
+//  writeTrack
+//---------------------------------------------------------
+
+void ExportMidi::writeTrack(MidiTrack& track, staff_idx_t staffIdx, const StaffEvents& events, bool exportRPNs) const
+{
+    Staff* staff = m_score->staff(staffIdx);
+    Part* part   = staff->part();
+
+    track.setOutPort(part->midiPort());
+    track.setOutChannel(part->midiChannel());
+
+    // Pass through the all instruments in the part
+    for (const auto& pair : part->instruments()) {
+        // Pass through the all channels of the instrument
+        // "normal", "pizzicato", "tremolo" for Strings,
+        // "normal", "mute" for Trumpet
+        for (const InstrChannel* instrChan : pair.second->channel()) {
+            const InstrChannel* ch = part->masterScore()->playbackChannel(instrChan);
+            char port    = part->masterScore()->midiPort(ch->channel());
+            char channel = part->masterScore()->midiChannel(ch->channel());
+
+            if (staff->isTop()) {
+                track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_RESET_ALL_CTRL, 0));
+                // We need this to get the correct pitch of bends
+                // Hidden under preferences because some software
+                // crashes when receiving RPNs: https://musescore.org/en/node/37431
+                if (channel != 9 && exportRPNs) {
+                    // set pitch bend sensitivity to 12 semitones:
+                    track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_LRPN, 0));
+                    track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_HRPN, 0));
+                    track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_HDATA, 12));
+
+                    // reset fine tuning
+                    /*track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_LRPN, 1));
+                    track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_HRPN, 0));
+                    track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_HDATA, 64));*/
+
+                    // deactivate rpn
+                    track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_LRPN, 127));
+                    track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_HRPN, 127));
                 }
 
-                // Export port to MIDI META event
-                if (track.outPort() >= 0 && track.outPort() <= 127) {
-                    MidiEvent ev;
-                    ev.setType(ME_META);
-                    ev.setMetaType(META_PORT_CHANGE);
-                    ev.setLen(1);
-                    unsigned char* data = new unsigned char[1];
-                    data[0] = int(track.outPort());
-                    ev.setEData(data);
-                    track.insert(0, ev);
+                if (ch->program() != -1) {
+                    track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_PROGRAM, ch->program()));
                 }
+                track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_VOLUME, ch->volume()));
+                track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_PANPOT, ch->pan()));
+                track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_REVERB_SEND, ch->reverb()));
+                track.insert(0, MidiEvent(ME_CONTROLLER, channel, CTRL_CHORUS_SEND, ch->chorus()));
+            }
 
-                for (auto i = events.begin(); i != events.end(); ++i) {
-                    const NPlayEvent& event = i->second;
+            // Export port to MIDI META event
+            if (track.outPort() >= 0 && track.outPort() <= 127) {
+                MidiEvent ev;
+                ev.setType(ME_META);
+                ev.setMetaType(META_PORT_CHANGE);
+                ev.setLen(1);
+                unsigned char* data = new unsigned char[1];
+                data[0] = int(track.outPort());
+                ev.setEData(data);
+                track.insert(0, ev);
+            }
 
-                    if (event.isMuted()) {
-                        continue;
-                    }
-                    if (event.discard() == staffIdx + 1 && event.velo() > 0) {
-                        // turn note off so we can restrike it in another track
-                        track.insert(m_pauseMap.addPauseTicks(i->first), MidiEvent(ME_NOTEON, channel,
-                                                                                   event.pitch(), 0));
-                    }
+            for (auto i = events.cbegin(); i != events.cend(); ++i) {
+                const NPlayEvent& event = i->second;
 
-                    if (event.getOriginatingStaff() != staffIdx) {
-                        continue;
-                    }
+                if (event.discard() == static_cast<int>(staffIdx) + 1 && event.velo() > 0) {
+                    // turn note off so we can restrike it in another track
+                    track.insert(m_pauseMap.addPauseTicks(i->first), MidiEvent(ME_NOTEON, channel,
+                                                                               event.pitch(), 0));
+                }
 
-                    if (event.discard() && event.velo() == 0) {
-                        // ignore noteoff but restrike noteon
-                        continue;
-                    }
+                if (event.getOriginatingStaff() != static_cast<int>(staffIdx)) {
+                    continue;
+                }
 
-                    if (!exportRPNs && event.type() == ME_CONTROLLER && event.portamento()) {
-                        // ignore portamento control events if exportRPN isn't switched on
-                        continue;
-                    }
+                if (event.discard() && event.velo() == 0) {
+                    // ignore noteoff but restrike noteon
+                    continue;
+                }
 
-                    char eventPort    = m_score->masterScore()->midiPort(event.channel());
-                    char eventChannel = m_score->masterScore()->midiChannel(event.channel());
-                    if (port != eventPort || channel != eventChannel) {
-                        continue;
-                    }
+                if (!exportRPNs && event.type() == ME_CONTROLLER && event.portamento()) {
+                    // ignore portamento control events if exportRPN isn't switched on
+                    continue;
+                }
 
-                    if (event.type() == ME_NOTEON) {
-                        // use the note values instead of the event values if portamento is suppressed
-                        if (!exportRPNs && event.portamento()) {
-                            track.insert(m_pauseMap.addPauseTicks(i->first), MidiEvent(ME_NOTEON, channel,
-                                                                                       event.note()->pitch(), event.velo()));
-                        } else {
-                            track.insert(m_pauseMap.addPauseTicks(i->first), MidiEvent(ME_NOTEON, channel,
-                                                                                       event.pitch(), event.velo()));
-                        }
-                    } else if (event.type() == ME_CONTROLLER) {
-                        track.insert(m_pauseMap.addPauseTicks(i->first), MidiEvent(ME_CONTROLLER, channel,
-                                                                                   event.controller(), event.value()));
-                    } else if (event.type() == ME_PITCHBEND) {
-                        track.insert(m_pauseMap.addPauseTicks(i->first), MidiEvent(ME_PITCHBEND, channel,
-                                                                                   event.dataA(), event.dataB()));
+                char eventPort    = m_score->masterScore()->midiPort(event.channel());
+                char eventChannel = m_score->masterScore()->midiChannel(event.channel());
+                if (port != eventPort || channel != eventChannel) {
+                    continue;
+                }
+
+                if (event.type() == ME_NOTEON) {
+                    // use the note values instead of the event values if portamento is suppressed
+                    if (!exportRPNs && event.portamento()) {
+                        track.insert(m_pauseMap.addPauseTicks(i->first), MidiEvent(ME_NOTEON, channel,
+                                                                                   event.note()->pitch(), event.velo()));
                     } else {
-                        LOGD("writeMidi: unknown midi event 0x%02x", event.type());
+                        track.insert(m_pauseMap.addPauseTicks(i->first), MidiEvent(ME_NOTEON, channel,
+                                                                                   event.pitch(), event.velo()));
                     }
+                } else if (event.type() == ME_CONTROLLER) {
+                    track.insert(m_pauseMap.addPauseTicks(i->first), MidiEvent(ME_CONTROLLER, channel,
+                                                                               event.controller(), event.value()));
+                } else if (event.type() == ME_PITCHBEND) {
+                    track.insert(m_pauseMap.addPauseTicks(i->first), MidiEvent(ME_PITCHBEND, channel,
+                                                                               event.dataA(), event.dataB()));
+                } else {
+                    LOGD("writeMidi: unknown midi event 0x%02x", event.type());
                 }
             }
         }
-        ++staffIdx;
     }
-    return !m_midiFile.write(device);
 }
 
 bool ExportMidi::write(const QString& name, bool midiExpandRepeats, bool exportRPNs, const SynthesizerState& synthState)
@@ -25,12 +25,15 @@
 
 #include <QFile>
 
+#include "engraving/types/types.h"
+
 #include "../midishared/midifile.h"
 
 namespace mu::engraving {
 class Score;
 class TempoMap;
 class SynthesizerState;
+class NPlayEvent;
 }
 
 namespace mu::iex::midi {
@@ -64,7 +67,11 @@ private:
         inline int addPauseTicks(int utick) const { return utick + this->offsetAtUTick(utick); }
     };
 
+    // <utick, event> in the order of rendering
+    using StaffEvents = std::vector<std::pair<int, engraving::NPlayEvent> >;
+
     void writeHeader();
+    void writeTrack(MidiTrack& track, engraving::staff_idx_t staffIdx, const StaffEvents& events, bool exportRPNs) const;
 
     QFile m_file;
     MidiFile m_midiFile;
@@ -20,6 +20,7 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <future>
 #include <set>
 
 #include <QFile>
@@ -81,6 +82,7 @@
 #include "importmidi_instrument.h"
 #include "importmidi_chordname.h"
 #include "../midishared/midifile.h"
+#include "concurrency/taskscheduler.h"
 
 #include "log.h"
 
@@ -231,57 +233,96 @@ void findAllTupletsForDrums(
     // note: temporary local tuplets and chords are deleted here
 }
 
+// below that, the quantization on the workers doesn't pay off
+static constexpr size_t MIN_TRACKS_TO_QUANTIZE_CONCURRENTLY = 4;
+
+static TaskScheduler* quantizeWorkers()
+{
+    static TaskScheduler workers;
+    return &workers;
+}
+
+void quantizeTrack(MTrack& mtrack,
+                   TimeSigMap* sigmap,
+                   const ReducedFraction& lastTick)
+{
+    auto& opers = midiImportOperations;
+    // pass current track index through MidiImportOperations
+    // for further usage; it's kept per thread
+    MidiOperations::CurrentTrackSetter setCurrentTrack{ opers, mtrack.indexOfOperation };
+
+    const auto basicQuant = Quantize::quantValueToFraction(
+        opers.data()->trackOpers.quantValue.value(mtrack.indexOfOperation));
+#ifdef QT_DEBUG
+    Q_ASSERT_X(MChord::isLastTickValid(lastTick, mtrack.chords),
+               "quantizeTrack", "Last tick is less than max note off time");
+#endif
+    MChord::setBarIndexes(mtrack.chords, basicQuant, lastTick, sigmap);
+
+    if (mtrack.mtrack->drumTrack()) {
+        findAllTupletsForDrums(mtrack, sigmap, basicQuant);
+    } else {
+        MidiTuplet::findAllTuplets(mtrack.tuplets, mtrack.chords, sigmap, basicQuant);
+    }
+#ifdef QT_DEBUG
+    Q_ASSERT_X(!doNotesOverlap(mtrack),
+               "quantizeTrack",
+               "There are overlapping notes of the same voice that is incorrect");
+#endif
+    // (4/3 of the smallest duration) tol is less sensitive
+    // to on time inaccuracies than 1/2 earlier
+    MChord::collectChords(mtrack, { 2, 1 }, { 4, 3 });
+    Quantize::quantizeChords(mtrack.chords, sigmap, basicQuant);
+    MidiTuplet::removeEmptyTuplets(mtrack);
+#ifdef QT_DEBUG
+    Q_ASSERT_X(MidiTuplet::areTupletRangesOk(mtrack.chords, mtrack.tuplets),
+               "quantizeTrack", "Tuplet chord/note is outside tuplet "
+                                "or non-tuplet chord/note is inside tuplet");
+#endif
+}
+
 void quantizeAllTracks(std::multimap<int, MTrack>& tracks,
                        TimeSigMap* sigmap,
                        const ReducedFraction& lastTick)
 {
     auto& opers = midiImportOperations;
 
+    std::vector<MTrack*> tracksToQuantize;
     for (auto& track: tracks) {
         MTrack& mtrack = track.second;
         if (mtrack.chords.empty()) {
             continue;
         }
-        // pass current track index through MidiImportOperations
-        // for further usage
-        MidiOperations::CurrentTrackSetter setCurrentTrack{ opers, mtrack.indexOfOperation };
 
         if (opers.data()->processingsOfOpenedFile == 0) {
             opers.data()->trackOpers.isDrumTrack.setValue(
-                opers.currentTrack(), mtrack.mtrack->drumTrack());
+                mtrack.indexOfOperation, mtrack.mtrack->drumTrack());
             if (mtrack.mtrack->drumTrack()) {
                 opers.data()->trackOpers.maxVoiceCount.setValue(
-                    opers.currentTrack(), MidiOperations::VoiceCount::V_1);
+                    mtrack.indexOfOperation, MidiOperations::VoiceCount::V_1);
             }
         }
-        const auto basicQuant = Quantize::quantValueToFraction(
-            opers.data()->trackOpers.quantValue.value(mtrack.indexOfOperation));
-#ifdef QT_DEBUG
-        Q_ASSERT_X(MChord::isLastTickValid(lastTick, mtrack.chords),
-                   "quantizeAllTracks", "Last tick is less than max note off time");
-#endif
-        MChord::setBarIndexes(mtrack.chords, basicQuant, lastTick, sigmap);
+        tracksToQuantize.push_back(&mtrack);
+    }
 
-        if (mtrack.mtrack->drumTrack()) {
-            findAllTupletsForDrums(mtrack, sigmap, basicQuant);
-        } else {
-            MidiTuplet::findAllTuplets(mtrack.tuplets, mtrack.chords, sigmap, basicQuant);
+    if (tracksToQuantize.size() < MIN_TRACKS_TO_QUANTIZE_CONCURRENTLY) {
+        for (MTrack* mtrack: tracksToQuantize) {
+            quantizeTrack(*mtrack, sigmap, lastTick);
         }
-#ifdef QT_DEBUG
-        Q_ASSERT_X(!doNotesOverlap(track.second),
-                   "quantizeAllTracks",
-                   "There are overlapping notes of the same voice that is incorrect");
-#endif
-        // (4/3 of the smallest duration) tol is less sensitive
-        // to on time inaccuracies than 1/2 earlier
-        MChord::collectChords(mtrack, { 2, 1 }, { 4, 3 });
-        Quantize::quantizeChords(mtrack.chords, sigmap, basicQuant);
-        MidiTuplet::removeEmptyTuplets(mtrack);
-#ifdef QT_DEBUG
-        Q_ASSERT_X(MidiTuplet::areTupletRangesOk(mtrack.chords, mtrack.tuplets),
-                   "quantizeAllTracks", "Tuplet chord/note is outside tuplet "
-                                        "or non-tuplet chord/note is inside tuplet");
-#endif
+        return;
+    }
+
+    // the tracks only share the operations and the time signatures,
+    // which are only read from now on
+    std::vector<std::future<void> > futures;
+    futures.reserve(tracksToQuantize.size());
+    for (MTrack* mtrack: tracksToQuantize) {
+        futures.push_back(quantizeWorkers()->submit([mtrack, sigmap, lastTick]() {
+            quantizeTrack(*mtrack, sigmap, lastTick);
+        }));
+    }
+    for (auto& future: futures) {
+        future.get();
     }
 }
 
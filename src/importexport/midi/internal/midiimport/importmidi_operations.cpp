@@ -30,6 +30,8 @@ namespace mu::iex::midi {
 MidiOperations::Data midiImportOperations;
 
 namespace MidiOperations {
+thread_local int Data::_currentTrack = -1;
+
 static int readBoolFromXml(QXmlStreamReader& xml)
 {
     int value = -1;
@@ -259,7 +259,8 @@ private:
 
     QString _currentMidiFile;
     QString _midiOperationsFile;
-    int _currentTrack = -1;
+    // per thread, so the tracks can be processed concurrently
+    static thread_local int _currentTrack;
 
     std::map<QString, FileData> _data;      // <file name, tracks data>
 };
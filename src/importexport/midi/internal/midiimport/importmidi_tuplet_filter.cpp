@@ -261,11 +261,30 @@ bool isInCommonIndexes(
     return false;
 }
 
+// on time quant errors of the tuplet chords if they were excluded from the tuplet,
+// in the order of TupletInfo::chords; they don't depend on the selected tuplets
+// so they are found once for the whole search instead of for every combination
+using ChordQuantErrors = std::vector<std::vector<ReducedFraction> >;
+
+ChordQuantErrors findChordQuantErrors(
+    const std::vector<TupletInfo>& tuplets,
+    const ReducedFraction& basicQuant)
+{
+    ChordQuantErrors errors(tuplets.size());
+    for (size_t i = 0; i != tuplets.size(); ++i) {
+        errors[i].reserve(tuplets[i].chords.size());
+        for (const auto& chord: tuplets[i].chords) {
+            errors[i].push_back(Quantize::findOnTimeQuantError(*chord.second, basicQuant));
+        }
+    }
+    return errors;
+}
+
 TupletErrorResult findTupletError(
     const std::vector<int>& tupletIndexes,
     const std::vector<TupletInfo>& tuplets,
-    size_t voiceCount,
-    const ReducedFraction& basicQuant)
+    const ChordQuantErrors& chordQuantErrors,
+    size_t voiceCount)
 {
     ReducedFraction sumError{ 0, 1 };
     ReducedFraction sumLengthOfRests{ 0, 1 };
@@ -293,11 +312,13 @@ TupletErrorResult findTupletError(
             continue;
         }
         const auto& tuplet = tuplets[i];
+        size_t chordIndex = 0;
         for (const auto& chord: tuplet.chords) {
+            const auto& quantError = chordQuantErrors[i][chordIndex++];
             if (usedChords.find(&*chord.second) != usedChords.end()) {
                 continue;
             }
-            sumError += Quantize::findOnTimeQuantError(*chord.second, basicQuant);
+            sumError += quantError;
         }
     }
 
@@ -472,12 +493,12 @@ void tryUpdateBestIndexes(
     TupletErrorResult& minCurrentError,
     const std::vector<int>& selectedTuplets,
     const std::vector<TupletInfo>& tuplets,
-    const std::map<int, std::vector<std::pair<ReducedFraction, ReducedFraction> > >& voiceIntervals,
-    const ReducedFraction& basicQuant)
+    const ChordQuantErrors& chordQuantErrors,
+    const std::map<int, std::vector<std::pair<ReducedFraction, ReducedFraction> > >& voiceIntervals)
 {
     const size_t voiceCount = voiceIntervals.size();
     const auto error = findTupletError(selectedTuplets, tuplets,
-                                       voiceCount, basicQuant);
+                                       chordQuantErrors, voiceCount);
     if (!minCurrentError.isInitialized() || error < minCurrentError) {
         minCurrentError = error;
         bestTupletIndexes = selectedTuplets;
@@ -580,9 +601,9 @@ void findNextTuplet(
     TupletErrorResult& minCurrentError,
     const std::vector<TupletCommon>& tupletCommons,
     const std::vector<TupletInfo>& tuplets,
+    const ChordQuantErrors& chordQuantErrors,
     const std::vector<std::pair<ReducedFraction, ReducedFraction> >& tupletIntervals,
-    size_t commonsSize,
-    const ReducedFraction& basicQuant)
+    size_t commonsSize)
 {
     while (!validTuplets.empty()) {
         size_t index = validTuplets.first();
@@ -621,7 +642,7 @@ void findNextTuplet(
             }
             if (!canAddMoreIndexes) {
                 tryUpdateBestIndexes(bestTupletIndexes, minCurrentError,
-                                     selectedTuplets, tuplets, voiceIntervals, basicQuant);
+                                     selectedTuplets, tuplets, chordQuantErrors, voiceIntervals);
             }
             return;
         }
@@ -658,11 +679,11 @@ void findNextTuplet(
             }
             if (!canAddMoreIndexes) {
                 tryUpdateBestIndexes(bestTupletIndexes, minCurrentError,
-                                     selectedTuplets, tuplets, voiceIntervals, basicQuant);
+                                     selectedTuplets, tuplets, chordQuantErrors, voiceIntervals);
             }
         } else {
             findNextTuplet(selectedTuplets, validTuplets, bestTupletIndexes, minCurrentError,
-                           tupletCommons, tuplets, tupletIntervals, commonsSize, basicQuant);
+                           tupletCommons, tuplets, chordQuantErrors, tupletIntervals, commonsSize);
         }
 
         selectedTuplets.pop_back();
@@ -698,11 +719,12 @@ std::vector<int> findBestTuplets(
     std::vector<int> selectedTuplets;
     TupletErrorResult minCurrentError;
     const auto tupletIntervals = findTupletIntervals(tuplets, basicQuant);
+    const auto chordQuantErrors = findChordQuantErrors(tuplets, basicQuant);
 
     ValidTuplets validTuplets(int(tuplets.size()));
 
     findNextTuplet(selectedTuplets, validTuplets, bestTupletIndexes, minCurrentError,
-                   tupletCommons, tuplets, tupletIntervals, commonsSize, basicQuant);
+                   tupletCommons, tuplets, chordQuantErrors, tupletIntervals, commonsSize);
 
     return bestTupletIndexes;
 }
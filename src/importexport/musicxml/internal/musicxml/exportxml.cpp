@@ -40,6 +40,9 @@
 #include "exportxml.h"
 
 #include <math.h>
+#include <map>
+#include <unordered_map>
+#include <vector>
 #include <QBuffer>
 #include <QDate>
 #include <QRegularExpression>
@@ -275,8 +278,12 @@ class SlurHandler
     bool started[MAX_NUMBER_LEVEL];
     int findSlur(const Slur* s) const;
 
+    // writable slurs by their start and end element, built once per export
+    std::unordered_map<const EngravingItem*, std::vector<const Slur*> > chordRestSlurs;
+
 public:
     SlurHandler();
+    void init(const Score* score);
     void doSlurs(const ChordRest* chordRest, Notations& notations, XmlWriter& xml);
 
 private:
@@ -370,6 +377,7 @@ class ExportMusicXml
     TrillHash _trillStart;
     TrillHash _trillStop;
     MxmlInstrumentMap instrMap;
+    std::map<int, std::vector<Spanner*> > _spannersByEndTick;   // in the order of the spanner map, see spannerStop()
 
     int findBracket(const TextLineBase* tl) const;
     int findDashes(const TextLineBase* tl) const;
@@ -441,6 +449,7 @@ public:
     double getTenthsFromInches(double) const;
     double getTenthsFromDots(double) const;
     Fraction tick() const { return _tick; }
+    const std::vector<Spanner*>& spannersEndingAt(const Fraction& tick2) const;
     void writeInstrumentDetails(const Instrument* instrument);
 
     static bool canWrite(const EngravingItem* e);
@@ -805,30 +814,50 @@ static const ChordRest* findFirstChordRest(const Slur* s)
 //   doSlurs
 //---------------------------------------------------------
 
+//---------------------------------------------------------
+//   init
+//    index the writable slurs by their start and end element,
+//    doSlurs() is called for every chord and rest
+//---------------------------------------------------------
+
+void SlurHandler::init(const Score* score)
+{
+    chordRestSlurs.clear();
+    for (const auto& it : score->spanner()) {
+        auto sp = it.second;
+        if (sp->generated() || sp->type() != ElementType::SLUR || !ExportMusicXml::canWrite(sp)) {
+            continue;
+        }
+        const auto s = static_cast<const Slur*>(sp);
+        chordRestSlurs[sp->startElement()].push_back(s);
+        if (sp->endElement() != sp->startElement()) {
+            chordRestSlurs[sp->endElement()].push_back(s);
+        }
+    }
+}
+
 void SlurHandler::doSlurs(const ChordRest* chordRest, Notations& notations, XmlWriter& xml)
 {
+    // search for slur(s) starting or stopping at this chord
+    auto slurs = chordRestSlurs.find(chordRest);
+    if (slurs == chordRestSlurs.end()) {
+        return;
+    }
+
     // loop over all slurs twice, first to handle the stops, then the starts
     for (int i = 0; i < 2; ++i) {
-        // search for slur(s) starting or stopping at this chord
-        for (const auto& it : chordRest->score()->spanner()) {
-            auto sp = it.second;
-            if (sp->generated() || sp->type() != ElementType::SLUR || !ExportMusicXml::canWrite(sp)) {
-                continue;
-            }
-            if (chordRest == sp->startElement() || chordRest == sp->endElement()) {
-                const auto s = static_cast<const Slur*>(sp);
-                const auto firstChordRest = findFirstChordRest(s);
-                if (firstChordRest) {
-                    if (i == 0) {
-                        // first time: do slur stops
-                        if (firstChordRest != chordRest) {
-                            doSlurStop(s, notations, xml);
-                        }
-                    } else {
-                        // second time: do slur starts
-                        if (firstChordRest == chordRest) {
-                            doSlurStart(s, notations, xml);
-                        }
+        for (const Slur* s : slurs->second) {
+            const auto firstChordRest = findFirstChordRest(s);
+            if (firstChordRest) {
+                if (i == 0) {
+                    // first time: do slur stops
+                    if (firstChordRest != chordRest) {
+                        doSlurStop(s, notations, xml);
+                    }
+                } else {
+                    // second time: do slur starts
+                    if (firstChordRest == chordRest) {
+                        doSlurStart(s, notations, xml);
                     }
                 }
             }
@@ -5783,6 +5812,17 @@ static void spannerStart(ExportMusicXml* exp, track_idx_t strack, track_idx_t et
     }
 }
 
+//---------------------------------------------------------
+//  spannersEndingAt
+//---------------------------------------------------------
+
+const std::vector<Spanner*>& ExportMusicXml::spannersEndingAt(const Fraction& tick2) const
+{
+    static const std::vector<Spanner*> none;
+    auto it = _spannersByEndTick.find(tick2.ticks());
+    return it != _spannersByEndTick.end() ? it->second : none;
+}
+
 //---------------------------------------------------------
 //  spannerStop
 //---------------------------------------------------------
@@ -5795,9 +5835,7 @@ static void spannerStart(ExportMusicXml* exp, track_idx_t strack, track_idx_t et
 static void spannerStop(ExportMusicXml* exp, track_idx_t strack, track_idx_t etrack, const Fraction& tick2, staff_idx_t sstaff,
                         QSet<const Spanner*>& stopped)
 {
-    for (auto it : exp->score()->spanner()) {
-        Spanner* e = it.second;
-
+    for (Spanner* e : exp->spannersEndingAt(tick2)) {
         if (!exp->canWrite(e)) {
             continue;
         }
@@ -7286,6 +7324,13 @@ void ExportMusicXml::write(mu::io::IODevice* dev)
 
     calcDivisions();
 
+    // the spanners are looked up for every chord and rest, index them once
+    sh.init(_score);
+    _spannersByEndTick.clear();
+    for (const auto& it : _score->spanner()) {
+        _spannersByEndTick[it.second->tick2().ticks()].push_back(it.second);
+    }
+
     for (int i = 0; i < MAX_NUMBER_LEVEL; ++i) {
         brackets[i] = nullptr;
         dashes[i] = nullptr;
@@ -7373,6 +7418,39 @@ bool saveXml(Score* score, const QString& name)
 //     </rootfiles>
 // </container>
 
+//---------------------------------------------------------
+//   MxlEntryDevice
+//    write only device passing everything written to it
+//    straight into the zip entry being streamed
+//---------------------------------------------------------
+
+class MxlEntryDevice : public mu::io::IODevice
+{
+public:
+    MxlEntryDevice(MQZipWriter& zipwriter)
+        : m_zipwriter(zipwriter) {}
+
+protected:
+    bool doOpen(OpenMode m) override { return m == OpenMode::WriteOnly; }
+    size_t dataSize() const override { return m_size; }
+    const uint8_t* rawData() const override { return nullptr; }
+    bool resizeData(size_t size) override
+    {
+        m_size = size;
+        return true;
+    }
+
+    size_t writeData(const uint8_t* data, size_t len) override
+    {
+        m_zipwriter.writeFile(reinterpret_cast<const char*>(data), static_cast<qint64>(len));
+        return len;
+    }
+
+private:
+    MQZipWriter& m_zipwriter;
+    size_t m_size = 0;
+};
+
 static void writeMxlArchive(Score* score, MQZipWriter& zipwriter, const QString& filename)
 {
     mu::io::Buffer cbuf;
@@ -7391,12 +7469,20 @@ static void writeMxlArchive(Score* score, MQZipWriter& zipwriter, const QString&
 
     zipwriter.addFile("META-INF/container.xml", cbuf.data().toQByteArrayNoCopy());
 
-    mu::io::Buffer dbuf;
-    dbuf.open(mu::io::IODevice::ReadWrite);
-    ExportMusicXml em(score);
-    em.write(&dbuf);
-    dbuf.seek(0);
-    zipwriter.addFile(filename, dbuf.data().toQByteArrayNoCopy());
+    //! NOTE The score is deflated while it is being written, it is never held in memory at once
+    if (!zipwriter.startFile(filename)) {
+        return;
+    }
+
+    MxlEntryDevice dev(zipwriter);
+    dev.open(mu::io::IODevice::WriteOnly);
+    {
+        // the writer flushes what it still buffers when it goes away
+        ExportMusicXml em(score);
+        em.write(&dev);
+    }
+    dev.close();
+    zipwriter.finishFile();
 }
 
 bool saveMxl(Score* score, QIODevice* device)
@@ -7408,7 +7494,7 @@ bool saveMxl(Score* score, QIODevice* device)
     writeMxlArchive(score, uz, fn);
     uz.close();
 
-    return true;
+    return uz.status() == MQZipWriter::NoError;
 }
 
 bool saveMxl(Score* score, const QString& name)
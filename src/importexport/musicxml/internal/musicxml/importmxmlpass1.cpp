@@ -297,14 +297,46 @@ bool MusicXMLParserPass1::determineMeasureLength(QVector<Fraction>& ml) const
 /**
  Get the VoiceList for part \a id.
  Return an empty VoiceList on error.
+ Called from pass 2 for every note, returns a reference to avoid copying the list.
  */
 
-VoiceList MusicXMLParserPass1::getVoiceList(const QString id) const
+const VoiceList& MusicXMLParserPass1::getVoiceList(const QString& id) const
 {
-    if (_parts.contains(id)) {
-        return _parts.value(id).voicelist;
-    }
-    return VoiceList();
+    static const VoiceList empty;
+    auto it = _parts.constFind(id);
+    return it != _parts.cend() ? it->voicelist : empty;
+}
+
+//---------------------------------------------------------
+//   getMusicXmlPart
+//---------------------------------------------------------
+
+/**
+ Get the MusicXmlPart for part \a id.
+ Return an empty MusicXmlPart on error.
+ */
+
+const MusicXmlPart& MusicXMLParserPass1::getMusicXmlPart(const QString& id) const
+{
+    static const MusicXmlPart empty;
+    auto it = _parts.constFind(id);
+    return it != _parts.cend() ? *it : empty;
+}
+
+//---------------------------------------------------------
+//   getInstruments
+//---------------------------------------------------------
+
+/**
+ Get the MusicXMLInstruments for part \a id.
+ Return an empty MusicXMLInstruments on error.
+ */
+
+const MusicXMLInstruments& MusicXMLParserPass1::getInstruments(const QString& id) const
+{
+    static const MusicXMLInstruments empty;
+    auto it = _instruments.constFind(id);
+    return it != _instruments.cend() ? *it : empty;
 }
 
 //---------------------------------------------------------
@@ -316,12 +348,11 @@ VoiceList MusicXMLParserPass1::getVoiceList(const QString id) const
  Return an empty MusicXmlInstrList on error.
  */
 
-MusicXmlInstrList MusicXMLParserPass1::getInstrList(const QString id) const
+const MusicXmlInstrList& MusicXMLParserPass1::getInstrList(const QString& id) const
 {
-    if (_parts.contains(id)) {
-        return _parts.value(id)._instrList;
-    }
-    return MusicXmlInstrList();
+    static const MusicXmlInstrList empty;
+    auto it = _parts.constFind(id);
+    return it != _parts.cend() ? it->_instrList : empty;
 }
 
 //---------------------------------------------------------
@@ -333,12 +364,11 @@ MusicXmlInstrList MusicXMLParserPass1::getInstrList(const QString id) const
  Return an empty MusicXmlIntervalList on error.
  */
 
-MusicXmlIntervalList MusicXMLParserPass1::getIntervals(const QString id) const
+const MusicXmlIntervalList& MusicXMLParserPass1::getIntervals(const QString& id) const
 {
-    if (_parts.contains(id)) {
-        return _parts.value(id)._intervals;
-    }
-    return MusicXmlIntervalList();
+    static const MusicXmlIntervalList empty;
+    auto it = _parts.constFind(id);
+    return it != _parts.cend() ? it->_intervals : empty;
 }
 
 //---------------------------------------------------------
@@ -380,7 +410,7 @@ void MusicXMLParserPass1::setDrumsetDefault(const QString& id,
 bool MusicXMLParserPass1::determineStaffMoveVoice(const QString& id, const int mxStaff, const QString& mxVoice,
                                                   int& msMove, int& msTrack, int& msVoice) const
 {
-    VoiceList voicelist = getVoiceList(id);
+    const VoiceList& voicelist = getVoiceList(id);
     msMove = 0;   // TODO
     msTrack = 0;   // TODO
     msVoice = 0;   // TODO
@@ -494,8 +524,9 @@ Fraction MusicXMLParserPass1::getMeasureStart(const int i) const
 
 int MusicXMLParserPass1::octaveShift(const QString& id, const staff_idx_t staff, const Fraction f) const
 {
-    if (_parts.contains(id)) {
-        return _parts.value(id).octaveShift(staff, f);
+    auto it = _parts.constFind(id);
+    if (it != _parts.cend()) {
+        return it->octaveShift(staff, f);
     }
 
     return 0;
@@ -3223,11 +3254,7 @@ void MusicXMLParserPass1::note(const QString& partId,
 
     // store result
     if (dura.isValid() && dura > Fraction(0, 1)) {
-        // count the chords
-        if (!_parts.value(partId).voicelist.contains(voice)) {
-            VoiceDesc vs;
-            _parts[partId].voicelist.insert(voice, vs);
-        }
+        // count the chords (operator[] inserts a default VoiceDesc for a new voice)
         _parts[partId].voicelist[voice].incrChordRests(staff);
         // determine note length for voice overlap detection
         vod.addNote((sTime + missingPrev).ticks(), (sTime + missingPrev + dura).ticks(), voice, staff);
@@ -159,17 +159,17 @@ public:
     void rest();
     void skipLogCurrElem();
     bool determineMeasureLength(QVector<Fraction>& ml) const;
-    VoiceList getVoiceList(const QString id) const;
+    const VoiceList& getVoiceList(const QString& id) const;
     bool determineStaffMoveVoice(const QString& id, const int mxStaff, const QString& mxVoice, int& msMove, int& msTrack,
                                  int& msVoice) const;
     track_idx_t trackForPart(const QString& id) const;
     bool hasPart(const QString& id) const;
     Part* getPart(const QString& id) const { return _partMap.value(id); }
-    MusicXmlPart getMusicXmlPart(const QString& id) const { return _parts.value(id); }
-    MusicXMLInstruments getInstruments(const QString& id) const { return _instruments.value(id); }
+    const MusicXmlPart& getMusicXmlPart(const QString& id) const;
+    const MusicXMLInstruments& getInstruments(const QString& id) const;
     void setDrumsetDefault(const QString& id, const QString& instrId, const NoteHeadGroup hg, const int line, const DirectionV sd);
-    MusicXmlInstrList getInstrList(const QString id) const;
-    MusicXmlIntervalList getIntervals(const QString id) const;
+    const MusicXmlInstrList& getInstrList(const QString& id) const;
+    const MusicXmlIntervalList& getIntervals(const QString& id) const;
     Fraction getMeasureStart(const int i) const;
     int octaveShift(const QString& id, const staff_idx_t staff, const Fraction f) const;
     const CreditWordsList& credits() const { return _credits; }
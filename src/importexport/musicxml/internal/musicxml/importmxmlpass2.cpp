@@ -1703,7 +1703,7 @@ void MusicXMLParserPass2::part()
     setPartInstruments(_logger, &_e, part, id, _score, _pass1.getInstrList(id), _pass1.getIntervals(id), instruments);
 
     // set the part name
-    auto mxmlPart = _pass1.getMusicXmlPart(id);
+    const auto& mxmlPart = _pass1.getMusicXmlPart(id);
     part->setPartName(mxmlPart.getName());
     if (mxmlPart.getPrintName()) {
         part->setLongName(mxmlPart.getName());
@@ -1718,7 +1718,7 @@ void MusicXMLParserPass2::part()
     }
 
 #ifdef DEBUG_VOICE_MAPPER
-    VoiceList voicelist = _pass1.getVoiceList(id);
+    const VoiceList& voicelist = _pass1.getVoiceList(id);
     // debug: print voice mapper contents
     LOGD("voiceMapperStats: part '%s'", qPrintable(id));
     for (QMap<QString, mu::engraving::VoiceDesc>::const_iterator i = voicelist.constBegin(); i != voicelist.constEnd(); ++i) {
@@ -5429,7 +5429,7 @@ void MusicXMLParserPass2::backup(Fraction& dura)
 //   MusicXMLParserLyric
 //---------------------------------------------------------
 
-MusicXMLParserLyric::MusicXMLParserLyric(const LyricNumberHandler lyricNumberHandler,
+MusicXMLParserLyric::MusicXMLParserLyric(const LyricNumberHandler& lyricNumberHandler,
                                          QXmlStreamReader& e, Score* score, MxmlLogger* logger)
     : _lyricNumberHandler(lyricNumberHandler), _e(e), _score(score), _logger(logger)
 {
@@ -3984,6 +3984,17 @@ bool StreamHandle::write(char* /* buff */, int /* size */)
     return true;
 }
 
+bool StreamHandle::skip(int size)
+{
+    if (m_point != NULL && size >= 0 && m_curPos + size <= m_size) {
+        m_curPos += size;
+
+        return true;
+    }
+
+    return false;
+}
+
 Block::Block()
 {
     doResize(0);
@@ -4001,27 +4012,22 @@ void Block::resize(unsigned int count)
 
 void Block::doResize(unsigned int count)
 {
-    m_data.clear();
-    for (unsigned int i = 0; i < count; ++i) {
-        m_data.push_back('\0');
-    }
-    // m_data.resize(count);
+    m_data.assign(count, '\0');
 }
 
 const unsigned char* Block::data() const
 {
-    // return const_cast<unsigned char*>(&m_data.front());
-    return &m_data.front();
+    return m_data.empty() ? NULL : m_data.data();
 }
 
 unsigned char* Block::data()
 {
-    return &m_data.front();
+    return m_data.empty() ? NULL : m_data.data();
 }
 
 int Block::size() const
 {
-    return m_data.size();
+    return static_cast<int>(m_data.size());
 }
 
 bool Block::toBoolean() const
@@ -4357,8 +4363,7 @@ bool BasicParse::jump(int offset)
     }
 
     if (offset > 0) {
-        Block placeHolder(offset);
-        return m_handle->read((char*)placeHolder.data(), placeHolder.size());
+        return m_handle->skip(offset);
     }
 
     return true;
@@ -26,6 +26,7 @@
 #include <QList>
 #include <QString>
 #include <cmath>
+#include <vector>
 
 #ifdef WIN32
 #define DLL_EXPORT extern "C" __declspec(dllexport)
@@ -2232,6 +2233,8 @@ private:
 public:
     virtual bool read(char* buff, int size);
     virtual bool write(char* buff, int size);
+    // advances the read position without copying the skipped bytes
+    virtual bool skip(int size);
 
 private:
     int m_size;
@@ -2271,7 +2274,8 @@ private:
 
 private:
     // char [-128, 127], unsigned char [0, 255]
-    QList<unsigned char> m_data;
+    // contiguous, so that the stream can copy a whole block in one call
+    std::vector<unsigned char> m_data;
 };
 
 class FixedBlock : public Block
@@ -62,7 +62,25 @@ VideoEncoder::~VideoEncoder()
     delete m_ffmpeg;
 }
 
-bool VideoEncoder::open(const io::path_t& fileName, unsigned width, unsigned height, unsigned bitrate, unsigned gop, unsigned fps)
+//! NOTE The hardware encoders (h264_nvenc, h264_videotoolbox, ...) take the same software frames as the default one.
+//! The VAAPI ones only take frames from a hardware frames context, so they are not supported
+static AVCodec* findEncoder(const std::string& encoderName)
+{
+    if (!encoderName.empty()) {
+        if (encoderName.find("vaapi") != std::string::npos) {
+            LOGW() << "not supported encoder: " << encoderName << ", the default one is used";
+        } else if (AVCodec* codec = avcodec_find_encoder_by_name(encoderName.c_str())) {
+            return codec;
+        } else {
+            LOGW() << "not found encoder: " << encoderName << ", the default one is used";
+        }
+    }
+
+    return avcodec_find_encoder(AV_CODEC_ID_H264);
+}
+
+bool VideoEncoder::open(const io::path_t& fileName, unsigned width, unsigned height, unsigned bitrate, unsigned gop, unsigned fps,
+                        const std::string& encoderName)
 {
     m_ffmpeg->ptsCounter = 0;
 
@@ -131,15 +149,26 @@ bool VideoEncoder::open(const io::path_t& fileName, unsigned width, unsigned hei
 
     // open_video
     // find the video encoder
-    m_ffmpeg->codec = avcodec_find_encoder(m_ffmpeg->codecCtx->codec_id);
+    m_ffmpeg->codec = findEncoder(encoderName);
     if (!m_ffmpeg->codec) {
         LOGE() << "not found codec";
         return false;
     }
     // open the codec
     if (avcodec_open2(m_ffmpeg->codecCtx, m_ffmpeg->codec, 0) < 0) {
-        LOGE() << "failed open codec";
-        return false;
+        // a hardware encoder is found but there may be no device for it
+        AVCodec* defaultCodec = avcodec_find_encoder(AV_CODEC_ID_H264);
+        if (m_ffmpeg->codec == defaultCodec || !defaultCodec) {
+            LOGE() << "failed open codec";
+            return false;
+        }
+
+        LOGW() << "failed open encoder: " << m_ffmpeg->codec->name << ", the default one is used";
+        m_ffmpeg->codec = defaultCodec;
+        if (avcodec_open2(m_ffmpeg->codecCtx, m_ffmpeg->codec, 0) < 0) {
+            LOGE() << "failed open codec";
+            return false;
+        }
     }
 
     // Allocate the YUV frame
@@ -22,6 +22,7 @@
 #ifndef MU_IMPORTEXPORT_VIDEOENCODER_H
 #define MU_IMPORTEXPORT_VIDEOENCODER_H
 
+#include <string>
 #include <QImage>
 #include "io/path.h"
 
@@ -33,7 +34,8 @@ public:
     VideoEncoder();
     ~VideoEncoder();
 
-    bool open(const io::path_t& fileName, unsigned width, unsigned height, unsigned bitrate, unsigned gop, unsigned fps);
+    bool open(const io::path_t& fileName, unsigned width, unsigned height, unsigned bitrate, unsigned gop, unsigned fps,
+              const std::string& encoderName = std::string());
     void close();
 
     bool encodeImage(const QImage& img);
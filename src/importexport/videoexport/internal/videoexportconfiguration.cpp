@@ -28,6 +28,7 @@ static std::string DEFAULT_RESOLUTION = "1080p";
 static int DEFAULT_FPS = 24;
 static double DEFAULT_LEADING_SEC = 3.0;
 static double DEFAULT_TRAILING_SECONDS = 3.0;
+static std::string DEFAULT_ENCODER = "";
 
 using namespace mu::iex::videoexport;
 
@@ -100,3 +101,13 @@ void VideoExportConfiguration::setTrailingSec(std::optional<double> trailingSec)
 {
     m_trailingSec = trailingSec;
 }
+
+std::string VideoExportConfiguration::encoder() const
+{
+    return m_encoder ? m_encoder.value() : DEFAULT_ENCODER;
+}
+
+void VideoExportConfiguration::setEncoder(std::optional<std::string> encoder)
+{
+    m_encoder = encoder;
+}
@@ -21,8 +21,14 @@
  */
 #include "videowriter.h"
 
+#include <algorithm>
+#include <deque>
+#include <map>
+
 #include "videoencoder.h"
 
+#include "concurrency/taskscheduler.h"
+
 #include "engraving/libmscore/page.h"
 #include "engraving/libmscore/system.h"
 #include "engraving/libmscore/repeatlist.h"
@@ -104,17 +110,25 @@ mu::Ret VideoWriter::write(INotationProjectPtr project, const io::path_t& filePa
 
     cfg.leadingSec = configuration()->leadingSec();
     cfg.trailingSec = configuration()->trailingSec();
+    cfg.encoder = configuration()->encoder();
 
     Ret ret = generatePagedOriginalVideo(project, filePath, cfg);
     return ret;
 }
 
+//! NOTE The frames are composed on their own workers, not on the shared ones, which are used by the audio
+static mu::TaskScheduler* frameWorkers()
+{
+    static mu::TaskScheduler workers(std::thread::hardware_concurrency());
+    return &workers;
+}
+
 mu::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, const io::path_t& filePath, const Config& config)
 {
     // --score-video -o ./simple5.mp4 ./simple5.mscz
 
     VideoEncoder encoder;
-    if (!encoder.open(filePath, config.width, config.height, config.bitrate, config.fps / 2, config.fps)) {
+    if (!encoder.open(filePath, config.width, config.height, config.bitrate, config.fps / 2, config.fps, config.encoder)) {
         LOGE() << "failed open encoder";
         return make_ret(Ret::Code::UnknownError);
     }
@@ -158,18 +172,52 @@ mu::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, con
     score->update();
 
     // Setup painting
-    QImage frame(config.width, config.height, QImage::Format_RGB32);
-    frame.setDotsPerMeterX(std::lrint((CANVAS_DPI * 1000) / engraving::INCH));
-    frame.setDotsPerMeterY(std::lrint((CANVAS_DPI * 1000) / engraving::INCH));
+    //! NOTE Only the cursor changes between the frames of a page,
+    //! so each page is painted once and the frames are composed from its raster
+    const size_t MAX_CACHED_PAGES = 4;
+    std::map<int, QImage> pageRasters;
+    std::deque<int> pageRastersOrder;
 
-    QPainter qp(&frame);
-    qp.setRenderHint(QPainter::Antialiasing, true);
-    qp.setRenderHint(QPainter::TextAntialiasing, true);
-    RectF frameRect = RectF::fromQRectF(QRectF(frame.rect()));
+    auto painting = masterNotation->notation()->painting();
+    painting->prepareView(RectF(), /*isPrinting*/ true);
 
-    draw::Painter painter(&qp, "video_writer");
+    auto pageRaster = [&](const Page* page) -> const QImage& {
+        auto it = pageRasters.find(page->no());
+        if (it != pageRasters.end()) {
+            return it->second;
+        }
 
-    auto painting = masterNotation->notation()->painting();
+        if (pageRastersOrder.size() >= MAX_CACHED_PAGES) {
+            pageRasters.erase(pageRastersOrder.front());
+            pageRastersOrder.pop_front();
+        }
+
+        QImage raster(config.width, config.height, QImage::Format_RGB32);
+        raster.setDotsPerMeterX(std::lrint((CANVAS_DPI * 1000) / engraving::INCH));
+        raster.setDotsPerMeterY(std::lrint((CANVAS_DPI * 1000) / engraving::INCH));
+        raster.fill(Qt::white);
+
+        {
+            QPainter qp(&raster);
+            qp.setRenderHint(QPainter::Antialiasing, true);
+            qp.setRenderHint(QPainter::TextAntialiasing, true);
+
+            draw::Painter painter(&qp, "video_writer");
+
+            INotationPainting::Options opt;
+            opt.fromPage = page->no();
+            opt.toPage = opt.fromPage;
+            opt.deviceDpi = CANVAS_DPI;
+
+            painting->paintPrint(&painter, opt);
+        }
+
+        pageRastersOrder.push_back(page->no());
+        return pageRasters.emplace(page->no(), std::move(raster)).first->second;
+    };
+
+    // the cursor is laid out in score units, the rasters are in device pixels
+    const double CURSOR_SCALE = CANVAS_DPI / engraving::DPI;
 
     // Setup duration
     INotationPlaybackPtr playback = masterNotation->playback();
@@ -193,6 +241,27 @@ mu::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, con
     PlaybackCursor cursor;
     cursor.setNotation(masterNotation->notation());
 
+    //! NOTE The frames are composed by the frame workers and encoded in order on the encoder worker,
+    //! while the next ones are being prepared here. The frames in flight are bounded to keep the memory down
+    TaskScheduler encodeWorker(1);
+    const size_t MAX_FRAMES_IN_FLIGHT = std::max<size_t>(2, frameWorkers()->threadPoolSize() * 2);
+    std::deque<std::future<QImage> > composing;
+    std::deque<std::future<void> > encoding;
+
+    auto encodeNextFrame = [&]() {
+        QImage frame = composing.front().get();
+        composing.pop_front();
+
+        encoding.push_back(encodeWorker.submit([&encoder, frame]() {
+            encoder.encodeImage(frame);
+        }));
+
+        if (encoding.size() > MAX_FRAMES_IN_FLIGHT) {
+            encoding.front().get();
+            encoding.pop_front();
+        }
+    };
+
     for (int f = 0; f < frameCount; f++) {
         float currentTimeSec = (qreal)f / config.fps;
         currentTimeSec -= config.leadingSec;
@@ -210,24 +279,37 @@ mu::Ret VideoWriter::generatePagedOriginalVideo(INotationProjectPtr project, con
             break;
         }
 
-        INotationPainting::Options opt;
-        opt.fromPage = page->no();
-        opt.toPage = opt.fromPage;
-        opt.deviceDpi = CANVAS_DPI;
-
-        painter.fillRect(frameRect, draw::Color::white);
-
-        painting->paintPrint(&painter, opt);
+        const QImage& raster = pageRaster(page);
 
         cursor.move(tick);
 
         RectF cursorRect = cursor.rect();
         PointF pagePos = page->pos();
         RectF cursorAbsRect = cursorRect.translated(-pagePos);
+        QRectF cursorFrameRect(cursorAbsRect.x() * CURSOR_SCALE, cursorAbsRect.y() * CURSOR_SCALE,
+                               cursorAbsRect.width() * CURSOR_SCALE, cursorAbsRect.height() * CURSOR_SCALE);
+
+        // the raster is shared with the worker and copied on its first paint there
+        composing.push_back(frameWorkers()->submit([raster, cursorFrameRect, CURSOR_COLOR]() {
+            QImage frame = raster;
+            QPainter qp(&frame);
+            qp.setRenderHint(QPainter::Antialiasing, true);
+            qp.fillRect(cursorFrameRect, CURSOR_COLOR.toQColor());
+            qp.end();
+            return frame;
+        }));
+
+        if (composing.size() > MAX_FRAMES_IN_FLIGHT) {
+            encodeNextFrame();
+        }
+    }
 
-        painter.fillRect(cursorAbsRect, CURSOR_COLOR);
+    while (!composing.empty()) {
+        encodeNextFrame();
+    }
 
-        encoder.encodeImage(frame);
+    for (std::future<void>& encoded : encoding) {
+        encoded.get();
     }
 
     encoder.close();
@@ -49,6 +49,7 @@ private:
         int bitrate = 800000;
         float leadingSec = 3.;
         float trailingSec = 3.;
+        std::string encoder;
     };
 
     Ret generatePagedOriginalVideo(project::INotationProjectPtr project, const io::path_t& filePath, const Config& config);
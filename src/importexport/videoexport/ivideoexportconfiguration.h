@@ -56,6 +56,10 @@ public:
 
     virtual double trailingSec() const = 0;
     virtual void setTrailingSec(std::optional<double> trailingSec) = 0;
+
+    //! NOTE The name of the ffmpeg encoder, ex h264_nvenc; empty is the default software H.264 encoder
+    virtual std::string encoder() const = 0;
+    virtual void setEncoder(std::optional<std::string> encoder) = 0;
 };
 }
 
@@ -23,6 +23,9 @@
 
 #include "types/texttypes.h"
 
+#include "libmscore/score.h"
+#include "libmscore/undo.h"
+
 #include "log.h"
 
 using namespace mu::inspector;
@@ -276,6 +279,10 @@ void AbstractInspectorModel::onPropertyValueChanged(const mu::engraving::Pid pid
 
     beginCommand();
 
+    //! NOTE record the changes on a big selection as a few undo commands
+    mu::engraving::UndoStack* engravingUndoStack = m_elementList.front()->score()->undoStack();
+    engravingUndoStack->beginPropertyBatch();
+
     for (mu::engraving::EngravingItem* element : m_elementList) {
         IF_ASSERT_FAILED(element) {
             continue;
@@ -291,6 +298,8 @@ void AbstractInspectorModel::onPropertyValueChanged(const mu::engraving::Pid pid
         element->undoChangeProperty(pid, propValue, ps);
     }
 
+    engravingUndoStack->endPropertyBatch();
+
     updateNotation();
     endCommand();
 }
@@ -0,0 +1,108 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "instrumentssearchindex.h"
+
+#include "log.h"
+
+using namespace mu::instrumentsscene;
+using namespace mu::notation;
+
+static constexpr int TRIGRAM_SIZE = 3;
+
+InstrumentsSearchIndex::Trigram InstrumentsSearchIndex::trigram(const QString& str, int pos)
+{
+    return (static_cast<Trigram>(str.at(pos).unicode()) << 32)
+           | (static_cast<Trigram>(str.at(pos + 1).unicode()) << 16)
+           | static_cast<Trigram>(str.at(pos + 2).unicode());
+}
+
+void InstrumentsSearchIndex::build(const InstrumentTemplateList& templates)
+{
+    TRACEFUNC;
+
+    m_templates.clear();
+    m_names.clear();
+    m_trigrams.clear();
+
+    for (const InstrumentTemplate* templ : templates) {
+        const int index = static_cast<int>(m_templates.size());
+        const QString name = templ->trackName.toQString().toLower();
+
+        m_templates.push_back(templ);
+        m_names.push_back(name);
+
+        for (int pos = 0; pos + TRIGRAM_SIZE <= name.size(); ++pos) {
+            std::vector<int>& indexes = m_trigrams[trigram(name, pos)];
+            if (indexes.empty() || indexes.back() != index) {
+                indexes.push_back(index);
+            }
+        }
+    }
+}
+
+bool InstrumentsSearchIndex::isEmpty() const
+{
+    return m_templates.empty();
+}
+
+QSet<const InstrumentTemplate*> InstrumentsSearchIndex::search(const QString& text) const
+{
+    QSet<const InstrumentTemplate*> result;
+
+    const QString lowerText = text.toLower();
+    if (lowerText.isEmpty()) {
+        return result;
+    }
+
+    auto addIfContains = [this, &lowerText, &result](int index) {
+        if (m_names[index].contains(lowerText)) {
+            result.insert(m_templates[index]);
+        }
+    };
+
+    //! NOTE The short texts have no trigram, all the names are checked
+    if (lowerText.size() < TRIGRAM_SIZE) {
+        for (int index = 0; index < static_cast<int>(m_names.size()); ++index) {
+            addIfContains(index);
+        }
+
+        return result;
+    }
+
+    const std::vector<int>* rarest = nullptr;
+    for (int pos = 0; pos + TRIGRAM_SIZE <= lowerText.size(); ++pos) {
+        auto it = m_trigrams.constFind(trigram(lowerText, pos));
+        if (it == m_trigrams.constEnd()) {
+            return result;
+        }
+
+        if (!rarest || it->size() < rarest->size()) {
+            rarest = &it.value();
+        }
+    }
+
+    for (int index : *rarest) {
+        addIfContains(index);
+    }
+
+    return result;
+}
@@ -0,0 +1,55 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_INSTRUMENTSSCENE_INSTRUMENTSSEARCHINDEX_H
+#define MU_INSTRUMENTSSCENE_INSTRUMENTSSEARCHINDEX_H
+
+#include <vector>
+
+#include <QHash>
+#include <QSet>
+#include <QString>
+
+#include "notation/notationtypes.h"
+
+namespace mu::instrumentsscene {
+//! NOTE Finds the instrument templates whose track name contains a text, case insensitively.
+//! The lower case names are split into trigrams once, so a search only checks
+//! the names which contain the rarest trigram of the text
+class InstrumentsSearchIndex
+{
+public:
+    void build(const notation::InstrumentTemplateList& templates);
+    bool isEmpty() const;
+
+    QSet<const notation::InstrumentTemplate*> search(const QString& text) const;
+
+private:
+    using Trigram = quint64;
+    static Trigram trigram(const QString& str, int pos);
+
+    std::vector<const notation::InstrumentTemplate*> m_templates;
+    std::vector<QString> m_names;
+    QHash<Trigram, std::vector<int> > m_trigrams;
+};
+}
+
+#endif // MU_INSTRUMENTSSCENE_INSTRUMENTSSEARCHINDEX_H
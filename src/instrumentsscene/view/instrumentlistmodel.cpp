@@ -413,6 +413,17 @@ void InstrumentListModel::setSearchText(const QString& text)
     }
 
     m_searchText = text;
+
+    if (isSearching()) {
+        if (m_searchIndex.isEmpty()) {
+            m_searchIndex.build(repository()->instrumentTemplates());
+        }
+
+        m_searchMatches = m_searchIndex.search(m_searchText);
+    } else {
+        m_searchMatches.clear();
+    }
+
     updateStateBySearch();
 }
 
@@ -497,7 +508,7 @@ void InstrumentListModel::updateStateBySearch()
 bool InstrumentListModel::isInstrumentAccepted(const InstrumentTemplate& instrument, bool compareWithCurrentGroup) const
 {
     if (isSearching()) {
-        return instrument.trackName.toQString().contains(m_searchText, Qt::CaseInsensitive);
+        return m_searchMatches.contains(&instrument);
     }
 
     if (instrument.groupId != m_currentGroupId && compareWithCurrentGroup) {
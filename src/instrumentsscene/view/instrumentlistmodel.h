@@ -31,6 +31,8 @@
 
 #include "uicomponents/view/itemmultiselectionmodel.h"
 
+#include "internal/instrumentssearchindex.h"
+
 namespace mu::instrumentsscene {
 class InstrumentListModel : public QAbstractListModel, public async::Asyncable
 {
@@ -135,6 +137,9 @@ private:
     QString m_currentGroupId;
     QString m_searchText;
 
+    InstrumentsSearchIndex m_searchIndex;
+    QSet<const notation::InstrumentTemplate*> m_searchMatches;
+
     Instruments m_instruments;
     uicomponents::ItemMultiSelectionModel* m_selection = nullptr;
 
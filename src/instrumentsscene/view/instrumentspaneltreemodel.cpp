@@ -173,7 +173,7 @@ void InstrumentsPanelTreeModel::setupPartsConnections()
     async::NotifyList<const Part*> notationParts = m_notation->parts()->partList();
 
     notationParts.onChanged(m_partsNotifyReceiver.get(), [this]() {
-        load();
+        updateParts();
     });
 
     auto updateMasterPartItem = [this](const ID& partId) {
@@ -195,6 +195,100 @@ void InstrumentsPanelTreeModel::setupPartsConnections()
     });
 }
 
+//! NOTE Each undo/redo reports the whole part list as changed, most often (ex undo of a note input)
+//! the parts and their staves are the same, then only the items are refreshed instead of rebuilding the tree
+void InstrumentsPanelTreeModel::updateParts()
+{
+    if (m_isLoadingBlocked) {
+        return;
+    }
+
+    if (!m_rootItem || !m_masterNotation || !m_notation) {
+        load();
+        return;
+    }
+
+    TRACEFUNC;
+
+    async::NotifyList<const Part*> masterParts = m_masterNotation->parts()->partList();
+    sortParts(masterParts);
+
+    if (!isTreeUpToDate(masterParts)) {
+        load();
+        return;
+    }
+
+    INotationPartsPtr masterNotationParts = m_masterNotation->parts();
+
+    for (int i = 0; i < m_rootItem->childCount(); ++i) {
+        auto partItem = dynamic_cast<PartTreeItem*>(m_rootItem->childAtRow(i));
+        if (!partItem) {
+            continue;
+        }
+
+        partItem->init(masterParts.at(i));
+
+        for (AbstractInstrumentsPanelTreeItem* item : partItem->childItems()) {
+            if (auto staffItem = dynamic_cast<StaffTreeItem*>(item)) {
+                staffItem->init(masterNotationParts->staff(staffItem->id()));
+            }
+        }
+    }
+
+    updateRemovingAvailability();
+}
+
+bool InstrumentsPanelTreeModel::isTreeUpToDate(const notation::PartList& masterParts) const
+{
+    const QList<AbstractInstrumentsPanelTreeItem*>& partItems = m_rootItem->childItems();
+    if (partItems.size() != static_cast<int>(masterParts.size())) {
+        return false;
+    }
+
+    INotationPartsPtr notationParts = m_notation->parts();
+    INotationPartsPtr masterNotationParts = m_masterNotation->parts();
+
+    for (int i = 0; i < partItems.size(); ++i) {
+        const AbstractInstrumentsPanelTreeItem* partItem = partItems.at(i);
+        const Part* masterPart = masterParts.at(i);
+
+        if (partItem->id() != masterPart->id()) {
+            return false;
+        }
+
+        //! NOTE The visibility change of an item is applied to the score, so it must not come from a refresh
+        const Part* part = notationParts->part(masterPart->id());
+        if (partItem->isVisible() != (part && part->show())) {
+            return false;
+        }
+
+        QList<const AbstractInstrumentsPanelTreeItem*> staffItems;
+        for (const AbstractInstrumentsPanelTreeItem* item : partItem->childItems()) {
+            if (item->type() == static_cast<int>(InstrumentsTreeItemType::ItemType::STAFF)) {
+                staffItems << item;
+            }
+        }
+
+        const async::NotifyList<const Staff*> masterStaves = masterNotationParts->staffList(masterPart->id());
+        if (staffItems.size() != static_cast<int>(masterStaves.size())) {
+            return false;
+        }
+
+        for (int j = 0; j < staffItems.size(); ++j) {
+            if (staffItems.at(j)->id() != masterStaves.at(j)->id()) {
+                return false;
+            }
+
+            const Staff* staff = notationParts->staff(masterStaves.at(j)->id());
+            if (staffItems.at(j)->isVisible() != (staff && staff->show())) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
 void InstrumentsPanelTreeModel::setupStavesConnections(const ID& stavesPartId)
 {
     async::NotifyList<const Staff*> notationStaves = m_notation->parts()->staffList(stavesPartId);
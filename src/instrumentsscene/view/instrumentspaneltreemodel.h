@@ -119,6 +119,8 @@ private:
     void sortParts(notation::PartList& parts);
 
     void setupPartsConnections();
+    void updateParts();
+    bool isTreeUpToDate(const notation::PartList& masterParts) const;
     void setupStavesConnections(const ID& stavesPartId);
     void listenNotationSelectionChanged();
 
@@ -164,6 +164,9 @@ bool MultiInstancesProvider::isProjectAlreadyOpened(const io::path_t& projectPat
     return ret;
 }
 
+//! NOTE A project already opened in another instance is not handed over, that instance is brought to front.
+//! Parsed scores are graphs of raw pointers valid only in their process, so they can't be shared,
+//! and copied or dragged content goes through the system clipboard, which other instances read directly
 void MultiInstancesProvider::activateWindowWithProject(const io::path_t& projectPath)
 {
     if (!isInited()) {
@@ -85,6 +85,10 @@ public:
     virtual int selectionProximity() const = 0;
     virtual void setSelectionProximity(int proximity) = 0;
 
+    //! NOTE Below this zoom, in pixels per spatium, the views paint the score with less detail, 0 to turn it off
+    virtual double levelOfDetailThreshold() const = 0;
+    virtual void setLevelOfDetailThreshold(double pixelsPerSpatium) = 0;
+
     virtual ZoomType defaultZoomType() const = 0;
     virtual void setDefaultZoomType(ZoomType zoomType) = 0;
 
@@ -148,6 +152,13 @@ public:
     virtual int delayBetweenNotesInRealTimeModeMilliseconds() const = 0;
     virtual void setDelayBetweenNotesInRealTimeModeMilliseconds(int delayMs) = 0;
 
+    virtual int midiChordInputWindowMilliseconds() const = 0;
+    virtual void setMidiChordInputWindowMilliseconds(int windowMs) = 0;
+
+    //! 0: the note input is always laid out with the full quality
+    virtual int draftLayoutRefineDelayMilliseconds() const = 0;
+    virtual void setDraftLayoutRefineDelayMilliseconds(int delayMs) = 0;
+
     virtual int notePlayDurationMilliseconds() const = 0;
     virtual void setNotePlayDurationMilliseconds(int durationMs) = 0;
 
@@ -46,6 +46,7 @@ public:
     // Shadow note
     virtual void showShadowNote(const PointF& pos) = 0;
     virtual void hideShadowNote() = 0;
+    virtual RectF shadowNoteRect() const = 0;
 
     // Visibility
     virtual void toggleVisible() = 0;
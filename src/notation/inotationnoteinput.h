@@ -68,6 +68,9 @@ public:
 
     virtual async::Notification noteAdded() const = 0;
     virtual async::Notification stateChanged() const = 0;
+
+    //! the pages laid out as a draft during the note input have been laid out again
+    virtual async::Notification draftLayoutRefined() const = 0;
 };
 
 using INotationNoteInputPtr = std::shared_ptr<INotationNoteInput>;
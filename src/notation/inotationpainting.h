@@ -43,6 +43,28 @@ public:
     virtual SizeF pageSizeInch() const = 0;
 
     virtual void paintView(draw::Painter* painter, const RectF& frameRect, bool isPrinting) = 0;
+
+    //! NOTE Lays out the pages and the measures about to be shown in the given area,
+    //! or the whole score for printing. Called before painting, when the view or the score changes
+    virtual void prepareView(const RectF& frameRect, bool isPrinting) = 0;
+
+    //! NOTE The parts of paintView for the views which keep the painted score:
+    //! the score and the interaction on top of it
+    virtual void paintViewScore(draw::Painter* painter, const RectF& frameRect, bool isPrinting) = 0;
+    virtual void paintViewInteraction(draw::Painter* painter) = 0;
+
+    struct Damage {
+        uint64_t revision = 0;  // to pass on the next call
+        RectF rect;             // canvas area painted differently since the given revision
+        bool all = false;
+    };
+
+    virtual Damage damageSince(uint64_t revision) = 0;
+
+    //! NOTE For the changes of how the score is painted which are not a change of its layout,
+    //! like the selection: the given canvas area, or everything if it isn't valid, is painted from its elements again
+    virtual void invalidatePainted(const RectF& rect = RectF()) = 0;
+
     virtual void paintPdf(draw::Painter* painter, const Options& opt) = 0;
     virtual void paintPrint(draw::Painter* painter, const Options& opt) = 0;
     virtual void paintPng(draw::Painter* painter, const Options& opt) = 0;
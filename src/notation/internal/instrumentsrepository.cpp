@@ -30,42 +30,57 @@ using namespace mu::notation;
 
 void InstrumentsRepository::init()
 {
+    readPaths();
+
     configuration()->scoreOrderListPathsChanged().onNotify(this, [this]() {
+        //! NOTE Don't reload over the first load, it may be still running on a worker
+        ensureLoaded();
+        readPaths();
         load();
     });
+}
 
-    load();
+void InstrumentsRepository::readPaths()
+{
+    m_instrumentListPath = configuration()->instrumentListPath();
+    m_scoreOrderListPaths = configuration()->scoreOrderListPaths();
+}
+
+void InstrumentsRepository::ensureLoaded() const
+{
+    std::call_once(m_loadOnce, [this]() {
+        const_cast<InstrumentsRepository*>(this)->load();
+    });
 }
 
 const InstrumentTemplateList& InstrumentsRepository::instrumentTemplates() const
 {
+    ensureLoaded();
     return m_instrumentTemplates;
 }
 
 const InstrumentTemplate& InstrumentsRepository::instrumentTemplate(const std::string& instrumentId) const
 {
-    const InstrumentTemplateList& templates = m_instrumentTemplates;
-
-    auto it = std::find_if(templates.begin(), templates.end(), [instrumentId](const InstrumentTemplate* templ) {
-        return templ->id == instrumentId;
-    });
+    ensureLoaded();
 
-    if (it == m_instrumentTemplates.cend()) {
+    auto it = m_instrumentTemplatesById.find(instrumentId);
+    if (it == m_instrumentTemplatesById.cend()) {
         static InstrumentTemplate dummy;
         return dummy;
     }
 
-    const InstrumentTemplate* templ = *it;
-    return *templ;
+    return *it->second;
 }
 
 const ScoreOrderList& InstrumentsRepository::orders() const
 {
+    ensureLoaded();
     return mu::engraving::instrumentOrders;
 }
 
 const ScoreOrder& InstrumentsRepository::order(const std::string& orderId) const
 {
+    ensureLoaded();
     const ScoreOrderList& orders = mu::engraving::instrumentOrders;
 
     auto it = std::find_if(orders.begin(), orders.end(), [orderId](const ScoreOrder& order) {
@@ -82,11 +97,13 @@ const ScoreOrder& InstrumentsRepository::order(const std::string& orderId) const
 
 const InstrumentGenreList& InstrumentsRepository::genres() const
 {
+    ensureLoaded();
     return m_genres;
 }
 
 const InstrumentGroupList& InstrumentsRepository::groups() const
 {
+    ensureLoaded();
     return m_groups;
 }
 
@@ -95,16 +112,16 @@ void InstrumentsRepository::load()
     TRACEFUNC;
 
     m_instrumentTemplates.clear();
+    m_instrumentTemplatesById.clear();
     m_genres.clear();
     m_groups.clear();
     mu::engraving::clearInstrumentTemplates();
 
-    io::path_t instrumentsPath = configuration()->instrumentListPath();
-    if (!mu::engraving::loadInstrumentTemplates(instrumentsPath)) {
-        LOGE() << "Could not load instruments from " << instrumentsPath << "!";
+    if (!mu::engraving::loadInstrumentTemplates(m_instrumentListPath)) {
+        LOGE() << "Could not load instruments from " << m_instrumentListPath << "!";
     }
 
-    for (const io::path_t& ordersPath : configuration()->scoreOrderListPaths()) {
+    for (const io::path_t& ordersPath : m_scoreOrderListPaths) {
         if (!mu::engraving::loadInstrumentTemplates(ordersPath)) {
             LOGE() << "Could not load orders from " << ordersPath << "!";
         }
@@ -124,6 +141,7 @@ void InstrumentsRepository::load()
 
             templ->groupId = group->id;
             m_instrumentTemplates << templ;
+            m_instrumentTemplatesById.emplace(templ->id.toStdString(), templ);
         }
     }
 }
@@ -22,6 +22,9 @@
 #ifndef MU_NOTATION_INSTRUMENTSREPOSITORY_H
 #define MU_NOTATION_INSTRUMENTSREPOSITORY_H
 
+#include <mutex>
+#include <unordered_map>
+
 #include "modularity/ioc.h"
 
 #include "async/channel.h"
@@ -38,6 +41,12 @@ class InstrumentsRepository : public IInstrumentsRepository, public async::Async
 public:
     void init();
 
+    //! NOTE Parses the instruments and the score orders, called from the concurrent init.
+    //! The accessors wait for it, so the first of them does the load itself if it was not started yet.
+    //! The load only reads the paths resolved by init() on the main thread, and the engraving
+    //! globals it fills are published by the once flag and by the wait for the concurrent init
+    void ensureLoaded() const;
+
     const InstrumentTemplateList& instrumentTemplates() const override;
     const InstrumentTemplate& instrumentTemplate(const std::string& instrumentId) const override;
 
@@ -48,10 +57,17 @@ public:
     const InstrumentGroupList& groups() const override;
 
 private:
+    void readPaths();
     void load();
     void clear();
 
+    mutable std::once_flag m_loadOnce;
+
+    io::path_t m_instrumentListPath;
+    io::paths_t m_scoreOrderListPaths;
+
     InstrumentTemplateList m_instrumentTemplates;
+    std::unordered_map<std::string, const InstrumentTemplate*> m_instrumentTemplatesById;
     InstrumentGroupList m_groups;
     InstrumentGenreList m_genres;
 };
@@ -482,11 +482,20 @@ mu::ValNt<bool> MasterNotation::needSave() const
 
 void MasterNotation::initExcerpts(const ExcerptNotationList& excerpts)
 {
+    // the excerpts already inited are laid out again all together
+    std::vector<mu::engraving::Score*> initedScores;
     for (IExcerptNotationPtr excerptNotation : excerpts) {
-        ExcerptNotation* impl = get_impl(excerptNotation);
+        mu::engraving::Excerpt* excerpt = get_impl(excerptNotation)->excerpt();
+        if (excerpt->inited()) {
+            initedScores.push_back(excerpt->excerptScore());
+        } else {
+            masterScore()->initExcerpt(excerpt);
+        }
+    }
+    masterScore()->doLayoutScoresRange(initedScores, mu::engraving::Fraction(0, 1), mu::engraving::Fraction(-1, 1));
 
-        masterScore()->initExcerpt(impl->excerpt());
-        impl->init();
+    for (IExcerptNotationPtr excerptNotation : excerpts) {
+        get_impl(excerptNotation)->init();
     }
 }
 
@@ -57,7 +57,9 @@ void MidiInputOutputController::init()
         }
     });
 
-    midiInPort()->eventReceived().onReceive(this, [this](const midi::tick_t tick, const midi::Event& event) {
+    midiInPort()->eventReceived().onReceive(this, [this](const midi::tick_t tick, const midi::Event& event, const midi::timestamp_t receivedAt) {
+        UNUSED(receivedAt)
+
         if (!configuration()->isMidiInputEnabled()) {
             return;
         }
@@ -24,6 +24,7 @@
 #include <QGuiApplication>
 #include <QScreen>
 
+#include "async/async.h"
 #include "log.h"
 
 #include "libmscore/masterscore.h"
@@ -46,6 +47,8 @@
 
 using namespace mu::notation;
 
+static constexpr size_t LAYOUT_PAGES_PER_STEP = 4;
+
 Notation::Notation(mu::engraving::Score* score)
 {
     m_painting = std::make_shared<NotationPainting>(this);
@@ -56,7 +59,7 @@ Notation::Notation(mu::engraving::Score* score)
     m_accessibility = std::make_shared<NotationAccessibility>(this);
     m_parts = std::make_shared<NotationParts>(this, m_interaction, m_undoStack);
     m_style = std::make_shared<NotationStyle>(this, m_undoStack);
-    m_elements = std::make_shared<NotationElements>(this);
+    m_elements = std::make_shared<NotationElements>(this, m_notationChanged);
 
     m_interaction->noteInput()->noteAdded().onNotify(this, [this]() {
         notifyAboutNotationChanged();
@@ -104,6 +107,8 @@ Notation::Notation(mu::engraving::Score* score)
 
 Notation::~Notation()
 {
+    engraving::MemoryReport::removeSources(this);
+
     //! Note Dereference internal pointers before the deallocation of mu::engraving::Score* in order to prevent access to dereferenced object
     //! Makes sense to use std::shared_ptr<mu::engraving::Score*> ubiquitous instead of the raw pointers
     m_parts = nullptr;
@@ -136,6 +141,35 @@ void Notation::setScore(mu::engraving::Score* score)
 
     m_score = score;
     m_scoreInited.notify();
+
+    engraving::MemoryReport::removeSources(this);
+    if (m_score) {
+        engraving::MemoryReport::addSource(this, m_score, "renderCaches", [this]() {
+            return static_cast<const NotationPainting*>(m_painting.get())->memoryUsage();
+        });
+    }
+
+    if (m_score && !m_score->isLayoutComplete()) {
+        continueLayout();
+    }
+}
+
+void Notation::continueLayout()
+{
+    //! NOTE The score has been opened with only its first pages laid out,
+    //! lay out the rest step by step so the UI stays responsive in between
+    async::Async::call(this, [this]() {
+        if (!m_score || m_score->isLayoutComplete()) {
+            return;
+        }
+
+        m_score->continueLayout(LAYOUT_PAGES_PER_STEP);
+        notifyAboutNotationChanged();
+
+        if (!m_score->isLayoutComplete()) {
+            continueLayout();
+        }
+    });
 }
 
 mu::async::Notification Notation::scoreInited() const
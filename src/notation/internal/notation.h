@@ -90,6 +90,8 @@ private:
     friend class NotationInteraction;
     friend class NotationPainting;
 
+    void continueLayout();
+
     engraving::Score* m_score = nullptr;
     async::Notification m_scoreInited;
 
@@ -49,6 +49,7 @@ static const Settings::Key FOREGROUND_WALLPAPER_PATH(module_name, "ui/canvas/for
 static const Settings::Key FOREGROUND_USE_COLOR(module_name, "ui/canvas/foreground/useColor");
 
 static const Settings::Key SELECTION_PROXIMITY(module_name, "ui/canvas/misc/selectionProximity");
+static const Settings::Key LEVEL_OF_DETAIL_THRESHOLD(module_name, "ui/canvas/misc/levelOfDetailThreshold");
 
 static const Settings::Key DEFAULT_ZOOM_TYPE(module_name, "ui/canvas/zoomDefaultType");
 static const Settings::Key DEFAULT_ZOOM(module_name, "ui/canvas/zoomDefaultLevel");
@@ -71,6 +72,8 @@ static const Settings::Key IS_LIMIT_CANVAS_SCROLL_AREA_KEY(module_name, "ui/canv
 
 static const Settings::Key COLOR_NOTES_OUTSIDE_OF_USABLE_PITCH_RANGE(module_name, "score/note/warnPitchRange");
 static const Settings::Key REALTIME_DELAY(module_name, "io/midi/realtimeDelay");
+static const Settings::Key MIDI_CHORD_INPUT_WINDOW(module_name, "io/midi/chordInputWindow");
+static const Settings::Key DRAFT_LAYOUT_REFINE_DELAY(module_name, "score/noteInput/draftLayoutRefineDelay");
 static const Settings::Key NOTE_DEFAULT_PLAY_DURATION(module_name, "score/note/defaultPlayDuration");
 
 static const Settings::Key FIRST_SCORE_ORDER_LIST_KEY(module_name, "application/paths/scoreOrderList1");
@@ -154,6 +157,7 @@ void NotationConfiguration::init()
     fileSystem()->makePath(userStylesPath());
 
     settings()->setDefaultValue(SELECTION_PROXIMITY, Val(2));
+    settings()->setDefaultValue(LEVEL_OF_DETAIL_THRESHOLD, Val(2.5));
     settings()->setDefaultValue(IS_MIDI_INPUT_ENABLED, Val(true));
     settings()->setDefaultValue(IS_AUTOMATICALLY_PAN_ENABLED, Val(true));
     settings()->setDefaultValue(IS_PLAY_REPEATS_ENABLED, Val(true));
@@ -177,6 +181,8 @@ void NotationConfiguration::init()
 
     settings()->setDefaultValue(COLOR_NOTES_OUTSIDE_OF_USABLE_PITCH_RANGE, Val(true));
     settings()->setDefaultValue(REALTIME_DELAY, Val(750));
+    settings()->setDefaultValue(MIDI_CHORD_INPUT_WINDOW, Val(20));
+    settings()->setDefaultValue(DRAFT_LAYOUT_REFINE_DELAY, Val(400));
     settings()->setDefaultValue(NOTE_DEFAULT_PLAY_DURATION, Val(500));
 
     settings()->setDefaultValue(FIRST_SCORE_ORDER_LIST_KEY,
@@ -425,6 +431,16 @@ void NotationConfiguration::setSelectionProximity(int proximity)
     settings()->setSharedValue(SELECTION_PROXIMITY, Val(proximity));
 }
 
+double NotationConfiguration::levelOfDetailThreshold() const
+{
+    return settings()->value(LEVEL_OF_DETAIL_THRESHOLD).toDouble();
+}
+
+void NotationConfiguration::setLevelOfDetailThreshold(double pixelsPerSpatium)
+{
+    settings()->setSharedValue(LEVEL_OF_DETAIL_THRESHOLD, Val(pixelsPerSpatium));
+}
+
 ZoomType NotationConfiguration::defaultZoomType() const
 {
     return settings()->value(DEFAULT_ZOOM_TYPE).toEnum<ZoomType>();
@@ -653,6 +669,26 @@ void NotationConfiguration::setDelayBetweenNotesInRealTimeModeMilliseconds(int d
     settings()->setSharedValue(REALTIME_DELAY, Val(delayMs));
 }
 
+int NotationConfiguration::midiChordInputWindowMilliseconds() const
+{
+    return settings()->value(MIDI_CHORD_INPUT_WINDOW).toInt();
+}
+
+void NotationConfiguration::setMidiChordInputWindowMilliseconds(int windowMs)
+{
+    settings()->setSharedValue(MIDI_CHORD_INPUT_WINDOW, Val(windowMs));
+}
+
+int NotationConfiguration::draftLayoutRefineDelayMilliseconds() const
+{
+    return settings()->value(DRAFT_LAYOUT_REFINE_DELAY).toInt();
+}
+
+void NotationConfiguration::setDraftLayoutRefineDelayMilliseconds(int delayMs)
+{
+    settings()->setSharedValue(DRAFT_LAYOUT_REFINE_DELAY, Val(delayMs));
+}
+
 int NotationConfiguration::notePlayDurationMilliseconds() const
 {
     return settings()->value(NOTE_DEFAULT_PLAY_DURATION).toInt();
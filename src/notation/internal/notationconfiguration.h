@@ -89,6 +89,9 @@ public:
     int selectionProximity() const override;
     void setSelectionProximity(int proximity) override;
 
+    double levelOfDetailThreshold() const override;
+    void setLevelOfDetailThreshold(double pixelsPerSpatium) override;
+
     ZoomType defaultZoomType() const override;
     void setDefaultZoomType(ZoomType zoomType) override;
 
@@ -152,6 +155,12 @@ public:
     int delayBetweenNotesInRealTimeModeMilliseconds() const override;
     void setDelayBetweenNotesInRealTimeModeMilliseconds(int delayMs) override;
 
+    int midiChordInputWindowMilliseconds() const override;
+    void setMidiChordInputWindowMilliseconds(int windowMs) override;
+
+    int draftLayoutRefineDelayMilliseconds() const override;
+    void setDraftLayoutRefineDelayMilliseconds(int delayMs) override;
+
     int notePlayDurationMilliseconds() const override;
     void setNotePlayDurationMilliseconds(int durationMs) override;
 
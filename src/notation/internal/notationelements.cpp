@@ -32,9 +32,12 @@
 
 using namespace mu::notation;
 
-NotationElements::NotationElements(IGetScore* getScore)
+NotationElements::NotationElements(IGetScore* getScore, async::Notification notationChanged)
     : m_getScore(getScore)
 {
+    notationChanged.onNotify(this, [this]() {
+        m_searchIndex.valid = false;
+    });
 }
 
 mu::engraving::Score* NotationElements::msScore() const
@@ -95,11 +98,29 @@ std::vector<EngravingItem*> NotationElements::elements(const FilterElementsOptio
     return result;
 }
 
-mu::engraving::RehearsalMark* NotationElements::rehearsalMark(const std::string& name) const
+const NotationElements::SearchIndex& NotationElements::searchIndex() const
 {
-    QString qname = QString::fromStdString(name).toLower();
+    const mu::engraving::Score* currentScore = score();
+    if (m_searchIndex.valid && m_searchIndex.score == currentScore) {
+        return m_searchIndex;
+    }
 
-    for (mu::engraving::Segment* segment = score()->firstSegment(mu::engraving::SegmentType::ChordRest); segment;
+    TRACEFUNC;
+
+    m_searchIndex.measures.clear();
+    m_searchIndex.rehearsalMarks.clear();
+    m_searchIndex.score = currentScore;
+    m_searchIndex.valid = true;
+
+    if (!currentScore) {
+        return m_searchIndex;
+    }
+
+    for (Measure* measure = currentScore->firstMeasure(); measure; measure = measure->nextMeasure()) {
+        m_searchIndex.measures.push_back(measure);
+    }
+
+    for (mu::engraving::Segment* segment = currentScore->firstSegment(mu::engraving::SegmentType::ChordRest); segment;
          segment = segment->next1(mu::engraving::SegmentType::ChordRest)) {
         for (EngravingItem* element: segment->annotations()) {
             if (element->type() != ElementType::REHEARSAL_MARK) {
@@ -107,10 +128,20 @@ mu::engraving::RehearsalMark* NotationElements::rehearsalMark(const std::string&
             }
 
             mu::engraving::RehearsalMark* rehearsalMark = static_cast<mu::engraving::RehearsalMark*>(element);
-            QString rehearsalMarkName = rehearsalMark->plainText().toQString().toLower();
-            if (rehearsalMarkName.startsWith(qname)) {
-                return rehearsalMark;
-            }
+            m_searchIndex.rehearsalMarks.emplace_back(rehearsalMark->plainText().toQString().toLower(), rehearsalMark);
+        }
+    }
+
+    return m_searchIndex;
+}
+
+mu::engraving::RehearsalMark* NotationElements::rehearsalMark(const std::string& name) const
+{
+    QString qname = QString::fromStdString(name).toLower();
+
+    for (const auto& pair : searchIndex().rehearsalMarks) {
+        if (pair.first.startsWith(qname)) {
+            return pair.second;
         }
     }
 
@@ -119,7 +150,12 @@ mu::engraving::RehearsalMark* NotationElements::rehearsalMark(const std::string&
 
 mu::engraving::Measure* NotationElements::measure(const int measureIndex) const
 {
-    return score()->crMeasure(measureIndex);
+    const std::vector<Measure*>& measures = searchIndex().measures;
+    if (measureIndex < 0 || size_t(measureIndex) >= measures.size()) {
+        return nullptr;
+    }
+
+    return measures.at(measureIndex);
 }
 
 PageList NotationElements::pages() const
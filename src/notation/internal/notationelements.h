@@ -22,14 +22,19 @@
 #ifndef MU_NOTATION_NOTATIONELEMENTS_H
 #define MU_NOTATION_NOTATIONELEMENTS_H
 
+#include <QString>
+
+#include "async/asyncable.h"
+#include "async/notification.h"
+
 #include "inotationelements.h"
 #include "igetscore.h"
 
 namespace mu::notation {
-class NotationElements : public INotationElements
+class NotationElements : public INotationElements, public async::Asyncable
 {
 public:
-    NotationElements(IGetScore* getScore);
+    NotationElements(IGetScore* getScore, async::Notification notationChanged);
 
     mu::engraving::Score* msScore() const override;
 
@@ -54,7 +59,20 @@ private:
     ElementPattern* constructElementPattern(const FilterElementsOptions* elementsOptions) const;
     mu::engraving::NotePattern* constructNotePattern(const FilterNotesOptions* notesOptions) const;
 
+    //! NOTE Measures and rehearsal marks in score order, so that the search popup and
+    //! the "go to" commands don't walk the score on every key press.
+    //! Dropped on every notation change and rebuilt on the next lookup
+    struct SearchIndex {
+        bool valid = false;
+        const mu::engraving::Score* score = nullptr;
+        std::vector<Measure*> measures;
+        std::vector<std::pair<QString, mu::engraving::RehearsalMark*> > rehearsalMarks; // lower case text
+    };
+
+    const SearchIndex& searchIndex() const;
+
     IGetScore* m_getScore = nullptr;
+    mutable SearchIndex m_searchIndex;
 };
 }
 
@@ -146,6 +146,7 @@ NotationInteraction::NotationInteraction(Notation* notation, INotationUndoStackP
 {
     m_noteInput = std::make_shared<NotationNoteInput>(notation, this, m_undoStack);
     m_selection = std::make_shared<NotationSelection>(notation);
+    m_selectionChanged.setDebugName("notation.selectionChanged");
 
     m_noteInput->stateChanged().onNotify(this, [this]() {
         if (!m_noteInput->isNoteInputMode()) {
@@ -153,6 +154,10 @@ NotationInteraction::NotationInteraction(Notation* notation, INotationUndoStackP
         }
     });
 
+    m_noteInput->draftLayoutRefined().onNotify(this, [this]() {
+        notifyAboutNotationChanged();
+    });
+
     m_undoStack->undoNotification().onNotify(this, [this]() {
         endEditElement();
     });
@@ -496,6 +501,18 @@ void NotationInteraction::hideShadowNote()
     score()->shadowNote().setVisible(false);
 }
 
+RectF NotationInteraction::shadowNoteRect() const
+{
+    const mu::engraving::ShadowNote& shadowNote = score()->shadowNote();
+    if (!shadowNote.visible() || !shadowNote.isValid()) {
+        return RectF();
+    }
+
+    //! NOTE The accidental and the articulations are drawn out of the bounding box
+    double margin = 3 * shadowNote.spatium();
+    return shadowNote.bbox().translated(shadowNote.pagePos()).adjusted(-margin, -margin, margin, margin);
+}
+
 void NotationInteraction::toggleVisible()
 {
     startEdit();
@@ -571,6 +588,8 @@ std::vector<mu::engraving::EngravingItem*> NotationInteraction::hitElements(cons
 
     std::vector<mu::engraving::EngravingItem*> ll;
 
+    mu::engraving::EngravingItem::PagePosCacheScope pagePosCache;
+
     PointF p = p_in - page->pos();
 
     if (isTextEditingStarted()) {
@@ -962,8 +981,12 @@ bool NotationInteraction::isSelectionTypeFiltered(SelectionFilterType type) cons
 
 void NotationInteraction::setSelectionTypeFiltered(SelectionFilterType type, bool filtered)
 {
-    score()->selectionFilter().setFiltered(type, filtered);
-    if (selection()->isRange()) {
+    SelectionFilter& filter = score()->selectionFilter();
+    const int oldTypes = filter.filteredTypes();
+    filter.setFiltered(type, filtered);
+
+    //! NOTE Recollecting a big range is expensive, skip it if no type actually changed
+    if (filter.filteredTypes() != oldTypes && selection()->isRange()) {
         score()->selection().updateSelectedElements();
         notifyAboutSelectionChangedIfNeed();
     }
@@ -3626,10 +3649,11 @@ void NotationInteraction::swapSelection()
     mu::engraving::Selection& selection = score()->selection();
     QString mimeType = selection.mimeType();
 
+    // serialized once unless the selection gets extended below
+    QByteArray currentSelectionBackup = selection.mimeData().toQByteArray();
+
     if (mimeType == mu::engraving::mimeStaffListFormat) { // determine size of clipboard selection
-        const QMimeData* mimeData = this->selection()->mimeData();
-        QByteArray data = mimeData ? mimeData->data(mu::engraving::mimeStaffListFormat) : QByteArray();
-        mu::engraving::XmlReader reader(data);
+        mu::engraving::XmlReader reader(currentSelectionBackup);
         reader.readNextStartElement();
 
         Fraction tickLen = Fraction(0, 1);
@@ -3654,10 +3678,10 @@ void NotationInteraction::swapSelection()
             mu::engraving::Fraction endTick = startTick + tickLen;
             selection.extendRangeSelection(segment, segmentAfter, staffIndex, startTick, endTick);
             selection.update();
+            currentSelectionBackup = selection.mimeData().toQByteArray();
         }
     }
 
-    QByteArray currentSelectionBackup = selection.mimeData().toQByteArray();
     pasteSelection();
     QMimeData* mimeData = new QMimeData();
     mimeData->setData(mimeType, currentSelectionBackup);
@@ -64,6 +64,7 @@ public:
     // Shadow note
     void showShadowNote(const PointF& pos) override;
     void hideShadowNote() override;
+    RectF shadowNoteRect() const override;
 
     // Visibility
     void toggleVisible() override;
@@ -32,13 +32,10 @@
 
 #include "notationtypes.h"
 
-#include "defer.h"
 #include "log.h"
 
 using namespace mu::notation;
 
-static constexpr int PROCESS_INTERVAL = 20;
-
 NotationMidiInput::NotationMidiInput(IGetScore* getScore, INotationInteractionPtr notationInteraction, INotationUndoStackPtr undoStack)
     : m_getScore(getScore), m_notationInteraction(notationInteraction), m_undoStack(undoStack)
 {
@@ -64,10 +61,14 @@ void NotationMidiInput::onMidiEventReceived(const midi::Event& event)
     }
 
     if (event.opcode() == midi::Event::Opcode::NoteOn || event.opcode() == midi::Event::Opcode::NoteOff) {
+        //! NOTE Audition right away, without waiting for the batching and the score update
+        auditionNote(event);
+
         m_eventsQueue.push_back(event);
 
         if (!m_processTimer.isActive()) {
-            m_processTimer.start(PROCESS_INTERVAL);
+            //! NOTE The notes arriving within the window are entered as one chord, with a single undo step and layout
+            m_processTimer.start(configuration()->midiChordInputWindowMilliseconds());
         }
     }
 }
@@ -117,9 +118,14 @@ void NotationMidiInput::doProcessEvents()
 
     std::vector<const Note*> notes;
 
+    const bool noteInputMode = isNoteInputMode();
+    if (noteInputMode) {
+        m_undoStack->prepareChanges();
+    }
+
     for (size_t i = 0; i < m_eventsQueue.size(); ++i) {
         const midi::Event& event = m_eventsQueue.at(i);
-        Note* note = isNoteInputMode() ? addNoteToScore(event) : makeNote(event);
+        Note* note = noteInputMode ? addNoteToScore(event) : makeNote(event);
         if (note) {
             notes.push_back(note);
         }
@@ -133,13 +139,16 @@ void NotationMidiInput::doProcessEvents()
         }
     }
 
-    if (!notes.empty()) {
-        std::vector<const EngravingItem*> notesItems;
-        for (const Note* note : notes) {
-            notesItems.push_back(note);
+    if (noteInputMode) {
+        m_undoStack->commitChanges();
+
+        const mu::engraving::Score* sc = score();
+        if (sc && sc->inputState().cr()) {
+            m_notationInteraction->showItem(sc->inputState().cr());
         }
+    }
 
-        playbackController()->playElements(notesItems);
+    if (!notes.empty()) {
         m_notesReceivedChannel.send(notes);
     }
 
@@ -147,6 +156,21 @@ void NotationMidiInput::doProcessEvents()
     m_processTimer.stop();
 }
 
+void NotationMidiInput::auditionNote(const midi::Event& e)
+{
+    //! NOTE The note isn't added to the score, it only carries the pitch and the instrument of the input position
+    Note* note = makeNote(e);
+    if (!note) {
+        return;
+    }
+
+    playbackController()->playElements({ note });
+
+    Chord* chord = note->chord();
+    delete note;
+    delete chord;
+}
+
 Note* NotationMidiInput::addNoteToScore(const midi::Event& e)
 {
     mu::engraving::Score* sc = score();
@@ -167,12 +191,6 @@ Note* NotationMidiInput::addNoteToScore(const midi::Event& e)
         return nullptr;
     }
 
-    DEFER {
-        m_undoStack->commitChanges();
-    };
-
-    m_undoStack->prepareChanges();
-
     if (e.opcode() == midi::Event::Opcode::NoteOff) {
         if (isRealtime()) {
             const Chord* chord = is.cr()->isChord() ? engraving::toChord(is.cr()) : nullptr;
@@ -206,8 +224,6 @@ Note* NotationMidiInput::addNoteToScore(const midi::Event& e)
 
     sc->activeMidiPitches().push_back(inputEv);
 
-    m_notationInteraction->showItem(is.cr());
-
     return note;
 }
 
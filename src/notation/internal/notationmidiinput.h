@@ -57,6 +57,7 @@ private:
     mu::engraving::Score* score() const;
 
     void doProcessEvents();
+    void auditionNote(const midi::Event& e);
     Note* addNoteToScore(const midi::Event& e);
     Note* makeNote(const midi::Event& e);
 
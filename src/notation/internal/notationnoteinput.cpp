@@ -50,6 +50,9 @@ NotationNoteInput::NotationNoteInput(const IGetScore* getScore, INotationInterac
             updateInputState();
         }
     });
+
+    m_draftRefineTimer.setSingleShot(true);
+    QObject::connect(&m_draftRefineTimer, &QTimer::timeout, [this]() { refineDraftLayout(); });
 }
 
 NotationNoteInput::~NotationNoteInput()
@@ -308,6 +311,8 @@ void NotationNoteInput::endNoteInput()
         is.setSlur(0);
     }
 
+    refineDraftLayout();
+
     notifyAboutNoteInputEnded();
     updateInputState();
 }
@@ -618,13 +623,41 @@ void NotationNoteInput::startEdit()
 
 void NotationNoteInput::apply()
 {
+    //! NOTE While notes are entered one after another, the vertical justification
+    //! of the pages is left out of the layout until the input pauses
+    int refineDelay = configuration()->draftLayoutRefineDelayMilliseconds();
+    bool draft = refineDelay > 0 && isNoteInputMode();
+
+    score()->setDraftLayout(draft);
     m_undoStack->commitChanges();
+    score()->setDraftLayout(false);
+
+    if (draft && score()->hasDraftLayout()) {
+        m_draftRefineTimer.start(refineDelay);
+    }
 
     if (mu::engraving::ChordRest* chordRest = score()->inputState().cr()) {
         m_interaction->showItem(chordRest);
     }
 }
 
+void NotationNoteInput::refineDraftLayout()
+{
+    m_draftRefineTimer.stop();
+
+    if (!score() || !score()->hasDraftLayout()) {
+        return;
+    }
+
+    score()->refineDraftLayout();
+    m_draftLayoutRefined.notify();
+}
+
+Notification NotationNoteInput::draftLayoutRefined() const
+{
+    return m_draftLayoutRefined;
+}
+
 void NotationNoteInput::updateInputState()
 {
     TRACEFUNC;
@@ -22,6 +22,8 @@
 #ifndef MU_NOTATION_NOTATIONNOTEINPUT_H
 #define MU_NOTATION_NOTATIONNOTEINPUT_H
 
+#include <QTimer>
+
 #include "../inotationnoteinput.h"
 #include "modularity/ioc.h"
 #include "async/asyncable.h"
@@ -81,6 +83,7 @@ public:
 
     async::Notification noteAdded() const override;
     async::Notification stateChanged() const override;
+    async::Notification draftLayoutRefined() const override;
 
     void setGetViewRectFunc(const std::function<RectF()>& func);
 
@@ -91,6 +94,7 @@ private:
 
     void startEdit();
     void apply();
+    void refineDraftLayout();
 
     void updateInputState();
     void notifyAboutStateChanged();
@@ -108,6 +112,9 @@ private:
     async::Notification m_noteAdded;
     async::Notification m_noteInputStarted;
     async::Notification m_noteInputEnded;
+    async::Notification m_draftLayoutRefined;
+
+    QTimer m_draftRefineTimer;
 
     ScoreCallbacks* m_scoreCallbacks = nullptr;
     std::function<RectF()> m_getViewRectFunc;
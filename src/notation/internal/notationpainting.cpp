@@ -24,6 +24,8 @@
 #include <QScreen>
 
 #include "engraving/libmscore/score.h"
+#include "engraving/libmscore/page.h"
+#include "engraving/libmscore/system.h"
 #include "engraving/infrastructure/paint.h"
 #include "engraving/infrastructure/debugpaint.h"
 
@@ -37,11 +39,18 @@ using namespace mu::notation;
 using namespace mu::engraving;
 using namespace mu::draw;
 
+static constexpr size_t MAX_KEPT_DAMAGES = 64;
+
 NotationPainting::NotationPainting(Notation* notation)
     : m_notation(notation)
 {
 }
 
+mu::engraving::MemoryReport::Entry NotationPainting::memoryUsage() const
+{
+    return m_displayLists.memoryUsage();
+}
+
 mu::engraving::Score* NotationPainting::score() const
 {
     return m_notation->score();
@@ -113,13 +122,26 @@ bool NotationPainting::isPaintPageBorder() const
 }
 
 void NotationPainting::doPaint(draw::Painter* painter, const Options& opt)
+{
+    doPaintScore(painter, opt);
+
+    if (score() && !opt.isPrinting) {
+        paintViewInteraction(painter);
+    }
+}
+
+void NotationPainting::doPaintScore(draw::Painter* painter, const Options& opt)
 {
     TRACEFUNC;
     if (!score()) {
         return;
     }
 
+    //! NOTE The display lists of what the layout changed must be dropped before painting
+    takeScoreDamage();
+
     Options myopt = opt;
+    myopt.displayLists = &m_displayLists;
     bool printPageBackground = myopt.printPageBackground;
     myopt.onPaintPageSheet
         = [this, printPageBackground](draw::Painter* painter, const RectF& pageRect, const RectF& pageContentRect, bool isOdd) {
@@ -127,10 +149,6 @@ void NotationPainting::doPaint(draw::Painter* painter, const Options& opt)
     };
 
     engraving::Paint::paintScore(painter, score(), myopt);
-
-    if (!myopt.isPrinting) {
-        static_cast<NotationInteraction*>(m_notation->interaction().get())->paint(painter);
-    }
 }
 
 void NotationPainting::paintPageSheet(Painter* painter, const RectF& pageRect, const RectF& pageContentRect, bool isOdd,
@@ -180,7 +198,58 @@ void NotationPainting::paintPageSheet(Painter* painter, const RectF& pageRect, c
     }
 }
 
-void NotationPainting::paintView(Painter* painter, const RectF& frameRect, bool isPrinting)
+void NotationPainting::layoutVisiblePages(const RectF& frameRect)
+{
+    //! NOTE The rest of the score is laid out in the background after opening,
+    //! but pages the view is about to show are needed right away
+    bool vertical = MScore::verticalOrientation();
+    while (score() && !score()->isLayoutComplete() && !score()->pages().empty()) {
+        RectF lastPageRect = score()->pages().back()->canvasBoundingRect();
+        bool covered = vertical ? frameRect.bottom() <= lastPageRect.bottom() : frameRect.right() <= lastPageRect.right();
+        if (covered) {
+            break;
+        }
+
+        score()->continueLayout(1);
+    }
+}
+
+void NotationPainting::layoutVisibleMeasures(const RectF& frameRect)
+{
+    //! NOTE In continuous view only the measures around the visible range are laid out,
+    //! the others keep their previous layout until they are scrolled in
+    if (!score() || !score()->layoutOptions().isLinearMode() || score()->systems().empty()) {
+        return;
+    }
+
+    const double margin = frameRect.width();
+    const double left = frameRect.left() - margin;
+    const double right = frameRect.right() + margin;
+
+    Fraction stick(-1, 1);
+    Fraction etick(-1, 1);
+    for (const MeasureBase* mb : score()->systems().front()->measures()) {
+        RectF rect = mb->canvasBoundingRect();
+        if (rect.right() < left) {
+            continue;
+        }
+        if (rect.left() > right) {
+            break;
+        }
+        if (stick.negative()) {
+            stick = mb->tick();
+        }
+        etick = mb->tick();
+    }
+
+    if (stick.negative()) {
+        return;
+    }
+
+    score()->setLinearLayoutWindow(stick, etick);
+}
+
+INotationPainting::Options NotationPainting::viewOptions(const RectF& frameRect, bool isPrinting) const
 {
     Options opt;
     opt.isSetViewport = false;
@@ -188,7 +257,94 @@ void NotationPainting::paintView(Painter* painter, const RectF& frameRect, bool
     opt.frameRect = frameRect;
     opt.deviceDpi = uiConfiguration()->logicalDpi();
     opt.isPrinting = isPrinting;
-    doPaint(painter, opt);
+    opt.simplifyBelowPixelsPerSpatium = configuration()->levelOfDetailThreshold();
+    return opt;
+}
+
+void NotationPainting::paintView(Painter* painter, const RectF& frameRect, bool isPrinting)
+{
+    doPaint(painter, viewOptions(frameRect, isPrinting));
+}
+
+void NotationPainting::prepareView(const RectF& frameRect, bool isPrinting)
+{
+    layoutVisiblePages(frameRect);
+    layoutVisibleMeasures(frameRect);
+
+    //! NOTE Printing and export need the whole score
+    if (isPrinting && score()) {
+        score()->continueLayout(0);
+        score()->setLinearLayoutWindow(Fraction(-1, 1), Fraction(-1, 1));
+    }
+}
+
+void NotationPainting::paintViewScore(Painter* painter, const RectF& frameRect, bool isPrinting)
+{
+    doPaintScore(painter, viewOptions(frameRect, isPrinting));
+}
+
+void NotationPainting::paintViewInteraction(Painter* painter)
+{
+    static_cast<NotationInteraction*>(m_notation->interaction().get())->paint(painter);
+}
+
+void NotationPainting::takeScoreDamage()
+{
+    if (!score() || score()->paintDamage().isEmpty()) {
+        return;
+    }
+
+    const engraving::PaintDamage& scoreDamage = score()->paintDamage();
+
+    Damage damage;
+    damage.revision = ++m_revision;
+    damage.rect = scoreDamage.rect;
+    damage.all = scoreDamage.all;
+    score()->resetPaintDamage();
+
+    invalidatePainted(damage.all ? RectF() : damage.rect);
+
+    m_damages.push_back(damage);
+    if (m_damages.size() > MAX_KEPT_DAMAGES) {
+        m_damages.pop_front();
+    }
+}
+
+INotationPainting::Damage NotationPainting::damageSince(uint64_t revision)
+{
+    takeScoreDamage();
+
+    Damage result;
+    result.revision = m_revision;
+    if (revision == m_revision) {
+        return result;
+    }
+
+    //! NOTE The damages between the given revision and the kept ones are not known anymore
+    if (m_damages.empty() || revision + 1 < m_damages.front().revision) {
+        result.all = true;
+        return result;
+    }
+
+    for (const Damage& damage : m_damages) {
+        if (damage.revision <= revision) {
+            continue;
+        }
+
+        result.rect.unite(damage.rect);
+        result.all = result.all || damage.all;
+    }
+
+    return result;
+}
+
+void NotationPainting::invalidatePainted(const RectF& rect)
+{
+    if (rect.isValid()) {
+        m_displayLists.invalidate(rect);
+    } else {
+        m_displayLists.clear();
+    }
 }
 
 void NotationPainting::paintPdf(draw::Painter* painter, const Options& opt)
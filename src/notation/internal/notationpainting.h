@@ -22,9 +22,13 @@
 #ifndef MU_NOTATION_NOTATIONPAINTING_H
 #define MU_NOTATION_NOTATIONPAINTING_H
 
+#include <deque>
+
 #include "../inotationpainting.h"
 #include "igetscore.h"
 
+#include "engraving/infrastructure/pagedisplaylists.h"
+
 #include "modularity/ioc.h"
 #include "../inotationconfiguration.h"
 #include "engraving/iengravingconfiguration.h"
@@ -53,20 +57,39 @@ public:
     SizeF pageSizeInch() const override;
 
     void paintView(draw::Painter* painter, const RectF& frameRect, bool isPrinting) override;
+    void prepareView(const RectF& frameRect, bool isPrinting) override;
+    void paintViewScore(draw::Painter* painter, const RectF& frameRect, bool isPrinting) override;
+    void paintViewInteraction(draw::Painter* painter) override;
+
+    Damage damageSince(uint64_t revision) override;
+    void invalidatePainted(const RectF& rect = RectF()) override;
     void paintPdf(draw::Painter* painter, const Options& opt) override;
     void paintPrint(draw::Painter* painter, const Options& opt) override;
     void paintPng(draw::Painter* painter, const Options& opt) override;
 
+    engraving::MemoryReport::Entry memoryUsage() const;
+
 private:
     mu::engraving::Score* score() const;
 
     bool isPaintPageBorder() const;
     void doPaint(draw::Painter* painter, const Options& opt);
+    void doPaintScore(draw::Painter* painter, const Options& opt);
+    Options viewOptions(const RectF& frameRect, bool isPrinting) const;
+    void takeScoreDamage();
+    void layoutVisiblePages(const RectF& frameRect);
+    void layoutVisibleMeasures(const RectF& frameRect);
     void paintPageBorder(draw::Painter* painter, const mu::engraving::Page* page) const;
     void paintPageSheet(mu::draw::Painter* painter, const RectF& pageRect, const RectF& pageContentRect, bool isOdd,
                         bool printPageBackground) const;
 
     Notation* m_notation = nullptr;
+
+    // the damages of the last revisions, the older ones are taken as damage of everything
+    std::deque<Damage> m_damages;
+    uint64_t m_revision = 0;
+
+    engraving::PageDisplayLists m_displayLists;
 };
 }
 
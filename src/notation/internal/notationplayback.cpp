@@ -74,6 +74,7 @@ void NotationPlayback::init(INotationUndoStackPtr undoStack)
 
     m_playbackModel.setPlayRepeats(configuration()->isPlayRepeatsEnabled());
     m_playbackModel.setPlayChordSymbols(configuration()->isPlayChordSymbolsEnabled());
+    m_playbackModel.setStreamingEnabled(true);
 
     m_playbackModel.load(score());
 
@@ -142,10 +142,10 @@ mu::engraving::Score* NotationSelection::score() const
 
 void NotationSelection::onElementHit(EngravingItem* el)
 {
-    m_lastElementHit = el;
+    m_lastElementHitEid = el ? el->eid() : 0;
 }
 
 EngravingItem* NotationSelection::lastElementHit() const
 {
-    return m_lastElementHit;
+    return score()->itemByEid(m_lastElementHitEid);
 }
@@ -58,7 +58,9 @@ public:
 
 private:
     mu::engraving::Score* score() const;
-    EngravingItem* m_lastElementHit;
+
+    //! NOTE Kept by id, the item may be deleted by the next edit
+    mu::engraving::eid_t m_lastElementHitEid = 0;
 
     IGetScore* m_getScore = nullptr;
     INotationSelectionRangePtr m_range;
@@ -34,6 +34,7 @@ using namespace mu::notation;
 
 static constexpr qreal SCROLL_LIMIT_OFF_OFFSET = 0.75;
 static constexpr qreal SCROLL_LIMIT_ON_OFFSET = 0.02;
+static constexpr int PENDING_TILES_INTERVAL = 8; // ms
 
 AbstractNotationPaintView::AbstractNotationPaintView(QQuickItem* parent)
     : uicomponents::QuickPaintedView(parent)
@@ -63,9 +64,17 @@ AbstractNotationPaintView::AbstractNotationPaintView(QQuickItem* parent)
     m_loopOutMarker = std::make_unique<LoopMarker>(LoopBoundaryType::LoopOut);
 
     m_continuousPanel = std::make_unique<ContinuousPanel>();
+    m_tileCache = std::make_unique<NotationTileCache>();
 
     //! NOTE For diagnostic tools
     dispatcher()->reg(this, "diagnostic-notationview-redraw", [this]() {
+        invalidateTiles();
+        update();
+    });
+
+    //! NOTE The tiles rasterized in the background are drawn once they are ready
+    m_pendingTilesTimer.setSingleShot(true);
+    connect(&m_pendingTilesTimer, &QTimer::timeout, this, [this]() {
         update();
     });
 
@@ -77,6 +86,8 @@ AbstractNotationPaintView::AbstractNotationPaintView(QQuickItem* parent)
 
 AbstractNotationPaintView::~AbstractNotationPaintView()
 {
+    engraving::MemoryReport::removeSources(this);
+
     if (m_notation && isMainView()) {
         m_notation->accessibility()->setMapToScreenFunc(nullptr);
         m_notation->interaction()->setGetViewRectFunc(nullptr);
@@ -208,6 +219,8 @@ void AbstractNotationPaintView::onCurrentNotationChanged()
     m_playbackCursor->setNotation(m_notation);
     m_loopInMarker->setNotation(m_notation);
     m_loopOutMarker->setNotation(m_notation);
+    invalidateTiles();
+    registerMemoryUsage();
 
     if (!m_notation) {
         return;
@@ -228,11 +241,15 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
         m_notation->painting()->setViewMode(m_notation->viewState()->viewMode());
     }
 
+    layoutViewport();
+
     INotationInteractionPtr interaction = notationInteraction();
 
     m_notation->notationChanged().onNotify(this, [this, interaction]() {
         interaction->hideShadowNote();
-        update();
+        m_playbackCursor->invalidate();
+        layoutViewport();
+        redrawChangedArea();
     });
 
     onNoteInputStateChanged();
@@ -240,8 +257,9 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
         onNoteInputStateChanged();
     });
 
+    m_selectionRect = selectionRect();
     interaction->selectionChanged().onNotify(this, [this]() {
-        update();
+        onSelectionChanged();
     });
 
     interaction->showItemRequested().onReceive(this, [this](const INotationInteraction::ShowItemRequest& request) {
@@ -255,6 +273,8 @@ void AbstractNotationPaintView::onLoadNotation(INotationPtr)
     });
 
     interaction->dropChanged().onNotify(this, [this]() {
+        invalidateTiles();
+
         if (!hasActiveFocus()) {
             forceFocusIn(); // grab keyboard focus after element added from palette
         }
@@ -330,6 +350,7 @@ void AbstractNotationPaintView::onMatrixChanged(const Transform&, bool overrideZ
 {
     UNUSED(overrideZoomType);
 
+    layoutViewport();
     update();
 
     emit horizontalScrollChanged();
@@ -354,12 +375,25 @@ void AbstractNotationPaintView::onViewSizeChanged()
     }
 
     ensureViewportInsideScrollableArea();
+    layoutViewport();
 
     emit horizontalScrollChanged();
     emit verticalScrollChanged();
     emit viewportChanged();
 }
 
+void AbstractNotationPaintView::layoutViewport()
+{
+    //! NOTE The pages and the measures about to be shown are laid out
+    //! when the view moves or the score changes, not while it is painted
+    if (!isInited()) {
+        return;
+    }
+
+    bool isPrinting = publishMode() || m_inputController->readonly();
+    notation()->painting()->prepareView(viewport(), isPrinting);
+}
+
 void AbstractNotationPaintView::updateLoopMarkers()
 {
     TRACEFUNC;
@@ -428,8 +462,122 @@ void AbstractNotationPaintView::onNoteInputStateChanged()
 
     if (INotationInteractionPtr interaction = notationInteraction()) {
         interaction->hideShadowNote();
+        redrawChangedArea();
+    }
+}
+
+void AbstractNotationPaintView::onSelectionChanged()
+{
+    //! NOTE The selected elements are marked without the repainted area,
+    //! the area is taken from the elements of the previous and of the new selection
+    RectF oldSelectionRect = m_selectionRect;
+    m_selectionRect = selectionRect();
+
+    if (oldSelectionRect.isNull() || m_selectionRect.isNull() || !canRedrawChangedAreaOnly()) {
+        invalidateTiles();
         update();
+        return;
     }
+
+    RectF rect = oldSelectionRect.united(m_selectionRect);
+    m_tileCache->invalidate(rect);
+    notation()->painting()->invalidatePainted(rect);
+    redrawChangedArea(rect);
+}
+
+RectF AbstractNotationPaintView::selectionRect() const
+{
+    //! NOTE The range selection is drawn around its elements
+    INotationSelectionPtr selection = notationSelection();
+    if (!selection || selection->isRange()) {
+        return RectF();
+    }
+
+    static constexpr size_t MAX_TRACKED_ELEMENTS = 256;
+    std::vector<EngravingItem*> elements = selection->elements();
+    if (elements.empty() || elements.size() > MAX_TRACKED_ELEMENTS) {
+        return RectF();
+    }
+
+    RectF rect;
+    for (const EngravingItem* element : elements) {
+        if (element->isSpanner()) {
+            for (const engraving::SpannerSegment* segment : toSpanner(element)->spannerSegments()) {
+                rect.unite(segment->canvasBoundingRect());
+            }
+        } else {
+            rect.unite(element->canvasBoundingRect());
+        }
+    }
+
+    return rect;
+}
+
+RectF AbstractNotationPaintView::overlaysRect() const
+{
+    RectF rect;
+
+    if (INotationInteractionPtr interaction = notationInteraction()) {
+        rect.unite(interaction->shadowNoteRect());
+    }
+
+    if (isNoteEnterMode()) {
+        //! NOTE The marks of the strings are drawn out of the cursor
+        RectF cursorRect = notationNoteInput()->cursorRect();
+        rect.unite(cursorRect.adjusted(-cursorRect.width(), 0, cursorRect.width(), 0));
+    }
+
+    return rect;
+}
+
+bool AbstractNotationPaintView::canRedrawChangedAreaOnly() const
+{
+    INotationInteractionPtr interaction = notationInteraction();
+    if (!interaction || notation()->viewMode() == engraving::LayoutMode::LINE) {
+        return false;
+    }
+
+    //! NOTE The other overlays of the interaction are not tracked
+    return !interaction->isDragStarted()
+           && !interaction->isGripEditStarted()
+           && !interaction->isElementEditStarted()
+           && !interaction->isTextEditingStarted()
+           && !interaction->selection()->isRange();
+}
+
+void AbstractNotationPaintView::redrawChangedArea(const RectF& changedRect)
+{
+    TRACEFUNC;
+
+    if (!isInited() || !canRedrawChangedAreaOnly()) {
+        update();
+        return;
+    }
+
+    INotationPainting::Damage damage = notation()->painting()->damageSince(m_paintRevision);
+
+    RectF rect = changedRect.united(damage.rect);
+    //! NOTE The changes which don't report their area are repainted everywhere
+    if (damage.all || rect.isNull()) {
+        update();
+        return;
+    }
+
+    rect.unite(m_paintedOverlaysRect);
+    rect.unite(overlaysRect());
+
+    redrawLogicalRect(rect);
+}
+
+void AbstractNotationPaintView::redrawLogicalRect(const RectF& rect)
+{
+    qreal guiScaling = configuration()->guiScaling();
+    Transform guiScalingCompensation;
+    guiScalingCompensation.scale(guiScaling, guiScaling);
+
+    // the antialiased edges are out of the area
+    QRect viewRect = (m_matrix * guiScalingCompensation).map(rect).toQRectF().toAlignedRect().adjusted(-2, -2, 2, 2);
+    update(viewRect);
 }
 
 void AbstractNotationPaintView::onShowItemRequested(const INotationInteraction::ShowItemRequest& request)
@@ -464,8 +612,9 @@ bool AbstractNotationPaintView::isNoteEnterMode() const
 void AbstractNotationPaintView::showShadowNote(const PointF& pos)
 {
     TRACEFUNC;
+    RectF oldShadowNoteRect = notationInteraction()->shadowNoteRect();
     notationInteraction()->showShadowNote(pos);
-    update();
+    redrawChangedArea(oldShadowNoteRect.united(notationInteraction()->shadowNoteRect()));
 }
 
 void AbstractNotationPaintView::showContextMenu(const ElementType& elementType, const QPointF& pos, bool activateFocus)
@@ -494,11 +643,15 @@ void AbstractNotationPaintView::paint(QPainter* qp)
 {
     TRACEFUNC;
 
-    mu::draw::Painter mup(qp, objectName().toStdString());
-    mu::draw::Painter* painter = &mup;
-
     RectF rect(0.0, 0.0, width(), height());
-    paintBackground(rect, painter);
+
+    //! NOTE Only the area of update(rect) is painted again, see redrawChangedArea
+    RectF dirtyRect = qp->hasClipping() ? RectF::fromQRectF(qp->clipBoundingRect()).intersected(rect) : rect;
+
+    {
+        mu::draw::Painter backgroundPainter(qp, objectName().toStdString());
+        paintBackground(rect, &backgroundPainter);
+    }
 
     if (!isInited()) {
         return;
@@ -508,10 +661,28 @@ void AbstractNotationPaintView::paint(QPainter* qp)
     Transform guiScalingCompensation;
     guiScalingCompensation.scale(guiScaling, guiScaling);
 
-    painter->setWorldTransform(m_matrix * guiScalingCompensation);
-
+    const Transform matrix = m_matrix * guiScalingCompensation;
     bool isPrinting = publishMode() || m_inputController->readonly();
-    notation()->painting()->paintView(painter, toLogical(rect), isPrinting);
+
+    INotationPaintingPtr painting = notation()->painting();
+
+    bool isPaintedFromTiles = paintCachedScore(qp, matrix, dirtyRect, isPrinting);
+
+    //! NOTE After the tiles, the batched painter must be the only one using qp
+    mu::draw::Painter mup(qp, objectName().toStdString(), mu::draw::Painter::Mode::Batched);
+    mu::draw::Painter* painter = &mup;
+
+    painter->setWorldTransform(matrix);
+
+    if (!isPaintedFromTiles) {
+        painting->paintViewScore(painter, toLogical(dirtyRect), isPrinting);
+    }
+
+    if (!isPrinting) {
+        painting->paintViewInteraction(painter);
+    }
+
+    m_paintedOverlaysRect = overlaysRect();
 
     m_playbackCursor->paint(painter);
     m_noteInputCursor->paint(painter);
@@ -547,14 +718,17 @@ void AbstractNotationPaintView::onNotationSetup()
     });
 
     configuration()->foregroundChanged().onNotify(this, [this]() {
+        invalidateTiles();
         update();
     });
 
     uiConfiguration()->currentThemeChanged().onNotify(this, [this]() {
+        invalidateTiles();
         update();
     });
 
     engravingConfiguration()->debuggingOptionsChanged().onNotify(this, [this]() {
+        invalidateTiles();
         update();
     });
 }
@@ -572,6 +746,46 @@ void AbstractNotationPaintView::paintBackground(const RectF& rect, draw::Painter
     }
 }
 
+bool AbstractNotationPaintView::paintCachedScore(QPainter* qp, const Transform& matrix, const RectF& dirtyRect, bool isPrinting)
+{
+    updateTileCache(isPrinting);
+
+    INotationPaintingPtr painting = notation()->painting();
+    bool isPainted = m_tileCache->paint(qp, matrix, dirtyRect, [painting, isPrinting](draw::Painter* tilePainter, const RectF& tileRect) {
+        painting->paintViewScore(tilePainter, tileRect, isPrinting);
+    });
+
+    if (m_tileCache->hasPendingTiles() && !m_pendingTilesTimer.isActive()) {
+        m_pendingTilesTimer.start(PENDING_TILES_INTERVAL);
+    }
+
+    return isPainted;
+}
+
+void AbstractNotationPaintView::updateTileCache(bool isPrinting)
+{
+    INotationPainting::Damage damage = notation()->painting()->damageSince(m_paintRevision);
+    m_paintRevision = damage.revision;
+
+    if (damage.all || isPrinting != m_tilesPrinting) {
+        m_tileCache->clear();
+    } else if (!damage.rect.isNull()) {
+        m_tileCache->invalidate(damage.rect);
+    }
+
+    m_tilesPrinting = isPrinting;
+}
+
+void AbstractNotationPaintView::invalidateTiles()
+{
+    m_tileCache->clear();
+    m_paintRevision = 0;
+
+    if (notation()) {
+        notation()->painting()->invalidatePainted();
+    }
+}
+
 PointF AbstractNotationPaintView::canvasCenter() const
 {
     TRACEFUNC;
@@ -1113,9 +1327,23 @@ void AbstractNotationPaintView::setNotation(INotationPtr notation)
 {
     clear();
     m_notation = notation;
+    registerMemoryUsage();
     update();
 }
 
+void AbstractNotationPaintView::registerMemoryUsage()
+{
+    engraving::MemoryReport::removeSources(this);
+
+    if (!m_notation || !m_notation->elements()->msScore()) {
+        return;
+    }
+
+    engraving::MemoryReport::addSource(this, m_notation->elements()->msScore(), "renderCaches", [this]() {
+        return m_tileCache->memoryUsage();
+    });
+}
+
 void AbstractNotationPaintView::setReadonly(bool readonly)
 {
     m_inputController->setReadonly(readonly);
@@ -1204,6 +1432,8 @@ void AbstractNotationPaintView::movePlaybackCursor(midi::tick_t tick)
         return;
     }
 
+    const RectF oldCursorRect = m_playbackCursor->rect();
+
     m_playbackCursor->move(tick);
     const RectF& cursorRect = m_playbackCursor->rect();
 
@@ -1219,7 +1449,13 @@ void AbstractNotationPaintView::movePlaybackCursor(midi::tick_t tick)
         }
     }
 
-    update(); //! TODO set rect to optimization
+    //! NOTE Only the old and the new cursor places need to be repainted
+    if (!isInited() || oldCursorRect.isNull()) {
+        update();
+        return;
+    }
+
+    redrawLogicalRect(oldCursorRect.united(cursorRect));
 }
 
 bool AbstractNotationPaintView::needAdjustCanvasVerticallyWhilePlayback(const RectF& cursorRect)
@@ -45,6 +45,7 @@
 #include "playbackcursor.h"
 #include "loopmarker.h"
 #include "continuouspanel.h"
+#include "notationtilecache.h"
 
 namespace mu::notation {
 class AbstractNotationPaintView : public uicomponents::QuickPaintedView, public IControlledView, public async::Asyncable,
@@ -171,6 +172,10 @@ protected:
 
     virtual void onMatrixChanged(const draw::Transform& matrix, bool overrideZoomType);
 
+    //! NOTE Paints the score from the cached images if it can, returns false otherwise
+    virtual bool paintCachedScore(QPainter* qp, const draw::Transform& matrix, const RectF& dirtyRect, bool isPrinting);
+    virtual void invalidateTiles();
+
 protected slots:
     virtual void onViewSizeChanged();
 
@@ -186,9 +191,11 @@ private:
 
     bool canReceiveAction(const actions::ActionCode& actionCode) const override;
     void onCurrentNotationChanged();
+    void registerMemoryUsage();
     bool isInited() const;
 
     bool doMoveCanvas(qreal dx, qreal dy);
+    void layoutViewport();
 
     // Input
     void wheelEvent(QWheelEvent* event) override;
@@ -217,11 +224,18 @@ private:
     bool adjustCanvasPosition(const RectF& logicRect, bool adjustVertically = true);
 
     void onNoteInputStateChanged();
+    void onSelectionChanged();
+
+    RectF selectionRect() const;
+    RectF overlaysRect() const;
+    bool canRedrawChangedAreaOnly() const;
+    void redrawChangedArea(const RectF& changedRect = RectF());
 
     void onShowItemRequested(const INotationInteraction::ShowItemRequest& request);
 
     void onPlayingChanged();
     void movePlaybackCursor(midi::tick_t tick);
+    void redrawLogicalRect(const RectF& rect);
     bool needAdjustCanvasVerticallyWhilePlayback(const RectF& cursorRect);
 
     void updateLoopMarkers();
@@ -230,6 +244,7 @@ private:
     PointF alignToCurrentPageBorder(const RectF& showRect, const PointF& pos) const;
 
     void paintBackground(const RectF& rect, draw::Painter* painter);
+    void updateTileCache(bool isPrinting);
 
     PointF canvasCenter() const;
     std::pair<qreal, qreal> constraintCanvas(qreal dx, qreal dy) const;
@@ -243,6 +258,12 @@ private:
     std::unique_ptr<LoopMarker> m_loopInMarker;
     std::unique_ptr<LoopMarker> m_loopOutMarker;
     std::unique_ptr<ContinuousPanel> m_continuousPanel;
+    std::unique_ptr<NotationTileCache> m_tileCache;
+    QTimer m_pendingTilesTimer;
+    uint64_t m_paintRevision = 0;
+    bool m_tilesPrinting = false;
+    RectF m_paintedOverlaysRect; // the shadow note and the note input cursor of the last paint
+    RectF m_selectionRect;   // null if not known
 
     qreal m_previousVerticalScrollPosition = 0;
     qreal m_previousHorizontalScrollPosition = 0;
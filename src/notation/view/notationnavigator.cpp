@@ -21,16 +21,26 @@
  */
 #include "notationnavigator.h"
 
+#include <cmath>
+
 #include "libmscore/system.h"
 
 #include "log.h"
 
 using namespace mu::notation;
 
+static constexpr int THUMBNAILS_DELAY = 300; // ms, the pages are painted again once the editing pauses
+static constexpr double MAX_THUMBNAIL_SIZE = 4096; // pixels
+
 NotationNavigator::NotationNavigator(QQuickItem* parent)
     : AbstractNotationPaintView(parent)
 {
     setReadonly(true);
+
+    m_thumbnailsTimer.setSingleShot(true);
+    connect(&m_thumbnailsTimer, &QTimer::timeout, this, [this]() {
+        paintNextOutdatedThumbnail();
+    });
 }
 
 void NotationNavigator::load()
@@ -245,6 +255,172 @@ void NotationNavigator::onViewSizeChanged()
 {
 }
 
+bool NotationNavigator::paintCachedScore(QPainter* qp, const draw::Transform& matrix, const RectF& dirtyRect, bool isPrinting)
+{
+    const double scaling = matrix.m11();
+    if (!canUseThumbnails(scaling)) {
+        return AbstractNotationPaintView::paintCachedScore(qp, matrix, dirtyRect, isPrinting);
+    }
+
+    TRACEFUNC;
+
+    updateThumbnails(isPrinting);
+
+    m_thumbnailsScaling = scaling;
+    m_thumbnailsFrameRect = matrix.inverted().map(RectF(0.0, 0.0, width(), height()));
+
+    bool hasOutdated = false;
+
+    for (PageThumbnail& thumbnail : m_thumbnails) {
+        RectF targetRect = matrix.map(thumbnail.canvasRect);
+        if (!targetRect.intersects(dirtyRect)) {
+            continue;
+        }
+
+        //! NOTE Only the pages never painted are painted right away,
+        //! the others are shown as they were until they are painted again in the background
+        if (thumbnail.image.isNull()) {
+            thumbnail.image = paintThumbnail(thumbnail.canvasRect, scaling, isPrinting);
+            thumbnail.scaling = scaling;
+            thumbnail.isOutdated = false;
+        } else if (thumbnail.isOutdated || !qFuzzyCompare(thumbnail.scaling, scaling)) {
+            hasOutdated = true;
+        }
+
+        qp->drawImage(targetRect.toQRectF(), thumbnail.image);
+    }
+
+    if (hasOutdated && !m_thumbnailsTimer.isActive()) {
+        m_thumbnailsTimer.start(THUMBNAILS_DELAY);
+    }
+
+    return true;
+}
+
+void NotationNavigator::invalidateTiles()
+{
+    AbstractNotationPaintView::invalidateTiles();
+
+    m_thumbnails.clear();
+    m_thumbnailsRevision = 0;
+    m_thumbnailsTimer.stop();
+}
+
+bool NotationNavigator::canUseThumbnails(double scaling) const
+{
+    if (notationViewMode() != ViewMode::PAGE) {
+        return false;
+    }
+
+    //! NOTE Very big thumbnails would cost more memory than the tiles
+    for (const Page* page : pages()) {
+        if (page->width() * scaling > MAX_THUMBNAIL_SIZE || page->height() * scaling > MAX_THUMBNAIL_SIZE) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void NotationNavigator::updateThumbnails(bool isPrinting)
+{
+    INotationPainting::Damage damage = notation()->painting()->damageSince(m_thumbnailsRevision);
+    m_thumbnailsRevision = damage.revision;
+
+    const bool isAllDamaged = damage.all || isPrinting != m_thumbnailsPrinting;
+    m_thumbnailsPrinting = isPrinting;
+
+    PageList pages = this->pages();
+
+    std::vector<PageThumbnail> thumbnails;
+    thumbnails.reserve(pages.size());
+
+    for (const Page* page : pages) {
+        PageThumbnail thumbnail;
+        for (PageThumbnail& oldThumbnail : m_thumbnails) {
+            if (oldThumbnail.page == page) {
+                thumbnail = std::move(oldThumbnail);
+                break;
+            }
+        }
+
+        RectF canvasRect = page->canvasBoundingRect();
+        if (thumbnail.canvasRect != canvasRect) {
+            thumbnail.canvasRect = canvasRect;
+            thumbnail.isOutdated = true;
+        }
+
+        if (isAllDamaged || canvasRect.intersects(damage.rect)) {
+            thumbnail.isOutdated = true;
+        }
+
+        thumbnail.page = page;
+        thumbnails.push_back(std::move(thumbnail));
+    }
+
+    m_thumbnails = std::move(thumbnails);
+}
+
+void NotationNavigator::paintNextOutdatedThumbnail()
+{
+    if (!notation() || !isVisible()) {
+        return;
+    }
+
+    TRACEFUNC;
+
+    updateThumbnails(m_thumbnailsPrinting);
+
+    //! NOTE One page at a time, so that the editing is not held up; the hidden pages are painted once they are shown
+    PageThumbnail* next = nullptr;
+    bool hasMore = false;
+
+    for (PageThumbnail& thumbnail : m_thumbnails) {
+        bool isOutdated = thumbnail.isOutdated || !qFuzzyCompare(thumbnail.scaling, m_thumbnailsScaling);
+        if (!isOutdated || !thumbnail.canvasRect.intersects(m_thumbnailsFrameRect)) {
+            continue;
+        }
+
+        if (next) {
+            hasMore = true;
+            break;
+        }
+
+        next = &thumbnail;
+    }
+
+    if (!next) {
+        return;
+    }
+
+    notation()->painting()->prepareView(next->canvasRect, m_thumbnailsPrinting);
+
+    next->image = paintThumbnail(next->canvasRect, m_thumbnailsScaling, m_thumbnailsPrinting);
+    next->scaling = m_thumbnailsScaling;
+    next->isOutdated = false;
+
+    update();
+
+    if (hasMore) {
+        m_thumbnailsTimer.start(0);
+    }
+}
+
+QImage NotationNavigator::paintThumbnail(const RectF& canvasRect, double scaling, bool isPrinting) const
+{
+    QSize size(std::ceil(canvasRect.width() * scaling), std::ceil(canvasRect.height() * scaling));
+    QImage image(size, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+
+    QPainter qp(&image);
+    draw::Painter painter(&qp, "notationthumbnail", draw::Painter::Mode::Batched);
+    painter.setWorldTransform(draw::Transform(scaling, 0.0, 0.0, scaling, -canvasRect.left() * scaling, -canvasRect.top() * scaling));
+
+    notation()->painting()->paintViewScore(&painter, canvasRect, isPrinting);
+
+    return image;
+}
+
 void NotationNavigator::paintCursor(QPainter* painter)
 {
     TRACEFUNC;
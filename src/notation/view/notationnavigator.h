@@ -22,6 +22,9 @@
 #ifndef MU_NOTATION_NOTATIONNAVIGATOR_H
 #define MU_NOTATION_NOTATIONNAVIGATOR_H
 
+#include <vector>
+
+#include <QImage>
 #include <QObject>
 #include <QMouseEvent>
 #include <QPainter>
@@ -72,6 +75,9 @@ private:
     void paint(QPainter* painter) override;
     void onViewSizeChanged() override;
 
+    bool paintCachedScore(QPainter* qp, const draw::Transform& matrix, const RectF& dirtyRect, bool isPrinting) override;
+    void invalidateTiles() override;
+
     void wheelEvent(QWheelEvent* event) override;
     void mousePressEvent(QMouseEvent* event) override;
     void mouseMoveEvent(QMouseEvent* event) override;
@@ -85,8 +91,29 @@ private:
 
     PageList pages() const;
 
+    //! NOTE A low resolution image of a page, painted again in the background when the page has changed
+    struct PageThumbnail {
+        const Page* page = nullptr;
+        RectF canvasRect;
+        double scaling = 0.0;
+        QImage image;
+        bool isOutdated = true;
+    };
+
+    bool canUseThumbnails(double scaling) const;
+    void updateThumbnails(bool isPrinting);
+    void paintNextOutdatedThumbnail();
+    QImage paintThumbnail(const RectF& canvasRect, double scaling, bool isPrinting) const;
+
     RectF m_cursorRect;
     PointF m_startMove;
+
+    std::vector<PageThumbnail> m_thumbnails;
+    uint64_t m_thumbnailsRevision = 0;
+    bool m_thumbnailsPrinting = false;
+    double m_thumbnailsScaling = 0.0;
+    RectF m_thumbnailsFrameRect;
+    QTimer m_thumbnailsTimer;
 };
 }
 
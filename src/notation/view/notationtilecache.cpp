@@ -0,0 +1,318 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "notationtilecache.h"
+
+#include <chrono>
+#include <cmath>
+
+#include <QPainter>
+
+#include "concurrency/taskscheduler.h"
+#include "draw/bufferedpaintprovider.h"
+#include "draw/utils/drawdatapaint.h"
+
+using namespace mu;
+using namespace mu::notation;
+
+static constexpr int TILE_SIZE = 512; // pixels
+static constexpr size_t MAX_TILES = 96; // about 100 MB
+static constexpr size_t MAX_SCALING_BUCKETS = 2;
+static constexpr double SCALING_PRECISION = 1e-6;
+
+static int tileIndexOf(double pos)
+{
+    return static_cast<int>(std::floor(pos / TILE_SIZE));
+}
+
+static bool isSameScaling(double s1, double s2)
+{
+    return std::abs(s1 - s2) < SCALING_PRECISION;
+}
+
+//! NOTE The tiles are rasterized on their own workers, not on the shared ones, which are used by the audio
+static TaskScheduler* tileWorkers()
+{
+    static TaskScheduler workers;
+    return &workers;
+}
+
+static bool isReady(const std::future<QImage>& future)
+{
+    return future.valid() && future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+void NotationTileCache::clear()
+{
+    m_buckets.clear();
+}
+
+engraving::MemoryReport::Entry NotationTileCache::memoryUsage() const
+{
+    engraving::MemoryReport::Entry entry;
+    for (const ScalingBucket& bucket : m_buckets) {
+        for (const auto& p : bucket.tiles) {
+            entry.count++;
+            entry.bytes += static_cast<size_t>(p.second.image.sizeInBytes());
+        }
+    }
+    return entry;
+}
+
+void NotationTileCache::invalidate(const RectF& canvasRect)
+{
+    //! NOTE One more pixel around for the antialiased edges
+    const double margin = 1.0;
+
+    for (ScalingBucket& bucket : m_buckets) {
+        const int firstColumn = tileIndexOf(canvasRect.left() * bucket.scaling - margin);
+        const int lastColumn = tileIndexOf(canvasRect.right() * bucket.scaling + margin);
+        const int firstRow = tileIndexOf(canvasRect.top() * bucket.scaling - margin);
+        const int lastRow = tileIndexOf(canvasRect.bottom() * bucket.scaling + margin);
+
+        for (auto it = bucket.tiles.begin(); it != bucket.tiles.end();) {
+            const TileIndex& index = it->first;
+            bool damaged = index.first >= firstColumn && index.first <= lastColumn
+                           && index.second >= firstRow && index.second <= lastRow;
+            if (!damaged) {
+                ++it;
+                continue;
+            }
+
+            //! NOTE The tiles that were drawn are kept until they are rasterized again
+            Tile& tile = it->second;
+            if (tile.image.isNull() && !tile.rasterized.valid()) {
+                it = bucket.tiles.erase(it);
+            } else {
+                tile.isOutdated = true;
+                ++it;
+            }
+        }
+    }
+}
+
+NotationTileCache::ScalingBucket* NotationTileCache::scalingBucket(double scaling)
+{
+    for (auto it = m_buckets.begin(); it != m_buckets.end(); ++it) {
+        if (isSameScaling(it->scaling, scaling)) {
+            m_buckets.splice(m_buckets.begin(), m_buckets, it);
+            return &m_buckets.front();
+        }
+    }
+
+    //! NOTE While zooming the scaling changes on every frame,
+    //! the tiles are painted once it stays the same
+    if (!isSameScaling(m_lastScaling, scaling)) {
+        return nullptr;
+    }
+
+    m_buckets.push_front(ScalingBucket { scaling, {} });
+    if (m_buckets.size() > MAX_SCALING_BUCKETS) {
+        m_buckets.pop_back();
+    }
+
+    return &m_buckets.front();
+}
+
+bool NotationTileCache::paint(QPainter* painter, const draw::Transform& matrix, const RectF& viewRect, const PaintFunc& paintScore)
+{
+    const double scaling = matrix.m11();
+    ScalingBucket* bucket = scalingBucket(scaling);
+    m_lastScaling = scaling;
+
+    if (!bucket) {
+        return false;
+    }
+
+    ++m_frame;
+
+    //! NOTE The tiles are drawn at whole pixels to stay sharp
+    const double originX = std::round(matrix.dx());
+    const double originY = std::round(matrix.dy());
+
+    const int firstColumn = tileIndexOf(viewRect.left() - originX);
+    const int lastColumn = tileIndexOf(viewRect.right() - originX);
+    const int firstRow = tileIndexOf(viewRect.top() - originY);
+    const int lastRow = tileIndexOf(viewRect.bottom() - originY);
+
+    std::vector<std::pair<TileIndex, Tile*> > missingTiles;
+
+    for (int row = firstRow; row <= lastRow; ++row) {
+        for (int column = firstColumn; column <= lastColumn; ++column) {
+            TileIndex index { column, row };
+            Tile& tile = bucket->tiles[index];
+            tile.lastUsed = m_frame;
+
+            if (isReady(tile.rasterized)) {
+                tile.image = tile.rasterized.get();
+            }
+
+            if (tile.rasterized.valid()) {
+                continue;
+            }
+
+            if (tile.image.isNull()) {
+                missingTiles.push_back({ index, &tile });
+            } else if (tile.isOutdated) {
+                startRasterizing(tile, index, scaling, paintScore);
+            }
+        }
+    }
+
+    paintTiles(missingTiles, scaling, paintScore);
+
+    for (int row = firstRow; row <= lastRow; ++row) {
+        for (int column = firstColumn; column <= lastColumn; ++column) {
+            const Tile& tile = bucket->tiles[{ column, row }];
+            if (!tile.image.isNull()) {
+                painter->drawImage(QPointF(originX + column * TILE_SIZE, originY + row * TILE_SIZE), tile.image);
+            }
+        }
+    }
+
+    removeUnusedTiles();
+
+    return true;
+}
+
+bool NotationTileCache::hasPendingTiles() const
+{
+    for (const ScalingBucket& bucket : m_buckets) {
+        for (const auto& pair : bucket.tiles) {
+            if (pair.second.rasterized.valid()) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+draw::DrawDataPtr NotationTileCache::recordTile(const TileIndex& index, double scaling, const PaintFunc& paintScore) const
+{
+    const double left = index.first * TILE_SIZE;
+    const double top = index.second * TILE_SIZE;
+
+    std::shared_ptr<draw::BufferedPaintProvider> provider = std::make_shared<draw::BufferedPaintProvider>();
+    {
+        draw::Painter recorder(provider, "notationtile");
+        recorder.setWorldTransform(draw::Transform(scaling, 0.0, 0.0, scaling, -left, -top));
+
+        paintScore(&recorder, RectF(left / scaling, top / scaling, TILE_SIZE / scaling, TILE_SIZE / scaling));
+
+        recorder.endDraw();
+    }
+
+    return provider->drawData();
+}
+
+QImage NotationTileCache::rasterizeTile(const draw::DrawDataPtr& data)
+{
+    QImage image(TILE_SIZE, TILE_SIZE, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::transparent);
+
+    QPainter qp(&image);
+    draw::Painter painter(&qp, "notationtile", draw::Painter::Mode::Batched);
+    draw::DrawDataPaint::replay(&painter, data);
+    painter.endDraw();
+
+    return image;
+}
+
+bool NotationTileCache::canRasterizeInBackground(const draw::DrawDataPtr& data)
+{
+    //! NOTE The debugging provider of the painter is shared by all the painters
+    if (draw::Painter::extended || tileWorkers()->threadPoolSize() <= 1) {
+        return false;
+    }
+
+    //! NOTE The pixmaps are drawn with QPixmap, which is only for the GUI thread
+    for (const draw::DrawData::Object& object : data->objects) {
+        for (const draw::DrawData::Data& d : object.datas) {
+            if (!d.pixmaps.empty()) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+//! NOTE The tiles never drawn are needed now: they are recorded one by one,
+//! but rasterized at the same time
+void NotationTileCache::paintTiles(const std::vector<std::pair<TileIndex, Tile*> >& tiles, double scaling, const PaintFunc& paintScore)
+{
+    for (const auto& pair : tiles) {
+        startRasterizing(*pair.second, pair.first, scaling, paintScore);
+    }
+
+    for (const auto& pair : tiles) {
+        Tile* tile = pair.second;
+        if (tile->rasterized.valid()) {
+            tile->image = tile->rasterized.get();
+        }
+    }
+}
+
+void NotationTileCache::startRasterizing(Tile& tile, const TileIndex& index, double scaling, const PaintFunc& paintScore)
+{
+    draw::DrawDataPtr data = recordTile(index, scaling, paintScore);
+    tile.isOutdated = false;
+
+    if (!canRasterizeInBackground(data)) {
+        tile.image = rasterizeTile(data);
+        return;
+    }
+
+    tile.rasterized = tileWorkers()->submit([data]() {
+        return rasterizeTile(data);
+    });
+}
+
+void NotationTileCache::removeUnusedTiles()
+{
+    size_t count = 0;
+    for (const ScalingBucket& bucket : m_buckets) {
+        count += bucket.tiles.size();
+    }
+
+    while (count > MAX_TILES) {
+        ScalingBucket* oldestBucket = nullptr;
+        std::map<TileIndex, Tile>::iterator oldest;
+
+        for (ScalingBucket& bucket : m_buckets) {
+            for (auto it = bucket.tiles.begin(); it != bucket.tiles.end(); ++it) {
+                if (!oldestBucket || it->second.lastUsed < oldest->second.lastUsed) {
+                    oldestBucket = &bucket;
+                    oldest = it;
+                }
+            }
+        }
+
+        //! NOTE The tiles of the current frame are kept
+        if (!oldestBucket || oldest->second.lastUsed == m_frame) {
+            break;
+        }
+
+        oldestBucket->tiles.erase(oldest);
+        --count;
+    }
+}
@@ -0,0 +1,94 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_NOTATION_NOTATIONTILECACHE_H
+#define MU_NOTATION_NOTATIONTILECACHE_H
+
+#include <functional>
+#include <future>
+#include <list>
+#include <map>
+#include <vector>
+
+#include <QImage>
+
+#include "draw/painter.h"
+#include "draw/types/drawdata.h"
+#include "draw/types/geometry.h"
+#include "draw/types/transform.h"
+
+#include "engraving/libmscore/memoryreport.h"
+
+class QPainter;
+
+namespace mu::notation {
+//! NOTE Keeps the painted score as tiles of the canvas, one set of tiles per scaling,
+//! so that scrolling only draws the images again and not the score.
+//! The score of a tile is recorded to a display list, which is rasterized by the paint workers
+class NotationTileCache
+{
+public:
+    using PaintFunc = std::function<void (draw::Painter* painter, const RectF& frameRect)>;
+
+    void clear();
+    void invalidate(const RectF& canvasRect);
+
+    //! NOTE Draws the tiles of the rect of the view, the missing ones are painted with paintScore.
+    //! The outdated tiles are drawn as they were until they are rasterized again in the background.
+    //! Returns false if the tiles are not used for this scaling (yet), see scalingBucket
+    bool paint(QPainter* painter, const draw::Transform& matrix, const RectF& viewRect, const PaintFunc& paintScore);
+
+    //! NOTE The view must be painted again until there are no more pending tiles
+    bool hasPendingTiles() const;
+
+    //! NOTE The number and the bytes of the tile images
+    engraving::MemoryReport::Entry memoryUsage() const;
+
+private:
+    struct Tile {
+        QImage image;
+        bool isOutdated = false;   // the image is drawn until the tile is rasterized again
+        std::future<QImage> rasterized;   // valid while the tile is rasterized in the background
+        uint64_t lastUsed = 0;
+    };
+
+    using TileIndex = std::pair<int, int>; // column, row
+
+    struct ScalingBucket {
+        double scaling = 0.0;
+        std::map<TileIndex, Tile> tiles;
+    };
+
+    ScalingBucket* scalingBucket(double scaling);
+    draw::DrawDataPtr recordTile(const TileIndex& index, double scaling, const PaintFunc& paintScore) const;
+    static QImage rasterizeTile(const draw::DrawDataPtr& data);
+    static bool canRasterizeInBackground(const draw::DrawDataPtr& data);
+    void paintTiles(const std::vector<std::pair<TileIndex, Tile*> >& tiles, double scaling, const PaintFunc& paintScore);
+    void startRasterizing(Tile& tile, const TileIndex& index, double scaling, const PaintFunc& paintScore);
+    void removeUnusedTiles();
+
+    std::list<ScalingBucket> m_buckets; // the most recently used first
+    double m_lastScaling = 0.0;
+    uint64_t m_frame = 0;
+};
+}
+
+#endif // MU_NOTATION_NOTATIONTILECACHE_H
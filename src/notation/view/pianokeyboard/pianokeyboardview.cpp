@@ -22,6 +22,7 @@
 #include "pianokeyboardview.h"
 
 #include <QPainter>
+#include <QQuickWindow>
 
 #include "pianokeyboardcontroller.h"
 
@@ -62,19 +63,23 @@ PianoKeyboardView::PianoKeyboardView(QQuickItem* parent)
 
     uiConfiguration()->fontChanged().onNotify(this, [this]() {
         determineOctaveLabelsFont();
+        invalidateKeysPixmap();
         update();
     });
 
     updateKeyStateColors();
     uiConfiguration()->currentThemeChanged().onNotify(this, [this]() {
         updateKeyStateColors();
+        invalidateKeysPixmap();
         update();
     });
 
     m_controller->init();
 
+    //! NOTE During playback the states change many times per frame,
+    //! so the colors are only brought up to date once, in the next paint
     m_controller->keyStatesChanged().onNotify(this, [this]() {
-        updateKeyStateColors();
+        m_keyStateColorsValid = false;
         update();
     });
 
@@ -133,6 +138,8 @@ void PianoKeyboardView::calculateKeyRects()
 
     m_keysAreaRect.setSize(QSizeF(hPos + m_spacing / 2, m_whiteKeyHeight));
     adjustKeysAreaPosition();
+
+    invalidateKeysPixmap();
 }
 
 void PianoKeyboardView::adjustKeysAreaPosition()
@@ -179,38 +186,83 @@ void PianoKeyboardView::updateKeyStateColors()
     m_blackKeyBottomPieceStateColors[KeyState::OtherInSelectedChord] = mixedColors(blackKeyBottomPieceBaseColor, accentColor, 0.4);
     m_blackKeyBottomPieceStateColors[KeyState::Selected] = mixedColors(blackKeyBottomPieceBaseColor, accentColor, 0.8);
     m_blackKeyBottomPieceStateColors[KeyState::Played] = mixedColors(blackKeyBottomPieceBaseColor, accentColor, 1.0);
+
+    m_keyStateColorsValid = true;
+}
+
+qreal PianoKeyboardView::devicePixelRatio() const
+{
+    return window() ? window()->effectiveDevicePixelRatio() : 1.0;
+}
+
+void PianoKeyboardView::invalidateKeysPixmap()
+{
+    m_keysPixmapValid = false;
+}
+
+void PianoKeyboardView::renderKeysPixmap()
+{
+    TRACEFUNC;
+
+    qreal dpr = devicePixelRatio();
+    QSize pixmapSize = (m_keysAreaRect.size() * dpr).toSize();
+
+    m_keysPixmap = QPixmap(pixmapSize.expandedTo(QSize(1, 1)));
+    m_keysPixmap.setDevicePixelRatio(dpr);
+    m_keysPixmap.fill(Qt::transparent);
+
+    QPainter painter(&m_keysPixmap);
+    painter.setRenderHint(QPainter::Antialiasing);
+
+    QRectF keysRect(QPointF(0.0, 0.0), m_keysAreaRect.size());
+    painter.fillRect(keysRect, backgroundColor);
+    paintWhiteKeys(&painter, keysRect, false);
+    paintBlackKeys(&painter, keysRect, false);
+
+    m_keysPixmapValid = true;
 }
 
 void PianoKeyboardView::paint(QPainter* painter)
 {
     TRACEFUNC;
 
-    painter->setRenderHint(QPainter::Antialiasing);
+    if (!m_keyStateColorsValid) {
+        updateKeyStateColors();
+    }
 
-    paintBackground(painter);
+    if (!m_keysPixmapValid || !qFuzzyCompare(m_keysPixmap.devicePixelRatio(), devicePixelRatio())) {
+        renderKeysPixmap();
+    }
+
+    painter->setRenderHint(QPainter::Antialiasing);
 
     QPointF pos = m_keysAreaRect.topLeft();
+    painter->drawPixmap(pos, m_keysPixmap);
+
     painter->translate(pos);
 
     QRectF viewport = QRectF(0.0, 0.0, width(), height()).translated(-pos);
-    paintWhiteKeys(painter, viewport);
-    paintBlackKeys(painter, viewport);
-}
-
-void PianoKeyboardView::paintBackground(QPainter* painter)
-{
-    painter->fillRect(m_keysAreaRect, backgroundColor);
+    QRectF repaintedWhiteKeysArea = paintWhiteKeys(painter, viewport, true);
+    paintBlackKeys(painter, viewport, true, repaintedWhiteKeysArea);
 }
 
-void PianoKeyboardView::paintWhiteKeys(QPainter* painter, const QRectF& viewport)
+QRectF PianoKeyboardView::paintWhiteKeys(QPainter* painter, const QRectF& viewport, bool highlightedOnly)
 {
     QPainterPath path;
+    QRectF paintedArea;
 
     for (auto [key, rect] : m_whiteKeyRects) {
         if (!viewport.intersects(rect)) {
             continue;
         }
 
+        KeyState state = highlightedOnly ? m_controller->keyState(key) : KeyState::None;
+        if (highlightedOnly && state == KeyState::None) {
+            continue;
+        }
+
+        paintedArea |= rect;
+
         qreal inset = m_spacing / 2;
 
         qreal left = inset, top = m_spacing,
@@ -230,7 +282,7 @@ void PianoKeyboardView::paintWhiteKeys(QPainter* painter, const QRectF& viewport
 
         painter->translate(rect.topLeft());
 
-        QColor fillColor = m_whiteKeyStateColors[m_controller->keyState(key)];
+        QColor fillColor = m_whiteKeyStateColors[state];
 
         painter->fillPath(path, fillColor);
 
@@ -261,9 +313,12 @@ void PianoKeyboardView::paintWhiteKeys(QPainter* painter, const QRectF& viewport
 
         painter->translate(-rect.topLeft());
     }
+
+    return paintedArea;
 }
 
-void PianoKeyboardView::paintBlackKeys(QPainter* painter, const QRectF& viewport)
+void PianoKeyboardView::paintBlackKeys(QPainter* painter, const QRectF& viewport, bool highlightedOnly,
+                                       const QRectF& repaintedWhiteKeysArea)
 {
     QLinearGradient topPieceGradient;
     QLinearGradient bottomPieceGradient;
@@ -277,6 +332,11 @@ void PianoKeyboardView::paintBlackKeys(QPainter* painter, const QRectF& viewport
             continue;
         }
 
+        KeyState state = highlightedOnly ? m_controller->keyState(key) : KeyState::None;
+        if (highlightedOnly && state == KeyState::None && !repaintedWhiteKeysArea.intersects(rect)) {
+            continue;
+        }
+
         if (backgroundRect.isEmpty()) {
             qreal blackKeyInset = 2.0 * m_keyWidthScaling;
             qreal cornerRadius = blackKeyInset;
@@ -325,8 +385,8 @@ void PianoKeyboardView::paintBlackKeys(QPainter* painter, const QRectF& viewport
             bottomPieceGradient.setFinalStop(0.0, bottom);
         }
 
-        topPieceGradient.setColorAt(1.0, m_blackKeyTopPieceStateColors[m_controller->keyState(key)]);
-        bottomPieceGradient.setColorAt(0.0, m_blackKeyBottomPieceStateColors[m_controller->keyState(key)]);
+        topPieceGradient.setColorAt(1.0, m_blackKeyTopPieceStateColors[state]);
+        bottomPieceGradient.setColorAt(0.0, m_blackKeyBottomPieceStateColors[state]);
 
         painter->translate(rect.topLeft());
         painter->fillRect(backgroundRect, backgroundColor);
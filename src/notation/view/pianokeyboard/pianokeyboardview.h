@@ -22,6 +22,8 @@
 #ifndef MU_NOTATION_PIANOKEYBOARDVIEW_H
 #define MU_NOTATION_PIANOKEYBOARDVIEW_H
 
+#include <QPixmap>
+
 #include "async/asyncable.h"
 
 #include "uicomponents/view/quickpaintedview.h"
@@ -75,10 +77,15 @@ private:
     void determineOctaveLabelsFont();
     void updateKeyStateColors();
 
-    void paintBackground(QPainter* painter);
+    //! NOTE With highlightedOnly, only the keys in a state other than None are painted
+    //! (plus the black keys over them), to be composited over the cached keys pixmap;
+    //! otherwise all the keys are painted in the None state
+    QRectF paintWhiteKeys(QPainter* painter, const QRectF& viewport, bool highlightedOnly);
+    void paintBlackKeys(QPainter* painter, const QRectF& viewport, bool highlightedOnly, const QRectF& repaintedWhiteKeysArea = QRectF());
 
-    void paintWhiteKeys(QPainter* painter, const QRectF& viewport);
-    void paintBlackKeys(QPainter* painter, const QRectF& viewport);
+    qreal devicePixelRatio() const;
+    void invalidateKeysPixmap();
+    void renderKeysPixmap();
 
     void moveCanvas(qreal dx);
     void setScrollOffset(qreal offset);
@@ -105,6 +112,10 @@ private:
 
     QFont m_octaveLabelsFont;
 
+    QPixmap m_keysPixmap;
+    bool m_keysPixmapValid = false;
+    bool m_keyStateColorsValid = false;
+
     std::map<KeyState, QColor> m_whiteKeyStateColors;
     std::map<KeyState, QColor> m_blackKeyTopPieceStateColors;
     std::map<KeyState, QColor> m_blackKeyBottomPieceStateColors;
@@ -21,7 +21,14 @@
  */
 #include "playbackcursor.h"
 
+#include <algorithm>
+
 #include "engraving/libmscore/system.h"
+#include "engraving/libmscore/page.h"
+#include "engraving/libmscore/measure.h"
+#include "engraving/libmscore/segment.h"
+
+#include "log.h"
 
 using namespace mu::notation;
 
@@ -37,6 +44,7 @@ void PlaybackCursor::paint(mu::draw::Painter* painter)
 void PlaybackCursor::setNotation(INotationPtr notation)
 {
     m_notation = notation;
+    invalidate();
 }
 
 void PlaybackCursor::move(midi::tick_t tick)
@@ -44,90 +52,134 @@ void PlaybackCursor::move(midi::tick_t tick)
     m_rect = resolveCursorRectByTick(tick);
 }
 
-//! NOTE Copied from ScoreView::moveCursor(const Fraction& tick)
-mu::RectF PlaybackCursor::resolveCursorRectByTick(midi::tick_t _tick) const
+void PlaybackCursor::invalidate()
+{
+    m_spansValid = false;
+}
+
+//! NOTE Copied from ScoreView::moveCursor(const Fraction& tick),
+//! done once for all the segments of the score
+void PlaybackCursor::buildSpans() const
 {
+    TRACEFUNC;
+
+    m_spans.clear();
+    m_spansValid = true;
+
     if (!m_notation) {
-        return RectF();
+        return;
     }
 
     const mu::engraving::Score* score = m_notation->elements()->msScore();
+    if (!score) {
+        return;
+    }
 
-    Fraction tick = Fraction::fromTicks(_tick);
+    const double spatium = score->spatium();
 
-    Measure* measure = score->tick2measureMM(tick);
-    if (!measure) {
-        return RectF();
-    }
+    const mu::engraving::System* spanSystem = nullptr;
+    double y = 0.0;
+    double h = 0.0;
 
-    mu::engraving::System* system = measure->system();
-    if (!system) {
-        return RectF();
-    }
+    for (const Measure* measure = score->firstMeasureMM(); measure; measure = measure->nextMeasureMM()) {
+        const mu::engraving::System* system = measure->system();
+        if (!system) {
+            continue;
+        }
+
+        if (system != spanSystem) {
+            spanSystem = system;
+
+            y = system->staffYpage(0) + system->page()->pos().y();
+            h = 6 * spatium;
+
+            //
+            // set cursor height for whole system
+            //
+            double y2 = 0.0;
+
+            for (size_t i = 0; i < score->nstaves(); ++i) {
+                const mu::engraving::SysStaff* ss = system->staff(i);
+                if (!ss->show() || !score->staff(i)->show()) {
+                    continue;
+                }
+                y2 = ss->bbox().bottom();
+            }
 
-    qreal x = 0.0;
-    mu::engraving::Segment* s = nullptr;
-    for (s = measure->first(mu::engraving::SegmentType::ChordRest); s;) {
-        Fraction t1 = s->tick();
-        int x1 = s->canvasPos().x();
-        qreal x2 = 0.0;
-        Fraction t2;
-
-        mu::engraving::Segment* ns = s->next(mu::engraving::SegmentType::ChordRest);
-        while (ns && !ns->visible()) {
-            ns = ns->next(mu::engraving::SegmentType::ChordRest);
+            h += y2;
+            y -= 3 * spatium;
         }
 
-        if (ns) {
-            t2 = ns->tick();
-            x2 = ns->canvasPos().x();
-        } else {
-            t2 = measure->endTick();
-            // measure->width is not good enough because of courtesy keysig, timesig
-            mu::engraving::Segment* seg = measure->findSegment(mu::engraving::SegmentType::EndBarLine, measure->tick() + measure->ticks());
-            if (seg) {
-                x2 = seg->canvasPos().x();
+        for (mu::engraving::Segment* s = measure->first(mu::engraving::SegmentType::ChordRest); s;) {
+            Span span;
+            span.tickFrom = s->tick().ticks();
+            span.xFrom = static_cast<int>(s->canvasPos().x());
+            span.y = y;
+            span.height = h;
+
+            mu::engraving::Segment* ns = s->next(mu::engraving::SegmentType::ChordRest);
+            while (ns && !ns->visible()) {
+                ns = ns->next(mu::engraving::SegmentType::ChordRest);
+            }
+
+            if (ns) {
+                span.tickTo = ns->tick().ticks();
+                span.xTo = ns->canvasPos().x();
             } else {
-                x2 = measure->canvasPos().x() + measure->width(); // safety, should not happen
+                span.tickTo = measure->endTick().ticks();
+                // measure->width is not good enough because of courtesy keysig, timesig
+                const mu::engraving::Segment* seg = measure->findSegment(mu::engraving::SegmentType::EndBarLine,
+                                                                         measure->tick() + measure->ticks());
+                if (seg) {
+                    span.xTo = seg->canvasPos().x();
+                } else {
+                    span.xTo = measure->canvasPos().x() + measure->width(); // safety, should not happen
+                }
             }
-        }
 
-        if (tick >= t1 && tick < t2) {
-            Fraction dt = t2 - t1;
-            qreal dx = x2 - x1;
-            x = x1 + dx * (tick - t1).ticks() / dt.ticks();
-            break;
+            if (span.tickTo > span.tickFrom) {
+                m_spans.push_back(span);
+            }
+
+            s = ns;
         }
-        s = ns;
     }
+}
 
-    if (!s) {
+mu::RectF PlaybackCursor::resolveCursorRectByTick(midi::tick_t _tick) const
+{
+    if (!m_notation) {
         return RectF();
     }
 
-    double y = system->staffYpage(0) + system->page()->pos().y();
-    double _spatium = score->spatium();
+    if (!m_spansValid) {
+        buildSpans();
+    }
 
-    double w  = 8;
-    double h  = 6 * _spatium;
-    //
-    // set cursor height for whole system
-    //
-    double y2 = 0.0;
+    const int tick = static_cast<int>(_tick);
 
-    for (size_t i = 0; i < score->nstaves(); ++i) {
-        mu::engraving::SysStaff* ss = system->staff(i);
-        if (!ss->show() || !score->staff(i)->show()) {
-            continue;
-        }
-        y2 = ss->bbox().bottom();
+    auto it = std::upper_bound(m_spans.cbegin(), m_spans.cend(), tick, [](int t, const Span& span) {
+        return t < span.tickFrom;
+    });
+
+    if (it == m_spans.cbegin()) {
+        return RectF();
     }
 
-    h += y2;
-    x -= _spatium;
-    y -= 3 * _spatium;
+    const Span& span = *(--it);
+    if (tick >= span.tickTo) {
+        return RectF();
+    }
+
+    const mu::engraving::Score* score = m_notation->elements()->msScore();
+    const double spatium = score->spatium();
+
+    double x = span.xFrom + (span.xTo - span.xFrom) * (tick - span.tickFrom) / (span.tickTo - span.tickFrom);
+    x -= spatium;
+
+    double w = 8;
 
-    return RectF(x, y, w, h);
+    return RectF(x, span.y, w, span.height);
 }
 
 bool PlaybackCursor::visible() const
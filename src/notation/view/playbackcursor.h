@@ -22,6 +22,8 @@
 #ifndef MU_NOTATION_PLAYBACKCURSOR_H
 #define MU_NOTATION_PLAYBACKCURSOR_H
 
+#include <vector>
+
 #include "modularity/ioc.h"
 #include "notation/inotationconfiguration.h"
 #include "draw/types/geometry.h"
@@ -43,18 +45,36 @@ public:
     void setNotation(INotationPtr notation);
     void move(midi::tick_t tick);
 
+    //! NOTE The cursor positions are taken from a table built from the layout on the first move,
+    //! it has to be invalidated after each layout
+    void invalidate();
+
     bool visible() const;
     void setVisible(bool arg);
 
     const RectF& rect() const;
 
 private:
+    //! NOTE The cursor goes linearly from one visible chord/rest segment to the next one
+    struct Span {
+        int tickFrom = 0;
+        int tickTo = 0;
+        double xFrom = 0.0;
+        double xTo = 0.0;
+        double y = 0.0;
+        double height = 0.0;
+    };
+
     QColor color() const;
     RectF resolveCursorRectByTick(midi::tick_t tick) const;
+    void buildSpans() const;
 
     bool m_visible = false;
     RectF m_rect;
 
+    mutable std::vector<Span> m_spans;
+    mutable bool m_spansValid = false;
+
     INotationPtr m_notation;
 };
 }
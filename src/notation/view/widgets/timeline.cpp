@@ -28,6 +28,8 @@
 #include <QTextDocument>
 #include <QMouseEvent>
 
+#include <map>
+
 #include "translation.h"
 
 #include "engraving/types/typesconv.h"
@@ -57,6 +59,50 @@
 using namespace mu::notation;
 using namespace mu::engraving;
 
+//---------------------------------------------------------
+//   cellsToRects
+//    merges the cells (column, row) into rectangles:
+//    the runs of rows in a column, then the same runs in the next columns
+//---------------------------------------------------------
+
+static std::vector<QRect> cellsToRects(const std::set<std::pair<int, int> >& cells)
+{
+    std::vector<QRect> rects;
+    std::map<std::pair<int, int>, size_t> prevColumnRuns;
+    std::map<std::pair<int, int>, size_t> columnRuns;
+    int column = -1;
+
+    auto it = cells.begin();
+    while (it != cells.end()) {
+        const int col = it->first;
+        const int top = it->second;
+        int bottom = top;
+        for (++it; it != cells.end() && it->first == col && it->second == bottom + 1; ++it) {
+            ++bottom;
+        }
+
+        if (col != column) {
+            prevColumnRuns.clear();
+            if (col == column + 1) {
+                prevColumnRuns.swap(columnRuns);
+            }
+            columnRuns.clear();
+            column = col;
+        }
+
+        auto prev = prevColumnRuns.find({ top, bottom });
+        if (prev != prevColumnRuns.end()) {
+            rects[prev->second].setRight(col);
+            columnRuns[{ top, bottom }] = prev->second;
+        } else {
+            rects.push_back(QRect(QPoint(col, top), QPoint(col, bottom)));
+            columnRuns[{ top, bottom }] = rects.size() - 1;
+        }
+    }
+
+    return rects;
+}
+
 //---------------------------------------------------------
 //   TRowLabels
 //---------------------------------------------------------
@@ -762,6 +808,7 @@ Timeline::Timeline(QSplitter* splitter)
 
     connect(verticalScrollBar(), &QScrollBar::valueChanged, _rowNames->verticalScrollBar(), &QScrollBar::setValue);
     connect(verticalScrollBar(), &QScrollBar::valueChanged, this, &Timeline::handleScroll);
+    connect(horizontalScrollBar(), &QScrollBar::valueChanged, this, &Timeline::updateVisibleArea);
     connect(_rowNames, &TRowLabels::swapMeta, this, &Timeline::swapMeta);
     connect(this, &Timeline::moved, _rowNames, &TRowLabels::mouseOver);
 
@@ -965,35 +1012,17 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
         );
     const bool rebuildPartial = !rebuildAll && (startMeasure >= 0);
 
-    const unsigned numMetas = nmetas();
-
     if (rebuildAll) {
         clearScene();
         startMeasure = 0;
         endMeasure = globalCols;
     } else {
         if (rebuildPartial) {
-            const QRectF replacedRect
-                = getMeasureRect(startMeasure, 0, numMetas) | getMeasureRect(endMeasure - 1, globalRows - 1, numMetas);
-            const QList<QGraphicsItem*> replacedItems = scene()->items(replacedRect, Qt::ContainsItemShape);
-            for (QGraphicsItem* item : replacedItems) {
-                if (item->data(keyItemType).value<ItemType>() != ItemType::TYPE_MEASURE) {
-                    continue;
-                }
-                scene()->removeItem(item);
-                delete item;
-            }
+            removeCells(startMeasure, endMeasure);
         }
 
-        // Meta rows are still rebuilt from scratch, remove old meta rows manually
-        const QList<QGraphicsItem*> items = scene()->items();
-        for (QGraphicsItem* item : items) {
-            if (item->data(keyItemType).value<ItemType>() != ItemType::TYPE_META) {
-                continue;
-            }
-            scene()->removeItem(item);
-            delete item;
-        }
+        // Meta rows are still rebuilt from scratch
+        removeMetas();
     }
 
     _metaRows.clear();
@@ -1002,52 +1031,225 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
         return;
     }
 
-    int stagger = 0;
-    setMinimumHeight(_gridHeight * (numMetas + 1) + 5 + horizontalScrollBar()->height());
+    setMinimumHeight(_gridHeight * (nmetas() + 1) + 5 + horizontalScrollBar()->height());
     setMinimumWidth(_gridWidth * 3);
-    _globalZValue = 1;
 
-    // Draw grid
-    Measure* currMeasure = score()->firstMeasure();
-    for (int i = 0; i < startMeasure; ++i) {
-        currMeasure = currMeasure->nextMeasure();
+    updateCellsModel(globalRows, globalCols, std::max(startMeasure, 0), std::max(endMeasure, 0));
+
+    gridRows = globalRows;
+    gridCols = globalCols;
+
+    setSceneRect(0, 0, getWidth(), getHeight());
+
+    syncVisibleCells();
+    drawMetas();
+}
+
+//---------------------------------------------------------
+//   Timeline::updateCellsModel
+//    refreshes the measures and the occupancy of the columns
+//    in [startMeasure, endMeasure)
+//---------------------------------------------------------
+
+void Timeline::updateCellsModel(int rows, int cols, int startMeasure, int endMeasure)
+{
+    TRACEFUNC;
+
+    if (rows != gridRows || cols != gridCols || (startMeasure == 0 && endMeasure == cols)) {
+        _cellMeasures.assign(cols, nullptr);
+        _filledCells.assign(static_cast<size_t>(rows) * cols, false);
+        _measureColumns.clear();
     }
 
-    QList<Part*> partList = getParts();
+    Measure* measure = score()->firstMeasure();
+    for (int i = 0; i < startMeasure && measure; ++i) {
+        measure = measure->nextMeasure();
+    }
 
-    for (int col = startMeasure; col < endMeasure; col++) {
-        for (int row = 0; row < globalRows; row++) {
-            QGraphicsRectItem* graphicsRectItem = new QGraphicsRectItem(getMeasureRect(col, row, numMetas));
-            graphicsRectItem->setData(keyItemType, QVariant::fromValue(ItemType::TYPE_MEASURE));
-
-            setMetaData(graphicsRectItem, row, ElementType::INVALID, currMeasure, false, 0);
-
-            QString translateMeasure = qtrc("notation/timeline", "Measure");
-            QChar initialLetter = translateMeasure[0];
-            QTextDocument doc;
-            QString partName = "";
-            if (partList.size() > row) {
-                doc.setHtml(partList.at(row)->longName());
-                partName = doc.toPlainText();
-                if (partName.isEmpty()) {         // No Long instrument name? Fall back to Part name
-                    doc.setHtml(partList.at(row)->partName());
-                    partName = doc.toPlainText();
-                }
-                if (partName.isEmpty()) {       // No Part name? Fall back to Instrument name
-                    partName = partList.at(row)->instrumentName();
+    const track_idx_t ntracks = static_cast<track_idx_t>(rows) * VOICES;
+
+    for (int col = startMeasure; col < endMeasure && measure; ++col, measure = measure->nextMeasure()) {
+        if (_cellMeasures[col]) {
+            _measureColumns.erase(_cellMeasures[col]);
+        }
+
+        _cellMeasures[col] = measure;
+        _measureColumns[measure] = col;
+
+        const size_t columnOffset = static_cast<size_t>(col) * rows;
+        std::fill(_filledCells.begin() + columnOffset, _filledCells.begin() + columnOffset + rows, false);
+
+        for (Segment* seg = measure->first(SegmentType::ChordRest); seg; seg = seg->next(SegmentType::ChordRest)) {
+            for (track_idx_t track = 0; track < ntracks; track++) {
+                ChordRest* chordRest = seg->cr(track);
+                if (chordRest) {
+                    ElementType crt = chordRest->type();
+                    if (crt == ElementType::CHORD || crt == ElementType::MEASURE_REPEAT) {
+                        _filledCells[columnOffset + track / VOICES] = true;
+                    }
                 }
             }
+        }
+    }
+
+    QList<Part*> partList = getParts();
+
+    _cellsPartNames.assign(rows, QString());
+    for (int row = 0; row < rows && row < partList.size(); row++) {
+        QTextDocument doc;
+        doc.setHtml(partList.at(row)->longName());
+        QString partName = doc.toPlainText();
+        if (partName.isEmpty()) {         // No Long instrument name? Fall back to Part name
+            doc.setHtml(partList.at(row)->partName());
+            partName = doc.toPlainText();
+        }
+        if (partName.isEmpty()) {       // No Part name? Fall back to Instrument name
+            partName = partList.at(row)->instrumentName();
+        }
+        _cellsPartNames[row] = partName;
+    }
+}
+
+//---------------------------------------------------------
+//   Timeline::visibleCells
+//    the columns and the rows of the cells around the viewport
+//---------------------------------------------------------
+
+QRect Timeline::visibleCells() const
+{
+    static constexpr int MARGIN = 2;
+
+    const QRectF area = mapToScene(viewport()->rect()).boundingRect();
+    const int numMetas = static_cast<int>(nmetas());
+
+    const int firstCol = std::max(0, static_cast<int>(area.left()) / _gridWidth - MARGIN);
+    const int lastCol = std::min(gridCols - 1, static_cast<int>(area.right()) / _gridWidth + MARGIN);
+    const int firstRow = std::max(0, (static_cast<int>(area.top()) - 3) / _gridHeight - numMetas - MARGIN);
+    const int lastRow = std::min(gridRows - 1, (static_cast<int>(area.bottom()) - 3) / _gridHeight - numMetas + MARGIN);
+
+    return QRect(QPoint(firstCol, firstRow), QPoint(lastCol, lastRow));
+}
+
+//---------------------------------------------------------
+//   Timeline::syncVisibleCells
+//    drops the cell items which went out of the viewport
+//    and creates the ones which came in
+//---------------------------------------------------------
+
+void Timeline::syncVisibleCells()
+{
+    if (!score() || gridRows == 0 || gridCols == 0) {
+        return;
+    }
+
+    TRACEFUNC;
+
+    const QRect cells = visibleCells();
+
+    for (auto it = _cellItems.begin(); it != _cellItems.end();) {
+        const int col = static_cast<int>(it->first / gridRows);
+        const int row = static_cast<int>(it->first % gridRows);
+        if (cells.contains(col, row)) {
+            ++it;
+            continue;
+        }
+
+        scene()->removeItem(it->second);
+        delete it->second;
+        it = _cellItems.erase(it);
+    }
+
+    const int numMetas = static_cast<int>(nmetas());
+    for (int col = cells.left(); col <= cells.right(); col++) {
+        for (int row = cells.top(); row <= cells.bottom(); row++) {
+            const size_t key = static_cast<size_t>(col) * gridRows + row;
+            if (_cellItems.find(key) == _cellItems.end()) {
+                _cellItems[key] = createCell(col, row, numMetas);
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------
+//   Timeline::removeCells
+//---------------------------------------------------------
 
-            graphicsRectItem->setToolTip(initialLetter + QString(" ") + QString::number(currMeasure->no() + 1) + QString(", ") + partName);
-            graphicsRectItem->setPen(QPen(activeTheme().backgroundColor));
-            graphicsRectItem->setBrush(QBrush(colorBox(graphicsRectItem)));
-            graphicsRectItem->setZValue(-3);
-            scene()->addItem(graphicsRectItem);
+void Timeline::removeCells(int startMeasure, int endMeasure)
+{
+    for (auto it = _cellItems.begin(); it != _cellItems.end();) {
+        const int col = static_cast<int>(it->first / gridRows);
+        if (col < startMeasure || col >= endMeasure) {
+            ++it;
+            continue;
         }
 
-        currMeasure = currMeasure->nextMeasure();
+        scene()->removeItem(it->second);
+        delete it->second;
+        it = _cellItems.erase(it);
     }
-    setSceneRect(0, 0, getWidth(), getHeight());
+}
+
+//---------------------------------------------------------
+//   Timeline::createCell
+//---------------------------------------------------------
+
+QGraphicsRectItem* Timeline::createCell(int column, int row, int numMetas)
+{
+    Measure* measure = _cellMeasures[column];
+
+    QGraphicsRectItem* graphicsRectItem = new QGraphicsRectItem(getMeasureRect(column, row, numMetas));
+    graphicsRectItem->setData(keyItemType, QVariant::fromValue(ItemType::TYPE_MEASURE));
+
+    setMetaData(graphicsRectItem, row, ElementType::INVALID, measure, false, 0);
+
+    QString translateMeasure = qtrc("notation/timeline", "Measure");
+    QChar initialLetter = translateMeasure[0];
+    const QString& partName = _cellsPartNames[row];
+
+    graphicsRectItem->setToolTip(initialLetter + QString(" ") + QString::number(measure->no() + 1) + QString(", ") + partName);
+    graphicsRectItem->setPen(QPen(activeTheme().backgroundColor));
+    graphicsRectItem->setBrush(QBrush(colorBox(column, row)));
+    graphicsRectItem->setZValue(-3);
+    scene()->addItem(graphicsRectItem);
+
+    return graphicsRectItem;
+}
+
+//---------------------------------------------------------
+//   Timeline::removeMetas
+//---------------------------------------------------------
+
+void Timeline::removeMetas()
+{
+    const QList<QGraphicsItem*> items = scene()->items();
+    for (QGraphicsItem* item : items) {
+        if (item->data(keyItemType).value<ItemType>() != ItemType::TYPE_META) {
+            continue;
+        }
+        scene()->removeItem(item);
+        delete item;
+    }
+
+    // the hovered meta value is gone
+    std::get<0>(_oldHoverInfo) = nullptr;
+    std::get<1>(_oldHoverInfo) = -1;
+}
+
+//---------------------------------------------------------
+//   Timeline::drawMetas
+//    the meta rows and the meta values of the measures
+//    from one viewport before to one viewport after the visible ones
+//---------------------------------------------------------
+
+void Timeline::drawMetas()
+{
+    TRACEFUNC;
+
+    const unsigned numMetas = nmetas();
+
+    int stagger = 0;
+    _globalZValue = 1;
+    _globalMeasureNumber = -1;
 
     // Draw meta rows and separator
     QGraphicsLineItem* graphicsLineItemSeparator = new QGraphicsLineItem(0,
@@ -1077,7 +1279,11 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
         _metaRows.push_back(pairGraphicsIntMeta);
     }
 
-    int xPos = 0;
+    const QRect cells = visibleCells();
+    _metasBegin = std::max(0, cells.left() - cells.width());
+    _metasEnd = std::min(gridCols, cells.right() + 1 + cells.width());
+
+    int xPos = _metasBegin * _gridWidth;
 
     // Create stagger array if _collapsedMeta is false
 #if (!defined (_MSCVER) && !defined (_MSC_VER))
@@ -1091,10 +1297,18 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
     std::vector<int> staggerArr(numMetas, 0);    // Default initialized, loop not required
 #endif
 
+    const unsigned keySigRow = getMetaRow(qtrc("notation/timeline", "Key signature"));
+    const unsigned jumpsRow = getMetaRow(qtrc("notation/timeline", "Jumps and markers"));
+
     bool noKey = true;
     std::get<4>(_repeatInfo) = false;
 
-    for (Measure* cm = score()->firstMeasure(); cm; cm = cm->nextMeasure()) {
+    for (int col = _metasBegin; col < _metasEnd; ++col) {
+        Measure* cm = _cellMeasures[col];
+        if (!cm) {
+            break;
+        }
+
         for (Segment* currSeg = cm->first(); currSeg; currSeg = currSeg->next()) {
             // Toggle noKey if initial key signature is found
             if (currSeg->isKeySigType() && cm == score()->firstMeasure()) {
@@ -1106,11 +1320,11 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
             // If no initial key signature is found, add key signature
             if (cm == score()->firstMeasure() && noKey
                 && (currSeg->isTimeSigType() || currSeg->isChordRestType())) {
-                if (getMetaRow(qtrc("notation/timeline", "Key signature")) != numMetas) {
+                if (keySigRow != numMetas) {
                     if (_collapsedMeta) {
                         keyMeta(0, &stagger, xPos);
                     } else {
-                        keyMeta(0, &staggerArr[getMetaRow(qtrc("notation/timeline", "Key signature"))], xPos);
+                        keyMeta(0, &staggerArr[keySigRow], xPos);
                     }
                 }
                 noKey = false;
@@ -1131,7 +1345,7 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
             }
         }
         // Handle all jumps here
-        if (getMetaRow(qtrc("notation/timeline", "Jumps and markers")) != numMetas) {
+        if (jumpsRow != numMetas) {
             ElementList measureElementsList = cm->el();
             for (EngravingItem* element : measureElementsList) {
                 std::get<3>(_repeatInfo) = element;
@@ -1159,9 +1373,6 @@ void Timeline::drawGrid(int globalRows, int globalCols, int startMeasure, int en
         xPos += _gridWidth;
         std::get<4>(_repeatInfo) = false;
     }
-
-    gridRows = globalRows;
-    gridCols = globalCols;
 }
 
 //---------------------------------------------------------
@@ -1518,9 +1729,10 @@ void Timeline::measureMeta(Segment*, int*, int pos)
     int row = getMetaRow(qtrc("notation/timeline", "Measures"));
 
     // Adjust number
-    Measure* currMeasure;
-    for (currMeasure = score()->firstMeasure(); currMeasureNumber != 0; currMeasureNumber--, currMeasure = currMeasure->nextMeasure()) {
+    if (currMeasureNumber < 0 || currMeasureNumber >= static_cast<int>(_cellMeasures.size())) {
+        return;
     }
+    Measure* currMeasure = _cellMeasures[currMeasureNumber];
 
     // Add measure number
     QString measureNumber = (currMeasure->irregular()) ? "( )" : QString::number(currMeasure->no() + 1);
@@ -1842,6 +2054,12 @@ void Timeline::clearScene()
     nonVisiblePathItem = nullptr;
     visiblePathItem = nullptr;
     selectionItem = nullptr;
+    _cellItems.clear();
+    _metasBegin = 0;
+    _metasEnd = 0;
+
+    std::get<0>(_oldHoverInfo) = nullptr;
+    std::get<1>(_oldHoverInfo) = -1;
 }
 
 //---------------------------------------------------------
@@ -2040,8 +2258,38 @@ void Timeline::drawSelection()
         }
     }
 
+    const int numMetas = static_cast<int>(nmetas());
+
+    _selectedCells.clear();
+    for (const std::tuple<Measure*, int, ElementType>& label : metaLabelsSet) {
+        if (std::get<1>(label) == -1) {
+            continue;
+        }
+
+        auto column = _measureColumns.find(std::get<0>(label));
+        if (column == _measureColumns.end()) {
+            continue;
+        }
+
+        _selectedCells.insert({ column->second, std::get<1>(label) });
+    }
+
+    for (const QRect& cells : cellsToRects(_selectedCells)) {
+        _selectionPath.addRect(getMeasureRect(cells.left(), cells.top(), numMetas)
+                               | getMeasureRect(cells.right(), cells.bottom(), numMetas));
+    }
+
+    // Ensure unselected measures are not marked selected
+    for (auto& cell : _cellItems) {
+        cell.second->setBrush(QBrush(colorBox(static_cast<int>(cell.first / gridRows), static_cast<int>(cell.first % gridRows))));
+    }
+
     const QList<QGraphicsItem*> graphicsItemList = scene()->items();
     for (QGraphicsItem* graphicsItem : graphicsItemList) {
+        if (graphicsItem->data(keyItemType).value<ItemType>() == ItemType::TYPE_MEASURE) {
+            continue;
+        }
+
         int stave = graphicsItem->data(0).value<int>();
         ElementType elementType = graphicsItem->data(1).value<ElementType>();
         Measure* measure = static_cast<Measure*>(graphicsItem->data(2).value<void*>());
@@ -2083,20 +2331,6 @@ void Timeline::drawSelection()
                 }
             }
         }
-        // Change color from gray to only blue
-        else if (it != metaLabelsSet.end()) {
-            QGraphicsRectItem* graphicsRectItem = qgraphicsitem_cast<QGraphicsRectItem*>(graphicsItem);
-            graphicsRectItem->setBrush(QBrush(QColor(graphicsRectItem->brush().color().red(),
-                                                     graphicsRectItem->brush().color().green(),
-                                                     255)));
-            _selectionPath.addRect(graphicsRectItem->rect());
-        } else {
-            // Ensure unselected measures are not marked selected
-            QGraphicsRectItem* graphicsRectItem = qgraphicsitem_cast<QGraphicsRectItem*>(graphicsItem);
-            if (graphicsRectItem && graphicsRectItem->data(keyItemType).value<ItemType>() == ItemType::TYPE_MEASURE) {
-                graphicsRectItem->setBrush(QBrush(colorBox(graphicsRectItem)));
-            }
-        }
     }
 
     if (selectionItem) {
@@ -2170,17 +2404,8 @@ void Timeline::mousePressEvent(QMouseEvent* event)
             // Handle measure box clicks
             if (scenePt.y() > (nmeta - 1) * _gridHeight + verticalScrollBar()->value()
                 && scenePt.y() < bottomOfMeta) {
-                QRectF tmp(scenePt.x(), 0, 3, nmeta * _gridHeight + nstaves() * _gridHeight);
-                QList<QGraphicsItem*> gl = scene()->items(tmp);
-                Measure* measure = nullptr;
-
-                for (QGraphicsItem* graphicsItem : gl) {
-                    measure = static_cast<Measure*>(graphicsItem->data(2).value<void*>());
-                    //-3 z value is the grid square values
-                    if (graphicsItem->zValue() == -3 && measure) {
-                        break;
-                    }
-                }
+                const int column = static_cast<int>(scenePt.x()) / _gridWidth;
+                Measure* measure = (column >= 0 && column < static_cast<int>(_cellMeasures.size())) ? _cellMeasures[column] : nullptr;
 
                 if (measure) {
                     interaction()->showItem(measure);
@@ -2523,6 +2748,16 @@ void Timeline::showEvent(QShowEvent* evt)
     }
 }
 
+//---------------------------------------------------------
+//   resizeEvent
+//---------------------------------------------------------
+
+void Timeline::resizeEvent(QResizeEvent* event)
+{
+    QGraphicsView::resizeEvent(event);
+    updateVisibleArea();
+}
+
 //---------------------------------------------------------
 //   changeEvent
 //---------------------------------------------------------
@@ -2593,6 +2828,33 @@ void Timeline::updateGridFromCmdState()
     updateGrid(startMeasureIndex, endMeasureIndex);
 }
 
+//---------------------------------------------------------
+//   updateGridFromChangesRange
+//    the command state is already reset when the undo stack
+//    reports a change, so take the measures from the range
+//---------------------------------------------------------
+
+void Timeline::updateGridFromChangesRange(const ChangesRange& range)
+{
+    if (!score()) {
+        updateGridFull();
+        return;
+    }
+
+    if (range.tickFrom < 0 || range.tickTo < 0) {
+        updateGridFull();
+        return;
+    }
+
+    const Measure* startMeasure = score()->tick2measure(Fraction::fromTicks(range.tickFrom));
+    const int startMeasureIndex = startMeasure ? startMeasure->measureIndex() : 0;
+
+    const Measure* endMeasure = score()->tick2measure(Fraction::fromTicks(range.tickTo));
+    const int endMeasureIndex = endMeasure ? (endMeasure->measureIndex() + 1) : static_cast<int>(score()->nmeasures());
+
+    updateGrid(startMeasureIndex, endMeasureIndex);
+}
+
 //---------------------------------------------------------
 //   Timeline::setNotation
 //---------------------------------------------------------
@@ -2760,25 +3022,17 @@ int Timeline::nstaves() const
 //   Timeline::colorBox
 //---------------------------------------------------------
 
-QColor Timeline::colorBox(QGraphicsRectItem* item)
+QColor Timeline::colorBox(int column, int row) const
 {
-    Measure* measure = static_cast<Measure*>(item->data(2).value<void*>());
-    staff_idx_t stave = static_cast<staff_idx_t>(item->data(0).value<int>());
-    for (Segment* seg = measure->first(); seg; seg = seg->next()) {
-        if (!seg->isChordRestType()) {
-            continue;
-        }
-        for (track_idx_t track = stave * VOICES; track < stave * VOICES + VOICES; track++) {
-            ChordRest* chordRest = seg->cr(track);
-            if (chordRest) {
-                ElementType crt = chordRest->type();
-                if (crt == ElementType::CHORD || crt == ElementType::MEASURE_REPEAT) {
-                    return activeTheme().colorBoxColor;
-                }
-            }
-        }
+    const size_t index = static_cast<size_t>(column) * gridRows + row;
+    QColor color = (index < _filledCells.size() && _filledCells[index]) ? activeTheme().colorBoxColor : QColor(224, 224, 224);
+
+    // Change color from gray to only blue
+    if (_selectedCells.find({ column, row }) != _selectedCells.end()) {
+        color = QColor(color.red(), color.green(), 255);
     }
-    return QColor(224, 224, 224);
+
+    return color;
 }
 
 //---------------------------------------------------------
@@ -2866,6 +3120,33 @@ void Timeline::handleScroll(int value)
             graphicsItem->setY(qreal(scrollbarValue + rowY));
         }
     }
+
+    syncVisibleCells();
+    viewport()->update();
+}
+
+//---------------------------------------------------------
+//   Timeline::updateVisibleArea
+//    creates the items which came into the viewport,
+//    the meta values are redrawn when the viewport leaves the measures they were drawn for
+//---------------------------------------------------------
+
+void Timeline::updateVisibleArea()
+{
+    if (!score() || gridRows == 0 || gridCols == 0) {
+        return;
+    }
+
+    syncVisibleCells();
+
+    const QRect cells = visibleCells();
+    if (cells.left() < _metasBegin || cells.right() >= _metasEnd) {
+        removeMetas();
+        _metaRows.clear();
+        drawMetas();
+        drawSelection();
+    }
+
     viewport()->update();
 }
 
@@ -32,6 +32,8 @@
 #include "actions/iactionsdispatcher.h"
 
 #include <vector>
+#include <set>
+#include <unordered_map>
 #include <QGraphicsView>
 #include <QSplitter>
 
@@ -127,6 +129,7 @@ public:
 
     void updateGridView() { updateGrid(-1, -1); }
     void updateGridFromCmdState();
+    void updateGridFromChangesRange(const ChangesRange& range);
     void setNotation(INotationPtr notation);
 
     TRowLabels* labelsColumn() const;
@@ -166,6 +169,19 @@ private:
     int gridRows = 0;
     int gridCols = 0;
 
+    //! NOTE The grid is virtualized: the occupancy of every cell is kept in a compact model,
+    //! the graphics items are created only for the cells around the viewport
+    std::vector<engraving::Measure*> _cellMeasures;
+    std::unordered_map<const engraving::Measure*, int> _measureColumns;
+    std::vector<bool> _filledCells;
+    std::vector<QString> _cellsPartNames;
+    std::set<std::pair<int, int> > _selectedCells;
+    std::unordered_map<size_t, QGraphicsRectItem*> _cellItems;
+
+    // The meta values are drawn for the measures around the viewport
+    int _metasBegin = 0;
+    int _metasEnd = 0;
+
     QGraphicsPathItem* nonVisiblePathItem = nullptr;
     QGraphicsPathItem* visiblePathItem = nullptr;
     QGraphicsPathItem* selectionItem = nullptr;
@@ -207,6 +223,7 @@ private:
     void wheelEvent(QWheelEvent* event) override;
     void leaveEvent(QEvent*) override;
     void showEvent(QShowEvent*) override;
+    void resizeEvent(QResizeEvent*) override;
     void changeEvent(QEvent*) override;
 
     unsigned correctMetaRow(unsigned row);
@@ -221,6 +238,15 @@ private:
 
     void clearScene();
 
+    void updateCellsModel(int rows, int cols, int startMeasure, int endMeasure);
+    QRect visibleCells() const;
+    void syncVisibleCells();
+    void removeCells(int startMeasure, int endMeasure);
+    QGraphicsRectItem* createCell(int column, int row, int numMetas);
+
+    void drawMetas();
+    void removeMetas();
+
     void updateGrid(int startMeasure = -1, int endMeasure = -1);
 
     INotationInteractionPtr interaction() const;
@@ -228,6 +254,7 @@ private:
 
 private slots:
     void handleScroll(int value);
+    void updateVisibleArea();
 
     void changeSelection(engraving::SelState);
     void mouseOver(QPointF pos);
@@ -256,7 +283,7 @@ private:
 
     void updateGridFull() { updateGrid(0, -1); }
 
-    QColor colorBox(QGraphicsRectItem* item);
+    QColor colorBox(int column, int row) const;
 
     std::vector<std::pair<QString, bool> > getLabels();
 
@@ -49,6 +49,11 @@ public:
         m_msTimeline->updateGridFromCmdState();
     }
 
+    void updateGrid(const ChangesRange& range)
+    {
+        m_msTimeline->updateGridFromChangesRange(range);
+    }
+
     void setNotation(INotationPtr notation)
     {
         m_msTimeline->setNotation(notation);
@@ -123,8 +128,10 @@ void TimelineView::componentComplete()
             return;
         }
 
-        notation->undoStack()->stackChanged().onNotify(this, [=] {
-            updateView();
+        //! NOTE The grid of the changed measures is updated from the changes range, sent with each change of the stack
+        notation->undoStack()->changesChannel().onReceive(this, [this, timeline](const ChangesRange& range) {
+            update();
+            timeline->updateGrid(range);
         });
 
         notation->interaction()->selectionChanged().onNotify(this, [=] {
@@ -22,6 +22,7 @@
 #include "palettecell.h"
 
 #include "mimedatautils.h"
+#include "palettecelliconengine.h"
 
 #include "engraving/rw/xml.h"
 #include "engraving/libmscore/actionicon.h"
@@ -152,6 +153,7 @@ void PaletteCell::retranslate()
         TextBase* orig = toTextBase(untranslatedElement.get());
         const QString& text = orig->xmlText();
         target->setXmlText(mu::qtrc("palette", text.toUtf8().constData()));
+        PaletteCellIconEngine::invalidateCache();
     }
 }
 
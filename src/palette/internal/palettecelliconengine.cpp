@@ -22,6 +22,8 @@
 #include "palettecelliconengine.h"
 
 #include <QPainter>
+#include <QPixmap>
+#include <QPixmapCache>
 
 #include "draw/types/geometry.h"
 #include "draw/painter.h"
@@ -37,9 +39,26 @@ using namespace mu::palette;
 using namespace mu::draw;
 using namespace mu::engraving;
 
+static constexpr int MIN_PIXMAP_CACHE_LIMIT_KB = 32 * 1024;
+
+static int s_cacheGeneration = 0;
+
 PaletteCellIconEngine::PaletteCellIconEngine(PaletteCellConstPtr cell, qreal extraMag)
     : QIconEngine(), m_cell(cell), m_extraMag(extraMag)
 {
+    //! NOTE The cached cells of a master palette search don't fit into the default limit
+    static const bool cacheLimitSet = []() {
+        if (QPixmapCache::cacheLimit() < MIN_PIXMAP_CACHE_LIMIT_KB) {
+            QPixmapCache::setCacheLimit(MIN_PIXMAP_CACHE_LIMIT_KB);
+        }
+        return true;
+    }();
+    UNUSED(cacheLimitSet);
+}
+
+void PaletteCellIconEngine::invalidateCache()
+{
+    ++s_cacheGeneration;
 }
 
 QIconEngine* PaletteCellIconEngine::clone() const
@@ -50,17 +69,63 @@ QIconEngine* PaletteCellIconEngine::clone() const
 void PaletteCellIconEngine::paint(QPainter* qp, const QRect& rect, QIcon::Mode mode, QIcon::State state)
 {
     qreal dpi = qp->device()->logicalDpiX();
-    Painter p(qp, "palettecell");
-    p.save();
-    p.setAntialiasing(true);
-    paintCell(p, RectF::fromQRectF(rect), mode == QIcon::Selected, state == QIcon::On, dpi);
-    p.restore();
+    {
+        Painter p(qp, "palettecell");
+        p.save();
+        paintBackground(p, RectF::fromQRectF(rect), mode == QIcon::Selected, state == QIcon::On);
+        p.restore();
+    }
+
+    if (!m_cell || !m_cell->element || rect.isEmpty()) {
+        return;
+    }
+
+    //! NOTE Laying out and drawing the element is much slower than drawing a pixmap,
+    //! so the cell is rendered once per size, resolution and elements color and then taken from the cache
+    const qreal dpr = qp->device()->devicePixelRatioF();
+    const QString key = cacheKey(rect.size(), dpi, dpr);
+
+    QPixmap pixmap;
+    if (!QPixmapCache::find(key, &pixmap)) {
+        pixmap = renderCell(rect.size(), dpi, dpr);
+        QPixmapCache::insert(key, pixmap);
+    }
+
+    qp->drawPixmap(rect.topLeft(), pixmap);
+}
+
+QString PaletteCellIconEngine::cacheKey(const QSize& size, qreal dpi, qreal dpr) const
+{
+    return QString("palettecell:%1:%2:%3:%4x%5:%6:%7:%8:%9:%10:%11:%12")
+           .arg(s_cacheGeneration)
+           .arg(m_cell->id)
+           .arg(reinterpret_cast<quintptr>(m_cell->element.get()))
+           .arg(size.width()).arg(size.height())
+           .arg(dpi).arg(dpr)
+           .arg(m_extraMag * m_cell->mag)
+           .arg(m_cell->xoffset).arg(m_cell->yoffset)
+           .arg(m_cell->drawStaff)
+           .arg(configuration()->elementsColor().rgba());
 }
 
-void PaletteCellIconEngine::paintCell(Painter& painter, const RectF& rect, bool selected, bool current, qreal dpi) const
+QPixmap PaletteCellIconEngine::renderCell(const QSize& size, qreal dpi, qreal dpr) const
 {
-    paintBackground(painter, rect, selected, current);
+    TRACEFUNC;
+
+    QPixmap pixmap(size * dpr);
+    pixmap.setDevicePixelRatio(dpr);
+    pixmap.fill(Qt::transparent);
 
+    QPainter qp(&pixmap);
+    Painter p(&qp, "palettecell");
+    p.setAntialiasing(true);
+    paintCell(p, RectF(0, 0, size.width(), size.height()), dpi);
+
+    return pixmap;
+}
+
+void PaletteCellIconEngine::paintCell(Painter& painter, const RectF& rect, qreal dpi) const
+{
     if (!m_cell) {
         return;
     }
@@ -45,6 +45,9 @@ public:
 
     void paint(QPainter* painter, const QRect& rect, QIcon::Mode mode, QIcon::State state) override;
 
+    //! NOTE Drops the rendered cells, for the changes of the elements content (ex retranslation)
+    static void invalidateCache();
+
     struct PaintContext
     {
         mu::draw::Painter* painter = nullptr;
@@ -55,7 +58,10 @@ public:
     static void paintPaletteElement(void* context, mu::engraving::EngravingItem* element);
 
 private:
-    void paintCell(draw::Painter& painter, const RectF& rect, bool selected, bool current, qreal dpi) const;
+    QString cacheKey(const QSize& size, qreal dpi, qreal dpr) const;
+    QPixmap renderCell(const QSize& size, qreal dpi, qreal dpr) const;
+
+    void paintCell(draw::Painter& painter, const RectF& rect, qreal dpi) const;
     void paintBackground(draw::Painter& painter, const RectF& rect, bool selected, bool current) const;
     void paintActionIcon(draw::Painter& painter, const RectF& rect, mu::engraving::EngravingItem* element) const;
     qreal paintStaff(draw::Painter& painter, const RectF& rect, qreal spatium) const;
@@ -596,12 +596,8 @@ void PaletteProvider::init()
     m_userPaletteModel = new PaletteTreeModel(std::make_shared<PaletteTree>(), this);
     connect(m_userPaletteModel, &PaletteTreeModel::treeChanged, this, &PaletteProvider::notifyAboutUserPaletteChanged);
 
-    m_masterPaletteModel = new PaletteTreeModel(PaletteCreator::newMasterPaletteTree());
-    m_masterPaletteModel->setParent(this);
-
     m_searchFilterModel = new PaletteCellFilterProxyModel(this);
     m_searchFilterModel->setFilterCaseSensitivity(Qt::CaseInsensitive);
-    m_searchFilterModel->setSourceModel(m_masterPaletteModel);
 
     m_visibilityFilterModel = new QSortFilterProxyModel(this);
     m_visibilityFilterModel->setFilterRole(PaletteTreeModel::VisibleRole);
@@ -643,6 +639,10 @@ bool PaletteProvider::isSingleClickToOpenPalette() const
 QAbstractItemModel* PaletteProvider::mainPaletteModel()
 {
     if (m_isSearching) {
+        if (!m_searchFilterModel->sourceModel()) {
+            m_searchFilterModel->setSourceModel(masterPaletteModel());
+        }
+
         m_mainPalette = m_searchFilterModel;
     } else {
         m_mainPalette = m_visibilityFilterModel;
@@ -707,7 +707,7 @@ FilterPaletteTreeModel* PaletteProvider::poolPaletteModel(const QModelIndex& ind
         return nullptr;
     }
 
-    FilterPaletteTreeModel* m = new FilterPaletteTreeModel(filter, m_masterPaletteModel);
+    FilterPaletteTreeModel* m = new FilterPaletteTreeModel(filter, masterPaletteModel());
     QQmlEngine::setObjectOwnership(m, QQmlEngine::JavaScriptOwnership);
     return m;
 }
@@ -738,12 +738,13 @@ QAbstractItemModel* PaletteProvider::availableExtraPalettesModel() const
 
     QStandardItem* root = m->invisibleRootItem();
 
-    const int masterRows = m_masterPaletteModel->rowCount();
+    const PaletteTreeModel* masterModel = masterPaletteModel();
+    const int masterRows = masterModel->rowCount();
     for (int row = 0; row < masterRows; ++row) {
-        const QModelIndex idx = m_masterPaletteModel->index(row, 0);
+        const QModelIndex idx = masterModel->index(row, 0);
         // add everything that cannot be found in user palette
         if (!convertIndex(idx, m_userPaletteModel).isValid()) {
-            const QString name = m_masterPaletteModel->data(idx, Qt::DisplayRole).toString();
+            const QString name = masterModel->data(idx, Qt::DisplayRole).toString();
             QStandardItem* item = new QStandardItem(name);
             item->setData(false, CustomRole);       // this palette is from master palette, hence not custom
             item->setData(QPersistentModelIndex(idx), PaletteIndexRole);
@@ -838,19 +839,14 @@ bool PaletteProvider::resetPalette(const QModelIndex& index)
         return false;
     }
 
-    Q_ASSERT(m_defaultPaletteModel != m_userPaletteModel);
-
-    QAbstractItemModel* resetModel = nullptr;
-    QModelIndex resetIndex;
+    Q_ASSERT(defaultPaletteModel() != m_userPaletteModel);
 
-    if (m_defaultPaletteModel) {
-        resetModel = m_defaultPaletteModel;
-        resetIndex = convertIndex(index, m_defaultPaletteModel);
-    }
+    QAbstractItemModel* resetModel = defaultPaletteModel();
+    QModelIndex resetIndex = convertIndex(index, resetModel);
 
     if (!resetIndex.isValid()) {
-        resetModel = m_masterPaletteModel;
-        resetIndex = convertIndex(index, m_masterPaletteModel);
+        resetModel = masterPaletteModel();
+        resetIndex = convertIndex(index, resetModel);
     }
 
     const QModelIndex userPaletteIndex = convertProxyIndex(index, m_userPaletteModel);
@@ -977,6 +973,24 @@ void PaletteProvider::setDefaultPaletteTree(PaletteTreePtr tree)
     }
 }
 
+PaletteTreeModel* PaletteProvider::masterPaletteModel() const
+{
+    if (!m_masterPaletteModel) {
+        m_masterPaletteModel = new PaletteTreeModel(PaletteCreator::newMasterPaletteTree(), const_cast<PaletteProvider*>(this));
+    }
+
+    return m_masterPaletteModel;
+}
+
+PaletteTreeModel* PaletteProvider::defaultPaletteModel() const
+{
+    if (!m_defaultPaletteModel) {
+        m_defaultPaletteModel = new PaletteTreeModel(PaletteCreator::newDefaultPaletteTree(), const_cast<PaletteProvider*>(this));
+    }
+
+    return m_defaultPaletteModel;
+}
+
 mu::async::Channel<ElementPtr> PaletteProvider::addCustomItemRequested() const
 {
     return m_addCustomItemRequested;
@@ -254,8 +254,14 @@ public:
     void retranslate()
     {
         m_userPaletteModel->retranslate();
-        m_masterPaletteModel->retranslate();
-        m_defaultPaletteModel->retranslate();
+
+        if (m_masterPaletteModel) {
+            m_masterPaletteModel->retranslate();
+        }
+
+        if (m_defaultPaletteModel) {
+            m_defaultPaletteModel->retranslate();
+        }
     }
 
     bool isSinglePalette() const;
@@ -289,9 +295,14 @@ private:
 
     QString getPaletteFilename(bool open, const QString& name = "") const;
 
-    PaletteTreeModel* m_userPaletteModel;
-    PaletteTreeModel* m_masterPaletteModel;
-    PaletteTreeModel* m_defaultPaletteModel; // palette used by "Reset palette" action
+    //! NOTE The master and the default palettes are only needed for the search, the "More" popup
+    //! and the "Reset palette" action, so their elements are created on the first use
+    PaletteTreeModel* masterPaletteModel() const;
+    PaletteTreeModel* defaultPaletteModel() const;
+
+    PaletteTreeModel* m_userPaletteModel = nullptr;
+    mutable PaletteTreeModel* m_masterPaletteModel = nullptr;
+    mutable PaletteTreeModel* m_defaultPaletteModel = nullptr; // palette used by "Reset palette" action
 
     async::Notification m_userPaletteChanged;
 
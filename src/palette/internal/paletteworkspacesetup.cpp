@@ -72,8 +72,6 @@ void PaletteWorkspaceSetup::setup()
         return;
     }
 
-    paletteProvider()->setDefaultPaletteTree(PaletteCreator::newDefaultPaletteTree());
-
     paletteProvider()->userPaletteTreeChanged().onNotify(this, [this]() {
         PaletteTreePtr tree = paletteProvider()->userPaletteTree();
 
@@ -671,6 +671,7 @@ void PlaybackController::resetCurrentSequence()
     playback()->audioOutput()->outputParamsChanged().resetOnReceive(this);
     playback()->audioOutput()->masterOutputParamsChanged().resetOnReceive(this);
     playback()->audioOutput()->clearMasterOutputParams();
+    playback()->audioOutput()->auxOutputParamsChanged().resetOnReceive(this);
 
     setCurrentPlaybackTime(0);
     setCurrentPlaybackStatus(PlaybackStatus::Stopped);
@@ -884,6 +885,10 @@ void PlaybackController::setupNewCurrentSequence(const TrackSequenceId sequenceI
     audio::AudioOutputParams masterOutputParams = audioSettings()->masterAudioOutputParams();
     playback()->audioOutput()->setMasterOutputParams(masterOutputParams);
 
+    for (aux_channel_idx_t idx = 0; idx < AUX_CHANNEL_NUM; ++idx) {
+        playback()->audioOutput()->setAuxOutputParams(idx, audioSettings()->auxOutputParams(idx));
+    }
+
     subscribeOnAudioParamsChanges();
     setupSequenceTracks();
     setupSequencePlayer();
@@ -897,6 +902,11 @@ void PlaybackController::subscribeOnAudioParamsChanges()
         audioSettings()->setMasterAudioOutputParams(params);
     });
 
+    playback()->audioOutput()->auxOutputParamsChanged().onReceive(this, [this](const aux_channel_idx_t index,
+                                                                               const audio::AudioOutputParams& params) {
+        audioSettings()->setAuxOutputParams(index, params);
+    });
+
     playback()->tracks()->inputParamsChanged().onReceive(this,
                                                          [this](const TrackSequenceId sequenceId,
                                                                 const TrackId trackId,
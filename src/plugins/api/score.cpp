@@ -21,8 +21,12 @@
  */
 
 #include "score.h"
+
+#include <QMetaProperty>
+
 #include "cursor.h"
 #include "elements.h"
+#include "scoresnapshot.h"
 
 #include "libmscore/factory.h"
 #include "libmscore/instrtemplate.h"
@@ -30,6 +34,9 @@
 #include "libmscore/score.h"
 #include "libmscore/segment.h"
 #include "libmscore/text.h"
+#include "libmscore/undo.h"
+
+#include "log.h"
 
 using namespace mu::engraving;
 
@@ -246,4 +253,149 @@ void Score::endCmd(bool rollback)
 
     notation()->notationChanged().notify();
 }
+
+//---------------------------------------------------------
+//   Score::findElements
+//---------------------------------------------------------
+
+static void collectElement(void* data, mu::engraving::EngravingItem* e)
+{
+    static_cast<std::vector<mu::engraving::EngravingItem*>*>(data)->push_back(e);
+}
+
+QVariantList Score::findElements(int type, bool selectionOnly)
+{
+    const ElementType elementType = ElementType(type);
+    std::vector<mu::engraving::EngravingItem*> items;
+
+    if (selectionOnly) {
+        items = score()->selection().elements(elementType);
+    } else {
+        std::vector<mu::engraving::EngravingItem*> all;
+        score()->scanElements(&all, collectElement);
+        for (mu::engraving::EngravingItem* e : all) {
+            if (e->type() == elementType) {
+                items.push_back(e);
+            }
+        }
+    }
+
+    QVariantList result;
+    result.reserve(static_cast<int>(items.size()));
+    for (mu::engraving::EngravingItem* e : items) {
+        result.push_back(QVariant::fromValue(wrap(e)));
+    }
+
+    return result;
+}
+
+//---------------------------------------------------------
+//   Score::setElementsProperty
+//---------------------------------------------------------
+
+int Score::setElementsProperty(const QVariantList& elements, const QString& name, const QVariant& value)
+{
+    const QByteArray propertyName = name.toLatin1();
+    // the elements usually share a few wrapper types, so look the property up once per type
+    QHash<const QMetaObject*, int> propertyIndexes;
+
+    const bool started = startBatchCmd();
+
+    int count = 0;
+    for (const QVariant& var : elements) {
+        ScoreElement* wrapped = var.value<ScoreElement*>();
+        if (!wrapped || !wrapped->element()) {
+            continue;
+        }
+
+        const QMetaObject* meta = wrapped->metaObject();
+        auto it = propertyIndexes.find(meta);
+        if (it == propertyIndexes.end()) {
+            it = propertyIndexes.insert(meta, meta->indexOfProperty(propertyName.constData()));
+        }
+
+        if (it.value() < 0) {
+            continue;
+        }
+
+        if (meta->property(it.value()).write(wrapped, value)) {
+            ++count;
+        }
+    }
+
+    endBatchCmd(started);
+
+    return count;
+}
+
+//---------------------------------------------------------
+//   Score::addElements
+//---------------------------------------------------------
+
+int Score::addElements(const QVariantList& parents, const QVariantList& elements)
+{
+    if (parents.size() != elements.size()) {
+        LOGW() << "the number of parents and elements differ";
+        return 0;
+    }
+
+    const bool started = startBatchCmd();
+
+    int count = 0;
+    for (int i = 0; i < elements.size(); ++i) {
+        EngravingItem* wrapped = elements.at(i).value<EngravingItem*>();
+        if (!wrapped || wrapped->ownership() == Ownership::SCORE) {
+            continue;
+        }
+
+        QObject* parent = parents.at(i).value<QObject*>();
+        if (Note* note = qobject_cast<Note*>(parent)) {
+            note->add(wrapped);
+        } else if (Chord* chord = qobject_cast<Chord*>(parent)) {
+            chord->add(wrapped);
+        } else {
+            continue;
+        }
+
+        if (wrapped->ownership() == Ownership::SCORE) {
+            ++count;
+        }
+    }
+
+    endBatchCmd(started);
+
+    return count;
+}
+
+//---------------------------------------------------------
+//   Score::snapshot
+//---------------------------------------------------------
+
+QVariantMap Score::snapshot() const
+{
+    return makeScoreSnapshot(score());
+}
+
+//---------------------------------------------------------
+//   Score::startBatchCmd
+//    starts a command for a batch operation unless the plugin
+//    has already started one, returns whether it did
+//---------------------------------------------------------
+
+bool Score::startBatchCmd()
+{
+    if (score()->undoStack()->active()) {
+        return false;
+    }
+
+    startCmd();
+    return true;
+}
+
+void Score::endBatchCmd(bool started)
+{
+    if (started) {
+        endCmd();
+    }
+}
 } // namespace mu::plugins::api
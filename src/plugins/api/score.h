@@ -204,6 +204,60 @@ public:
 
     Q_INVOKABLE QString extractLyrics() { return score()->extractLyrics(); }
 
+    /**
+     * Returns all the elements of the given \p type, collected
+     * in a single pass over the score. Much faster than walking
+     * the whole score with a Cursor.
+     * \param type Element type, one of the \ref Element values.
+     * \param selectionOnly If true, only the selected elements
+     * are returned.
+     * \since MuseScore 4.0
+     */
+    Q_INVOKABLE QVariantList findElements(int type, bool selectionOnly = false);
+    /**
+     * Sets the property \p name to \p value on all the given \p elements.
+     * If no command is started, the changes are made in a single
+     * undoable command followed by a single layout.
+     * \param elements List of elements, e.g. returned by findElements().
+     * \param name Name of the property as used by the element wrappers,
+     * e.g. "color" or "visible".
+     * \returns The number of elements the property has been written to,
+     * elements without the property or with a read-only one are not counted.
+     * \since MuseScore 4.0
+     */
+    Q_INVOKABLE int setElementsProperty(const QVariantList& elements, const QString& name, const QVariant& value);
+    /**
+     * Adds each element of \p elements to the Note or Chord at
+     * the same position in \p parents. If no command is started,
+     * all the elements are added in a single undoable command
+     * followed by a single layout.
+     * \returns The number of elements added.
+     * \since MuseScore 4.0
+     */
+    Q_INVOKABLE int addElements(const QVariantList& parents, const QVariantList& elements);
+
+    /**
+     * Returns a plain data copy of the measures, chords, rests and
+     * notes of the score. The copy holds no references into the score,
+     * so read-only plugins (analysis, checkers, exporters) can pass it
+     * to a WorkerScript and do the long work there, off the UI thread,
+     * sending the results back with WorkerScript messages:
+     * \code
+     * WorkerScript {
+     *     id: worker
+     *     source: "analysis.mjs"
+     *     onMessage: function(result) { console.log(result.text) }
+     * }
+     * onRun: worker.sendMessage({ score: curScore.snapshot() })
+     * \endcode
+     * Every chord or rest has the properties \p tick, \p ticks,
+     * \p track, \p staff, \p voice, \p isRest and \p notes; every
+     * note has \p pitch, \p tpc, \p tieBack and \p tieFor.
+     * Ticks are in units of \p division per quarter note.
+     * \since MuseScore 4.0
+     */
+    Q_INVOKABLE QVariantMap snapshot() const;
+
 //      //@ ??
 //      Q_INVOKABLE void updateRepeatList(bool expandRepeats) { score()->updateRepeatList(); } // TODO: needed?
 
@@ -255,6 +309,9 @@ public:
     /// \endcond
 
 private:
+    bool startBatchCmd();
+    void endBatchCmd(bool started);
+
     mu::notation::INotationPtr notation() const;
     mu::notation::INotationUndoStackPtr undoStack() const;
 };
@@ -0,0 +1,105 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "scoresnapshot.h"
+
+#include <QVariantList>
+
+#include "libmscore/chord.h"
+#include "libmscore/chordrest.h"
+#include "libmscore/measure.h"
+#include "libmscore/note.h"
+#include "libmscore/score.h"
+#include "libmscore/segment.h"
+
+using namespace mu::engraving;
+
+namespace mu::plugins::api {
+static QVariantList snapshotMeasures(const mu::engraving::Score* score)
+{
+    QVariantList measures;
+
+    for (const Measure* m = score->firstMeasure(); m; m = m->nextMeasure()) {
+        QVariantMap measure;
+        measure["tick"] = m->tick().ticks();
+        measure["ticks"] = m->ticks().ticks();
+        measure["timesigNumerator"] = m->timesig().numerator();
+        measure["timesigDenominator"] = m->timesig().denominator();
+        measures.push_back(measure);
+    }
+
+    return measures;
+}
+
+static QVariantMap snapshotChordRest(const ChordRest* cr)
+{
+    QVariantMap chordRest;
+    chordRest["tick"] = cr->tick().ticks();
+    chordRest["ticks"] = cr->actualTicks().ticks();
+    chordRest["track"] = static_cast<int>(cr->track());
+    chordRest["staff"] = static_cast<int>(cr->staffIdx());
+    chordRest["voice"] = static_cast<int>(cr->voice());
+    chordRest["isRest"] = cr->isRest();
+
+    QVariantList notes;
+    if (cr->isChord()) {
+        for (const Note* n : toChord(cr)->notes()) {
+            QVariantMap note;
+            note["pitch"] = n->pitch();
+            note["tpc"] = n->tpc();
+            note["tieBack"] = n->tieBack() != nullptr;
+            note["tieFor"] = n->tieFor() != nullptr;
+            notes.push_back(note);
+        }
+    }
+    chordRest["notes"] = notes;
+
+    return chordRest;
+}
+
+QVariantMap makeScoreSnapshot(const mu::engraving::Score* score)
+{
+    QVariantMap snapshot;
+    if (!score) {
+        return snapshot;
+    }
+
+    snapshot["division"] = Constants::division;
+    snapshot["nstaves"] = static_cast<int>(score->nstaves());
+    snapshot["ntracks"] = static_cast<int>(score->ntracks());
+    snapshot["measures"] = snapshotMeasures(score);
+
+    QVariantList chordRests;
+    const track_idx_t tracks = score->ntracks();
+    for (const Segment* s = score->firstSegment(SegmentType::ChordRest); s; s = s->next1(SegmentType::ChordRest)) {
+        for (track_idx_t track = 0; track < tracks; ++track) {
+            const EngravingItem* e = s->element(track);
+            if (e && e->isChordRest()) {
+                chordRests.push_back(snapshotChordRest(toChordRest(e)));
+            }
+        }
+    }
+    snapshot["chordRests"] = chordRests;
+
+    return snapshot;
+}
+}
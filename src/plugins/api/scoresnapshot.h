@@ -0,0 +1,44 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2022 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PLUGIN_API_SCORESNAPSHOT_H__
+#define __PLUGIN_API_SCORESNAPSHOT_H__
+
+#include <QVariantMap>
+
+namespace mu::engraving {
+class Score;
+}
+
+namespace mu::plugins::api {
+//---------------------------------------------------------
+//   makeScoreSnapshot
+//    plain data copy of the musical content of a score;
+//    it holds no pointers into the score, so it can be sent
+//    to a WorkerScript and read there in its own JS engine
+//    while the score keeps being edited
+//---------------------------------------------------------
+
+extern QVariantMap makeScoreSnapshot(const mu::engraving::Score* score);
+}
+
+#endif
@@ -25,6 +25,13 @@
 
 #include "plugins/view/pluginview.h"
 #include "plugins/api/qmlplugin.h"
+#include "plugins/api/elements.h"
+#include "plugins/api/score.h"
+
+#include "engraving/compat/scoreaccess.h"
+#include "engraving/libmscore/factory.h"
+#include "engraving/libmscore/masterscore.h"
+#include "engraving/libmscore/stafftext.h"
 
 using namespace mu;
 using namespace mu::plugins;
@@ -46,3 +53,44 @@ TEST_F(Plugins_ApiTests, Enums)
 
     EXPECT_EQ(view.qmlPlugin()->property("errorCount").toInt(), 0);
 }
+
+TEST_F(Plugins_ApiTests, SetElementsProperty)
+{
+    // [GIVEN] Two texts which are not added to the score, so they are written without the undo
+    engraving::MasterScore* score = engraving::compat::ScoreAccess::createMasterScoreWithBaseStyle();
+    api::Score apiScore(score);
+
+    api::EngravingItem* text1 = api::wrap(engraving::Factory::createStaffText(score->dummy()->segment()), api::Ownership::PLUGIN);
+    api::EngravingItem* text2 = api::wrap(engraving::Factory::createStaffText(score->dummy()->segment()), api::Ownership::PLUGIN);
+
+    QVariantList elements = { QVariant::fromValue(text1), QVariant(), QVariant::fromValue(text2) };
+
+    // [GIVEN] A command is started, so setElementsProperty doesn't start its own one
+    score->startCmd();
+
+    // [WHEN] Set a writable property
+    int count = apiScore.setElementsProperty(elements, "visible", false);
+
+    // [THEN] Both texts are written, the empty item is skipped
+    EXPECT_EQ(count, 2);
+    EXPECT_FALSE(text1->element()->visible());
+    EXPECT_FALSE(text2->element()->visible());
+
+    // [WHEN] Set a property which the texts have, but which is read only
+    count = apiScore.setElementsProperty(elements, "type", 0);
+
+    // [THEN] Nothing is counted, only the successful writes are
+    EXPECT_EQ(count, 0);
+
+    // [WHEN] Set a property which the texts don't have
+    count = apiScore.setElementsProperty(elements, "noSuchProperty", 1);
+
+    // [THEN] Nothing is counted
+    EXPECT_EQ(count, 0);
+
+    score->endCmd();
+
+    delete text1;
+    delete text2;
+    delete score;
+}
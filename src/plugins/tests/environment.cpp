@@ -24,8 +24,13 @@
 
 #include <QQmlEngine>
 
+#include "draw/drawmodule.h"
+#include "fonts/fontsmodule.h"
+#include "engraving/engravingmodule.h"
 #include "plugins/pluginsmodule.h"
 
+#include "engraving/libmscore/mscore.h"
+
 #include "modularity/ioc.h"
 #include "mocks/uienginemock.h"
 
@@ -33,6 +38,9 @@
 
 static mu::testing::SuiteEnvironment plugins_env(
 {
+    new mu::draw::DrawModule(),
+    new mu::fonts::FontsModule(), // needs for libmscore
+    new mu::engraving::EngravingModule(),
     new mu::plugins::PluginsModule()
 },
     []() {
@@ -53,4 +61,8 @@ static mu::testing::SuiteEnvironment plugins_env(
             LOGE() << "error: " << e.toString() << "\n";
         }
     });
+},
+    []() {
+    mu::engraving::MScore::testMode = true;
+    mu::engraving::MScore::noGui = true;
 });
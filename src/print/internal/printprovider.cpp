@@ -38,6 +38,7 @@ Ret PrintProvider::printNotation(INotationPtr notation)
     }
 
     auto painting = notation->painting();
+    painting->prepareView(RectF(), /*isPrinting*/ true);
 
     SizeF pageSizeInch = painting->pageSizeInch();
     QPrinter printerDev(QPrinter::HighResolution);
@@ -63,14 +64,37 @@ Ret PrintProvider::printNotation(INotationPtr notation)
 
     Painter painter(&printerDev, "print");
 
+    //! NOTE The pages are painted one by one, each of them is handed to the printer before the next one is painted.
+    //! No events are processed in between: the timers (autosave, the refinement of a draft layout) could change the score
+    //! NOTE 0 for both pages means the whole document (all pages or the current page)
+    const bool allPages = printerDev.fromPage() == 0 && printerDev.toPage() == 0;
+    const int fromPage = allPages ? 0 : printerDev.fromPage() - 1;
+    const int toPage = allPages ? painting->pageCount() - 1 : printerDev.toPage() - 1;
+    const int copyCount = printerDev.copyCount();
+    int printedPages = 0;
+
     INotationPainting::Options opt;
-    opt.fromPage = printerDev.fromPage() - 1;
-    opt.toPage = printerDev.toPage() - 1;
-    opt.copyCount = printerDev.copyCount();
+    opt.copyCount = 1;
     opt.deviceDpi = printerDev.logicalDpiX();
-    opt.onNewPage = [&printerDev]() { printerDev.newPage(); };
 
-    painting->paintPrint(&painter, opt);
+    for (int copy = 0; copy < copyCount; ++copy) {
+        for (int page = fromPage; page <= toPage; ++page) {
+            if (printedPages > 0) {
+                printerDev.newPage();
+            }
+
+            opt.fromPage = page;
+            opt.toPage = page;
+            painting->paintPrint(&painter, opt);
+
+            ++printedPages;
+
+            if (printerDev.printerState() == QPrinter::Aborted) {
+                painter.endDraw();
+                return mu::make_ret(Ret::Code::Cancel);
+            }
+        }
+    }
 
     painter.endDraw();
 
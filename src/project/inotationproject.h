@@ -26,6 +26,8 @@
 
 #include "io/path.h"
 #include "types/ret.h"
+#include "types/retval.h"
+#include "types/bytearray.h"
 
 #include "projecttypes.h"
 #include "notation/imasternotation.h"
@@ -64,6 +66,9 @@ public:
     virtual Ret save(const io::path_t& path = io::path_t(), SaveMode saveMode = SaveMode::Save) = 0;
     virtual Ret writeToDevice(QIODevice* device) = 0;
 
+    //! NOTE Writes the project as it would be saved to the path, but into an uncompressed container in memory
+    virtual RetVal<ByteArray> writeSnapshot(const io::path_t& path) = 0;
+
     virtual ProjectMeta metaInfo() const = 0;
     virtual void setMetaInfo(const ProjectMeta& meta, bool undoable = false) = 0;
 
@@ -47,7 +47,8 @@ public:
         UNIT_TYPE,
         PAGE_NUMBER,
         TRANSPARENT_BACKGROUND,
-        BEATS_COLORS
+        BEATS_COLORS,
+        REUSE_GLYPHS
     };
 
     using Options = QMap<OptionKey, Val>;
@@ -58,6 +59,38 @@ public:
     virtual Ret write(notation::INotationPtr notation, QIODevice& device, const Options& options = Options()) = 0;
     virtual Ret writeList(const notation::INotationPtrList& notations, QIODevice& device, const Options& options = Options()) = 0;
 
+    //! NOTE Writes each page to its device, for the writers of the PER_PAGE unit type.
+    //! The writers may paint the pages concurrently
+    virtual Ret writePages(notation::INotationPtr notation, const std::vector<QIODevice*>& devices, const Options& options = Options())
+    {
+        Options pageOptions = options;
+        for (size_t i = 0; i < devices.size(); ++i) {
+            pageOptions[OptionKey::PAGE_NUMBER] = Val(static_cast<int>(i));
+            Ret ret = write(notation, *devices[i], pageOptions);
+            if (!ret) {
+                return ret;
+            }
+        }
+
+        return make_ok();
+    }
+
+    using WriterDevices = std::vector<std::pair<std::shared_ptr<INotationWriter>, QIODevice*> >;
+
+    //! NOTE Writes the notation with each writer into its device, for several formats of the same notation.
+    //! The audio writers render the notation once for all their formats
+    virtual Ret writeFormats(notation::INotationPtr notation, const WriterDevices& writers, const Options& options = Options())
+    {
+        for (const auto& [writer, device] : writers) {
+            Ret ret = writer->write(notation, *device, options);
+            if (!ret) {
+                return ret;
+            }
+        }
+
+        return make_ok();
+    }
+
     virtual bool supportsProgressNotifications() const { return false; }
     virtual framework::Progress progress() const { return framework::Progress(); }
 
@@ -29,6 +29,8 @@
 #include "global/deprecated/xmlreader.h"
 #include "engraving/infrastructure/mscreader.h"
 
+#include "projectmetacache.h"
+
 #include "log.h"
 
 using namespace mu::io;
@@ -46,6 +48,11 @@ mu::RetVal<ProjectMeta> MscMetaReader::readMeta(const io::path_t& filePath) cons
         return meta;
     }
 
+    ProjectMetaCache cache;
+    if (cache.load(filePath, meta.val)) {
+        return meta;
+    }
+
     MscReader::Params params;
     params.filePath = filePath.toQString();
     params.mode = mscIoModeBySuffix(io::suffix(filePath));
@@ -59,8 +66,8 @@ mu::RetVal<ProjectMeta> MscMetaReader::readMeta(const io::path_t& filePath) cons
     }
 
     // Read score meta
-    ByteArray scoreData = msczReader.readScoreFile();
-    framework::XmlReader xmlReader(scoreData.toQByteArray());
+    ByteArray scoreData = readScoreHead(msczReader);
+    framework::XmlReader xmlReader(scoreData.toQByteArrayNoCopy());
     doReadMeta(xmlReader, meta.val);
 
     // Read thumbnail
@@ -73,9 +80,45 @@ mu::RetVal<ProjectMeta> MscMetaReader::readMeta(const io::path_t& filePath) cons
 
     meta.val.filePath = filePath;
 
+    cache.store(filePath, meta.val, thumbnailData);
+
     return meta;
 }
 
+//! NOTE All the meta is before the first measure: the meta tags and the parts precede the staves,
+//! and the title frame precedes the measures of the first staff. So the score file is inflated
+//! chunk by chunk only until the first measure, the reader stops at the end of the cut data
+ByteArray MscMetaReader::readScoreHead(const MscReader& reader) const
+{
+    static const std::string_view FIRST_MEASURE("<Measure");
+
+    ByteArray head;
+    size_t searchPos = 0;
+    reader.readScoreFile([&head, &searchPos](const uint8_t* data, size_t len) {
+        head.push_back(data, len);
+
+        std::string_view str(head.constChar(), head.size());
+        while (true) {
+            size_t pos = str.find(FIRST_MEASURE, searchPos);
+            if (pos == std::string_view::npos || pos + FIRST_MEASURE.size() >= str.size()) {
+                // the tag may be split between the chunks
+                searchPos = str.size() > FIRST_MEASURE.size() ? str.size() - FIRST_MEASURE.size() : 0;
+                return true;
+            }
+
+            char next = str.at(pos + FIRST_MEASURE.size());
+            if (next == '>' || next == ' ') {
+                head.resize(pos);
+                return false;
+            }
+
+            searchPos = pos + 1;
+        }
+    });
+
+    return head;
+}
+
 MscMetaReader::RawMeta MscMetaReader::doReadBox(framework::XmlReader& xmlReader) const
 {
     RawMeta meta;
@@ -31,6 +31,10 @@ namespace mu::framework {
 class XmlReader;
 }
 
+namespace mu::engraving {
+class MscReader;
+}
+
 namespace mu::project {
 class MscMetaReader : public IMscMetaReader
 {
@@ -67,6 +71,8 @@ private:
         size_t partsCount = 0;
     };
 
+    ByteArray readScoreHead(const engraving::MscReader& reader) const;
+
     void doReadMeta(framework::XmlReader& xmlReader, ProjectMeta& meta) const;
     RawMeta doReadBox(framework::XmlReader& xmlReader) const;
     RawMeta doReadRawMeta(framework::XmlReader& xmlReader) const;
@@ -26,6 +26,7 @@
 #include <QFile>
 
 #include "io/buffer.h"
+#include "io/fileinfo.h"
 
 #include "engraving/engravingproject.h"
 #include "engraving/compat/scoreaccess.h"
@@ -38,6 +39,7 @@
 #include "notation/notationerrors.h"
 #include "projectaudiosettings.h"
 #include "projectfileinfoprovider.h"
+#include "projectsnapshotcache.h"
 
 #include "libmscore/undo.h"
 
@@ -50,6 +52,10 @@ using namespace mu::engraving;
 using namespace mu::notation;
 using namespace mu::project;
 
+//! NOTE Number of pages laid out before an opened score is shown,
+//! the rest of the score is laid out afterwards, see Notation::continueLayout
+static constexpr size_t FIRST_LAYOUT_PAGES = 2;
+
 static const QString WORK_TITLE_TAG("workTitle");
 static const QString WORK_NUMBER_TAG("workNumber");
 static const QString SUBTITLE_TAG("subtitle");
@@ -156,15 +162,49 @@ mu::Ret NotationProject::load(const io::path_t& path, const io::path_t& stylePat
         return make_ret(Ret::Code::InternalError);
     }
 
-    MscReader reader(params);
-    if (!reader.open()) {
-        return make_ret(engraving::Err::FileOpenError);
+    //! NOTE A reopened .mscz file is read from its uncompressed snapshot, if there is one for its current content
+    ProjectSnapshotCache snapshots;
+    std::string snapshotKey;
+    bool fromSnapshot = false;
+    if (params.mode == MscIoMode::Zip && configuration()->isSnapshotCacheEnabled()) {
+        snapshotKey = snapshots.snapshotKey(path);
+        fromSnapshot = snapshots.hasSnapshot(snapshotKey);
     }
 
-    Ret ret = doLoad(reader, stylePath, forceMode);
-    if (!ret) {
-        LOGE() << "failed load, err: " << ret.toString();
-        return ret;
+    Ret ret = make_ok();
+    if (fromSnapshot) {
+        MscReader::Params snapshotParams = params;
+        snapshotParams.filePath = snapshots.snapshotPath(snapshotKey);
+        snapshotParams.mainFileName = FileInfo(path).completeBaseName() + u".mscx";
+
+        MscReader reader(snapshotParams);
+        ret = reader.open() ? doLoad(reader, stylePath, forceMode) : make_ret(engraving::Err::FileOpenError);
+        if (!ret) {
+            LOGW() << "failed load snapshot, err: " << ret.toString() << ", load the file";
+            fileSystem()->remove(snapshotParams.filePath);
+            fromSnapshot = false;
+            setupProject();
+        }
+    }
+
+    if (!fromSnapshot) {
+        MscReader reader(params);
+        if (!reader.open()) {
+            return make_ret(engraving::Err::FileOpenError);
+        }
+
+        ret = doLoad(reader, stylePath, forceMode);
+        if (!ret) {
+            LOGE() << "failed load, err: " << ret.toString();
+            return ret;
+        }
+
+        if (!snapshotKey.empty()) {
+            Ret snapshotRet = snapshots.storeSnapshot(snapshotKey, path);
+            if (!snapshotRet) {
+                LOGW() << "failed store snapshot, err: " << snapshotRet.toString();
+            }
+        }
     }
 
     bool treatAsImported = m_masterNotation->masterScore()->mscVersion() < 400;
@@ -220,6 +260,9 @@ mu::Ret NotationProject::doLoad(engraving::MscReader& reader, const io::path_t&
 
     masterScore->lockUpdates(false);
     masterScore->setLayoutAll();
+    if (application()->runMode() == framework::IApplication::RunMode::Editor) {
+        masterScore->setLayoutPageLimit(FIRST_LAYOUT_PAGES);
+    }
     masterScore->update();
 
     // Load other stuff from the project file
@@ -465,7 +508,7 @@ mu::Ret NotationProject::save(const io::path_t& path, SaveMode saveMode)
             suffix = engraving::MSCX;
         }
 
-        return saveScore(path, suffix);
+        return saveScore(path, suffix, IProjectAutoSaver::AUTOSAVE_COMPRESSION_LEVEL);
     }
 
     return make_ret(notation::Err::UnknownError);
@@ -500,7 +543,32 @@ mu::Ret NotationProject::writeToDevice(QIODevice* device)
     return ret;
 }
 
-mu::Ret NotationProject::saveScore(const io::path_t& path, const std::string& fileSuffix)
+mu::RetVal<ByteArray> NotationProject::writeSnapshot(const io::path_t& path)
+{
+    TRACEFUNC;
+
+    Buffer buf;
+    buf.open(IODevice::OpenMode::WriteOnly);
+
+    MscWriter::Params params;
+    params.device = &buf;
+    params.filePath = engraving::containerPath(path);
+    params.mainFileName = engraving::mainFileName(path).toString();
+    params.mode = MscIoMode::Zip;
+    params.compressed = false;
+
+    MscWriter msczWriter(params);
+    Ret ret = writeProject(msczWriter, false);
+    msczWriter.close();
+
+    if (!ret) {
+        return RetVal<ByteArray>(ret);
+    }
+
+    return RetVal<ByteArray>::make_ok(buf.data());
+}
+
+mu::Ret NotationProject::saveScore(const io::path_t& path, const std::string& fileSuffix, int compressionLevel)
 {
     if (!isMuseScoreFile(fileSuffix) && !fileSuffix.empty()) {
         return exportProject(path, fileSuffix);
@@ -508,10 +576,10 @@ mu::Ret NotationProject::saveScore(const io::path_t& path, const std::string& fi
 
     MscIoMode ioMode = mscIoModeBySuffix(fileSuffix);
 
-    return doSave(path, true, ioMode);
+    return doSave(path, true, ioMode, compressionLevel);
 }
 
-mu::Ret NotationProject::doSave(const io::path_t& path, bool generateBackup, engraving::MscIoMode ioMode)
+mu::Ret NotationProject::doSave(const io::path_t& path, bool generateBackup, engraving::MscIoMode ioMode, int compressionLevel)
 {
     QString targetContainerPath = engraving::containerPath(path).toQString();
     io::path_t targetMainFilePath = engraving::mainFilePath(path);
@@ -541,6 +609,10 @@ mu::Ret NotationProject::doSave(const io::path_t& path, bool generateBackup, eng
         params.filePath = savePath;
         params.mainFileName = targetMainFileName.toQString();
         params.mode = ioMode;
+        if (ioMode == MscIoMode::Zip) {
+            params.previousFilePath = targetContainerPath;
+            params.compressionLevel = compressionLevel;
+        }
         IF_ASSERT_FAILED(params.mode != MscIoMode::Unknown) {
             return make_ret(Ret::Code::InternalError);
         }
@@ -27,6 +27,7 @@
 #include "async/asyncable.h"
 
 #include "modularity/ioc.h"
+#include "iapplication.h"
 #include "io/ifilesystem.h"
 #include "iprojectconfiguration.h"
 #include "inotationreadersregister.h"
@@ -53,6 +54,7 @@ class NotationProject : public INotationProject, public async::Asyncable
     INJECT(project, INotationReadersRegister, readers)
     INJECT(project, INotationWritersRegister, writers)
     INJECT(project, IProjectMigrator, migrator)
+    INJECT(project, framework::IApplication, application)
 
 public:
     ~NotationProject() override;
@@ -83,6 +85,7 @@ public:
 
     Ret save(const io::path_t& path = io::path_t(), SaveMode saveMode = SaveMode::Save) override;
     Ret writeToDevice(QIODevice* device) override;
+    RetVal<ByteArray> writeSnapshot(const io::path_t& path) override;
 
     ProjectMeta metaInfo() const override;
     void setMetaInfo(const ProjectMeta& meta, bool undoable = false) override;
@@ -98,10 +101,10 @@ private:
     Ret doLoad(engraving::MscReader& reader, const io::path_t& stylePath, bool forceMode);
     Ret doImport(const io::path_t& path, const io::path_t& stylePath, bool forceMode);
 
-    Ret saveScore(const io::path_t& path, const std::string& fileSuffix);
+    Ret saveScore(const io::path_t& path, const std::string& fileSuffix, int compressionLevel = -1);
     Ret saveSelectionOnScore(const io::path_t& path = io::path_t());
     Ret exportProject(const io::path_t& path, const std::string& suffix);
-    Ret doSave(const io::path_t& path, bool generateBackup, engraving::MscIoMode ioMode);
+    Ret doSave(const io::path_t& path, bool generateBackup, engraving::MscIoMode ioMode, int compressionLevel);
     Ret makeCurrentFileAsBackup();
     Ret writeProject(engraving::MscWriter& msczWriter, bool onlySelection);
 
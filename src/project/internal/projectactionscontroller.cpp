@@ -706,6 +706,11 @@ ProjectActionsController::AudioFile ProjectActionsController::exportMp3(const IN
     return audio;
 }
 
+Progress ProjectActionsController::uploadProgress() const
+{
+    return m_uploadProgress;
+}
+
 void ProjectActionsController::showUploadProgressDialog()
 {
     if (interactive()->isOpened(UPLOAD_PROGRESS_URI).val) {
@@ -753,10 +758,8 @@ void ProjectActionsController::uploadProject(const CloudProjectInfo& info, const
         LOGD() << "Uploading project started";
     });
 
-    m_uploadingProjectProgress->progressChanged.onReceive(this, [](int64_t current, int64_t total, const std::string&) {
-        if (total > 0) {
-            LOGD() << "Uploading project progress: " << current << " / " << total << " bytes";
-        }
+    m_uploadingProjectProgress->progressChanged.onReceive(this, [this](int64_t current, int64_t total, const std::string& message) {
+        m_uploadProgress.progressChanged.send(current, total, message);
     });
 
     m_uploadingProjectProgress->finished.onReceive(this, [this, project, projectData, audio, openEditUrl, publishMode,
@@ -803,10 +806,8 @@ void ProjectActionsController::uploadAudio(const AudioFile& audio, const QUrl& s
         LOGD() << "Uploading audio started";
     });
 
-    m_uploadingAudioProgress->progressChanged.onReceive(this, [](int64_t current, int64_t total, const std::string&) {
-        if (total > 0) {
-            LOGD() << "Uploading audio progress: " << current << " / " << total << " bytes";
-        }
+    m_uploadingAudioProgress->progressChanged.onReceive(this, [this](int64_t current, int64_t total, const std::string& message) {
+        m_uploadProgress.progressChanged.send(current, total, message);
     });
 
     m_uploadingAudioProgress->finished.onReceive(this, [this, audio, urlToOpen, isFirstSave](const ProgressResult& res) {
@@ -81,6 +81,8 @@ public:
     bool isAnyProjectOpened() const override;
     bool saveProject(const io::path_t& path = io::path_t()) override;
 
+    framework::Progress uploadProgress() const override;
+
 private:
     void setupConnections();
 
@@ -169,6 +171,7 @@ private:
 
     framework::ProgressPtr m_uploadingProjectProgress = nullptr;
     framework::ProgressPtr m_uploadingAudioProgress = nullptr;
+    framework::Progress m_uploadProgress;
 
     int m_numberOfSavesToCloud = 0;
 };
@@ -28,6 +28,8 @@
 
 #include "types/bytearray.h"
 
+#include "log.h"
+
 using namespace mu::project;
 using namespace mu::audio;
 using namespace mu::engraving;
@@ -62,6 +64,29 @@ void ProjectAudioSettings::setMasterAudioOutputParams(const AudioOutputParams& p
     setNeedSave(true);
 }
 
+AudioOutputParams ProjectAudioSettings::auxOutputParams(aux_channel_idx_t index) const
+{
+    IF_ASSERT_FAILED(index < m_auxOutputParams.size()) {
+        return {};
+    }
+
+    return m_auxOutputParams[index];
+}
+
+void ProjectAudioSettings::setAuxOutputParams(aux_channel_idx_t index, const AudioOutputParams& params)
+{
+    IF_ASSERT_FAILED(index < m_auxOutputParams.size()) {
+        return;
+    }
+
+    if (m_auxOutputParams[index] == params) {
+        return;
+    }
+
+    m_auxOutputParams[index] = params;
+    setNeedSave(true);
+}
+
 AudioInputParams ProjectAudioSettings::trackInputParams(const InstrumentTrackId& partId) const
 {
     auto search = m_trackInputParamsMap.find(partId);
@@ -104,6 +129,7 @@ void ProjectAudioSettings::setTrackOutputParams(const InstrumentTrackId& partId,
         needSave |= (it->second.volume != params.volume);
         needSave |= (it->second.balance != params.balance);
         needSave |= (it->second.fxChain != params.fxChain);
+        needSave |= (it->second.auxSends != params.auxSends);
     }
 
     m_trackOutputParamsMap.insert_or_assign(partId, params);
@@ -191,6 +217,11 @@ mu::Ret ProjectAudioSettings::read(const engraving::MscReader& reader)
     QJsonObject masterObj = rootObj.value("master").toObject();
     m_masterOutputParams = outputParamsFromJson(masterObj);
 
+    QJsonArray auxArray = rootObj.value("aux").toArray();
+    for (int i = 0; i < auxArray.size() && i < static_cast<int>(m_auxOutputParams.size()); ++i) {
+        m_auxOutputParams[i] = outputParamsFromJson(auxArray.at(i).toObject());
+    }
+
     QJsonArray tracksArray = rootObj.value("tracks").toArray();
 
     for (const QJsonValue value : tracksArray) {
@@ -223,6 +254,13 @@ mu::Ret ProjectAudioSettings::write(engraving::MscWriter& writer)
     QJsonObject rootObj;
     rootObj["master"] = outputParamsToJson(m_masterOutputParams);
 
+    QJsonArray auxArray;
+    for (const AudioOutputParams& params : m_auxOutputParams) {
+        auxArray.append(outputParamsToJson(params));
+    }
+
+    rootObj["aux"] = auxArray;
+
     QJsonArray tracksArray;
     for (const auto& pair : m_trackInputParamsMap) {
         tracksArray.append(buildTrackObject(pair.first));
@@ -260,6 +298,17 @@ AudioOutputParams ProjectAudioSettings::outputParamsFromJson(const QJsonObject&
     result.balance = object.value("balance").toVariant().toFloat();
     result.volume = object.value("volumeDb").toVariant().toFloat();
 
+    const QJsonArray auxSendsArray = object.value("auxSends").toArray();
+    for (const QJsonValue& value : auxSendsArray) {
+        QJsonObject auxSendObject = value.toObject();
+
+        AuxSendParams auxSend;
+        auxSend.signalAmount = auxSendObject.value("signalAmount").toVariant().toFloat();
+        auxSend.active = auxSendObject.value("active").toBool();
+
+        result.auxSends.push_back(auxSend);
+    }
+
     return result;
 }
 
@@ -346,6 +395,18 @@ QJsonObject ProjectAudioSettings::outputParamsToJson(const audio::AudioOutputPar
     result.insert("balance", params.balance);
     result.insert("volumeDb", params.volume);
 
+    if (!params.auxSends.empty()) {
+        QJsonArray auxSendsArray;
+        for (const AuxSendParams& auxSend : params.auxSends) {
+            QJsonObject auxSendObject;
+            auxSendObject.insert("signalAmount", auxSend.signalAmount);
+            auxSendObject.insert("active", auxSend.active);
+            auxSendsArray.append(auxSendObject);
+        }
+
+        result.insert("auxSends", auxSendsArray);
+    }
+
     return result;
 }
 
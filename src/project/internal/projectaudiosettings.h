@@ -22,6 +22,7 @@
 #ifndef MU_PROJECT_PROJECTAUDIOSETTINGS_H
 #define MU_PROJECT_PROJECTAUDIOSETTINGS_H
 
+#include <array>
 #include <memory>
 #include <string>
 
@@ -41,6 +42,9 @@ public:
     audio::AudioOutputParams masterAudioOutputParams() const override;
     void setMasterAudioOutputParams(const audio::AudioOutputParams& params) override;
 
+    audio::AudioOutputParams auxOutputParams(audio::aux_channel_idx_t index) const override;
+    void setAuxOutputParams(audio::aux_channel_idx_t index, const audio::AudioOutputParams& params) override;
+
     audio::AudioInputParams trackInputParams(const engraving::InstrumentTrackId& partId) const override;
     void setTrackInputParams(const engraving::InstrumentTrackId& partId, const audio::AudioInputParams& params) override;
 
@@ -97,6 +101,7 @@ private:
     void setNeedSave(bool needSave);
 
     audio::AudioOutputParams m_masterOutputParams;
+    std::array<audio::AudioOutputParams, audio::AUX_CHANNEL_NUM> m_auxOutputParams;
 
     std::unordered_map<engraving::InstrumentTrackId, audio::AudioInputParams> m_trackInputParamsMap;
     std::unordered_map<engraving::InstrumentTrackId, audio::AudioOutputParams> m_trackOutputParamsMap;
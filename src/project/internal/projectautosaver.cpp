@@ -21,10 +21,15 @@
  */
 #include "projectautosaver.h"
 
+#include "io/buffer.h"
+#include "serialization/zipreader.h"
+#include "serialization/zipwriter.h"
+
 #include "engraving/infrastructure/mscio.h"
 
 #include "log.h"
 
+using namespace mu;
 using namespace mu::project;
 
 void ProjectAutoSaver::init()
@@ -90,6 +95,9 @@ void ProjectAutoSaver::removeProjectUnsavedChanges(const io::path_t& projectPath
         path = projectAutoSavePath(projectPath);
     }
 
+    std::lock_guard<std::mutex> lock(m_backgroundSaveMutex);
+    ++m_saveGeneration;
+
     fileSystem()->remove(path);
 }
 
@@ -114,6 +122,11 @@ mu::io::path_t ProjectAutoSaver::projectAutoSavePath(const io::path_t& projectPa
     return engraving::containerPath(projectPath).appendingSuffix(AUTOSAVE_SUFFIX);
 }
 
+mu::framework::Progress ProjectAutoSaver::autoSaveProgress() const
+{
+    return m_autoSaveProgress;
+}
+
 INotationProjectPtr ProjectAutoSaver::currentProject() const
 {
     return globalContext()->currentProject();
@@ -157,6 +170,13 @@ void ProjectAutoSaver::onTrySave()
     io::path_t projectPath = this->projectPath(project);
     io::path_t savePath = project->isNewlyCreated() ? projectPath : projectAutoSavePath(projectPath);
 
+    if (canSaveInBackground(savePath)) {
+        saveInBackground(project, savePath);
+        return;
+    }
+
+    cancelBackgroundSave();
+
     Ret ret = project->save(savePath, SaveMode::AutoSave);
     if (!ret) {
         LOGE() << "[autosave] failed to save project, err: " << ret.toString();
@@ -166,6 +186,135 @@ void ProjectAutoSaver::onTrySave()
     LOGD() << "[autosave] successfully saved project";
 }
 
+bool ProjectAutoSaver::canSaveInBackground(const io::path_t& savePath) const
+{
+    if (!configuration()->isBackgroundAutoSaveEnabled()) {
+        return false;
+    }
+
+    std::string suffix = io::suffix(savePath);
+    if (suffix == IProjectAutoSaver::AUTOSAVE_SUFFIX) {
+        suffix = io::suffix(io::completeBasename(savePath));
+    }
+
+    //! NOTE Only the compression of the .mscz files is worth moving to the background
+    return suffix == engraving::MSCZ;
+}
+
+void ProjectAutoSaver::saveInBackground(INotationProjectPtr project, const io::path_t& savePath)
+{
+    TRACEFUNC;
+
+    //! NOTE The project is written on the main thread, into an uncompressed container in memory,
+    //! while the compression and writing to the disk are done on the worker
+    RetVal<ByteArray> snapshot = project->writeSnapshot(savePath);
+    if (!snapshot.ret) {
+        LOGE() << "[autosave] failed to write project snapshot, err: " << snapshot.ret.toString();
+        return;
+    }
+
+    uint64_t generation = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_backgroundSaveMutex);
+        generation = ++m_saveGeneration;
+    }
+
+    //! NOTE The file system is taken here, the injections aren't resolved on the workers
+    m_backgroundSaver.submit([this, fs = fileSystem(), data = snapshot.val, savePath, generation]() {
+        m_autoSaveProgress.started.notify();
+
+        Ret ret = writeSnapshot(fs, data, savePath, generation);
+        if (!ret && ret.code() != static_cast<int>(Ret::Code::Cancel)) {
+            LOGE() << "[autosave] failed to save project in background, err: " << ret.toString();
+        }
+
+        m_autoSaveProgress.finished.send(framework::ProgressResult(ret));
+    });
+}
+
+Ret ProjectAutoSaver::writeSnapshot(std::shared_ptr<io::IFileSystem> fs, const ByteArray& snapshot, const io::path_t& savePath,
+                                    uint64_t generation)
+{
+    TRACEFUNC;
+
+    if (isSaveCancelled(generation)) {
+        return make_ret(Ret::Code::Cancel);
+    }
+
+    ByteArray data = snapshot;
+    io::Buffer buf(&data);
+    buf.open(io::IODevice::ReadOnly);
+
+    ZipReader source(&buf);
+    if (source.hasError()) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    io::path_t tempPath = savePath + "_saving";
+    {
+        ZipWriter target(tempPath);
+        target.setCompressionLevel(IProjectAutoSaver::AUTOSAVE_COMPRESSION_LEVEL);
+
+        //! NOTE The files unchanged since the previous autosave are copied from it without recompressing
+        std::unique_ptr<ZipReader> previous;
+        if (fs->exists(savePath)) {
+            previous = std::make_unique<ZipReader>(savePath);
+        }
+
+        std::vector<ZipReader::FileInfo> files = source.fileInfoList();
+        int64_t total = static_cast<int64_t>(files.size());
+        int64_t current = 0;
+
+        for (const ZipReader::FileInfo& info : files) {
+            if (isSaveCancelled(generation)) {
+                target.close();
+                fs->remove(tempPath);
+                return make_ret(Ret::Code::Cancel);
+            }
+
+            if (info.isFile) {
+                std::string name = info.filePath.toStdString();
+                ByteArray fileData = source.fileData(name);
+                if (!previous || !target.addUnchangedFile(*previous, name, fileData)) {
+                    target.addFile(name, fileData);
+                }
+            }
+
+            m_autoSaveProgress.progressChanged.send(++current, total, std::string());
+        }
+
+        target.close();
+        if (target.hasError() || source.hasError()) {
+            fs->remove(tempPath);
+            return make_ret(Ret::Code::UnknownError);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_backgroundSaveMutex);
+    if (isSaveCancelled(generation)) {
+        fs->remove(tempPath);
+        return make_ret(Ret::Code::Cancel);
+    }
+
+    Ret ret = fs->move(tempPath, savePath, true);
+    if (!ret) {
+        fs->remove(tempPath);
+    }
+
+    return ret;
+}
+
+bool ProjectAutoSaver::isSaveCancelled(uint64_t generation) const
+{
+    return m_saveGeneration != generation;
+}
+
+void ProjectAutoSaver::cancelBackgroundSave()
+{
+    std::lock_guard<std::mutex> lock(m_backgroundSaveMutex);
+    ++m_saveGeneration;
+}
+
 mu::io::path_t ProjectAutoSaver::projectPath(INotationProjectPtr project) const
 {
     return project->isNewlyCreated() ? configuration()->newProjectTemporaryPath() : project->path();
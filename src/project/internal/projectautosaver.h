@@ -22,9 +22,13 @@
 #ifndef MU_PROJECT_PROJECTAUTOSAVER_H
 #define MU_PROJECT_PROJECTAUTOSAVER_H
 
+#include <atomic>
+#include <mutex>
+
 #include <QTimer>
 
 #include "async/asyncable.h"
+#include "concurrency/taskscheduler.h"
 
 #include "modularity/ioc.h"
 #include "context/iglobalcontext.h"
@@ -53,6 +57,8 @@ public:
     io::path_t projectOriginalPath(const io::path_t& projectAutoSavePath) const override;
     io::path_t projectAutoSavePath(const io::path_t& projectPath) const override;
 
+    framework::Progress autoSaveProgress() const override;
+
 private:
     INotationProjectPtr currentProject() const;
 
@@ -60,10 +66,26 @@ private:
 
     void onTrySave();
 
+    bool canSaveInBackground(const io::path_t& savePath) const;
+    void saveInBackground(INotationProjectPtr project, const io::path_t& savePath);
+    Ret writeSnapshot(std::shared_ptr<io::IFileSystem> fs, const ByteArray& snapshot, const io::path_t& savePath,
+                      uint64_t generation);
+    bool isSaveCancelled(uint64_t generation) const;
+    void cancelBackgroundSave();
+
     io::path_t projectPath(INotationProjectPtr project) const;
 
     QTimer m_timer;
     io::path_t m_lastProjectPathNeedingAutosave;
+
+    //! NOTE Every new autosave or removal of the unsaved changes cancels the background one,
+    //! the mutex keeps a cancelled save from moving its file into place afterwards
+    std::mutex m_backgroundSaveMutex;
+    std::atomic<uint64_t> m_saveGeneration = 0;
+    framework::Progress m_autoSaveProgress;
+
+    //! NOTE Destroyed first, waits for the background save
+    TaskScheduler m_backgroundSaver { 1 };
 };
 }
 
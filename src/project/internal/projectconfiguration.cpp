@@ -54,6 +54,8 @@ static const Settings::Key PREFERRED_SCORE_CREATION_MODE_KEY(module_name, "proje
 static const Settings::Key MIGRATION_OPTIONS(module_name, "project/migration");
 static const Settings::Key AUTOSAVE_ENABLED_KEY(module_name, "project/autoSaveEnabled");
 static const Settings::Key AUTOSAVE_INTERVAL_KEY(module_name, "project/autoSaveInterval");
+static const Settings::Key BACKGROUND_AUTOSAVE_ENABLED_KEY(module_name, "project/backgroundAutoSaveEnabled");
+static const Settings::Key SNAPSHOT_CACHE_ENABLED_KEY(module_name, "project/snapshotCacheEnabled");
 static const Settings::Key SHOULD_DESTINATION_FOLDER_BE_OPENED_ON_EXPORT(module_name, "project/shouldDestinationFolderBeOpenedOnExport");
 static const Settings::Key OPEN_DETAILED_PROJECT_UPLOADED_DIALOG(module_name, "project/openDetailedProjectUploadedDialog");
 static const Settings::Key HAS_ASKED_AUDIO_GENERATION_SETTINGS(module_name, "project/hasAskedAudioGenerationSettings");
@@ -101,6 +103,9 @@ void ProjectConfiguration::init()
         m_autoSaveIntervalChanged.send(val.toInt());
     });
 
+    settings()->setDefaultValue(BACKGROUND_AUTOSAVE_ENABLED_KEY, Val(true));
+    settings()->setDefaultValue(SNAPSHOT_CACHE_ENABLED_KEY, Val(false));
+
     settings()->setDefaultValue(SHOULD_DESTINATION_FOLDER_BE_OPENED_ON_EXPORT, Val(false));
     settings()->setDefaultValue(OPEN_DETAILED_PROJECT_UPLOADED_DIALOG, Val(true));
     settings()->setDefaultValue(HAS_ASKED_AUDIO_GENERATION_SETTINGS, Val(false));
@@ -574,11 +579,41 @@ async::Channel<int> ProjectConfiguration::autoSaveIntervalChanged() const
     return m_autoSaveIntervalChanged;
 }
 
+bool ProjectConfiguration::isBackgroundAutoSaveEnabled() const
+{
+    return settings()->value(BACKGROUND_AUTOSAVE_ENABLED_KEY).toBool();
+}
+
+void ProjectConfiguration::setBackgroundAutoSaveEnabled(bool enabled)
+{
+    settings()->setSharedValue(BACKGROUND_AUTOSAVE_ENABLED_KEY, Val(enabled));
+}
+
 io::path_t ProjectConfiguration::newProjectTemporaryPath() const
 {
     return globalConfiguration()->userAppDataPath() + "/new_project" + DEFAULT_FILE_SUFFIX;
 }
 
+bool ProjectConfiguration::isSnapshotCacheEnabled() const
+{
+    return settings()->value(SNAPSHOT_CACHE_ENABLED_KEY).toBool();
+}
+
+void ProjectConfiguration::setSnapshotCacheEnabled(bool enabled)
+{
+    settings()->setSharedValue(SNAPSHOT_CACHE_ENABLED_KEY, Val(enabled));
+}
+
+io::path_t ProjectConfiguration::snapshotCachePath() const
+{
+    return globalConfiguration()->userAppDataPath() + "/snapshots";
+}
+
+io::path_t ProjectConfiguration::metaCachePath() const
+{
+    return globalConfiguration()->userAppDataPath() + "/meta_cache";
+}
+
 bool ProjectConfiguration::isAccessibleEnabled() const
 {
     return accessibilityConfiguration()->enabled();
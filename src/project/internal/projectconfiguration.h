@@ -108,8 +108,17 @@ public:
     void setAutoSaveInterval(int minutes) override;
     async::Channel<int> autoSaveIntervalChanged() const override;
 
+    bool isBackgroundAutoSaveEnabled() const override;
+    void setBackgroundAutoSaveEnabled(bool enabled) override;
+
     io::path_t newProjectTemporaryPath() const override;
 
+    bool isSnapshotCacheEnabled() const override;
+    void setSnapshotCacheEnabled(bool enabled) override;
+    io::path_t snapshotCachePath() const override;
+
+    io::path_t metaCachePath() const override;
+
     bool isAccessibleEnabled() const override;
 
     bool shouldDestinationFolderBeOpenedOnExport() const override;
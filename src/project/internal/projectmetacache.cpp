@@ -0,0 +1,176 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "projectmetacache.h"
+
+#include <algorithm>
+
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::io;
+using namespace mu::project;
+
+//! NOTE Increase if the way the meta is read or stored changes
+static const std::string META_CACHE_FORMAT_VERSION("1");
+static const std::string META_SUFFIX(".json");
+static const std::string THUMBNAIL_SUFFIX(".png");
+
+//! NOTE Enough for the recent scores and a few folders of the score lists
+static constexpr size_t MAX_ENTRIES = 200;
+
+bool ProjectMetaCache::load(const io::path_t& filePath, ProjectMeta& meta) const
+{
+    io::path_t path = entryPath(filePath) + META_SUFFIX;
+
+    ByteArray data;
+    if (!fileSystem()->exists(path) || !fileSystem()->readFile(path, data)) {
+        return false;
+    }
+
+    QJsonObject obj = QJsonDocument::fromJson(data.toQByteArrayNoCopy()).object();
+    if (obj.value("path").toString() != filePath.toQString()
+        || obj.value("stamp").toString().toStdString() != fileStamp(filePath)) {
+        return false;
+    }
+
+    meta.title = obj.value("title").toString();
+    meta.subtitle = obj.value("subtitle").toString();
+    meta.composer = obj.value("composer").toString();
+    meta.lyricist = obj.value("lyricist").toString();
+    meta.copyright = obj.value("copyright").toString();
+    meta.translator = obj.value("translator").toString();
+    meta.arranger = obj.value("arranger").toString();
+    meta.partsCount = static_cast<size_t>(obj.value("partsCount").toInt());
+    meta.creationDate = QDate::fromString(obj.value("creationDate").toString(), Qt::ISODate);
+
+    ByteArray thumbnailData;
+    io::path_t thumbnailPath = entryPath(filePath) + THUMBNAIL_SUFFIX;
+    if (fileSystem()->exists(thumbnailPath) && fileSystem()->readFile(thumbnailPath, thumbnailData)) {
+        meta.thumbnail.loadFromData(thumbnailData.toQByteArrayNoCopy(), "PNG");
+    }
+
+    meta.filePath = filePath;
+
+    return true;
+}
+
+void ProjectMetaCache::store(const io::path_t& filePath, const ProjectMeta& meta, const ByteArray& thumbnailData) const
+{
+    std::string stamp = fileStamp(filePath);
+    if (stamp.empty()) {
+        return;
+    }
+
+    Ret ret = fileSystem()->makePath(configuration()->metaCachePath());
+    if (!ret) {
+        LOGW() << "failed create meta cache directory, err: " << ret.toString();
+        return;
+    }
+
+    QJsonObject obj;
+    obj["path"] = filePath.toQString();
+    obj["stamp"] = QString::fromStdString(stamp);
+    obj["title"] = meta.title;
+    obj["subtitle"] = meta.subtitle;
+    obj["composer"] = meta.composer;
+    obj["lyricist"] = meta.lyricist;
+    obj["copyright"] = meta.copyright;
+    obj["translator"] = meta.translator;
+    obj["arranger"] = meta.arranger;
+    obj["partsCount"] = static_cast<int>(meta.partsCount);
+    obj["creationDate"] = meta.creationDate.toString(Qt::ISODate);
+
+    io::path_t path = entryPath(filePath) + META_SUFFIX;
+    io::path_t thumbnailPath = entryPath(filePath) + THUMBNAIL_SUFFIX;
+
+    //! NOTE The thumbnail goes first, the meta makes the entry valid
+    if (thumbnailData.empty()) {
+        fileSystem()->remove(thumbnailPath);
+    } else {
+        fileSystem()->writeFile(thumbnailPath, thumbnailData);
+    }
+
+    ret = fileSystem()->writeFile(path, ByteArray::fromQByteArrayNoCopy(QJsonDocument(obj).toJson(QJsonDocument::Compact)));
+    if (!ret) {
+        LOGW() << "failed write meta cache entry, err: " << ret.toString();
+        return;
+    }
+
+    removeOldEntries();
+}
+
+void ProjectMetaCache::removeOldEntries() const
+{
+    RetVal<io::paths_t> entries = fileSystem()->scanFiles(configuration()->metaCachePath(), { "*" + META_SUFFIX },
+                                                          ScanMode::FilesInCurrentDir);
+    if (!entries.ret || entries.val.size() <= MAX_ENTRIES) {
+        return;
+    }
+
+    // ISO dates are ordered like strings, the newest entries first
+    std::vector<std::pair<String, io::path_t> > dated;
+    for (const io::path_t& path : entries.val) {
+        dated.push_back({ fileSystem()->lastModified(path).toString(), path });
+    }
+    std::sort(dated.begin(), dated.end(), [](const auto& a, const auto& b) {
+        return a.first > b.first;
+    });
+
+    for (size_t i = MAX_ENTRIES; i < dated.size(); ++i) {
+        const io::path_t& path = dated.at(i).second;
+        fileSystem()->remove(path);
+
+        std::string thumbnailPath = path.toStdString();
+        thumbnailPath.replace(thumbnailPath.size() - META_SUFFIX.size(), META_SUFFIX.size(), THUMBNAIL_SUFFIX);
+        fileSystem()->remove(io::path_t(thumbnailPath));
+    }
+}
+
+io::path_t ProjectMetaCache::entryPath(const io::path_t& filePath) const
+{
+    std::string key = filePath.toStdString() + META_CACHE_FORMAT_VERSION;
+    ByteArray hash = cryptographicHash()->hash(ByteArray(key.c_str(), key.size()), ICryptographicHash::Algorithm::Md4);
+
+    static const char HEX[] = "0123456789abcdef";
+    std::string name;
+    name.reserve(hash.size() * 2);
+    for (size_t i = 0; i < hash.size(); ++i) {
+        uint8_t b = hash.at(i);
+        name.push_back(HEX[b >> 4]);
+        name.push_back(HEX[b & 0x0f]);
+    }
+
+    return configuration()->metaCachePath() + "/" + io::path_t(name);
+}
+
+std::string ProjectMetaCache::fileStamp(const io::path_t& filePath) const
+{
+    RetVal<uint64_t> size = fileSystem()->fileSize(filePath);
+    if (!size.ret) {
+        return std::string();
+    }
+
+    return fileSystem()->lastModified(filePath).toString().toStdString() + "/" + std::to_string(size.val);
+}
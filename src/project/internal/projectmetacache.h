@@ -0,0 +1,58 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_PROJECT_PROJECTMETACACHE_H
+#define MU_PROJECT_PROJECTMETACACHE_H
+
+#include "modularity/ioc.h"
+#include "global/icryptographichash.h"
+#include "io/ifilesystem.h"
+#include "iprojectconfiguration.h"
+
+#include "types/bytearray.h"
+#include "projecttypes.h"
+
+namespace mu::project {
+//! NOTE Keeps the meta and the thumbnails read from the score files,
+//! so that the lists of the scores don't open each of them every time.
+//! An entry is keyed by the path of its file and is valid while the file
+//! has the same modification time and size. The entries written longest ago
+//! are removed over the limit
+class ProjectMetaCache
+{
+    INJECT(project, IProjectConfiguration, configuration)
+    INJECT(project, io::IFileSystem, fileSystem)
+    INJECT(project, ICryptographicHash, cryptographicHash)
+
+public:
+    ProjectMetaCache() = default;
+
+    bool load(const io::path_t& filePath, ProjectMeta& meta) const;
+    void store(const io::path_t& filePath, const ProjectMeta& meta, const ByteArray& thumbnailData) const;
+
+private:
+    io::path_t entryPath(const io::path_t& filePath) const;
+    std::string fileStamp(const io::path_t& filePath) const;
+    void removeOldEntries() const;
+};
+}
+
+#endif // MU_PROJECT_PROJECTMETACACHE_H
@@ -0,0 +1,147 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "projectsnapshotcache.h"
+
+#include <algorithm>
+
+#include "serialization/zipreader.h"
+#include "serialization/zipwriter.h"
+
+#include "log.h"
+
+using namespace mu;
+using namespace mu::io;
+using namespace mu::project;
+
+//! NOTE Increase if the way the snapshots are written changes
+static const std::string SNAPSHOT_FORMAT_VERSION("1");
+static const std::string SNAPSHOT_SUFFIX(".mscz");
+
+static constexpr size_t MAX_SNAPSHOTS = 20;
+
+std::string ProjectSnapshotCache::snapshotKey(const io::path_t& filePath) const
+{
+    ByteArray data;
+    if (!fileSystem()->readFile(filePath, data)) {
+        return std::string();
+    }
+
+    data.push_back(reinterpret_cast<const uint8_t*>(SNAPSHOT_FORMAT_VERSION.c_str()), SNAPSHOT_FORMAT_VERSION.size());
+    ByteArray hash = cryptographicHash()->hash(data, ICryptographicHash::Algorithm::Md4);
+
+    static const char HEX[] = "0123456789abcdef";
+    std::string key;
+    key.reserve(hash.size() * 2);
+    for (size_t i = 0; i < hash.size(); ++i) {
+        uint8_t b = hash.at(i);
+        key.push_back(HEX[b >> 4]);
+        key.push_back(HEX[b & 0x0f]);
+    }
+    return key;
+}
+
+io::path_t ProjectSnapshotCache::snapshotPath(const std::string& key) const
+{
+    return configuration()->snapshotCachePath() + "/" + io::path_t(key + SNAPSHOT_SUFFIX);
+}
+
+bool ProjectSnapshotCache::hasSnapshot(const std::string& key) const
+{
+    if (key.empty()) {
+        return false;
+    }
+    return fileSystem()->exists(snapshotPath(key));
+}
+
+Ret ProjectSnapshotCache::storeSnapshot(const std::string& key, const io::path_t& filePath) const
+{
+    TRACEFUNC;
+
+    IF_ASSERT_FAILED(!key.empty()) {
+        return make_ret(Ret::Code::InternalError);
+    }
+
+    Ret ret = fileSystem()->makePath(configuration()->snapshotCachePath());
+    if (!ret) {
+        return ret;
+    }
+
+    ZipReader source(filePath);
+    if (source.hasError()) {
+        return make_ret(Ret::Code::UnknownError);
+    }
+
+    //! NOTE Written next to the snapshot first, so that a broken snapshot is never taken
+    io::path_t path = snapshotPath(key);
+    io::path_t tempPath = path + ".tmp";
+    {
+        ZipWriter snapshot(tempPath);
+        snapshot.setCompressionEnabled(false);
+
+        for (const ZipReader::FileInfo& info : source.fileInfoList()) {
+            if (!info.isFile) {
+                continue;
+            }
+
+            std::string name = info.filePath.toStdString();
+            snapshot.addFile(name, source.fileData(name));
+        }
+
+        snapshot.close();
+        if (snapshot.hasError() || source.hasError()) {
+            fileSystem()->remove(tempPath);
+            return make_ret(Ret::Code::UnknownError);
+        }
+    }
+
+    ret = fileSystem()->move(tempPath, path, true);
+    if (!ret) {
+        fileSystem()->remove(tempPath);
+        return ret;
+    }
+
+    removeOldSnapshots();
+
+    return make_ok();
+}
+
+void ProjectSnapshotCache::removeOldSnapshots() const
+{
+    RetVal<io::paths_t> snapshots = fileSystem()->scanFiles(configuration()->snapshotCachePath(), { "*" + SNAPSHOT_SUFFIX },
+                                                            ScanMode::FilesInCurrentDir);
+    if (!snapshots.ret || snapshots.val.size() <= MAX_SNAPSHOTS) {
+        return;
+    }
+
+    // ISO dates are ordered like strings, the newest snapshots first
+    std::vector<std::pair<String, io::path_t> > dated;
+    for (const io::path_t& path : snapshots.val) {
+        dated.push_back({ fileSystem()->lastModified(path).toString(), path });
+    }
+    std::sort(dated.begin(), dated.end(), [](const auto& a, const auto& b) {
+        return a.first > b.first;
+    });
+
+    for (size_t i = MAX_SNAPSHOTS; i < dated.size(); ++i) {
+        fileSystem()->remove(dated.at(i).second);
+    }
+}
@@ -0,0 +1,61 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef MU_PROJECT_PROJECTSNAPSHOTCACHE_H
+#define MU_PROJECT_PROJECTSNAPSHOTCACHE_H
+
+#include <string>
+
+#include "modularity/ioc.h"
+#include "global/icryptographichash.h"
+#include "io/ifilesystem.h"
+#include "iprojectconfiguration.h"
+
+#include "types/ret.h"
+
+namespace mu::project {
+//! NOTE Keeps uncompressed copies (snapshots) of recently opened .mscz files,
+//! so that reopening them maps the files and skips the decompression.
+//! A snapshot is keyed by a hash of the content of its file,
+//! the file itself stays the source of truth and any change of it invalidates the snapshot
+class ProjectSnapshotCache
+{
+    INJECT(project, IProjectConfiguration, configuration)
+    INJECT(project, io::IFileSystem, fileSystem)
+    INJECT(project, ICryptographicHash, cryptographicHash)
+
+public:
+    ProjectSnapshotCache() = default;
+
+    //! NOTE Empty if the file can't be read
+    std::string snapshotKey(const io::path_t& filePath) const;
+
+    io::path_t snapshotPath(const std::string& key) const;
+    bool hasSnapshot(const std::string& key) const;
+
+    Ret storeSnapshot(const std::string& key, const io::path_t& filePath) const;
+
+private:
+    void removeOldSnapshots() const;
+};
+}
+
+#endif // MU_PROJECT_PROJECTSNAPSHOTCACHE_H
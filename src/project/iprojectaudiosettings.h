@@ -38,6 +38,9 @@ public:
     virtual audio::AudioOutputParams masterAudioOutputParams() const = 0;
     virtual void setMasterAudioOutputParams(const audio::AudioOutputParams& params) = 0;
 
+    virtual audio::AudioOutputParams auxOutputParams(audio::aux_channel_idx_t index) const = 0;
+    virtual void setAuxOutputParams(audio::aux_channel_idx_t index, const audio::AudioOutputParams& params) = 0;
+
     virtual audio::AudioInputParams trackInputParams(const engraving::InstrumentTrackId& trackId) const = 0;
     virtual void setTrackInputParams(const engraving::InstrumentTrackId& trackId, const audio::AudioInputParams& params) = 0;
 
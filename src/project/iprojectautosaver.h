@@ -23,6 +23,7 @@
 #define MU_PROJECT_IPROJECTAUTOSAVER_H
 
 #include "io/path.h"
+#include "progress.h"
 
 #include "modularity/imoduleexport.h"
 
@@ -42,7 +43,13 @@ public:
     virtual io::path_t projectOriginalPath(const io::path_t& projectAutoSavePath) const = 0;
     virtual io::path_t projectAutoSavePath(const io::path_t& projectPath) const = 0;
 
+    //! NOTE Reports the autosaves which are written in the background
+    virtual framework::Progress autoSaveProgress() const = 0;
+
     static inline const std::string AUTOSAVE_SUFFIX = "autosave";
+
+    //! NOTE The fastest one, the autosaves are written often and read rarely
+    static constexpr int AUTOSAVE_COMPRESSION_LEVEL = 1;
 };
 }
 
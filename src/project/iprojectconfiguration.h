@@ -106,8 +106,17 @@ public:
     virtual void setAutoSaveInterval(int minutes) = 0;
     virtual async::Channel<int> autoSaveIntervalChanged() const = 0;
 
+    virtual bool isBackgroundAutoSaveEnabled() const = 0;
+    virtual void setBackgroundAutoSaveEnabled(bool enabled) = 0;
+
     virtual io::path_t newProjectTemporaryPath() const = 0;
 
+    virtual bool isSnapshotCacheEnabled() const = 0;
+    virtual void setSnapshotCacheEnabled(bool enabled) = 0;
+    virtual io::path_t snapshotCachePath() const = 0;
+
+    virtual io::path_t metaCachePath() const = 0;
+
     virtual bool isAccessibleEnabled() const = 0;
 
     virtual bool shouldDestinationFolderBeOpenedOnExport() const = 0;
@@ -25,6 +25,7 @@
 #include "modularity/imoduleexport.h"
 #include "types/ret.h"
 #include "io/path.h"
+#include "progress.h"
 
 namespace mu::project {
 class IProjectFilesController : MODULE_EXPORT_INTERFACE
@@ -40,6 +41,9 @@ public:
     virtual bool isProjectOpened(const io::path_t& path) const = 0;
     virtual bool isAnyProjectOpened() const = 0;
     virtual bool saveProject(const io::path_t& path = io::path_t()) = 0;
+
+    //! NOTE The progress of the score and audio uploads to the cloud, its message is the upload rate
+    virtual framework::Progress uploadProgress() const = 0;
 };
 }
 
@@ -43,6 +43,7 @@
 
 #include "view/exportdialogmodel.h"
 #include "view/exportprogressmodel.h"
+#include "view/uploadprogressmodel.h"
 #include "view/recentprojectsmodel.h"
 #include "view/scorethumbnail.h"
 #include "view/templatesmodel.h"
@@ -139,6 +140,7 @@ void ProjectModule::registerUiTypes()
 {
     qmlRegisterType<ExportDialogModel>("MuseScore.Project", 1, 0, "ExportDialogModel");
     qmlRegisterType<ExportProgressModel>("MuseScore.Project", 1, 0, "ExportProgressModel");
+    qmlRegisterType<UploadProgressModel>("MuseScore.Project", 1, 0, "UploadProgressModel");
 
     qmlRegisterType<RecentProjectsModel>("MuseScore.Project", 1, 0, "RecentScoresModel");
     qmlRegisterType<NewScoreModel>("MuseScore.Project", 1, 0, "NewScoreModel");
@@ -29,13 +29,21 @@ StyledDialogView {
     id: root
 
     contentWidth: 314
-    contentHeight: 52
+    contentHeight: 100
     margins: 12
 
     modal: true
     frameless: true
     closeOnEscape: false
 
+    UploadProgressModel {
+        id: model
+    }
+
+    Component.onCompleted: {
+        model.load()
+    }
+
     ColumnLayout {
         anchors.fill: parent
 
@@ -48,5 +56,16 @@ StyledDialogView {
             text: qsTrc("project", "Saving online…")
             font: ui.theme.largeBodyBoldFont
         }
+
+        ProgressBar {
+            Layout.fillWidth: true
+            Layout.preferredHeight: 30
+
+            from: 0
+            to: model.totalProgress
+            value: model.progress
+
+            progressStatus: model.rate
+        }
     }
 }
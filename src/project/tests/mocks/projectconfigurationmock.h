@@ -90,8 +90,17 @@ public:
     MOCK_METHOD(void, setAutoSaveInterval, (int), (override));
     MOCK_METHOD(async::Channel<int>, autoSaveIntervalChanged, (), (const, override));
 
+    MOCK_METHOD(bool, isBackgroundAutoSaveEnabled, (), (const, override));
+    MOCK_METHOD(void, setBackgroundAutoSaveEnabled, (bool), (override));
+
     MOCK_METHOD(io::path_t, newProjectTemporaryPath, (), (const, override));
 
+    MOCK_METHOD(bool, isSnapshotCacheEnabled, (), (const, override));
+    MOCK_METHOD(void, setSnapshotCacheEnabled, (bool), (override));
+    MOCK_METHOD(io::path_t, snapshotCachePath, (), (const, override));
+
+    MOCK_METHOD(io::path_t, metaCachePath, (), (const, override));
+
     MOCK_METHOD(bool, isAccessibleEnabled, (), (const, override));
 
     MOCK_METHOD(bool, shouldDestinationFolderBeOpenedOnExport, (), (const, override));
@@ -0,0 +1,60 @@
+/*
+ * SPDX-License-Identifier: GPL-3.0-only
+ * MuseScore-CLA-applies
+ *
+ * MuseScore
+ * Music Composition & Notation
+ *
+ * Copyright (C) 2021 MuseScore BVBA and others
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 3 as
+ * published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "uploadprogressmodel.h"
+
+using namespace mu::project;
+using namespace mu::framework;
+
+UploadProgressModel::UploadProgressModel(QObject* parent)
+    : QObject(parent)
+{
+}
+
+int UploadProgressModel::progress() const
+{
+    return m_progress;
+}
+
+int UploadProgressModel::totalProgress() const
+{
+    return m_totalProgress;
+}
+
+QString UploadProgressModel::rate() const
+{
+    return m_rate;
+}
+
+void UploadProgressModel::load()
+{
+    Progress progress = projectFilesController()->uploadProgress();
+
+    //! NOTE The score and the audio are uploaded one after another, each one from zero
+    progress.progressChanged.onReceive(this, [this](int64_t current, int64_t total, const std::string& message) {
+        //! NOTE The bytes may not fit into the int of QML
+        m_progress = total > 0 ? static_cast<int>(current * 100 / total) : 0;
+        m_totalProgress = total > 0 ? 100 : 0;
+        m_rate = QString::fromStdString(message);
+        emit progressChanged();
+    });
+}
@@ -76,6 +76,33 @@ samples_t AudioConfigurationStub::renderStep() const
     return 0;
 }
 
+bool AudioConfigurationStub::isLowLatencyModeEnabled() const
+{
+    return false;
+}
+
+void AudioConfigurationStub::setLowLatencyModeEnabled(bool)
+{
+}
+
+bool AudioConfigurationStub::isAutoFreezeEnabled() const
+{
+    return false;
+}
+
+void AudioConfigurationStub::setAutoFreezeEnabled(bool)
+{
+}
+
+size_t AudioConfigurationStub::frozenTracksMemoryLimitMb() const
+{
+    return 0;
+}
+
+void AudioConfigurationStub::setFrozenTracksMemoryLimitMb(size_t)
+{
+}
+
 unsigned int AudioConfigurationStub::sampleRate() const
 {
     return 0;
@@ -55,7 +55,7 @@ mu::Ret WorkspaceFile::load()
         return data.ret;
     }
 
-    QByteArray ba = data.val.toQByteArrayNoCopy();
+    QByteArray ba = data.val.toQByteArray();
     QBuffer buf(&ba);
     buf.open(QIODevice::ReadOnly);
     MQZipReader zip(&buf);
@@ -66,11 +66,14 @@ mu::Ret WorkspaceFile::load()
         return make_ret(Err::FailedUnPack);
     }
 
+    //! NOTE Only the central directory is read here
+    m_packedData.clear();
     QVector<MQZipReader::FileInfo> files = zip.fileInfoList();
     for (const MQZipReader::FileInfo& fi : files) {
         if (fi.isFile) {
-            QByteArray fdata = zip.fileData(fi.filePath);
-            m_data[fi.filePath.toStdString()] = fdata;
+            std::string name = fi.filePath.toStdString();
+            m_data.erase(name);
+            m_packedData.insert(name);
         }
     }
 
@@ -80,11 +83,42 @@ mu::Ret WorkspaceFile::load()
     }
 
     zip.close();
+
+    m_fileData = ba;
+
     return make_ret(Ret::Code::Ok);
 }
 
+QByteArray WorkspaceFile::unpackData(const std::string& name) const
+{
+    QBuffer buf;
+    buf.setData(m_fileData);
+    buf.open(QIODevice::ReadOnly);
+    MQZipReader zip(&buf);
+
+    QByteArray data = zip.fileData(QString::fromStdString(name));
+    if (zip.status() != MQZipReader::NoError) {
+        LOGE() << "failed read data: " << name << ", status: " << zip.status();
+    }
+
+    zip.close();
+    return data;
+}
+
+void WorkspaceFile::unpackAllData()
+{
+    for (const std::string& name : m_packedData) {
+        m_data[name] = unpackData(name);
+    }
+
+    m_packedData.clear();
+    m_fileData.clear();
+}
+
 mu::Ret WorkspaceFile::save()
 {
+    unpackAllData();
+
     std::vector<std::string> paths;
     for (const auto& d : m_data) {
         paths.push_back(d.first);
@@ -233,10 +267,20 @@ QByteArray WorkspaceFile::data(const std::string& name) const
     if (it != m_data.end()) {
         return it->second;
     }
+
+    auto packedIt = m_packedData.find(name);
+    if (packedIt != m_packedData.end()) {
+        QByteArray data = unpackData(name);
+        m_data[name] = data;
+        m_packedData.erase(packedIt);
+        return data;
+    }
+
     return QByteArray();
 }
 
 void WorkspaceFile::setData(const std::string& name, const QByteArray& data)
 {
     m_data[name] = data;
+    m_packedData.erase(name);
 }
@@ -24,6 +24,7 @@
 
 #include <string>
 #include <map>
+#include <set>
 #include <QByteArray>
 
 #include "io/ifilesystem.h"
@@ -55,6 +56,9 @@ public:
 
 private:
 
+    QByteArray unpackData(const std::string& name) const;
+    void unpackAllData();
+
     struct Container
     {
         static void write(MQZipWriter& zip, const std::vector<std::string>& paths);
@@ -68,7 +72,11 @@ private:
 
     io::path_t m_filePath;
     std::map<std::string, Val> m_meta;
-    std::map<std::string, QByteArray> m_data;
+
+    //! NOTE Only the meta is read on the load, the data are unpacked from the file on the first request
+    QByteArray m_fileData;
+    mutable std::set<std::string> m_packedData;
+    mutable std::map<std::string, QByteArray> m_data;
 };
 }
 
@@ -0,0 +1,80 @@
+#!/usr/bin/env bash
+# SPDX-License-Identifier: GPL-3.0-only
+# MuseScore-CLA-applies
+#
+# MuseScore
+# Music Composition & Notation
+#
+# Copyright (C) 2021 MuseScore BVBA and others
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License version 3 as
+# published by the Free Software Foundation.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+echo "MuseScore VTest Layout Benchmark"
+
+set -o pipefail
+
+HERE="$(dirname ${BASH_SOURCE[0]})"
+SCORES_DIR="$HERE/scores"
+OUTPUT_DIR="./vtest_benchmark"
+MSCORE_BIN=build.release/install/bin/mscore
+TIME_BIN=/usr/bin/time
+DPI=180
+
+while [[ "$#" -gt 0 ]]; do
+    case $1 in
+        -s|--scores) SCORES_DIR="$2"; shift ;;
+        -o|--output-dir) OUTPUT_DIR="$2"; shift ;;
+        -m|--mscore) MSCORE_BIN="$2"; shift ;;
+        -t|--time) TIME_BIN="$2"; shift ;;
+        *) echo "Unknown parameter passed: $1"; exit 1 ;;
+    esac
+    shift
+done
+
+echo "::group::Configuration:"
+echo "SCORES_DIR: $SCORES_DIR"
+echo "OUTPUT_DIR: $OUTPUT_DIR"
+echo "MSCORE_BIN: $MSCORE_BIN"
+echo "TIME_BIN: $TIME_BIN"
+echo "DPI: $DPI"
+echo "::endgroup::"
+
+rm -rf $OUTPUT_DIR
+mkdir -p $OUTPUT_DIR/layout $OUTPUT_DIR/pngs
+
+LOG_FILE=$OUTPUT_DIR/benchmark.log
+SUMMARY_FILE=$OUTPUT_DIR/summary.csv
+
+# Per score:
+#  layout/<score>.json  time of the layout phases of a full layout (see --score-layout-stats)
+#  summary.csv          wall time (s) and peak memory (kB) of the process laying out the score,
+#                       and of the one laying out and painting it to png
+echo "score,layout_s,layout_peak_kb,paint_s,paint_peak_kb" > $SUMMARY_FILE
+
+echo "::group::Running benchmark"
+SCORES_LIST=$(ls -p $SCORES_DIR | grep -v /)
+for score in $SCORES_LIST ; do
+    NAME=${score%.*}
+
+    LAYOUT_TIME=$($TIME_BIN -f "%e,%M" -o /dev/stdout \
+        $MSCORE_BIN --score-layout-stats $SCORES_DIR/$score -o $OUTPUT_DIR/layout/$NAME.json 2>>$LOG_FILE | tail -n 1)
+    PAINT_TIME=$($TIME_BIN -f "%e,%M" -o /dev/stdout \
+        $MSCORE_BIN $SCORES_DIR/$score -o $OUTPUT_DIR/pngs/$NAME.png -r $DPI 2>>$LOG_FILE | tail -n 1)
+
+    echo "$NAME,$LAYOUT_TIME,$PAINT_TIME" | tee -a $SUMMARY_FILE
+done
+echo "::endgroup::"
+
+echo "::group::Total:"
+awk -F, 'NR > 1 { layout += $2; paint += $4; if ($3 > peak) peak = $3 }
+         END { printf "layout: %.2f s, painting: %.2f s, peak memory: %d kB\n", layout, paint, peak }' $SUMMARY_FILE
+echo "::endgroup::"
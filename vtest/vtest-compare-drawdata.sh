@@ -0,0 +1,114 @@
+#!/usr/bin/env bash
+# SPDX-License-Identifier: GPL-3.0-only
+# MuseScore-CLA-applies
+#
+# MuseScore
+# Music Composition & Notation
+#
+# Copyright (C) 2022 MuseScore BVBA and others
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License version 3 as
+# published by the Free Software Foundation.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+echo "MuseScore VTest Compare DrawData"
+
+set -o pipefail
+
+HERE="$(dirname ${BASH_SOURCE[0]})"
+CURRENT_DIR="./current_drawdata"
+REFERENCE_DIR="./reference_drawdata"
+OUTPUT_DIR="./comparison"
+MSCORE_BIN=build.debug/install/bin/mscore
+
+while [[ "$#" -gt 0 ]]; do
+    case $1 in
+        -c|--current-dir) CURRENT_DIR="$2"; shift ;;
+        -r|--reference-dir) REFERENCE_DIR="$2"; shift ;;
+        -o|--output-dir) OUTPUT_DIR="$2"; shift ;;
+        -m|--mscore) MSCORE_BIN="$2"; shift ;;
+        *) echo "Unknown parameter passed: $1"; exit 1 ;;
+    esac
+    shift
+done
+
+echo "::group::Configuration:"
+echo "CURRENT_DIR: $CURRENT_DIR"
+echo "REFERENCE_DIR: $REFERENCE_DIR"
+echo "OUTPUT_DIR: $OUTPUT_DIR"
+echo "MSCORE_BIN: $MSCORE_BIN"
+echo "::endgroup::"
+
+rm -rf $OUTPUT_DIR
+mkdir -p $OUTPUT_DIR
+
+LOG_FILE=$OUTPUT_DIR/compare.log
+
+# The pages are compared structurally, only the different ones are rasterized:
+# <page>.ref.png, <page>.png and <page>.diff.png
+echo "::group::Comparing DrawData files"
+$MSCORE_BIN --diagnostic-com-drawdata $REFERENCE_DIR --diagnostic-com-drawdata $CURRENT_DIR --diagnostic-output $OUTPUT_DIR 2>&1 | tee $LOG_FILE && SUCCESS="true"
+echo "::endgroup::"
+
+if [ -z "$SUCCESS" ]; then
+    echo -e "\033[0;31mComparing DrawData failed!\033[0m"
+    exit 1
+fi
+
+DIFF_NAME_LIST=""
+for PNG_FILE in $(ls $OUTPUT_DIR/*.png 2>/dev/null | grep -v "\.ref\.png$" | grep -v "\.diff\.png$") ; do
+    png_file_name=$(basename $PNG_FILE)
+    DIFF_NAME_LIST+=" "${png_file_name%.png}
+done
+for PNG_FILE in $(ls $OUTPUT_DIR/*.ref.png 2>/dev/null) ; do
+    png_file_name=$(basename $PNG_FILE)
+    FILE_NAME=${png_file_name%.ref.png}
+    if ! test -f $OUTPUT_DIR/$FILE_NAME.png; then
+        DIFF_NAME_LIST+=" "$FILE_NAME
+    fi
+done
+
+# Generate html report
+if [ -n "$DIFF_NAME_LIST" ]; then
+    export VTEST_DIFF_FOUND=true
+    echo "VTEST_DIFF_FOUND=$VTEST_DIFF_FOUND" >> $GITHUB_ENV
+
+    echo "Generate html report"
+    HTML=$OUTPUT_DIR/vtest_compare.html
+    rm -f $HTML
+    cp $HERE/style.css $OUTPUT_DIR
+    echo "<html>" >> $HTML
+    echo "  <head>" >> $HTML
+    echo "   <link rel=\"stylesheet\" type=\"text/css\" href=\"style.css\">" >> $HTML
+    echo "  </head>" >> $HTML
+    echo "  <body>" >> $HTML
+    echo "    <div id=\"topbar\">" >> $HTML
+    echo "      <span>Reference</span>" >> $HTML
+    echo "      <span>Current</span>" >> $HTML
+    echo "      <span>Diff</span>" >> $HTML
+    echo "    </div>" >> $HTML
+    echo "    <div id=\"topmargin\"></div>" >> $HTML
+
+    for DIFF_NAME in $DIFF_NAME_LIST ; do
+        echo "Different: $DIFF_NAME"
+        echo "    <h2 id=\"$DIFF_NAME\">$DIFF_NAME <a class=\"toc-anchor\" href=\"#$DIFF_NAME\">#</a></h2>" >> $HTML
+        echo "    <div>" >> $HTML
+        echo "      <img src=\"$DIFF_NAME.ref.png\">" >> $HTML
+        echo "      <img src=\"$DIFF_NAME.png\">" >> $HTML
+        echo "      <img src=\"$DIFF_NAME.diff.png\">" >> $HTML
+        echo "    </div>" >> $HTML
+    done
+
+    echo "  </body>" >> $HTML
+    echo "</html>" >> $HTML
+
+else
+    rm -rf $OUTPUT_DIR
+fi